@@ -0,0 +1,10 @@
+import os
+import sys
+
+def f():
+    import os
+    return sys.argv
+
+import os
+from sys import argv
+from sys import argv
@@ -0,0 +1,13 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+O="--quiet --options=NONE --extras=+r --fields=+r"
+
+echo "# without aggregation"
+${CTAGS} $O -o - input.py
+echo "# with aggregation"
+${CTAGS} $O --aggregate-references -o - input.py
+echo "# with aggregation, without the fields"
+${CTAGS} $O --aggregate-references --fields=-{refcount}{reflines} -o - input.py
@@ -0,0 +1,49 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE"
+
+compare()
+{
+	local msg=$1
+	shift
+	local a=$BUILDDIR/tags.at-once
+	local b=$BUILDDIR/tags.appended
+	rm -f $a $b
+	${CTAGS} $O -o $a "$@" src/a.c src/b.c
+	${CTAGS} $O -o $b "$@" src/a.c
+	${CTAGS} $O -a -o $b "$@" src/b.c
+	if cmp -s $a $b; then
+		echo "$msg: same"
+	else
+		echo "$msg: different"
+	fi
+	rm -f $a $b
+}
+
+compare "sorted"
+compare "foldcase" --sort=foldcase
+compare "spilled" --sort-memory-limit=1
+
+# The file says it is sorted but it isn't.
+T=$BUILDDIR/tags.unsorted
+rm -f $T
+${CTAGS} $O -o $T src/a.c
+{ grep '^!' $T; grep -v '^!' $T | sort -r; } > $T.tmp
+mv $T.tmp $T
+${CTAGS} $O -a -o $T src/b.c
+grep -v '^!' $T
+rm -f $T
+
+# The file is sorted another way.
+${CTAGS} $O --sort=no -o $T src/a.c
+${CTAGS} $O -a -o $T src/b.c
+grep '^!_TAG_FILE_SORTED' $T | cut -f1-2
+grep -v '^!' $T
+rm -f $T
+exit 0
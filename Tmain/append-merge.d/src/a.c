@@ -0,0 +1,3 @@
+int a0;
+void a1 (void) { }
+int B2;
@@ -0,0 +1,3 @@
+int b0;
+struct b1 { int m; };
+int A2;
@@ -0,0 +1,46 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE --pseudo-tags=TAG_FILE_SORTED"
+T=$BUILDDIR/tags.replace
+A=$BUILDDIR/a.c
+B=$BUILDDIR/b.c
+
+rm -f $T $A $B
+cp src/a.c $A
+cp src/b.c $B
+
+${CTAGS} $O -o $T $A $B src/c.c
+
+echo '# a.c changed'
+echo 'int a2;' > $A
+${CTAGS} $O --append=replace -o $T $A
+sed -e "s|$BUILDDIR/||" $T | cut -f1-2
+
+echo '# b.c emptied'
+: > $B
+${CTAGS} $O --append=replace -o $T $B
+sed -e "s|$BUILDDIR/||" $T | cut -f1-2
+
+echo '# plain append keeps the old tags'
+echo 'int a3;' > $A
+${CTAGS} $O --append=yes -o $T $A
+sed -e "s|$BUILDDIR/||" $T | cut -f1-2
+
+echo '# the tag file is unsorted'
+${CTAGS} $O --sort=no -o $T src/c.c $A
+${CTAGS} $O --append=replace -o $T src/c.c
+sed -e "s|$BUILDDIR/||" $T | cut -f1-2
+
+echo '# errors'
+${CTAGS} $O --append=replace -e -o $T src/c.c
+${CTAGS} $O --append=replace --sort=no -o $T src/c.c
+${CTAGS} $O --append=other -o $T src/c.c
+
+rm -f $T $A $B
+exit 0
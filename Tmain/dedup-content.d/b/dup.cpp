@@ -0,0 +1,2 @@
+struct { int x; } v;
+int f (void) { return 0; }
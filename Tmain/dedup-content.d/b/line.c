@@ -0,0 +1,3 @@
+int g;
+#line 10 "gen.y"
+int h;
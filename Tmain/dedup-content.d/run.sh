@@ -0,0 +1,22 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+O="--quiet --options=NONE --extras=-p --sort=yes"
+
+echo '# tags'
+${CTAGS} $O --dedup-content --line-directives -R -o - a b
+
+echo '# replayed'
+${CTAGS} $O --dedup-content --line-directives --verbose -R -o - a b 2>&1 \
+	| grep -e '^tagging' | sort
+
+echo '# totals'
+${CTAGS} $O --dedup-content --line-directives --totals=yes -R -o - a b 2>&1 >/dev/null \
+	| grep -e 'same contents'
+
+echo '# incompatible options'
+${CTAGS} $O --dedup-content -x a/dup.c
+${CTAGS} $O --dedup-content --extras=+f -o - a/dup.c > /dev/null
+exit 0
@@ -0,0 +1,3 @@
+int b;
+int c;
+void g (void) { }
@@ -0,0 +1,3 @@
+int a;
+int b;
+void f (void) { }
@@ -0,0 +1,42 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE --pseudo-tags=-TAG_PROC_CWD"
+B=$BUILDDIR/delta
+
+rm -f $B.*
+${CTAGS} $O -o $B.tags input.c
+
+echo "# adding input-2.c"
+${CTAGS} $O --delta=$B.tags -o $B.tags input.c input-2.c
+cat $B.tags.delta
+test -e $B.tags.prev && echo "the previous tag file is left"
+
+echo "# removing input.c"
+cp $B.tags $B.old
+${CTAGS} $O --delta=$B.old -o $B.tags input-2.c
+cat $B.tags.delta
+
+echo "# no change"
+${CTAGS} $O --delta=$B.tags -o $B.tags input-2.c
+cat $B.tags.delta
+
+echo "# --merge"
+${CTAGS} $O -o $B.1 input.c
+${CTAGS} $O --merge --delta=$B.tags -o $B.tags $B.1 $B.old
+cat $B.tags.delta
+
+echo "# errors"
+{
+	${CTAGS} $O --delta=$B.tags -o - input.c
+	${CTAGS} $O --delta=$B.tags -o $B.2 -u input.c
+	${CTAGS} $O --delta=$B.tags -o $B.2 -a input.c
+	${CTAGS} $O --delta= -o $B.2 input.c
+	sort -r $B.tags > $B.r
+	${CTAGS} $O --delta=$B.r -o $B.2 input.c
+} 2>&1 | sed "s|$B|delta|g"
+
+rm -f $B.*
@@ -0,0 +1,24 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+# The section for input.c is larger than the one kept in memory.
+input=${BUILDDIR}/etags-large-section.c
+awk 'BEGIN { for (i = 0; i < 150000; i++) printf "int variable_%06d;\n", i }' > $input
+
+${CTAGS} --quiet --options=NONE -e -o ${BUILDDIR}/TAGS $input small.c
+
+# Print the size in the header of each section and the size of the
+# section followed.
+LC_ALL=C awk '
+/^\f$/ { if (name) print name, size, bytes; header = 1; next }
+header { split($0, a, ","); name = a[1]; sub(/.*\//, "", name); size = a[2]; bytes = 0; header = 0; next }
+{ bytes += length($0) + 1; n++ }
+END { print name, size, bytes; print n, "tags" }
+' ${BUILDDIR}/TAGS
+
+rm -f $input ${BUILDDIR}/TAGS
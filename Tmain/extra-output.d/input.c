@@ -0,0 +1,14 @@
+struct point {
+	int x, y;
+};
+
+static int origin (struct point *p)
+{
+	return p->x == 0 && p->y == 0;
+}
+
+int main (void)
+{
+	struct point p = { 0, 0 };
+	return origin (&p);
+}
@@ -0,0 +1,46 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE"
+B=$BUILDDIR/extra-output
+
+# The Fortran parser parses input.f90 again after failing once.
+rm -f $B.*
+${CTAGS} $O -o $B.tags --extra-output=e-ctags:$B.e.tags --extra-output=etags:$B.TAGS \
+		 input.c input.f90
+${CTAGS} $O -o $B.u.1 input.c input.f90
+${CTAGS} $O --output-format=e-ctags -o $B.e.1 input.c input.f90
+# The extra outputs have the file names of the main output.
+${CTAGS} $O -e --tag-relative=no -o $B.TAGS.1 input.c input.f90
+cmp $B.tags $B.u.1 && echo "same u-ctags"
+cmp $B.e.tags $B.e.1 && echo "same e-ctags"
+cmp $B.TAGS $B.TAGS.1 && echo "same etags"
+
+echo "# foldcase"
+${CTAGS} $O --sort=foldcase -o $B.tags --extra-output=e-ctags:$B.e.tags input.c input.f90
+${CTAGS} $O --sort=foldcase --output-format=e-ctags -o $B.e.1 input.c input.f90
+cmp $B.e.tags $B.e.1 && echo "same e-ctags"
+
+echo "# cleared"
+rm -f $B.e.tags
+${CTAGS} $O -o $B.tags --extra-output=e-ctags:$B.e.tags --extra-output= input.c
+[ -e $B.e.tags ] || echo "no extra output"
+
+echo "# errors"
+{
+	${CTAGS} $O -o $B.tags --extra-output=u-ctags:$B.e.tags input.c
+	${CTAGS} $O -o $B.tags --extra-output=etags:$B.e.tags --extra-output=etags:$B.TAGS input.c
+	${CTAGS} $O -o $B.tags --extra-output=xref:$B.e.tags input.c
+	${CTAGS} $O -o $B.tags --extra-output=e-ctags input.c
+	${CTAGS} $O -o $B.tags --extra-output=e-ctags:$B.tags input.c
+	${CTAGS} $O -o $B.tags --extra-output=e-ctags:$B.e.tags --append input.c
+	${CTAGS} $O -e -o $B.TAGS --extra-output=e-ctags:$B.e.tags input.c
+} 2>&1 | sed -e "s|$B|extra-output|g"
+
+rm -f $B.*
+exit 0
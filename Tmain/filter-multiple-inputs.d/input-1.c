@@ -0,0 +1,2 @@
+int b;
+int a;
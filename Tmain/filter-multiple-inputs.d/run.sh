@@ -0,0 +1,18 @@
+#!/bin/sh
+# Copyright: 2026 Universal Ctags Team
+# License: GPL-2
+
+CTAGS=$1
+
+# The tags of each input file are followed by the terminator, including
+# an input file having no tag.
+for sort in yes no; do
+	echo "# sort=$sort"
+	printf './input-1.c\n./input-2.c\n./input-3.c\n' | $CTAGS --quiet --options=NONE --filter --sort=$sort \
+		--filter-terminator='--
+'
+	echo "# sort=$sort, pseudo tags"
+	printf './input-1.c\n./input-3.c\n' | $CTAGS --quiet --options=NONE --filter --sort=$sort \
+		--extras=+p --pseudo-tags=TAG_FILE_SORTED --filter-terminator='--
+'
+done
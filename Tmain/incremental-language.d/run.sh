@@ -0,0 +1,32 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE --extras=-p"
+D=$BUILDDIR/incremental-language-src
+T=$BUILDDIR/incremental-language-tags
+
+rm -rf $D $T $T.manifest $T.prev
+mkdir -p $D
+cp -p a.c tool $D
+
+run()
+{
+	echo "# $1"
+	( cd $BUILDDIR && ${CTAGS} $O --incremental --verbose -o $T \
+		incremental-language-src/a.c incremental-language-src/tool 2>&1 ) \
+		| grep -e 'in manifest' -e '^Get file language'
+	head -n 1 $T.manifest
+	sed 1d $T.manifest | cut -f 4-
+}
+
+run "first"
+run "nothing changed"
+
+echo 'int a1;' >> $D/a.c
+run "a.c changed"
+
+rm -rf $D $T $T.manifest $T.prev
+exit 0
@@ -0,0 +1,39 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE --extras=-p"
+D=$BUILDDIR/incremental-src
+T=$BUILDDIR/incremental-tags
+
+rm -rf $D $T $T.manifest $T.prev
+mkdir -p $D
+cp a.c b.c c.c $D
+
+run()
+{
+	echo "# $1"
+	( cd $BUILDDIR && ${CTAGS} $O --incremental --verbose -R -o $T incremental-src 2>&1 ) \
+		| grep -e '^reusing' | sort
+	cat $T
+}
+
+run "first"
+run "nothing changed"
+
+echo 'int b1;' >> $D/b.c
+rm $D/c.c
+run "b.c changed, c.c removed"
+
+touch $D/a.c
+run "a.c touched"
+
+echo '# incompatible options'
+${CTAGS} $O --incremental -o - a.c
+${CTAGS} $O --incremental --append -o $T a.c
+${CTAGS} $O --incremental --output-format=etags -o $T a.c
+
+rm -rf $D $T $T.manifest $T.prev
+exit 0
@@ -0,0 +1,4 @@
+class C
+  def foo
+  end
+end
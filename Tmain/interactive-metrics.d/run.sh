@@ -0,0 +1,35 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+. ../utils.sh
+
+is_feature_available ${CTAGS} interactive
+
+s()
+{
+	sed -e s/':"'/': "'/g \
+		-e 's/"\(wall\|cpu\)": [0-9.]*/"\1": T/g' \
+		-e 's/"allocations": [0-9]*/"allocations": N/' \
+		-e 's/"\(self\|workers\)": [0-9][0-9]*/"\1": N/g' \
+		-e 's/"counts": \[[0-9, ]*\], "sum": [0-9.]*/"counts": C, "sum": T/' \
+		-e 's/"text": "\(# TYPE ctags_files counter\)\\n.*\\n\(ctags_parse_seconds_count 1\)\\n.*\\n\(# EOF\)\\n"/"text": "\1 ... \2 ... \3"/' \
+		| jdropver
+}
+
+CTAGS="$CTAGS --options=NONE --extras=-p"
+
+echo metrics in server submode
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"a.rb"}'
+  echo '{"command":"metrics", "id":1}'
+  echo '{"command":"metrics", "format":"openmetrics"}'
+  echo '{"command":"metrics", "format":"xml"}'
+) | ${CTAGS} --_interactive=server |s
+
+echo metrics in default submode
+echo =======================================
+(
+  echo '{"command":"metrics"}'
+) | ${CTAGS} --_interactive |s
@@ -0,0 +1,19 @@
+int g;
+
+class A {
+public:
+	int a;
+	void m();
+};
+
+void f(int x)
+{
+	int y = x;
+	if (y) {
+		y++;
+	}
+}
+
+struct B {
+	int b;
+};
@@ -0,0 +1,6 @@
+int g;
+
+void f(int x)
+{
+	int y = x;
+}
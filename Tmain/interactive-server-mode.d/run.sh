@@ -0,0 +1,95 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+. ../utils.sh
+
+is_feature_available ${CTAGS} interactive
+
+s()
+{
+	sed -e s/':"'/': "'/g | jdropver
+}
+
+CTAGS="$CTAGS --options=NONE"
+
+echo tagging a file twice
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"a.rb"}'
+  echo '{"command":"generate-tags", "filename":"a.rb"}'
+) | ${CTAGS} --_interactive=server |s
+
+echo
+echo tagging a file twice without server submode
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"a.rb"}'
+  echo '{"command":"generate-tags", "filename":"a.rb"}'
+) | ${CTAGS} --_interactive |s
+
+echo
+echo tagging data
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"c.rb", "size":12}'
+  printf 'def baz\nend\n'
+  echo '{"command":"generate-tags", "filename":"c.rb", "size":12}'
+  printf 'def baz\nend\n'
+  echo '{"command":"generate-tags", "filename":"c.rb", "size":12}'
+  printf 'def qux\nend\n'
+) | ${CTAGS} --_interactive=server |s
+
+echo
+echo tagging files in a batch
+echo =======================================
+(
+  echo '{"command":"generate-tags", "files":[{"filename":"a.rb"}, {"filename":"c.rb", "size":12}, {"filename":"b.rb"}]}'
+  printf 'def baz\nend\n'
+  echo '{"command":"generate-tags", "files":[{"filename":"a.rb"}, {"filename":"b.rb"}, {"size":3}]}'
+  echo '{"command":"generate-tags", "files":"a.rb"}'
+) | ${CTAGS} --_interactive=server |s
+
+echo
+echo tagging files in a batch request with workers
+echo =======================================
+(
+  echo '{"command":"generate-tags-batch", "id":1, "files":[{"filename":"a.rb"}, {"filename":"c.rb", "size":12}, {"filename":"b.rb"}]}'
+  printf 'def baz\nend\n'
+  echo '{"command":"generate-tags-batch", "id":"second", "files":[{"filename":"a.rb"}, {"filename":"c.rb", "size":12}]}'
+  printf 'def qux\nend\n'
+  echo '{"command":"generate-tags", "id":3, "filename":"b.rb"}'
+  echo '{"command":"generate-tags-batch", "files":"a.rb"}'
+) | ${CTAGS} --_interactive=server --jobs=2 |s
+
+echo
+echo tagging mapped contents
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"m.rb", "mapped":"mapped.txt"}'
+  echo '{"command":"generate-tags", "filename":"m.rb", "mapped":"mapped.txt"}'
+  echo '{"command":"generate-tags", "filename":"m.rb", "mapped":"mapped.txt", "size":13}'
+) | ${CTAGS} --_interactive=server |s
+
+echo
+echo reparsing an edited scope
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"e.cpp", "size":'$(wc -c < edit-1.cpp)'}'
+  cat edit-1.cpp
+  # lines 12-13 are replaced with 4 lines in the body of f
+  echo '{"command":"generate-tags", "filename":"e.cpp", "size":'$(wc -c < edit-2.cpp)', "edit":{"start":12, "end":13, "lines":4}}'
+  cat edit-2.cpp
+  # the edit is not inside a scope
+  echo '{"command":"generate-tags", "filename":"e.cpp", "size":'$(wc -c < edit-3.cpp)', "edit":{"start":2, "end":10, "lines":0}}'
+  cat edit-3.cpp
+) | ${CTAGS} --_interactive=server --fields=+n --kinds-c++=+l |s
+
+echo
+echo a long request
+echo =======================================
+p=
+for i in $(seq 1 600); do
+	p="./$p"
+done
+echo '{"command":"generate-tags", "filename":"'"$p"'b.rb"}' | ${CTAGS} --_interactive=server |s | sed -e 's|"\(\./\)*b.rb"|"(long path)b.rb"|'
@@ -0,0 +1,21 @@
+int g;
+
+class A {
+public:
+	int a;
+	void m();
+};
+
+void f(int x)
+{
+	int y = x;
+	int z = y;
+	if (y) {
+		z++;
+		y++;
+	}
+}
+
+struct B {
+	int b;
+};
@@ -0,0 +1,57 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+. ../utils.sh
+
+is_feature_available ${CTAGS} interactive
+
+s()
+{
+	sed -e s/':"'/': "'/g | jdropver
+}
+
+CTAGS="$CTAGS --options=NONE"
+
+echo querying the tags of files
+echo =======================================
+(
+  echo '{"command":"generate-tags", "files":[{"filename":"a.rb"}, {"filename":"b.rb"}]}'
+  echo '{"command":"find-definition", "name":"foo"}'
+  echo '{"command":"find-definition", "name":"foo", "kind":"class"}'
+  echo '{"command":"list-members", "id":1, "scope":"C"}'
+  echo '{"command":"list-symbols", "filename":"b.rb"}'
+  echo '{"command":"generate-tags", "filename":"b.rb", "size":12}'
+  printf 'def bar\nend\n'
+  echo '{"command":"find-definition", "name":"foo"}'
+  echo '{"command":"list-symbols", "filename":"b.rb"}'
+  echo '{"command":"find-definition"}'
+) | ${CTAGS} --_interactive=server |s
+
+echo
+echo querying the tags of a scope reparsed
+echo =======================================
+(
+  echo '{"command":"generate-tags", "filename":"e.cpp", "size":'$(wc -c < edit-1.cpp)'}'
+  cat edit-1.cpp
+  echo '{"command":"list-symbols", "filename":"e.cpp"}'
+  echo '{"command":"generate-tags", "filename":"e.cpp", "size":'$(wc -c < edit-2.cpp)', "edit":{"start":12, "end":13, "lines":4}}'
+  cat edit-2.cpp
+  echo '{"command":"list-symbols", "filename":"e.cpp"}'
+  echo '{"command":"list-members", "scope":"f"}'
+) | ${CTAGS} --_interactive=server --fields=+n --kinds-c++=+l |s
+
+echo
+echo querying the tags of files tagged in workers
+echo =======================================
+(
+  echo '{"command":"generate-tags-batch", "files":[{"filename":"a.rb"}, {"filename":"b.rb"}]}'
+  echo '{"command":"find-definition", "name":"foo"}'
+) | ${CTAGS} --_interactive=server --jobs=2 |s
+
+echo
+echo querying without server submode
+echo =======================================
+(
+  echo '{"command":"find-definition", "name":"foo"}'
+) | ${CTAGS} --_interactive |s
@@ -0,0 +1,44 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+is_feature_available ${CTAGS} jobs
+
+O="--quiet --options=NONE --extras=+g --fields=+n"
+INPUT=$BUILDDIR/jobs-guest.md
+
+# The anonymous tags of the C parser are in the first half of the
+# promises, and the ones of the JavaScript parser are in the other
+# half.
+{
+	for i in $(seq 3000); do
+		printf '```c\nstruct {\n\tint a;\n\tint b;\n\tint c;\n} s%d;\n```\n\n' $i
+	done
+	for i in $(seq 3000); do
+		printf '```javascript\nfoo(function () {\n\tvar x = %d;\n\tvar y = x;\n\treturn y;\n});\n```\n\n' $i
+	done
+} > $INPUT
+
+run()
+{
+	local j=$1
+	shift
+	${CTAGS} $O --jobs=$j "$@" -o $BUILDDIR/jobs-guest-$j.tags $INPUT
+}
+
+for j in 2 4; do
+	echo "# JOBS=$j"
+	run $j --verbose 2>&1 | grep -e 'workers for' -e 'again'
+	if run 1 && run $j && cmp -s $BUILDDIR/jobs-guest-1.tags $BUILDDIR/jobs-guest-$j.tags; then
+		echo same
+	else
+		echo different
+	fi
+done
+
+rm -f $INPUT $BUILDDIR/jobs-guest-*.tags
+exit 0
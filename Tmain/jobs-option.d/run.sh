@@ -0,0 +1,53 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+is_feature_available ${CTAGS} jobs
+
+O="--quiet --options=NONE"
+
+run()
+{
+	local j=$1
+	shift
+	${CTAGS} $O --jobs=$j -o - "$@"
+}
+
+compare()
+{
+	local msg=$1
+	shift
+	if [ "$(run 1 "$@")" = "$(run 2 "$@")" ] && [ "$(run 1 "$@")" = "$(run 3 "$@")" ] &&
+		   [ "$(run 1 "$@")" = "$(run 9 "$@")" ]; then
+		echo "$msg: same"
+	else
+		echo "$msg: different"
+	fi
+}
+
+compare "files" src/a.c src/b.c src/c.mak src/d.c src/e.py
+compare "recursion" -R src
+compare "options between files" src/a.c src/b.c --kinds-C=-v src/d.c src/e.py
+compare "no pseudo tags, unsorted" --extras=-p --sort=no src/a.c src/b.c src/c.mak src/d.c src/e.py
+compare "foldcase" --sort=foldcase -R src
+compare "duplicated inputs" src/a.c src/b.c src/a.c src/d.c src/a.c
+
+# The tags sorted in the workers are merged into the tag file
+for j in 1 4; do
+	${CTAGS} $O -o $BUILDDIR/jobs-option-$j.tags src/a.c src/e.py
+	${CTAGS} $O --jobs=$j --append=replace -o $BUILDDIR/jobs-option-$j.tags -R src
+done
+if cmp -s $BUILDDIR/jobs-option-1.tags $BUILDDIR/jobs-option-4.tags; then
+	echo "append: same"
+else
+	echo "append: different"
+fi
+rm -f $BUILDDIR/jobs-option-*.tags
+
+echo '# JOBS=0'
+run 0 src/a.c
+exit 0
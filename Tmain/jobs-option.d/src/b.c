@@ -0,0 +1,2 @@
+int b0;
+struct b1 { int m; };
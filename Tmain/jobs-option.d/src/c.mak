@@ -0,0 +1,3 @@
+all: c0
+c0:
+	echo c
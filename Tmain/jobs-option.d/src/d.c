@@ -0,0 +1,2 @@
+int d0;
+#define d1 1
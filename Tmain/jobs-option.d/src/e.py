@@ -0,0 +1,2 @@
+def e0():
+    pass
@@ -0,0 +1,47 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+is_feature_available ${CTAGS} jobs
+
+O="--quiet --options=NONE"
+D=$BUILDDIR/jobs-schedule
+rm -rf $D
+mkdir -p $D
+
+# One large file among small ones
+i=0
+while [ $i -lt 2000 ]; do
+	echo "int large_$i (void) { return $i; }"
+	i=$((i + 1))
+done > $D/m.c
+for f in a b c d e f g h i j k l n o p q r s t u; do
+	echo "int small_$f (void) { return 0; }" > $D/$f.c
+done
+
+run()
+{
+	local j=$1
+	shift
+	${CTAGS} $O --jobs=$j -o - "$@" $D/*.c
+}
+
+for s in yes no; do
+	if [ "$(run 1 --sort=$s)" = "$(run 3 --sort=$s)" ] &&
+		   [ "$(run 1 --sort=$s)" = "$(run 8 --sort=$s)" ]; then
+		echo "sort=$s: same"
+	else
+		echo "sort=$s: different"
+	fi
+done
+
+${CTAGS} $O --jobs=3 --totals=yes -o /dev/null $D/*.c 2>&1 \
+	| sed -n -e 's/busy [0-9]*% .*/busy/p'
+${CTAGS} $O --jobs=3 --totals=extra -o /dev/null $D/*.c 2>&1 \
+	| awk '/PER-WORKER/ { p = 1 } p && /^[0-9]/ { jobs += $2; cost += $4 } END { print jobs, cost }'
+
+rm -rf $D
@@ -0,0 +1,47 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+is_feature_available ${CTAGS} jobs
+
+O="--quiet --options=NONE --extras=+f --fields=+n"
+INPUT=$BUILDDIR/jobs-split.bat
+
+for i in $(seq 30000); do
+	printf ':label%d\nset var%d=1\necho %d\n' $i $i $i
+done > $INPUT
+
+run()
+{
+	local j=$1
+	shift
+	${CTAGS} $O --jobs=$j "$@" -o $BUILDDIR/jobs-split-$j.tags $INPUT
+}
+
+compare()
+{
+	for j in 2 4; do
+		echo "# JOBS=$j" "$@"
+		run $j --verbose "$@" 2>&1 | grep -e 'workers for'
+		if run 1 "$@" && run $j "$@" \
+				&& cmp -s $BUILDDIR/jobs-split-1.tags $BUILDDIR/jobs-split-$j.tags; then
+			echo same
+		else
+			echo different
+		fi
+	done
+}
+
+compare
+compare --sort=no
+# A pattern with a scope action refers to the tags of the other lines.
+compare --regex-DosBatch='/^echo (.*)/\1/e,echo/{scope=ref}'
+# The etags writer keeps the tags of the input file until its end.
+compare -e
+
+rm -f $INPUT $BUILDDIR/jobs-split-*.tags
+exit 0
@@ -0,0 +1,48 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+is_feature_available ${CTAGS} jobs
+
+O="--quiet --options=NONE --sort=no"
+D=$BUILDDIR/jobs-unsorted-ptags
+rm -rf $D
+mkdir -p $D
+
+# The workers parse the large file first, and the small files of the
+# same language after it.
+i=0
+while [ $i -lt 2000 ]; do
+	echo "def large_$i(): pass"
+	i=$((i + 1))
+done > $D/m.py
+for f in a b c d e f; do
+	echo "int small_$f;" > $D/$f.c
+	echo "def small_$f(): pass" > $D/$f.py
+done
+
+run()
+{
+	local j=$1
+	${CTAGS} $O --jobs=$j -o $D/tags.$j $D/a.c $D/b.py $D/c.c $D/m.py $D/d.py $D/e.c $D/f.py
+}
+
+run 1
+for j in 2 3 8; do
+	run $j
+	if cmp -s $D/tags.1 $D/tags.$j; then
+		echo "jobs=$j: same"
+	else
+		echo "jobs=$j: different"
+	fi
+done
+
+# The pseudo tags for a parser come before the tags of the first input
+# file parsed with it.
+grep -e '^!_TAG_PARSER_VERSION' -e '^small_' $D/tags.1 | sed -e "s|$D/||"
+
+rm -rf $D
@@ -0,0 +1,14 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+# The language maps are changed between the input files.
+${CTAGS} --quiet --options=NONE --print-language \
+		 input.x Makefile.x \
+		 --map-C=+.x input.x \
+		 --map-Make=+'(Makefile.*)' Makefile.x \
+		 --map-C=-.x input.x Makefile.x \
+		 --langmap=Make: Makefile.x
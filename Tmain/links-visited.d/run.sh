@@ -0,0 +1,31 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+exit_if_win32 $CTAGS
+
+# tree/a/b/loop leads to tree, and both tree/c/alias1 and
+# tree/c/alias2 lead to ext. Which alias is visited first depends on
+# the order of readdir.
+D=$BUILDDIR/links-visited.tmp
+
+rm -rf $D
+mkdir -p $D/tree/a/b $D/tree/c $D/ext
+echo 'int f (void) { return 0; }' > $D/tree/a/b/x.c
+echo 'int g (void) { return 0; }' > $D/ext/y.c
+ln -s ../.. $D/tree/a/b/loop
+ln -s ../../ext $D/tree/c/alias1
+ln -s ../../ext $D/tree/c/alias2
+
+cd $D/tree
+echo "# --links=yes"
+${CTAGS} --quiet --options=NONE -R -o - --links=yes . | sed -e 's/alias[12]/alias/'
+echo "# --links=no"
+${CTAGS} --quiet --options=NONE -R -o - --links=no .
+cd - > /dev/null
+
+rm -rf $D
@@ -0,0 +1,14 @@
+struct point { int x, y; };
+
+static int origin (struct point *p)
+{
+	p->x = 0;
+	p->y = 0;
+	return 0;
+}
+
+int main (void)
+{
+	struct point p;
+	return origin (&p);
+}
@@ -0,0 +1,9 @@
+import os
+import sys
+
+def main():
+    return os.getcwd()
+
+class Runner:
+    def run(self):
+        return main()
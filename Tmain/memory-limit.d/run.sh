@@ -0,0 +1,47 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE"
+
+compare()
+{
+	local msg=$1
+	shift
+	if [ "$(${CTAGS} $O -o - "$@")" = "$(${CTAGS} $O --memory-limit=1 -o - "$@")" ]; then
+		echo "$msg: same"
+	else
+		echo "$msg: different"
+	fi
+}
+
+compare "sorted" input.c input.py
+compare "unsorted" --sort=no input.c input.py
+compare "references" --extras=+r --aggregate-references input.c input.py
+compare "fields" --fields=+neK input.c input.py
+
+# The tag file is spilled and sorted in runs as small as the limit allows.
+rm -f $BUILDDIR/tags.limited $BUILDDIR/tags.unlimited
+${CTAGS} $O -o $BUILDDIR/tags.unlimited input.c input.py
+${CTAGS} $O --memory-limit=1 --totals=yes -o $BUILDDIR/tags.limited input.c input.py 2>&1 |
+	grep -e 'memory-limit' -e 'disk' | sed -e 's/^[0-9]* kB of [0-9]* kB/N kB of N kB/'
+if cmp -s $BUILDDIR/tags.limited $BUILDDIR/tags.unlimited; then
+	echo "tag file: same"
+else
+	echo "tag file: different"
+fi
+rm -f $BUILDDIR/tags.limited $BUILDDIR/tags.unlimited
+
+for s in 0 1K 2m 3G; do
+	${CTAGS} $O --memory-limit=$s -o - input.c > /dev/null && echo "$s: accepted"
+done
+
+for s in -1 1X K; do
+	echo "# $s"
+	${CTAGS} $O --memory-limit=$s -o - input.c
+done
+exit 0
@@ -0,0 +1,9 @@
+fun f
+  ABC;
+  #dir
+Y=low
+XXy=up
+xy=mid
+123:num
+%pct
+var v DEF;
@@ -0,0 +1,60 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE"
+SRC=$BUILDDIR/name-index-input.c
+TAGS=$BUILDDIR/name-index.tags
+
+i=0
+: > $SRC
+while [ $i -lt 400 ]; do
+	echo "int func$i (void) { return $i; }" >> $SRC
+	i=$((i + 1))
+done
+
+lookup()
+{
+	for n in func0 func1 func17 func250 func399 func4000 a zzz; do
+		${READTAGS} -t $TAGS - $n
+	done
+	${READTAGS} -t $TAGS -p - func39
+	${READTAGS} -t $TAGS -i - FUNC123
+}
+
+rm -f $TAGS $TAGS.index
+${CTAGS} $O --name-index -o $TAGS $SRC
+head -1 $TAGS.index | sed -e 's/[0-9]*$/<size>/'
+if [ $(wc -l < $TAGS.index) -gt 2 ]; then
+	echo "index has entries"
+fi
+
+lookup > $BUILDDIR/name-index.with
+cut -f1 $BUILDDIR/name-index.with
+mv $TAGS.index $TAGS.saved
+lookup > $BUILDDIR/name-index.without
+cmp $BUILDDIR/name-index.with $BUILDDIR/name-index.without && echo "same results without index"
+
+# An index not matching the tag file must not change the results.
+sed -e '2,$s/func/xfunc/' $TAGS.saved > $TAGS.index
+lookup > $BUILDDIR/name-index.stale
+cmp $BUILDDIR/name-index.with $BUILDDIR/name-index.stale && echo "same results with stale index"
+
+echo "# unsorted"
+${CTAGS} $O --name-index -u -o $BUILDDIR/name-index-u.tags $SRC
+[ -e $BUILDDIR/name-index-u.tags.index ] || echo "no index"
+echo "# stdout"
+${CTAGS} $O --name-index -o - $SRC > /dev/null
+
+rm -f $SRC $TAGS $TAGS.index $TAGS.saved $BUILDDIR/name-index-u.tags \
+   $BUILDDIR/name-index.with $BUILDDIR/name-index.without $BUILDDIR/name-index.stale
+exit 0
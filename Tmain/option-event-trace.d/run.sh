@@ -0,0 +1,12 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+${CTAGS} --quiet --options=NONE --sort=yes --_event-trace=$BUILDDIR/trace.json \
+		 -o $BUILDDIR/tags input.c input.sh &&
+	sed -e 's/"ts":[0-9.]*/"ts":T/' $BUILDDIR/trace.json
+rm -f $BUILDDIR/trace.json $BUILDDIR/tags
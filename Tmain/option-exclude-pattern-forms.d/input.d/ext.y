@@ -0,0 +1 @@
+int ext_y;
@@ -0,0 +1 @@
+int keep_c;
@@ -0,0 +1 @@
+int name_c;
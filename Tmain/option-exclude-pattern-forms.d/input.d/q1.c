@@ -0,0 +1 @@
+int q1_c;
@@ -0,0 +1 @@
+int q22_c;
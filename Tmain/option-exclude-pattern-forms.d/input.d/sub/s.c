@@ -0,0 +1 @@
+int s_c;
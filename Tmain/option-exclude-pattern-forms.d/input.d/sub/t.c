@@ -0,0 +1 @@
+int t_c;
@@ -0,0 +1 @@
+int tmp_a_c;
@@ -0,0 +1 @@
+int tmp_b_c;
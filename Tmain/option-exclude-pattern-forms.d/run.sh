@@ -0,0 +1,11 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS="$1"
+
+# NAME, *.EXT, *SUFFIX, PREFIX*, and generic glob forms of patterns
+${CTAGS} --quiet --options=NONE -o - -R --langmap=C:+.y.yy \
+		 --exclude='name.c' --exclude='*.y' --exclude='*~' \
+		 --exclude='tmp-*' --exclude-exception='tmp-b.c' \
+		 --exclude='q?.c' --exclude='input.d/sub/s.*' \
+		 input.d
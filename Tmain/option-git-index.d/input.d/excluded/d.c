@@ -0,0 +1 @@
+int excluded_d_c;
@@ -0,0 +1 @@
+int sub_deeper_c_c;
@@ -0,0 +1 @@
+int untracked_c;
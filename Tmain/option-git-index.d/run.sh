@@ -0,0 +1,32 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+# index-v2 and index-v4 are made with "git add a.c sub excluded" in
+# input.d, and "git update-index --index-version N".
+D=$BUILDDIR/option-git-index.tmp
+O="--quiet --options=NONE -o - --exclude=excluded"
+
+run_ctags()
+{
+	${CTAGS} $O --git-index=$D | sed -e "s|$D/||"
+}
+
+rm -rf $D
+cp -r input.d $D
+mkdir $D/.git
+
+for v in 2 4; do
+	echo "# version $v"
+	cp index-v$v $D/.git/index
+	run_ctags
+done
+
+echo "# .git having gitdir"
+mv $D/.git $D/gitdir
+echo "gitdir: gitdir" > $D/.git
+run_ctags
+
+rm -rf $D
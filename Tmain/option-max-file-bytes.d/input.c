@@ -0,0 +1,8 @@
+int a;
+int b;
+struct s {
+	int m;
+	int n;
+};
+int c;
+int d;
@@ -0,0 +1,14 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+O="--options=NONE --sort=no --extras=-p --fields=-T --totals -o -"
+
+for s in 0 1 14 30; do
+	echo "# $s"
+	${CTAGS} $O --max-file-bytes=$s input.c 2>&1 \
+		| sed -e 's/ in [0-9.]* seconds.*//' -e "/No options will be read/d"
+done
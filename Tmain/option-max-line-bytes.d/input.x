@@ -0,0 +1,3 @@
+def short
+def head xxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxxx def tail
+def last
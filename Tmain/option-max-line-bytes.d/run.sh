@@ -0,0 +1,16 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+O="--options=NONE --sort=no --extras=-p --fields=-T --langdef=X --langmap=X:.x -o -"
+
+for s in 0 32; do
+	echo "# $s"
+	${CTAGS} $O --max-line-bytes=$s \
+			 --regex-X='/def (t[a-z]+)$/\1/d/' \
+			 --regex-X='/^def ([a-z]+)/\1/d/' \
+			 input.x 2>&1 | sed -e "/No options will be read/d"
+done
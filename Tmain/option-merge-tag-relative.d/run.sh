@@ -0,0 +1,37 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE"
+D=$BUILDDIR/option-merge-tag-relative
+rm -rf $D
+mkdir -p $D
+cp -r src/* $D
+
+# A tag file for each package, made in the directory of the package
+for p in a b; do
+	( cd $D/pkg/$p && ${CTAGS} $O -o tags $p.c ../../include/shared.h )
+done
+
+echo '# merged into the top directory'
+( cd $D && ${CTAGS} $O --tag-relative=yes --merge -o tags pkg/a/tags pkg/b/tags )
+grep -v '^!_' $D/tags
+
+echo '# merged into a subdirectory'
+mkdir $D/out
+( cd $D && ${CTAGS} $O --tag-relative=yes --merge -o out/tags pkg/a/tags pkg/b/tags )
+grep -v '^!_' $D/out/tags
+
+echo '# kept as is'
+( cd $D && ${CTAGS} $O --merge -o - pkg/a/tags pkg/b/tags ) | grep -v '^!_'
+
+echo '# ids'
+( cd $D/pkg/a && ${CTAGS} $O --pseudo-tags=+TAG_INPUT_FILE_ID -o tags a.c )
+( cd $D && ${CTAGS} $O --tag-relative=yes --merge -o tags pkg/a/tags 2>&1 )
+
+rm -rf $D
+exit 0
@@ -0,0 +1 @@
+struct shared { int member; };
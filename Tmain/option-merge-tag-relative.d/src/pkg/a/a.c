@@ -0,0 +1 @@
+int a_func (void) { return 0; }
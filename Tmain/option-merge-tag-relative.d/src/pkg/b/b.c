@@ -0,0 +1 @@
+int b_func (void) { return 0; }
@@ -0,0 +1,24 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+M=$BUILDDIR/metrics.txt
+
+rm -f $M
+${CTAGS} --quiet --options=NONE --extras=-p -o /dev/null --metrics-file=$M input.c
+grep -v -e '_seconds' -e '^ctags_peak_rss_bytes' $M
+grep -e '^ctags_parse_seconds_count' $M
+
+echo '#' json
+rm -f $M
+${CTAGS} --quiet --options=NONE --extras=-p -o /dev/null --metrics-file=$M --metrics-format=json input.c
+sed -e 's/"\(wall\|cpu\)": [0-9.]*/"\1": T/g' \
+	-e 's/"allocations": [0-9]*/"allocations": N/' \
+	-e 's/"\(self\|workers\)": [0-9][0-9]*/"\1": N/g' \
+	-e 's/"counts": \[[0-9, ]*\], "sum": [0-9.]*/"counts": C, "sum": T/' $M
+
+rm -f $M
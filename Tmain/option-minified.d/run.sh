@@ -0,0 +1,30 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+O="--quiet --options=NONE --sort=no --extras=-p --totals"
+input=${BUILDDIR}/option-minified.js
+
+# 100 lines, each of which is about 1000 bytes long and has 20 functions
+# each having a nested function.
+awk 'BEGIN {
+	for (i = 0; i < 100; i++) {
+		s = "";
+		for (j = 0; j < 20; j++)
+			s = s sprintf("function f%d_%d(a,b){function g(c){return c+a+b+%d}return g(1)}", i, j, j);
+		print s;
+	}
+}' > $input
+
+for p in parse skip toplevel truncate:8K; do
+	echo "# $p"
+	${CTAGS} $O --minified=$p -o ${BUILDDIR}/tags $input 2>&1 \
+		| sed -e 's/ in [0-9.]* seconds.*//'
+	echo "$(wc -l < ${BUILDDIR}/tags) tags ($(grep -c '^g	' ${BUILDDIR}/tags) nested)"
+done
+
+rm -f $input ${BUILDDIR}/tags
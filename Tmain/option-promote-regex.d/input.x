@@ -0,0 +1,7 @@
+#define BAZ 1
+DEFINE quux 2
+struct bar {
+	int x;
+};
+int foo(int a);
+typedef int qux_t;
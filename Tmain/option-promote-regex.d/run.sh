@@ -0,0 +1,26 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+is_feature_available ${CTAGS} pcre2
+
+for p in no yes verify; do
+	echo '#' $p
+	${CTAGS} --verbose --options=NONE --promote-regex=$p \
+			 --langdef=X'{_autoFQTag}' --map-X=.x --fields=-T \
+			 --kinddef-X=d,define,defines \
+			 --kinddef-X=s,struct,structs \
+			 --kinddef-X=f,func,functions \
+			 --kinddef-X=t,typedef,typedefs \
+			 --regex-X='/^#define[ \t]+([A-Za-z_]+)/\1/d/' \
+			 --regex-X='/^define[ \t]+([a-z]+)/\1/d/i' \
+			 --regex-X='/^(int|char) ([a-z]+)\(/\2/f/' \
+			 --mline-regex-X='/^struct ([a-z]+) \{\n/\1/s/{mgroup=1}' \
+			 --regex-X='/typedef .* ([a-z_]+);$/\1/t/' \
+			 -o - input.x 2> stderr.tmp
+	grep -e 'romoting' stderr.tmp
+done
+rm -f stderr.tmp
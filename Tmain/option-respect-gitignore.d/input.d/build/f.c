@@ -0,0 +1 @@
+int build_f_c;
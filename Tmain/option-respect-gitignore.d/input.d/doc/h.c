@@ -0,0 +1 @@
+int doc_h_c;
@@ -0,0 +1 @@
+int ignored_c;
@@ -0,0 +1 @@
+int lib_g_c;
@@ -0,0 +1 @@
+int lib_keep_c;
@@ -0,0 +1 @@
+int src_a_c;
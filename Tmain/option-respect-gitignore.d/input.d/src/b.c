@@ -0,0 +1 @@
+int src_b_c;
@@ -0,0 +1 @@
+int src_deep_build_d_c;
@@ -0,0 +1 @@
+int src_deep_c_c;
@@ -0,0 +1 @@
+int src_gen_c;
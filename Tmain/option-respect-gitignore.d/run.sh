@@ -0,0 +1,20 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+# The ignore files are stored without the leading dot not to make git
+# ignore the files of this test case.
+D=$BUILDDIR/option-respect-gitignore.tmp
+rm -rf $D
+cp -r input.d $D
+for f in $(find $D -name gitignore -o -name ignore); do
+	mv $f $(dirname $f)/.$(basename $f)
+done
+
+${CTAGS} --quiet --options=NONE -o - -R --respect-gitignore $D | sed -e "s|$D/||"
+echo '#' without the option
+${CTAGS} --quiet --options=NONE -o - -R $D | sed -e "s|$D/||" | cut -f 2
+
+rm -rf $D
@@ -0,0 +1,48 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE"
+D=$BUILDDIR/option-shard-merge
+rm -rf $D
+mkdir -p $D
+
+for sort in yes foldcase; do
+	echo "# sort=$sort"
+	${CTAGS} $O --sort=$sort -R -o $D/tags src
+	for k in 1 2 3; do
+		${CTAGS} $O --sort=$sort -R --shard=$k/3 -o $D/tags.$k src
+	done
+	# Every input file is in exactly one shard.
+	for k in 1 2 3; do
+		grep -v '^!_' $D/tags.$k | cut -f 2 | sort -u | tee $D/files.$k
+	done | sort | uniq -c | awk '{ print $1 }' | sort -u
+	cat $D/files.1 $D/files.2 $D/files.3 | awk 'END { print NR }'
+	${CTAGS} $O --merge -o $D/tags.merged $D/tags.3 $D/tags.1 $D/tags.2
+	cmp $D/tags $D/tags.merged && echo "merged: same"
+	${CTAGS} $O --merge -o - $D/tags.2 $D/tags.1 $D/tags.3 | cmp $D/tags - \
+		&& echo "merged to stdout: same"
+done
+
+echo "# ./ at the head of a path"
+for k in 1 2 3; do
+	${CTAGS} $O -R --shard=$k/3 -o - ./src | grep -v '^!_' | cut -f 2 | sed -e 's|^\./||' \
+		| sort -u | cmp - $D/files.$k && echo "shard $k: same"
+done
+
+echo "# errors"
+${CTAGS} $O --sort=no -R -o $D/tags.unsorted src
+(
+	${CTAGS} $O --merge -o $D/tags.merged $D/tags.1 $D/tags.unsorted
+	${CTAGS} $O --merge -o $D/tags.1 $D/tags.1 $D/tags.2
+	${CTAGS} $O --merge --append -o $D/tags.merged $D/tags.1
+	${CTAGS} $O --shard=4/3 src
+	${CTAGS} $O --shard=2 src
+) 2>&1 | sed -e "s|$D/||"
+
+rm -rf $D
+exit 0
@@ -0,0 +1 @@
+int func_f (void) { return 0; }
@@ -0,0 +1 @@
+int func_g (void) { return 0; }
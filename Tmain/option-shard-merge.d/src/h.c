@@ -0,0 +1 @@
+int func_h (void) { return 0; }
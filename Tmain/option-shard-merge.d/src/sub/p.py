@@ -0,0 +1,2 @@
+def py_p():
+    pass
@@ -0,0 +1 @@
+struct same { int x; };
@@ -0,0 +1,12 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+${CTAGS} --quiet --options=NONE --totals=json -o - input.c 2>&1 >/dev/null \
+	| sed -e 's/"\(wall\|cpu\)": [0-9.]*/"\1": T/g' \
+		  -e 's/"allocations": [0-9]*/"allocations": N/' \
+		  -e 's/"\(self\|workers\)": [0-9][0-9]*/"\1": N/g' \
+		  -e 's/"counts": \[[0-9, ]*\], "sum": [0-9.]*/"counts": C, "sum": T/'
@@ -0,0 +1,8 @@
+module m
+contains
+subroutine s(a)
+  integer :: a ! comment
+  a = a + &
+      1
+end subroutine s
+end module m
@@ -0,0 +1,10 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+${CTAGS} --quiet --options=NONE --totals=slow:2 -o - input.f 2>&1 >/dev/null \
+	| sed -ne '/^SLOWEST FILES/,$p' \
+	| sed -e 's/^ *[0-9][0-9.]* *[0-9][0-9.]* /T T /'
@@ -0,0 +1,54 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE --fields=+nS --extras=+pq"
+
+compare()
+{
+	local msg=$1
+	shift
+	local a=$BUILDDIR/tags.text
+	local b=$BUILDDIR/tags.binary
+	local r=ok
+	rm -f $a $b
+	${CTAGS} $O -o $a "$@" input.c
+	${CTAGS} $O --output-format=binary -o $b "$@" input.c
+	for q in "-l" "-D" "- origin" "-i - origin" "-p - p" "-i -p - o"; do
+		if [ "$(${READTAGS} -t $a -ne $q)" != "$(${READTAGS} -t $b -ne $q)" ]; then
+			r="different output with $q"
+		fi
+	done
+	if ! ${CTAGS} $O --output-format=binary -o - "$@" input.c | cmp -s - $b; then
+		r="different output to stdout"
+	fi
+	echo "$msg: $r"
+	rm -f $a $b
+}
+
+compare "sorted"
+compare "unsorted" --sort=no
+compare "foldcase" --sort=foldcase
+
+b=$BUILDDIR/tags.binary
+rm -f $b
+${CTAGS} $O --output-format=binary -o $b input.c
+echo "# list"
+${READTAGS} -t $b -ne -l
+echo "# overwrite"
+${CTAGS} $O --output-format=binary -o $b input.c && echo ok
+echo "# append"
+${CTAGS} $O --output-format=binary --append -o $b input.c
+echo "# jobs"
+${CTAGS} $O --output-format=binary --jobs=2 -o $b input.c && echo ok
+rm -f $b
+exit 0
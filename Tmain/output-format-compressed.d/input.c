@@ -0,0 +1,12 @@
+struct point {
+	int x, y;
+};
+
+static int origin (struct point *p)
+{
+	return p->x == 0 && p->y == 0;
+}
+
+int Origin;
+int moveTo (struct point *p, int x, int y);
+#define ORIGIN_X 0
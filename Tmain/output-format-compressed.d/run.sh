@@ -0,0 +1,70 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+is_feature_available ${CTAGS} zlib
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE --fields=+nS --extras=+pq"
+
+# Enough tags for several blocks
+many=$BUILDDIR/many.c
+i=0
+while [ $i -lt 3000 ]; do
+	echo "int func_$i (int a) { return a + $i; }"
+	i=$((i + 1))
+done > $many
+
+compare()
+{
+	local msg=$1
+	local input=$2
+	shift 2
+	local a=$BUILDDIR/tags.text
+	local b=$BUILDDIR/tags.compressed
+	local r=ok
+	rm -f $a $b
+	${CTAGS} $O -o $a "$@" $input
+	${CTAGS} $O --output-format=compressed -o $b "$@" $input
+	for q in "-l" "-D" "- origin" "-i - origin" "-p - p" "-i -p - o" \
+			 "- func_0" "- func_1999" "- func_2999" "-i - FUNC_2500" "-p - func_10"; do
+		if [ "$(${READTAGS} -t $a -ne $q)" != "$(${READTAGS} -t $b -ne $q)" ]; then
+			r="different output with $q"
+		fi
+	done
+	if ! ${CTAGS} $O --output-format=compressed -o - "$@" $input | cmp -s - $b; then
+		r="different output to stdout"
+	fi
+	echo "$msg: $r"
+	rm -f $a $b
+}
+
+compare "sorted" input.c
+compare "unsorted" input.c --sort=no
+compare "foldcase" input.c --sort=foldcase
+compare "sorted, several blocks" $many
+compare "unsorted, several blocks" $many --sort=no
+compare "foldcase, several blocks" $many --sort=foldcase
+rm -f $many
+
+b=$BUILDDIR/tags.compressed
+rm -f $b
+${CTAGS} $O --output-format=compressed -o $b input.c
+echo "# list"
+${READTAGS} -t $b -ne -l
+echo "# overwrite"
+${CTAGS} $O --output-format=compressed -o $b input.c && echo ok
+echo "# append"
+${CTAGS} $O --output-format=compressed --append -o $b input.c
+echo "# jobs"
+${CTAGS} $O --output-format=compressed --jobs=2 -o $b input.c && echo ok
+rm -f $b
+exit 0
@@ -0,0 +1,20 @@
+struct point {
+	int x, y;
+};
+
+static int origin (struct point *p)
+{
+	return p->x == 0 && p->y == 0;
+}
+
+#ifdef NEGATIVE
+int distance (struct point *p) {
+#else
+unsigned int distance (struct point *p) {
+#endif
+	return p->x + p->y;
+}
+
+int Origin;
+int moveTo (struct point *p, int x, int y);
+#define ORIGIN_X 0
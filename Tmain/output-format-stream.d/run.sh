@@ -0,0 +1,53 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE"
+
+# The tags read from the stream are the same as the ones read from
+# the unsorted tag lines. The first pass on input.cpp fails after
+# the "#if 0" branch; the strings defined after the point the second
+# pass starts at are defined again.
+compare()
+{
+	local msg=$1
+	shift
+	local r=ok
+	for f in input.c input.cpp; do
+		if [ "$(${CTAGS} $O --sort=no -o - "$@" $f | ${READTAGS} -t - -ne -l)" \
+				 != "$(${CTAGS} $O --output-format=stream -o - "$@" $f | ${READTAGS} -t - -ne -l)" ]; then
+			r="different output for $f"
+		fi
+	done
+	echo "$msg: $r"
+}
+
+compare "default"
+compare "all fields" --fields='*' --extras=+pq
+compare "long kinds" --fields=+KZ --excmd=combine
+compare "numbers" --excmd=number --fields=-t
+
+s=$BUILDDIR/tags.stream
+rm -f $s
+echo "# list"
+${CTAGS} $O --fields=+nS --output-format=stream -o - input.c | ${READTAGS} -t - -ne -l
+echo "# sorted"
+${CTAGS} $O --output-format=stream --sort=yes -o $s input.c
+${READTAGS} -t - -ne -l < $s | head -1
+echo "# by name"
+${READTAGS} -t $s -l > /dev/null 2>&1 || echo "failed"
+echo "# append"
+${CTAGS} $O --output-format=stream --append -o $s input.c
+echo "# jobs"
+${CTAGS} $O --output-format=stream --jobs=2 -o $s input.c && echo ok
+rm -f $s
+exit 0
@@ -0,0 +1,43 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE --extras=+p --pseudo-tags=TAG_INPUT_FILE_ID"
+a=$BUILDDIR/tags.id
+b=$BUILDDIR/tags.path
+
+echo '# sorted'
+${CTAGS} $O -o - -R src | sort
+echo '# unsorted'
+${CTAGS} $O --sort=no -o - -R src | sort
+
+echo '# readtags'
+${CTAGS} $O -o $a -R src
+${CTAGS} --quiet --options=NONE -o $b -R src
+for q in "-l" "- a_func" "-p - b_"; do
+	if [ "$(${READTAGS} -t $a -ne $q)" = "$(${READTAGS} -t $b -ne $q)" ]; then
+		echo "$q: ok"
+	else
+		echo "$q: different output"
+	fi
+done
+
+echo '# append'
+${CTAGS} $O --append=replace -o $a src/deep/dir/a.c
+grep -c '^!_TAG_INPUT_FILE_ID' $a
+if [ "$(${READTAGS} -t $a -ne -l)" = "$(${READTAGS} -t $b -ne -l)" ]; then
+	echo ok
+else
+	echo "different output"
+fi
+
+rm -f $a $b
@@ -0,0 +1,2 @@
+int a_var;
+int a_func (void) { return a_var; }
@@ -0,0 +1,2 @@
+static int b_var;
+int b_func (void) { return b_var; }
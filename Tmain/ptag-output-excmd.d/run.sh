@@ -7,7 +7,7 @@ CTAGS=$1
 
 O="--quiet --options=NONE "
 
-for c in number pattern mixed combine; do
+for c in number pattern mixed combine hash; do
 	${CTAGS} $O \
 			 --excmd=$c \
 			 --extras=+p --pseudo-tags=TAG_OUTPUT_EXCMD \
@@ -0,0 +1,32 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+O="--quiet --options=NONE"
+
+run()
+{
+	local n=$1
+	shift
+	${CTAGS} $O --read-ahead=$n -o - "$@"
+}
+
+compare()
+{
+	local msg=$1
+	shift
+	if [ "$(run 0 "$@")" = "$(run 1 "$@")" ] && [ "$(run 0 "$@")" = "$(run 100 "$@")" ]; then
+		echo "$msg: same"
+	else
+		echo "$msg: different"
+	fi
+}
+
+compare "files" src/a.c src/b.c src/c.mak src/d.c src/e.py
+compare "recursion" -R src
+compare "options between files" src/a.c src/b.c --kinds-C=-v src/d.c src/e.py
+
+echo '# invalid number'
+run -1 src/a.c
+exit 0
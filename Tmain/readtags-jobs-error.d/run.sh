@@ -0,0 +1,23 @@
+#!/bin/sh
+
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+READTAGS=$3
+
+. ../utils.sh
+
+#V="valgrind --leak-check=full -v"
+V=
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+if ! ( "${READTAGS}" -h | grep -q -e -j ); then
+    skip "no jobs option in readtags"
+fi
+
+# Each worker fails in evaluating the qualifier, but the error should
+# be reported once.
+${V} ${READTAGS} -t output.tags -j 3 -Q '(< $name 1)' -l
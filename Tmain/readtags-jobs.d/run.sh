@@ -0,0 +1,43 @@
+#!/bin/sh
+
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+READTAGS=$3
+
+. ../utils.sh
+
+#V="valgrind --leak-check=full -v"
+V=
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+if ! ( "${READTAGS}" -h | grep -q -e -j ); then
+    skip "no jobs option in readtags"
+fi
+
+list()
+{
+	${V} ${READTAGS} -t output.tags -ne "$@" -l
+}
+
+for exp in \
+	'-Q|(eq? $kind "member")' \
+	'-S|(<> $kind &kind)' \
+	'-S|(<or> (<> $input &input) (*- (<> $line &line)))' \
+	'-Q|(not (eq? $kind "member"))|-S|(<> $name &name)' \
+	; do
+	echo ";; $exp"
+	IFS='|'
+	set -- $exp
+	unset IFS
+	serial=$(list "$@")
+	for n in 2 3 64; do
+		if [ "$(list -j $n "$@")" != "${serial}" ]; then
+			echo "different output with -j $n"
+		fi
+	done
+	echo "${serial}"
+done
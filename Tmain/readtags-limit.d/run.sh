@@ -0,0 +1,53 @@
+#!/bin/sh
+
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+READTAGS=$3
+
+. ../utils.sh
+
+#V="valgrind --leak-check=full -v"
+V=
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+if ! ( "${READTAGS}" -h | grep -q -e --limit ); then
+	skip "no limit option in readtags"
+fi
+
+if ! ( "${READTAGS}" -h | grep -q -e -S ); then
+	skip "no sorter function in readtags"
+fi
+
+# functions first, then the tags in src/ui/, then shorter names
+S='(<or> (<> (if (eq? $kind "f") 0 1) (if (eq? &kind "f") 0 1))
+         (<> (if (prefix? $input "src/ui/") 0 1) (if (prefix? &input "src/ui/") 0 1))
+         (<> (length $name) (length &name)))'
+
+echo '# the first 3 with a prefix' &&
+${V} ${READTAGS} -t output.tags -k 3 -p - getUs &&
+
+echo '# the best 3 with a prefix' &&
+${V} ${READTAGS} -t output.tags -S "$S" -k 3 -p - getUs &&
+
+echo '# the best 4 of the variables' &&
+${V} ${READTAGS} -t output.tags -Q '(eq? $kind "v")' -S "$S" --limit 4 -l &&
+
+echo '# the best 2 of all with 2 jobs' &&
+${V} ${READTAGS} -t output.tags -S "$S" -j 2 -k2 -l &&
+
+echo '# the same as the sorted list' &&
+for k in 1 2 5 9 10; do
+	if [ "$(${READTAGS} -t output.tags -S "$S" -k $k -l)" != \
+		 "$(${READTAGS} -t output.tags -S "$S" -l | head -n $k)" ]; then
+		echo "different output with -k $k"
+	fi
+done &&
+
+echo '# errors' &&
+for opts in '-k 0 -l' '--limit 3x -l' '--limit'; do
+	${V} ${READTAGS} -t output.tags $opts 2>&1 | sed -e 's|^.*readtags[^:]*: |readtags: |'
+done
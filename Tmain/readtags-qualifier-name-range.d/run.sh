@@ -0,0 +1,35 @@
+#!/bin/sh
+
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+READTAGS=$3
+
+. ../utils.sh
+
+#V="valgrind --leak-check=full -v"
+V=
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+if ! ( "${READTAGS}" -h | grep -q -e -Q ); then
+    skip "no qualifier function in readtags"
+fi
+
+for exp in \
+	'(prefix? $name "Ba")' \
+	'(eq? $name "Foo")' \
+	'(eq? "ae" $name)' \
+	'(and (eq? $kind "member") (prefix? $name "Foo."))' \
+	'(#/^Ba[rz]\./ $name)' \
+	'(#/^Bx?/ $name)' \
+	'((string->regexp "^Foo") $name)' \
+	'(prefix? $name "X")' \
+	'(or (prefix? $name "A") (prefix? $name "C"))' \
+	'(#/^b/i $name)' \
+	; do
+	echo ";; $exp"
+	${V} ${READTAGS} -d -t output.tags -Q "$exp" -l 2>&1 | sed -e 's/^.*readtags[^:]*: //'
+done
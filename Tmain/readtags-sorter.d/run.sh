@@ -30,3 +30,6 @@ ${READTAGS} -t output.tags -ne -S '(<or> (*- (<> (- (or $end $line) $line) (- (o
 
 echo '!_INPUT_ORDER of structure members (linear search)' &&
 ${READTAGS} -t output.tags -ne -Q '(eq? $kind "member")' -S '(<or> (<> $input &input) (<> $line &line) (<> $name &name))' -l
+
+echo '!_REVERSE_ORDER of kinds' &&
+${READTAGS} -t output.tags -ne -S '(<or> (<> &kind $kind) (<> $input &input) (<> $line &line))' -l
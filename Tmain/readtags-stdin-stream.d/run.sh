@@ -0,0 +1,30 @@
+#!/bin/sh
+
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+READTAGS=$3
+
+. ../utils.sh
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+if ! ( "${READTAGS}" -h | grep -q -e -Q ); then
+    skip "no qualifier function in readtags"
+fi
+
+# Listing the tags reads the standard input as it arrives. No temporarily
+# file is needed.
+echo '# -l'
+cat output.tags | TMPDIR=/nonexistent "${READTAGS}" -t - -en -Q '(substr? $name ".a")' -l
+echo '# -S -l'
+cat output.tags | TMPDIR=/nonexistent "${READTAGS}" -t - -S '(<> $line &line)' -l
+
+# The pseudo tags are read again after listing them, so the input is
+# copied.
+echo '# -D -l'
+cat output.tags | "${READTAGS}" -t - -Q '(or (prefix? $name "!_TAG_PROGRAM_N") (substr? $name ".a"))' -D -l
+echo '# -l -D'
+cat output.tags | "${READTAGS}" -t - -Q '(or (prefix? $name "!_TAG_PROGRAM_N") (substr? $name ".a"))' -l -D
@@ -0,0 +1,13 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+# A pattern is compiled when it is used first.
+echo '# not used'
+${CTAGS} --quiet --options=NONE --options=./args.ctags --languages=-Broken -o - ./input.txt 2>&1
+
+echo '# used'
+${CTAGS} --quiet --options=NONE --options=./args.ctags -o - ./input.broken 2>&1
@@ -0,0 +1,8 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+${CTAGS} --quiet --options=NONE --options=./args.ctags --fields=+K -o - ./input.bar
@@ -0,0 +1,21 @@
+int a(void)
+{
+	return 1;
+}
+
+struct s { int m; };
+
+#if 0
+int v = 1;
+#endif
+
+int b(void)
+{
+	return 2;
+}
+}
+
+int c(void)
+{
+	return 3;
+}
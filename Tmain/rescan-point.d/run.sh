@@ -0,0 +1,13 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+
+. ../utils.sh
+
+# The first pass fails at the stray '}' after ignoring the "#if 0" branch.
+# The second pass starts at line 7, the last top-level statement boundary
+# before the branch, and reads 55 of the 132 bytes again.
+${CTAGS} --quiet --options=NONE --sort=no --fields=+ne --totals=json -o - input.cpp 2>&1 \
+	| sed -e 's/.*"languages": {\("C++": {[^}]*\)}.*/\1/' \
+		  -e 's/, "time": {"wall": [0-9.]*, "cpu": [0-9.]*//'
@@ -0,0 +1,16 @@
+namespace geo {
+	class Point {
+	public:
+		int x;
+		int y;
+		void move (int dx, int dy);
+	};
+}
+
+class Shape {
+	int sides;
+	int area (void);
+};
+
+int Shape::area (void) { return 0; }
+struct Point { int z; };
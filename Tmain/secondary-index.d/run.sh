@@ -0,0 +1,54 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE"
+TAGS=$BUILDDIR/secondary-index.tags
+
+lookup()
+{
+	for f in input.cpp input.py nothere.c; do
+		echo "-f $f:" $(${READTAGS} -t $TAGS -f $f | cut -f1)
+	done
+	for s in class:Point namespace:geo class:geo::Point class:Shape struct:Point; do
+		echo "-m $s:" $(${READTAGS} -t $TAGS -m $s | cut -f1)
+	done
+}
+
+rm -f $TAGS $TAGS.secondary
+${CTAGS} $O --secondary-index -o $TAGS input.cpp input.py
+head -1 $TAGS.secondary | cut -f1,2,4,5
+lookup > $BUILDDIR/secondary-index.with
+cat $BUILDDIR/secondary-index.with
+
+mv $TAGS.secondary $TAGS.saved
+lookup > $BUILDDIR/secondary-index.without
+cmp $BUILDDIR/secondary-index.with $BUILDDIR/secondary-index.without && echo "same results without index"
+
+# An index not matching the tag file must not change the results.
+sed -e '1s/\t[0-9]*\t/\t1\t/' $TAGS.saved > $TAGS.secondary
+lookup > $BUILDDIR/secondary-index.stale
+cmp $BUILDDIR/secondary-index.with $BUILDDIR/secondary-index.stale && echo "same results with stale index"
+
+echo "# scope key"
+${CTAGS} $O --secondary-index --fields=+Z -o $TAGS input.cpp input.py
+lookup > $BUILDDIR/secondary-index.scope-key
+cmp $BUILDDIR/secondary-index.with $BUILDDIR/secondary-index.scope-key && echo "same results with scope key"
+
+echo "# unsorted"
+${CTAGS} $O --secondary-index -u -o $BUILDDIR/secondary-index-u.tags input.cpp
+[ -e $BUILDDIR/secondary-index-u.tags.secondary ] || echo "no index"
+
+rm -f $TAGS $TAGS.secondary $TAGS.saved $BUILDDIR/secondary-index-u.tags \
+   $BUILDDIR/secondary-index.with $BUILDDIR/secondary-index.without \
+   $BUILDDIR/secondary-index.stale $BUILDDIR/secondary-index.scope-key
+exit 0
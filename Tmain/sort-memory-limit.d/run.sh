@@ -0,0 +1,43 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+O="--quiet --options=NONE"
+
+compare()
+{
+	local msg=$1
+	shift
+	local a=$BUILDDIR/tags.sorted-in-memory
+	local b=$BUILDDIR/tags.spilled
+	rm -f $a $b
+	${CTAGS} $O -o $a "$@"
+	${CTAGS} $O --sort-memory-limit=64 -o $b "$@"
+	if cmp -s $a $b &&
+		   [ "$(${CTAGS} $O -o - "$@")" = "$(${CTAGS} $O --sort-memory-limit=1 -o - "$@")" ]; then
+		echo "$msg: same"
+	else
+		echo "$msg: different"
+	fi
+	rm -f $a $b
+}
+
+compare "sorted" src/a.c src/b.c src/e.py
+compare "foldcase" --sort=foldcase src/a.c src/b.c src/e.py
+compare "xref" --sort=yes -x src/a.c src/b.c src/e.py
+# More sorted runs than kept open at once
+compare "runs" $(for i in 1 2 3 4 5 6; do echo src/a.c src/b.c src/e.py; done)
+
+for s in 1K 2m 3G; do
+	${CTAGS} $O --sort-memory-limit=$s -o - src/a.c > /dev/null && echo "$s: accepted"
+done
+
+for s in 0 -1 1X K; do
+	echo "# $s"
+	${CTAGS} $O --sort-memory-limit=$s -o - src/a.c
+done
+exit 0
@@ -0,0 +1,2 @@
+int a0;
+void a1 (void) { }
@@ -0,0 +1,63 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+READTAGS=$3
+
+if ! [ -x "${READTAGS}" ]; then
+	skip "no readtags"
+fi
+
+O="--quiet --options=NONE"
+SRC=$BUILDDIR/trigram-index-input.c
+TAGS=$BUILDDIR/trigram-index.tags
+
+i=0
+: > $SRC
+while [ $i -lt 400 ]; do
+	echo "int func$i (void) { return $i; }" >> $SRC
+	echo "int Var${i}Count;" >> $SRC
+	i=$((i + 1))
+done
+
+lookup()
+{
+	for n in nc17 c399 var1 ar25 Var250Count TAG xyz; do
+		echo "$n:" $(${READTAGS} -t $TAGS -c - $n | cut -f1)
+	done
+	echo "-i VAR12:" $(${READTAGS} -t $TAGS -c -i - VAR12 | cut -f1)
+	for n in unc un Count; do
+		echo "$n:" $(${READTAGS} -t $TAGS -c - $n | wc -l) tags
+	done
+}
+
+rm -f $TAGS $TAGS.trigrams
+${CTAGS} $O --trigram-index -o $TAGS $SRC
+head -1 $TAGS.trigrams | cut -f1,2
+if [ $(wc -l < $TAGS.trigrams) -gt 2 ]; then
+	echo "index has entries"
+fi
+
+lookup > $BUILDDIR/trigram-index.with
+cat $BUILDDIR/trigram-index.with
+mv $TAGS.trigrams $TAGS.saved
+lookup > $BUILDDIR/trigram-index.without
+cmp $BUILDDIR/trigram-index.with $BUILDDIR/trigram-index.without && echo "same results without index"
+
+# An index not matching the tag file must not change the results.
+sed -e '1s/\t[0-9]*\t/\t1\t/' $TAGS.saved > $TAGS.trigrams
+lookup > $BUILDDIR/trigram-index.stale
+cmp $BUILDDIR/trigram-index.with $BUILDDIR/trigram-index.stale && echo "same results with stale index"
+
+echo "# unsorted"
+${CTAGS} $O --trigram-index -u -o $BUILDDIR/trigram-index-u.tags $SRC
+[ -e $BUILDDIR/trigram-index-u.tags.trigrams ] || echo "no index"
+echo "# stdout"
+${CTAGS} $O --trigram-index -o - $SRC > /dev/null
+
+rm -f $SRC $TAGS $TAGS.trigrams $TAGS.saved $BUILDDIR/trigram-index-u.tags \
+   $BUILDDIR/trigram-index.with $BUILDDIR/trigram-index.without $BUILDDIR/trigram-index.stale
+exit 0
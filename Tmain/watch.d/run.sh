@@ -0,0 +1,59 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+. ../utils.sh
+
+CTAGS=$1
+BUILDDIR=$2
+
+is_feature_available ${CTAGS} watch
+
+O="--quiet --options=NONE --extras=-p"
+D=$BUILDDIR/watch-src
+T=$BUILDDIR/watch-tags
+
+rm -rf $D $T $T.*
+mkdir -p $D
+cp a.c $D
+
+# Wait until the tag file has PATTERN, for 10 seconds at most
+wait_for()
+{
+	local i
+	for i in $(seq 100); do
+		if grep -q "$1" $T 2>/dev/null; then
+			return 0
+		fi
+		sleep 0.1
+	done
+	echo "timed out waiting for $1"
+	return 1
+}
+
+( cd $BUILDDIR && exec ${CTAGS} $O --watch -R -o $T watch-src ) &
+pid=$!
+
+echo "# first"
+wait_for a1 && cat $T
+
+echo "# b.c added"
+cp b.c $D
+wait_for b1 && cat $T
+
+echo "# a.c removed"
+rm $D/a.c
+for i in $(seq 100); do
+	grep -q a1 $T || break
+	sleep 0.1
+done
+cat $T
+
+kill $pid
+wait $pid 2>/dev/null
+
+echo '# incompatible options'
+${CTAGS} $O --watch -L - < /dev/null
+${CTAGS} $O --watch --print-language a.c
+
+rm -rf $D $T $T.*
+exit 0
@@ -0,0 +1,19 @@
+# Copyright: 2026 Universal Ctags contributors
+# License: GPL-2
+
+CTAGS=$1
+BUILDDIR=$2
+
+. ../utils.sh
+
+is_feature_available $CTAGS xpath
+
+for f in input.svg input.glade; do
+	echo "# $f"
+	${CTAGS} --quiet --options=NONE --extras=+r --fields=+nrK --fields=-{xpath} -o - $f > $BUILDDIR/dom.tags
+	${CTAGS} --quiet --options=NONE --extras=+r --fields=+nrK --fields=-{xpath} -o - \
+			 --_xml-stream-threshold=0 $f > $BUILDDIR/stream.tags
+	cat $BUILDDIR/stream.tags
+	cmp $BUILDDIR/dom.tags $BUILDDIR/stream.tags && echo same as DOM
+	rm $BUILDDIR/dom.tags $BUILDDIR/stream.tags
+done
@@ -0,0 +1,27 @@
+	.file	"counter.c"
+	.text
+	.p2align 4
+	.globl	counter_next
+	.type	counter_next, @function
+counter_next:
+.LFB0:
+	.cfi_startproc
+	movl	counter(%rip), %eax
+	addl	$1, %eax
+#APP
+# 4 "counter.c" 1
+	nop # "#define in a comment"
+# 0 "" 2
+#NO_APP
+	movl	%eax, counter(%rip)
+	ret
+	.cfi_endproc
+.LFE0:
+	.size	counter_next, .-counter_next
+	.section	.rodata.str1.1,"aMS",@progbits,1
+.LC0:
+	.string	"label: not a label"
+	.local	counter
+	.comm	counter,4,4
+	.ident	"GCC: (GNU) 13.2.0"
+	.section	.note.GNU-stack,"",@progbits
@@ -0,0 +1,21 @@
+int before;
+#if 0
+int ignored0;
+int ignored1 = f (a, b);
+/* a comment in an ignored branch
+#endif
+#else
+*/
+char *s = "a string \
+#else";
+// a comment \
+#endif
+	  #ifdef NESTED
+int ignored2;
+	  #endif
+int ignored3; ??=endif
+int ignored4; %:endif
+#else
+int visible;
+#endif
+int after;
@@ -0,0 +1,47 @@
+/* The bodies are skipped when only functions and prototypes are tagged. */
+static int f0 (int n)
+{
+	const char *s = "}";
+	char c = '}';
+	/* } */
+	// }
+	int a[] = { 1, 2, { 3 } };
+	struct { int x; } v = { 0 };
+	enum { E0, E1 } e = E1;
+	if (n > 0) {
+		return (struct p) { n, '{' }.x;
+	}
+	switch (n) {
+	case '}':
+		break;
+	default:
+		{ n++; }
+	}
+	return a[0] + v.x + e + (s[0] == c);
+}
+
+int f1 (void)
+{
+#if X
+	if (f0 (1)) {
+#else
+	if (f0 (2)) {
+#endif
+		f0 (3);
+	}
+	return 0;
+}
+
+struct { int y; } f2 (void)
+{
+	struct { int z; } w;
+	return (struct { int y; }) { w.z };
+}
+
+int f3 (void);
+
+int f4 (int (*g) (void))
+{
+	int f5 (void);
+	return f5 () + g ();
+}
@@ -0,0 +1,11 @@
+(ns app.core)
+
+(defn outer
+  "Returns x.
+  (defn in-docstring [])"
+  [x]
+  (let [c \(]
+    x))
+
+(defn after-outer [] \))
+(defn last-one [])
@@ -0,0 +1,6 @@
+#include "input.h"
+
+DEFUN(myfunc)
+  BEGIN
+  return -1;
+  END
@@ -0,0 +1,3 @@
+#define DEFUN(NAME) int NAME (int x, int y)
+#define BEGIN {
+#define END }
@@ -0,0 +1,8 @@
+// The stray closing bracket below stops the parser. No branch of a
+// preprocessor conditional is ignored, so the input is not parsed again
+// and the anonymous types keep the names given in the first pass.
+struct { int a; } v1;
+enum { X, Y } e1;
+int f() { return 0; }
+}
+struct { int b; } v2;
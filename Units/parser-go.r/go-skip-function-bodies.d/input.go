@@ -0,0 +1,32 @@
+package main
+
+func f0() {
+	s := "}{\"}"
+	r := '}'
+	q := '\''
+	b := `}\`
+	_, _, _, _ = s, r, q, b
+}
+
+func f1() int {
+	// }
+	/* } **/
+	if true {
+		return 1
+	}
+	return 0
+}
+
+var v0 = []int{1, 2, 3}
+
+func f2(x [2]int) {
+	m := map[string]struct{ a int }{"}": {a: 1}}
+	_ = m
+}
+
+type t0 struct {
+	a int
+}
+
+func (t *t0) f3() {
+}
@@ -0,0 +1,13 @@
+(defun outer (x)
+  "Returns X.
+(defun in-docstring ())"
+  #| (defun in-block-comment ()) |#
+  (let ((c #\())
+(defvar in-body c)
+    x))
+
+(defmacro after-outer (&body body)
+  `(progn ,@body))
+
+(defun unbalanced (
+(defun recovered ())
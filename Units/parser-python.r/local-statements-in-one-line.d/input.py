@@ -0,0 +1,19 @@
+def f(a):
+    s = "x\" # y"; g = lambda: 1
+    t = """a"""  # c
+    u = (1,
+         lambda: 2)
+    v, w = 1, lambda: 3
+    n = types.SimpleNamespace(m=lambda: 4)
+    if a: x = 5
+    return a
+
+class C:
+    def m(self):
+        y = 'class C2: pass'
+        z = "def f2(): pass"
+        def inner(): pass
+        h = lambda: 6
+    k = 7
+
+z = 8
@@ -0,0 +1,11 @@
+# region: R
+def f():
+    pass
+
+class C:
+    def m(self):
+        pass
+# item: i
+# endregion
+def g():
+    pass
@@ -0,0 +1,28 @@
+-- Rows in the form of a MySQL dump
+CREATE TABLE t1 (a int, b varchar(64));
+INSERT INTO t1 VALUES (1,'x; CREATE TABLE fake1 (a int);'),(2,'it''s; "quoted"'),
+(3,'-- not a comment; /* nor this */'), /* a comment; 'with a quote */
+-- another; comment 'with a quote
+(4, "double; quoted");
+CREATE TABLE t2 (a int);
+
+-- Rows in the form of a PostgreSQL dump
+COPY public.t2 (a) FROM stdin;
+1	CREATE TABLE fake2 (a int);
+2	it's; done
+\.
+CREATE TABLE t3 (a int);
+
+-- Statements without the terminator in T-SQL
+insert into t3 values (1)
+GO
+INSERT INTO t3 VALUES (2)
+CREATE TABLE t4 (a int)
+INSERT INTO t4
+	VALUES (1)
+GO
+
+-- A statement in a dollar-quoted string
+INSERT INTO t4 VALUES ($$a; CREATE TABLE fake3 (x int);$$);
+INSERT INTO t4 VALUES ($q$b; $$ CREATE TABLE fake4 (x int);$q$);
+CREATE TABLE t5 (x int);
@@ -0,0 +1,2 @@
+int foo;/* 000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000 */
+int bar;
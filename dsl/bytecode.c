@@ -0,0 +1,896 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   A compiler translating the common forms of qualifier and sorter
+*   expressions into a flat instruction array. The instructions read the
+*   fields of a tag entry in place: no EsObject is made while running them.
+*   For anything the instructions cannot decide, like a string operator
+*   applied to a missing field, the caller evaluates the expression with
+*   dsl_eval() as before. So the results and errors are the same.
+*/
+
+/*
+ * INCLUDES
+ */
+#include "bytecode.h"
+
+#include <errno.h>
+#include <limits.h>
+#include <regex.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+/*
+ * TYPES
+ */
+enum eBCFieldType {
+	BC_FIELD_NAME,
+	BC_FIELD_INPUT,
+	BC_FIELD_PATTERN,
+	BC_FIELD_KIND,
+	BC_FIELD_EXTENSION,			/* looked up with key */
+	BC_FIELD_SCOPE_KIND,
+	BC_FIELD_SCOPE_NAME,
+	BC_FIELD_TYPEREF_KIND,
+	BC_FIELD_TYPEREF_NAME,
+	BC_FIELD_LINE,				/* integer fields follow */
+	BC_FIELD_END,
+	BC_FIELD_NTH,
+	BC_FIELD_FILE,				/* boolean */
+};
+
+typedef struct sBCField {
+	enum eBCFieldType type;
+	const char *key;			/* for BC_FIELD_EXTENSION */
+	int alt;					/* read the alternative entry (&field) */
+} bcField;
+
+enum eBCOpcode {
+	BC_PUSH,					/* push num */
+	BC_TEST,					/* push whether field is not #f */
+	BC_EQ_STR,					/* (eq? field str) */
+	BC_EQ_INT,					/* (eq? field num) */
+	BC_PREFIX,					/* (prefix? field str) */
+	BC_SUFFIX,					/* (suffix? field str) */
+	BC_SUBSTR,					/* (substr? field str) */
+	BC_REGEX,					/* (#/regex/ field) */
+	BC_LT,						/* (< field num) */
+	BC_GT,
+	BC_LE,
+	BC_GE,
+	BC_NOT,
+	BC_AND,						/* if the top is false, jump; else pop */
+	BC_OR,						/* if the top is true, jump; else pop */
+};
+
+typedef struct sBCInsn {
+	enum eBCOpcode op;
+	bcField field;
+	char *str;
+	size_t len;
+	long num;
+	regex_t *regex;
+	unsigned int jump;
+} bcInsn;
+
+typedef struct sBCCompare {
+	bcField a, b;
+	int flip;
+} bcCompare;
+
+struct sDSLBytecode {
+	bcInsn *insns;
+	unsigned int count;
+	unsigned int size;
+	char *stack;				/* as deep as count */
+
+	bcCompare *cmps;			/* for sorters */
+	unsigned int ncmps;
+
+	char *scratch;				/* for NUL terminating a part of a field */
+	size_t scratch_size;
+};
+
+static const struct {
+	const char *name;
+	enum eBCFieldType type;
+	const char *key;
+} bcFieldTable [] = {
+	{ "name",           BC_FIELD_NAME,         NULL },
+	{ "input",          BC_FIELD_INPUT,        NULL },
+	{ "pattern",        BC_FIELD_PATTERN,      NULL },
+	{ "kind",           BC_FIELD_KIND,         NULL },
+	{ "access",         BC_FIELD_EXTENSION,    "access" },
+	{ "extras",         BC_FIELD_EXTENSION,    "extras" },
+	{ "inherits",       BC_FIELD_EXTENSION,    "inherits" },
+	{ "implementation", BC_FIELD_EXTENSION,    "implementation" },
+	{ "language",       BC_FIELD_EXTENSION,    "language" },
+	{ "scope",          BC_FIELD_EXTENSION,    "scope" },
+	{ "signature",      BC_FIELD_EXTENSION,    "signature" },
+	{ "typeref",        BC_FIELD_EXTENSION,    "typeref" },
+	{ "roles",          BC_FIELD_EXTENSION,    "roles" },
+	{ "xpath",          BC_FIELD_EXTENSION,    "xpath" },
+	{ "scope-kind",     BC_FIELD_SCOPE_KIND,   NULL },
+	{ "scope-name",     BC_FIELD_SCOPE_NAME,   NULL },
+	{ "typeref-kind",   BC_FIELD_TYPEREF_KIND, NULL },
+	{ "typeref-name",   BC_FIELD_TYPEREF_NAME, NULL },
+	{ "line",           BC_FIELD_LINE,         NULL },
+	{ "end",            BC_FIELD_END,          NULL },
+	{ "nth",            BC_FIELD_NTH,          NULL },
+	{ "file",           BC_FIELD_FILE,         NULL },
+};
+
+
+/*
+ * FUNCTION DEFINITIONS
+ */
+
+/*
+ * Field accessors
+ */
+static const char *entry_xget (const tagEntry *entry, const char *key)
+{
+	for (unsigned int i = 0; i < entry->fields.count; i++)
+	{
+		if (strcmp (entry->fields.list [i].key, key) == 0)
+			return entry->fields.list [i].value;
+	}
+	return NULL;
+}
+
+/* Split "KIND:NAME" like dsl_entry_scope_kind and friends do. */
+static const char *get_kind_or_name (const char *value, int name, size_t *len)
+{
+	const char *colon;
+
+	if (value == NULL)
+		return NULL;
+	colon = strchr (value, ':');
+	if (colon == NULL)
+		return NULL;
+	if (!name)
+	{
+		*len = colon - value;
+		return value;
+	}
+	if (colon [1] == '\0')
+		return NULL;
+	*len = strlen (colon + 1);
+	return colon + 1;
+}
+
+/* Return the value of a string field, or NULL if the field is #f. The
+ * value may not be terminated with NUL at *LEN. */
+static const char *get_string (const bcField *f, const tagEntry *entry, size_t *len)
+{
+	const char *s;
+
+	switch (f->type)
+	{
+	case BC_FIELD_NAME:
+		s = entry->name;
+		break;
+	case BC_FIELD_INPUT:
+		s = entry->file;
+		break;
+	case BC_FIELD_PATTERN:
+		s = entry->address.pattern;
+		break;
+	case BC_FIELD_KIND:
+		s = entry->kind;
+		break;
+	case BC_FIELD_EXTENSION:
+		s = entry_xget (entry, f->key);
+		break;
+	case BC_FIELD_SCOPE_KIND:
+	case BC_FIELD_SCOPE_NAME:
+		return get_kind_or_name (entry_xget (entry, "scope"),
+								 f->type == BC_FIELD_SCOPE_NAME, len);
+	case BC_FIELD_TYPEREF_KIND:
+	case BC_FIELD_TYPEREF_NAME:
+		return get_kind_or_name (entry_xget (entry, "typeref"),
+								 f->type == BC_FIELD_TYPEREF_NAME, len);
+	default:
+		return NULL;
+	}
+	if (s)
+		*len = strlen (s);
+	return s;
+}
+
+/* Return 1 and set *V if the integer field is not #f. */
+static int get_integer (const bcField *f, const tagEntry *entry, long *v)
+{
+	const char *str;
+	char *endstr;
+
+	switch (f->type)
+	{
+	case BC_FIELD_LINE:
+		*v = (long) entry->address.lineNumber;
+		return *v != 0;
+	case BC_FIELD_END:
+		str = entry_xget (entry, "end");
+		break;
+	case BC_FIELD_NTH:
+		str = entry_xget (entry, "nth");
+		break;
+	default:
+		return 0;
+	}
+	if (str == NULL)
+		return 0;
+	errno = 0;
+	*v = strtol (str, &endstr, 10);
+	return (*endstr == '\0' && str != endstr && errno == 0
+			&& *v <= INT_MAX && *v >= INT_MIN);
+}
+
+static int is_integer_field (const bcField *f)
+{
+	return f->type >= BC_FIELD_LINE && f->type <= BC_FIELD_NTH;
+}
+
+static int is_string_field (const bcField *f)
+{
+	return f->type < BC_FIELD_LINE;
+}
+
+static int test_field (const bcField *f, const tagEntry *entry)
+{
+	size_t len;
+	long v;
+
+	if (f->type == BC_FIELD_FILE)
+		return entry->fileScope? 1: 0;
+	else if (is_integer_field (f))
+		return get_integer (f, entry, &v);
+	else
+		return get_string (f, entry, &len) != NULL;
+}
+
+static const char *terminate_string (DSLBytecode *code, const char *s, size_t len)
+{
+	if (s [len] == '\0')
+		return s;
+
+	if (len + 1 > code->scratch_size)
+	{
+		char *p = realloc (code->scratch, len + 1);
+		if (p == NULL)
+			return NULL;
+		code->scratch = p;
+		code->scratch_size = len + 1;
+	}
+	memcpy (code->scratch, s, len);
+	code->scratch [len] = '\0';
+	return code->scratch;
+}
+
+/*
+ * Compiler
+ */
+static int parse_field (EsObject *o, char prefix, bcField *f)
+{
+	const char *name;
+
+	f->key = NULL;
+	f->alt = (prefix == '&');
+
+	if (es_symbol_p (o))
+	{
+		name = es_symbol_get (o);
+		if (name [0] != prefix)
+			return 0;
+		for (unsigned int i = 0; i < sizeof (bcFieldTable) / sizeof (bcFieldTable [0]); i++)
+		{
+			if (strcmp (name + 1, bcFieldTable [i].name) == 0)
+			{
+				f->type = bcFieldTable [i].type;
+				f->key = bcFieldTable [i].key;
+				return 1;
+			}
+		}
+		return 0;
+	}
+
+	/* ($ "key") */
+	if (es_cons_p (o)
+		&& es_symbol_p (es_car (o))
+		&& es_symbol_get (es_car (o)) [0] == prefix
+		&& es_symbol_get (es_car (o)) [1] == '\0'
+		&& es_cons_p (es_cdr (o))
+		&& es_string_p (es_car (es_cdr (o)))
+		&& es_null (es_cdr (es_cdr (o))))
+	{
+		f->type = BC_FIELD_EXTENSION;
+		f->key = es_string_get (es_car (es_cdr (o)));
+		return 1;
+	}
+	return 0;
+}
+
+static bcInsn *emit (DSLBytecode *code, enum eBCOpcode op)
+{
+	bcInsn *insn;
+
+	if (code->count == code->size)
+	{
+		unsigned int size = code->size? code->size * 2: 16;
+		bcInsn *p = realloc (code->insns, sizeof (bcInsn) * size);
+		if (p == NULL)
+			return NULL;
+		code->insns = p;
+		code->size = size;
+	}
+	insn = code->insns + code->count++;
+	memset (insn, 0, sizeof (*insn));
+	insn->op = op;
+	return insn;
+}
+
+static int set_string (bcInsn *insn, EsObject *o)
+{
+	insn->str = strdup (es_string_get (o));
+	if (insn->str == NULL)
+		return 0;
+	insn->len = strlen (insn->str);
+	return 1;
+}
+
+static int compile_regex (bcInsn *insn, const char *pattern, int icase)
+{
+	insn->regex = malloc (sizeof (regex_t));
+	if (insn->regex == NULL)
+		return 0;
+	if (regcomp (insn->regex, pattern,
+				 REG_EXTENDED | REG_NEWLINE | (icase? REG_ICASE: 0)) != 0)
+	{
+		free (insn->regex);
+		insn->regex = NULL;
+		return 0;
+	}
+	return 1;
+}
+
+/* Get the pattern of #/PATTERN/ or (string->regexp "PATTERN" ...). */
+static const char *regex_pattern (EsObject *o, int *icase)
+{
+	const char *pattern = es_regex_get_literal (o, icase);
+	if (pattern)
+		return pattern;
+
+	if (!(es_cons_p (o) && es_symbol_p (es_car (o))
+		  && strcmp (es_symbol_get (es_car (o)), "string->regexp") == 0))
+		return NULL;
+
+	o = es_cdr (o);
+	if (!es_cons_p (o) || !es_string_p (es_car (o)))
+		return NULL;
+	pattern = es_string_get (es_car (o));
+	o = es_cdr (o);
+	*icase = 0;
+	if (es_null (o))
+		return pattern;
+
+	/* :case-fold #t|#f */
+	if (!(es_symbol_p (es_car (o))
+		  && strcmp (es_symbol_get (es_car (o)), ":case-fold") == 0
+		  && es_cons_p (es_cdr (o))
+		  && es_boolean_p (es_car (es_cdr (o)))
+		  && es_null (es_cdr (es_cdr (o)))))
+		return NULL;
+	*icase = es_boolean_get (es_car (es_cdr (o)));
+	return pattern;
+}
+
+static int compile_qualifier (DSLBytecode *code, EsObject *expr);
+
+static int compile_logical (DSLBytecode *code, EsObject *args, enum eBCOpcode op)
+{
+	unsigned int *fixups = NULL;
+	unsigned int nfixups = 0;
+	int r = 1;
+
+	if (es_null (args))
+		return emit (code, BC_PUSH)
+			&& ((code->insns [code->count - 1].num = (op == BC_AND)), 1);
+
+	for (; es_cons_p (args) && r; args = es_cdr (args))
+	{
+		if (!compile_qualifier (code, es_car (args)))
+			r = 0;
+		else if (es_cons_p (es_cdr (args)))
+		{
+			unsigned int *p = realloc (fixups, sizeof (unsigned int) * (nfixups + 1));
+			if (p == NULL || emit (code, op) == NULL)
+			{
+				free (p? p: fixups);
+				return 0;
+			}
+			fixups = p;
+			fixups [nfixups++] = code->count - 1;
+		}
+	}
+	if (r && !es_null (args))
+		r = 0;
+
+	for (unsigned int i = 0; i < nfixups; i++)
+		code->insns [fixups [i]].jump = code->count;
+	free (fixups);
+	return r;
+}
+
+static enum eBCOpcode flip_comparison (enum eBCOpcode op)
+{
+	switch (op)
+	{
+	case BC_LT: return BC_GT;
+	case BC_GT: return BC_LT;
+	case BC_LE: return BC_GE;
+	case BC_GE: return BC_LE;
+	default:    return op;
+	}
+}
+
+static int compile_binary (DSLBytecode *code, const char *name,
+						   EsObject *a, EsObject *b)
+{
+	static const struct {
+		const char *name;
+		enum eBCOpcode op;
+	} ops [] = {
+		{ "eq?",     BC_EQ_STR },
+		{ "prefix?", BC_PREFIX },
+		{ "suffix?", BC_SUFFIX },
+		{ "substr?", BC_SUBSTR },
+		{ "<",       BC_LT },
+		{ ">",       BC_GT },
+		{ "<=",      BC_LE },
+		{ ">=",      BC_GE },
+	};
+	enum eBCOpcode op;
+	bcInsn *insn;
+	bcField f;
+	unsigned int i;
+
+	for (i = 0; i < sizeof (ops) / sizeof (ops [0]); i++)
+		if (strcmp (name, ops [i].name) == 0)
+			break;
+	if (i == sizeof (ops) / sizeof (ops [0]))
+		return 0;
+	op = ops [i].op;
+
+	if (!parse_field (a, '$', &f))
+	{
+		/* Only eq? and the number comparisons can take the field
+		 * as the second argument. */
+		if (op != BC_EQ_STR && op < BC_LT)
+			return 0;
+		if (!parse_field (b, '$', &f))
+			return 0;
+		b = a;
+		op = flip_comparison (op);
+	}
+
+	if (op == BC_EQ_STR && es_integer_p (b) && is_integer_field (&f))
+		op = BC_EQ_INT;
+
+	if (op == BC_EQ_STR || op == BC_PREFIX || op == BC_SUFFIX || op == BC_SUBSTR)
+	{
+		if (!es_string_p (b) || !is_string_field (&f))
+			return 0;
+		insn = emit (code, op);
+		return insn && ((insn->field = f), set_string (insn, b));
+	}
+
+	if (!es_integer_p (b) || !is_integer_field (&f))
+		return 0;
+	insn = emit (code, op);
+	if (insn == NULL)
+		return 0;
+	insn->field = f;
+	insn->num = es_integer_get (b);
+	return 1;
+}
+
+static int compile_qualifier (DSLBytecode *code, EsObject *expr)
+{
+	bcField f;
+	EsObject *op, *args;
+	const char *pattern;
+	int icase = 0;
+
+	if (es_boolean_p (expr))
+	{
+		bcInsn *insn = emit (code, BC_PUSH);
+		return insn && ((insn->num = es_boolean_get (expr)), 1);
+	}
+	if (es_symbol_p (expr)
+		&& (strcmp (es_symbol_get (expr), "true") == 0
+			|| strcmp (es_symbol_get (expr), "false") == 0))
+	{
+		bcInsn *insn = emit (code, BC_PUSH);
+		return insn && ((insn->num = (es_symbol_get (expr) [0] == 't')), 1);
+	}
+	if (parse_field (expr, '$', &f))
+	{
+		bcInsn *insn = emit (code, BC_TEST);
+		return insn && ((insn->field = f), 1);
+	}
+	if (!es_cons_p (expr))
+		return 0;
+
+	op = es_car (expr);
+	args = es_cdr (expr);
+
+	pattern = regex_pattern (op, &icase);
+	if (pattern)
+	{
+		bcInsn *insn;
+		/* Only the boolean form, (#/PATTERN/ field). */
+		if (!(es_cons_p (args) && es_null (es_cdr (args))
+			  && parse_field (es_car (args), '$', &f)
+			  && is_string_field (&f)))
+			return 0;
+		insn = emit (code, BC_REGEX);
+		return insn && ((insn->field = f), compile_regex (insn, pattern, icase));
+	}
+
+	if (!es_symbol_p (op))
+		return 0;
+
+	if (strcmp (es_symbol_get (op), "and") == 0)
+		return compile_logical (code, args, BC_AND);
+	else if (strcmp (es_symbol_get (op), "or") == 0)
+		return compile_logical (code, args, BC_OR);
+	else if (strcmp (es_symbol_get (op), "not") == 0)
+	{
+		if (!(es_cons_p (args) && es_null (es_cdr (args))))
+			return 0;
+		return compile_qualifier (code, es_car (args))
+			&& emit (code, BC_NOT);
+	}
+
+	if (!(es_cons_p (args) && es_cons_p (es_cdr (args))
+		  && es_null (es_cdr (es_cdr (args)))))
+		return 0;
+	return compile_binary (code, es_symbol_get (op),
+						   es_car (args), es_car (es_cdr (args)));
+}
+
+static DSLBytecode *bytecode_new (void)
+{
+	return calloc (1, sizeof (DSLBytecode));
+}
+
+DSLBytecode *dsl_bytecode_compile_qualifier (EsObject *expr)
+{
+	DSLBytecode *code = bytecode_new ();
+
+	if (code == NULL)
+		return NULL;
+
+	if (!compile_qualifier (code, expr)
+		|| (code->stack = malloc (code->count)) == NULL)
+	{
+		dsl_bytecode_free (code);
+		return NULL;
+	}
+	return code;
+}
+
+static int parse_comparison (EsObject *expr, bcCompare *cmp)
+{
+	cmp->flip = 0;
+
+	/* (*- (<> ...)) */
+	if (es_cons_p (expr) && es_symbol_p (es_car (expr))
+		&& strcmp (es_symbol_get (es_car (expr)), "*-") == 0
+		&& es_cons_p (es_cdr (expr)) && es_null (es_cdr (es_cdr (expr))))
+	{
+		cmp->flip = 1;
+		expr = es_car (es_cdr (expr));
+	}
+
+	if (!(es_cons_p (expr) && es_symbol_p (es_car (expr))
+		  && strcmp (es_symbol_get (es_car (expr)), "<>") == 0))
+		return 0;
+	expr = es_cdr (expr);
+	if (!(es_cons_p (expr) && es_cons_p (es_cdr (expr))
+		  && es_null (es_cdr (es_cdr (expr)))))
+		return 0;
+
+	EsObject *a = es_car (expr);
+	EsObject *b = es_car (es_cdr (expr));
+	if (!(parse_field (a, '$', &cmp->a) || parse_field (a, '&', &cmp->a)))
+		return 0;
+	if (!(parse_field (b, '$', &cmp->b) || parse_field (b, '&', &cmp->b)))
+		return 0;
+	return (cmp->a.type != BC_FIELD_FILE && cmp->b.type != BC_FIELD_FILE);
+}
+
+DSLBytecode *dsl_bytecode_compile_sorter (EsObject *expr)
+{
+	DSLBytecode *code = bytecode_new ();
+	unsigned int n = 0;
+	int flip = 0;
+
+	if (code == NULL)
+		return NULL;
+
+	/* (*- (<or> ...)) reverses all the comparisons. */
+	if (es_cons_p (expr) && es_symbol_p (es_car (expr))
+		&& strcmp (es_symbol_get (es_car (expr)), "*-") == 0
+		&& es_cons_p (es_cdr (expr)) && es_null (es_cdr (es_cdr (expr)))
+		&& es_cons_p (es_car (es_cdr (expr)))
+		&& es_symbol_p (es_car (es_car (es_cdr (expr))))
+		&& strcmp (es_symbol_get (es_car (es_car (es_cdr (expr)))), "<or>") == 0)
+	{
+		flip = 1;
+		expr = es_car (es_cdr (expr));
+	}
+
+	if (es_cons_p (expr) && es_symbol_p (es_car (expr))
+		&& strcmp (es_symbol_get (es_car (expr)), "<or>") == 0)
+	{
+		EsObject *o;
+		for (o = es_cdr (expr); es_cons_p (o); o = es_cdr (o))
+			n++;
+		if (n == 0 || !es_null (o)
+			|| (code->cmps = calloc (n, sizeof (bcCompare))) == NULL)
+			goto failure;
+		for (o = es_cdr (expr); es_cons_p (o); o = es_cdr (o))
+		{
+			if (!parse_comparison (es_car (o), code->cmps + code->ncmps))
+				goto failure;
+			code->cmps [code->ncmps].flip ^= flip;
+			code->ncmps++;
+		}
+	}
+	else
+	{
+		if ((code->cmps = calloc (1, sizeof (bcCompare))) == NULL
+			|| !parse_comparison (expr, code->cmps))
+			goto failure;
+		code->ncmps = 1;
+	}
+	return code;
+
+ failure:
+	dsl_bytecode_free (code);
+	return NULL;
+}
+
+void dsl_bytecode_free (DSLBytecode *code)
+{
+	if (code == NULL)
+		return;
+
+	for (unsigned int i = 0; i < code->count; i++)
+	{
+		free (code->insns [i].str);
+		if (code->insns [i].regex)
+		{
+			regfree (code->insns [i].regex);
+			free (code->insns [i].regex);
+		}
+	}
+	free (code->insns);
+	free (code->stack);
+	free (code->cmps);
+	free (code->scratch);
+	free (code);
+}
+
+/*
+ * Interpreter
+ */
+int dsl_bytecode_qualify (DSLBytecode *code, const tagEntry *entry)
+{
+	char *const stack = code->stack;
+	int sp = 0;
+	unsigned int pc = 0;
+
+	while (pc < code->count)
+	{
+		const bcInsn *insn = code->insns + pc++;
+		const char *s;
+		size_t len;
+		long v;
+
+		switch (insn->op)
+		{
+		case BC_PUSH:
+			stack [sp++] = (char) insn->num;
+			break;
+		case BC_TEST:
+			stack [sp++] = (char) test_field (&insn->field, entry);
+			break;
+		case BC_EQ_STR:
+			s = get_string (&insn->field, entry, &len);
+			stack [sp++] = (s && len == insn->len
+							&& memcmp (s, insn->str, len) == 0);
+			break;
+		case BC_EQ_INT:
+			stack [sp++] = (get_integer (&insn->field, entry, &v)
+							&& v == insn->num);
+			break;
+		case BC_PREFIX:
+			s = get_string (&insn->field, entry, &len);
+			if (s == NULL)
+				return DSL_BYTECODE_FALLBACK;
+			stack [sp++] = (len >= insn->len
+							&& memcmp (s, insn->str, insn->len) == 0);
+			break;
+		case BC_SUFFIX:
+			s = get_string (&insn->field, entry, &len);
+			if (s == NULL)
+				return DSL_BYTECODE_FALLBACK;
+			stack [sp++] = (len >= insn->len
+							&& memcmp (s + len - insn->len, insn->str, insn->len) == 0);
+			break;
+		case BC_SUBSTR:
+			s = get_string (&insn->field, entry, &len);
+			if (s == NULL || (s = terminate_string (code, s, len)) == NULL)
+				return DSL_BYTECODE_FALLBACK;
+			stack [sp++] = (strstr (s, insn->str) != NULL);
+			break;
+		case BC_REGEX:
+			s = get_string (&insn->field, entry, &len);
+			if (s == NULL || (s = terminate_string (code, s, len)) == NULL)
+				return DSL_BYTECODE_FALLBACK;
+			stack [sp++] = (regexec (insn->regex, s, 0, NULL, 0) == 0);
+			break;
+		case BC_LT:
+		case BC_GT:
+		case BC_LE:
+		case BC_GE:
+			if (!get_integer (&insn->field, entry, &v))
+				return DSL_BYTECODE_FALLBACK;
+			stack [sp++] = (insn->op == BC_LT)? v <  insn->num
+				:          (insn->op == BC_GT)? v >  insn->num
+				:          (insn->op == BC_LE)? v <= insn->num
+				:                               v >= insn->num;
+			break;
+		case BC_NOT:
+			stack [sp - 1] = !stack [sp - 1];
+			break;
+		case BC_AND:
+			if (!stack [sp - 1])
+				pc = insn->jump;
+			else
+				sp--;
+			break;
+		case BC_OR:
+			if (stack [sp - 1])
+				pc = insn->jump;
+			else
+				sp--;
+			break;
+		}
+	}
+	return stack [sp - 1]? 1: 0;
+}
+
+static int compare_strings (const char *a, size_t alen, const char *b, size_t blen)
+{
+	int r = memcmp (a, b, alen < blen? alen: blen);
+	if (r == 0)
+		r = (alen < blen)? -1: (alen > blen)? 1: 0;
+	return r;
+}
+
+int dsl_bytecode_compare (DSLBytecode *code, const tagEntry *a, const tagEntry *b)
+{
+	int r = 0;
+
+	for (unsigned int i = 0; i < code->ncmps && r == 0; i++)
+	{
+		const bcCompare *cmp = code->cmps + i;
+		const tagEntry *ea = cmp->a.alt? b: a;
+		const tagEntry *eb = cmp->b.alt? b: a;
+
+		if (cmp->a.type == BC_FIELD_INPUT && cmp->b.type == BC_FIELD_INPUT
+			&& ea->file && ea->file == eb->file)
+			r = 0;				/* interned by the caller */
+		else if (is_integer_field (&cmp->a) && is_integer_field (&cmp->b))
+		{
+			long va, vb;
+			if (!get_integer (&cmp->a, ea, &va) || !get_integer (&cmp->b, eb, &vb))
+				return DSL_BYTECODE_FALLBACK;
+			r = (va < vb)? -1: (va > vb)? 1: 0;
+		}
+		else if (is_string_field (&cmp->a) && is_string_field (&cmp->b))
+		{
+			const char *sa, *sb;
+			size_t la, lb;
+			sa = get_string (&cmp->a, ea, &la);
+			sb = get_string (&cmp->b, eb, &lb);
+			if (sa == NULL || sb == NULL)
+				return DSL_BYTECODE_FALLBACK;
+			r = compare_strings (sa, la, sb, lb);
+			r = (r < 0)? -1: (r > 0)? 1: 0;
+		}
+		else
+			return DSL_BYTECODE_FALLBACK;
+
+		if (cmp->flip)
+			r = -r;
+	}
+	return r;
+}
+
+static int is_same_field (const bcField *a, const bcField *b)
+{
+	if (a->type != b->type)
+		return 0;
+	if (a->type == BC_FIELD_EXTENSION)
+		return strcmp (a->key, b->key) == 0;
+	return 1;
+}
+
+unsigned int dsl_bytecode_key_count (DSLBytecode *code)
+{
+	for (unsigned int i = 0; i < code->ncmps; i++)
+	{
+		const bcCompare *cmp = code->cmps + i;
+		if (cmp->a.alt == cmp->b.alt || !is_same_field (&cmp->a, &cmp->b))
+			return 0;
+	}
+	return code->ncmps;
+}
+
+void dsl_bytecode_extract_keys (DSLBytecode *code, const tagEntry *entry,
+								DSLSortKey *keys)
+{
+	for (unsigned int i = 0; i < code->ncmps; i++)
+	{
+		const bcField *f = &code->cmps [i].a;
+
+		if (is_integer_field (f))
+		{
+			keys [i].str = NULL;
+			keys [i].missing = !get_integer (f, entry, &keys [i].num);
+		}
+		else
+		{
+			keys [i].str = get_string (f, entry, &keys [i].len);
+			keys [i].missing = (keys [i].str == NULL);
+		}
+	}
+}
+
+int dsl_bytecode_compare_keys (DSLBytecode *code,
+							   const DSLSortKey *a, const DSLSortKey *b)
+{
+	int r = 0;
+
+	for (unsigned int i = 0; i < code->ncmps && r == 0; i++)
+	{
+		const bcCompare *cmp = code->cmps + i;
+
+		if (a [i].missing || b [i].missing)
+			return DSL_BYTECODE_FALLBACK;
+		else if (a [i].str == NULL)
+			r = (a [i].num < b [i].num)? -1: (a [i].num > b [i].num)? 1: 0;
+		else if (a [i].str == b [i].str && a [i].len == b [i].len)
+			r = 0;
+		else
+		{
+			r = compare_strings (a [i].str, a [i].len, b [i].str, b [i].len);
+			r = (r < 0)? -1: (r > 0)? 1: 0;
+		}
+
+		/* (<> &x $x) sorts in the reverse order. */
+		if (cmp->a.alt)
+			r = -r;
+		if (cmp->flip)
+			r = -r;
+	}
+	return r;
+}
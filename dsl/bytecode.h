@@ -0,0 +1,77 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*/
+
+#ifndef BYTECODE_H
+#define BYTECODE_H
+
+/*
+ * INCLUDES
+ */
+#include "es.h"
+#include "readtags.h"
+
+
+/*
+ * TYPES
+ */
+typedef struct sDSLBytecode DSLBytecode;
+
+/* The result of running bytecode */
+enum eDSLBytecodeResult {
+	/* The bytecode cannot tell the result for the entry; for example,
+	 * a field used as a string is missing. Evaluate the expression with
+	 * dsl_eval() to get the result or the error. */
+	DSL_BYTECODE_FALLBACK = -2,
+};
+
+/* A field of an entry extracted once for sorting. STR is NULL for an
+ * integer field. STR may not be terminated with NUL at LEN. MISSING is
+ * set if the field is #f. */
+typedef struct sDSLSortKey {
+	const char *str;
+	size_t len;
+	long num;
+	int missing;
+} DSLSortKey;
+
+
+/*
+ * Function declarations
+ */
+
+/* Compile a qualifier or sorter expression into a flat instruction array.
+ * Return NULL if EXPR uses a form the bytecode doesn't support. */
+DSLBytecode *dsl_bytecode_compile_qualifier (EsObject *expr);
+DSLBytecode *dsl_bytecode_compile_sorter    (EsObject *expr);
+
+/* Return 1 (accept), 0 (reject), or DSL_BYTECODE_FALLBACK. */
+int          dsl_bytecode_qualify (DSLBytecode *code, const tagEntry *entry);
+
+/* Return -1, 0, 1, or DSL_BYTECODE_FALLBACK. */
+int          dsl_bytecode_compare (DSLBytecode *code,
+								   const tagEntry *a, const tagEntry *b);
+
+/* Return the number of the sort keys of an entry if every comparison of
+ * the sorter compares a field of an entry with the same field of the
+ * other entry, like (<> $name &name). Return 0 if not. */
+unsigned int dsl_bytecode_key_count (DSLBytecode *code);
+
+/* Extract the sort keys of ENTRY into KEYS. The keys point to the
+ * strings of ENTRY. */
+void         dsl_bytecode_extract_keys (DSLBytecode *code, const tagEntry *entry,
+										DSLSortKey *keys);
+
+/* Return -1, 0, or 1 like dsl_bytecode_compare() for the entries the
+ * keys are extracted from. Return DSL_BYTECODE_FALLBACK if the keys
+ * deciding the order include a missing one; compare the entries with
+ * dsl_eval() then. */
+int          dsl_bytecode_compare_keys (DSLBytecode *code,
+										const DSLSortKey *a, const DSLSortKey *b);
+
+void         dsl_bytecode_free    (DSLBytecode *code);
+
+#endif
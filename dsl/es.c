@@ -1309,6 +1309,19 @@ es_regex_p   (const EsObject*   object)
 	return es_object_type_p(object, ES_TYPE_REGEX);
 }
 
+const char*
+es_regex_get_literal (const EsObject* object, int *case_insensitive)
+{
+	if (es_regex_p (object))
+	{
+		if (case_insensitive)
+			*case_insensitive = ((EsRegex*)object)->case_insensitive;
+		return ((EsRegex*)object)->literal;
+	}
+	else
+		return NULL;
+}
+
 static void es_regex_free(EsObject* object)
 {
 	free(((EsRegex*)object)->literal);
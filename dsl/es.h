@@ -156,6 +156,8 @@ EsObject*    es_cdr         (const EsObject* object);
 EsObject*    es_regex_compile (const char* pat,
 							   int case_insensitive);
 int          es_regex_p       (const EsObject* object);
+const char*  es_regex_get_literal (const EsObject* regex,
+								   int *case_insensitive);
 EsObject*    es_regex_exec    (const EsObject* regex,
 							   const EsObject* str);
 
@@ -37,6 +37,7 @@ struct sOptVM
 
 	int        print_depth;
 	int        read_depth;
+	int        loop_depth;	/* exit is caught by a loop if > 0 */
 	char      *prompt;
 	void      *app_data;
 };
@@ -1487,6 +1488,10 @@ vm_call_operator (OptVM *vm, EsObject *op)
 		vm_estack_pop (vm);
 		if (es_object_equal (OPT_ERR_STOPPED, r))
 			vm_record_stop (vm, op);
+		else if (es_object_equal (OPT_ERR_INVALIDEXIT, r)
+				 && vm->loop_depth > 0)
+			;	/* Just leaving a loop. Recording the stacks
+				 * costs much if the operand stack is deep. */
 		else
 			vm_record_error (vm, r, op);
 		return r;
@@ -3716,6 +3721,7 @@ op_loop (OptVM *vm, EsObject *name)
 	ptrArrayDeleteLast (vm->ostack);
 
 	EsObject *e;
+	vm->loop_depth++;
 	while (true)
 	{
 		e = vm_call_proc (vm, proc);
@@ -3728,6 +3734,7 @@ op_loop (OptVM *vm, EsObject *name)
 		else if (es_error_p (e))
 			break;
 	}
+	vm->loop_depth--;
 	es_object_unref (proc);
 	return e;
 }
@@ -3759,6 +3766,7 @@ op_repeat (OptVM *vm, EsObject *name)
 	ptrArrayDeleteLast (vm->ostack);
 
 	EsObject *e = es_false;
+	vm->loop_depth++;
 	for (int i = 0; i < n; i++)
 	{
 		e = vm_call_proc (vm, proc);
@@ -3771,6 +3779,7 @@ op_repeat (OptVM *vm, EsObject *name)
 		else if (es_error_p (e))
 			break;
 	}
+	vm->loop_depth--;
 	es_object_unref (proc);
 	return e;
 }
@@ -3784,7 +3793,11 @@ op_stop (OptVM *vm, EsObject *name)
 static EsObject*
 op_stopped (OptVM *vm, EsObject *name)
 {
+	/* exit doesn't go out of stopped. */
+	int loop_depth = vm->loop_depth;
+	vm->loop_depth = 0;
 	EsObject *e = op_exec (vm, name);
+	vm->loop_depth = loop_depth;
 	vm_ostack_push (vm, es_error_p (e)? es_true: es_false);
 	return es_false;
 }
@@ -3816,6 +3829,7 @@ op_for (OptVM *vm, EsObject *name)
 	ptrArrayDeleteLastInBatch (vm->ostack, 3);
 
 	EsObject *r = es_false;
+	vm->loop_depth++;
 	for (int i = initial;
 		 (increment >= 0) ? (i <= limit) : (i >= limit);
 		 i += increment)
@@ -3834,6 +3848,7 @@ op_for (OptVM *vm, EsObject *name)
 		if (es_error_p (r))
 			break;
 	}
+	vm->loop_depth--;
 	es_object_unref (proc);
 	return r;
 }
@@ -4330,7 +4345,9 @@ op_forall (OptVM *vm, EsObject *name)
 
 	ptrArrayRemoveLast (vm->ostack);
 	ptrArrayRemoveLast (vm->ostack);
+	vm->loop_depth++;
 	EsObject *e = (*proc_driver) (vm, name, proc, obj);
+	vm->loop_depth--;
 	es_object_unref (proc);
 	es_object_unref (obj);
 
@@ -10,10 +10,12 @@
  * INCLUDES
  */
 #include "qualifier.h"
+#include "bytecode.h"
 #include "dsl.h"
 #include "es.h"
 
 #include <stdlib.h>
+#include <string.h>
 
 /*
  * TYPES
@@ -21,6 +23,12 @@
 struct sQCode
 {
 	DSLCode *dsl;
+	DSLBytecode *bc;			/* NULL if exp is not compilable */
+
+	/* Every accepted tag has a name starting with (or, if name_full
+	 * is set, equal to) name_range. NULL if unknown. */
+	char *name_range;
+	int name_full;
 };
 
 
@@ -49,6 +57,112 @@ static int initialize (void)
 	return 1;
 }
 
+static int is_name_ref (EsObject *o)
+{
+	return es_symbol_p (o) && strcmp (es_symbol_get (o), "$name") == 0;
+}
+
+/* The literal prefix of an extended regular expression anchored with '^'.
+ * Return the length of the prefix, or 0 if there is none. */
+static size_t regex_literal_prefix (const char *pat)
+{
+	size_t len = 0;
+
+	if (pat[0] != '^' || strchr (pat, '|'))
+		return 0;
+
+	for (pat++; pat[len] && !strchr (".[]()*+?{}\\^$", pat[len]); len++)
+		;
+	/* A quantifier applies to the last literal character. */
+	if (len > 0 && pat[len] && strchr ("*?{", pat[len]))
+		len--;
+	return len;
+}
+
+/* Find a constraint on $name in EXP that holds for every tag making EXP
+ * true: (prefix? $name "lit"), (eq? $name "lit"), (#/^lit.../ $name), or
+ * an `and' having one of them as a conjunct. */
+static int find_name_constraint (EsObject *exp, const char **lit, size_t *len,
+								 int *full)
+{
+	EsObject *op, *args;
+
+	if (!es_cons_p (exp))
+		return 0;
+	op = es_car (exp);
+	args = es_cdr (exp);
+
+	if (es_symbol_p (op) && strcmp (es_symbol_get (op), "and") == 0)
+	{
+		int found = 0;
+		for (; es_cons_p (args); args = es_cdr (args))
+		{
+			const char *l;
+			size_t n;
+			int f;
+			if (!find_name_constraint (es_car (args), &l, &n, &f))
+				continue;
+			if (!found || (f && !*full) || (f == *full && n > *len))
+			{
+				*lit = l;
+				*len = n;
+				*full = f;
+				found = 1;
+			}
+		}
+		return found;
+	}
+
+	if (!es_cons_p (args) || !es_cons_p (es_cdr (args)))
+	{
+		int icase = 1;
+		const char *pat = es_regex_get_literal (op, &icase);
+
+		/* (string->regexp "PATTERN") without :case-fold */
+		if (es_cons_p (op) && es_symbol_p (es_car (op))
+			&& strcmp (es_symbol_get (es_car (op)), "string->regexp") == 0
+			&& es_cons_p (es_cdr (op)) && es_string_p (es_car (es_cdr (op)))
+			&& es_null (es_cdr (es_cdr (op))))
+		{
+			pat = es_string_get (es_car (es_cdr (op)));
+			icase = 0;
+		}
+
+		/* Only the boolean form, (#/PATTERN/ $name), constrains the name. */
+		if (pat && !icase && es_cons_p (args) && is_name_ref (es_car (args))
+			&& es_null (es_cdr (args)))
+		{
+			*len = regex_literal_prefix (pat);
+			*lit = pat + 1;
+			*full = 0;
+			return *len > 0;
+		}
+		return 0;
+	}
+	if (!es_null (es_cdr (es_cdr (args))) || !es_symbol_p (op))
+		return 0;
+
+	EsObject *a = es_car (args);
+	EsObject *b = es_car (es_cdr (args));
+	if (strcmp (es_symbol_get (op), "prefix?") == 0
+		&& is_name_ref (a) && es_string_p (b))
+	{
+		*lit = es_string_get (b);
+		*full = 0;
+	}
+	else if (strcmp (es_symbol_get (op), "eq?") == 0
+			 && ((is_name_ref (a) && es_string_p (b))
+				 || (is_name_ref (b) && es_string_p (a))))
+	{
+		*lit = es_string_get (is_name_ref (a)? b: a);
+		*full = 1;
+	}
+	else
+		return 0;
+	*len = strlen (*lit);
+	return *len > 0;
+}
+
 QCode  *q_compile (EsObject *exp)
 {
 	QCode *code;
@@ -63,13 +177,34 @@ QCode  *q_compile (EsObject *exp)
 		return NULL;
 	}
 
+	code->name_range = NULL;
+	code->name_full = 0;
+	{
+		const char *lit;
+		size_t len;
+		if (find_name_constraint (exp, &lit, &len, &code->name_full))
+		{
+			code->name_range = malloc (len + 1);
+			if (code->name_range == NULL)
+			{
+				fprintf(stderr, "MEMORY EXHAUSTED\n");
+				free (code);
+				return NULL;
+			}
+			memcpy (code->name_range, lit, len);
+			code->name_range [len] = '\0';
+		}
+	}
+
 	code->dsl = dsl_compile (DSL_QUALIFIER, exp);
 	if (code->dsl == NULL)
 	{
 		fprintf(stderr, "MEMORY EXHAUSTED or SYNTAX ERROR\n");
+		free (code->name_range);
 		free (code);
 		return NULL;
 	}
+	code->bc = dsl_bytecode_compile_qualifier (exp);
 	return code;
 }
 
@@ -82,6 +217,14 @@ enum QRESULT q_is_acceptable  (QCode *code, tagEntry *entry)
 		.engine = DSL_QUALIFIER,
 		.entry  = entry,
 	};
+
+	if (code->bc)
+	{
+		i = dsl_bytecode_qualify (code->bc, entry);
+		if (i != DSL_BYTECODE_FALLBACK)
+			return i? Q_ACCEPT: Q_REJECT;
+	}
+
 	es_autounref_pool_push ();
 	r = dsl_eval (code->dsl, &env);
 	if (es_object_equal (r, es_false))
@@ -100,9 +243,17 @@ enum QRESULT q_is_acceptable  (QCode *code, tagEntry *entry)
 	return i;
 }
 
+const char *q_name_range (QCode *code, int *full)
+{
+	*full = code->name_full;
+	return code->name_range;
+}
+
 void q_destroy (QCode *code)
 {
 	dsl_release (DSL_QUALIFIER, code->dsl);
+	dsl_bytecode_free (code->bc);
+	free (code->name_range);
 	free (code);
 }
 
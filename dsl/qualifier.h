@@ -25,6 +25,10 @@ enum QRESULT {
 QCode       *q_compile        (EsObject *exp);
 enum QRESULT q_is_acceptable  (QCode *code, tagEntry *entry);
 void         q_destroy        (QCode *code);
+
+/* Return a string that the name of every tag accepted by CODE starts
+ * with, or is equal to if *FULL is set. Return NULL if there is none. */
+const char  *q_name_range     (QCode *code, int *full);
 void         q_help           (FILE *fp);
 
 #endif
@@ -11,6 +11,7 @@
  */
 
 #include "sorter.h"
+#include "bytecode.h"
 #include "dsl.h"
 #include "es.h"
 
@@ -328,6 +329,7 @@ static int initialize (void)
 struct sSCode
 {
 	DSLCode *dsl;
+	DSLBytecode *bc;			/* NULL if exp is not compilable */
 };
 
 SCode *s_compile (EsObject *exp)
@@ -351,6 +353,7 @@ SCode *s_compile (EsObject *exp)
 		free (code);
 		return NULL;
 	}
+	code->bc = dsl_bytecode_compile_sorter (exp);
 	return code;
 }
 
@@ -365,6 +368,14 @@ int s_compare        (const tagEntry * a, const tagEntry * b, SCode *code)
 		.entry = a,
 		.alt_entry = b,
 	};
+
+	if (code->bc)
+	{
+		i = dsl_bytecode_compare (code->bc, a, b);
+		if (i != DSL_BYTECODE_FALLBACK)
+			return i;
+	}
+
 	es_autounref_pool_push ();
 	r = dsl_eval (code->dsl, &env);
 
@@ -408,9 +419,25 @@ int s_compare        (const tagEntry * a, const tagEntry * b, SCode *code)
 	return i;
 }
 
+unsigned int s_key_count      (SCode *code)
+{
+	return code->bc? dsl_bytecode_key_count (code->bc): 0;
+}
+
+void s_extract_keys   (SCode *code, const tagEntry *entry, DSLSortKey *keys)
+{
+	dsl_bytecode_extract_keys (code->bc, entry, keys);
+}
+
+int s_compare_keys   (SCode *code, const DSLSortKey *a, const DSLSortKey *b)
+{
+	return dsl_bytecode_compare_keys (code->bc, a, b);
+}
+
 void s_destroy        (SCode *code)
 {
 	dsl_release (DSL_SORTER, code->dsl);
+	dsl_bytecode_free (code->bc);
 	free (code);
 }
 
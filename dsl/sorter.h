@@ -15,6 +15,7 @@
 
 #include "es.h"
 #include "readtags.h"
+#include "bytecode.h"
 
 #include <stdio.h>
 
@@ -32,6 +33,13 @@ typedef struct sSCode SCode;
 
 SCode       *s_compile        (EsObject *exp);
 int          s_compare        (const tagEntry * a, const tagEntry * b, SCode *code);
+
+/* Sort keys extracted once per entry; see dsl_bytecode_key_count() and
+ * friends. s_key_count() returns 0 if the sorter cannot be run on keys. */
+unsigned int s_key_count      (SCode *code);
+void         s_extract_keys   (SCode *code, const tagEntry *entry, DSLSortKey *keys);
+int          s_compare_keys   (SCode *code, const DSLSortKey *a, const DSLSortKey *b);
+
 void         s_destroy        (SCode *code);
 void         s_help           (FILE *fp);
 
@@ -21,6 +21,12 @@
 #include <string.h>		/* strerror */
 #include <stdlib.h>		/* exit */
 #include <stdio.h>		/* stderr */
+#include <errno.h>
+#if defined (READTAGS_DSL) && defined (HAVE_FORK)
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
 
 typedef struct sReadOption {
 	int sortOverride;
@@ -29,6 +35,13 @@ typedef struct sReadOption {
 	int matchOpts;
 } readOptions;
 
+/* What findTag() looks up */
+typedef enum {
+	FIND_BY_NAME,
+	FIND_BY_FILE,				/* -f, the tags in an input file */
+	FIND_BY_SCOPE,				/* -m, the tags in a scope */
+} findKey;
+
 struct canonWorkArea {
 	struct canonFnameCacheTable *cacheTable;
 	int ptags;
@@ -38,6 +51,7 @@ struct canonWorkArea {
 static const char *TagFileName = "tags";
 static const char *ProgramName;
 static int debugMode;
+static unsigned long Limit;		/* 0 means no limit */
 #ifdef READTAGS_DSL
 #include "dsl/qualifier.h"
 static QCode *Qualifier;
@@ -45,7 +59,9 @@ static QCode *Qualifier;
 static SCode *Sorter;
 #include "dsl/formatter.h"
 static FCode *Formatter;
+static unsigned int Jobs = 1;
 #endif
+static int InWorker;
 
 static const char* tagsStrerror (int err)
 {
@@ -89,42 +105,101 @@ static void printPseudoTag (const tagEntry *entry, void *data)
 }
 
 #ifdef READTAGS_DSL
-static void freeCopiedTag (tagEntry *e)
+/*
+ * The tags to be sorted are copied into large chunks of memory instead
+ * of one allocation per string. All the chunks are freed at once after
+ * printing the sorted tags.
+ */
+#define TAG_CHUNK_SIZE (1024 * 1024)
+
+struct tagChunk {
+	struct tagChunk *next;
+	size_t size;
+	size_t used;
+	char data [];
+};
+
+struct tagEntryHolder {
+	tagEntry *e;
+	int order;					/* for making the sort stable */
+	const DSLSortKey *keys;		/* NULL if the sorter runs on the tags */
+};
+struct tagEntryArray {
+	int count;
+	int length;
+	struct tagEntryHolder *a;
+	int seen;					/* the number of tags offered to the heap */
+	int evicted;				/* the number of tags dropped from the heap */
+	struct tagChunk *chunks;	/* storage for the copied tags */
+	hashTable *files;			/* the input file names copied once */
+	DSLSortKey *keys;			/* the sort keys of all the tags */
+};
+
+static void *tagEntryArrayAlloc (struct tagEntryArray *a, size_t size, size_t align)
 {
-	free ((void *)e->name);
-	free ((void *)e->file);
-	if (e->address.pattern)
-		free ((void *)e->address.pattern);
-	if (e->kind)
-		free ((void *)e->kind);
-	for (unsigned short c = 0; c < e->fields.count; c++)
+	struct tagChunk *chunk = a->chunks;
+	size_t offset = 0;
+
+	if (chunk)
+		offset = (chunk->used + align - 1) & ~(align - 1);
+	if (chunk == NULL || chunk->size < offset || chunk->size - offset < size)
+	{
+		size_t chunkSize = size > TAG_CHUNK_SIZE? size: TAG_CHUNK_SIZE;
+
+		chunk = eMalloc (sizeof (struct tagChunk) + chunkSize);
+		chunk->next = a->chunks;
+		chunk->size = chunkSize;
+		a->chunks = chunk;
+		offset = 0;
+	}
+
+	chunk->used = offset + size;
+	return chunk->data + offset;
+}
+
+static const char *tagEntryArrayStrdup (struct tagEntryArray *a, const char *str)
+{
+	size_t size = strlen (str) + 1;
+	char *copy = tagEntryArrayAlloc (a, size, 1);
+
+	memcpy (copy, str, size);
+	return copy;
+}
+
+/* The tags of an input file share one copy of its name, so a sorter
+ * comparing $input and &input can tell the same file by pointer. */
+static const char *tagEntryArrayInternFile (struct tagEntryArray *a, const char *file)
+{
+	const char *copy = hashTableGetItem (a->files, file);
+
+	if (copy == NULL)
 	{
-		free ((void *)e->fields.list[c].key);
-		free ((void *)e->fields.list[c].value);
+		copy = tagEntryArrayStrdup (a, file);
+		hashTablePutItem (a->files, (void *)copy, (void *)copy);
 	}
-	if (e->fields.count)
-		free ((void *)e->fields.list);
-	free ((void *)e);
+	return copy;
 }
 
-static tagEntry *copyTag (tagEntry *o)
+static tagEntry *copyTag (struct tagEntryArray *a, tagEntry *o)
 {
+	const size_t align = sizeof (void *);
 	tagEntry *n;
 
-	n = eCalloc (1, sizeof  (*o));
+	n = tagEntryArrayAlloc (a, sizeof (*o), align);
+	memset (n, 0, sizeof (*n));
 
-	n->name = eStrdup (o->name);
+	n->name = tagEntryArrayStrdup (a, o->name);
 
 	if (o->file)
-		n->file = eStrdup (o->file);
+		n->file = tagEntryArrayInternFile (a, o->file);
 
 	if (o->address.pattern)
-		n->address.pattern = eStrdup (o->address.pattern);
+		n->address.pattern = tagEntryArrayStrdup (a, o->address.pattern);
 
 	n->address.lineNumber = o->address.lineNumber;
 
 	if (o->kind)
-		n->kind = eStrdup (o->kind);
+		n->kind = tagEntryArrayStrdup (a, o->kind);
 
 	n->fileScope = o->fileScope;
 	n->fields.count = o->fields.count;
@@ -132,26 +207,18 @@ static tagEntry *copyTag (tagEntry *o)
 	if (o->fields.count == 0)
 		return n;
 
-	n->fields.list = eMalloc (o->fields.count * sizeof (*o->fields.list));
+	n->fields.list = tagEntryArrayAlloc (a, o->fields.count * sizeof (*o->fields.list),
+										 align);
 
 	for (unsigned short c = 0; c < o->fields.count; c++)
 	{
-		n->fields.list[c].key = eStrdup (o->fields.list[c].key);
-		n->fields.list[c].value = eStrdup (o->fields.list[c].value);
+		n->fields.list[c].key = tagEntryArrayStrdup (a, o->fields.list[c].key);
+		n->fields.list[c].value = tagEntryArrayStrdup (a, o->fields.list[c].value);
 	}
 
 	return n;
 }
 
-struct tagEntryHolder {
-	tagEntry *e;
-};
-struct tagEntryArray {
-	int count;
-	int length;
-	struct tagEntryHolder *a;
-};
-
 static struct tagEntryArray *tagEntryArrayNew (void)
 {
 	struct tagEntryArray * a = eMalloc (sizeof (struct tagEntryArray));
@@ -159,6 +226,11 @@ static struct tagEntryArray *tagEntryArrayNew (void)
 	a->count = 0;
 	a->length = 1024;
 	a->a = eMalloc(a->length * sizeof (a->a[0]));
+	a->seen = 0;
+	a->evicted = 0;
+	a->chunks = NULL;
+	a->files = hashTableNew (127, hashCstrhash, hashCstreq, NULL, NULL);
+	a->keys = NULL;
 
 	return a;
 }
@@ -177,31 +249,173 @@ static void tagEntryArrayPush (struct tagEntryArray *a, tagEntry *e)
 		a->length *= 2;
 	}
 
-	a->a[a->count++].e = e;
+	a->a[a->count].e = e;
+	a->a[a->count].order = a->count;
+	a->a[a->count].keys = NULL;
+	a->count++;
 }
 
-static void tagEntryArrayFree (struct tagEntryArray *a, int freeTags)
+/* Extract the fields the sorter compares from all the tags at once, so
+ * sorting compares the keys instead of running the sorter for each pair
+ * of the tags. Nothing is extracted if the sorter is not a chain of
+ * comparisons of the same fields. */
+static void tagEntryArrayExtractKeys (struct tagEntryArray *a)
 {
-	if (freeTags)
+	const unsigned int n = s_key_count (Sorter);
+
+	if (n == 0 || a->count == 0)
+		return;
+
+	a->keys = eMalloc (sizeof (a->keys[0]) * n * a->count);
+	for (int i = 0; i < a->count; i++)
 	{
-		for (int i = 0; i < a->count; i++)
-			freeCopiedTag (a->a[i].e);
+		s_extract_keys (Sorter, a->a[i].e, a->keys + i * n);
+		a->a[i].keys = a->keys + i * n;
+	}
+}
+
+static void tagChunksFree (struct tagChunk *chunk)
+{
+	while (chunk)
+	{
+		struct tagChunk *next = chunk->next;
+		eFree (chunk);
+		chunk = next;
 	}
+}
+
+static void tagEntryArrayFree (struct tagEntryArray *a)
+{
+	tagChunksFree (a->chunks);
+	hashTableDelete (a->files);
+	if (a->keys)
+		eFree (a->keys);
 	free (a->a);
 	free (a);
 }
 
 static int compareTagEntry (const void *a, const void *b)
 {
-	return s_compare (((struct tagEntryHolder *)a)->e, ((struct tagEntryHolder *)b)->e, Sorter);
+	const struct tagEntryHolder *ha = a;
+	const struct tagEntryHolder *hb = b;
+	int r = ha->keys
+		? s_compare_keys (Sorter, ha->keys, hb->keys)
+		: DSL_BYTECODE_FALLBACK;
+
+	/* Run the sorter on the tags if a key is missing. */
+	if (r == DSL_BYTECODE_FALLBACK)
+		r = s_compare (ha->e, hb->e, Sorter);
+
+	/* Keep the order in the tag file for the tags the sorter cannot
+	 * tell apart, so the output doesn't depend on qsort or on the
+	 * number of jobs. */
+	if (r == 0)
+		r = (ha->order < hb->order)? -1: (ha->order > hb->order)? 1: 0;
+	return r;
+}
+
+/*
+ * With a limit, the array is a heap of the best LIMIT tags seen so far,
+ * with the worst of them at the top. A tag is copied only if it beats
+ * the top, so the tags of a large range are walked once and only the
+ * tags to print are kept.
+ */
+static void tagEntryHeapSwap (struct tagEntryArray *a, int i, int j)
+{
+	struct tagEntryHolder tmp = a->a[i];
+
+	a->a[i] = a->a[j];
+	a->a[j] = tmp;
+}
+
+static void tagEntryHeapDown (struct tagEntryArray *a, int i)
+{
+	while (1)
+	{
+		int worst = i;
+		const int l = 2 * i + 1;
+		const int r = l + 1;
+
+		if (l < a->count && compareTagEntry (a->a + l, a->a + worst) > 0)
+			worst = l;
+		if (r < a->count && compareTagEntry (a->a + r, a->a + worst) > 0)
+			worst = r;
+		if (worst == i)
+			break;
+		tagEntryHeapSwap (a, i, worst);
+		i = worst;
+	}
+}
+
+static void tagEntryHeapUp (struct tagEntryArray *a, int i)
+{
+	while (i > 0)
+	{
+		const int parent = (i - 1) / 2;
+
+		if (compareTagEntry (a->a + i, a->a + parent) <= 0)
+			break;
+		tagEntryHeapSwap (a, i, parent);
+		i = parent;
+	}
+}
+
+/* Copy the tags in the heap to new chunks, releasing the storage of
+ * the tags dropped from the heap. */
+static void tagEntryHeapCompact (struct tagEntryArray *a)
+{
+	struct tagChunk *chunks = a->chunks;
+	hashTable *files = a->files;
+
+	a->chunks = NULL;
+	a->files = hashTableNew (127, hashCstrhash, hashCstreq, NULL, NULL);
+	for (int i = 0; i < a->count; i++)
+		a->a[i].e = copyTag (a, a->a[i].e);
+	tagChunksFree (chunks);
+	hashTableDelete (files);
+	a->evicted = 0;
+}
+
+static void tagEntryHeapOffer (struct tagEntryArray *a, tagEntry *e,
+							   unsigned long limit)
+{
+	struct tagEntryHolder h = {
+		.e = e,
+		.order = a->seen++,
+		.keys = NULL,
+	};
+
+	if ((unsigned long) a->count < limit)
+	{
+		h.e = copyTag (a, e);
+		if (a->count == a->length)
+		{
+			a->length *= 2;
+			a->a = eRealloc (a->a, sizeof (a->a[0]) * a->length);
+		}
+		a->a[a->count] = h;
+		tagEntryHeapUp (a, a->count++);
+		return;
+	}
+
+	/* A tag tying with the top comes later in the tag file. */
+	if (compareTagEntry (&h, a->a) >= 0)
+		return;
+
+	h.e = copyTag (a, e);
+	a->a[0] = h;
+	tagEntryHeapDown (a, 0);
+	if (++a->evicted > a->count)
+		tagEntryHeapCompact (a);
 }
 
 static void walkTags (tagFile *const file, tagEntry *first_entry,
 					  tagResult (* nextfn) (tagFile *const, tagEntry *),
 					  void (* actionfn) (const tagEntry *, void *), void *data,
-					  struct canonWorkArea *canon)
+					  unsigned long limit, struct canonWorkArea *canon)
 {
 	struct tagEntryArray *a = NULL;
+	unsigned long count = 0;
 
 	if (Sorter)
 		a = tagEntryArrayNew ();
@@ -232,14 +446,20 @@ static void walkTags (tagFile *const file, tagEntry *first_entry,
 			}
 		}
 
-		if (a)
+		if (a && limit)
+			tagEntryHeapOffer (a, shadow, limit);
+		else if (a)
 		{
-			tagEntry *e = copyTag (shadow);
+			tagEntry *e = copyTag (a, shadow);
 			tagEntryArrayPush (a, e);
 		}
 		else
+		{
 			(* actionfn) (shadow, data);
-	} while ( (*nextfn) (file, first_entry) == TagSuccess);
+			count++;
+		}
+	} while ((a || limit == 0 || count < limit)
+			 && (*nextfn) (file, first_entry) == TagSuccess);
 
 	int err = tagsGetErrno (file);
 	if (err != 0)
@@ -252,18 +472,22 @@ static void walkTags (tagFile *const file, tagEntry *first_entry,
 
 	if (a)
 	{
+		if (! limit)
+			tagEntryArrayExtractKeys (a);
 		qsort (a->a, a->count, sizeof (a->a[0]), compareTagEntry);
 		for (int i = 0; i < a->count; i++)
 			(* actionfn) (a->a[i].e, data);
-		tagEntryArrayFree (a, 1);
+		tagEntryArrayFree (a);
 	}
 }
 #else
 static void walkTags (tagFile *const file, tagEntry *first_entry,
 					  tagResult (* nextfn) (tagFile *const, tagEntry *),
 					  void (* actionfn) (const tagEntry *, void *), void *data,
-					  struct canonWorkArea *canon)
+					  unsigned long limit, struct canonWorkArea *canon)
 {
+	unsigned long count = 0;
+
 	do
 	{
 		tagEntry *shadow = first_entry;
@@ -279,8 +503,10 @@ static void walkTags (tagFile *const file, tagEntry *first_entry,
 		}
 
 		(* actionfn) (shadow, data);
+		count++;
 	}
-	while ( (*nextfn) (file, first_entry) == TagSuccess);
+	while ((limit == 0 || count < limit)
+		   && (*nextfn) (file, first_entry) == TagSuccess);
 
 	int err = tagsGetErrno (file);
 	if (err != 0)
@@ -325,6 +551,8 @@ static int copyFile (FILE *in, FILE *out)
 
 static void removeTagFile (void)
 {
+	if (InWorker)
+		return;
 	remove (TagFileName);
 	eFree ((char *)TagFileName);
 }
@@ -395,10 +623,35 @@ static tagFile *openTags (const char *const filePath, tagFileInfo *const info)
 			exit (1);
 		}
 		fclose (tempFP);
-		return tagsOpen (tempName, info);
+		return tagsOpenMapped (tempName, info);
 	}
 
-	return tagsOpen (filePath, info);
+	return tagsOpenMapped (filePath, info);
+}
+
+/* Return true if no option after the one at `rest' in argv [i] reads the
+ * tag file. Option arguments look like names; they are taken as actions
+ * to be safe. */
+static int isLastAction (int argc, char **argv, int i, const char *rest)
+{
+	if (strpbrk (rest, "lDP"))
+		return 0;
+	for (i++; i < argc; i++)
+	{
+		const char *const arg = argv [i];
+		if (arg [0] != '-' || arg [1] == '\0')
+			return 0;
+		if (arg [1] == '-')
+		{
+			if (strcmp (arg, "--list") == 0
+				|| strcmp (arg, "--list-pseudo-tags") == 0
+				|| strcmp (arg, "--with-pseudo-tags") == 0)
+				return 0;
+		}
+		else if (strpbrk (arg + 1, "lDP"))
+			return 0;
+	}
+	return 1;
 }
 
 static int hasPsuedoTag (tagFile *const file,
@@ -411,7 +664,357 @@ static int hasPsuedoTag (tagFile *const file,
 			&& (strcmp(entry.file, exepectedValueAsInputField) == 0));
 }
 
-static void findTag (const char *const name, readOptions *readOpts,
+#if defined (READTAGS_DSL) && defined (HAVE_FORK)
+/*
+ * Listing tags in worker processes (--jobs)
+ *
+ * The tag file is divided into line-aligned parts with
+ * tagsFirstInPart(). Each worker process runs the filter and the sorter
+ * on one part, and writes the surviving tags as records into a
+ * temporary file. The parent process loads the records and prints them
+ * in the order of the parts, or, with a sorter, merges the sorted parts.
+ * As the sort is stable, the output is the same as listing the tags in
+ * one process.
+ *
+ * A worker writes its diagnostics, like the errors in evaluating the
+ * filter, into another temporary file. The parent process prints them
+ * in the order of the parts, up to the first part that failed, as a
+ * process listing the tags alone stops at the first error.
+ */
+struct tagRecordHeader {
+	unsigned long lineNumber;
+	unsigned short fieldCount;
+	short fileScope;
+	unsigned char hasFile, hasPattern, hasKind;
+};
+
+struct listJob {
+	pid_t pid;
+	FILE *fp;
+	char *name;
+	FILE *errfp;				/* stderr of the worker */
+	char *errName;
+
+	char *buffer;				/* records loaded from fp */
+	tagEntry *entries;
+	tagExtensionField *fields;
+	int count;
+	int next;					/* for merging */
+	int failed;
+};
+
+static void putRecordString (const char *str, FILE *fp)
+{
+	fputs (str, fp);
+	fputc ('\0', fp);
+}
+
+static void writeTagRecord (const tagEntry *e, void *data)
+{
+	FILE *fp = data;
+	struct tagRecordHeader h;
+
+	memset (&h, 0, sizeof (h));
+	h.lineNumber = e->address.lineNumber;
+	h.fieldCount = e->fields.count;
+	h.fileScope = e->fileScope;
+	h.hasFile = (e->file != NULL);
+	h.hasPattern = (e->address.pattern != NULL);
+	h.hasKind = (e->kind != NULL);
+	fwrite (&h, sizeof (h), 1, fp);
+
+	putRecordString (e->name, fp);
+	if (e->file)
+		putRecordString (e->file, fp);
+	if (e->address.pattern)
+		putRecordString (e->address.pattern, fp);
+	if (e->kind)
+		putRecordString (e->kind, fp);
+	for (unsigned short c = 0; c < e->fields.count; c++)
+	{
+		putRecordString (e->fields.list[c].key, fp);
+		putRecordString (e->fields.list[c].value, fp);
+	}
+}
+
+static const char *getRecordString (const char **p)
+{
+	const char *s = *p;
+	*p += strlen (s) + 1;
+	return s;
+}
+
+/* Read a record at *P into E if E is not NULL, and advance *P. */
+static unsigned short readTagRecord (const char **p, tagEntry *e,
+									 tagExtensionField *fields)
+{
+	struct tagRecordHeader h;
+	const char *name, *file = NULL, *pattern = NULL, *kind = NULL;
+
+	memcpy (&h, *p, sizeof (h));
+	*p += sizeof (h);
+
+	name = getRecordString (p);
+	if (h.hasFile)
+		file = getRecordString (p);
+	if (h.hasPattern)
+		pattern = getRecordString (p);
+	if (h.hasKind)
+		kind = getRecordString (p);
+	for (unsigned short c = 0; c < h.fieldCount; c++)
+	{
+		const char *key = getRecordString (p);
+		const char *value = getRecordString (p);
+		if (e)
+		{
+			fields[c].key = key;
+			fields[c].value = value;
+		}
+	}
+
+	if (e)
+	{
+		memset (e, 0, sizeof (*e));
+		e->name = name;
+		e->file = file;
+		e->address.pattern = pattern;
+		e->address.lineNumber = h.lineNumber;
+		e->kind = kind;
+		e->fileScope = h.fileScope;
+		e->fields.count = h.fieldCount;
+		e->fields.list = h.fieldCount? fields: NULL;
+	}
+	return h.fieldCount;
+}
+
+static void runListWorker (unsigned int part, unsigned int parts,
+						   FILE *fp, struct canonWorkArea *canon)
+{
+	tagFileInfo info;
+	tagEntry entry;
+	int err;
+	tagFile *const file = openTags (TagFileName, &info);
+
+	InWorker = 1;
+	if (file == NULL || !info.status.opened)
+	{
+		fprintf (stderr, "%s: cannot open tag file in worker %u: %s: %s\n",
+				 ProgramName, part,
+				 tagsStrerror (info.status.error_number),
+				 TagFileName);
+		exit (1);
+	}
+
+	if (tagsFirstInPart (file, &entry, part, parts) == TagSuccess)
+		walkTags (file, &entry, tagsNext, writeTagRecord, fp, Limit, canon);
+	else if ((err = tagsGetErrno (file)) != 0)
+	{
+		fprintf (stderr, "%s: error in tagsFirstInPart(): %s\n",
+				 ProgramName,
+				 tagsStrerror (err));
+		exit (1);
+	}
+	tagsClose (file);
+
+	if (fflush (fp) != 0 || ferror (fp))
+	{
+		fprintf (stderr, "%s: error in writing to the temporarily file in worker %u\n",
+				 ProgramName, part);
+		exit (1);
+	}
+	exit (0);
+}
+
+static void loadTagRecords (struct listJob *job)
+{
+	long size;
+	const char *p, *end;
+	size_t nfields = 0;
+
+	if (fseek (job->fp, 0, SEEK_END) != 0
+		|| (size = ftell (job->fp)) < 0
+		|| fseek (job->fp, 0, SEEK_SET) != 0)
+	{
+		fprintf (stderr, "%s: cannot rewind the temporarily file: %s\n",
+				 ProgramName, strerror (errno));
+		exit (1);
+	}
+
+	job->buffer = eMalloc (size + 1);
+	if (size > 0 && fread (job->buffer, 1, size, job->fp) != (size_t) size)
+	{
+		fprintf (stderr, "%s: error in reading the temporarily file\n",
+				 ProgramName);
+		exit (1);
+	}
+
+	end = job->buffer + size;
+	for (p = job->buffer; p < end; job->count++)
+		nfields += readTagRecord (&p, NULL, NULL);
+
+	job->entries = eMalloc ((job->count? job->count: 1) * sizeof (job->entries[0]));
+	job->fields = eMalloc ((nfields? nfields: 1) * sizeof (job->fields[0]));
+
+	nfields = 0;
+	p = job->buffer;
+	for (int i = 0; i < job->count; i++)
+		nfields += readTagRecord (&p, job->entries + i, job->fields + nfields);
+}
+
+static void copyWorkerDiagnostics (FILE *errfp)
+{
+	char buf[BUFSIZ];
+	size_t n;
+
+	rewind (errfp);
+	while ((n = fread (buf, 1, sizeof (buf), errfp)) > 0)
+		fwrite (buf, 1, n, stderr);
+}
+
+static void walkTagsInJobs (unsigned int jobs,
+							void (* actionfn) (const tagEntry *, void *), void *data,
+							struct canonWorkArea *canon)
+{
+	struct listJob *jobTable = eCalloc (jobs, sizeof (jobTable[0]));
+	int failed = 0;
+	unsigned long count = 0;
+
+	if (debugMode)
+		fprintf (stderr, "%s: listing tags in %u workers\n", ProgramName, jobs);
+
+	/* Nothing buffered in the parent process should be written twice
+	 * by the workers. */
+	fflush (stdout);
+	fflush (stderr);
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		struct listJob *job = jobTable + k;
+
+		job->fp = tempFileFP ("w+", &job->name);
+		job->errfp = tempFileFP ("w+", &job->errName);
+		if (job->fp == NULL || job->errfp == NULL)
+		{
+			fprintf (stderr, "%s: failed to make a temporarily file for worker %u\n",
+					 ProgramName, k);
+			exit (1);
+		}
+
+		job->pid = fork ();
+		if (job->pid < 0)
+		{
+			fprintf (stderr, "%s: cannot fork a worker: %s\n",
+					 ProgramName, strerror (errno));
+			exit (1);
+		}
+		else if (job->pid == 0)
+		{
+			if (dup2 (fileno (job->errfp), STDERR_FILENO) < 0)
+				exit (1);
+			runListWorker (k, jobs, job->fp, canon);
+		}
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		struct listJob *job = jobTable + k;
+		int status;
+
+		while (waitpid (job->pid, &status, 0) < 0)
+		{
+			if (errno != EINTR)
+			{
+				status = -1;
+				break;
+			}
+		}
+		if (status != 0)
+			job->failed = 1;
+		else
+			loadTagRecords (job);
+		fclose (job->fp);
+		remove (job->name);
+		eFree (job->name);
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		struct listJob *job = jobTable + k;
+
+		if (!failed)
+		{
+			copyWorkerDiagnostics (job->errfp);
+			failed = job->failed;
+		}
+		fclose (job->errfp);
+		remove (job->errName);
+		eFree (job->errName);
+	}
+	if (failed)
+		exit (1);
+
+	if (Sorter)
+	{
+		while (1)
+		{
+			struct listJob *best = NULL;
+
+			/* On a tie, the job reading the earlier part wins. */
+			for (unsigned int k = 0; k < jobs; k++)
+			{
+				struct listJob *job = jobTable + k;
+				if (job->next == job->count)
+					continue;
+				if (best == NULL
+					|| s_compare (best->entries + best->next,
+								  job->entries + job->next, Sorter) > 0)
+					best = job;
+			}
+			if (best == NULL)
+				break;
+			(* actionfn) (best->entries + best->next++, data);
+			if (++count == Limit)
+				break;
+		}
+	}
+	else
+	{
+		for (unsigned int k = 0; k < jobs; k++)
+			for (int i = 0; i < jobTable[k].count; i++)
+			{
+				if (count == Limit && Limit != 0)
+					break;
+				(* actionfn) (jobTable[k].entries + i, data);
+				count++;
+			}
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		eFree (jobTable[k].buffer);
+		eFree (jobTable[k].entries);
+		eFree (jobTable[k].fields);
+	}
+	eFree (jobTable);
+}
+#endif
+
+static tagResult findFirstTag (tagFile *const file, tagEntry *const entry,
+								const char *const name, findKey key,
+								const readOptions *const readOpts)
+{
+	switch (key)
+	{
+	case FIND_BY_FILE:
+		return tagsFindByFile (file, entry, name);
+	case FIND_BY_SCOPE:
+		return tagsFindByScope (file, entry, name);
+	default:
+		return tagsFind (file, entry, name, readOpts->matchOpts);
+	}
+}
+
+static void findTag (const char *const name, findKey key, readOptions *readOpts,
 					 tagPrintOptions *printOpts, struct canonWorkArea *canon)
 {
 	tagFileInfo info;
@@ -453,30 +1056,65 @@ static void findTag (const char *const name, readOptions *readOpts,
 	if (debugMode)
 		fprintf (stderr, "%s: searching for \"%s\" in \"%s\"\n",
 					 ProgramName, name, TagFileName);
-	if (tagsFind (file, &entry, name, readOpts->matchOpts) == TagSuccess)
+	if (findFirstTag (file, &entry, name, key, readOpts) == TagSuccess)
 		walkTags (file, &entry, tagsFindNext,
 #ifdef READTAGS_DSL
 				  Formatter? printTagWithFormatter:
 #endif
 				  printTag, printOpts,
-				  canon);
+				  Limit, canon);
 	else if ((err = tagsGetErrno (file)) != 0)
 	{
-		fprintf (stderr, "%s: error in tagsFind(): %s\n",
+		fprintf (stderr, "%s: error in %s(): %s\n",
 				 ProgramName,
+				 (key == FIND_BY_FILE)? "tagsFindByFile"
+				 : (key == FIND_BY_SCOPE)? "tagsFindByScope"
+				 : "tagsFind",
 				 tagsStrerror (err));
 		exit (1);
 	}
 	tagsClose (file);
 }
 
-static void listTags (int pseudoTags, tagPrintOptions *printOpts,
+/* Return true if the tags can be listed while reading the standard input
+ * without copying it to a temporarily file. The file is read only once
+ * from the start to the end, so the action must be the last one reading
+ * it and nothing may look up the tags by name or read the pseudo tags
+ * again. */
+static int canListStream (int pseudoTags, int lastAction,
+						  tagPrintOptions *printOpts, struct canonWorkArea *canon,
+						  const char *range)
+{
+	if (strcmp (TagFileName, "-") != 0 || pseudoTags || !lastAction)
+		return 0;
+	if (canon || printOpts->escaping)
+		return 0;
+#ifdef READTAGS_DSL
+	if (range && strncmp (range, "!_", 2) != 0)
+		return 0;
+	if (Jobs > 1 && (Qualifier || Sorter))
+		return 0;
+#else
+	(void) range;
+#endif
+	return 1;
+}
+
+static void listTags (int pseudoTags, int lastAction, tagPrintOptions *printOpts,
 					  struct canonWorkArea *canon)
 {
 	tagFileInfo info;
 	tagEntry entry;
 	int err = 0;
-	tagFile *const file = openTags (TagFileName, &info);
+	const char *range = NULL;
+#ifdef READTAGS_DSL
+	int full = 0;
+	if (!pseudoTags && Qualifier)
+		range = q_name_range (Qualifier, &full);
+#endif
+	tagFile *const file = canListStream (pseudoTags, lastAction, printOpts, canon, range)
+		? tagsOpenStream (stdin, &info)
+		: openTags (TagFileName, &info);
 	if (file == NULL || !info.status.opened)
 	{
 		fprintf (stderr, "%s: cannot open tag file: %s: %s\n",
@@ -503,7 +1141,7 @@ static void listTags (int pseudoTags, tagPrintOptions *printOpts,
 	{
 		if (tagsFirstPseudoTag (file, &entry) == TagSuccess)
 			walkTags (file, &entry, tagsNextPseudoTag, printPseudoTag, printOpts,
-					  canon);
+					  0, canon);
 		else if ((err = tagsGetErrno (file)) != 0)
 		{
 			fprintf (stderr, "%s: error in tagsFirstPseudoTag(): %s\n",
@@ -514,13 +1152,43 @@ static void listTags (int pseudoTags, tagPrintOptions *printOpts,
 	}
 	else
 	{
+#ifdef READTAGS_DSL
+		/* Only the tags in the range of the names satisfying the
+		 * qualifier are read. */
+		if (range && strncmp (range, "!_", 2) != 0)
+		{
+			if (debugMode)
+				fprintf (stderr, "%s: searching for names %s \"%s\" in \"%s\"\n",
+						 ProgramName, full? "equal to": "starting with", range,
+						 TagFileName);
+			if (tagsFind (file, &entry, range,
+						  full? TAG_FULLMATCH: TAG_PARTIALMATCH) == TagSuccess)
+				walkTags (file, &entry, tagsFindNext,
+						  Formatter? printTagWithFormatter: printTag, printOpts,
+						  Limit, canon);
+			else if ((err = tagsGetErrno (file)) != 0)
+			{
+				fprintf (stderr, "%s: error in tagsFind(): %s\n",
+						 ProgramName,
+						 tagsStrerror (err));
+				exit (1);
+			}
+		}
+		else
+#endif
+#if defined (READTAGS_DSL) && defined (HAVE_FORK)
+		if (Jobs > 1 && (Qualifier || Sorter))
+			walkTagsInJobs (Jobs, Formatter? printTagWithFormatter: printTag,
+							printOpts, canon);
+		else
+#endif
 		if (tagsFirst (file, &entry) == TagSuccess)
 			walkTags (file, &entry, tagsNext,
 #ifdef READTAGS_DSL
 					  Formatter? printTagWithFormatter:
 #endif
 					  printTag, printOpts,
-					  canon);
+					  Limit, canon);
 		else if ((err = tagsGetErrno (file)) != 0)
 		{
 			fprintf (stderr, "%s: error in tagsFirst(): %s\n",
@@ -554,6 +1222,10 @@ static const char *const Usage =
 	"        \"-\" indicates arguments after this as NAME(s) even if they start with -.\n"
 	"    -D | --list-pseudo-tags\n"
 	"        List pseudo tags.\n"
+	"    -f FILE | --in-file FILE\n"
+	"        List regular tags in the input file FILE.\n"
+	"    -m SCOPE | --in-scope SCOPE\n"
+	"        List regular tags in the scope SCOPE like class:Foo.\n"
 	"Options:\n"
 	"    -d | --debug\n"
 	"        Turn on debugging output.\n"
@@ -561,12 +1233,16 @@ static const char *const Usage =
 	"        Escape characters like tabs in output as described in tags(5).\n"
 	"    -e | --extension-fields\n"
 	"        Include extension fields in output.\n"
+	"    -k N | --limit N\n"
+	"        Print at most N tags for each ACTION; with -S, the first N of the sorted tags.\n"
 	"    -i | --icase-match\n"
 	"        Perform case-insensitive matching in the NAME action.\n"
 	"    -n | --line-number\n"
 	"        Also include the line number field when -e option is given.\n"
 	"    -p | --prefix-match\n"
 	"        Perform prefix matching in the NAME action.\n"
+	"    -c | --substring-match\n"
+	"        Perform substring matching in the NAME action.\n"
 	"    -P | --with-pseudo-tags\n"
 	"        List pseudo tags as if -D option is specified but continues processing without exiting.\n"
 	"    -t TAGFILE | --tag-file TAGFILE\n"
@@ -586,6 +1262,8 @@ static const char *const Usage =
 	"        Filter the tags listed by ACTION with EXP before printing.\n"
 	"    -S EXP | --sorter EXP\n"
 	"        Sort the tags listed by ACTION with EXP before printing.\n"
+	"    -j N | --jobs N\n"
+	"        Run EXP of -Q and -S for -l in N worker processes.\n"
 #endif
 	;
 
@@ -649,6 +1327,40 @@ static void *compileExpression(const char* exp, void * (*compiler) (EsObject *),
 }
 #endif
 
+#ifdef READTAGS_DSL
+static unsigned int parseJobs (const char *const str, const char *const optname)
+{
+	char *end;
+	unsigned long n;
+
+	errno = 0;
+	n = strtoul (str, &end, 10);
+	if (*str == '\0' || *end != '\0' || errno != 0 || n == 0 || n > 1024)
+	{
+		fprintf (stderr, "%s: invalid number of jobs for %s option: %s\n",
+				 ProgramName, optname, str);
+		exit (1);
+	}
+	return (unsigned int) n;
+}
+#endif
+
+static unsigned long parseLimit (const char *const str, const char *const optname)
+{
+	char *end;
+	unsigned long n;
+
+	errno = 0;
+	n = strtoul (str, &end, 10);
+	if (*str == '\0' || *end != '\0' || errno != 0 || n == 0 || str[0] == '-')
+	{
+		fprintf (stderr, "%s: invalid number of tags for %s option: %s\n",
+				 ProgramName, optname, str);
+		exit (1);
+	}
+	return n;
+}
+
 static void printVersion(void)
 {
 	/* readtags uses code of ctags via libutil.
@@ -693,7 +1405,7 @@ extern int main (int argc, char **argv)
 		{
 			if (canon)
 				canon->ptags = 0;
-			findTag (arg, &readOpts, &printOpts, canon);
+			findTag (arg, FIND_BY_NAME, &readOpts, &printOpts, canon);
 			actionSupplied = 1;
 		}
 		else if (arg [0] == '-' && arg [1] == '\0')
@@ -708,7 +1420,7 @@ extern int main (int argc, char **argv)
 			{
 				if (canon)
 					canon->ptags = 1;
-				listTags (1, &printOpts, NULL);
+				listTags (1, 0, &printOpts, NULL);
 				if (optname[0] == 'l')
 					actionSupplied = 1;
 			}
@@ -752,13 +1464,46 @@ extern int main (int argc, char **argv)
 				readOpts.matchOpts |= TAG_IGNORECASE;
 			else if (strcmp (optname, "prefix-match") == 0)
 				readOpts.matchOpts |= TAG_PARTIALMATCH;
+			else if (strcmp (optname, "substring-match") == 0)
+				readOpts.matchOpts |= TAG_SUBSTRINGMATCH;
 			else if (strcmp (optname, "list") == 0)
 			{
 				if (canon)
 					canon->ptags = 0;
-				listTags (0, &printOpts, canon);
+				listTags (0, isLastAction (argc, argv, i, ""), &printOpts, canon);
 				actionSupplied = 1;
 			}
+			else if (strcmp (optname, "in-file") == 0
+					 || strcmp (optname, "in-scope") == 0)
+			{
+				if (i + 1 < argc)
+				{
+					if (canon)
+						canon->ptags = 0;
+					findTag (argv[++i],
+							 (optname[3] == 'f')? FIND_BY_FILE: FIND_BY_SCOPE,
+							 &readOpts, &printOpts, canon);
+					actionSupplied = 1;
+				}
+				else
+				{
+					fprintf (stderr, "%s: missing %s for --%s option\n",
+							 ProgramName,
+							 (optname[3] == 'f')? "input file": "scope", optname);
+					exit (1);
+				}
+			}
+			else if (strcmp (optname, "limit") == 0)
+			{
+				if (i + 1 < argc)
+					Limit = parseLimit (argv[++i], "--limit");
+				else
+				{
+					fprintf (stderr, "%s: missing number of tags for --%s option\n",
+							 ProgramName, optname);
+					exit (1);
+				}
+			}
 			else if (strcmp (optname, "line-number") == 0)
 				printOpts.lineNumber = 1;
 			else if (strcmp (optname, "tag-file") == 0)
@@ -827,6 +1572,17 @@ extern int main (int argc, char **argv)
 					exit (1);
 				}
 			}
+			else if (strcmp (optname, "jobs") == 0)
+			{
+				if (i + 1 < argc)
+					Jobs = parseJobs (argv[++i], "--jobs");
+				else
+				{
+					fprintf (stderr, "%s: missing number of jobs for --%s option\n",
+							 ProgramName, optname);
+					exit (1);
+				}
+			}
 			else if (strcmp (optname, "formatter") == 0)
 			{
 				if (i + 1 < argc)
@@ -861,7 +1617,7 @@ extern int main (int argc, char **argv)
 					case 'P':
 						if (canon)
 							canon->ptags = 1;
-						listTags (1, &printOpts, canon);
+						listTags (1, 0, &printOpts, canon);
 						if (arg  [j] == 'D')
 							actionSupplied = 1;
 						break;
@@ -888,12 +1644,36 @@ extern int main (int argc, char **argv)
 					case 'e': printOpts.extensionFields = 1; break;
 					case 'i': readOpts.matchOpts |= TAG_IGNORECASE;   break;
 					case 'p': readOpts.matchOpts |= TAG_PARTIALMATCH; break;
+					case 'c': readOpts.matchOpts |= TAG_SUBSTRINGMATCH; break;
 					case 'l':
 						if (canon)
 							canon->ptags = 0;
-						listTags (0, &printOpts, canon);
+						listTags (0, isLastAction (argc, argv, i, arg + j + 1),
+								  &printOpts, canon);
 						actionSupplied = 1;
 						break;
+					case 'f':
+					case 'm':
+						if (i + 1 == argc)
+							printUsage(stderr, 1);
+						if (canon)
+							canon->ptags = 0;
+						findTag (argv[++i],
+								 (arg[j] == 'f')? FIND_BY_FILE: FIND_BY_SCOPE,
+								 &readOpts, &printOpts, canon);
+						actionSupplied = 1;
+						break;
+					case 'k':
+						if (arg [j+1] != '\0')
+						{
+							Limit = parseLimit (arg + j + 1, "-k");
+							j += strlen (arg + j + 1);
+						}
+						else if (i + 1 < argc)
+							Limit = parseLimit (argv[++i], "-k");
+						else
+							printUsage(stderr, 1);
+						break;
 					case 'n': printOpts.lineNumber = 1; break;
 					case 't':
 						if (arg [j+1] != '\0')
@@ -937,6 +1717,17 @@ extern int main (int argc, char **argv)
 													   (void * (*)(EsObject *))s_compile,
 													   "sorter");
 						break;
+					case 'j':
+						if (arg [j+1] != '\0')
+						{
+							Jobs = parseJobs (arg + j + 1, "-j");
+							j += strlen (arg + j + 1);
+						}
+						else if (i + 1 < argc)
+							Jobs = parseJobs (argv[++i], "-j");
+						else
+							printUsage(stderr, 1);
+						break;
 					case 'F':
 						if (i + 1 == argc)
 							printUsage(stderr, 1);
@@ -957,7 +1748,7 @@ extern int main (int argc, char **argv)
 	if (! actionSupplied)
 	{
 		fprintf (stderr,
-			"%s: no action specified: specify one of NAME, -l or -D\n",
+			"%s: no action specified: specify one of NAME, -l, -D, -f or -m\n",
 			ProgramName);
 		exit (1);
 	}
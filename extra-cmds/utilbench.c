@@ -0,0 +1,438 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Microbenchmarks for the data structures used in ctags.
+*
+*   Usage: utilbench [-s <scale>] [<benchmark>...]
+*
+*   Each benchmark repeats an operation many times, and the time per
+*   operation is printed. <scale> multiplies the number of operations.
+*   Without <benchmark>, all the benchmarks are run.
+*/
+
+#include "general.h"
+
+#include "htable.h"
+#include "interval_tree_generic.h"
+#include "keyword.h"
+#include "mio.h"
+#include "objpool.h"
+#include "ptrarray.h"
+#include "rbtree.h"
+#include "routines.h"
+#include "vstring.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sBenchmark {
+	const char *name;
+	unsigned long count;		/* operations in one run at scale 1 */
+	void (* run) (unsigned long count);
+} benchmark;
+
+struct intervalNode {
+	struct rb_node rb;
+	unsigned long start, last;
+	unsigned long subtreeLast;
+};
+
+/*
+*   DATA DEFINITIONS
+*/
+
+/* Results are accumulated here so that the compiler doesn't optimize
+ * the operations out. */
+static volatile unsigned long Sink;
+
+static char **Words;
+static unsigned long WordCount;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+/* readtags-stub.c provides the other functions needed outside of the
+ * utilities. keyword.c uses this only for dumping keywords. */
+extern const char *getLanguageName (const langType language CTAGS_ATTR_UNUSED)
+{
+	return "Bench";
+}
+
+#define INTERVAL_START(node) ((node)->start)
+#define INTERVAL_LAST(node) ((node)->last)
+INTERVAL_TREE_DEFINE(struct intervalNode, rb,
+					 unsigned long, subtreeLast,
+					 INTERVAL_START, INTERVAL_LAST, static, intervalBench)
+
+static double now (void)
+{
+#if defined (HAVE_CLOCK_GETTIME) && defined (CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+#else
+	return (double) clock () / CLOCKS_PER_SEC;
+#endif
+}
+
+/* Make COUNT identifier-like words; about one in eight is a duplicate. */
+static void prepareWords (unsigned long count)
+{
+	unsigned long seed = 1;
+
+	Words = xMalloc (count, char *);
+	WordCount = count;
+	for (unsigned long i = 0; i < count; i++)
+	{
+		char buf [32];
+		unsigned long n = (i % 8 == 7)? i / 2: i;
+		int length;
+
+		seed = seed * 1103515245 + 12345;
+		length = snprintf (buf, sizeof (buf), "w%c%lx_%lu",
+						   'a' + (int) ((seed >> 16) % 26), n * 2654435761UL, n % 97);
+		Words [i] = eStrndup (buf, length);
+	}
+}
+
+static void releaseWords (void)
+{
+	for (unsigned long i = 0; i < WordCount; i++)
+		eFree (Words [i]);
+	eFree (Words);
+	Words = NULL;
+	WordCount = 0;
+}
+
+static void benchHashTableString0 (hashTable *table, unsigned long count)
+{
+	unsigned long found = 0;
+
+	for (unsigned long i = 0; i < count; i++)
+		hashTableUpdateOrPutItem (table, Words [i % WordCount], Words [i % WordCount]);
+	for (unsigned long i = 0; i < count; i++)
+		found += (hashTableGetItem (table, Words [(i * 7) % WordCount]) != NULL);
+	Sink += found + hashTableCountItem (table);
+	hashTableDelete (table);
+}
+
+static void benchHashTableInt0 (hashTable *table, unsigned long count)
+{
+	unsigned long found = 0;
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		int *key = xMalloc (1, int);
+		*key = (int) i;
+		hashTablePutItem (table, key, key);
+	}
+	for (unsigned long i = 0; i < count; i++)
+	{
+		int key = (int) ((i * 7) % count);
+		found += (hashTableGetItem (table, &key) != NULL);
+	}
+	Sink += found;
+	hashTableDelete (table);
+}
+
+static void benchHashTableString (unsigned long count)
+{
+	benchHashTableString0 (hashTableNew (1024, hashCstrhash, hashCstreq, NULL, NULL),
+						   count);
+}
+
+static void benchHashTableStringFlat (unsigned long count)
+{
+	benchHashTableString0 (hashTableNewFlat (1024, hashCstrhash, hashCstreq, NULL, NULL),
+						   count);
+}
+
+static void benchHashTableInt (unsigned long count)
+{
+	benchHashTableInt0 (hashTableNew (1024, hashInthash, hashInteq, eFree, NULL),
+						count);
+}
+
+static void benchHashTableIntFlat (unsigned long count)
+{
+	benchHashTableInt0 (hashTableNewFlat (1024, hashInthash, hashInteq, eFree, NULL),
+						count);
+}
+
+static void benchPtrArrayAdd (unsigned long count)
+{
+	ptrArray *array = ptrArrayNew (NULL);
+	unsigned long sum = 0;
+
+	for (unsigned long i = 0; i < count; i++)
+		ptrArrayAdd (array, Words [i % WordCount]);
+	for (unsigned int i = 0; i < ptrArrayCount (array); i++)
+		sum += ((const char *) ptrArrayItem (array, i))[1];
+	while (ptrArrayCount (array) > 0)
+		ptrArrayRemoveLast (array);
+	Sink += sum;
+	ptrArrayDelete (array);
+}
+
+static int compareWords (const void *a, const void *b)
+{
+	return strcmp (a, b);
+}
+
+static void benchPtrArraySort (unsigned long count)
+{
+	ptrArray *array = ptrArrayNew (NULL);
+
+	for (unsigned long i = 0; i < count; i++)
+		ptrArrayAdd (array, Words [i % WordCount]);
+	ptrArraySort (array, compareWords);
+	Sink += ((const char *) ptrArrayItem (array, 0))[1];
+	ptrArrayDelete (array);
+}
+
+static void benchVStringPut (unsigned long count)
+{
+	vString *vstr = vStringNew ();
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		if (i % 64 == 0)
+			vStringClear (vstr);
+		vStringPut (vstr, 'a' + (int) (i % 26));
+	}
+	Sink += vStringLength (vstr);
+	vStringDelete (vstr);
+}
+
+static void benchVStringCat (unsigned long count)
+{
+	vString *vstr = vStringNew ();
+	unsigned long length = 0;
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		vStringCopyS (vstr, Words [i % WordCount]);
+		vStringCatS (vstr, "::");
+		vStringCatS (vstr, Words [(i + 1) % WordCount]);
+		length += vStringLength (vstr);
+	}
+	Sink += length;
+	vStringDelete (vstr);
+}
+
+static void *newBenchString (void *createArg CTAGS_ATTR_UNUSED)
+{
+	return vStringNew ();
+}
+
+static void clearBenchString (void *data)
+{
+	vStringClear ((vString *) data);
+}
+
+static void benchObjPool (unsigned long count)
+{
+	objPool *pool = objPoolNew (16, newBenchString,
+								(objPoolDeleteFunc) vStringDelete,
+								clearBenchString, NULL);
+	vString *held [8];
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		unsigned int n = (unsigned int) (i % 8);
+
+		held [n] = objPoolGet (pool);
+		vStringPut (held [n], 'x');
+		if (n == 7)
+		{
+			for (unsigned int j = 0; j < 8; j++)
+				objPoolPut (pool, held [j]);
+		}
+	}
+	for (unsigned int j = 0; j < count % 8; j++)
+		objPoolPut (pool, held [j]);
+	objPoolDelete (pool);
+}
+
+static void benchIntervalTree (unsigned long count)
+{
+	struct intervalNode *nodes = xMalloc (count, struct intervalNode);
+	struct rb_root root = RB_ROOT;
+	unsigned long found = 0;
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		/* Nested and sibling scopes like those in a source file. */
+		nodes [i].start = i * 4;
+		nodes [i].last = i * 4 + 2 + (i % 16) * 8;
+		intervalBench_insert (nodes + i, &root);
+	}
+	for (unsigned long i = 0; i < count; i++)
+	{
+		unsigned long line = ((i * 7) % count) * 4 + 1;
+		struct intervalNode *n;
+
+		for (n = intervalBench_iter_first (&root, line, line); n;
+			 n = intervalBench_iter_next (n, line, line))
+			found++;
+	}
+	for (unsigned long i = 0; i < count; i++)
+		intervalBench_remove (nodes + i, &root);
+	Sink += found;
+	eFree (nodes);
+}
+
+static void benchKeyword (unsigned long count)
+{
+	static langType language;
+	unsigned long found = 0;
+
+	/* A new language for each run as keywords cannot be removed. */
+	language++;
+	for (unsigned long i = 0; i < 256 && i < WordCount; i++)
+		addKeyword (Words [i], language, (int) i + 1);
+	for (unsigned long i = 0; i < count; i++)
+		found += (lookupKeyword (Words [(i * 7) % WordCount], language) > 0);
+	Sink += found;
+}
+
+static void benchMIOMemory (unsigned long count)
+{
+	MIO *mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+	char line [64];
+	unsigned long lines = 0;
+	int c;
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		mio_puts (mio, Words [i % WordCount]);
+		mio_putc (mio, '\n');
+	}
+	mio_rewind (mio);
+	while ((c = mio_getc (mio)) != EOF)
+		lines += (c == '\n');
+	mio_rewind (mio);
+	while (mio_gets (mio, line, sizeof (line)))
+		lines++;
+	Sink += lines;
+	mio_unref (mio);
+}
+
+static void benchMIOFile (unsigned long count)
+{
+	FILE *fp = tmpfile ();
+	MIO *mio;
+	unsigned long lines = 0;
+	int c;
+
+	if (fp == NULL)
+	{
+		perror ("tmpfile");
+		exit (1);
+	}
+	mio = mio_new_fp (fp, fclose);
+	for (unsigned long i = 0; i < count; i++)
+	{
+		mio_puts (mio, Words [i % WordCount]);
+		mio_putc (mio, '\n');
+	}
+	mio_flush (mio);
+	mio_rewind (mio);
+	while ((c = mio_getc (mio)) != EOF)
+		lines += (c == '\n');
+	Sink += lines;
+	mio_unref (mio);
+}
+
+static const benchmark Benchmarks [] = {
+	{ "htable-string",  1000000, benchHashTableString },
+	{ "htable-int",     1000000, benchHashTableInt },
+	{ "htable-string-flat", 1000000, benchHashTableStringFlat },
+	{ "htable-int-flat", 1000000, benchHashTableIntFlat },
+	{ "ptrarray-add",   4000000, benchPtrArrayAdd },
+	{ "ptrarray-sort",   500000, benchPtrArraySort },
+	{ "vstring-put",   20000000, benchVStringPut },
+	{ "vstring-cat",    2000000, benchVStringCat },
+	{ "objpool",        8000000, benchObjPool },
+	{ "interval-tree",   500000, benchIntervalTree },
+	{ "keyword",        4000000, benchKeyword },
+	{ "mio-memory",     2000000, benchMIOMemory },
+	{ "mio-file",       2000000, benchMIOFile },
+};
+
+static void runBenchmark (const benchmark *b, unsigned long scale)
+{
+	unsigned long count = b->count * scale;
+	double start, elapsed;
+
+	/* Warm up the caches and the allocator. */
+	b->run (count / 16 + 1);
+
+	start = now ();
+	b->run (count);
+	elapsed = now () - start;
+
+	printf ("%-16s %12lu %10.3f %10.2f\n",
+			b->name, count, elapsed, elapsed * 1e9 / count);
+	fflush (stdout);
+}
+
+int main (int argc, char **argv)
+{
+	unsigned long scale = 1;
+	int i = 1;
+
+	if (i + 1 < argc && strcmp (argv [i], "-s") == 0)
+	{
+		scale = strtoul (argv [i + 1], NULL, 0);
+		if (scale == 0)
+		{
+			fprintf (stderr, "utilbench: wrong scale: %s\n", argv [i + 1]);
+			return 1;
+		}
+		i += 2;
+	}
+
+	for (int j = i; j < argc; j++)
+	{
+		size_t k;
+
+		for (k = 0; k < ARRAY_SIZE (Benchmarks); k++)
+			if (strcmp (argv [j], Benchmarks [k].name) == 0)
+				break;
+		if (k == ARRAY_SIZE (Benchmarks))
+		{
+			fprintf (stderr, "utilbench: unknown benchmark: %s\n", argv [j]);
+			fprintf (stderr, "benchmarks:");
+			for (k = 0; k < ARRAY_SIZE (Benchmarks); k++)
+				fprintf (stderr, " %s", Benchmarks [k].name);
+			fputc ('\n', stderr);
+			return 1;
+		}
+	}
+
+	prepareWords (65536);
+	printf ("%-16s %12s %10s %10s\n", "benchmark", "operations", "time(s)", "ns/op");
+	for (size_t k = 0; k < ARRAY_SIZE (Benchmarks); k++)
+	{
+		bool selected = (i == argc);
+
+		for (int j = i; j < argc && !selected; j++)
+			selected = (strcmp (argv [j], Benchmarks [k].name) == 0);
+		if (selected)
+			runBenchmark (Benchmarks + k, scale);
+	}
+	releaseWords ();
+
+	return 0;
+}
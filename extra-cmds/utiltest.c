@@ -8,6 +8,7 @@
 #include "general.h"
 
 #include "acutest.h"
+#include "bytescan.h"
 #include "fname.h"
 #include "htable.h"
 #include "numarray.h"
@@ -15,6 +16,177 @@
 #include "vstring.h"
 #include <string.h>
 
+static void test_bytescan_set(void)
+{
+	/* Longer than a vector so both the vector loop and the tail run. */
+	const unsigned char buf[] = "abcdefghijklmnopqrstuvwxyz0123456789/xyz";
+	const unsigned char *end = buf + sizeof(buf) - 1;
+	const unsigned char set[] = { '$', '/', '9', '\\' };
+	unsigned int i;
+
+	TEST_CHECK(findByteInSet (buf, end, set, 4) == buf + 35);
+	TEST_CHECK(findByteInSet (buf, end, set, 2) == buf + 36);
+	TEST_CHECK(findByteInSet (buf, end, set, 1) == end);
+	TEST_CHECK(findByteInSet (buf, end, set, 0) == end);
+	TEST_CHECK(findByteInSet (buf + 37, end, set, 4) == end);
+	TEST_CHECK(findByteInSet (end, end, set, 4) == end);
+
+	/* Each of the first 35 bytes appears first at its own position. */
+	for (i = 0; i < 35; i++)
+		TEST_CHECK(findByteInSet (buf, end, buf + i, 3) == buf + i);
+}
+
+static void test_bytescan_control(void)
+{
+	unsigned char buf[40];
+	unsigned int i;
+
+	memset (buf, 'a', sizeof(buf));
+	TEST_CHECK(findControlOrByte (buf, buf + sizeof(buf), '\\') == buf + sizeof(buf));
+
+	for (i = 0; i < sizeof(buf); i++)
+	{
+		buf[i] = '\t';
+		TEST_CHECK(findControlOrByte (buf, buf + sizeof(buf), '\\') == buf + i);
+		buf[i] = 0x7F;
+		TEST_CHECK(findControlOrByte (buf, buf + sizeof(buf), '\\') == buf + i);
+		buf[i] = '\\';
+		TEST_CHECK(findControlOrByte (buf, buf + sizeof(buf), '\\') == buf + i);
+		buf[i] = 0x80;
+		TEST_CHECK(findControlOrByte (buf, buf + sizeof(buf), '\\') == buf + sizeof(buf));
+		buf[i] = 0x20;
+		TEST_CHECK(findControlOrByte (buf, buf + sizeof(buf), '\\') == buf + sizeof(buf));
+		buf[i] = 'a';
+	}
+}
+
+/* The vector loops for AVX2 run on 64 bytes or more. Start the long
+ * runs at unaligned offsets so that both the loops and the heads and
+ * the tails around them run. */
+#define BYTESCAN_LONG_RUN 200
+static const unsigned int bytescanStarts[] = { 0, 1, 7, 31, 33 };
+
+static void test_bytescan_byte3(void)
+{
+	unsigned char buf[BYTESCAN_LONG_RUN];
+	const unsigned char *end = buf + sizeof(buf);
+	const unsigned char cs[] = { '\n', '\\', '"' };
+	unsigned int k, i, c;
+
+	memset (buf, 'a', sizeof(buf));
+	for (k = 0; k < ARRAY_SIZE(bytescanStarts); k++)
+	{
+		const unsigned char *s = buf + bytescanStarts[k];
+
+		TEST_CHECK(findByte3 (s, end, '\n', '\\', '"') == end);
+		for (i = bytescanStarts[k]; i < sizeof(buf); i++)
+			for (c = 0; c < ARRAY_SIZE(cs); c++)
+			{
+				buf[i] = cs[c];
+				TEST_CHECK(findByte3 (s, end, '\n', '\\', '"') == buf + i);
+				/* A byte after END is not found. */
+				TEST_CHECK(findByte3 (s, buf + i, '\n', '\\', '"') == buf + i);
+				buf[i] = 'a';
+			}
+	}
+}
+
+static void test_bytescan_set_long(void)
+{
+	unsigned char buf[BYTESCAN_LONG_RUN];
+	const unsigned char *end = buf + sizeof(buf);
+	const unsigned char set[] = { '$', '/', '9', '\\' };
+	unsigned int k, i;
+
+	memset (buf, 'a', sizeof(buf));
+	for (k = 0; k < ARRAY_SIZE(bytescanStarts); k++)
+	{
+		const unsigned char *s = buf + bytescanStarts[k];
+
+		TEST_CHECK(findByteInSet (s, end, set, 4) == end);
+		for (i = bytescanStarts[k]; i < sizeof(buf); i++)
+		{
+			buf[i] = set[i % 4];
+			TEST_CHECK(findByteInSet (s, end, set, 4) == buf + i);
+			buf[i] = 'a';
+		}
+	}
+}
+
+static void test_bytescan_control_long(void)
+{
+	unsigned char buf[BYTESCAN_LONG_RUN];
+	const unsigned char *end = buf + sizeof(buf);
+	unsigned int k, i;
+
+	memset (buf, 'a', sizeof(buf));
+	for (k = 0; k < ARRAY_SIZE(bytescanStarts); k++)
+	{
+		const unsigned char *s = buf + bytescanStarts[k];
+
+		for (i = bytescanStarts[k]; i < sizeof(buf); i++)
+		{
+			buf[i] = '\0';
+			TEST_CHECK(findControlOrByte (s, end, '\\') == buf + i);
+			buf[i] = 0x7F;
+			TEST_CHECK(findControlOrByte (s, end, '\\') == buf + i);
+			buf[i] = '\\';
+			TEST_CHECK(findControlOrByte (s, end, '\\') == buf + i);
+			buf[i] = 0xFF;
+			TEST_CHECK(findControlOrByte (s, end, '\\') == end);
+			buf[i] = 'a';
+		}
+	}
+}
+
+static void test_bytescan_count(void)
+{
+	unsigned char buf[BYTESCAN_LONG_RUN];
+	unsigned int k, i, n;
+
+	for (i = 0; i < sizeof(buf); i++)
+		buf[i] = (i % 3 == 0 || i % 7 == 0)? '\n': 'a';
+
+	for (k = 0; k < ARRAY_SIZE(bytescanStarts); k++)
+	{
+		const unsigned char *s = buf + bytescanStarts[k];
+
+		/* Count the bytes in [S, S + I) for every length. */
+		n = 0;
+		for (i = 0; s + i <= buf + sizeof(buf); i++)
+		{
+			TEST_CHECK(countByte (s, s + i, '\n') == n);
+			if (s + i < buf + sizeof(buf) && s[i] == '\n')
+				n++;
+		}
+		TEST_CHECK(countByte (s, buf + sizeof(buf), 'b') == 0);
+	}
+}
+
+static void test_bytescan_nonascii(void)
+{
+	unsigned char buf[BYTESCAN_LONG_RUN];
+	const unsigned char *end = buf + sizeof(buf);
+	unsigned int k, i;
+
+	memset (buf, 0x7F, sizeof(buf));
+	for (k = 0; k < ARRAY_SIZE(bytescanStarts); k++)
+	{
+		const unsigned char *s = buf + bytescanStarts[k];
+
+		TEST_CHECK(findNonAscii (s, end) == end);
+		for (i = bytescanStarts[k]; i < sizeof(buf); i++)
+		{
+			buf[i] = 0x80;
+			TEST_CHECK(findNonAscii (s, end) == buf + i);
+			buf[i] = 0xFF;
+			TEST_CHECK(findNonAscii (s, end) == buf + i);
+			TEST_CHECK(findNonAscii (s, buf + i) == buf + i);
+			buf[i] = 0x7F;
+		}
+	}
+}
+
 static void test_fname_absolute(void)
 {
 	char *str;
@@ -126,6 +298,23 @@ static void test_fname_absolute_with_cache(void)
 #undef T
 }
 
+static void test_fname_interned(void)
+{
+	struct canonFnameCacheTable *ct = canonFnameCacheTableNew ("/abc", false);
+	const char *a, *b;
+
+	a = canonicalizeFileName (ct, "input");
+	b = canonicalizeFileName (ct, "./input");
+	TEST_CHECK(a == b);
+	b = canonicalizeFileName (ct, "../abc/input");
+	TEST_CHECK(a == b);
+	b = canonicalizeFileName (ct, "input2");
+	TEST_CHECK(a != b && strcmp (b, "input2") == 0);
+	b = canonicalizeFileName (ct, "./input");
+	TEST_CHECK(a == b);
+	canonFnameCacheTableDelete (ct);
+}
+
 static void test_fname_relative(void)
 {
 	struct canonFnameCacheTable *ct;
@@ -235,6 +424,108 @@ static void test_htable_grow(void)
 	hashTableDelete(htable);
 }
 
+static void test_htable_flat_update(void)
+{
+	hashTable *htable = hashTableNewFlat (3, hashCstrhash, hashCstreq,
+										  eFree, NULL);
+	TEST_CHECK(htable != NULL);
+
+	hashTablePutItem (htable, strdup("a"), "A");
+	TEST_CHECK (hashTableUpdateItem (htable,  "a", "B") == true);
+	TEST_CHECK (hashTableUpdateItem (htable,  "b", "B") == false);
+	TEST_CHECK (strcmp (hashTableGetItem (htable, "a"), "B") == 0);
+	TEST_CHECK (hashTableUpdateOrPutItem (htable,  "a", "C") == true);
+	TEST_CHECK (hashTableUpdateOrPutItem (htable,  strdup("x"), "X") == false);
+	TEST_CHECK (strcmp (hashTableGetItem (htable, "x"), "X") == 0);
+	TEST_CHECK (hashTableCountItem (htable) == 2);
+	hashTableDelete(htable);
+}
+
+static void test_htable_flat_grow(void)
+{
+	hashTable *htable;
+	int i;
+	char keyBuf[20];
+
+	htable = hashTableNewFlat (3, hashCstrhash, hashCstreq, eFree, eFree);
+
+	for (i = 0; i < 1000; ++i)
+	{
+		snprintf(keyBuf, sizeof(keyBuf), "str_%d", i);
+		hashTablePutItem (htable, strdup(keyBuf), strdup(keyBuf));
+	}
+	for (i = 0; i < 1000; i += 2)
+	{
+		snprintf(keyBuf, sizeof(keyBuf), "str_%d", i);
+		TEST_CHECK (hashTableDeleteItem (htable, keyBuf));
+	}
+
+	TEST_CHECK (hashTableCountItem (htable) == 500);
+	for (i = 0; i < 1000; ++i)
+	{
+		snprintf(keyBuf, sizeof(keyBuf), "str_%d", i);
+		TEST_CHECK (hashTableHasItem (htable, keyBuf) == (i % 2 == 1));
+	}
+	TEST_CHECK (strcmp (hashTableGetItem (htable, "str_123"), "str_123") == 0);
+	hashTableClear (htable);
+	TEST_CHECK (hashTableCountItem (htable) == 0);
+	TEST_CHECK (hashTableGetItem (htable, "str_123") == NULL);
+	hashTableDelete(htable);
+}
+
+static bool collect_chain (const void *key CTAGS_ATTR_UNUSED, void *value, void *user_data)
+{
+	vStringCatS (user_data, value);
+	return true;
+}
+
+static void test_htable_flat_chain(void)
+{
+	hashTable *htable = hashTableNewFlat (8, hashPtrhash, hashPtreq,
+										  NULL, NULL);
+	vString *chain = vStringNew ();
+	int i;
+
+	/* Many keys sharing the home slots make the probe sequences
+	 * overlap and wrap around the end of the table. */
+	for (i = 0; i < 100; i++)
+	{
+		hashTablePutItem (htable, HT_INT_TO_PTR(i % 10), "o");
+		if (i == 50)
+			hashTablePutItem (htable, HT_INT_TO_PTR(3), "n");
+	}
+	hashTablePutItem (htable, HT_INT_TO_PTR(3), "N");
+
+	TEST_CHECK (strcmp (hashTableGetItem (htable, HT_INT_TO_PTR(3)), "N") == 0);
+	TEST_CHECK (hashTableDeleteItem (htable, HT_INT_TO_PTR(3)));
+	hashTableForeachItemOnChain (htable, HT_INT_TO_PTR(3), collect_chain, chain);
+	TEST_CHECK (strcmp (vStringValue (chain), "ooooonooooo") == 0);
+	TEST_CHECK (hashTableCountItem (htable) == 101);
+
+	vStringDelete (chain);
+	hashTableDelete(htable);
+}
+
+static void test_htable_casehash(void)
+{
+	const char *lower = "abcdefghijklmnopqrstuvwxyz_@[`{0189";
+	const char *upper = "ABCDEFGHIJKLMNOPQRSTUVWXYZ_@[`{0189";
+	size_t len;
+
+	/* Every length goes through a different way of reading the tail. */
+	for (len = 0; len <= strlen (lower); len++)
+	{
+		TEST_CHECK (hashCstrncasehash (lower, len) == hashCstrncasehash (upper, len));
+		TEST_CHECK (len == 0 || hashCstrnhash (lower, len) != hashCstrnhash (upper, len));
+	}
+
+	/* Only ASCII letters are folded. */
+	TEST_CHECK (hashCstrcasehash ("a@z") != hashCstrcasehash ("A`Z"));
+	TEST_CHECK (hashCstrcasehash ("a[z") != hashCstrcasehash ("A{Z"));
+	TEST_CHECK (hashCstrcasehash ("\xc0") != hashCstrcasehash ("\xe0"));
+	TEST_CHECK (hashCstrhash ("keyword") == hashCstrnhash ("keyword", 7));
+}
+
 static void test_numarray(void)
 {
 	intArray *a = intArrayNew ();
@@ -311,6 +602,24 @@ static void test_vstring_truncate_leading(void)
 	vStringDelete (vstr);
 }
 
+static void test_vstring_escaping(void)
+{
+	vString *vstr = vStringNew ();
+
+	vStringCatSWithEscaping (vstr, "a long name with\ta tab and \\, \x01, \x7f\n");
+	TEST_CHECK(strcmp (vStringValue (vstr),
+					   "a long name with\\ta tab and \\\\, \\x01, \\x7F\\n") == 0);
+	vStringClear (vstr);
+
+	vStringCatSWithEscaping (vstr, "");
+	TEST_CHECK(strcmp (vStringValue (vstr), "") == 0);
+
+	vStringCatSWithEscapingAsPattern (vstr, "a/b\\c: a long enough input/");
+	TEST_CHECK(strcmp (vStringValue (vstr), "a\\/b\\\\c: a long enough input\\/") == 0);
+
+	vStringDelete (vstr);
+}
+
 static void test_vstring_eqc(void)
 {
 	vString *vstr = vStringNewInit ("abcdefg");
@@ -324,16 +633,50 @@ static void test_vstring_eqc(void)
 	vStringDelete (vstr);
 }
 
+static void test_vstring_inline(void)
+{
+	vString *vstr = vStringNewInit ("short");
+	char *str;
+
+	TEST_CHECK(vStringIsInline(vstr));
+
+	for (int i = 0; i < 100; i++)
+		vStringPut (vstr, 'x');
+	TEST_CHECK(!vStringIsInline(vstr));
+	TEST_CHECK(vStringLength(vstr) == 105);
+	TEST_CHECK(strncmp (vStringValue(vstr), "shortxxx", 8) == 0);
+	vStringDelete (vstr);
+
+	vstr = vStringNewInit ("short");
+	str = vStringDeleteUnwrap (vstr);
+	TEST_CHECK(strcmp (str, "short") == 0);
+	eFree (str);
+}
+
 TEST_LIST = {
+   { "bytescan/set",     test_bytescan_set     },
+   { "bytescan/control", test_bytescan_control },
+   { "bytescan/byte3",   test_bytescan_byte3   },
+   { "bytescan/set-long", test_bytescan_set_long },
+   { "bytescan/control-long", test_bytescan_control_long },
+   { "bytescan/count",   test_bytescan_count   },
+   { "bytescan/nonascii", test_bytescan_nonascii },
    { "fname/absolute",   test_fname_absolute   },
    { "fname/absolute+cache", test_fname_absolute_with_cache },
+   { "fname/interned",   test_fname_interned   },
    { "fname/relative",   test_fname_relative   },
    { "htable/update",    test_htable_update    },
    { "htable/grow",      test_htable_grow      },
+   { "htable/flat-update", test_htable_flat_update },
+   { "htable/flat-grow", test_htable_flat_grow },
+   { "htable/flat-chain", test_htable_flat_chain },
+   { "htable/casehash",  test_htable_casehash  },
    { "numarray",         test_numarray         },
    { "routines/strrstr", test_routines_strrstr },
    { "vstring/ncats",    test_vstring_ncats    },
    { "vstring/truncate_leading", test_vstring_truncate_leading },
+   { "vstring/escaping", test_vstring_escaping },
    { "vstring/EqC",      test_vstring_eqc },
+   { "vstring/inline",   test_vstring_inline },
    { NULL, NULL }     /* zeroed record marking the end of the list */
 };
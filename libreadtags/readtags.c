@@ -9,12 +9,26 @@
 /*
 *   INCLUDE FILES
 */
+#if defined (HAVE_CONFIG_H)
+#include <config.h>  /* zlib.h may include unistd.h replaced by gnulib */
+#endif
+
 #include <stdlib.h>
 #include <string.h>
 #include <ctype.h>
 #include <stdio.h>
 #include <errno.h>
 #include <sys/types.h>  /* to declare off_t */
+#if defined(__unix__) || (defined(__APPLE__) && defined(__MACH__))
+# include <sys/mman.h>  /* for tagsOpenMapped */
+# include <unistd.h>  /* for pread in tagsOpenCursor */
+# define READTAGS_USE_MMAP
+# define READTAGS_USE_PREAD
+#endif
+
+#ifdef READTAGS_USE_ZLIB
+# include <zlib.h>  /* for the compressed tag file */
+#endif
 
 #include "readtags.h"
 
@@ -23,6 +37,57 @@
 */
 #define TAB '\t'
 
+/* The distance in bytes below which tagsFindMany reads forward
+ * sequentially instead of bisecting */
+#define FIND_MANY_WINDOW 4096
+
+/* The initial size of the buffer a cursor reads the tag file into */
+#define CURSOR_BUFFER_SIZE 8192
+
+/* The sidecar name index made by ctags --name-index */
+#define NAME_INDEX_SUFFIX ".index"
+#define NAME_INDEX_HEADER "!_CTAGS_NAME_INDEX\t1\t"
+
+/* The sidecar trigram index made by ctags --trigram-index.
+ * See main/trigram.c of Universal Ctags for the layout. */
+#define TRIGRAM_INDEX_SUFFIX ".trigrams"
+#define TRIGRAM_INDEX_HEADER "!_CTAGS_TRIGRAM_INDEX\t1\t"
+#define TRIGRAM_KEY_LENGTH 6
+
+/* The sidecar secondary index made by ctags --secondary-index.
+ * See main/secondary.c of Universal Ctags for the layout. */
+#define SECONDARY_INDEX_SUFFIX ".secondary"
+#define SECONDARY_INDEX_HEADER "!_CTAGS_SECONDARY_INDEX\t1\t"
+
+/* The binary tag file made by ctags --output-format=binary.
+ * See main/writer-binary.c of Universal Ctags for the layout. */
+#define BINARY_MAGIC "!_TAG_BINARY_FORMAT\t1\t/u-ctags/\n"
+#define BINARY_MAGIC_SIZE 32
+#define BINARY_HEADER_SIZE (BINARY_MAGIC_SIZE + 8 * 4)
+#define BINARY_RECORD_SIZE (8 * 4)
+#define BINARY_FIELD_SIZE (2 * 4)
+#define BINARY_NO_STRING 0xffffffffUL
+#define BINARY_FLAG_FILE_SCOPE 0x1
+
+/* The compressed tag file made by ctags --output-format=compressed.
+ * See main/writer-compressed.c of Universal Ctags for the layout. */
+#define COMPRESSED_MAGIC "!_TAG_COMPRESSED_FORMAT\t1\t/zlib/\n"
+#define COMPRESSED_MAGIC_SIZE (sizeof (COMPRESSED_MAGIC) - 1)
+#define COMPRESSED_HEADER_SIZE (COMPRESSED_MAGIC_SIZE + 8 * 4)
+#define COMPRESSED_INDEX_SIZE (6 * 4)
+
+/* The stream of records made by ctags --output-format=stream.
+ * See main/writer-stream.c of Universal Ctags for the layout. */
+#define STREAM_MAGIC "!_TAG_STREAM_FORMAT\t1\t/records/\n"
+#define STREAM_MAGIC_SIZE (sizeof (STREAM_MAGIC) - 1)
+#define STREAM_FLAG_FILE_SCOPE 0x1
+
+enum streamRecordType {
+	STREAM_STRING = 1,
+	STREAM_PTAG   = 2,
+	STREAM_TAG    = 3,
+};
+
 
 /*
 *   DATA DECLARATIONS
@@ -39,6 +104,30 @@ typedef long long rt_off_t;
 typedef off_t rt_off_t;
 #endif
 
+/* An input file defined with !_TAG_INPUT_FILE_ID */
+typedef struct {
+		/* like "@1f2e3d4c", followed by `path' in the same allocation */
+	char *id;
+	char *path;
+} inputFileId;
+
+/* An input file or a scope in the secondary index with its posting list */
+typedef struct {
+	const char *key;
+	const char *posting;
+} secondaryKey;
+
+/* A block of the compressed tag file */
+typedef struct {
+		/* position of the first line of the block in the tag lines */
+	rt_off_t start;
+		/* offset of the compressed block in the file */
+	rt_off_t offset;
+	unsigned long size;
+		/* size of the block after decompression */
+	unsigned long length;
+} compressedBlock;
+
 /* Information about current tag file */
 struct sTagFile {
 		/* has the file been opened and this structure initialized? */
@@ -53,6 +142,13 @@ struct sTagFile {
 	tagSortType sortMethod;
 		/* pointer to file structure */
 	FILE* fp;
+		/* the tag file mapped by tagsOpenMapped; addr is NULL unless mapped */
+	struct {
+				/* start of the mapping, `size' bytes long */
+			const char *addr;
+				/* offset of the next character to read */
+			rt_off_t pos;
+	} map;
 		/* file position of first character of `line' */
 	rt_off_t pos;
 		/* size of tag file in seekable positions */
@@ -73,6 +169,12 @@ struct sTagFile {
 			short partial;
 				/* ignoring case */
 			short ignorecase;
+				/* performing substring match */
+			short substring;
+				/* looking up the tags of the input file or the
+				 * scope `name' instead of the tags named `name' */
+			short byFile;
+			short byScope;
 	} search;
 		/* miscellaneous extension fields */
 	struct {
@@ -92,6 +194,162 @@ struct sTagFile {
 			/* program version */
 		char *version;
 	} program;
+		/* sidecar name index; count is 0 if no index is loaded */
+	struct {
+				/* number of entries */
+			size_t count;
+				/* file offsets of the indexed tag lines */
+			rt_off_t *offsets;
+				/* names of the indexed tag lines, pointing into `buffer' */
+			char **names;
+				/* contents of the index file */
+			char *buffer;
+	} index;
+		/* sidecar trigram index, loaded at the first substring search;
+		 * path is NULL if the tag file has none, and blocks is NULL
+		 * unless the index is loaded */
+	struct {
+			char *path;
+			short loaded;
+				/* file offsets of the first lines of the blocks */
+			rt_off_t *blocks;
+			size_t blockCount;
+				/* lines of the trigrams and their posting lists,
+				 * pointing into `buffer' */
+			char **postings;
+			size_t count;
+			char *buffer;
+				/* the blocks in which the current search looks for
+				 * the name if `on' is set; the line at the head of
+				 * `candidates [current]' is not read yet if `atHead'
+				 * is set */
+			short on;
+			short atHead;
+			size_t *candidates;
+			size_t candidateCount;
+			size_t current;
+	} trigrams;
+		/* sidecar secondary index, loaded at the first search by an
+		 * input file or a scope; path is NULL if the tag file has none,
+		 * and inputs is NULL unless the index is loaded */
+	struct {
+			char *path;
+			short loaded;
+				/* keys sorted for bisecting with their posting
+				 * lists, pointing into `buffer'; the input files are
+				 * resolved and unescaped like tagEntry.file, and the
+				 * scopes are unescaped like field values */
+			secondaryKey *inputs;
+			size_t inputCount;
+			secondaryKey *scopes;
+			size_t scopeCount;
+			char *buffer;
+				/* the rest of the posting list read by the current
+				 * search if `on' is set, and the offset of the line
+				 * read last, or -1 before the first */
+			short on;
+			const char *posting;
+			rt_off_t offset;
+	} secondary;
+		/* input files referred to by ids in the input fields of tags,
+		 * sorted by id; count is 0 if the tag file defines no id */
+	struct {
+			size_t count;
+			size_t max;
+			inputFileId *list;
+	} inputIds;
+		/* set by tagsFirstInPart; tagsNext stops before reading a line
+		 * starting at `end' or after if `limited' is set. For a binary
+		 * tag file, `end' is the index of a record. */
+	struct {
+			short limited;
+			rt_off_t end;
+	} part;
+		/* the tag file in the binary format; data is NULL unless the
+		 * file is in the format */
+	struct {
+				/* the whole file; the mapping or `buffer' */
+			const unsigned char *data;
+				/* allocated if the file is not mapped */
+			unsigned char *buffer;
+				/* pseudo tags followed by tags */
+			const unsigned char *records;
+			const unsigned char *fields;
+			const char *strings;
+			unsigned long stringSize;
+			unsigned long ptagCount;
+			unsigned long tagCount;
+			unsigned long fieldCount;
+				/* index of the next record to read */
+			unsigned long next;
+	} binary;
+		/* the tag file in the compressed format; blocks is NULL unless
+		 * the file is in the format. The positions in the file are the
+		 * ones in the tag lines before compression, and `size' is the
+		 * size of the lines. */
+	struct {
+			compressedBlock *blocks;
+			unsigned long count;
+				/* first tag names of the blocks */
+			char *names;
+				/* a compressed block read from the file */
+			unsigned char *input;
+				/* the decompressed block `current'; current is
+				 * `count' if no block is decompressed */
+			char *data;
+			unsigned long current;
+				/* position of the next character to read */
+			rt_off_t pos;
+				/* sizes of the largest block before and after
+				 * decompression, for allocating `input' and `data' */
+			unsigned long inputSize;
+			unsigned long dataSize;
+	} compressed;
+		/* the tag file read sequentially from the stream given to
+		 * tagsOpenStream(); on is 0 for a tag file opened by name */
+	struct {
+			short on;
+				/* the first line after the pseudo tags is kept in
+				 * `line' until it is read as a tag */
+			short pending;
+				/* no tag has been read yet; tagsFirst() can only be
+				 * called in this state */
+			short atFirst;
+				/* number of bytes read from the stream */
+			rt_off_t pos;
+				/* the stream is in the record format; `record'
+				 * holds the last record read, `length' bytes of
+				 * `size', and `strings' the string table made of
+				 * `count' strings at `offsets' */
+			short records;
+			unsigned char *record;
+			size_t length;
+			size_t size;
+			char *strings;
+			size_t stringSize;
+			size_t stringMax;
+			size_t *offsets;
+			unsigned long count;
+			unsigned long offsetMax;
+	} stream;
+		/* the tag file opened by tagsOpenCursor(); owner is NULL unless
+		 * the handle is a cursor. A cursor shares the file, the pseudo
+		 * tags, the indexes and the mapping or the binary data with
+		 * `owner', and never changes them. Unless the file is mapped or
+		 * in the binary format, it is read with pread(2) at `fd', which
+		 * doesn't move a file position shared with the other cursors.
+		 * The lines are read into `buffer' holding `length' bytes from
+		 * the position `start'; buffer is NULL for a compressed file. */
+	struct {
+			const tagFile *owner;
+			int fd;
+			char *buffer;
+			size_t size;
+			rt_off_t start;
+			size_t length;
+				/* position of the next character to read */
+			rt_off_t pos;
+	} cursor;
 		/* 0 (initial state set by calloc), errno value,
 		 * or tagErrno typed value */
 	int err;
@@ -134,6 +392,95 @@ static int readtags_fseek(FILE *fp, rt_off_t pos, int whence)
 	return ret;
 }
 
+#ifdef READTAGS_USE_ZLIB
+static const char *compressedDataAt (tagFile *const file, rt_off_t pos,
+									 size_t *length);
+#endif
+#ifdef READTAGS_USE_PREAD
+static const char *cursorDataAt (tagFile *const file, rt_off_t pos,
+								 size_t *length);
+#endif
+
+/* The tag file is read through the following functions. They read the
+ * mapping made by tagsOpenMapped() without calling stdio or the system.
+ * For a compressed tag file, they read the decompressed tag lines. For
+ * a cursor, they read the buffer of the cursor.
+ */
+static rt_off_t tellTagFile (tagFile *const file)
+{
+	if (file->stream.on)
+		return file->stream.pos;
+	if (file->compressed.blocks)
+		return file->compressed.pos;
+	if (file->cursor.buffer)
+		return file->cursor.pos;
+	if (file->map.addr)
+		return file->map.pos;
+	return readtags_ftell (file->fp);
+}
+
+static int seekTagFile (tagFile *const file, rt_off_t pos, int whence)
+{
+	if (file->stream.on)
+	{
+		errno = ESPIPE;
+		return -1;
+	}
+	if (file->map.addr || file->compressed.blocks || file->cursor.buffer)
+	{
+		rt_off_t *current = file->compressed.blocks
+			? &file->compressed.pos
+			: file->cursor.buffer
+			? &file->cursor.pos
+			: &file->map.pos;
+
+		if (whence == SEEK_END)
+			pos += file->size;
+		else if (whence == SEEK_CUR)
+			pos += *current;
+		if (pos < 0 || pos > file->size)
+		{
+			errno = EINVAL;
+			return -1;
+		}
+		*current = pos;
+		return 0;
+	}
+	return readtags_fseek (file->fp, pos, whence);
+}
+
+/* Return the character at `pos' of the tag file, or EOF. */
+static int readCharAt (tagFile *const file, rt_off_t pos)
+{
+#ifdef READTAGS_USE_ZLIB
+	if (file->compressed.blocks)
+	{
+		size_t length;
+		const char *data = compressedDataAt (file, pos, &length);
+
+		return data? (unsigned char) *data: EOF;
+	}
+#endif
+#ifdef READTAGS_USE_PREAD
+	if (file->cursor.buffer)
+	{
+		size_t length;
+		const char *data = cursorDataAt (file, pos, &length);
+
+		return data? (unsigned char) *data: EOF;
+	}
+#endif
+	if (file->map.addr)
+		return (pos >= 0 && pos < file->size)
+			? (unsigned char) file->map.addr [pos]
+			: EOF;
+	if (file->stream.on)
+		return EOF;
+	if (readtags_fseek (file->fp, pos, SEEK_SET) < 0)
+		return EOF;
+	return fgetc (file->fp);
+}
+
 /* Converts a hexadecimal digit to its value */
 static int xdigitValue (unsigned char digit)
 {
@@ -306,6 +653,244 @@ static tagResult copyName (tagFile *const file)
 	return TagSuccess;
 }
 
+#if defined(READTAGS_USE_MMAP) || defined(READTAGS_USE_ZLIB)
+/* Copy a line in memory from `start' to `line', and advance `pos' over
+ * it. `end' is where the memory holding the line ends.
+ */
+static int copyLineInMemory (tagFile *const file, const char *const start,
+							 const char *const end, rt_off_t *pos, int *err)
+{
+	const char *next;
+	size_t length;
+
+	next = memchr (start, '\n', (size_t) (end - start));
+	next = (next == NULL)? end: next + 1;
+	length = (size_t) (next - start);
+	while (length >= file->line.size)
+	{
+		if (growString (&file->line) != TagSuccess)
+		{
+			*err = ENOMEM;
+			return 0;
+		}
+	}
+	memcpy (file->line.buffer, start, length);
+	*pos += (rt_off_t) length;
+	while (length > 0  &&
+		   (start [length - 1] == '\n' || start [length - 1] == '\r'))
+		--length;
+	file->line.buffer [length] = '\0';
+
+	if (copyName (file) != TagSuccess)
+	{
+		*err = ENOMEM;
+		return 0;
+	}
+	return 1;
+}
+#endif
+
+#ifdef READTAGS_USE_MMAP
+/* Same as readTagLineRaw but the line is taken from the mapping. */
+static int readTagLineMapped (tagFile *const file, int *err)
+{
+	const char *const start = file->map.addr + file->map.pos;
+	const char *const end = file->map.addr + file->size;
+
+	*err = 0;
+	file->pos = file->map.pos;
+	if (start >= end)
+		return 0;
+	return copyLineInMemory (file, start, end, &file->map.pos, err);
+}
+#endif
+
+#ifdef READTAGS_USE_ZLIB
+/* Same as readTagLineRaw but the line is taken from the decompressed
+ * block. A line never crosses the end of a block.
+ */
+static int readTagLineCompressed (tagFile *const file, int *err)
+{
+	size_t length;
+	const char *start;
+
+	*err = 0;
+	file->pos = file->compressed.pos;
+	if (file->pos >= file->size)
+		return 0;
+	start = compressedDataAt (file, file->pos, &length);
+	if (start == NULL)
+	{
+		*err = errno;
+		return 0;
+	}
+	return copyLineInMemory (file, start, start + length,
+							 &file->compressed.pos, err);
+}
+#endif
+
+#ifdef READTAGS_USE_PREAD
+/* Read `size' bytes at `offset' of the tag file of a cursor. Return 0
+ * on success, or -1 with errno set on failure.
+ */
+static int preadTagFile (tagFile *const file, void *const buffer, size_t size,
+						 rt_off_t offset)
+{
+	char *p = buffer;
+
+	while (size > 0)
+	{
+		const ssize_t n = pread (file->cursor.fd, p, size, (off_t) offset);
+
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n < 0)
+			return -1;
+		if (n == 0)
+		{
+			/* The tag file is truncated after it is opened. */
+			errno = TagErrnoUnexpectedFormat;
+			return -1;
+		}
+		p += n;
+		size -= (size_t) n;
+		offset += (rt_off_t) n;
+	}
+	return 0;
+}
+
+/* Read the tag file from `pos' into the buffer of the cursor unless the
+ * buffer holds `pos' already. Return the data at `pos', and store the
+ * length of the rest of the buffer to `length'. Return NULL with errno
+ * set on failure.
+ */
+static const char *cursorDataAt (tagFile *const file, rt_off_t pos,
+								 size_t *length)
+{
+	if (pos < 0 || pos >= file->size)
+	{
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (pos < file->cursor.start
+		|| pos >= file->cursor.start + (rt_off_t) file->cursor.length)
+	{
+		const rt_off_t rest = file->size - pos;
+		const size_t n = (rest < (rt_off_t) file->cursor.size)
+			? (size_t) rest
+			: file->cursor.size;
+
+		file->cursor.length = 0;
+		if (preadTagFile (file, file->cursor.buffer, n, pos) < 0)
+			return NULL;
+		file->cursor.start = pos;
+		file->cursor.length = n;
+	}
+
+	*length = (size_t) (file->cursor.start + (rt_off_t) file->cursor.length - pos);
+	return file->cursor.buffer + (pos - file->cursor.start);
+}
+
+/* Same as readTagLineRaw but the line is taken from the buffer of the
+ * cursor. A line crossing the end of the buffer is read again from its
+ * head, into a larger buffer if it doesn't fit.
+ */
+static int readTagLineCursor (tagFile *const file, int *err)
+{
+	const rt_off_t pos = file->cursor.pos;
+	const char *start;
+	size_t length;
+
+	*err = 0;
+	file->pos = pos;
+	if (pos >= file->size)
+		return 0;
+
+	while (1)
+	{
+		start = cursorDataAt (file, pos, &length);
+		if (start == NULL)
+		{
+			*err = errno;
+			return 0;
+		}
+		if (memchr (start, '\n', length) != NULL
+			|| pos + (rt_off_t) length >= file->size)
+			break;
+
+		if (file->cursor.start == pos)
+		{
+			char *buffer = realloc (file->cursor.buffer, file->cursor.size * 2);
+
+			if (buffer == NULL)
+			{
+				*err = ENOMEM;
+				return 0;
+			}
+			file->cursor.buffer = buffer;
+			file->cursor.size *= 2;
+		}
+		file->cursor.length = 0;
+	}
+	return copyLineInMemory (file, start, start + length, &file->cursor.pos, err);
+}
+#endif
+
+/* Same as readTagLineRaw but the line is read from the stream without
+ * seeking back. A line longer than the buffer is read in pieces appended
+ * to the buffer.
+ */
+static int readTagLineStream (tagFile *const file, int *err)
+{
+	size_t length = 0;
+
+	*err = 0;
+	file->stream.atFirst = 0;
+	if (file->stream.pending)
+	{
+		file->stream.pending = 0;
+		return 1;
+	}
+
+	file->pos = file->stream.pos;
+	while (1)
+	{
+		char *const pLastChar = file->line.buffer + file->line.size - 2;
+
+		*pLastChar = '\0';
+		if (fgets (file->line.buffer + length, (int) (file->line.size - length),
+				   file->fp) == NULL)
+		{
+			if (length > 0)
+				break;	/* the last line has no newline */
+			if (! feof (file->fp))
+				*err = errno;
+			return 0;
+		}
+		length += strlen (file->line.buffer + length);
+		if (*pLastChar == '\0' || *pLastChar == '\n' || *pLastChar == '\r')
+			break;
+		if (growString (&file->line) != TagSuccess)
+		{
+			*err = ENOMEM;
+			return 0;
+		}
+	}
+	file->stream.pos += length;
+
+	while (length > 0  &&
+		   (file->line.buffer [length - 1] == '\n' || file->line.buffer [length - 1] == '\r'))
+		file->line.buffer [--length] = '\0';
+
+	if (copyName (file) != TagSuccess)
+	{
+		*err = ENOMEM;
+		return 0;
+	}
+	return 1;
+}
+
 /* Return 1 on success.
  * Return 0 on failure or EOF.
  * errno is set to *err unless EOF.
@@ -315,6 +900,21 @@ static int readTagLineRaw (tagFile *const file, int *err)
 	int result = 1;
 	int reReadLine;
 
+	if (file->stream.on)
+		return readTagLineStream (file, err);
+#ifdef READTAGS_USE_ZLIB
+	if (file->compressed.blocks)
+		return readTagLineCompressed (file, err);
+#endif
+#ifdef READTAGS_USE_PREAD
+	if (file->cursor.buffer)
+		return readTagLineCursor (file, err);
+#endif
+#ifdef READTAGS_USE_MMAP
+	if (file->map.addr)
+		return readTagLineMapped (file, err);
+#endif
+
 	/*  If reading the line places any character other than a null or a
 	 *  newline at the last character position in the buffer (one less than
 	 *  the buffer size), then we must resize the buffer and reattempt to read
@@ -556,6 +1156,32 @@ static char *unescapeInPlace (char *q, char **tab, size_t *p_len)
 	return p;
 }
 
+static int compareInputFileIds (const void *a, const void *b)
+{
+	return strcmp (((const inputFileId *) a)->id, ((const inputFileId *) b)->id);
+}
+
+/* Return the path for `id' in the input field of a tag, or `id' itself
+ * if the id is not defined. */
+static const char *resolveInputFileId (tagFile *const file, const char *const id)
+{
+	size_t lower = 0;
+	size_t upper = file->inputIds.count;
+
+	while (lower < upper)
+	{
+		const size_t mid = lower + (upper - lower) / 2;
+		const int r = strcmp (id, file->inputIds.list [mid].id);
+		if (r == 0)
+			return file->inputIds.list [mid].path;
+		else if (r < 0)
+			upper = mid;
+		else
+			lower = mid + 1;
+	}
+	return id;
+}
+
 static tagResult parseTagLine (tagFile *file, tagEntry *const entry, int *err)
 {
 	int i;
@@ -586,6 +1212,13 @@ static tagResult parseTagLine (tagFile *file, tagEntry *const entry, int *err)
 			}
 			p = unescapeInPlace (p, &tab, &p_len);
 		}
+		if (file->inputIds.count > 0 && *entry->file == '@'
+			&& file->initialized)
+		{
+			if (tab != NULL)
+				*tab = '\0';
+			entry->file = resolveInputFileId (file, entry->file);
+		}
 
 		if (tab != NULL)
 		{
@@ -689,149 +1322,536 @@ static int isPseudoTagLine (const char *buffer)
 	return (strncmp (buffer, PseudoTagPrefix, PseudoTagPrefixLength) == 0);
 }
 
-static tagResult readPseudoTags (tagFile *const file, tagFileInfo *const info)
+static void initFileInfo (tagFileInfo *const info)
 {
-	fpos_t startOfLine;
-	int err = 0;
-	tagResult result = TagSuccess;
-	const size_t prefixLength = strlen (PseudoTagPrefix);
-	int tag_output_mode_u_ctags = 0;
-	int tag_output_filesep_slash = 0;
-
 	info->file.format     = 1;
 	info->file.sort       = TAG_UNSORTED;
 	info->program.author  = NULL;
 	info->program.name    = NULL;
 	info->program.url     = NULL;
 	info->program.version = NULL;
-
-	while (1)
-	{
-		if (fgetpos (file->fp, &startOfLine) < 0)
-		{
-			err = errno;
-			break;
-		}
-		if (! readTagLine (file, &err))
-			break;
-		if (!isPseudoTagLine (file->line.buffer))
-			break;
-		else
-		{
-			tagEntry entry;
-			const char *key, *value;
-			if (parseTagLine (file, &entry, &err) != TagSuccess)
-				break;
-			key = entry.name + prefixLength;
-			value = entry.file;
-			if (strcmp (key, "TAG_FILE_SORTED") == 0)
-			{
-				char *endptr = NULL;
-				long m = strtol (value, &endptr, 10);
-				if (*endptr != '\0' || m < 0 || m > 2)
-				{
-					err = TagErrnoUnexpectedSortedMethod;
-					break;
-				}
-				file->sortMethod = (tagSortType) m;
-			}
-			else if (strcmp (key, "TAG_FILE_FORMAT") == 0)
-			{
-				char *endptr = NULL;
-				long m = strtol (value, &endptr, 10);
-				if (*endptr != '\0' || m < 1 || m > 2)
-				{
-					err = TagErrnoUnexpectedFormat;
-					break;
-				}
-				file->format = (unsigned char) m;
-			}
-			else if (strcmp (key, "TAG_PROGRAM_AUTHOR") == 0)
-			{
-				file->program.author = duplicate (value);
-				if (value && file->program.author == NULL)
-				{
-					err = ENOMEM;
-					break;
-				}
-			}
-			else if (strcmp (key, "TAG_PROGRAM_NAME") == 0)
-			{
-				file->program.name = duplicate (value);
-				if (value && file->program.name == NULL)
-				{
-					err = ENOMEM;
-					break;
-				}
-			}
-			else if (strcmp (key, "TAG_PROGRAM_URL") == 0)
-			{
-				file->program.url = duplicate (value);
-				if (value && file->program.url == NULL)
-				{
-					err = ENOMEM;
-					break;
-				}
-			}
-			else if (strcmp (key, "TAG_PROGRAM_VERSION") == 0)
-			{
-				file->program.version = duplicate (value);
-				if (value && file->program.version == NULL)
-				{
-					err = ENOMEM;
-					break;
-				}
-			}
-			else if (strcmp (key, "TAG_OUTPUT_MODE") == 0)
-			{
-				if (strcmp (value, "u-ctags") == 0)
-					tag_output_mode_u_ctags = 1;
-			}
-			else if (strcmp (key, "TAG_OUTPUT_FILESEP") == 0)
-			{
-				if (strcmp (value, "slash") == 0)
-					tag_output_filesep_slash = 1;
-			}
-
-			info->file.format     = file->format;
-			info->file.sort       = file->sortMethod;
-			info->program.author  = file->program.author;
-			info->program.name    = file->program.name;
-			info->program.url     = file->program.url;
-			info->program.version = file->program.version;
-		}
-	}
-
-	if (tag_output_mode_u_ctags && tag_output_filesep_slash)
-		file->inputUCtagsMode = 1;
-
-	if (fsetpos (file->fp, &startOfLine) < 0)
-		err = errno;
-
-	info->status.error_number = err;
-	if (err)
-		result = TagFailure;
-	return result;
 }
 
-static int doesFilePointPseudoTag (tagFile *const file, void *unused)
+static void copyFileInfo (tagFile *const file, tagFileInfo *const info)
 {
-	return isPseudoTagLine (file->name.buffer);
+	info->file.format     = file->format;
+	info->file.sort       = file->sortMethod;
+	info->program.author  = file->program.author;
+	info->program.name    = file->program.name;
+	info->program.url     = file->program.url;
+	info->program.version = file->program.version;
 }
 
-static tagResult gotoFirstLogicalTag (tagFile *const file)
+/* Apply a pseudo tag to `file'. Return 0 or an error number. */
+/* Record the id defined by `entry', a TAG_INPUT_FILE_ID pseudo tag like
+ *
+ *   !_TAG_INPUT_FILE_ID	path/to/input.c	/@1f2e3d4c/
+ *
+ * The path is unescaped in loadInputFileIds() as the pseudo tags telling
+ * how the tag file is escaped may follow.
+ */
+static int addInputFileId (tagFile *const file, const tagEntry *const entry)
 {
-	fpos_t startOfLine;
+	const char *pattern = entry->address.pattern;
+	size_t idLength, pathLength;
+	inputFileId *f;
 
-	if (readtags_fseek(file->fp, 0, SEEK_SET) == -1)
+	if (pattern == NULL || pattern [0] != '/' || pattern [1] != '@')
+		return 0;
+	idLength = strcspn (pattern + 1, "/");
+	if (pattern [1 + idLength] != '/')
+		return 0;
+
+	if (file->inputIds.count == file->inputIds.max)
 	{
-		file->err = errno;
+		size_t max = file->inputIds.max? file->inputIds.max * 2: 16;
+		inputFileId *list = realloc (file->inputIds.list,
+									 max * sizeof (inputFileId));
+		if (list == NULL)
+			return ENOMEM;
+		file->inputIds.list = list;
+		file->inputIds.max = max;
+	}
+
+	pathLength = strlen (entry->file);
+	f = file->inputIds.list + file->inputIds.count;
+	f->id = malloc (idLength + 1 + pathLength + 1);
+	if (f->id == NULL)
+		return ENOMEM;
+	memcpy (f->id, pattern + 1, idLength);
+	f->id [idLength] = '\0';
+	f->path = f->id + idLength + 1;
+	memcpy (f->path, entry->file, pathLength + 1);
+	file->inputIds.count++;
+	return 0;
+}
+
+static void loadInputFileIds (tagFile *const file)
+{
+	for (size_t i = 0; i < file->inputIds.count; i++)
+	{
+		if (file->inputUCtagsMode)
+		{
+			char *tab = NULL;
+			size_t length = strlen (file->inputIds.list [i].path);
+			unescapeInPlace (file->inputIds.list [i].path, &tab, &length);
+		}
+	}
+	if (file->inputIds.count > 1)
+		qsort (file->inputIds.list, file->inputIds.count,
+			   sizeof (inputFileId), compareInputFileIds);
+}
+
+static void unloadInputFileIds (tagFile *const file)
+{
+	for (size_t i = 0; i < file->inputIds.count; i++)
+		free (file->inputIds.list [i].id);
+	free (file->inputIds.list);
+	memset (&file->inputIds, 0, sizeof (file->inputIds));
+}
+
+static int applyPseudoTag (tagFile *const file, const tagEntry *const entry,
+						   int *const tag_output_mode_u_ctags,
+						   int *const tag_output_filesep_slash)
+{
+	const char *key = entry->name + PseudoTagPrefixLength;
+	const char *value = entry->file;
+
+	if (strcmp (key, "TAG_FILE_SORTED") == 0)
+	{
+		char *endptr = NULL;
+		long m = strtol (value, &endptr, 10);
+		if (*endptr != '\0' || m < 0 || m > 2)
+			return TagErrnoUnexpectedSortedMethod;
+		file->sortMethod = (tagSortType) m;
+	}
+	else if (strcmp (key, "TAG_FILE_FORMAT") == 0)
+	{
+		char *endptr = NULL;
+		long m = strtol (value, &endptr, 10);
+		if (*endptr != '\0' || m < 1 || m > 2)
+			return TagErrnoUnexpectedFormat;
+		file->format = (unsigned char) m;
+	}
+	else if (strcmp (key, "TAG_PROGRAM_AUTHOR") == 0)
+	{
+		file->program.author = duplicate (value);
+		if (value && file->program.author == NULL)
+			return ENOMEM;
+	}
+	else if (strcmp (key, "TAG_PROGRAM_NAME") == 0)
+	{
+		file->program.name = duplicate (value);
+		if (value && file->program.name == NULL)
+			return ENOMEM;
+	}
+	else if (strcmp (key, "TAG_PROGRAM_URL") == 0)
+	{
+		file->program.url = duplicate (value);
+		if (value && file->program.url == NULL)
+			return ENOMEM;
+	}
+	else if (strcmp (key, "TAG_PROGRAM_VERSION") == 0)
+	{
+		file->program.version = duplicate (value);
+		if (value && file->program.version == NULL)
+			return ENOMEM;
+	}
+	else if (strcmp (key, "TAG_OUTPUT_MODE") == 0)
+	{
+		if (strcmp (value, "u-ctags") == 0)
+			*tag_output_mode_u_ctags = 1;
+	}
+	else if (strcmp (key, "TAG_OUTPUT_FILESEP") == 0)
+	{
+		if (strcmp (value, "slash") == 0)
+			*tag_output_filesep_slash = 1;
+	}
+	else if (strcmp (key, "TAG_INPUT_FILE_ID") == 0)
+		return addInputFileId (file, entry);
+	return 0;
+}
+
+/* The records of a stream made by ctags --output-format=stream are read
+ * through the following functions. A record is a 32-bit little endian
+ * length and as many bytes: the type and the payload. The strings of an
+ * entry point to the record or to the string table.
+ */
+static int readStreamRecord (tagFile *const file, int *err)
+{
+	unsigned char header [4];
+	size_t length;
+	size_t n;
+
+	*err = 0;
+	n = fread (header, 1, sizeof (header), file->fp);
+	if (n == 0 && feof (file->fp))
+		return 0;
+	if (n < sizeof (header))
+	{
+		*err = ferror (file->fp)? errno: TagErrnoUnexpectedFormat;
+		return 0;
+	}
+	length = (size_t) header [0]
+		| ((size_t) header [1] << 8)
+		| ((size_t) header [2] << 16)
+		| ((size_t) header [3] << 24);
+	if (length == 0)
+	{
+		*err = TagErrnoUnexpectedFormat;
+		return 0;
+	}
+	if (length > file->stream.size)
+	{
+		size_t size = file->stream.size? file->stream.size: 256;
+		unsigned char *record;
+
+		while (size < length)
+			size *= 2;
+		record = realloc (file->stream.record, size);
+		if (record == NULL)
+		{
+			*err = ENOMEM;
+			return 0;
+		}
+		file->stream.record = record;
+		file->stream.size = size;
+	}
+	if (fread (file->stream.record, 1, length, file->fp) < length)
+	{
+		*err = ferror (file->fp)? errno: TagErrnoUnexpectedFormat;
+		return 0;
+	}
+	file->pos = file->stream.pos;
+	file->stream.pos += (rt_off_t) (sizeof (header) + length);
+	file->stream.length = length;
+	return 1;
+}
+
+/* Add the string in the STREAM_STRING record read last to the table. */
+static int addStreamString (tagFile *const file)
+{
+	const char *str = (const char *) file->stream.record + 1;
+	const size_t length = file->stream.length - 1;
+
+	if (length == 0 || str [length - 1] != '\0')
+		return TagErrnoUnexpectedFormat;
+
+	if (file->stream.stringSize + length > file->stream.stringMax)
+	{
+		size_t size = file->stream.stringMax? file->stream.stringMax: 4096;
+		char *strings;
+
+		while (size < file->stream.stringSize + length)
+			size *= 2;
+		strings = realloc (file->stream.strings, size);
+		if (strings == NULL)
+			return ENOMEM;
+		file->stream.strings = strings;
+		file->stream.stringMax = size;
+	}
+	if (file->stream.count == file->stream.offsetMax)
+	{
+		unsigned long max = file->stream.offsetMax? file->stream.offsetMax * 2: 256;
+		size_t *offsets = realloc (file->stream.offsets, max * sizeof (size_t));
+
+		if (offsets == NULL)
+			return ENOMEM;
+		file->stream.offsets = offsets;
+		file->stream.offsetMax = max;
+	}
+	memcpy (file->stream.strings + file->stream.stringSize, str, length);
+	file->stream.offsets [file->stream.count++] = file->stream.stringSize;
+	file->stream.stringSize += length;
+	return 0;
+}
+
+/* Read an unsigned LEB128 number at `*p' before `end'. */
+static int readVarint (const unsigned char **p, const unsigned char *const end,
+					   unsigned long *value)
+{
+	unsigned long v = 0;
+	unsigned int shift = 0;
+
+	while (*p < end && shift < sizeof (v) * 8)
+	{
+		const unsigned char c = *(*p)++;
+
+		v |= (unsigned long) (c & 0x7f) << shift;
+		if ((c & 0x80) == 0)
+		{
+			*value = v;
+			return 1;
+		}
+		shift += 7;
+	}
+	return 0;
+}
+
+/* Read a string at `*p': 0 for no string, an odd number for a string in
+ * the table, or an even number for the length of an inline string.
+ * Return 0 if the record is broken. */
+static int readStreamString (tagFile *const file, const unsigned char **p,
+							 const unsigned char *const end, const char **str)
+{
+	unsigned long v;
+
+	if (! readVarint (p, end, &v))
+		return 0;
+	if (v == 0)
+		*str = NULL;
+	else if (v & 1)
+	{
+		if ((v >> 1) >= file->stream.count)
+			return 0;
+		*str = file->stream.strings + file->stream.offsets [v >> 1];
+	}
+	else
+	{
+		const unsigned long length = (v >> 1) - 1;
+
+		if (length >= (unsigned long) (end - *p) || (*p) [length] != '\0')
+			return 0;
+		*str = (const char *) *p;
+		*p += length + 1;
+	}
+	return 1;
+}
+
+/* Fill `entry' with the STREAM_PTAG or STREAM_TAG record read last. */
+static tagResult parseStreamRecord (tagFile *const file, tagEntry *const entry,
+									int *err)
+{
+	const unsigned char *p = file->stream.record + 1;
+	const unsigned char *const end = file->stream.record + file->stream.length;
+	unsigned long lineNumber, flags, count, i;
+
+	memset (entry, 0, sizeof (*entry));
+	if (! readStreamString (file, &p, end, &entry->name)
+		|| ! readStreamString (file, &p, end, &entry->file)
+		|| ! readStreamString (file, &p, end, &entry->address.pattern))
+		goto format_error;
+	if (entry->name == NULL)
+		entry->name = EmptyString;
+	if (entry->file == NULL)
+		entry->file = EmptyString;
+	if (entry->address.pattern == NULL)
+		entry->address.pattern = EmptyString;
+	if (file->stream.record [0] == STREAM_PTAG)
+		return TagSuccess;
+
+	if (! readVarint (&p, end, &lineNumber)
+		|| ! readStreamString (file, &p, end, &entry->kind)
+		|| ! readVarint (&p, end, &flags)
+		|| ! readVarint (&p, end, &count)
+		|| count > 0xffff)
+		goto format_error;
+	entry->address.lineNumber = lineNumber;
+	entry->fileScope = (flags & STREAM_FLAG_FILE_SCOPE)? 1: 0;
+
+	while (count > file->fields.max)
+	{
+		if (growFields (file) != TagSuccess)
+		{
+			*err = ENOMEM;
+			return TagFailure;
+		}
+	}
+	for (i = 0; i < count; i++)
+	{
+		if (! readStreamString (file, &p, end, &file->fields.list [i].key)
+			|| ! readStreamString (file, &p, end, &file->fields.list [i].value)
+			|| file->fields.list [i].key == NULL
+			|| file->fields.list [i].value == NULL)
+			goto format_error;
+	}
+	entry->fields.count = (unsigned short) count;
+	if (entry->fields.count > 0)
+		entry->fields.list = file->fields.list;
+	for (i = entry->fields.count  ;  i < file->fields.max  ;  ++i)
+	{
+		file->fields.list [i].key = NULL;
+		file->fields.list [i].value = NULL;
+	}
+	return TagSuccess;
+
+ format_error:
+	*err = TagErrnoUnexpectedFormat;
+	return TagFailure;
+}
+
+/* Read records until a STREAM_PTAG or STREAM_TAG record, adding the
+ * strings to the table on the way. The records of unknown types are
+ * skipped. */
+static int readStreamEntry (tagFile *const file, int *err)
+{
+	*err = 0;
+	file->stream.atFirst = 0;
+	if (file->stream.pending)
+	{
+		file->stream.pending = 0;
+		return 1;
+	}
+
+	while (readStreamRecord (file, err))
+	{
+		const unsigned char type = file->stream.record [0];
+
+		if (type == STREAM_STRING)
+		{
+			*err = addStreamString (file);
+			if (*err)
+				return 0;
+		}
+		else if (type == STREAM_PTAG || type == STREAM_TAG)
+			return 1;
+	}
+	return 0;
+}
+
+/* Read the pseudo tags after the magic of a stream of records. The
+ * first tag is kept in the record buffer. */
+static int readStreamPseudoTags (tagFile *const file, tagFileInfo *const info,
+								 int *const tag_output_mode_u_ctags,
+								 int *const tag_output_filesep_slash,
+								 int *const tagRead)
+{
+	int err;
+
+	file->stream.records = 1;
+	while (readStreamEntry (file, &err))
+	{
+		tagEntry entry;
+
+		if (file->stream.record [0] == STREAM_TAG)
+		{
+			*tagRead = 1;
+			break;
+		}
+		if (parseStreamRecord (file, &entry, &err) != TagSuccess)
+			break;
+		err = applyPseudoTag (file, &entry, tag_output_mode_u_ctags,
+							  tag_output_filesep_slash);
+		if (err)
+			break;
+		copyFileInfo (file, info);
+	}
+	return err;
+}
+
+static tagResult readPseudoTags (tagFile *const file, tagFileInfo *const info)
+{
+	rt_off_t startOfLine = 0;
+	int err = 0;
+	tagResult result = TagSuccess;
+	int tag_output_mode_u_ctags = 0;
+	int tag_output_filesep_slash = 0;
+	int tagLineRead = 0;
+
+	initFileInfo (info);
+
+	while (1)
+	{
+		startOfLine = tellTagFile (file);
+		if (startOfLine < 0)
+		{
+			err = errno;
+			break;
+		}
+		if (! readTagLine (file, &err))
+			break;
+		if (file->stream.on
+			&& (strncmp (file->line.buffer, BINARY_MAGIC, BINARY_MAGIC_SIZE - 1) == 0
+				|| strncmp (file->line.buffer, COMPRESSED_MAGIC,
+							COMPRESSED_MAGIC_SIZE - 1) == 0))
+		{
+			/* Neither format can be read sequentially. */
+			err = TagErrnoUnexpectedFormat;
+			break;
+		}
+		if (strncmp (file->line.buffer, STREAM_MAGIC, STREAM_MAGIC_SIZE - 1) == 0)
+		{
+			/* A stream of records can only be read sequentially. */
+			if (file->stream.on)
+				err = readStreamPseudoTags (file, info, &tag_output_mode_u_ctags,
+											&tag_output_filesep_slash,
+											&tagLineRead);
+			else
+				err = TagErrnoUnexpectedFormat;
+			break;
+		}
+		if (!isPseudoTagLine (file->line.buffer))
+		{
+			tagLineRead = 1;
+			break;
+		}
+		else
+		{
+			tagEntry entry;
+			if (parseTagLine (file, &entry, &err) != TagSuccess)
+				break;
+			err = applyPseudoTag (file, &entry, &tag_output_mode_u_ctags,
+								  &tag_output_filesep_slash);
+			if (err)
+				break;
+			copyFileInfo (file, info);
+		}
+	}
+
+	if (tag_output_mode_u_ctags && tag_output_filesep_slash)
+		file->inputUCtagsMode = 1;
+	loadInputFileIds (file);
+
+	if (file->stream.on)
+	{
+		file->stream.pending = tagLineRead;
+		file->stream.atFirst = 1;
+	}
+	else if (startOfLine >= 0 && seekTagFile (file, startOfLine, SEEK_SET) < 0)
+		err = errno;
+
+	info->status.error_number = err;
+	if (err)
+		result = TagFailure;
+	return result;
+}
+
+static int doesFilePointPseudoTag (tagFile *const file, void *unused)
+{
+	return isPseudoTagLine (file->name.buffer);
+}
+
+static tagResult gotoFirstLogicalTag (tagFile *const file)
+{
+	rt_off_t startOfLine;
+
+	if (file->binary.data)
+	{
+		file->binary.next = file->binary.ptagCount;
+		return TagSuccess;
+	}
+
+	if (file->stream.on)
+	{
+		/* The tags read from the stream cannot be read again. */
+		if (! file->stream.atFirst)
+		{
+			file->err = ESPIPE;
+			return TagFailure;
+		}
+		return TagSuccess;
+	}
+
+	if (seekTagFile (file, 0, SEEK_SET) == -1)
+	{
+		file->err = errno;
 		return TagFailure;
 	}
 
 	while (1)
 	{
-		if (fgetpos (file->fp, &startOfLine) < 0)
+		startOfLine = tellTagFile (file);
+		if (startOfLine < 0)
 		{
 			file->err = errno;
 			return TagFailure;
@@ -845,7 +1865,7 @@ static tagResult gotoFirstLogicalTag (tagFile *const file)
 		if (!isPseudoTagLine (file->line.buffer))
 			break;
 	}
-	if (fsetpos (file->fp, &startOfLine) < 0)
+	if (seekTagFile (file, startOfLine, SEEK_SET) < 0)
 	{
 		file->err = errno;
 		return TagFailure;
@@ -853,20 +1873,1044 @@ static tagResult gotoFirstLogicalTag (tagFile *const file)
 	return TagSuccess;
 }
 
-static tagFile *initialize (const char *const filePath, tagFileInfo *const info)
+static void unloadNameIndex (tagFile *const file)
 {
-	tagFile *result = (tagFile*) calloc ((size_t) 1, sizeof (tagFile));
+	free (file->index.offsets);
+	free (file->index.names);
+	free (file->index.buffer);
+	memset (&file->index, 0, sizeof (file->index));
+}
 
-	if (result == NULL)
+/* Load <tagfile>.index made by ctags --name-index if it exists and its
+ * header records the size of the tag file. Any problem in the index
+ * just leaves it unused.
+ */
+static void loadNameIndex (tagFile *const file, const char *const filePath)
+{
+	const size_t headerLength = strlen (NAME_INDEX_HEADER);
+	char *indexPath;
+	FILE *fp;
+	rt_off_t indexSize;
+	char *p, *end, *next;
+	size_t count = 0;
+
+	indexPath = malloc (strlen (filePath) + strlen (NAME_INDEX_SUFFIX) + 1);
+	if (indexPath == NULL)
+		return;
+	strcpy (indexPath, filePath);
+	strcat (indexPath, NAME_INDEX_SUFFIX);
+	fp = fopen (indexPath, "rb");
+	free (indexPath);
+	if (fp == NULL)
+		return;
+
+	if (readtags_fseek (fp, 0, SEEK_END) == -1
+		|| (indexSize = readtags_ftell (fp)) <= (rt_off_t) headerLength
+		|| readtags_fseek (fp, 0, SEEK_SET) == -1)
+		goto out;
+
+	file->index.buffer = malloc ((size_t) indexSize + 1);
+	if (file->index.buffer == NULL)
+		goto out;
+	if (fread (file->index.buffer, 1, (size_t) indexSize, fp) != (size_t) indexSize)
+		goto failure;
+	file->index.buffer [indexSize] = '\0';
+	end = file->index.buffer + indexSize;
+
+	if (strncmp (file->index.buffer, NAME_INDEX_HEADER, headerLength) != 0
+		|| strtoll (file->index.buffer + headerLength, &p, 10) != (long long) file->size
+		|| *p != '\n')
+		goto failure;
+
+	for (next = p + 1; next < end; next++)
+		if (*next == '\n')
+			count++;
+	if (count == 0)
+		goto failure;
+
+	file->index.offsets = malloc (count * sizeof (rt_off_t));
+	file->index.names = malloc (count * sizeof (char *));
+	if (file->index.offsets == NULL || file->index.names == NULL)
+		goto failure;
+
+	for (p = p + 1; p < end && file->index.count < count; p = next + 1)
 	{
-		info->status.opened = 0;
-		info->status.error_number = ENOMEM;
-		return NULL;
+		char *name;
+		long long offset = strtoll (p, &name, 10);
+
+		next = strchr (p, '\n');
+		if (next == NULL || name == p || *name != TAB
+			|| offset <= 0 || offset >= (long long) file->size)
+			goto failure;
+		*next = '\0';
+		file->index.offsets [file->index.count] = (rt_off_t) offset;
+		file->index.names [file->index.count] = name + 1;
+		file->index.count++;
 	}
+	goto out;
 
-	if (growString (&result->line) != TagSuccess)
-		goto mem_error;
-	if (growString (&result->name) != TagSuccess)
+ failure:
+	unloadNameIndex (file);
+ out:
+	fclose (fp);
+}
+
+/* Record the path of <tagfile>.trigrams made by ctags --trigram-index if
+ * it exists. The index is loaded at the first substring search.
+ */
+static void locateTrigramIndex (tagFile *const file, const char *const filePath)
+{
+	FILE *fp;
+
+	file->trigrams.path = malloc (strlen (filePath) + strlen (TRIGRAM_INDEX_SUFFIX) + 1);
+	if (file->trigrams.path == NULL)
+		return;
+	strcpy (file->trigrams.path, filePath);
+	strcat (file->trigrams.path, TRIGRAM_INDEX_SUFFIX);
+	fp = fopen (file->trigrams.path, "rb");
+	if (fp == NULL)
+	{
+		free (file->trigrams.path);
+		file->trigrams.path = NULL;
+		return;
+	}
+	fclose (fp);
+}
+
+static void resetTrigramSearch (tagFile *const file)
+{
+	free (file->trigrams.candidates);
+	file->trigrams.candidates = NULL;
+	file->trigrams.candidateCount = 0;
+	file->trigrams.current = 0;
+	file->trigrams.on = 0;
+}
+
+static void unloadTrigramIndex (tagFile *const file)
+{
+	resetTrigramSearch (file);
+	free (file->trigrams.blocks);
+	free (file->trigrams.postings);
+	free (file->trigrams.buffer);
+	file->trigrams.blocks = NULL;
+	file->trigrams.postings = NULL;
+	file->trigrams.buffer = NULL;
+	file->trigrams.blockCount = 0;
+	file->trigrams.count = 0;
+}
+
+/* Load the trigram index if its header records the size of the tag file.
+ * Any problem in the index just leaves it unused. Return 1 if the index
+ * is loaded.
+ */
+static int loadTrigramIndex (tagFile *const file)
+{
+	const size_t headerLength = strlen (TRIGRAM_INDEX_HEADER);
+	FILE *fp;
+	rt_off_t indexSize;
+	unsigned long long blockCount, count;
+	char *p, *end, *next;
+	size_t i;
+
+	if (file->trigrams.loaded)
+		return file->trigrams.blocks != NULL;
+	file->trigrams.loaded = 1;
+	if (file->trigrams.path == NULL)
+		return 0;
+
+	fp = fopen (file->trigrams.path, "rb");
+	if (fp == NULL)
+		return 0;
+
+	if (readtags_fseek (fp, 0, SEEK_END) == -1
+		|| (indexSize = readtags_ftell (fp)) <= (rt_off_t) headerLength
+		|| readtags_fseek (fp, 0, SEEK_SET) == -1)
+		goto out;
+
+	file->trigrams.buffer = malloc ((size_t) indexSize + 1);
+	if (file->trigrams.buffer == NULL)
+		goto out;
+	if (fread (file->trigrams.buffer, 1, (size_t) indexSize, fp) != (size_t) indexSize)
+		goto failure;
+	file->trigrams.buffer [indexSize] = '\0';
+	end = file->trigrams.buffer + indexSize;
+
+	if (strncmp (file->trigrams.buffer, TRIGRAM_INDEX_HEADER, headerLength) != 0
+		|| strtoll (file->trigrams.buffer + headerLength, &p, 10) != (long long) file->size
+		|| *p != TAB
+		|| (blockCount = strtoull (p + 1, &p, 10), *p != TAB)
+		|| (count = strtoull (p + 1, &p, 10), *p != '\n'))
+		goto failure;
+
+	/* Allocate one block at least so that `blocks' tells the index is
+	 * loaded. */
+	file->trigrams.blocks = malloc ((blockCount + 1) * sizeof (rt_off_t));
+	file->trigrams.postings = malloc ((count + 1) * sizeof (char *));
+	if (file->trigrams.blocks == NULL || file->trigrams.postings == NULL)
+		goto failure;
+
+	for (i = 0, p = p + 1; i < blockCount; i++, p = next)
+	{
+		long long offset = strtoll (p, &next, 10);
+
+		if (next == p || *next != '\n' || offset <= 0 || offset >= (long long) file->size
+			|| (i > 0 && offset <= (long long) file->trigrams.blocks [i - 1]))
+			goto failure;
+		file->trigrams.blocks [i] = (rt_off_t) offset;
+		next++;
+	}
+	file->trigrams.blockCount = (size_t) blockCount;
+
+	for (i = 0; i < count; i++, p = next + 1)
+	{
+		next = (p < end)? strchr (p, '\n'): NULL;
+		if (next == NULL || next - p <= TRIGRAM_KEY_LENGTH || p [TRIGRAM_KEY_LENGTH] != TAB)
+			goto failure;
+		*next = '\0';
+		file->trigrams.postings [i] = p;
+	}
+	file->trigrams.count = (size_t) count;
+	goto out;
+
+ failure:
+	unloadTrigramIndex (file);
+ out:
+	fclose (fp);
+	return file->trigrams.blocks != NULL;
+}
+
+/* Record the path of <tagfile>.secondary made by ctags --secondary-index
+ * if it exists. The index is loaded at the first search by an input file
+ * or a scope.
+ */
+static void locateSecondaryIndex (tagFile *const file, const char *const filePath)
+{
+	FILE *fp;
+
+	file->secondary.path = malloc (strlen (filePath) + strlen (SECONDARY_INDEX_SUFFIX) + 1);
+	if (file->secondary.path == NULL)
+		return;
+	strcpy (file->secondary.path, filePath);
+	strcat (file->secondary.path, SECONDARY_INDEX_SUFFIX);
+	fp = fopen (file->secondary.path, "rb");
+	if (fp == NULL)
+	{
+		free (file->secondary.path);
+		file->secondary.path = NULL;
+		return;
+	}
+	fclose (fp);
+}
+
+static void unloadSecondaryIndex (tagFile *const file)
+{
+	free (file->secondary.inputs);
+	free (file->secondary.scopes);
+	free (file->secondary.buffer);
+	file->secondary.inputs = NULL;
+	file->secondary.scopes = NULL;
+	file->secondary.buffer = NULL;
+	file->secondary.inputCount = 0;
+	file->secondary.scopeCount = 0;
+	file->secondary.on = 0;
+}
+
+static int compareSecondaryKeys (const void *a, const void *b)
+{
+	return strcmp (((const secondaryKey *) a)->key, ((const secondaryKey *) b)->key);
+}
+
+/* Read a line of the secondary index at `p', "<type>\t<key>\t<posting>",
+ * into `key', unescaping the key in place. Return the next line, or NULL
+ * if the line is broken.
+ */
+static char *readSecondaryKey (tagFile *const file, char *const p,
+							   char type, secondaryKey *const key)
+{
+	char *tab, *next;
+	size_t length;
+
+	if (p [0] != type || p [1] != TAB)
+		return NULL;
+	key->key = p + 2;
+	tab = strchr (p + 2, TAB);
+	next = strchr (p + 2, '\n');
+	if (tab == NULL || next == NULL || tab > next || tab == key->key)
+		return NULL;
+	*tab = '\0';
+	*next = '\0';
+	key->posting = tab + 1;
+
+	length = tab - key->key;
+	if (type == 'S' || file->inputUCtagsMode)
+	{
+		char *dummy = NULL;
+		unescapeInPlace (p + 2, &dummy, &length);
+	}
+	if (type == 'I' && file->inputIds.count > 0 && *key->key == '@')
+		key->key = resolveInputFileId (file, key->key);
+	return next + 1;
+}
+
+/* Load the secondary index if its header records the size of the tag
+ * file. Any problem in the index just leaves it unused. Return 1 if the
+ * index is loaded.
+ */
+static int loadSecondaryIndex (tagFile *const file)
+{
+	const size_t headerLength = strlen (SECONDARY_INDEX_HEADER);
+	FILE *fp;
+	rt_off_t indexSize;
+	unsigned long long inputCount, scopeCount;
+	char *p, *end;
+	size_t i;
+
+	if (file->secondary.loaded)
+		return file->secondary.inputs != NULL;
+	file->secondary.loaded = 1;
+	if (file->secondary.path == NULL)
+		return 0;
+
+	fp = fopen (file->secondary.path, "rb");
+	if (fp == NULL)
+		return 0;
+
+	if (readtags_fseek (fp, 0, SEEK_END) == -1
+		|| (indexSize = readtags_ftell (fp)) <= (rt_off_t) headerLength
+		|| readtags_fseek (fp, 0, SEEK_SET) == -1)
+		goto out;
+
+	file->secondary.buffer = malloc ((size_t) indexSize + 1);
+	if (file->secondary.buffer == NULL)
+		goto out;
+	if (fread (file->secondary.buffer, 1, (size_t) indexSize, fp) != (size_t) indexSize)
+		goto failure;
+	file->secondary.buffer [indexSize] = '\0';
+	end = file->secondary.buffer + indexSize;
+
+	if (strncmp (file->secondary.buffer, SECONDARY_INDEX_HEADER, headerLength) != 0
+		|| strtoll (file->secondary.buffer + headerLength, &p, 10) != (long long) file->size
+		|| *p != TAB
+		|| (inputCount = strtoull (p + 1, &p, 10), *p != TAB)
+		|| (scopeCount = strtoull (p + 1, &p, 10), *p != '\n')
+		|| inputCount > (unsigned long long) indexSize
+		|| scopeCount > (unsigned long long) indexSize)
+		goto failure;
+
+	/* Allocate one key at least so that `inputs' tells the index is
+	 * loaded. */
+	file->secondary.inputs = malloc ((inputCount + 1) * sizeof (secondaryKey));
+	file->secondary.scopes = malloc ((scopeCount + 1) * sizeof (secondaryKey));
+	if (file->secondary.inputs == NULL || file->secondary.scopes == NULL)
+		goto failure;
+
+	for (i = 0, p = p + 1; i < inputCount; i++)
+	{
+		if (p >= end
+			|| (p = readSecondaryKey (file, p, 'I', file->secondary.inputs + i)) == NULL)
+			goto failure;
+	}
+	for (i = 0; i < scopeCount; i++)
+	{
+		if (p >= end
+			|| (p = readSecondaryKey (file, p, 'S', file->secondary.scopes + i)) == NULL)
+			goto failure;
+	}
+	file->secondary.inputCount = (size_t) inputCount;
+	file->secondary.scopeCount = (size_t) scopeCount;
+
+	/* Resolving and unescaping may change the order of the keys. */
+	qsort (file->secondary.inputs, file->secondary.inputCount,
+		   sizeof (secondaryKey), compareSecondaryKeys);
+	qsort (file->secondary.scopes, file->secondary.scopeCount,
+		   sizeof (secondaryKey), compareSecondaryKeys);
+	goto out;
+
+ failure:
+	unloadSecondaryIndex (file);
+ out:
+	fclose (fp);
+	return file->secondary.inputs != NULL;
+}
+
+#ifdef READTAGS_USE_MMAP
+/* Map the whole tag file. If it cannot be mapped, the file is read
+ * through `fp' as usual.
+ */
+static void mapTagFile (tagFile *const file)
+{
+	void *addr;
+
+	if (file->size <= 0 || (rt_off_t) (size_t) file->size != file->size)
+		return;
+
+	addr = mmap (NULL, (size_t) file->size, PROT_READ, MAP_PRIVATE,
+				 fileno (file->fp), 0);
+	if (addr == MAP_FAILED)
+		return;
+	file->map.addr = addr;
+	file->map.pos = 0;
+}
+
+static void unmapTagFile (tagFile *const file)
+{
+	if (file->map.addr)
+		munmap ((void *) file->map.addr, (size_t) file->size);
+	file->map.addr = NULL;
+}
+#endif
+
+/*
+ * Binary tag file
+ */
+
+static unsigned long readNumber (const unsigned char *p)
+{
+	return (unsigned long) p [0]
+		| ((unsigned long) p [1] << 8)
+		| ((unsigned long) p [2] << 16)
+		| ((unsigned long) p [3] << 24);
+}
+
+static int isBinaryTagFile (tagFile *const file)
+{
+	char magic [BINARY_MAGIC_SIZE];
+
+	if (file->size < BINARY_HEADER_SIZE)
+		return 0;
+	if (file->map.addr)
+		return memcmp (file->map.addr, BINARY_MAGIC, BINARY_MAGIC_SIZE) == 0;
+
+	if (fread (magic, 1, BINARY_MAGIC_SIZE, file->fp) != BINARY_MAGIC_SIZE)
+		clearerr (file->fp);
+	else if (memcmp (magic, BINARY_MAGIC, BINARY_MAGIC_SIZE) == 0)
+		return 1;
+	readtags_fseek (file->fp, 0, SEEK_SET);
+	return 0;
+}
+
+/* Return the string at `offset' of the string table, or NULL if the
+ * offset is broken. */
+static const char *binaryString (tagFile *const file, unsigned long offset)
+{
+	if (offset >= file->binary.stringSize)
+		return NULL;
+	return file->binary.strings + offset;
+}
+
+static const char *binaryName (tagFile *const file, unsigned long index)
+{
+	const char *name = binaryString (file,
+		readNumber (file->binary.records + index * BINARY_RECORD_SIZE));
+	return name? name: EmptyString;
+}
+
+static tagResult readBinaryRecord (tagFile *const file, unsigned long index,
+								   tagEntry *const entry)
+{
+	const unsigned char *r = file->binary.records + index * BINARY_RECORD_SIZE;
+	const unsigned long kind = readNumber (r + 12);
+	const unsigned long fieldStart = readNumber (r + 16);
+	const unsigned long fieldCount = readNumber (r + 20);
+	unsigned long i;
+
+	if (entry == NULL)
+		return TagSuccess;
+
+	memset (entry, 0, sizeof (*entry));
+	entry->name = binaryString (file, readNumber (r));
+	entry->file = binaryString (file, readNumber (r + 4));
+	entry->address.pattern = binaryString (file, readNumber (r + 8));
+	if (kind != BINARY_NO_STRING)
+	{
+		entry->kind = binaryString (file, kind);
+		if (entry->kind == NULL)
+			goto format_error;
+	}
+	entry->fileScope = (readNumber (r + 24) & BINARY_FLAG_FILE_SCOPE)? 1: 0;
+	entry->address.lineNumber = readNumber (r + 28);
+	if (entry->name == NULL || entry->file == NULL
+		|| entry->address.pattern == NULL
+		|| fieldStart > file->binary.fieldCount
+		|| fieldCount > file->binary.fieldCount - fieldStart
+		|| fieldCount > 0xffff)
+		goto format_error;
+
+	while (fieldCount > file->fields.max)
+	{
+		if (growFields (file) != TagSuccess)
+		{
+			file->err = ENOMEM;
+			return TagFailure;
+		}
+	}
+	for (i = 0; i < fieldCount; i++)
+	{
+		const unsigned char *f = file->binary.fields
+			+ (fieldStart + i) * BINARY_FIELD_SIZE;
+		file->fields.list [i].key = binaryString (file, readNumber (f));
+		file->fields.list [i].value = binaryString (file, readNumber (f + 4));
+		if (file->fields.list [i].key == NULL
+			|| file->fields.list [i].value == NULL)
+			goto format_error;
+	}
+	entry->fields.count = (unsigned short) fieldCount;
+	if (entry->fields.count > 0)
+		entry->fields.list = file->fields.list;
+	for (i = entry->fields.count  ;  i < file->fields.max  ;  ++i)
+	{
+		file->fields.list [i].key = NULL;
+		file->fields.list [i].value = NULL;
+	}
+	return TagSuccess;
+
+ format_error:
+	file->err = TagErrnoUnexpectedFormat;
+	return TagFailure;
+}
+
+/* Read the record at `next' if it is before `end'. */
+static tagResult readBinaryNext (tagFile *const file, tagEntry *const entry,
+								 unsigned long end)
+{
+	if (file->binary.next >= end)
+		return TagFailure;
+	return readBinaryRecord (file, file->binary.next++, entry);
+}
+
+static tagResult readBinaryPseudoTags (tagFile *const file, tagFileInfo *const info)
+{
+	int err = 0;
+	int tag_output_mode_u_ctags = 0;
+	int tag_output_filesep_slash = 0;
+	unsigned long i;
+
+	initFileInfo (info);
+	for (i = 0; i < file->binary.ptagCount; i++)
+	{
+		tagEntry entry;
+
+		if (readBinaryRecord (file, i, &entry) != TagSuccess)
+		{
+			err = file->err;
+			file->err = 0;
+			break;
+		}
+		err = applyPseudoTag (file, &entry, &tag_output_mode_u_ctags,
+							  &tag_output_filesep_slash);
+		if (err)
+			break;
+	}
+	copyFileInfo (file, info);
+
+	info->status.error_number = err;
+	return err? TagFailure: TagSuccess;
+}
+
+/* Load the whole binary tag file. The file is mapped if possible;
+ * the strings of entries point to the loaded data.
+ */
+static tagResult loadBinaryTagFile (tagFile *const file, tagFileInfo *const info)
+{
+	const unsigned char *h;
+	unsigned long sortMethod;
+	double expected;
+
+#ifdef READTAGS_USE_MMAP
+	if (file->map.addr == NULL)
+		mapTagFile (file);
+#endif
+	if (file->map.addr)
+		file->binary.data = (const unsigned char *) file->map.addr;
+	else
+	{
+		if ((rt_off_t) (size_t) file->size != file->size)
+		{
+			info->status.error_number = TagErrnoFileMaybeTooBig;
+			return TagFailure;
+		}
+		file->binary.buffer = malloc ((size_t) file->size);
+		if (file->binary.buffer == NULL)
+		{
+			info->status.error_number = ENOMEM;
+			return TagFailure;
+		}
+		if (readtags_fseek (file->fp, 0, SEEK_SET) == -1
+			|| fread (file->binary.buffer, 1, (size_t) file->size, file->fp)
+			!= (size_t) file->size)
+		{
+			info->status.error_number = errno? errno: TagErrnoUnexpectedFormat;
+			return TagFailure;
+		}
+		file->binary.data = file->binary.buffer;
+	}
+
+	h = file->binary.data + BINARY_MAGIC_SIZE;
+	sortMethod = readNumber (h);
+	file->binary.ptagCount = readNumber (h + 4);
+	file->binary.tagCount = readNumber (h + 8);
+	file->binary.fieldCount = readNumber (h + 12);
+	file->binary.stringSize = readNumber (h + 16);
+
+	/* Computed in double not to overflow. */
+	expected = (double) BINARY_HEADER_SIZE
+		+ ((double) file->binary.ptagCount + (double) file->binary.tagCount) * BINARY_RECORD_SIZE
+		+ (double) file->binary.fieldCount * BINARY_FIELD_SIZE
+		+ (double) file->binary.stringSize;
+	if (sortMethod > TAG_FOLDSORTED || expected != (double) file->size
+		|| (file->binary.stringSize > 0
+			&& file->binary.data [file->size - 1] != '\0'))
+	{
+		info->status.error_number = TagErrnoUnexpectedFormat;
+		return TagFailure;
+	}
+
+	file->binary.records = file->binary.data + BINARY_HEADER_SIZE;
+	file->binary.fields = file->binary.records
+		+ (file->binary.ptagCount + file->binary.tagCount) * BINARY_RECORD_SIZE;
+	file->binary.strings = (const char *) (file->binary.fields
+		+ file->binary.fieldCount * BINARY_FIELD_SIZE);
+	file->binary.next = file->binary.ptagCount;
+	file->format = 2;
+	file->sortMethod = (tagSortType) sortMethod;
+
+	return readBinaryPseudoTags (file, info);
+}
+
+static unsigned long binaryEnd (tagFile *const file)
+{
+	return file->binary.ptagCount + file->binary.tagCount;
+}
+
+/*
+ * Compressed tag file
+ */
+
+static int isCompressedTagFile (tagFile *const file)
+{
+	char magic [COMPRESSED_MAGIC_SIZE];
+	int r = 0;
+
+	if (file->size < (rt_off_t) COMPRESSED_HEADER_SIZE)
+		return 0;
+	if (file->map.addr)
+		return memcmp (file->map.addr, COMPRESSED_MAGIC, COMPRESSED_MAGIC_SIZE) == 0;
+
+	if (fread (magic, 1, COMPRESSED_MAGIC_SIZE, file->fp) != COMPRESSED_MAGIC_SIZE)
+		clearerr (file->fp);
+	else
+		r = (memcmp (magic, COMPRESSED_MAGIC, COMPRESSED_MAGIC_SIZE) == 0);
+	readtags_fseek (file->fp, 0, SEEK_SET);
+	return r;
+}
+
+#ifdef READTAGS_USE_ZLIB
+static rt_off_t readOffset (const unsigned char *p)
+{
+	return (rt_off_t) readNumber (p)
+		| (rt_off_t) ((unsigned long long) readNumber (p + 4) << 32);
+}
+
+/* Read the compressed block `b' into `input'. Return 0 on success. */
+static int readCompressedBlock (tagFile *const file, const compressedBlock *const b)
+{
+#ifdef READTAGS_USE_PREAD
+	if (file->cursor.owner)
+		return preadTagFile (file, file->compressed.input, (size_t) b->size,
+							 b->offset);
+#endif
+	if (readtags_fseek (file->fp, b->offset, SEEK_SET) == -1
+		|| fread (file->compressed.input, 1, (size_t) b->size, file->fp) != b->size)
+	{
+		clearerr (file->fp);
+		return -1;
+	}
+	return 0;
+}
+
+/* Decompress the block holding `pos' if it is not decompressed yet.
+ * Return the data at `pos', and store the length of the rest of the
+ * block to `length'. Return NULL with errno set on failure.
+ */
+static const char *compressedDataAt (tagFile *const file, rt_off_t pos,
+									 size_t *length)
+{
+	unsigned long lower = 0;
+	unsigned long upper = file->compressed.count;
+	const compressedBlock *b;
+	uLongf decompressed;
+
+	if (pos < 0 || pos >= file->size)
+	{
+		errno = EINVAL;
+		return NULL;
+	}
+
+	/* Find the last block starting at or before `pos'. */
+	while (upper - lower > 1)
+	{
+		const unsigned long mid = lower + (upper - lower) / 2;
+		if (file->compressed.blocks [mid].start <= pos)
+			lower = mid;
+		else
+			upper = mid;
+	}
+	b = file->compressed.blocks + lower;
+
+	if (file->compressed.current != lower)
+	{
+		file->compressed.current = file->compressed.count;
+		decompressed = (uLongf) b->length;
+		if (readCompressedBlock (file, b) < 0
+			|| uncompress ((Bytef *) file->compressed.data, &decompressed,
+						   file->compressed.input, (uLong) b->size) != Z_OK
+			|| decompressed != (uLongf) b->length)
+		{
+			errno = TagErrnoUnexpectedFormat;
+			return NULL;
+		}
+		file->compressed.current = lower;
+	}
+
+	*length = (size_t) (b->start + (rt_off_t) b->length - pos);
+	return file->compressed.data + (pos - b->start);
+}
+
+/* Read the block index and the names of a compressed tag file, and make
+ * the name index from them. The blocks are decompressed on demand. The
+ * mapping is not used for the file.
+ */
+static tagResult loadCompressedTagFile (tagFile *const file, tagFileInfo *const info)
+{
+	unsigned char header [COMPRESSED_HEADER_SIZE - COMPRESSED_MAGIC_SIZE];
+	unsigned char *index = NULL;
+	unsigned long count, i;
+	unsigned long maxSize = 0, maxLength = 0;
+	rt_off_t indexOffset, namesSize, total = 0;
+	size_t indexSize;
+
+#ifdef READTAGS_USE_MMAP
+	unmapTagFile (file);
+#endif
+
+	if (readtags_fseek (file->fp, (rt_off_t) COMPRESSED_MAGIC_SIZE, SEEK_SET) == -1
+		|| fread (header, 1, sizeof (header), file->fp) != sizeof (header))
+		goto format_error;
+
+	count = readNumber (header + 4);
+	indexOffset = readOffset (header + 8);
+	indexSize = (size_t) count * COMPRESSED_INDEX_SIZE;
+	if (readNumber (header) > TAG_FOLDSORTED || count == 0
+		|| indexSize / COMPRESSED_INDEX_SIZE != count
+		|| indexOffset < (rt_off_t) COMPRESSED_HEADER_SIZE
+		|| indexOffset > file->size
+		|| (rt_off_t) indexSize > file->size - indexOffset)
+		goto format_error;
+	namesSize = file->size - indexOffset - (rt_off_t) indexSize;
+
+	index = malloc (indexSize + (size_t) namesSize + 1);
+	file->compressed.blocks = calloc (count, sizeof (compressedBlock));
+	file->index.offsets = malloc (count * sizeof (rt_off_t));
+	file->index.names = malloc (count * sizeof (char *));
+	if (index == NULL || file->compressed.blocks == NULL
+		|| file->index.offsets == NULL || file->index.names == NULL)
+	{
+		info->status.error_number = ENOMEM;
+		goto error;
+	}
+	if (readtags_fseek (file->fp, indexOffset, SEEK_SET) == -1
+		|| fread (index, 1, indexSize + (size_t) namesSize, file->fp)
+		!= indexSize + (size_t) namesSize)
+		goto format_error;
+	index [indexSize + (size_t) namesSize] = '\0';
+	file->compressed.names = (char *) index + indexSize;
+	file->compressed.count = count;
+
+	for (i = 0; i < count; i++)
+	{
+		const unsigned char *e = index + i * COMPRESSED_INDEX_SIZE;
+		compressedBlock *b = file->compressed.blocks + i;
+		const unsigned long name = readNumber (e + 16);
+
+		b->start = total;
+		b->offset = readOffset (e);
+		b->size = readNumber (e + 8);
+		b->length = readNumber (e + 12);
+		if (b->offset < (rt_off_t) COMPRESSED_HEADER_SIZE
+			|| b->offset > indexOffset
+			|| (rt_off_t) b->size > indexOffset - b->offset
+			|| b->length == 0 || (rt_off_t) name >= namesSize)
+			goto format_error;
+		total += (rt_off_t) b->length;
+		if (b->size > maxSize)
+			maxSize = b->size;
+		if (b->length > maxLength)
+			maxLength = b->length;
+
+		/* Each block starts at a line; this is a name index made without
+		 * a sidecar file. */
+		file->index.offsets [i] = b->start;
+		file->index.names [i] = file->compressed.names + name;
+	}
+	file->index.count = count;
+	if (total != readOffset (header + 16))
+		goto format_error;
+
+	file->compressed.input = malloc (maxSize? maxSize: 1);
+	file->compressed.data = malloc (maxLength);
+	if (file->compressed.input == NULL || file->compressed.data == NULL)
+	{
+		info->status.error_number = ENOMEM;
+		goto error;
+	}
+	file->compressed.current = count;
+	file->compressed.pos = 0;
+	file->compressed.inputSize = maxSize? maxSize: 1;
+	file->compressed.dataSize = maxLength;
+	file->size = total;
+	return TagSuccess;
+
+ format_error:
+	info->status.error_number = TagErrnoUnexpectedFormat;
+ error:
+	if (file->compressed.names == NULL)
+		free (index);
+	return TagFailure;
+}
+#endif
+
+static void unloadCompressedTagFile (tagFile *const file)
+{
+	/* The names are in the buffer holding the block index. */
+	if (file->compressed.names)
+		free (file->compressed.names - file->compressed.count * COMPRESSED_INDEX_SIZE);
+	free (file->compressed.blocks);
+	free (file->compressed.input);
+	free (file->compressed.data);
+	memset (&file->compressed, 0, sizeof (file->compressed));
+}
+
+static tagFile *initialize (const char *const filePath, FILE *stream,
+							tagFileInfo *const info, int mapped)
+{
+	tagFile *result = (tagFile*) calloc ((size_t) 1, sizeof (tagFile));
+
+	if (result == NULL)
+	{
+		info->status.opened = 0;
+		info->status.error_number = ENOMEM;
+		return NULL;
+	}
+
+	if (growString (&result->line) != TagSuccess)
+		goto mem_error;
+	if (growString (&result->name) != TagSuccess)
+		goto mem_error;
+	result->fields.max = 20;
+	result->fields.list = (tagExtensionField*) calloc (
+		result->fields.max, sizeof (tagExtensionField));
+	if (result->fields.list == NULL)
+		goto mem_error;
+
+	if (stream)
+	{
+		/* The size is unknown, so nothing is looked up by position. */
+		result->fp = stream;
+		result->stream.on = 1;
+		if (readPseudoTags (result, info) == TagFailure)
+			goto file_error;
+		info->status.opened = 1;
+		result->initialized = 1;
+		return result;
+	}
+
+#if defined(__GLIBC__) && (__GLIBC__ >= 2) \
+	&& defined(__GLIBC_MINOR__) && (__GLIBC_MINOR__ >= 3)
+	result->fp = fopen (filePath, "rbm");
+#endif
+	if (result->fp == NULL)
+	{
+		errno = 0;
+		result->fp = fopen (filePath, "rb");
+	}
+	if (result->fp == NULL)
+	{
+		info->status.error_number = errno;
+		goto file_error;
+	}
+
+	/* Record the size of the tags file to `size` field of result. */
+	if (readtags_fseek (result->fp, 0, SEEK_END) == -1)
+	{
+		info->status.error_number = errno;
+		goto file_error;
+	}
+	result->size = readtags_ftell (result->fp);
+	if (result->size == -1)
+	{
+		/* fseek() retruns an int value.
+		 * We observed following behavior on Windows;
+		 * if sizeof(int) of the platform is too small for
+		 * representing the size of the tags file, fseek()
+		 * returns -1 and it doesn't set errno.
+		 */
+		info->status.error_number = errno;
+		if (info->status.error_number == 0)
+			info->status.error_number = TagErrnoFileMaybeTooBig;
+
+		goto file_error;
+	}
+	if (readtags_fseek(result->fp, 0, SEEK_SET) == -1)
+	{
+		info->status.error_number = errno;
+		goto file_error;
+	}
+
+#ifdef READTAGS_USE_MMAP
+	if (mapped)
+		mapTagFile (result);
+#else
+	(void) mapped;
+#endif
+
+	if (isBinaryTagFile (result))
+	{
+		if (loadBinaryTagFile (result, info) == TagFailure)
+			goto file_error;
+	}
+	else if (isCompressedTagFile (result))
+	{
+#ifdef READTAGS_USE_ZLIB
+		if (loadCompressedTagFile (result, info) == TagFailure
+			|| readPseudoTags (result, info) == TagFailure)
+			goto file_error;
+#else
+		info->status.error_number = TagErrnoUnexpectedFormat;
+		goto file_error;
+#endif
+	}
+	else
+	{
+		if (readPseudoTags (result, info) == TagFailure)
+			goto file_error;
+
+		loadNameIndex (result, filePath);
+		locateTrigramIndex (result, filePath);
+		locateSecondaryIndex (result, filePath);
+	}
+
+	info->status.opened = 1;
+	result->initialized = 1;
+
+	return result;
+ mem_error:
+	info->status.error_number = ENOMEM;
+ file_error:
+#ifdef READTAGS_USE_MMAP
+	unmapTagFile (result);
+#endif
+	free (result->line.buffer);
+	free (result->name.buffer);
+	free (result->fields.list);
+	free (result->binary.buffer);
+	unloadCompressedTagFile (result);
+	unloadNameIndex (result);
+	unloadTrigramIndex (result);
+	free (result->trigrams.path);
+	unloadSecondaryIndex (result);
+	free (result->secondary.path);
+	unloadInputFileIds (result);
+	if (result->fp && !result->stream.on)
+		fclose (result->fp);
+	free (result);
+	info->status.opened = 0;
+	return NULL;
+}
+
+/* Free the state of a cursor. The rest is owned by `cursor.owner'. */
+static void closeCursor (tagFile *const file)
+{
+	free (file->line.buffer);
+	free (file->name.buffer);
+	free (file->fields.list);
+	free (file->search.name);
+	free (file->trigrams.candidates);
+	free (file->compressed.input);
+	free (file->compressed.data);
+	free (file->cursor.buffer);
+	memset (file, 0, sizeof (tagFile));
+	free (file);
+}
+
+static tagFile *openCursor (tagFile *const file, tagFileInfo *const info)
+{
+	tagFile *result;
+
+	info->status.opened = 0;
+	info->status.error_number = 0;
+	if (file == NULL || ! file->initialized
+		|| file->stream.on || file->cursor.owner)
+	{
+		info->status.error_number = TagErrnoInvalidArgument;
+		return NULL;
+	}
+#ifndef READTAGS_USE_PREAD
+	if (file->binary.data == NULL)
+	{
+		info->status.error_number = ENOSYS;
+		return NULL;
+	}
+#endif
+
+	/* Load the indexes now so that the cursors share them, and
+	 * nothing changes `file' after this. */
+	if (file->binary.data == NULL && file->compressed.blocks == NULL)
+	{
+		loadTrigramIndex (file);
+		loadSecondaryIndex (file);
+	}
+
+	result = malloc (sizeof (tagFile));
+	if (result == NULL)
+	{
+		info->status.error_number = ENOMEM;
+		return NULL;
+	}
+	*result = *file;
+
+	/* Everything the reading functions change belongs to the cursor. */
+	memset (&result->line, 0, sizeof (result->line));
+	memset (&result->name, 0, sizeof (result->name));
+	memset (&result->search, 0, sizeof (result->search));
+	memset (&result->part, 0, sizeof (result->part));
+	result->fp = NULL;
+	result->pos = 0;
+	result->err = 0;
+	result->map.pos = 0;
+	result->fields.list = NULL;
+	result->trigrams.on = 0;
+	result->trigrams.atHead = 0;
+	result->trigrams.candidates = NULL;
+	result->trigrams.candidateCount = 0;
+	result->trigrams.current = 0;
+	result->secondary.on = 0;
+	result->secondary.posting = NULL;
+	result->secondary.offset = 0;
+	result->binary.buffer = NULL;
+	result->binary.next = 0;
+	result->compressed.input = NULL;
+	result->compressed.data = NULL;
+	result->compressed.current = file->compressed.count;
+	result->compressed.pos = 0;
+	result->cursor.owner = file;
+	result->cursor.buffer = NULL;
+	result->cursor.size = 0;
+	result->cursor.start = 0;
+	result->cursor.length = 0;
+	result->cursor.pos = 0;
+
+	if (growString (&result->line) != TagSuccess
+		|| growString (&result->name) != TagSuccess)
 		goto mem_error;
 	result->fields.max = 20;
 	result->fields.list = (tagExtensionField*) calloc (
@@ -874,75 +2918,66 @@ static tagFile *initialize (const char *const filePath, tagFileInfo *const info)
 	if (result->fields.list == NULL)
 		goto mem_error;
 
-#if defined(__GLIBC__) && (__GLIBC__ >= 2) \
-	&& defined(__GLIBC_MINOR__) && (__GLIBC_MINOR__ >= 3)
-	result->fp = fopen (filePath, "rbm");
-#endif
-	if (result->fp == NULL)
-	{
-		errno = 0;
-		result->fp = fopen (filePath, "rb");
-	}
-	if (result->fp == NULL)
-	{
-		info->status.error_number = errno;
-		goto file_error;
-	}
-
-	/* Record the size of the tags file to `size` field of result. */
-	if (readtags_fseek (result->fp, 0, SEEK_END) == -1)
+#ifdef READTAGS_USE_PREAD
+	if (file->binary.data == NULL)
 	{
-		info->status.error_number = errno;
-		goto file_error;
+		result->cursor.fd = fileno (file->fp);
+		if (file->compressed.blocks)
+		{
+			result->compressed.input = malloc (file->compressed.inputSize);
+			result->compressed.data = malloc (file->compressed.dataSize);
+			if (result->compressed.input == NULL || result->compressed.data == NULL)
+				goto mem_error;
+		}
+		else if (file->map.addr == NULL)
+		{
+			result->cursor.buffer = malloc (CURSOR_BUFFER_SIZE);
+			if (result->cursor.buffer == NULL)
+				goto mem_error;
+			result->cursor.size = CURSOR_BUFFER_SIZE;
+		}
 	}
-	result->size = readtags_ftell (result->fp);
-	if (result->size == -1)
-	{
-		/* fseek() retruns an int value.
-		 * We observed following behavior on Windows;
-		 * if sizeof(int) of the platform is too small for
-		 * representing the size of the tags file, fseek()
-		 * returns -1 and it doesn't set errno.
-		 */
-		info->status.error_number = errno;
-		if (info->status.error_number == 0)
-			info->status.error_number = TagErrnoFileMaybeTooBig;
+#endif
 
-		goto file_error;
-	}
-	if (readtags_fseek(result->fp, 0, SEEK_SET) == -1)
+	if (gotoFirstLogicalTag (result) != TagSuccess)
 	{
-		info->status.error_number = errno;
-		goto file_error;
+		info->status.error_number = result->err;
+		closeCursor (result);
+		return NULL;
 	}
 
-	if (readPseudoTags (result, info) == TagFailure)
-		goto file_error;
-
+	copyFileInfo (result, info);
 	info->status.opened = 1;
-	result->initialized = 1;
-
 	return result;
+
  mem_error:
 	info->status.error_number = ENOMEM;
- file_error:
-	free (result->line.buffer);
-	free (result->name.buffer);
-	free (result->fields.list);
-	if (result->fp)
-		fclose (result->fp);
-	free (result);
-	info->status.opened = 0;
+	closeCursor (result);
 	return NULL;
 }
 
 static void terminate (tagFile *const file)
 {
-	fclose (file->fp);
+	if (file->cursor.owner)
+	{
+		closeCursor (file);
+		return;
+	}
+
+#ifdef READTAGS_USE_MMAP
+	unmapTagFile (file);
+#endif
+	if (! file->stream.on)
+		fclose (file->fp);
 
 	free (file->line.buffer);
 	free (file->name.buffer);
 	free (file->fields.list);
+	free (file->binary.buffer);
+	free (file->stream.record);
+	free (file->stream.strings);
+	free (file->stream.offsets);
+	unloadCompressedTagFile (file);
 
 	if (file->program.author != NULL)
 		free (file->program.author);
@@ -955,6 +2990,13 @@ static void terminate (tagFile *const file)
 	if (file->search.name != NULL)
 		free (file->search.name);
 
+	unloadNameIndex (file);
+	unloadTrigramIndex (file);
+	free (file->trigrams.path);
+	unloadSecondaryIndex (file);
+	free (file->secondary.path);
+	unloadInputFileIds (file);
+
 	memset (file, 0, sizeof (tagFile));
 
 	free (file);
@@ -973,6 +3015,18 @@ static tagResult readNext (tagFile *const file, tagEntry *const entry)
 		return TagFailure;
 	}
 
+	if (file->binary.data)
+		return readBinaryNext (file, entry, binaryEnd (file));
+
+	if (file->stream.records)
+	{
+		if (! readStreamEntry (file, &file->err))
+			return TagFailure;
+		return (entry != NULL)
+			? parseStreamRecord (file, entry, &file->err)
+			: TagSuccess;
+	}
+
 	if (! readTagLine (file, &file->err))
 		return TagFailure;
 
@@ -983,6 +3037,34 @@ static tagResult readNext (tagFile *const file, tagEntry *const entry)
 	return result;
 }
 
+/* Return the offset dividing the tag file into `parts' parts at the
+ * beginning of `part'. */
+static rt_off_t partBoundary (rt_off_t size, unsigned int part,
+							  unsigned int parts)
+{
+	if (part >= parts)
+		return size;
+	return (size / parts) * part + (size % parts) * part / parts;
+}
+
+static tagResult readNextInPart (tagFile *const file, tagEntry *const entry)
+{
+	if (file->binary.data)
+		return readBinaryNext (file, entry, (unsigned long) file->part.end);
+
+	if (! readTagLine (file, &file->err))
+		return TagFailure;
+
+	/* readTagLine skips empty lines; the line read may start after
+	 * the end of the part even if the previous one ended before. */
+	if (file->pos >= file->part.end)
+		return TagFailure;
+
+	return (entry != NULL)
+		? parseTagLine (file, entry, &file->err)
+		: TagSuccess;
+}
+
 static const char *readFieldValue (
 	const tagEntry *const entry, const char *const key)
 {
@@ -1000,7 +3082,7 @@ static const char *readFieldValue (
 
 static int readTagLineSeek (tagFile *const file, const rt_off_t pos)
 {
-	if (readtags_fseek (file->fp, pos, SEEK_SET) < 0)
+	if (seekTagFile (file, pos, SEEK_SET) < 0)
 	{
 		file->err = errno;
 		return 0;
@@ -1017,28 +3099,124 @@ static int readTagLineSeek (tagFile *const file, const rt_off_t pos)
 	return 1;
 }
 
-static int nameComparison (tagFile *const file)
+/* Return 1 if `name', escaped as in the tag file, contains the searched
+ * name. The names of pseudo tags contain nothing.
+ */
+static int nameContains (tagFile *const file, const char *name)
+{
+	if (strncmp (name, PseudoTagPrefix, PseudoTagPrefixLength) == 0)
+		return 0;
+
+	while (1)
+	{
+		const char *s = name;
+		const unsigned char *n = (const unsigned char *) file->search.name;
+
+		while (*n != '\0' && *s != '\0')
+		{
+			const int c = readTagCharacter (&s);
+			if (file->search.ignorecase
+				? toupper (c) != toupper (*n)
+				: c != *n)
+				break;
+			n++;
+		}
+		if (*n == '\0')
+			return 1;
+		if (*name == '\0')
+			return 0;
+		readTagCharacter (&name);
+	}
+}
+
+static int nameComparisonWith (tagFile *const file, const char *const name)
 {
 	int result;
-	if (file->search.ignorecase)
+	if (file->search.substring)
+		result = nameContains (file, name)? 0: 1;
+	else if (file->search.ignorecase)
 	{
 		if (file->search.partial)
-			result = tagnuppercmp (file->search.name, file->name.buffer,
+			result = tagnuppercmp (file->search.name, name,
 					file->search.nameLength);
 		else
-			result = taguppercmp (file->search.name, file->name.buffer);
+			result = taguppercmp (file->search.name, name);
 	}
 	else
 	{
 		if (file->search.partial)
-			result = tagncmp (file->search.name, file->name.buffer,
+			result = tagncmp (file->search.name, name,
 					file->search.nameLength);
 		else
-			result = tagcmp (file->search.name, file->name.buffer);
+			result = tagcmp (file->search.name, name);
 	}
 	return result;
 }
 
+static int nameComparison (tagFile *const file)
+{
+	return nameComparisonWith (file, file->name.buffer);
+}
+
+static int binaryNameMatches (tagFile *const file, unsigned long index)
+{
+	return nameComparisonWith (file, binaryName (file, index)) == 0;
+}
+
+static int isSearchSorted (tagFile *const file)
+{
+	if (file->search.substring)
+		return 0;
+	return (file->sortMethod == TAG_SORTED      && !file->search.ignorecase) ||
+		(file->sortMethod == TAG_FOLDSORTED  &&  file->search.ignorecase);
+}
+
+static tagResult findInBinary (tagFile *const file, tagEntry *const entry)
+{
+	unsigned long lower = file->binary.ptagCount;
+	unsigned long upper = binaryEnd (file);
+
+	if (isSearchSorted (file))
+	{
+		while (lower < upper)
+		{
+			const unsigned long mid = lower + (upper - lower) / 2;
+			if (nameComparisonWith (file, binaryName (file, mid)) > 0)
+				lower = mid + 1;
+			else
+				upper = mid;
+		}
+	}
+	else
+	{
+		while (lower < upper && !binaryNameMatches (file, lower))
+			lower++;
+	}
+
+	if (lower < binaryEnd (file) && binaryNameMatches (file, lower))
+	{
+		file->binary.next = lower + 1;
+		return readBinaryRecord (file, lower, entry);
+	}
+	file->binary.next = binaryEnd (file);
+	return TagFailure;
+}
+
+static tagResult findNextInBinary (tagFile *const file, tagEntry *const entry)
+{
+	const unsigned long end = binaryEnd (file);
+
+	if (!isSearchSorted (file))
+	{
+		while (file->binary.next < end
+			   && !binaryNameMatches (file, file->binary.next))
+			file->binary.next++;
+	}
+	if (file->binary.next < end && binaryNameMatches (file, file->binary.next))
+		return readBinaryRecord (file, file->binary.next++, entry);
+	return TagFailure;
+}
+
 static tagResult findFirstNonMatchBefore (tagFile *const file)
 {
 #define JUMP_BACK 512
@@ -1078,6 +3256,64 @@ static tagResult findFirstMatchBefore (tagFile *const file)
 	return result;
 }
 
+/* Look the searched name up with the name index. The index is bisected
+ * in memory for the last entry sorting before the name, and the tag file
+ * is read forward from the line of the entry. The line is verified to be
+ * the one recorded in the index; as the tag file is sorted, no line
+ * before it can match. Return 1 and set `result' if the index decided
+ * the result. Return 0 if the index cannot be used for the name.
+ */
+static int findIndexed (tagFile *const file, tagResult *const result)
+{
+	size_t lower = 0;
+	size_t upper = file->index.count;
+	size_t i;
+	rt_off_t pos;
+	int more_lines;
+
+	while (lower < upper)
+	{
+		const size_t mid = lower + (upper - lower) / 2;
+		if (nameComparisonWith (file, file->index.names [mid]) > 0)
+			lower = mid + 1;
+		else
+			upper = mid;
+	}
+	if (lower == 0)
+		return 0;
+	i = lower - 1;
+	pos = file->index.offsets [i];
+
+	/* The entry must point to the head of the recorded line. The
+	 * entries made from the blocks of a compressed tag file do. */
+	if (pos >= file->size
+		|| (file->compressed.blocks == NULL && readCharAt (file, pos - 1) != '\n')
+		|| seekTagFile (file, pos, SEEK_SET) < 0)
+		return 0;
+	if (! readTagLine (file, &file->err))
+	{
+		file->err = 0;
+		return 0;
+	}
+	if (file->pos != pos || strcmp (file->name.buffer, file->index.names [i]) != 0)
+		return 0;
+
+	*result = TagFailure;
+	do
+	{
+		const int comp = nameComparison (file);
+		if (comp == 0)
+		{
+			*result = TagSuccess;
+			break;
+		}
+		else if (comp < 0)
+			break;
+		more_lines = readTagLine (file, &file->err);
+	} while (more_lines);
+	return 1;
+}
+
 static tagResult findBinary (tagFile *const file)
 {
 	tagResult result = TagFailure;
@@ -1085,6 +3321,10 @@ static tagResult findBinary (tagFile *const file)
 	rt_off_t upper_limit = file->size;
 	rt_off_t last_pos = 0;
 	rt_off_t pos = upper_limit / 2;
+
+	if (file->index.count > 0 && findIndexed (file, &result))
+		return result;
+
 	while (result != TagSuccess)
 	{
 		if (! readTagLineSeek (file, pos))
@@ -1118,53 +3358,406 @@ static tagResult findBinary (tagFile *const file)
 				result = TagSuccess;
 			else
 			{
-				result = findFirstMatchBefore (file);
-				if (result != TagSuccess && file->err)
-					break;
+				result = findFirstMatchBefore (file);
+				if (result != TagSuccess && file->err)
+					break;
+			}
+		}
+	}
+	return result;
+}
+
+static tagResult findSequentialFull (tagFile *const file,
+									 int (* isAcceptable) (tagFile *const, void *),
+									 void *data)
+{
+	if (file == NULL)
+		return TagFailure;
+
+	if (!file->initialized || file->err)
+	{
+		file->err = TagErrnoInvalidArgument;
+		return TagFailure;
+	}
+
+	tagResult result = TagFailure;
+	while (result == TagFailure)
+	{
+		if (! readTagLine (file, &file->err))
+			break;
+		if (isAcceptable (file, data))
+			result = TagSuccess;
+	}
+	return result;
+}
+
+static int nameAcceptable (tagFile *const file, void *unused)
+{
+	return (nameComparison (file) == 0);
+}
+
+static tagResult findSequential (tagFile *const file)
+{
+	return findSequentialFull (file, nameAcceptable, NULL);
+}
+
+/* A trigram of the searched name with its posting list */
+typedef struct {
+	const char *list;
+	size_t length;
+} trigramPosting;
+
+static int comparePostingLength (const void *a, const void *b)
+{
+	const trigramPosting *pa = a;
+	const trigramPosting *pb = b;
+
+	return (pa->length > pb->length) - (pa->length < pb->length);
+}
+
+/* Return the posting list of the trigram at `s' folded to lower case, or
+ * NULL if no name has it. */
+static const char *findTrigramPosting (tagFile *const file, const char *const s)
+{
+	char key [TRIGRAM_KEY_LENGTH + 1];
+	size_t lower = 0;
+	size_t upper = file->trigrams.count;
+	int i;
+
+	for (i = 0; i < 3; i++)
+	{
+		unsigned char c = (unsigned char) s [i];
+		if (c >= 'A' && c <= 'Z')
+			c = c - 'A' + 'a';
+		sprintf (key + 2 * i, "%02x", c);
+	}
+
+	while (lower < upper)
+	{
+		const size_t mid = lower + (upper - lower) / 2;
+		const int comp = strncmp (key, file->trigrams.postings [mid],
+								  TRIGRAM_KEY_LENGTH);
+		if (comp == 0)
+			return file->trigrams.postings [mid] + TRIGRAM_KEY_LENGTH + 1;
+		else if (comp > 0)
+			lower = mid + 1;
+		else
+			upper = mid;
+	}
+	return NULL;
+}
+
+/* Read the next block number from a posting list. The first number is
+ * a block, and the others are the differences from the previous one. */
+static int readPosting (const char **const list, size_t *const block)
+{
+	char *end;
+	const unsigned long delta = strtoul (*list, &end, 10);
+
+	if (end == *list)
+		return 0;
+	*block += delta;
+	*list = end;
+	return 1;
+}
+
+/* Choose the blocks of the tag file in which names may contain the
+ * searched name with the trigram index, by intersecting the posting
+ * lists of the trigrams in the name. Return 0 if the index cannot be
+ * used for the name.
+ */
+static int selectTrigramCandidates (tagFile *const file)
+{
+	const char *const name = file->search.name;
+	const size_t count = file->search.nameLength - 2;
+	trigramPosting *postings;
+	const char *p;
+	size_t i, j;
+
+	if (file->search.nameLength < 3)
+		return 0;
+	/* The names are escaped in the tag file, and so are their trigrams
+	 * in the index. */
+	for (i = 0; i < file->search.nameLength; i++)
+	{
+		const unsigned char c = (unsigned char) name [i];
+		if (c == '\\' || c < 0x20 || c == 0x7f)
+			return 0;
+	}
+	if (! loadTrigramIndex (file))
+		return 0;
+
+	postings = malloc (count * sizeof (trigramPosting));
+	if (postings == NULL)
+		return 0;
+	file->trigrams.on = 1;
+	file->trigrams.atHead = 1;
+	for (i = 0; i < count; i++)
+	{
+		postings [i].list = findTrigramPosting (file, name + i);
+		if (postings [i].list == NULL)
+		{
+			/* No name contains the searched name. */
+			free (postings);
+			return 1;
+		}
+		postings [i].length = strlen (postings [i].list);
+	}
+	qsort (postings, count, sizeof (trigramPosting), comparePostingLength);
+
+	/* The shortest list has the fewest blocks. */
+	for (i = 1, p = postings [0].list; *p != '\0'; p++)
+		if (*p == ' ')
+			i++;
+	file->trigrams.candidates = malloc (i * sizeof (size_t));
+	if (file->trigrams.candidates == NULL)
+	{
+		free (postings);
+		file->trigrams.on = 0;
+		return 0;
+	}
+	{
+		size_t block = 0;
+
+		p = postings [0].list;
+		while (readPosting (&p, &block))
+			file->trigrams.candidates [file->trigrams.candidateCount++] = block;
+	}
+
+	for (i = 1; i < count && file->trigrams.candidateCount > 0; i++)
+	{
+		size_t block = 0;
+		size_t kept = 0;
+		int more;
+
+		p = postings [i].list;
+		more = readPosting (&p, &block);
+		for (j = 0; j < file->trigrams.candidateCount && more; j++)
+		{
+			const size_t candidate = file->trigrams.candidates [j];
+
+			while (more && block < candidate)
+				more = readPosting (&p, &block);
+			if (more && block == candidate)
+				file->trigrams.candidates [kept++] = candidate;
+		}
+		file->trigrams.candidateCount = kept;
+	}
+	free (postings);
+	return 1;
+}
+
+/* Find the next tag containing the searched name in the candidate blocks
+ * chosen with the trigram index. */
+static tagResult findInTrigramCandidates (tagFile *const file)
+{
+	while (file->trigrams.current < file->trigrams.candidateCount)
+	{
+		const size_t block = file->trigrams.candidates [file->trigrams.current];
+		const rt_off_t end = (block + 1 < file->trigrams.blockCount)
+			? file->trigrams.blocks [block + 1]
+			: file->size;
+
+		if (block >= file->trigrams.blockCount)
+			break;
+		if (file->trigrams.atHead)
+		{
+			if (seekTagFile (file, file->trigrams.blocks [block], SEEK_SET) < 0)
+			{
+				file->err = errno;
+				return TagFailure;
 			}
+			file->trigrams.atHead = 0;
+		}
+		if (readTagLine (file, &file->err) && file->pos < end)
+		{
+			if (nameComparison (file) == 0)
+				return TagSuccess;
+			continue;
 		}
+		if (file->err)
+			return TagFailure;
+		file->trigrams.current++;
+		file->trigrams.atHead = 1;
 	}
-	return result;
+	return TagFailure;
 }
 
-static tagResult findSequentialFull (tagFile *const file,
-									 int (* isAcceptable) (tagFile *const, void *),
-									 void *data)
+/* Return the posting list of `key' in `keys' of the secondary index, or
+ * NULL if no tag has it. */
+static const char *findSecondaryPosting (const secondaryKey *const keys,
+										 size_t count, const char *const key)
 {
-	if (file == NULL)
-		return TagFailure;
+	size_t lower = 0;
+	size_t upper = count;
 
-	if (!file->initialized || file->err)
+	while (lower < upper)
 	{
-		file->err = TagErrnoInvalidArgument;
+		const size_t mid = lower + (upper - lower) / 2;
+		const int comp = strcmp (key, keys [mid].key);
+		if (comp == 0)
+			return keys [mid].posting;
+		else if (comp > 0)
+			lower = mid + 1;
+		else
+			upper = mid;
+	}
+	return NULL;
+}
+
+/* Read the tag at the next offset in the posting list of the secondary
+ * index. The first offset is a file position, and the others are the
+ * differences from the previous one. */
+static tagResult findInSecondaryPosting (tagFile *const file, tagEntry *const entry)
+{
+	const char *p = file->secondary.posting;
+	unsigned long long delta;
+	char *end;
+
+	if (p == NULL)
+		return TagFailure;
+	delta = strtoull (p, &end, 10);
+	if (end == p)
+	{
+		file->secondary.posting = NULL;
+		return TagFailure;
+	}
+	file->secondary.posting = end;
+	if (file->secondary.offset < 0)
+		file->secondary.offset = 0;
+	else if (delta == 0)
+		goto failure;
+	if (delta >= (unsigned long long) (file->size - file->secondary.offset))
+		goto failure;
+	file->secondary.offset += (rt_off_t) delta;
+
+	if (seekTagFile (file, file->secondary.offset, SEEK_SET) < 0)
+	{
+		file->err = errno;
 		return TagFailure;
 	}
+	if (! readTagLine (file, &file->err))
+		return TagFailure;
+	return (entry != NULL)
+		? parseTagLine (file, entry, &file->err)
+		: TagSuccess;
 
-	tagResult result = TagFailure;
-	while (result == TagFailure)
+ failure:
+	/* The index does not agree with the tag file. */
+	file->secondary.posting = NULL;
+	file->err = TagErrnoUnexpectedFormat;
+	return TagFailure;
+}
+
+/* The fields of Universal Ctags written after the scope of a tag */
+static const char *const FieldsAfterScope [] = {
+	"access", "end", "epoch", "extras", "implementation", "inherits",
+	"linehash", "nth", "refcount", "reflines", "roles", "scopeKind", "signature",
+	"typeref", "xpath",
+	NULL
+};
+
+static int isFieldAfterScope (const char *const key)
+{
+	int i;
+
+	for (i = 0; FieldsAfterScope [i] != NULL; i++)
+		if (strcmp (key, FieldsAfterScope [i]) == 0)
+			return 1;
+	return 0;
+}
+
+/* Whether the tag is in the input file or the scope searched for. The
+ * scope of a tag is its "scope" field, "scope:<kind>:<name>", or else its
+ * first field other than "language", "<kind>:<name>", unless the field is
+ * one written after the scope. */
+static int keyAcceptable (tagFile *const file, const tagEntry *const entry)
+{
+	const char *const key = file->search.name;
+	const char *const colon = strchr (key, ':');
+	unsigned short i;
+
+	if (file->search.byFile)
+		return strcmp (entry->file, key) == 0;
+
+	for (i = 0; i < entry->fields.count; i++)
 	{
-		if (! readTagLine (file, &file->err))
-			break;
-		if (isAcceptable (file, data))
-			result = TagSuccess;
+		const tagExtensionField *const field = entry->fields.list + i;
+
+		if (strcmp (field->key, "language") == 0)
+			continue;
+		if (strcmp (field->key, "scope") == 0)
+			return strcmp (field->value, key) == 0;
+		if (isFieldAfterScope (field->key))
+			return 0;
+		return colon != NULL
+			&& strlen (field->key) == (size_t) (colon - key)
+			&& strncmp (field->key, key, colon - key) == 0
+			&& strcmp (field->value, colon + 1) == 0;
 	}
-	return result;
+	return 0;
 }
 
-static int nameAcceptable (tagFile *const file, void *unused)
+/* Find the next tag in the input file or the scope searched for by
+ * reading the tags sequentially. */
+static tagResult findSequentialByKey (tagFile *const file, tagEntry *const entry)
 {
-	return (nameComparison (file) == 0);
+	tagEntry local;
+	tagEntry *const e = (entry != NULL)? entry: &local;
+
+	while (readNext (file, e) == TagSuccess)
+	{
+		if (keyAcceptable (file, e))
+			return TagSuccess;
+	}
+	return TagFailure;
 }
 
-static tagResult findSequential (tagFile *const file)
+static tagResult findByKey (tagFile *const file, tagEntry *const entry,
+							const char *const key, int byScope)
 {
-	return findSequentialFull (file, nameAcceptable, NULL);
+	file->part.limited = 0;
+	if (file->search.name != NULL)
+		free (file->search.name);
+	file->search.name = duplicate (key);
+	if (file->search.name == NULL)
+	{
+		file->err = ENOMEM;
+		return TagFailure;
+	}
+	file->search.nameLength = strlen (key);
+	file->search.partial = 0;
+	file->search.ignorecase = 0;
+	file->search.substring = 0;
+	file->search.byFile = ! byScope;
+	file->search.byScope = byScope;
+	resetTrigramSearch (file);
+
+	file->secondary.on = (file->binary.data == NULL
+						  && file->compressed.blocks == NULL
+						  && ! file->stream.on
+						  && loadSecondaryIndex (file));
+	if (file->secondary.on)
+	{
+		file->secondary.posting = byScope
+			? findSecondaryPosting (file->secondary.scopes,
+									file->secondary.scopeCount, key)
+			: findSecondaryPosting (file->secondary.inputs,
+									file->secondary.inputCount, key);
+		file->secondary.offset = -1;
+		return findInSecondaryPosting (file, entry);
+	}
+
+	if (gotoFirstLogicalTag (file) != TagSuccess)
+		return TagFailure;
+	return findSequentialByKey (file, entry);
 }
 
 static tagResult find (tagFile *const file, tagEntry *const entry,
 					   const char *const name, const int options)
 {
 	tagResult result;
+	file->part.limited = 0;
 	if (file->search.name != NULL)
 		free (file->search.name);
 	file->search.name = duplicate (name);
@@ -1174,26 +3767,39 @@ static tagResult find (tagFile *const file, tagEntry *const entry,
 		return TagFailure;
 	}
 	file->search.nameLength = strlen (name);
-	file->search.partial = (options & TAG_PARTIALMATCH) != 0;
+	file->search.substring = (options & TAG_SUBSTRINGMATCH) != 0;
+	file->search.partial = (options & TAG_PARTIALMATCH) != 0
+		&& !file->search.substring;
 	file->search.ignorecase = (options & TAG_IGNORECASE) != 0;
-	if (readtags_fseek (file->fp, 0, SEEK_END) < 0)
+	file->search.byFile = 0;
+	file->search.byScope = 0;
+	file->secondary.on = 0;
+	resetTrigramSearch (file);
+	if (file->binary.data)
+		return findInBinary (file, entry);
+	if (seekTagFile (file, 0, SEEK_END) < 0)
 	{
 		file->err = errno;
 		return TagFailure;
 	}
-	file->size = readtags_ftell (file->fp);
+	file->size = tellTagFile (file);
 	if (file->size == -1)
 	{
 		file->err = errno;
 		return TagFailure;
 	}
-	if (readtags_fseek(file->fp, 0, SEEK_SET) == -1)
+	if (seekTagFile (file, 0, SEEK_SET) == -1)
 	{
 		file->err = errno;
 		return TagFailure;
 	}
-	if ((file->sortMethod == TAG_SORTED      && !file->search.ignorecase) ||
-		(file->sortMethod == TAG_FOLDSORTED  &&  file->search.ignorecase))
+	if (file->search.substring && selectTrigramCandidates (file))
+	{
+		result = findInTrigramCandidates (file);
+		if (result == TagFailure && file->err)
+			return TagFailure;
+	}
+	else if (isSearchSorted (file))
 	{
 		result = findBinary (file);
 		if (result == TagFailure && file->err)
@@ -1241,12 +3847,216 @@ static tagResult findNextFull (tagFile *const file, tagEntry *const entry,
 
 static tagResult findNext (tagFile *const file, tagEntry *const entry)
 {
-	return findNextFull (file, entry,
-						 (file->sortMethod == TAG_SORTED      && !file->search.ignorecase) ||
-						 (file->sortMethod == TAG_FOLDSORTED  &&  file->search.ignorecase),
+	if (file->search.byFile || file->search.byScope)
+		return file->secondary.on
+			? findInSecondaryPosting (file, entry)
+			: findSequentialByKey (file, entry);
+	if (file->binary.data)
+		return findNextInBinary (file, entry);
+	if (file->trigrams.on)
+	{
+		tagResult result = findInTrigramCandidates (file);
+		if (result == TagSuccess && entry != NULL)
+			result = parseTagLine (file, entry, &file->err);
+		return result;
+	}
+	return findNextFull (file, entry, isSearchSorted (file),
 						 nameAcceptable, NULL);
 }
 
+/* Compare two searched names in the order of a sorted (or, when
+ * ignoring case, a foldcase sorted) tag file. */
+typedef struct {
+	const char *name;
+	size_t index;
+} tagQuery;
+
+static int querycmp (const void *a, const void *b)
+{
+	const unsigned char *s1 = (const unsigned char *) ((const tagQuery *) a)->name;
+	const unsigned char *s2 = (const unsigned char *) ((const tagQuery *) b)->name;
+	while (*s1 != '\0'  &&  *s1 == *s2)
+		s1++, s2++;
+	return (int) *s1 - (int) *s2;
+}
+
+static int queryuppercmp (const void *a, const void *b)
+{
+	const unsigned char *s1 = (const unsigned char *) ((const tagQuery *) a)->name;
+	const unsigned char *s2 = (const unsigned char *) ((const tagQuery *) b)->name;
+	while (*s1 != '\0'  &&  toupper (*s1) == toupper (*s2))
+		s1++, s2++;
+	return toupper (*s1) - toupper (*s2);
+}
+
+/* Read the first line at or after `lower' whose name does not sort before
+ * the searched name. The names of all lines before `lower' must sort
+ * before it. The search gallops forward from `lower' with doubling steps
+ * until passing the name, bisects the range found, and reads the last
+ * FIND_MANY_WINDOW bytes sequentially.
+ * Return 1 if such a line is read, 0 at the end of file or on an error.
+ */
+static int findFirstNotBefore (tagFile *const file, rt_off_t lower)
+{
+	rt_off_t upper = file->size;
+	rt_off_t step = FIND_MANY_WINDOW;
+
+	while (lower + step < file->size)
+	{
+		const rt_off_t probe = lower + step;
+		if (! readTagLineSeek (file, probe))
+		{
+			if (file->err)
+				return 0;
+			upper = probe;
+			break;
+		}
+		else if (nameComparison (file) > 0)
+		{
+			lower = file->pos;
+			step *= 2;
+		}
+		else
+		{
+			upper = probe;
+			break;
+		}
+	}
+
+	while (upper - lower > FIND_MANY_WINDOW)
+	{
+		const rt_off_t mid = lower + (upper - lower) / 2;
+		if (! readTagLineSeek (file, mid))
+		{
+			if (file->err)
+				return 0;
+			upper = mid;
+		}
+		else if (nameComparison (file) > 0)
+			lower = file->pos;
+		else
+			upper = mid;
+	}
+
+	if (seekTagFile (file, lower, SEEK_SET) < 0)
+	{
+		file->err = errno;
+		return 0;
+	}
+	while (readTagLine (file, &file->err))
+	{
+		if (nameComparison (file) <= 0)
+			return 1;
+	}
+	return 0;
+}
+
+static tagResult findManySorted (tagFile *const file, tagQuery *const queries,
+								 size_t count, tagFindManyCallback callback,
+								 void *userData)
+{
+	tagEntry entry;
+	rt_off_t lower;
+	size_t i;
+	int stopped = 0;
+
+	qsort (queries, count, sizeof (tagQuery),
+		   file->search.ignorecase? queryuppercmp: querycmp);
+
+	if (seekTagFile (file, 0, SEEK_END) < 0
+		|| (file->size = tellTagFile (file)) == -1)
+	{
+		file->err = errno;
+		return TagFailure;
+	}
+	if (gotoFirstLogicalTag (file) != TagSuccess)
+		return TagFailure;
+	lower = tellTagFile (file);
+
+	for (i = 0; i < count && !stopped; i++)
+	{
+		file->search.name = (char *) queries [i].name;
+		file->search.nameLength = strlen (queries [i].name);
+		if (! findFirstNotBefore (file, lower))
+			break;
+
+		/* All lines before the first one not sorting before this name
+		 * sort before the next name, too. */
+		lower = file->pos;
+		while (nameComparison (file) == 0)
+		{
+			if (parseTagLine (file, &entry, &file->err) != TagSuccess)
+				break;
+			if (callback (&entry, queries [i].index, userData))
+			{
+				stopped = 1;
+				break;
+			}
+			if (! readTagLine (file, &file->err))
+				break;
+		}
+		if (file->err)
+			break;
+	}
+	file->search.name = NULL;
+
+	return file->err? TagFailure: TagSuccess;
+}
+
+static tagResult findMany (tagFile *const file, const char *const *const names,
+						   size_t count, const int options,
+						   tagFindManyCallback callback, void *userData)
+{
+	tagQuery *queries;
+	tagEntry entry;
+	tagResult result;
+	size_t i;
+	const int ignorecase = (options & TAG_IGNORECASE) != 0;
+
+	/* The names are looked up one by one in a binary tag file; each
+	 * lookup bisects the records in memory. */
+	if (!file->binary.data && !(options & TAG_SUBSTRINGMATCH) &&
+		((file->sortMethod == TAG_SORTED      && !ignorecase) ||
+		 (file->sortMethod == TAG_FOLDSORTED  &&  ignorecase)))
+	{
+		queries = malloc (count * sizeof (tagQuery));
+		if (queries == NULL && count > 0)
+		{
+			file->err = ENOMEM;
+			return TagFailure;
+		}
+		for (i = 0; i < count; i++)
+		{
+			queries [i].name = names [i];
+			queries [i].index = i;
+		}
+		if (file->search.name != NULL)
+			free (file->search.name);
+		file->search.name = NULL;
+		file->search.partial = (options & TAG_PARTIALMATCH) != 0;
+		file->search.ignorecase = ignorecase;
+		file->search.substring = 0;
+		resetTrigramSearch (file);
+		result = findManySorted (file, queries, count, callback, userData);
+		free (queries);
+		return result;
+	}
+
+	for (i = 0; i < count; i++)
+	{
+		result = find (file, &entry, names [i], options);
+		while (result == TagSuccess)
+		{
+			if (callback (&entry, i, userData))
+				return TagSuccess;
+			result = findNext (file, &entry);
+		}
+		if (file->err)
+			return TagFailure;
+	}
+	return TagSuccess;
+}
+
 static tagResult findPseudoTag (tagFile *const file, int rewindBeforeFinding, tagEntry *const entry)
 {
 	if (file == NULL)
@@ -1258,9 +4068,16 @@ static tagResult findPseudoTag (tagFile *const file, int rewindBeforeFinding, ta
 		return TagFailure;
 	}
 
+	if (file->binary.data)
+	{
+		if (rewindBeforeFinding)
+			file->binary.next = 0;
+		return readBinaryNext (file, entry, file->binary.ptagCount);
+	}
+
 	if (rewindBeforeFinding)
 	{
-		if (readtags_fseek(file->fp, 0, SEEK_SET) == -1)
+		if (seekTagFile (file, 0, SEEK_SET) == -1)
 		{
 			file->err = errno;
 			return TagFailure;
@@ -1280,7 +4097,25 @@ static tagResult findPseudoTag (tagFile *const file, int rewindBeforeFinding, ta
 extern tagFile *tagsOpen (const char *const filePath, tagFileInfo *const info)
 {
 	tagFileInfo infoDummy;
-	return initialize (filePath, info? info: &infoDummy);
+	return initialize (filePath, NULL, info? info: &infoDummy, 0);
+}
+
+extern tagFile *tagsOpenMapped (const char *const filePath, tagFileInfo *const info)
+{
+	tagFileInfo infoDummy;
+	return initialize (filePath, NULL, info? info: &infoDummy, 1);
+}
+
+extern tagFile *tagsOpenStream (FILE *const stream, tagFileInfo *const info)
+{
+	tagFileInfo infoDummy;
+	return initialize (NULL, stream, info? info: &infoDummy, 0);
+}
+
+extern tagFile *tagsOpenCursor (tagFile *const file, tagFileInfo *const info)
+{
+	tagFileInfo infoDummy;
+	return openCursor (file, info? info: &infoDummy);
 }
 
 extern tagResult tagsSetSortType (tagFile *const file, const tagSortType type)
@@ -1318,11 +4153,65 @@ extern tagResult tagsFirst (tagFile *const file, tagEntry *const entry)
 		return TagFailure;
 	}
 
+	file->part.limited = 0;
 	if (gotoFirstLogicalTag (file) != TagSuccess)
 		return TagFailure;
 	return readNext (file, entry);
 }
 
+extern tagResult tagsFirstInPart (tagFile *const file, tagEntry *const entry,
+								   unsigned int part, unsigned int parts)
+{
+	rt_off_t first, begin;
+
+	if (file == NULL)
+		return TagFailure;
+
+	if (!file->initialized || file->err || parts == 0 || part >= parts)
+	{
+		file->err = TagErrnoInvalidArgument;
+		return TagFailure;
+	}
+
+	if (file->stream.on)
+	{
+		file->err = ESPIPE;
+		return TagFailure;
+	}
+
+	if (gotoFirstLogicalTag (file) != TagSuccess)
+		return TagFailure;
+
+	if (file->binary.data)
+	{
+		const unsigned long tags = file->binary.tagCount;
+		file->binary.next += (unsigned long) partBoundary (tags, part, parts);
+		file->part.limited = 1;
+		file->part.end = file->binary.ptagCount
+			+ partBoundary (tags, part + 1, parts);
+		return readNextInPart (file, entry);
+	}
+
+	first = tellTagFile (file);
+	begin = partBoundary (file->size, part, parts);
+	file->part.limited = 1;
+	file->part.end = partBoundary (file->size, part + 1, parts);
+
+	if (begin > first)
+	{
+		/* Skip the line including the byte before `begin'. A line
+		 * starting at `begin' belongs to this part. */
+		if (seekTagFile (file, begin - 1, SEEK_SET) < 0)
+		{
+			file->err = errno;
+			return TagFailure;
+		}
+		if (! readTagLineRaw (file, &file->err))
+			return TagFailure;
+	}
+	return readNextInPart (file, entry);
+}
+
 extern tagResult tagsNext (tagFile *const file, tagEntry *const entry)
 {
 	if (file == NULL)
@@ -1334,6 +4223,8 @@ extern tagResult tagsNext (tagFile *const file, tagEntry *const entry)
 		return TagFailure;
 	}
 
+	if (file->part.limited)
+		return readNextInPart (file, entry);
 	return readNext (file, entry);
 }
 
@@ -1345,6 +4236,42 @@ extern const char *tagsField (const tagEntry *const entry, const char *const key
 	return result;
 }
 
+extern unsigned long tagsLineHash (const char *const line, size_t length)
+{
+	unsigned long h = 2166136261UL;
+	size_t i;
+
+	if (length > 0 && line [length - 1] == '\n')
+		length--;
+	if (length > 0 && line [length - 1] == '\r')
+		length--;
+	if (length > 64)
+		length = 64;
+
+	for (i = 0; i < length; i++)
+	{
+		h ^= (unsigned char) line [i];
+		h = (h * 16777619UL) & 0xffffffffUL;
+	}
+	return h;
+}
+
+extern int tagsMatchLine (const tagEntry *const entry, const char *const line,
+						  size_t length)
+{
+	const char *value = tagsField (entry, "linehash");
+	char *endptr = NULL;
+	unsigned long h;
+
+	if (value == NULL || strlen (value) != 8)
+		return -1;
+	h = strtoul (value, &endptr, 16);
+	if (*endptr != '\0')
+		return -1;
+
+	return (h == tagsLineHash (line, length))? 1: 0;
+}
+
 extern tagResult tagsFind (tagFile *const file, tagEntry *const entry,
 						   const char *const name, const int options)
 {
@@ -1360,12 +4287,29 @@ extern tagResult tagsFind (tagFile *const file, tagEntry *const entry,
 	return find (file, entry, name, options);
 }
 
+extern tagResult tagsFindMany (tagFile *const file, const char *const *const names,
+								size_t count, const int options,
+								tagFindManyCallback callback, void *userData)
+{
+	if (file == NULL)
+		return TagFailure;
+
+	if (!file->initialized || file->err || callback == NULL
+		|| (names == NULL && count > 0))
+	{
+		file->err = TagErrnoInvalidArgument;
+		return TagFailure;
+	}
+
+	return findMany (file, names, count, options, callback, userData);
+}
+
 extern tagResult tagsFindNext (tagFile *const file, tagEntry *const entry)
 {
 	if (file == NULL)
 		return TagFailure;
 
-	if (!file->initialized || file->err)
+	if (!file->initialized || file->err || file->search.name == NULL)
 	{
 		file->err = TagErrnoInvalidArgument;
 		return TagFailure;
@@ -1374,6 +4318,36 @@ extern tagResult tagsFindNext (tagFile *const file, tagEntry *const entry)
 	return findNext (file, entry);
 }
 
+extern tagResult tagsFindByFile (tagFile *const file, tagEntry *const entry,
+								 const char *const path)
+{
+	if (file == NULL)
+		return TagFailure;
+
+	if (!file->initialized || file->err || path == NULL)
+	{
+		file->err = TagErrnoInvalidArgument;
+		return TagFailure;
+	}
+
+	return findByKey (file, entry, path, 0);
+}
+
+extern tagResult tagsFindByScope (tagFile *const file, tagEntry *const entry,
+								  const char *const scope)
+{
+	if (file == NULL)
+		return TagFailure;
+
+	if (!file->initialized || file->err || scope == NULL)
+	{
+		file->err = TagErrnoInvalidArgument;
+		return TagFailure;
+	}
+
+	return findByKey (file, entry, scope, 1);
+}
+
 extern tagResult tagsFirstPseudoTag (tagFile *const file, tagEntry *const entry)
 {
 	return findPseudoTag (file, 1, entry);
@@ -19,6 +19,9 @@
 #ifndef READTAGS_H
 #define READTAGS_H
 
+#include <stddef.h>  /* for size_t */
+#include <stdio.h>  /* for FILE */
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -46,6 +49,9 @@ typedef enum {
 #define TAG_OBSERVECASE   0x0
 #define TAG_IGNORECASE    0x2
 
+/* Options for tagsFind() */
+#define TAG_SUBSTRINGMATCH 0x4
+
 /*
 *  DATA DECLARATIONS
 */
@@ -125,7 +131,9 @@ typedef struct {
 	const char *name;
 
 		/* path of source file containing definition of tag.
-		   For a broken tags file, this can be NULL. */
+		   For a broken tags file, this can be NULL.
+		   An id defined with a !_TAG_INPUT_FILE_ID pseudo tag is
+		   replaced with the path. */
 	const char *file;
 
 		/* address for locating tag in source file */
@@ -156,6 +164,12 @@ typedef struct {
 
 } tagEntry;
 
+/* Called by tagsFindMany() for each tag entry matching `names [index]'.
+ * Returning non-zero stops the search.
+ */
+typedef int (* tagFindManyCallback) (const tagEntry *const entry, size_t index,
+									 void *userData);
+
 
 /*
 *  FUNCTION PROTOTYPES
@@ -175,9 +189,60 @@ typedef struct {
 *  successfully opened, or the tagErrno typed value representing the
 *  library level error. The error_number will be ENOMEM if the memory
 *  allocation for the handle is failed.
+*
+*  A tag file made by ctags --output-format=binary is loaded into memory
+*  (mapped on platforms supporting mmap()) as a whole; the other functions
+*  then work on the loaded records without parsing lines. The pseudo tags
+*  of such a file are always read before the tags. error_number will be
+*  TagErrnoUnexpectedFormat if the file is broken.
+*
+*  A tag file made by ctags --output-format=compressed is read by
+*  decompressing the block holding the lines to read, if the library is
+*  built with READTAGS_USE_ZLIB defined. error_number will be
+*  TagErrnoUnexpectedFormat for such a file if it is not.
 */
 extern tagFile *tagsOpen (const char *const filePath, tagFileInfo *const info);
 
+/*
+*  Same as tagsOpen() but the whole tag file is mapped into memory, on
+*  platforms supporting mmap(). Lines are then read from the mapping, so
+*  other functions reading the tag file make no system calls. The tag file
+*  must not be modified while it is open. If the tag file cannot be
+*  mapped, the function behaves like tagsOpen().
+*/
+extern tagFile *tagsOpenMapped (const char *const filePath, tagFileInfo *const info);
+
+/*
+*  Same as tagsOpen() but the tag file is read sequentially from `stream',
+*  which may be a pipe. Each line is parsed as it arrives; nothing is
+*  copied or buffered beyond the last line read. The pseudo tags are read
+*  here as in tagsOpen(). After that, only tagsFirst() (once, before any
+*  tag is read) and tagsNext() work: the functions needing to seek, like
+*  tagsFind(), tagsFirstPseudoTag() and tagsFirstInPart(), return
+*  TagFailure and tagsGetErrno() returns ESPIPE. Tag files in the binary
+*  and compressed formats are not supported. A stream of records made by
+*  ctags --output-format=stream is read record by record; only a stream
+*  can be read in the format. tagsClose() doesn't close `stream'.
+*/
+extern tagFile *tagsOpenStream (FILE *const stream, tagFileInfo *const info);
+
+/*
+*  Open a cursor on a tag file opened by tagsOpen() or tagsOpenMapped().
+*  A cursor is a handle passed to the other functions like the one of the
+*  tag file, with its own position, line buffer and search state. It
+*  shares the file, the pseudo tags, the indexes and the mapping with
+*  `file' instead of opening the tag file again, and reads the file with
+*  pread() unless it is mapped. Different threads can read the tag file
+*  through their own cursors at the same time without locking. Opening a
+*  cursor reads `file', so it must not run while another thread uses
+*  `file' itself. Close the cursors with tagsClose() before `file'. `info'
+*  is filled in as by tagsOpen(). A tag file in the binary format can have
+*  cursors on every platform, the others only where pread() is available;
+*  error_number is ENOSYS elsewhere, and TagErrnoInvalidArgument for a
+*  tag file opened by tagsOpenStream() or a cursor.
+*/
+extern tagFile *tagsOpenCursor (tagFile *const file, tagFileInfo *const info);
+
 /*
 *  This function allows the client to override the normal automatic detection
 *  of how a tag file is sorted. Permissible values for `type' are
@@ -212,6 +277,21 @@ extern tagResult tagsFirst (tagFile *const file, tagEntry *const entry);
 */
 extern tagResult tagsNext (tagFile *const file, tagEntry *const entry);
 
+/*
+*  Reads the first tag in a part of the file. The file is divided into
+*  `parts' parts of about the same size at line boundaries, and `part'
+*  (counting from 0) selects one of them. Each tag line belongs to exactly
+*  one part, so clients can read the parts of a file independently (for
+*  example in different processes) and still see every tag once. After
+*  calling this function, tagsNext() returns TagFailure at the end of the
+*  part; call tagsFirst() to read the whole file again. The function will
+*  return TagSuccess if a tag entry is found in the part, or TagFailure if
+*  not. tagsGetErrno() returns TagErrnoInvalidArgument if `part' is not
+*  less than `parts'.
+*/
+extern tagResult tagsFirstInPart (tagFile *const file, tagEntry *const entry,
+								  unsigned int part, unsigned int parts);
+
 /*
 *  Retrieve the value associated with the extension field for a specified key.
 *  It is passed a pointer to a structure already populated with values by a
@@ -221,6 +301,26 @@ extern tagResult tagsNext (tagFile *const file, tagEntry *const entry);
 */
 extern const char *tagsField (const tagEntry *const entry, const char *const key);
 
+/*
+*  Compute the hash of a source line that ctags --excmd=hash records in
+*  the "linehash" extension field: FNV-1a (32 bits) over the first 64
+*  bytes of the line. `line' has `length' bytes; a trailing "\n" or
+*  "\r\n" in them is not hashed.
+*/
+extern unsigned long tagsLineHash (const char *const line, size_t length);
+
+/*
+*  Check whether a source line is the one a tag entry was made for. It is
+*  passed a pointer to a structure populated by a previous call to
+*  tagsNext(), tagsFind(), or tagsFindNext(), and the line at
+*  entry->address.lineNumber in the source file. The function will return
+*  1 if the line has the hash in the "linehash" field of the entry, 0 if
+*  it doesn't, or -1 if the entry has no valid "linehash" field. A client
+*  getting 0 can fall back to searching the file for the tag.
+*/
+extern int tagsMatchLine (const tagEntry *const entry, const char *const line,
+						  size_t length);
+
 /*
 *  Find the first tag matching `name'. The structure pointed to by `entry'
 *  will be populated with information about the tag file entry. If a tag file
@@ -243,20 +343,64 @@ extern const char *tagsField (const tagEntry *const entry, const char *const key
 *        Matching will be performed in a case-sensitive manner. Note that
 *        this enables binary searches of the tag file.
 *
+*    TAG_SUBSTRINGMATCH
+*        Tags whose names contain `name' will qualify; TAG_PARTIALMATCH is
+*        ignored. Pseudo tags never qualify. If <tagfile>.trigrams made by
+*        ctags --trigram-index is found for a tag file in the default format,
+*        and `name' is at least three characters long, only the blocks of
+*        the tag file listed in the index for every trigram of `name' are
+*        read. Otherwise, the whole tag file is read.
+*
 *  The function will return TagSuccess if a tag matching the name is found, or
 *  TagFailure if not.
 */
 extern tagResult tagsFind (tagFile *const file, tagEntry *const entry, const char *const name, const int options);
 
+/*
+*  Find the tags matching each of `count' names in `names' with `options'
+*  (see tagsFind()), calling `callback' for every matching tag entry. The
+*  entry passed to the callback is valid only during the call.
+*  If the tag file is sorted in the way `options' asks for, the names are
+*  sorted and the tag file is walked once in the order: the search
+*  gallops forward from the matches of the last name to the next name,
+*  so close names cost a short sequential read instead of a binary
+*  search. Then the callback is called in the sorted order of the names.
+*  Otherwise, each name is looked up with tagsFind() in the given order.
+*  The function will return TagSuccess if the search is completed or
+*  stopped by the callback, or TagFailure on an error. tagsFindNext()
+*  cannot continue the search.
+*/
+extern tagResult tagsFindMany (tagFile *const file, const char *const *const names, size_t count, const int options, tagFindManyCallback callback, void *userData);
+
 /*
 *  Find the next tag matching the name and options supplied to the most recent
-*  call to tagsFind() for the same tag file. The structure pointed to by
-*  `entry' will be populated with information about the tag file entry. The
-*  function will return TagSuccess if another tag matching the name is found,
-*  or TagFailure if not.
+*  call to tagsFind() for the same tag file, or in the input file or the
+*  scope supplied to tagsFindByFile() or tagsFindByScope(). The structure
+*  pointed to by `entry' will be populated with information about the tag
+*  file entry. The function will return TagSuccess if another tag matching
+*  the name is found, or TagFailure if not.
 */
 extern tagResult tagsFindNext (tagFile *const file, tagEntry *const entry);
 
+/*
+*  Find the first tag in the input file `path', compared with the input
+*  fields of the tags as tagEntry.file, or in the scope `scope', like
+*  "class:Foo" for the members of the class Foo. The structure pointed to
+*  by `entry' will be populated with information about the tag file entry.
+*  tagsFindNext() finds the next tag in the same input file or scope; the
+*  tags are found in the order of the tag file.
+*  If <tagfile>.secondary made by ctags --secondary-index is found for a
+*  tag file in the default format, only the lines listed in the index for
+*  the input file or the scope are read. Otherwise, the whole tag file is
+*  read, and a scope is taken from the "scope" field of a tag or else its
+*  first field other than "language", unless the field is one written after
+*  the scope by Universal Ctags like "typeref".
+*  The function will return TagSuccess if a tag is found, or TagFailure if
+*  not.
+*/
+extern tagResult tagsFindByFile (tagFile *const file, tagEntry *const entry, const char *const path);
+extern tagResult tagsFindByScope (tagFile *const file, tagEntry *const entry, const char *const scope);
+
 /*
 *  Does the same as tagsFirst(), but is specialized to pseudo tags.
 *  If tagFileInfo doesn't contain pseudo tags you are interested in, read
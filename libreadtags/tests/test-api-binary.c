@@ -0,0 +1,322 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing the API functions with tag files in the binary format
+*
+*   The binary tag files are made from duplicated-names.c:
+*
+*   for s in yes foldcase no; do
+*     u-ctags --quiet --options=NONE -o duplicated-names--binary-sorted-$s.tags \
+*             --kinds-C='*' --sort=$s --output-format=binary input.c
+*   done
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static int
+same_string (const char *a, const char *b)
+{
+	return (a == NULL && b == NULL) || (a && b && strcmp (a, b) == 0);
+}
+
+static int
+same_entry (const tagEntry *a, const tagEntry *b)
+{
+	if (!(strcmp (a->name, b->name) == 0
+		  && strcmp (a->file, b->file) == 0
+		  && strcmp (a->address.pattern, b->address.pattern) == 0
+		  && a->address.lineNumber == b->address.lineNumber
+		  && same_string (a->kind, b->kind)
+		  && a->fileScope == b->fileScope
+		  && a->fields.count == b->fields.count))
+		return 0;
+
+	for (unsigned short i = 0; i < a->fields.count; i++)
+	{
+		if (strcmp (a->fields.list [i].key, b->fields.list [i].key) != 0
+			|| strcmp (a->fields.list [i].value, b->fields.list [i].value) != 0)
+			return 0;
+	}
+	return 1;
+}
+
+static tagFile *
+open_tags (const char *tags, tagFileInfo *info)
+{
+	tagFile *t;
+
+	fprintf (stderr, "opening %s...", tags);
+	t = tagsOpen (tags, info);
+	if (t == NULL || info->status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t, info->status.opened);
+		return NULL;
+	}
+	fprintf (stderr, "ok\n");
+	return t;
+}
+
+static int
+check_walking (tagFile *text, tagFile *bin)
+{
+	tagEntry e0, e1;
+	tagResult r0, r1;
+	int n = 0;
+
+	fprintf (stderr, "walking all entries...");
+	r0 = tagsFirst (text, &e0);
+	r1 = tagsFirst (bin, &e1);
+	while (r0 == TagSuccess && r1 == TagSuccess)
+	{
+		if (!same_entry (&e0, &e1))
+		{
+			fprintf (stderr, "different entries: %s and %s\n", e0.name, e1.name);
+			return 1;
+		}
+		n++;
+		r0 = tagsNext (text, &e0);
+		r1 = tagsNext (bin, &e1);
+	}
+	if (r0 != r1 || tagsGetErrno (bin) != 0)
+	{
+		fprintf (stderr, "unexpected end after %d entries (err: %d)\n",
+				 n, tagsGetErrno (bin));
+		return 1;
+	}
+	fprintf (stderr, "%d entries\n", n);
+	return 0;
+}
+
+static int
+check_finding (tagFile *text, tagFile *bin, const char *name, int options)
+{
+	tagEntry e0, e1;
+	tagResult r0, r1;
+	int n = 0;
+
+	fprintf (stderr, "finding \"%s\" (options: %d)...", name, options);
+	r0 = tagsFind (text, &e0, name, options);
+	r1 = tagsFind (bin, &e1, name, options);
+	while (r0 == TagSuccess && r1 == TagSuccess)
+	{
+		if (!same_entry (&e0, &e1))
+		{
+			fprintf (stderr, "different entries: %s and %s\n", e0.name, e1.name);
+			return 1;
+		}
+		n++;
+		r0 = tagsFindNext (text, &e0);
+		r1 = tagsFindNext (bin, &e1);
+	}
+	if (r0 != r1 || tagsGetErrno (bin) != 0)
+	{
+		fprintf (stderr, "unexpected end after %d entries (err: %d)\n",
+				 n, tagsGetErrno (bin));
+		return 1;
+	}
+	fprintf (stderr, "%d entries\n", n);
+	return 0;
+}
+
+static int
+count_found (const tagEntry *entry, size_t index, void *data)
+{
+	(*(int *) data)++;
+	return 0;
+}
+
+static int
+check_tags (const char *textTags, const char *binTags, tagSortType sort)
+{
+	tagFileInfo info0, info1;
+	tagFile *text, *bin;
+	tagEntry e;
+
+	text = open_tags (textTags, &info0);
+	if (text == NULL)
+		return 1;
+	bin = open_tags (binTags, &info1);
+	if (bin == NULL)
+		return 1;
+
+	fprintf (stderr, "checking info...");
+	if (info1.file.format != 2 || info1.file.sort != sort
+		|| !same_string (info1.program.name, "Universal Ctags"))
+	{
+		fprintf (stderr, "unexpected info (format: %d, sort: %d, name: %s)\n",
+				 info1.file.format, info1.file.sort,
+				 info1.program.name? info1.program.name: "(null)");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	if (check_walking (text, bin))
+		return 1;
+
+	const char *names [] = { "n", "m", "M", "ma", "main", "o", "O", "x", "" };
+	const int options [] = {
+		TAG_FULLMATCH,
+		TAG_PARTIALMATCH,
+		TAG_FULLMATCH | TAG_IGNORECASE,
+		TAG_PARTIALMATCH | TAG_IGNORECASE,
+	};
+	for (size_t i = 0; i < sizeof (names) / sizeof (names [0]); i++)
+	{
+		for (size_t j = 0; j < sizeof (options) / sizeof (options [0]); j++)
+		{
+			if (check_finding (text, bin, names [i], options [j]))
+				return 1;
+		}
+	}
+
+	fprintf (stderr, "finding many names...");
+	int c0 = 0, c1 = 0;
+	if (tagsFindMany (text, names, 8, TAG_FULLMATCH, count_found, &c0) != TagSuccess
+		|| tagsFindMany (bin, names, 8, TAG_FULLMATCH, count_found, &c1) != TagSuccess
+		|| c0 != c1)
+	{
+		fprintf (stderr, "unexpected result (%d and %d)\n", c0, c1);
+		return 1;
+	}
+	fprintf (stderr, "%d entries\n", c1);
+
+	fprintf (stderr, "walking pseudo tags...");
+	int p = 0;
+	if (tagsFirstPseudoTag (bin, &e) == TagSuccess)
+	{
+		do
+		{
+			if (strncmp (e.name, "!_", 2) != 0)
+			{
+				fprintf (stderr, "unexpected name: %s\n", e.name);
+				return 1;
+			}
+			p++;
+		}
+		while (tagsNextPseudoTag (bin, &e) == TagSuccess);
+	}
+	if (p == 0 || tagsGetErrno (bin) != 0)
+	{
+		fprintf (stderr, "unexpected result (%d, err: %d)\n", p, tagsGetErrno (bin));
+		return 1;
+	}
+	if (tagsFindPseudoTag (bin, &e, "!_TAG_FILE_SORTED", TAG_FULLMATCH) != TagSuccess
+		|| e.file [0] != '0' + (int) sort)
+	{
+		fprintf (stderr, "cannot find !_TAG_FILE_SORTED\n");
+		return 1;
+	}
+	fprintf (stderr, "%d pseudo tags\n", p);
+
+	fprintf (stderr, "reading in parts...");
+	int n0 = 0, n1 = 0;
+	if (tagsFirst (text, &e) == TagSuccess)
+		do n0++; while (tagsNext (text, &e) == TagSuccess);
+	for (unsigned int part = 0; part < 7; part++)
+	{
+		if (tagsFirstInPart (bin, &e, part, 7) == TagSuccess)
+			do n1++; while (tagsNext (bin, &e) == TagSuccess);
+		if (tagsGetErrno (bin) != 0)
+		{
+			fprintf (stderr, "unexpected error in part %u\n", part);
+			return 1;
+		}
+	}
+	if (n0 != n1)
+	{
+		fprintf (stderr, "different number of entries: %d and %d\n", n0, n1);
+		return 1;
+	}
+	fprintf (stderr, "%d entries\n", n1);
+
+	tagsClose (text);
+	tagsClose (bin);
+	return 0;
+}
+
+/* Make a binary tag file broken by truncating SRC in the current
+ * directory. */
+static int
+check_broken (const char *src)
+{
+	const char *broken = "broken-binary.tags";
+	char buf [128];
+	size_t len;
+	FILE *fp;
+	tagFileInfo info;
+	tagFile *t;
+
+	fprintf (stderr, "opening a broken binary tag file...");
+	fp = fopen (src, "rb");
+	if (fp == NULL)
+	{
+		perror (src);
+		return 99;
+	}
+	len = fread (buf, 1, sizeof (buf), fp);
+	fclose (fp);
+
+	fp = fopen (broken, "wb");
+	if (fp == NULL || fwrite (buf, 1, len, fp) != len)
+	{
+		fprintf (stderr, "cannot make %s\n", broken);
+		return 99;
+	}
+	fclose (fp);
+
+	t = tagsOpen (broken, &info);
+	remove (broken);
+	if (t != NULL || info.status.error_number != TagErrnoUnexpectedFormat)
+	{
+		fprintf (stderr, "unexpected result (t: %p, err: %d)\n",
+				 t, info.status.error_number);
+		return 1;
+	}
+	fprintf (stderr, "failed as expected\n");
+	return 0;
+}
+
+int
+main (void)
+{
+	const char *bin = "duplicated-names--binary-sorted-yes.tags";
+	char *srcdir = getenv ("srcdir");
+	int r;
+
+	if (srcdir)
+	{
+		char *src = malloc (strlen (srcdir) + 1 + strlen (bin) + 1);
+		if (src == NULL)
+			return 99;
+		sprintf (src, "%s/%s", srcdir, bin);
+		r = check_broken (src);
+		free (src);
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+	else
+		r = check_broken (bin);
+	if (r)
+		return r;
+
+	if (check_tags ("duplicated-names--sorted-yes.tags",
+					"duplicated-names--binary-sorted-yes.tags", TAG_SORTED)
+		|| check_tags ("duplicated-names--sorted-foldcase.tags",
+					   "duplicated-names--binary-sorted-foldcase.tags", TAG_FOLDSORTED)
+		|| check_tags ("duplicated-names--sorted-no.tags",
+					   "duplicated-names--binary-sorted-no.tags", TAG_UNSORTED))
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,210 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsFindByFile() and tagsFindByScope() API functions
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define COUNT(x) (sizeof(x)/sizeof(x[0]))
+#define OUTPUT_SIZE 8192
+#define MAX_KEYS 64
+
+static void
+record (char *output, const tagEntry *e)
+{
+	size_t length = strlen (output);
+
+	snprintf (output + length, OUTPUT_SIZE - length, "%s\t%s\t%s\n",
+			  e->name, e->file, e->address.pattern);
+}
+
+/* The scope of a tag as written by ctags: the "scope" field, or else the
+ * first field other than "language" if it is not "typeref". */
+static void
+get_scope (const tagEntry *e, char *scope, size_t size)
+{
+	scope [0] = '\0';
+	for (unsigned short i = 0; i < e->fields.count; i++)
+	{
+		if (strcmp (e->fields.list [i].key, "language") == 0)
+			continue;
+		if (strcmp (e->fields.list [i].key, "typeref") == 0)
+			return;
+		if (strcmp (e->fields.list [i].key, "scope") == 0)
+			snprintf (scope, size, "%s", e->fields.list [i].value);
+		else
+			snprintf (scope, size, "%s:%s", e->fields.list [i].key,
+					  e->fields.list [i].value);
+		return;
+	}
+}
+
+static void
+add_key (char keys [][128], size_t *count, const char *key)
+{
+	for (size_t i = 0; i < *count; i++)
+		if (strcmp (keys [i], key) == 0)
+			return;
+	if (*count < MAX_KEYS)
+		snprintf (keys [(*count)++], 128, "%s", key);
+}
+
+static int
+check_key (tagFile *t, const char *key, int by_scope)
+{
+	static char expected [OUTPUT_SIZE], actual [OUTPUT_SIZE];
+	char scope [128];
+	tagEntry e;
+	tagResult r;
+
+	expected [0] = '\0';
+	actual [0] = '\0';
+	for (r = tagsFirst (t, &e); r == TagSuccess; r = tagsNext (t, &e))
+	{
+		if (by_scope)
+		{
+			get_scope (&e, scope, sizeof (scope));
+			if (scope [0] == '\0')
+				continue;
+		}
+		if (strcmp (by_scope? scope: e.file, key) == 0)
+			record (expected, &e);
+	}
+
+	fprintf (stderr, "finding tags in %s \"%s\"...", by_scope? "scope": "file", key);
+	for (r = by_scope? tagsFindByScope (t, &e, key): tagsFindByFile (t, &e, key);
+		 r == TagSuccess;
+		 r = tagsFindNext (t, &e))
+		record (actual, &e);
+
+	if (tagsGetErrno (t) != 0)
+	{
+		fprintf (stderr, "failed unexpectedly: %d\n", tagsGetErrno (t));
+		return 1;
+	}
+	if (strcmp (expected, actual) != 0)
+	{
+		fprintf (stderr, "unexpected tags:\n%s\nexpected:\n%s\n", actual, expected);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+	return 0;
+}
+
+static int
+check_tags (const char *tags, int mapped, int cursor)
+{
+	static char files [MAX_KEYS][128], scopes [MAX_KEYS][128];
+	size_t file_count = 0, scope_count = 0;
+	char scope [128];
+	tagFileInfo info;
+	tagEntry e;
+	tagResult r;
+	tagFile *owner, *t;
+	int result = 0;
+
+	fprintf (stderr, "opening %s%s%s...", tags, mapped? " (mapped)": "",
+			 cursor? " (cursor)": "");
+	owner = mapped? tagsOpenMapped (tags, &info): tagsOpen (tags, &info);
+	if (owner == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 owner, info.status.opened);
+		return 1;
+	}
+	t = cursor? tagsOpenCursor (owner, &info): owner;
+	if (t == NULL)
+	{
+		fprintf (stderr, "cannot open a cursor\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	for (r = tagsFirst (t, &e); r == TagSuccess; r = tagsNext (t, &e))
+	{
+		add_key (files, &file_count, e.file);
+		get_scope (&e, scope, sizeof (scope));
+		if (scope [0] != '\0')
+			add_key (scopes, &scope_count, scope);
+	}
+	add_key (files, &file_count, "nonexistent.c");
+	add_key (scopes, &scope_count, "class:Nonexistent");
+	add_key (scopes, &scope_count, "class");
+	add_key (scopes, &scope_count, "");
+
+	for (size_t i = 0; i < file_count && result == 0; i++)
+		result = check_key (t, files [i], 0);
+	for (size_t i = 0; i < scope_count && result == 0; i++)
+		result = check_key (t, scopes [i], 1);
+
+	if (result == 0)
+	{
+		fprintf (stderr, "finding a name after finding tags in a file...");
+		if (tagsFindByFile (t, &e, files [0]) != TagSuccess
+			|| tagsFind (t, &e, e.name, TAG_FULLMATCH) != TagSuccess
+			|| (tagsFindNext (t, &e) == TagFailure && tagsGetErrno (t) != 0))
+		{
+			fprintf (stderr, "unexpected result\n");
+			result = 1;
+		}
+		else
+			fprintf (stderr, "ok\n");
+	}
+
+	if (cursor)
+		tagsClose (t);
+	tagsClose (owner);
+	return result;
+}
+
+int
+main (void)
+{
+	tagFileInfo info;
+	tagEntry e;
+	tagFile *t;
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("api-tagsFindByKey.tags", 0, 0)
+		|| check_tags ("api-tagsFindByKey.tags", 1, 0)
+		|| check_tags ("api-tagsFindByKey.tags", 0, 1)
+		|| check_tags ("api-tagsFindByKey-ids.tags", 0, 0)
+		|| check_tags ("api-tagsFindByKey-noindex.tags", 0, 0)
+		|| check_tags ("duplicated-names--sorted-no.tags", 0, 0)
+		|| check_tags ("duplicated-names--binary-sorted-yes.tags", 0, 0))
+		return 1;
+
+	fprintf (stderr, "finding tags in NULL...");
+	t = tagsOpen ("api-tagsFindByKey.tags", &info);
+	if (t == NULL)
+	{
+		fprintf (stderr, "cannot open the tag file\n");
+		return 1;
+	}
+	if (tagsFindByScope (t, &e, NULL) != TagFailure
+		|| tagsGetErrno (t) != TagErrnoInvalidArgument)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	tagsClose (t);
+	fprintf (stderr, "failed as expected\n");
+
+	return 0;
+}
@@ -0,0 +1,183 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsFindMany() API function
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define COUNT(x) (sizeof(x)/sizeof(x[0]))
+
+struct match {
+	size_t index;
+	char *name;
+	char *pattern;
+};
+
+struct matches {
+	struct match list [256];
+	size_t count;
+	size_t limit;
+};
+
+static int
+collect (const tagEntry *const entry, size_t index, void *userData)
+{
+	struct matches *m = userData;
+
+	if (m->count == COUNT (m->list))
+		return 1;
+	m->list [m->count].index = index;
+	m->list [m->count].name = strdup (entry->name);
+	m->list [m->count].pattern = strdup (entry->address.pattern);
+	m->count++;
+	return (m->limit > 0 && m->count >= m->limit);
+}
+
+static int
+compare_match (const void *a, const void *b)
+{
+	const struct match *x = a, *y = b;
+	int r;
+
+	if (x->index != y->index)
+		return x->index < y->index? -1: 1;
+	r = strcmp (x->name, y->name);
+	if (r == 0)
+		r = strcmp (x->pattern, y->pattern);
+	return r;
+}
+
+static void
+clear_matches (struct matches *m)
+{
+	for (size_t i = 0; i < m->count; i++)
+	{
+		free (m->list [i].name);
+		free (m->list [i].pattern);
+	}
+	m->count = 0;
+}
+
+static int
+check_tags (const char *tags, int options)
+{
+	const char *names [] = { "O", "nonexistent", "M", "main", "n", "N", "M", "a", "zzz" };
+	struct matches expected = { .count = 0, .limit = 0 };
+	struct matches actual = { .count = 0, .limit = 0 };
+	tagFileInfo info;
+	tagEntry e;
+	tagFile *t;
+	int r = 0;
+
+	fprintf (stderr, "opening %s...", tags);
+	t = tagsOpen (tags, &info);
+	if (t == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t, info.status.opened);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	for (size_t i = 0; i < COUNT (names); i++)
+	{
+		tagResult result = tagsFind (t, &e, names [i], options);
+		while (result == TagSuccess)
+		{
+			collect (&e, i, &expected);
+			result = tagsFindNext (t, &e);
+		}
+	}
+
+	fprintf (stderr, "finding %d names (%d)...", (int) COUNT (names), options);
+	if (tagsFindMany (t, names, COUNT (names), options, collect, &actual) != TagSuccess)
+	{
+		fprintf (stderr, "failed unexpectedly: %d\n", tagsGetErrno (t));
+		r = 1;
+		goto out;
+	}
+
+	qsort (expected.list, expected.count, sizeof (struct match), compare_match);
+	qsort (actual.list, actual.count, sizeof (struct match), compare_match);
+	if (expected.count != actual.count || expected.count == 0)
+	{
+		fprintf (stderr, "unexpected number of matches: %d (expected: %d)\n",
+				 (int) actual.count, (int) expected.count);
+		r = 1;
+		goto out;
+	}
+	for (size_t i = 0; i < expected.count; i++)
+	{
+		if (compare_match (expected.list + i, actual.list + i) != 0)
+		{
+			fprintf (stderr, "unexpected match: %s (expected: %s)\n",
+					 actual.list [i].name, expected.list [i].name);
+			r = 1;
+			goto out;
+		}
+	}
+	fprintf (stderr, "%d matches as expected\n", (int) actual.count);
+
+	fprintf (stderr, "stopping in the callback...");
+	clear_matches (&actual);
+	actual.limit = 1;
+	if (tagsFindMany (t, names, COUNT (names), options, collect, &actual) != TagSuccess
+		|| actual.count != 1)
+	{
+		fprintf (stderr, "unexpected result: %d matches\n", (int) actual.count);
+		r = 1;
+		goto out;
+	}
+	fprintf (stderr, "stopped as expected\n");
+
+ out:
+	clear_matches (&expected);
+	clear_matches (&actual);
+	tagsClose (t);
+	return r;
+}
+
+int
+main (void)
+{
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("duplicated-names--sorted-yes.tags", TAG_FULLMATCH)
+		|| check_tags ("duplicated-names--sorted-yes.tags", TAG_PARTIALMATCH)
+		|| check_tags ("duplicated-names--sorted-foldcase.tags", TAG_IGNORECASE)
+		|| check_tags ("duplicated-names--sorted-foldcase.tags", TAG_PARTIALMATCH|TAG_IGNORECASE)
+		|| check_tags ("duplicated-names--sorted-no.tags", TAG_FULLMATCH))
+		return 1;
+
+	fprintf (stderr, "calling with NULL callback...");
+	tagFileInfo info;
+	tagFile *t = tagsOpen ("duplicated-names--sorted-yes.tags", &info);
+	const char *name = "M";
+	if (t == NULL
+		|| tagsFindMany (t, &name, 1, TAG_FULLMATCH, NULL, NULL) != TagFailure
+		|| tagsGetErrno (t) != TagErrnoInvalidArgument)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	tagsClose (t);
+	fprintf (stderr, "failed as expected\n");
+
+	return 0;
+}
@@ -0,0 +1,144 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsFind() API function with TAG_SUBSTRINGMATCH
+*/
+
+#include "readtags.h"
+
+#include <ctype.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define COUNT(x) (sizeof(x)/sizeof(x[0]))
+
+static int
+contains (const char *name, const char *s, int ignorecase)
+{
+	const size_t length = strlen (s);
+
+	for (; *name != '\0'; name++)
+	{
+		size_t i;
+
+		for (i = 0; i < length && name [i] != '\0'; i++)
+		{
+			if (ignorecase
+				? toupper ((unsigned char) name [i]) != toupper ((unsigned char) s [i])
+				: name [i] != s [i])
+				break;
+		}
+		if (i == length)
+			return 1;
+	}
+	return 0;
+}
+
+static int
+check_tags (const char *tags, int mapped, int options, const char *const *queries,
+			size_t count)
+{
+	const int ignorecase = (options & TAG_IGNORECASE) != 0;
+	tagFileInfo info;
+	tagEntry e;
+	tagFile *t;
+	int r = 0;
+	size_t matched = 0;
+
+	fprintf (stderr, "opening %s%s...", tags, mapped? " (mapped)": "");
+	t = mapped? tagsOpenMapped (tags, &info): tagsOpen (tags, &info);
+	if (t == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t, info.status.opened);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	for (size_t i = 0; i < count; i++)
+	{
+		unsigned long expected = 0, actual = 0;
+		tagResult result;
+
+		for (result = tagsFirst (t, &e); result == TagSuccess; result = tagsNext (t, &e))
+		{
+			if (contains (e.name, queries [i], ignorecase))
+				expected++;
+		}
+
+		fprintf (stderr, "finding names containing \"%s\" (%d)...", queries [i], options);
+		for (result = tagsFind (t, &e, queries [i], options | TAG_SUBSTRINGMATCH);
+			 result == TagSuccess;
+			 result = tagsFindNext (t, &e))
+		{
+			if (! contains (e.name, queries [i], ignorecase))
+			{
+				fprintf (stderr, "unexpected match: %s\n", e.name);
+				r = 1;
+				goto out;
+			}
+			actual++;
+		}
+		if (tagsGetErrno (t) != 0)
+		{
+			fprintf (stderr, "failed unexpectedly: %d\n", tagsGetErrno (t));
+			r = 1;
+			goto out;
+		}
+		if (actual != expected)
+		{
+			fprintf (stderr, "unexpected number of matches: %lu (expected: %lu)\n",
+					 actual, expected);
+			r = 1;
+			goto out;
+		}
+		fprintf (stderr, "%lu matches as expected\n", actual);
+		matched += actual;
+	}
+
+	if (matched == 0)
+	{
+		fprintf (stderr, "no name matched\n");
+		r = 1;
+	}
+
+ out:
+	tagsClose (t);
+	return r;
+}
+
+int
+main (void)
+{
+	/* Names spread over the blocks, in a block, nowhere, and too short
+	 * for the trigram index. */
+	const char *indexed [] = {
+		"Item", "item", "Count9", "em99", "Item7", "ount1", "xyz", "tIt", "9", "",
+	};
+	const char *plain [] = {
+		"a", "ain", "MAIN", "M", "zzz",
+	};
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("api-tagsFindSubstring.tags", 0, TAG_OBSERVECASE, indexed, COUNT (indexed))
+		|| check_tags ("api-tagsFindSubstring.tags", 0, TAG_IGNORECASE, indexed, COUNT (indexed))
+		|| check_tags ("api-tagsFindSubstring.tags", 1, TAG_IGNORECASE, indexed, COUNT (indexed))
+		|| check_tags ("duplicated-names--sorted-yes.tags", 0, TAG_OBSERVECASE, plain, COUNT (plain))
+		|| check_tags ("duplicated-names--sorted-no.tags", 0, TAG_IGNORECASE, plain, COUNT (plain))
+		|| check_tags ("duplicated-names--binary-sorted-yes.tags", 0, TAG_IGNORECASE, plain, COUNT (plain)))
+		return 1;
+
+	return 0;
+}
@@ -0,0 +1,152 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsFirstInPart() API function
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static int
+same_entry (const tagEntry *a, const tagEntry *b)
+{
+	return (strcmp (a->name, b->name) == 0
+			&& strcmp (a->file, b->file) == 0
+			&& strcmp (a->address.pattern, b->address.pattern) == 0
+			&& ((a->kind == NULL && b->kind == NULL)
+				|| (a->kind && b->kind && strcmp (a->kind, b->kind) == 0))
+			&& a->fields.count == b->fields.count);
+}
+
+static int
+check_parts (const char *tags, tagFile *whole, tagFile *t, unsigned int parts)
+{
+	tagEntry e0, e1;
+	tagResult r0, r1;
+	int n = 0;
+
+	fprintf (stderr, "reading %s in %u part(s)...", tags, parts);
+	r0 = tagsFirst (whole, &e0);
+	for (unsigned int part = 0; part < parts; part++)
+	{
+		r1 = tagsFirstInPart (t, &e1, part, parts);
+		while (r1 == TagSuccess)
+		{
+			if (r0 != TagSuccess)
+			{
+				fprintf (stderr, "too many entries in part %u\n", part);
+				return 1;
+			}
+			if (!same_entry (&e0, &e1))
+			{
+				fprintf (stderr, "different entries in part %u: %s and %s\n",
+						 part, e0.name, e1.name);
+				return 1;
+			}
+			n++;
+			r0 = tagsNext (whole, &e0);
+			r1 = tagsNext (t, &e1);
+		}
+		if (tagsGetErrno (t) != 0)
+		{
+			fprintf (stderr, "unexpected error in part %u: %d\n",
+					 part, tagsGetErrno (t));
+			return 1;
+		}
+	}
+	if (r0 == TagSuccess)
+	{
+		fprintf (stderr, "missing entries after %d\n", n);
+		return 1;
+	}
+	fprintf (stderr, "%d entries\n", n);
+	return 0;
+}
+
+static int
+check_tags (const char *tags)
+{
+	tagFileInfo info;
+	tagFile *whole, *t;
+	tagEntry e;
+
+	fprintf (stderr, "opening %s...", tags);
+	whole = tagsOpen (tags, &info);
+	if (whole == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 whole, info.status.opened);
+		return 1;
+	}
+	t = tagsOpen (tags, &info);
+	if (t == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t, info.status.opened);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	for (unsigned int parts = 1; parts <= 64; parts *= 2)
+	{
+		if (check_parts (tags, whole, t, parts))
+			return 1;
+	}
+	if (check_parts (tags, whole, t, 7))
+		return 1;
+
+	fprintf (stderr, "reading the whole file after reading a part...");
+	if (tagsFirstInPart (t, &e, 0, 2) == TagSuccess)
+		tagsNext (t, &e);
+	int n0 = 0, n1 = 0;
+	if (tagsFirst (whole, &e) == TagSuccess)
+		do n0++; while (tagsNext (whole, &e) == TagSuccess);
+	if (tagsFirst (t, &e) == TagSuccess)
+		do n1++; while (tagsNext (t, &e) == TagSuccess);
+	if (n0 != n1)
+	{
+		fprintf (stderr, "different number of entries: %d and %d\n", n0, n1);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "passing a part out of range...");
+	if (tagsFirstInPart (t, &e, 2, 2) == TagSuccess
+		|| tagsGetErrno (t) != TagErrnoInvalidArgument)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	fprintf (stderr, "failed as expected\n");
+
+	tagsClose (whole);
+	tagsClose (t);
+	return 0;
+}
+
+int
+main (void)
+{
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("duplicated-names--sorted-yes.tags")
+		|| check_tags ("duplicated-names--sorted-no.tags")
+		|| check_tags ("ptag-sort-no.tags"))
+		return 1;
+
+	return 0;
+}
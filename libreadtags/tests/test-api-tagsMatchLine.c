@@ -0,0 +1,164 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsLineHash() and tagsMatchLine() API functions
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define MAX_LINES 64
+
+static int
+read_lines (const char *source, char lines [MAX_LINES][256], size_t *count)
+{
+	FILE *fp = fopen (source, "r");
+
+	if (fp == NULL)
+	{
+		perror ("fopen");
+		return 1;
+	}
+	for (*count = 0; *count < MAX_LINES; (*count)++)
+	{
+		if (fgets (lines [*count], 256, fp) == NULL)
+			break;
+	}
+	fclose (fp);
+	return 0;
+}
+
+static int
+check_tags (const char *tags, const char *source)
+{
+	char lines [MAX_LINES][256];
+	size_t count;
+	tagFileInfo info;
+	tagFile *t;
+	tagEntry e;
+	int n = 0;
+
+	if (read_lines (source, lines, &count))
+		return 1;
+
+	fprintf (stderr, "opening %s...", tags);
+	t = tagsOpen (tags, &info);
+	if (t == NULL)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d, error_number: %d)\n",
+				 t, info.status.opened, info.status.error_number);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "verifying the lines of the tags...");
+	if (tagsFirst (t, &e) != TagSuccess)
+	{
+		fprintf (stderr, "no tag\n");
+		return 1;
+	}
+	do
+	{
+		const char *line;
+
+		if (e.address.lineNumber == 0 || e.address.lineNumber > count)
+		{
+			fprintf (stderr, "unexpected line number %lu for %s\n",
+					 e.address.lineNumber, e.name);
+			return 1;
+		}
+		line = lines [e.address.lineNumber - 1];
+		if (tagsMatchLine (&e, line, strlen (line)) != 1)
+		{
+			fprintf (stderr, "line %lu doesn't match %s\n",
+					 e.address.lineNumber, e.name);
+			return 1;
+		}
+		/* The line end doesn't count. */
+		if (tagsMatchLine (&e, line, strcspn (line, "\n")) != 1)
+		{
+			fprintf (stderr, "line %lu without newline doesn't match %s\n",
+					 e.address.lineNumber, e.name);
+			return 1;
+		}
+		/* The previous line must differ in the tested file. */
+		if (e.address.lineNumber > 1
+			&& tagsMatchLine (&e, lines [e.address.lineNumber - 2],
+							  strlen (lines [e.address.lineNumber - 2])) != 0)
+		{
+			fprintf (stderr, "line %lu matches %s unexpectedly\n",
+					 e.address.lineNumber - 1, e.name);
+			return 1;
+		}
+		n++;
+	} while (tagsNext (t, &e) == TagSuccess);
+	fprintf (stderr, "%d tags\n", n);
+
+	tagsClose (t);
+	return 0;
+}
+
+static int
+check_no_hash (const char *tags)
+{
+	tagFileInfo info;
+	tagFile *t;
+	tagEntry e;
+
+	fprintf (stderr, "verifying a tag without linehash...");
+	t = tagsOpen (tags, &info);
+	if (t == NULL || tagsFirst (t, &e) != TagSuccess
+		|| tagsMatchLine (&e, "int M (void) { return 0; }\n", 27) != -1)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	tagsClose (t);
+	fprintf (stderr, "ok\n");
+	return 0;
+}
+
+int
+main (void)
+{
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	fprintf (stderr, "hashing an empty line...");
+	/* The offset basis of FNV-1a */
+	if (tagsLineHash ("", 0) != 2166136261UL
+		|| tagsLineHash ("\r\n", 2) != 2166136261UL)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "hashing a long line...");
+	if (tagsLineHash ("0123456789012345678901234567890123456789012345678901234567890123a", 65)
+		!= tagsLineHash ("0123456789012345678901234567890123456789012345678901234567890123b", 65))
+	{
+		fprintf (stderr, "bytes after the prefix are hashed\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	if (check_tags ("api-tagsMatchLine.tags", "duplicated-names.c")
+		|| check_no_hash ("duplicated-names--sorted-yes.tags"))
+		return 1;
+
+	return 0;
+}
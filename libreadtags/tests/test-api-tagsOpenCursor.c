@@ -0,0 +1,230 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsOpenCursor() API function
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#define COUNT(x) (sizeof(x)/sizeof(x[0]))
+#define OUTPUT_SIZE 65536
+
+/* A walk over the tag file: the whole file if name is NULL */
+struct walk {
+	const char *name;
+	int options;
+	tagFile *t;
+	tagEntry e;
+	tagResult r;
+	char output [OUTPUT_SIZE];
+};
+
+static void
+record (struct walk *w)
+{
+	size_t length = strlen (w->output);
+
+	snprintf (w->output + length, OUTPUT_SIZE - length, "%s\t%s\t%s\n",
+			  w->e.name, w->e.file, w->e.address.pattern);
+}
+
+static void
+start (struct walk *w, tagFile *t, const char *name, int options)
+{
+	w->name = name;
+	w->options = options;
+	w->t = t;
+	w->output [0] = '\0';
+	w->r = name? tagsFind (t, &w->e, name, options): tagsFirst (t, &w->e);
+	if (w->r == TagSuccess)
+		record (w);
+}
+
+/* Read the next tag of the walk, return 0 at the end. */
+static int
+step (struct walk *w)
+{
+	if (w->r != TagSuccess)
+		return 0;
+	w->r = w->name? tagsFindNext (w->t, &w->e): tagsNext (w->t, &w->e);
+	if (w->r == TagSuccess)
+		record (w);
+	return 1;
+}
+
+static int
+check_walk (struct walk *w, tagFile *reference)
+{
+	static struct walk expected;
+
+	start (&expected, reference, w->name, w->options);
+	while (step (&expected))
+		;
+
+	if (tagsGetErrno (w->t) != 0 || tagsGetErrno (reference) != 0)
+	{
+		fprintf (stderr, "failed unexpectedly: %d %d\n",
+				 tagsGetErrno (w->t), tagsGetErrno (reference));
+		return 1;
+	}
+	if (strcmp (w->output, expected.output) != 0)
+	{
+		fprintf (stderr, "unexpected tags for %s:\n%s\nexpected:\n%s\n",
+				 w->name? w->name: "(all)", w->output, expected.output);
+		return 1;
+	}
+	return 0;
+}
+
+static int
+check_tags (const char *tags, int mapped)
+{
+	const char *names [] = { "M", "N", "O", "main", "n", "nonexistent", "Item", "tem9" };
+	const int options [] = {
+		TAG_FULLMATCH | TAG_OBSERVECASE,
+		TAG_PARTIALMATCH | TAG_OBSERVECASE,
+		TAG_PARTIALMATCH | TAG_IGNORECASE,
+		TAG_SUBSTRINGMATCH | TAG_IGNORECASE,
+	};
+	static struct walk walks [3];
+	tagFileInfo info;
+	tagFile *t, *c0, *c1, *reference;
+	int r = 0;
+
+	fprintf (stderr, "opening cursors on %s%s...", tags, mapped? " (mapped)": "");
+	t = mapped? tagsOpenMapped (tags, &info): tagsOpen (tags, &info);
+	reference = tagsOpen (tags, &info);
+	if (t == NULL || reference == NULL)
+	{
+		fprintf (stderr, "cannot open the tag file\n");
+		return 1;
+	}
+	c0 = tagsOpenCursor (t, &info);
+	if (c0 == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (c: %p, opened: %d, error: %d)\n",
+				 c0, info.status.opened, info.status.error_number);
+		return 1;
+	}
+	c1 = tagsOpenCursor (t, NULL);
+	if (c1 == NULL)
+	{
+		fprintf (stderr, "cannot open the second cursor\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "reading the first tag right after opening...");
+	start (&walks [0], reference, NULL, 0);
+	if (tagsNext (c0, &walks [1].e) != TagSuccess
+		|| strcmp (walks [0].e.name, walks [1].e.name) != 0)
+	{
+		fprintf (stderr, "unexpected tag\n");
+		r = 1;
+		goto out;
+	}
+	fprintf (stderr, "ok\n");
+
+	/* The file and its cursors take turns reading a line each, so
+	 * any state they shared would show up in the output. */
+	for (size_t i = 0; i < COUNT (names); i++)
+	{
+		for (size_t j = 0; j < COUNT (options); j++)
+		{
+			fprintf (stderr, "finding \"%s\" (%d) while walking...",
+					 names [i], options [j]);
+			start (walks + 0, c0, NULL, 0);
+			start (walks + 1, c1, names [i], options [j]);
+			start (walks + 2, t, names [(i + 1) % COUNT (names)], options [j]);
+			while (step (walks + 0) | step (walks + 1) | step (walks + 2))
+				;
+			for (int k = 0; k < 3; k++)
+			{
+				if (check_walk (walks + k, reference))
+				{
+					r = 1;
+					goto out;
+				}
+			}
+			fprintf (stderr, "ok\n");
+		}
+	}
+
+	fprintf (stderr, "opening a cursor on a cursor...");
+	if (tagsOpenCursor (c0, &info) != NULL || info.status.opened != 0
+		|| info.status.error_number != TagErrnoInvalidArgument)
+	{
+		fprintf (stderr, "unexpected result\n");
+		r = 1;
+		goto out;
+	}
+	fprintf (stderr, "failed as expected\n");
+
+ out:
+	tagsClose (c0);
+	tagsClose (c1);
+	tagsClose (t);
+	tagsClose (reference);
+	return r;
+}
+
+int
+main (void)
+{
+	tagFileInfo info;
+	tagFile *t;
+	FILE *fp;
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("duplicated-names--sorted-yes.tags", 0)
+		|| check_tags ("duplicated-names--sorted-yes.tags", 1)
+		|| check_tags ("duplicated-names--sorted-no.tags", 0)
+		|| check_tags ("duplicated-names--sorted-foldcase.tags", 0)
+		|| check_tags ("duplicated-names--binary-sorted-yes.tags", 0)
+		|| check_tags ("api-tagsFindSubstring.tags", 0)
+		|| check_tags ("api-tagsFindSubstring.tags", 1))
+		return 1;
+
+	fprintf (stderr, "opening a cursor on a stream...");
+	fp = fopen ("duplicated-names--sorted-yes.tags", "r");
+	t = fp? tagsOpenStream (fp, &info): NULL;
+	if (t == NULL)
+	{
+		fprintf (stderr, "cannot open the stream\n");
+		return 1;
+	}
+	if (tagsOpenCursor (t, &info) != NULL || info.status.opened != 0
+		|| info.status.error_number != TagErrnoInvalidArgument)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	tagsClose (t);
+	fclose (fp);
+	fprintf (stderr, "failed as expected\n");
+
+	fprintf (stderr, "opening a cursor on NULL...");
+	if (tagsOpenCursor (NULL, &info) != NULL || info.status.opened != 0)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	fprintf (stderr, "failed as expected\n");
+
+	return 0;
+}
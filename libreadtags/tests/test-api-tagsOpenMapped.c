@@ -0,0 +1,134 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsOpenMapped() API function
+*/
+
+#include "readtags.h"
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static int
+same_entry (const tagEntry *a, const tagEntry *b)
+{
+	return (strcmp (a->name, b->name) == 0
+			&& strcmp (a->file, b->file) == 0
+			&& strcmp (a->address.pattern, b->address.pattern) == 0
+			&& ((a->kind == NULL && b->kind == NULL)
+				|| (a->kind && b->kind && strcmp (a->kind, b->kind) == 0))
+			&& a->fields.count == b->fields.count);
+}
+
+static int
+check_tags (const char *tags)
+{
+	tagFileInfo info;
+	tagEntry e0, e1;
+	tagFile *t0, *t1;
+	const char *names [] = { "M", "N", "O", "main", "n", "nonexistent" };
+	int n = 0;
+
+	fprintf (stderr, "opening %s...", tags);
+	t0 = tagsOpen (tags, &info);
+	if (t0 == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t0, info.status.opened);
+		return 1;
+	}
+	t1 = tagsOpenMapped (tags, &info);
+	if (t1 == NULL || info.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t1, info.status.opened);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "comparing entries...");
+	tagResult r0 = tagsFirst (t0, &e0);
+	tagResult r1 = tagsFirst (t1, &e1);
+	while (r0 == TagSuccess && r1 == TagSuccess)
+	{
+		if (!same_entry (&e0, &e1))
+		{
+			fprintf (stderr, "different entries: %s and %s\n", e0.name, e1.name);
+			return 1;
+		}
+		n++;
+		r0 = tagsNext (t0, &e0);
+		r1 = tagsNext (t1, &e1);
+	}
+	if (r0 != r1 || n == 0)
+	{
+		fprintf (stderr, "different number of entries\n");
+		return 1;
+	}
+	fprintf (stderr, "%d entries are the same\n", n);
+
+	for (size_t i = 0; i < sizeof (names) / sizeof (names [0]); i++)
+	{
+		for (int options = 0; options < 4; options++)
+		{
+			fprintf (stderr, "finding \"%s\" (%d)...", names [i], options);
+			r0 = tagsFind (t0, &e0, names [i], options);
+			r1 = tagsFind (t1, &e1, names [i], options);
+			while (r0 == TagSuccess && r1 == TagSuccess)
+			{
+				if (!same_entry (&e0, &e1))
+				{
+					fprintf (stderr, "different entries: %s and %s\n", e0.name, e1.name);
+					return 1;
+				}
+				r0 = tagsFindNext (t0, &e0);
+				r1 = tagsFindNext (t1, &e1);
+			}
+			if (r0 != r1 || tagsGetErrno (t0) != tagsGetErrno (t1))
+			{
+				fprintf (stderr, "different results\n");
+				return 1;
+			}
+			fprintf (stderr, "the same\n");
+		}
+	}
+
+	tagsClose (t0);
+	tagsClose (t1);
+	return 0;
+}
+
+int
+main (void)
+{
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("duplicated-names--sorted-yes.tags")
+		|| check_tags ("duplicated-names--sorted-no.tags")
+		|| check_tags ("duplicated-names--sorted-foldcase.tags"))
+		return 1;
+
+	fprintf (stderr, "opening a non-existing file...");
+	tagFileInfo info;
+	if (tagsOpenMapped ("./this-file-doesn-not-exist.tags", &info) != NULL
+		|| info.status.opened != 0)
+	{
+		fprintf (stderr, "opened unexpectedly\n");
+		return 1;
+	}
+	fprintf (stderr, "failed as expected\n");
+
+	return 0;
+}
@@ -0,0 +1,279 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released into the public domain.
+*
+*   Testing tagsOpenStream() API function
+*
+*   The stream of records is made from duplicated-names.c:
+*
+*   u-ctags --quiet --options=NONE -o duplicated-names--stream.tags \
+*           --kinds-C='*' --output-format=stream input.c
+*/
+
+#include "readtags.h"
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+static int
+same_entry (const tagEntry *a, const tagEntry *b)
+{
+	return (strcmp (a->name, b->name) == 0
+			&& strcmp (a->file, b->file) == 0
+			&& strcmp (a->address.pattern, b->address.pattern) == 0
+			&& a->address.lineNumber == b->address.lineNumber
+			&& ((a->kind == NULL && b->kind == NULL)
+				|| (a->kind && b->kind && strcmp (a->kind, b->kind) == 0))
+			&& a->fileScope == b->fileScope
+			&& a->fields.count == b->fields.count);
+}
+
+static int
+same_fields (const tagEntry *a, const tagEntry *b)
+{
+	for (unsigned short i = 0; i < a->fields.count; i++)
+	{
+		if (strcmp (a->fields.list [i].key, b->fields.list [i].key) != 0
+			|| strcmp (a->fields.list [i].value, b->fields.list [i].value) != 0)
+			return 0;
+	}
+	return 1;
+}
+
+static int
+check_tags (const char *tags)
+{
+	tagFileInfo info0, info1;
+	tagEntry e0, e1;
+	tagFile *t0, *t1;
+	FILE *fp;
+	int n = 0;
+
+	fprintf (stderr, "opening %s...", tags);
+	t0 = tagsOpen (tags, &info0);
+	if (t0 == NULL || info0.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t0, info0.status.opened);
+		return 1;
+	}
+	fp = fopen (tags, "rb");
+	if (fp == NULL)
+	{
+		perror ("fopen");
+		return 1;
+	}
+	t1 = tagsOpenStream (fp, &info1);
+	if (t1 == NULL || info1.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t1, info1.status.opened);
+		return 1;
+	}
+	if (info0.file.format != info1.file.format
+		|| info0.file.sort != info1.file.sort)
+	{
+		fprintf (stderr, "different pseudo tags\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "comparing entries...");
+	tagResult r0 = tagsFirst (t0, &e0);
+	tagResult r1 = tagsFirst (t1, &e1);
+	while (r0 == TagSuccess && r1 == TagSuccess)
+	{
+		if (!same_entry (&e0, &e1))
+		{
+			fprintf (stderr, "different entries: %s and %s\n", e0.name, e1.name);
+			return 1;
+		}
+		n++;
+		r0 = tagsNext (t0, &e0);
+		r1 = tagsNext (t1, &e1);
+	}
+	if (r0 != r1 || tagsGetErrno (t1) != 0)
+	{
+		fprintf (stderr, "different number of entries\n");
+		return 1;
+	}
+	fprintf (stderr, "%d entries are the same\n", n);
+
+	fprintf (stderr, "reading the stream again...");
+	if (tagsFirst (t1, &e1) != TagFailure || tagsGetErrno (t1) != ESPIPE)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	tagsClose (t0);
+	tagsClose (t1);
+
+	fprintf (stderr, "closing the stream...");
+	if (fclose (fp) != 0)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+	return 0;
+}
+
+static int
+check_find (const char *tags)
+{
+	tagFileInfo info;
+	tagEntry e;
+	tagFile *t;
+	FILE *fp = fopen (tags, "rb");
+
+	if (fp == NULL)
+	{
+		perror ("fopen");
+		return 1;
+	}
+
+	fprintf (stderr, "finding a tag in the stream...");
+	t = tagsOpenStream (fp, &info);
+	if (t == NULL
+		|| tagsFind (t, &e, "main", TAG_FULLMATCH) != TagFailure
+		|| tagsGetErrno (t) != ESPIPE)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	tagsClose (t);
+	fclose (fp);
+	fprintf (stderr, "ok\n");
+	return 0;
+}
+
+static int
+check_records (const char *text, const char *records)
+{
+	tagFileInfo info0, info1;
+	tagEntry e0, e1;
+	tagFile *t0, *t1;
+	FILE *fp;
+	int n = 0;
+
+	fprintf (stderr, "opening %s as a stream...", records);
+	t0 = tagsOpen (text, &info0);
+	fp = fopen (records, "rb");
+	if (t0 == NULL || fp == NULL)
+	{
+		fprintf (stderr, "unexpected result\n");
+		return 1;
+	}
+	t1 = tagsOpenStream (fp, &info1);
+	if (t1 == NULL || info1.status.opened == 0)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t1, info1.status.opened);
+		return 1;
+	}
+	if (info0.file.format != info1.file.format
+		|| info0.file.sort != info1.file.sort
+		|| info1.program.name == NULL
+		|| strcmp (info0.program.name, info1.program.name) != 0)
+	{
+		fprintf (stderr, "different pseudo tags\n");
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+
+	fprintf (stderr, "comparing entries...");
+	tagResult r0 = tagsFirst (t0, &e0);
+	tagResult r1 = tagsFirst (t1, &e1);
+	while (r0 == TagSuccess && r1 == TagSuccess)
+	{
+		if (!same_entry (&e0, &e1) || !same_fields (&e0, &e1))
+		{
+			fprintf (stderr, "different entries: %s and %s\n", e0.name, e1.name);
+			return 1;
+		}
+		n++;
+		r0 = tagsNext (t0, &e0);
+		r1 = tagsNext (t1, &e1);
+	}
+	if (r0 != r1 || tagsGetErrno (t1) != 0)
+	{
+		fprintf (stderr, "different number of entries\n");
+		return 1;
+	}
+	fprintf (stderr, "%d entries are the same\n", n);
+
+	tagsClose (t0);
+	tagsClose (t1);
+	fclose (fp);
+
+	fprintf (stderr, "opening %s by name...", records);
+	t1 = tagsOpen (records, &info1);
+	if (t1 != NULL || info1.status.opened != 0
+		|| info1.status.error_number != TagErrnoUnexpectedFormat)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t1, info1.status.opened);
+		return 1;
+	}
+	fprintf (stderr, "ok\n");
+	return 0;
+}
+
+static int
+check_binary (const char *tags)
+{
+	tagFileInfo info;
+	tagFile *t;
+	FILE *fp = fopen (tags, "rb");
+
+	if (fp == NULL)
+	{
+		perror ("fopen");
+		return 1;
+	}
+
+	fprintf (stderr, "opening %s as a stream...", tags);
+	t = tagsOpenStream (fp, &info);
+	if (t != NULL || info.status.opened != 0
+		|| info.status.error_number != TagErrnoUnexpectedFormat)
+	{
+		fprintf (stderr, "unexpected result (t: %p, opened: %d)\n",
+				 t, info.status.opened);
+		return 1;
+	}
+	fclose (fp);
+	fprintf (stderr, "ok\n");
+	return 0;
+}
+
+int
+main (void)
+{
+	char *srcdir = getenv ("srcdir");
+	if (srcdir)
+	{
+		if (chdir (srcdir) == -1)
+		{
+			perror ("chdir");
+			return 99;
+		}
+	}
+
+	if (check_tags ("duplicated-names--sorted-yes.tags")
+		|| check_tags ("empty.tags")
+		|| check_tags ("empty-no-newline.tags")
+		|| check_tags ("api-tagsMatchLine.tags")
+		|| check_find ("duplicated-names--sorted-yes.tags")
+		|| check_records ("duplicated-names--sorted-no.tags",
+						  "duplicated-names--stream.tags")
+		|| check_binary ("duplicated-names--binary-sorted-yes.tags"))
+		return 1;
+
+	return 0;
+}
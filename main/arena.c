@@ -0,0 +1,167 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for allocating many small objects that
+*   are released together.
+*
+*   An arena takes memory from chunks in order. A chunk is twice as large
+*   as the previous one up to MaxChunkSize, so allocating N objects calls
+*   malloc about log N times, and releasing them calls free as many times.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arena_p.h"
+#include "routines.h"
+
+/*
+*   MACROS
+*/
+
+/* What malloc guarantees on the common platforms */
+#define ARENA_ALIGNMENT (2 * sizeof (void *))
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sArenaChunk {
+	struct sArenaChunk *next;
+	size_t size;
+	size_t used;
+} arenaChunk;
+
+struct sArena {
+	arenaChunk *chunks;			/* the newest chunk first */
+	size_t chunkSize;			/* the size of the next chunk */
+};
+
+/*
+*   DATA DEFINITIONS
+*/
+static const size_t MaxChunkSize = 1024 * 1024;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static size_t alignSize (size_t size)
+{
+	return (size + ARENA_ALIGNMENT - 1) & ~(ARENA_ALIGNMENT - 1);
+}
+
+/* The data of a chunk follows its header. */
+static char *chunkData (const arenaChunk *chunk)
+{
+	return (char *) chunk + alignSize (sizeof (arenaChunk));
+}
+
+extern arena *arenaNew (size_t chunkSize)
+{
+	arena *a = xMalloc (1, arena);
+
+	a->chunks = NULL;
+	a->chunkSize = chunkSize;
+	return a;
+}
+
+extern void arenaDelete (arena *a)
+{
+	arenaChunk *chunk = a->chunks;
+
+	while (chunk)
+	{
+		arenaChunk *next = chunk->next;
+		eFree (chunk);
+		chunk = next;
+	}
+	eFree (a);
+}
+
+extern void arenaReset (arena *a)
+{
+	arenaChunk *chunk = a->chunks;
+
+	if (chunk == NULL)
+		return;
+
+	/* The newest chunk is the largest one but for an object larger than
+	 * the chunk size. */
+	while (chunk->next)
+	{
+		arenaChunk *next = chunk->next;
+		chunk->next = next->next;
+		eFree (next);
+	}
+	chunk->used = 0;
+}
+
+static void *allocate (arena *a, size_t size, bool aligned)
+{
+	arenaChunk *chunk = a->chunks;
+	size_t offset = 0;
+	void *r;
+
+	if (chunk)
+		offset = aligned? alignSize (chunk->used): chunk->used;
+
+	if (chunk == NULL || offset > chunk->size || chunk->size - offset < size)
+	{
+		size_t chunkSize = a->chunkSize;
+
+		if (chunkSize < size)
+			chunkSize = size;
+		else if (a->chunkSize < MaxChunkSize)
+			a->chunkSize *= 2;
+
+		chunk = eMalloc (alignSize (sizeof (arenaChunk)) + chunkSize);
+		chunk->next = a->chunks;
+		chunk->size = chunkSize;
+		chunk->used = 0;
+		a->chunks = chunk;
+		offset = 0;
+	}
+
+	r = chunkData (chunk) + offset;
+	chunk->used = offset + size;
+	return r;
+}
+
+extern void *arenaAlloc (arena *a, size_t size)
+{
+	return allocate (a, size, true);
+}
+
+extern char *arenaStrndup (arena *a, const char *const s, size_t length)
+{
+	char *r = allocate (a, length + 1, false);
+
+	memcpy (r, s, length);
+	r [length] = '\0';
+	return r;
+}
+
+extern char *arenaStrdup (arena *a, const char *const s)
+{
+	return arenaStrndup (a, s, strlen (s));
+}
+
+extern bool arenaOwns (const arena *a, const void *p)
+{
+	for (const arenaChunk *chunk = a->chunks; chunk; chunk = chunk->next)
+	{
+		uintptr_t data = (uintptr_t) chunkData (chunk);
+
+		if (data <= (uintptr_t) p && (uintptr_t) p < data + chunk->used)
+			return true;
+	}
+	return false;
+}
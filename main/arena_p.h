@@ -0,0 +1,42 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to bump allocators releasing all their objects at once.
+*/
+#ifndef CTAGS_MAIN_ARENA_PRIVATE_H
+#define CTAGS_MAIN_ARENA_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stddef.h>
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sArena arena;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern arena *arenaNew (size_t chunkSize);
+/* Release all the objects allocated in ARENA. */
+extern void arenaDelete (arena *a);
+/* Release all the objects allocated in ARENA, keeping its largest chunk
+ * for the objects allocated next. */
+extern void arenaReset (arena *a);
+
+/* The memory is aligned for any object. It cannot be freed one by one. */
+extern void *arenaAlloc (arena *a, size_t size);
+extern char *arenaStrdup (arena *a, const char *const s);
+extern char *arenaStrndup (arena *a, const char *const s, size_t length);
+
+/* Whether P points into an object allocated in ARENA */
+extern bool arenaOwns (const arena *a, const void *p);
+
+#endif	/* CTAGS_MAIN_ARENA_PRIVATE_H */
@@ -0,0 +1,147 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for interning strings.
+*
+*   Names of scopes, types, and identifiers appear many times in an input
+*   file. Interning a string stores its contents only once; the following
+*   requests for the same contents return the same pointer without
+*   allocating memory. The contents are stored in an arena, and all the
+*   atoms are released at once at the end of parsing an input file.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "arena_p.h"
+#include "atom.h"
+#include "debug.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "trashbox.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sAtomSlot {
+	const char *string;			/* NULL for an empty slot */
+	size_t length;
+	uint64_t hash;
+} atomSlot;
+
+typedef struct sAtomTable {
+	atomSlot *slots;
+	unsigned int size;			/* power of 2 */
+	unsigned int count;
+	arena *strings;
+} atomTable;
+
+/*
+*   DATA DEFINITIONS
+*/
+static const unsigned int InitialTableSize = 256;
+static const size_t InitialChunkSize = 4096;
+
+static atomTable *Atoms;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deleteAtomTable (atomTable *table)
+{
+	if (table == Atoms)
+		Atoms = NULL;
+
+	arenaDelete (table->strings);
+	eFree (table->slots);
+	eFree (table);
+}
+
+/* The table lives until the parser trash box is emptied at the end of
+ * parsing the current input file. */
+static atomTable *getAtomTable (void)
+{
+	if (Atoms == NULL)
+	{
+		Atoms = xMalloc (1, atomTable);
+		Atoms->size = InitialTableSize;
+		Atoms->slots = xCalloc (Atoms->size, atomSlot);
+		Atoms->count = 0;
+		Atoms->strings = arenaNew (InitialChunkSize);
+		PARSER_TRASH_BOX (Atoms, deleteAtomTable);
+	}
+	return Atoms;
+}
+
+static void growAtomTable (atomTable *table)
+{
+	unsigned int size = table->size * 2;
+	atomSlot *slots = xCalloc (size, atomSlot);
+
+	for (unsigned int i = 0; i < table->size; i++)
+	{
+		unsigned int j;
+
+		if (table->slots [i].string == NULL)
+			continue;
+		for (j = table->slots [i].hash & (size - 1);
+			 slots [j].string != NULL;
+			 j = (j + 1) & (size - 1))
+			;
+		slots [j] = table->slots [i];
+	}
+	eFree (table->slots);
+	table->slots = slots;
+	table->size = size;
+}
+
+extern const char *internStringN (const char *const s, size_t length)
+{
+	atomTable *table = getAtomTable ();
+	uint64_t hash = hashBytes (FNV1A_INITIAL_HASH, s, length);
+	unsigned int i;
+
+	for (i = hash & (table->size - 1);
+		 table->slots [i].string != NULL;
+		 i = (i + 1) & (table->size - 1))
+	{
+		const atomSlot *const slot = table->slots + i;
+
+		if (slot->hash == hash && slot->length == length
+			&& memcmp (slot->string, s, length) == 0)
+			return slot->string;
+	}
+
+	table->slots [i].string = arenaStrndup (table->strings, s, length);
+	table->slots [i].length = length;
+	table->slots [i].hash = hash;
+	table->count++;
+
+	/* Keep the load factor at most 1/2. */
+	if (table->count * 2 > table->size)
+	{
+		const char *r = table->slots [i].string;
+		growAtomTable (table);
+		return r;
+	}
+	return table->slots [i].string;
+}
+
+extern const char *internString (const char *const s)
+{
+	return internStringN (s, strlen (s));
+}
+
+extern bool isInternedString (const char *const s)
+{
+	return Atoms && arenaOwns (Atoms->strings, s);
+}
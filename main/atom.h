@@ -0,0 +1,32 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to the table of interned strings (atoms).
+*/
+#ifndef CTAGS_MAIN_ATOM_H
+#define CTAGS_MAIN_ATOM_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stddef.h>
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Return the atom for S: a string having the same contents as S. The same
+ * atom is returned for the same contents, so atoms can be compared with
+ * "==". An atom must not be modified nor freed. It is valid until the end
+ * of parsing the current input file. */
+extern const char *internString (const char *const s);
+extern const char *internStringN (const char *const s, size_t length);
+
+extern bool isInternedString (const char *const s);
+
+#endif  /* CTAGS_MAIN_ATOM_H */
@@ -0,0 +1,365 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for finding delimiter bytes in a buffer.
+*
+*   Tokenizers skip comments and strings by looking for the few bytes
+*   ending them. findByte () uses memchr (), which C libraries already
+*   vectorize. findByte2 () compares 16 bytes at once with SSE2 or NEON
+*   when the compiler targets them, and falls back to a byte loop.
+*
+*   Writers escaping tag names, patterns and field values look for the
+*   bytes to quote with findByteInSet () and findControlOrByte (), and
+*   copy the runs between them in bulk.
+*
+*   SSE2 is a part of x86-64 and NEON a part of AArch64, so they are
+*   chosen at compile time. AVX2 is not; on x86 the long runs are
+*   scanned 32 bytes at once when the CPU running ctags has AVX2, which
+*   is checked once with __builtin_cpu_supports (). The AVX2 loops stop
+*   at the first match or at the last 32 bytes, and the SSE2 and byte
+*   loops go on from there.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#if defined (__SSE2__) && defined (__GNUC__)
+# define BYTESCAN_SSE2
+# include <emmintrin.h>
+# if (defined (__x86_64__) || defined (__i386__)) \
+	&& (defined (__clang__) || __GNUC__ >= 5)
+#  define BYTESCAN_AVX2
+#  include <immintrin.h>
+# endif
+#elif defined (__ARM_NEON) && defined (__aarch64__)
+# define BYTESCAN_NEON
+# include <arm_neon.h>
+#endif
+
+#include "bytescan.h"
+
+/*
+*   DATA DEFINITIONS
+*/
+#ifdef BYTESCAN_AVX2
+static int HasAvx2 = -1;
+#endif
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+#ifdef BYTESCAN_AVX2
+static bool hasAvx2 (void)
+{
+	if (HasAvx2 < 0)
+	{
+		__builtin_cpu_init ();
+		HasAvx2 = __builtin_cpu_supports ("avx2")? 1: 0;
+	}
+	return HasAvx2;
+}
+
+/* The AVX2 loops are worth entering only for a run this long. */
+#define AVX2_MIN_RUN 64
+
+__attribute__((target("avx2")))
+static const unsigned char *findByteInSetAvx2 (const unsigned char *s, const unsigned char *end,
+											   const unsigned char *set, unsigned int n)
+{
+	for (; end - s >= 32; s += 32)
+	{
+		const __m256i v = _mm256_loadu_si256 ((const __m256i *) s);
+		__m256i m = _mm256_cmpeq_epi8 (v, _mm256_set1_epi8 ((char) set[0]));
+		unsigned int mask;
+
+		for (unsigned int i = 1; i < n; i++)
+			m = _mm256_or_si256 (m, _mm256_cmpeq_epi8 (v, _mm256_set1_epi8 ((char) set[i])));
+		mask = (unsigned int) _mm256_movemask_epi8 (m);
+		if (mask)
+			return s + __builtin_ctz (mask);
+	}
+	return s;
+}
+
+__attribute__((target("avx2")))
+static const unsigned char *findControlOrByteAvx2 (const unsigned char *s, const unsigned char *end,
+												   unsigned char c)
+{
+	const __m256i v1f = _mm256_set1_epi8 (0x1F);
+	const __m256i v7f = _mm256_set1_epi8 (0x7F);
+	const __m256i vc = _mm256_set1_epi8 ((char) c);
+
+	for (; end - s >= 32; s += 32)
+	{
+		const __m256i v = _mm256_loadu_si256 ((const __m256i *) s);
+		const __m256i ctrl = _mm256_cmpeq_epi8 (_mm256_min_epu8 (v, v1f), v);
+		const unsigned int mask = (unsigned int) _mm256_movemask_epi8 (
+			_mm256_or_si256 (ctrl, _mm256_or_si256 (_mm256_cmpeq_epi8 (v, v7f),
+													_mm256_cmpeq_epi8 (v, vc))));
+		if (mask)
+			return s + __builtin_ctz (mask);
+	}
+	return s;
+}
+
+__attribute__((target("avx2")))
+static const unsigned char *countByteAvx2 (const unsigned char *s, const unsigned char *end,
+										   unsigned char c, size_t *count)
+{
+	const __m256i vc = _mm256_set1_epi8 ((char) c);
+	size_t n = 0;
+
+	for (; end - s >= 32; s += 32)
+	{
+		const __m256i v = _mm256_loadu_si256 ((const __m256i *) s);
+		n += __builtin_popcount ((unsigned int) _mm256_movemask_epi8 (_mm256_cmpeq_epi8 (v, vc)));
+	}
+	*count += n;
+	return s;
+}
+
+__attribute__((target("avx2")))
+static const unsigned char *findNonAsciiAvx2 (const unsigned char *s, const unsigned char *end)
+{
+	for (; end - s >= 32; s += 32)
+	{
+		const unsigned int mask = (unsigned int) _mm256_movemask_epi8 (
+			_mm256_loadu_si256 ((const __m256i *) s));
+		if (mask)
+			return s + __builtin_ctz (mask);
+	}
+	return s;
+}
+#endif
+
+extern const unsigned char *findByte (const unsigned char *s, const unsigned char *end,
+									  unsigned char c)
+{
+	const unsigned char *p;
+
+	if (s >= end)
+		return end;
+	p = memchr (s, c, end - s);
+	return p? p: end;
+}
+
+extern const unsigned char *findByte2 (const unsigned char *s, const unsigned char *end,
+									   unsigned char c0, unsigned char c1)
+{
+	if (c0 == c1)
+		return findByte (s, end, c0);
+
+#if defined (BYTESCAN_SSE2)
+# ifdef BYTESCAN_AVX2
+	if (end - s >= AVX2_MIN_RUN && hasAvx2 ())
+	{
+		const unsigned char set [2] = { c0, c1 };
+		s = findByteInSetAvx2 (s, end, set, 2);
+	}
+# endif
+	const __m128i v0 = _mm_set1_epi8 ((char) c0);
+	const __m128i v1 = _mm_set1_epi8 ((char) c1);
+
+	for (; end - s >= 16; s += 16)
+	{
+		const __m128i v = _mm_loadu_si128 ((const __m128i *) s);
+		const int mask = _mm_movemask_epi8 (_mm_or_si128 (_mm_cmpeq_epi8 (v, v0),
+														  _mm_cmpeq_epi8 (v, v1)));
+		if (mask)
+			return s + __builtin_ctz ((unsigned int) mask);
+	}
+#elif defined (BYTESCAN_NEON)
+	const uint8x16_t v0 = vdupq_n_u8 (c0);
+	const uint8x16_t v1 = vdupq_n_u8 (c1);
+
+	for (; end - s >= 16; s += 16)
+	{
+		const uint8x16_t v = vld1q_u8 (s);
+		if (vmaxvq_u8 (vorrq_u8 (vceqq_u8 (v, v0), vceqq_u8 (v, v1))))
+			break;				/* the byte loop finds it in these 16 bytes */
+	}
+#endif
+
+	for (; s < end; s++)
+	{
+		if (*s == c0 || *s == c1)
+			return s;
+	}
+	return end;
+}
+
+extern const unsigned char *findByteInSet (const unsigned char *s, const unsigned char *end,
+										   const unsigned char *set, unsigned int n)
+{
+	unsigned int i;
+
+	if (n == 0)
+		return end;
+	else if (n == 1)
+		return findByte (s, end, set[0]);
+	else if (n == 2)
+		return findByte2 (s, end, set[0], set[1]);
+
+#if defined (BYTESCAN_SSE2)
+# ifdef BYTESCAN_AVX2
+	if (end - s >= AVX2_MIN_RUN && hasAvx2 ())
+		s = findByteInSetAvx2 (s, end, set, n);
+# endif
+	for (; end - s >= 16; s += 16)
+	{
+		const __m128i v = _mm_loadu_si128 ((const __m128i *) s);
+		__m128i m = _mm_cmpeq_epi8 (v, _mm_set1_epi8 ((char) set[0]));
+		int mask;
+
+		for (i = 1; i < n; i++)
+			m = _mm_or_si128 (m, _mm_cmpeq_epi8 (v, _mm_set1_epi8 ((char) set[i])));
+		mask = _mm_movemask_epi8 (m);
+		if (mask)
+			return s + __builtin_ctz ((unsigned int) mask);
+	}
+#elif defined (BYTESCAN_NEON)
+	for (; end - s >= 16; s += 16)
+	{
+		const uint8x16_t v = vld1q_u8 (s);
+		uint8x16_t m = vceqq_u8 (v, vdupq_n_u8 (set[0]));
+
+		for (i = 1; i < n; i++)
+			m = vorrq_u8 (m, vceqq_u8 (v, vdupq_n_u8 (set[i])));
+		if (vmaxvq_u8 (m))
+			break;				/* the byte loop finds it in these 16 bytes */
+	}
+#endif
+
+	for (; s < end; s++)
+	{
+		for (i = 0; i < n; i++)
+		{
+			if (*s == set[i])
+				return s;
+		}
+	}
+	return end;
+}
+
+extern const unsigned char *findControlOrByte (const unsigned char *s, const unsigned char *end,
+											   unsigned char c)
+{
+#if defined (BYTESCAN_SSE2)
+	const __m128i v1f = _mm_set1_epi8 (0x1F);
+	const __m128i v7f = _mm_set1_epi8 (0x7F);
+	const __m128i vc = _mm_set1_epi8 ((char) c);
+
+# ifdef BYTESCAN_AVX2
+	if (end - s >= AVX2_MIN_RUN && hasAvx2 ())
+		s = findControlOrByteAvx2 (s, end, c);
+# endif
+	for (; end - s >= 16; s += 16)
+	{
+		const __m128i v = _mm_loadu_si128 ((const __m128i *) s);
+		/* min (v, 0x1F) == v holds for unsigned v <= 0x1F. */
+		const __m128i ctrl = _mm_cmpeq_epi8 (_mm_min_epu8 (v, v1f), v);
+		const int mask = _mm_movemask_epi8 (_mm_or_si128 (ctrl,
+														  _mm_or_si128 (_mm_cmpeq_epi8 (v, v7f),
+																		_mm_cmpeq_epi8 (v, vc))));
+		if (mask)
+			return s + __builtin_ctz ((unsigned int) mask);
+	}
+#elif defined (BYTESCAN_NEON)
+	const uint8x16_t v1f = vdupq_n_u8 (0x1F);
+	const uint8x16_t v7f = vdupq_n_u8 (0x7F);
+	const uint8x16_t vc = vdupq_n_u8 (c);
+
+	for (; end - s >= 16; s += 16)
+	{
+		const uint8x16_t v = vld1q_u8 (s);
+		if (vmaxvq_u8 (vorrq_u8 (vcleq_u8 (v, v1f),
+								 vorrq_u8 (vceqq_u8 (v, v7f), vceqq_u8 (v, vc)))))
+			break;				/* the byte loop finds it in these 16 bytes */
+	}
+#endif
+
+	for (; s < end; s++)
+	{
+		if (*s <= 0x1F || *s == 0x7F || *s == c)
+			return s;
+	}
+	return end;
+}
+
+extern const unsigned char *findByte3 (const unsigned char *s, const unsigned char *end,
+									   unsigned char c0, unsigned char c1, unsigned char c2)
+{
+	const unsigned char set [3] = { c0, c1, c2 };
+
+	return findByteInSet (s, end, set, 3);
+}
+
+extern size_t countByte (const unsigned char *s, const unsigned char *end,
+						 unsigned char c)
+{
+	size_t n = 0;
+
+#if defined (BYTESCAN_SSE2)
+	const __m128i vc = _mm_set1_epi8 ((char) c);
+
+# ifdef BYTESCAN_AVX2
+	if (end - s >= AVX2_MIN_RUN && hasAvx2 ())
+		s = countByteAvx2 (s, end, c, &n);
+# endif
+	for (; end - s >= 16; s += 16)
+	{
+		const __m128i v = _mm_loadu_si128 ((const __m128i *) s);
+		n += __builtin_popcount ((unsigned int) _mm_movemask_epi8 (_mm_cmpeq_epi8 (v, vc)));
+	}
+#elif defined (BYTESCAN_NEON)
+	const uint8x16_t vc = vdupq_n_u8 (c);
+	const uint8x16_t one = vdupq_n_u8 (1);
+
+	for (; end - s >= 16; s += 16)
+		n += vaddvq_u8 (vandq_u8 (vceqq_u8 (vld1q_u8 (s), vc), one));
+#endif
+
+	for (; s < end; s++)
+	{
+		if (*s == c)
+			n++;
+	}
+	return n;
+}
+
+extern const unsigned char *findNonAscii (const unsigned char *s, const unsigned char *end)
+{
+#if defined (BYTESCAN_SSE2)
+# ifdef BYTESCAN_AVX2
+	if (end - s >= AVX2_MIN_RUN && hasAvx2 ())
+		s = findNonAsciiAvx2 (s, end);
+# endif
+	for (; end - s >= 16; s += 16)
+	{
+		const int mask = _mm_movemask_epi8 (_mm_loadu_si128 ((const __m128i *) s));
+		if (mask)
+			return s + __builtin_ctz ((unsigned int) mask);
+	}
+#elif defined (BYTESCAN_NEON)
+	for (; end - s >= 16; s += 16)
+	{
+		if (vmaxvq_u8 (vld1q_u8 (s)) & 0x80)
+			break;				/* the byte loop finds it in these 16 bytes */
+	}
+#endif
+
+	for (; s < end; s++)
+	{
+		if (*s & 0x80)
+			return s;
+	}
+	return end;
+}
@@ -0,0 +1,55 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to finding delimiter bytes in a buffer.
+*/
+#ifndef CTAGS_MAIN_BYTESCAN_H
+#define CTAGS_MAIN_BYTESCAN_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Return the first byte equal to C in [S, END), or END if there is none. */
+extern const unsigned char *findByte (const unsigned char *s, const unsigned char *end,
+									  unsigned char c);
+
+/* Return the first byte equal to C0 or C1 in [S, END), or END if there
+ * is none. */
+extern const unsigned char *findByte2 (const unsigned char *s, const unsigned char *end,
+									   unsigned char c0, unsigned char c1);
+
+/* Return the first byte equal to C0, C1, or C2 in [S, END), or END if
+ * there is none. */
+extern const unsigned char *findByte3 (const unsigned char *s, const unsigned char *end,
+									   unsigned char c0, unsigned char c1, unsigned char c2);
+
+/* Return the first byte in [S, END) equal to one of the N bytes at SET,
+ * or END if there is none. N should be small; each byte of SET costs a
+ * comparison per 16 input bytes. */
+extern const unsigned char *findByteInSet (const unsigned char *s, const unsigned char *end,
+										   const unsigned char *set, unsigned int n);
+
+/* Return the first byte in [S, END) that is a control character
+ * (0x00 to 0x1F, or 0x7F) or equal to C, or END if there is none. */
+extern const unsigned char *findControlOrByte (const unsigned char *s, const unsigned char *end,
+											   unsigned char c);
+
+/* Return the number of the bytes equal to C in [S, END), e.g. the
+ * newlines in a buffer. */
+extern size_t countByte (const unsigned char *s, const unsigned char *end,
+						 unsigned char c);
+
+/* Return the first byte in [S, END) not in ASCII (0x80 or above), or
+ * END if all the bytes are in ASCII. */
+extern const unsigned char *findNonAscii (const unsigned char *s, const unsigned char *end);
+
+#endif  /* CTAGS_MAIN_BYTESCAN_H */
@@ -0,0 +1,354 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for tagging input files with the same
+*   contents once (--dedup-content).
+*
+*   The tags written for an input file are recorded with a hash of its
+*   contents. The tags for another input file with the same contents,
+*   size, and language are written from the record with the input field
+*   replaced, instead of parsing the file again. The contents are hashed
+*   from the stream opened for parsing, which keeps the whole file in
+*   memory unless the file is large.
+*
+*   An anonymous name has a hash of the path of the input file. It is
+*   replaced with the hash for the file tagged from the record. The tags
+*   of an input file are not recorded if the hash may be found in them
+*   other than in the anonymous names, or if the input field of a tag is
+*   not the path of the file, like the tags after a #line directive.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "debug.h"
+#include "dedup_p.h"
+#include "entry_p.h"
+#include "htable.h"
+#include "options_p.h"
+#include "parse.h"
+#include "parse_p.h"
+#include "ptag_p.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "vstring.h"
+#include "xtag.h"
+
+/*
+*   MACROS
+*/
+#define DEDUP_RECORD_LIMIT (64UL * 1024 * 1024)	/* bytes of tags recorded */
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sDedupEntry {
+	uint64_t hash;				/* of the contents */
+	unsigned long size;
+	langType language;
+	char *baseName;				/* the name of the file tag, or NULL */
+	char *fileName;				/* the input file tagged first */
+	char anonHash [9];			/* in the anonymous names in tags, or "" */
+	char *tags;					/* without pseudo tags; NULL if not reusable */
+	size_t length;				/* of tags */
+	size_t fieldLength;			/* of the input field in tags */
+} dedupEntry;
+
+/*
+*   DATA DEFINITIONS
+*/
+static hashTable *Entries;		/* dedupEntry -> itself */
+static dedupEntry *Pending;		/* for the input file being tagged */
+static MIO *PendingMio;			/* its contents */
+static vString *PendingField;	/* the input field of its tags */
+static size_t RecordedBytes;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static unsigned int hashDedupEntry (const void *const key)
+{
+	const dedupEntry *entry = key;
+
+	return (unsigned int) (entry->hash ^ (entry->hash >> 32));
+}
+
+static bool isSameDedupEntry (const void *a, const void *b)
+{
+	const dedupEntry *x = a;
+	const dedupEntry *y = b;
+
+	return x->hash == y->hash && x->size == y->size
+		&& x->language == y->language
+		&& (x->baseName == y->baseName
+			|| (x->baseName && y->baseName
+				&& strcmp (x->baseName, y->baseName) == 0));
+}
+
+static void deleteDedupEntry (void *data)
+{
+	dedupEntry *entry = data;
+
+	if (entry->baseName)
+		eFree (entry->baseName);
+	eFree (entry->fileName);
+	if (entry->tags)
+		eFree (entry->tags);
+	eFree (entry);
+}
+
+static unsigned long getMioSize (MIO *mio)
+{
+	size_t size;
+	long end;
+
+	if (mio_memory_get_data (mio, &size))
+		return (unsigned long) size;
+
+	if (mio_seek (mio, 0, SEEK_END) != 0)
+		return 0;
+	end = mio_tell (mio);
+	mio_rewind (mio);
+	return end < 0? 0: (unsigned long) end;
+}
+
+static const char *findBytes (const char *s, size_t length,
+							  const char *bytes, size_t n)
+{
+	const char *const end = s + length;
+
+	while ((size_t) (end - s) >= n)
+	{
+		const char *p = memchr (s, bytes [0], (end - s) - n + 1);
+
+		if (p == NULL)
+			return NULL;
+		if (memcmp (p, bytes, n) == 0)
+			return p;
+		s = p + 1;
+	}
+	return NULL;
+}
+
+/* Append LENGTH bytes at S to LINE with the hash FROM in anonymous names
+ * replaced with TO. FROM is "" if no anonymous name is made. */
+static void catWithAnonHash (vString *line, const char *s, size_t length,
+							 const char *from, const char *to)
+{
+	const char *const end = s + length;
+	const char *p;
+
+	if (from [0] != '\0')
+	{
+		while ((p = findBytes (s, end - s, from, 8)) != NULL)
+		{
+			vStringNCatS (line, s, p - s);
+			vStringNCatS (line, to, 8);
+			s = p + 8;
+		}
+	}
+	vStringNCatS (line, s, end - s);
+}
+
+/* Write the tags of ENTRY for FILENAME. */
+static void replayDedupEntry (const dedupEntry *const entry,
+							  const char *const fileName)
+{
+	vString *field = makeTagFileInputField (fileName);
+	vString *line = vStringNew ();
+	const char *p = entry->tags;
+	const char *const end = entry->tags + entry->length;
+	char anonHash [9] = "";
+
+	verbose ("tagging %s with the tags of %s of the same contents\n",
+			 fileName, entry->fileName);
+
+	if (entry->anonHash [0] != '\0')
+		anonHashString (fileName, anonHash);
+
+	makeParserPseudoTags (entry->language);
+	while (p < end)
+	{
+		const char *eol = memchr (p, '\n', end - p);
+		const char *tab = memchr (p, '\t', eol - p);
+		const char *rest = tab + 1 + entry->fieldLength;
+
+		vStringClear (line);
+		catWithAnonHash (line, p, tab + 1 - p, entry->anonHash, anonHash);
+		vStringCat (line, field);
+		catWithAnonHash (line, rest, eol + 1 - rest, entry->anonHash, anonHash);
+		copyLineToTagFile (vStringValue (line));
+		p = eol + 1;
+	}
+
+	vStringDelete (line);
+	vStringDelete (field);
+}
+
+extern bool beginDedupContent (const char *const fileName, langType language,
+							   MIO *mio)
+{
+	dedupEntry key;
+	dedupEntry *entry;
+
+	Assert (Pending == NULL);
+
+	/* The ids in the input field are not rewritten. */
+	if (isInputFileIdEnabled ())
+		return false;
+
+	key.hash = hashMioContents (mio);
+	if (key.hash == 0)
+		return false;
+	key.size = getMioSize (mio);
+	key.language = language;
+	key.baseName = isXtagEnabled (XTAG_FILE_NAMES)
+		? (char *) baseFilename (fileName): NULL;
+
+	if (Entries == NULL)
+		Entries = hashTableNew (1024, hashDedupEntry, isSameDedupEntry,
+								deleteDedupEntry, NULL);
+
+	entry = hashTableGetItem (Entries, &key);
+	if (entry)
+	{
+		if (entry->tags == NULL)
+			return false;
+		replayDedupEntry (entry, fileName);
+		return true;
+	}
+
+	if (RecordedBytes >= DEDUP_RECORD_LIMIT)
+		return false;
+
+	Pending = xMalloc (1, dedupEntry);
+	*Pending = key;
+	if (key.baseName)
+		Pending->baseName = eStrdup (key.baseName);
+	Pending->fileName = eStrdup (fileName);
+	Pending->anonHash [0] = '\0';
+	Pending->tags = NULL;
+	Pending->length = 0;
+	PendingMio = mio_ref (mio);
+
+	if (PendingField == NULL)
+		PendingField = vStringNew ();
+	vString *field = makeTagFileInputField (fileName);
+	vStringCopy (PendingField, field);
+	vStringDelete (field);
+	Pending->fieldLength = vStringLength (PendingField);
+
+	beginTagFileCapture ();
+	return false;
+}
+
+/* Copy the tag lines in DATA to ENTRY dropping the pseudo tags. Return
+ * false if the input field of a tag is not FIELD. */
+static bool recordDedupTags (dedupEntry *const entry,
+							 const char *data, size_t size,
+							 const vString *const field)
+{
+	const char *p = data;
+	const char *const end = data + size;
+	char *out;
+
+	entry->tags = xMalloc (size + 1, char);
+	out = entry->tags;
+	while (p < end)
+	{
+		const char *eol = memchr (p, '\n', end - p);
+		const char *tab;
+
+		if (eol == NULL)
+			return false;
+		eol++;
+		if (strncmp (p, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) != 0)
+		{
+			tab = memchr (p, '\t', eol - p);
+			if (tab == NULL
+				|| (size_t) (eol - tab) < vStringLength (field) + 2
+				|| memcmp (tab + 1, vStringValue (field), vStringLength (field)) != 0
+				|| tab [1 + vStringLength (field)] != '\t')
+				return false;
+			memcpy (out, p, eol - p);
+			out += eol - p;
+		}
+		p = eol;
+	}
+	entry->length = out - entry->tags;
+	return true;
+}
+
+/* Whether the hash of the input file in the anonymous names of ENTRY
+ * can be found other than in the names. */
+static bool isAnonHashAmbiguous (const dedupEntry *const entry, MIO *contents)
+{
+	size_t size;
+	const char *data = (const char *) mio_memory_get_data (contents, &size);
+
+	/* The tags are made from the contents and the path. */
+	return data == NULL
+		|| findBytes (data, size, entry->anonHash, 8)
+		|| strstr (entry->fileName, entry->anonHash);
+}
+
+extern void endDedupContent (bool anonymous)
+{
+	MIO *mio;
+	unsigned char *data;
+	size_t size;
+	bool reusable = true;
+
+	if (Pending == NULL)
+		return;
+
+	mio = endTagFileCapture ();
+	data = mio_memory_get_data (mio, &size);
+
+	if (anonymous)
+	{
+		anonHashString (Pending->fileName, Pending->anonHash);
+		reusable = !isAnonHashAmbiguous (Pending, PendingMio);
+	}
+	mio_unref (PendingMio);
+	PendingMio = NULL;
+
+	if (!reusable || !recordDedupTags (Pending, (char *) data, size, PendingField))
+	{
+		if (Pending->tags)
+		{
+			eFree (Pending->tags);
+			Pending->tags = NULL;
+		}
+	}
+	else
+	{
+		Pending->tags = eRealloc (Pending->tags, Pending->length + 1);
+		RecordedBytes += Pending->length;
+	}
+	mio_unref (mio);
+
+	hashTablePutItem (Entries, Pending, Pending);
+	Pending = NULL;
+}
+
+extern void freeDedupContent (void)
+{
+	if (Entries)
+	{
+		hashTableDelete (Entries);
+		Entries = NULL;
+	}
+	vStringDelete (PendingField);
+	PendingField = NULL;
+	RecordedBytes = 0;
+}
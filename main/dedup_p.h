@@ -0,0 +1,39 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for tagging input files with the same contents once
+*   (--dedup-content).
+*/
+#ifndef CTAGS_MAIN_DEDUP_PRIVATE_H
+#define CTAGS_MAIN_DEDUP_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "mio.h"
+#include "types.h"
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Return true if the tags for FILENAME are written to the tag file from
+ * the tags of an input file tagged before with the same contents, read
+ * from MIO, and LANGUAGE. Otherwise, the tags written for FILENAME until
+ * endDedupContent () is called are recorded. */
+extern bool beginDedupContent (const char *const fileName, langType language,
+							   MIO *mio);
+
+/* Stop recording the tags for the input file given to beginDedupContent (),
+ * and keep them for the input files with the same contents. ANONYMOUS is
+ * true if an anonymous name is made for the file. */
+extern void endDedupContent (bool anonymous);
+
+extern void freeDedupContent (void);
+
+#endif	/* CTAGS_MAIN_DEDUP_PRIVATE_H */
@@ -14,6 +14,8 @@
 
 #include "debug.h"
 #include "dependency.h"
+#include "entry.h"
+#include "kind.h"
 #include "options.h"
 #include "parse_p.h"
 #include "read.h"
@@ -31,6 +33,13 @@ struct slaveControlBlock {
 	subparser   *subparsersDefault;
 	subparser   *subparsersInUse;
 	langType     owner;
+
+	/* The subparsers having makeTagEntryNotify in subparsersDefault,
+	   listed for each kind of the owner. notifiers[notifierKindCount]
+	   lists them all for the other tags. Each list is terminated with
+	   NULL. */
+	subparser ***notifiers;
+	unsigned int notifierKindCount;
 };
 
 extern void linkDependencyAtInitializeParsing (depType dtype,
@@ -72,15 +81,72 @@ extern struct slaveControlBlock *allocSlaveControlBlock (parserDefinition *parse
 	cb->subparsersDefault = NULL;
 	cb->subparsersInUse = NULL;
 	cb->owner = parser->id;
+	cb->notifiers = NULL;
+	cb->notifierKindCount = 0;
 
 	return cb;
 }
 
+static void freeNotifiers (struct slaveControlBlock *cb)
+{
+	if (cb->notifiers == NULL)
+		return;
+
+	for (unsigned int k = 0; k <= cb->notifierKindCount; k++)
+		eFree (cb->notifiers[k]);
+	eFree (cb->notifiers);
+	cb->notifiers = NULL;
+}
+
 extern void freeSlaveControlBlock (struct slaveControlBlock *cb)
 {
+	freeNotifiers (cb);
 	eFree (cb);
 }
 
+static bool isNotifiedOfKind (subparser *s, int kindIndex)
+{
+	const int *k = s->makeTagEntryNotifyKinds;
+
+	if (k == NULL || kindIndex == KIND_GHOST_INDEX)
+		return true;
+
+	for (; *k != KIND_GHOST_INDEX; k++)
+		if (*k == kindIndex)
+			return true;
+	return false;
+}
+
+/* Make the lists of the subparsers to call for the tags of each kind
+   so that makeTagEntry doesn't visit the subparsers not interested in
+   the tag. */
+static void buildNotifiers (struct slaveControlBlock *cb)
+{
+	unsigned int count = 0, kindCount;
+	subparser *s;
+
+	for (s = cb->subparsersDefault; s; s = s->next)
+		count++;
+
+	freeNotifiers (cb);
+	kindCount = countLanguageKinds (cb->owner);
+	cb->notifiers = xMalloc (kindCount + 1, subparser **);
+	cb->notifierKindCount = kindCount;
+	for (unsigned int k = 0; k <= kindCount; k++)
+	{
+		int kindIndex = (k == kindCount)? KIND_GHOST_INDEX: (int) k;
+		unsigned int n = 0;
+
+		cb->notifiers[k] = xMalloc (count + 1, subparser *);
+		for (s = cb->subparsersDefault; s; s = s->next)
+		{
+			if (s->makeTagEntryNotify && isNotifiedOfKind (s, kindIndex))
+				cb->notifiers[k][n++] = s;
+		}
+		cb->notifiers[k][n] = NULL;
+	}
+}
+
 extern void initializeDependencies (parserDefinition *parser,
 									struct slaveControlBlock *cb)
 {
@@ -113,6 +179,7 @@ extern void initializeDependencies (parserDefinition *parser,
 		}
 		sp = sp->next;
 	}
+	buildNotifiers (cb);
 
 	/* Initialize masters that act as base parsers. */
 	for (i = 0; i < parser->dependencyCount; i++)
@@ -182,16 +249,41 @@ extern void notifyInputEnd   (void)
 
 extern void notifyMakeTagEntry (const tagEntryInfo *tag, int corkIndex)
 {
+	langType lang = getInputLanguage ();
+	struct slaveControlBlock *cb = getSlaveControlBlock (lang);
+	int kindIndex = (tag->langType == lang)? tag->kindIndex: KIND_GHOST_INDEX;
 	subparser *s;
 
-	foreachSubparser(s, false)
+	if (cb == NULL || cb->subparsersInUse == NULL)
+		return;
+
+	/* A subparser specified with useSpecifiedSubparser() may not be
+	   on the lists. */
+	if (cb->notifiers == NULL || cb->subparsersInUse != cb->subparsersDefault)
 	{
-		if (s->makeTagEntryNotify)
+		foreachSubparser(s, false)
 		{
-			enterSubparser(s);
-			s->makeTagEntryNotify (s, tag, corkIndex);
-			leaveSubparser();
+			if (s->makeTagEntryNotify && isNotifiedOfKind (s, kindIndex))
+			{
+				enterSubparser(s);
+				s->makeTagEntryNotify (s, tag, corkIndex);
+				leaveSubparser();
+			}
 		}
+		return;
+	}
+
+	unsigned int k = cb->notifierKindCount;
+	if (kindIndex >= 0 && (unsigned int) kindIndex < cb->notifierKindCount)
+		k = kindIndex;
+
+	for (subparser **n = cb->notifiers[k]; (s = *n) != NULL; n++)
+	{
+		if (!isSubparserRunnable (s, false))
+			continue;
+		enterSubparser(s);
+		s->makeTagEntryNotify (s, tag, corkIndex);
+		leaveSubparser();
 	}
 }
 
@@ -39,13 +39,20 @@
 #include <stdint.h>
 #include <limits.h>  /* to define INT_MAX */
 
+#include "arena_p.h"
+#include "atom.h"
+#include "bytescan.h"
 #include "debug.h"
 #include "entry_p.h"
+#include "eventtrace_p.h"
 #include "field.h"
 #include "fmt_p.h"
+#include "htable.h"
 #include "kind.h"
 #include "interval_tree_generic.h"
+#include "manifest_p.h"
 #include "nestlevel.h"
+#include "numarray.h"
 #include "options_p.h"
 #include "ptag_p.h"
 #include "rbtree.h"
@@ -55,10 +62,13 @@
 #include "routines_p.h"
 #include "parse_p.h"
 #include "ptrarray.h"
+#include "secondary_p.h"
 #include "sort_p.h"
+#include "stats_p.h"
 #include "strlist.h"
 #include "subparser_p.h"
 #include "trashbox.h"
+#include "trigram_p.h"
 #include "writer_p.h"
 #include "xtag_p.h"
 
@@ -82,6 +92,53 @@
 # define O_RDWR         _O_RDWR
 #endif
 
+/*  The sidecar name index (--name-index) records a tag line in about
+ *  every NAME_INDEX_STRIDE bytes of the tag file.
+ */
+#define NAME_INDEX_SUFFIX ".index"
+#define NAME_INDEX_HEADER "!_CTAGS_NAME_INDEX\t1"
+#define NAME_INDEX_STRIDE 4096L
+
+/*  The fields of a cork queue entry used for building the full qualified
+ *  names of scopes. Parsers update the entries directly while parsing, so
+ *  the fields are copied to this dense array only when the queue is
+ *  flushed. The name built for an entry is kept for the entries in it.
+ */
+typedef struct sCorkScope {
+	int scopeIndex;
+	int namedIndex;				/* the nearest entry not being a placeholder
+								   in this and its scopes, or CORK_NIL */
+	int kindIndex;
+	langType langType;
+	const char *name;
+	const char *fqName;			/* an atom, or NULL if not built yet */
+	unsigned int placeholder:1;
+	unsigned int loop:1;		/* scopeIndex pointed to the entry itself */
+} corkScope;
+
+typedef struct sCorkScopeTable {
+	corkScope *scopes;
+	intArray *chain;
+	vString *buffer;
+} corkScopeTable;
+
+/* The interval table flattened in the order of the tree. Once the
+ * table is queried many times without being changed, point queries
+ * are answered by sweeping the array with a stack of the intervals
+ * the swept lines are in. Queries for ascending lines cost one sweep
+ * in total; a query for a smaller line starts the sweep again. */
+typedef struct sIntervalSweep {
+	struct sTagEntryInfoX **items;
+	struct sTagEntryInfoX **stack;
+	unsigned int allocated;
+	unsigned int count;
+	unsigned int next;			/* the first item not pushed yet */
+	unsigned int depth;
+	unsigned long line;			/* the line last queried */
+	unsigned int intervals;		/* in intervaltab */
+	unsigned int queries;		/* since the table was changed */
+	bool valid;
+} intervalSweep;
 
 /*  Maintains the state of the tag file.
  */
@@ -89,16 +146,38 @@ typedef struct eTagFile {
 	char *name;
 	char *directory;
 	MIO *mio;
+	bool inMemory;				/* MIO keeps the tags until they are sorted */
 	struct sNumTags { unsigned long added, prev; } numTags;
 	struct sMax { size_t line, tag; } max;
 	vString *vLine;
+	char *mergeName;			/* --append: the tag file the tags are merged into */
+	hashTable *replacedInputs;	/* --append=replace: the input fields of the tags to drop */
+	hashTable *inputFileIds;	/* TAG_INPUT_FILE_ID: id -> tag path */
+	vString *lastInputFileId;	/* the tag path whose pseudo tag is written last */
+	MIO *filterOutput;			/* --filter: stdout, kept across the input files */
+	MIO *capturedMio;			/* --dedup-content: the tag file while recording tags */
+	struct sShards {			/* the tags sorted in the workers or spilled */
+		MIO **mios;
+		char **names;
+		unsigned long *counts;	/* the tags in each shard */
+		unsigned int *levels;	/* how many times the runs in each shard are merged */
+		unsigned int count;
+		unsigned long numTags;
+	} shards;
 
 	int cork;
 	unsigned int corkFlags;
 	ptrArray *corkQueue;
+	arena *corkArena;			/* the entries in corkQueue and their strings */
+	unsigned int corkReleased;	/* the entries released by flushCorkQueue () */
+	corkScopeTable *corkScopes;	/* available while flushing corkQueue */
+	hashTable *refAggregates;	/* --aggregate-references: available while
+								   flushing corkQueue */
 	struct rb_root intervaltab;
+	intervalSweep intervalSweep;
 
 	bool patternCacheValid;
+	bool topLevelOnly;			/* --minified=toplevel for the input file */
 } tagFile;
 
 typedef struct sTagEntryInfoX  {
@@ -114,15 +193,20 @@ typedef struct sTagEntryInfoX  {
 *   DATA DEFINITIONS
 */
 
-static tagFile TagFile = {
+static CTAGS_THREAD_LOCAL tagFile TagFile = {
 	NULL,               /* tag file name */
 	NULL,               /* tag file directory (absolute) */
 	NULL,               /* file pointer */
+	false,              /* inMemory */
 	{ 0, 0 },           /* numTags */
 	{ 0, 0 },        /* max */
 	NULL,                /* vLine */
 	.cork = false,
 	.corkQueue = NULL,
+	.corkArena = NULL,
+	.corkReleased = 0,
+	.corkScopes = NULL,
+	.refAggregates = NULL,
 	/* .intervaltab = RB_ROOT,
 	 *
 	 * msvc doesn't accept the above expression:
@@ -131,10 +215,15 @@ static tagFile TagFile = {
 	 *
 	 */
 	.patternCacheValid = false,
+	.topLevelOnly = false,
 };
 
 static bool TagsToStdout = false;
 
+/* Called with each tag written to the tag file. */
+static tagWriteObserver TagWriteObserver;
+static void *TagWriteObserverData;
+
 /*
 *   FUNCTION PROTOTYPES
 */
@@ -153,6 +242,20 @@ INTERVAL_TREE_DEFINE(tagEntryInfoX, intervalnode,
 					 unsigned long, __intervalnode_subtree_last,
 					 INTERVAL_START, INTERVAL_END, /*static*/, intervaltab)
 
+static void invalidateIntervalSweep (void)
+{
+	TagFile.intervalSweep.valid = false;
+	TagFile.intervalSweep.queries = 0;
+}
+
+static void insertToIntervalTab (tagEntryInfoX *entry)
+{
+	intervaltab_insert(entry, &TagFile.intervaltab);
+	entry->slot.inIntevalTab = 1;
+	TagFile.intervalSweep.intervals++;
+	invalidateIntervalSweep ();
+}
+
 /*
 *   FUNCTION DEFINITIONS
 */
@@ -162,6 +265,11 @@ extern void freeTagFileResources (void)
 	if (TagFile.directory != NULL)
 		eFree (TagFile.directory);
 	vStringDelete (TagFile.vLine);
+	if (TagFile.intervalSweep.items)
+	{
+		eFree (TagFile.intervalSweep.items);
+		eFree (TagFile.intervalSweep.stack);
+	}
 }
 
 extern const char *tagFileName (void)
@@ -169,6 +277,172 @@ extern const char *tagFileName (void)
 	return TagFile.name;
 }
 
+/* FNV-1a, 32 bits */
+static uint32_t hashFnv1a32 (const char *s, size_t length)
+{
+	uint32_t h = 2166136261u;
+
+	for (size_t i = 0; i < length; i++)
+	{
+		h ^= (unsigned char) s [i];
+		h *= 16777619u;
+	}
+	return h;
+}
+
+static void makeInputFileIdString (const char *const tagPath, vString *id)
+{
+	char buf [16];
+
+	snprintf (buf, sizeof (buf), "@%08lx",
+			  (unsigned long) hashFnv1a32 (tagPath, strlen (tagPath)));
+	vStringCopyS (id, buf);
+}
+
+extern vString *makeTagFileInputField (const char *const fileName)
+{
+	vString *tagPath = makeInputFileTagPath (fileName);
+
+	if (getTagWriterType () == WRITER_U_CTAGS)
+	{
+		vString *escaped = vStringNew ();
+		vStringCatSWithEscaping (escaped, vStringValue (tagPath));
+		vStringDelete (tagPath);
+		tagPath = escaped;
+	}
+	return tagPath;
+}
+
+static void addReplacedInputField (char *field)
+{
+	if (hashTableHasItem (TagFile.replacedInputs, field))
+		eFree (field);
+	else
+		hashTablePutItem (TagFile.replacedInputs, field, field);
+}
+
+extern void replaceTagsOfInputFile (const char *const fileName)
+{
+	char *field = vStringDeleteUnwrap (makeTagFileInputField (fileName));
+
+	if (TagFile.replacedInputs == NULL)
+		TagFile.replacedInputs = hashTableNewFlat (64, hashCstrhash, hashCstreq,
+												   eFree, NULL);
+	addReplacedInputField (field);
+
+	/* The old tags may refer to the file by its id. */
+	if (isInputFileIdEnabled ())
+	{
+		vString *tagPath = makeInputFileTagPath (fileName);
+		vString *id = vStringNew ();
+
+		makeInputFileIdString (vStringValue (tagPath), id);
+		addReplacedInputField (vStringDeleteUnwrap (id));
+		vStringDelete (tagPath);
+	}
+}
+
+/*  With the TAG_INPUT_FILE_ID pseudo tag enabled, the input field of a
+ *  tag line is an id like "@1f2e3d4c" instead of the path of the input
+ *  file, and a pseudo tag like
+ *
+ *    !_TAG_INPUT_FILE_ID	path/to/input.c	/@1f2e3d4c/
+ *
+ *  is written for each id before the first tag using it. The pseudo tags
+ *  are gathered at the head of the tag file only by sorting, so the ids
+ *  are used only for a sorted tag file.
+ */
+extern bool isInputFileIdEnabled (void)
+{
+	return isPtagEnabled (PTAG_INPUT_FILE_ID)
+		&& isXtagEnabled (XTAG_PSEUDO_TAGS)
+		&& Option.sorted != SO_UNSORTED
+		&& !Option.filter
+		&& (getTagWriterType () == WRITER_U_CTAGS
+			|| getTagWriterType () == WRITER_E_CTAGS);
+}
+
+/*  Store the id for TAGPATH to ID, and write the pseudo tag defining it
+ *  if it may not be written yet. Return false if the path must be
+ *  written as is instead.
+ *
+ *  The id is made from the path only, so the ids of an input file agree
+ *  in the runs updating a tag file with --append or --incremental, and
+ *  in the worker processes of --jobs.
+ */
+extern bool getInputFileId (const char *const tagPath, vString *id)
+{
+	const char *known;
+
+	makeInputFileIdString (tagPath, id);
+
+	if (TagFile.inputFileIds == NULL)
+		TagFile.inputFileIds = hashTableNew (64, hashCstrhash, hashCstreq,
+											 eFree, eFree);
+
+	known = hashTableGetItem (TagFile.inputFileIds, vStringValue (id));
+	if (known == NULL)
+		hashTablePutItem (TagFile.inputFileIds, vStringStrdup (id), eStrdup (tagPath));
+	else if (strcmp (known, tagPath) != 0)
+	{
+		/* Two paths have the same id. The second one is written as is. */
+		return false;
+	}
+
+	if (TagFile.lastInputFileId == NULL)
+		TagFile.lastInputFileId = vStringNew ();
+	if (strcmp (vStringValue (TagFile.lastInputFileId), tagPath) != 0)
+	{
+		const char *pathAndId [2] = { tagPath, vStringValue (id) };
+
+		/* Written again for the same path after another path or a
+		 * rescan; sorting drops the duplicates. */
+		makePtagIfEnabled (PTAG_INPUT_FILE_ID, LANG_IGNORE, pathAndId);
+		vStringCopyS (TagFile.lastInputFileId, tagPath);
+	}
+	return true;
+}
+
+extern vString *makeTagFileInputFileId (const char *const fileName)
+{
+	vString *tagPath;
+	vString *id;
+
+	if (!isInputFileIdEnabled ())
+		return NULL;
+
+	tagPath = makeInputFileTagPath (fileName);
+	id = vStringNew ();
+	if (!getInputFileId (vStringValue (tagPath), id))
+	{
+		vStringDelete (id);
+		id = NULL;
+	}
+	vStringDelete (tagPath);
+	return id;
+}
+
+/*  Return true if LINE, a line of the tag file, is a tag of an input
+ *  file given to replaceTagsOfInputFile ().
+ */
+static bool isTagOfReplacedInputFile (const char *const line)
+{
+	const char *start = strchr (line, '\t');
+	const char *end;
+
+	if (TagFile.replacedInputs == NULL  ||  start == NULL
+		||  strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+		return false;
+
+	start++;
+	end = strchr (start, '\t');
+	if (end == NULL)
+		return false;
+
+	vStringNCopyS (TagFile.vLine, start, end - start);
+	return hashTableHasItem (TagFile.replacedInputs, vStringValue (TagFile.vLine));
+}
+
 /*
 *   Pseudo tag support
 */
@@ -397,6 +671,77 @@ static bool isTagFile (const char *const filename)
 	return ok;
 }
 
+/*  When the tags are sorted with the internal sort, they are collected
+ *  in memory and written to the tag file once, after sorting. The tag
+ *  file is not read back.
+ */
+static bool canSortInMemory (void)
+{
+#ifdef EXTERNAL_SORT
+	return false;
+#else
+	return Option.sorted != SO_UNSORTED && !writerSortsTags ();
+#endif
+}
+
+/*  With --filter, the tags of an input file are kept in memory unless
+ *  an external sort command has to read them from a file.
+ */
+static bool canFilterInMemory (void)
+{
+#ifdef EXTERNAL_SORT
+	return Option.sorted == SO_UNSORTED || writerSortsTags ();
+#else
+	return true;
+#endif
+}
+
+static MIO *newTagFileInMemory (void)
+{
+	TagFile.inMemory = true;
+	return mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+}
+
+/*  Return true if the tag file NAME says it is sorted the way the tags
+ *  are sorted now. The tags appended to such a file can be sorted alone
+ *  and merged into it, instead of sorting the whole file again.
+ */
+static bool canMergeIntoTagFile (const char *const name)
+{
+	enum { maxEntryLength = 32 };
+	char entry [maxEntryLength + 1];
+	const char flag = Option.sorted == SO_FOLDSORTED ? '2' :
+		(Option.sorted == SO_SORTED ? '1' : '0');
+	size_t entryLength;
+	const char *line;
+	bool ok = false;
+	MIO *mio;
+
+	if (! canSortInMemory ())
+		return false;
+
+	sprintf (entry, "%sTAG_FILE_SORTED\t", PSEUDO_TAG_PREFIX);
+	entryLength = strlen (entry);
+	Assert (entryLength < maxEntryLength);
+
+	mio = mio_new_file (name, "r");
+	if (mio == NULL)
+		return false;
+
+	line = readLineRaw (TagFile.vLine, mio);
+	while (line != NULL  &&  line [0] == entry [0])
+	{
+		if (strncmp (line, entry, entryLength) == 0)
+		{
+			ok = (line [entryLength] == flag  &&  line [entryLength + 1] == '\t');
+			break;
+		}
+		line = readLineRaw (TagFile.vLine, mio);
+	}
+	mio_unref (mio);
+	return ok;
+}
+
 extern void openTagFile (void)
 {
 	setDefaultTagFileName ();
@@ -405,6 +750,10 @@ extern void openTagFile (void)
 	if (TagFile.vLine == NULL)
 		TagFile.vLine = vStringNew ();
 
+	/* The extra outputs take the common pseudo tags written below. */
+	if (hasExtraOutputs ())
+		openExtraOutputs (TagsToStdout? NULL: Option.tagFileName, isTagFile);
+
 	/*  Open the tags file.
 	 */
 	if (TagsToStdout)
@@ -414,6 +763,11 @@ extern void openTagFile (void)
 			TagFile.mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
 			TagFile.name = NULL;
 		}
+		else if (canSortInMemory () || (Option.filter && canFilterInMemory ()))
+		{
+			TagFile.mio = newTagFileInMemory ();
+			TagFile.name = NULL;
+		}
 		else
 			TagFile.mio = tempFile ("w+", &TagFile.name);
 		if (isXtagEnabled (XTAG_PSEUDO_TAGS))
@@ -439,7 +793,29 @@ extern void openTagFile (void)
 		}
 		else
 		{
-			if (Option.append  &&  fileExists)
+			bool merge = Option.append  &&  fileExists
+				&&  canMergeIntoTagFile (TagFile.name);
+
+			if (Option.append  &&  fileExists  &&  Option.appendReplace  &&  ! merge)
+			{
+				/* The old tags are sorted again while being merged. */
+				TagFile.mio = mio_new_file (TagFile.name, "r+");
+				if (TagFile.mio != NULL)
+				{
+					updatePseudoTags (TagFile.mio);
+					mio_unref (TagFile.mio);
+				}
+				merge = true;
+			}
+
+			if (merge)
+			{
+				/* The tag file is left untouched until the tags are sorted. */
+				TagFile.mergeName = TagFile.name;
+				TagFile.name = NULL;
+				TagFile.mio = newTagFileInMemory ();
+			}
+			else if (Option.append  &&  fileExists)
 			{
 				TagFile.mio = mio_new_file (TagFile.name, "r+");
 				if (TagFile.mio != NULL)
@@ -451,7 +827,19 @@ extern void openTagFile (void)
 			}
 			else
 			{
+				if (Option.incremental)
+					loadManifest (TagFile.name);
+#ifndef EXTERNAL_SORT
+				if (Option.deltaFileName)
+					beginSortDelta (Option.deltaFileName, TagFile.name);
+#endif
 				TagFile.mio = mio_new_file (TagFile.name, "w");
+				if (TagFile.mio != NULL && canSortInMemory ())
+				{
+					/* The file is truncated here and written after sorting. */
+					mio_unref (TagFile.mio);
+					TagFile.mio = newTagFileInMemory ();
+				}
 				if (TagFile.mio != NULL && isXtagEnabled (XTAG_PSEUDO_TAGS))
 					addCommonPseudoTags ();
 			}
@@ -465,10 +853,321 @@ extern void openTagFile (void)
 		if (TagsToStdout)
 			TagFile.directory = eStrdup (CurrentDirectory);
 		else
-			TagFile.directory = absoluteDirname (TagFile.name);
+			TagFile.directory = absoluteDirname (TagFile.mergeName?
+												 TagFile.mergeName: TagFile.name);
 	}
 }
 
+extern void flushTagFile (void)
+{
+	usdtProbe0 (flush);
+	mio_flush (TagFile.mio);
+	abort_if_ferror (TagFile.mio);
+}
+
+/*  Make MIO the destination of tags written in a worker process.
+ *  The stream inherited from the parent process is left untouched;
+ *  the parent process keeps writing to it.
+ */
+extern void redirectTagFile (MIO *mio)
+{
+	TagFile.mio = mio;
+	TagFile.inMemory = false;
+	TagFile.numTags.added = 0;
+	TagFile.numTags.prev = 0;
+	TagFile.patternCacheValid = false;
+}
+
+/*  Append SIZE bytes at OFFSET of MIO, the tags written by a worker
+ *  process, to the tag file.
+ */
+extern void appendToTagFile (MIO *mio, long offset, long size, unsigned long numTags)
+{
+	enum { BufferSize = 8192 };
+	char buffer [BufferSize];
+
+	if (mio_seek (mio, offset, SEEK_SET) != 0)
+		error (FATAL | PERROR, "cannot rewind the output of a worker");
+
+	while (size > 0)
+	{
+		size_t toRead = (size < BufferSize)? (size_t) size: (size_t) BufferSize;
+		size_t numRead = mio_read (mio, buffer, 1, toRead);
+		if (numRead == 0)
+			error (FATAL | PERROR, "cannot read the output of a worker");
+		if (mio_write (TagFile.mio, buffer, 1, numRead) < numRead)
+			error (FATAL | PERROR, "cannot complete write");
+		size -= (long) numRead;
+	}
+	abort_if_ferror (TagFile.mio);
+
+	TagFile.numTags.added += numTags;
+	spillTagFileMaybe ();
+}
+
+/*  Write the tags to a memory stream until endTagFileCapture () is
+ *  called, to record the tags made for an input file.
+ */
+extern void beginTagFileCapture (void)
+{
+	Assert (TagFile.capturedMio == NULL);
+
+	TagFile.capturedMio = TagFile.mio;
+	TagFile.mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+}
+
+/*  Write the tags recorded since beginTagFileCapture () to the tag file,
+ *  and return the memory stream keeping them.
+ */
+extern MIO *endTagFileCapture (void)
+{
+	MIO *mio = TagFile.mio;
+	size_t size;
+	unsigned char *data = mio_memory_get_data (mio, &size);
+
+	Assert (TagFile.capturedMio != NULL);
+
+	TagFile.mio = TagFile.capturedMio;
+	TagFile.capturedMio = NULL;
+	if (size > 0 && mio_write (TagFile.mio, data, 1, size) < size)
+		error (FATAL | PERROR, "cannot complete write");
+	abort_if_ferror (TagFile.mio);
+	return mio;
+}
+
+/*  Whether the tags written in a worker process can be sorted in the
+ *  worker and merged into the tag file when it is closed, instead of
+ *  being appended to the tag file as they are.
+ */
+extern bool canMergeSortedShards (void)
+{
+	return canSortInMemory () && !Option.filter;
+}
+
+/*  In a worker process, sort the tags written to the tag file into OUTPUT.
+ */
+extern void sortTagFileShard (MIO *output)
+{
+#ifndef EXTERNAL_SORT
+	if (mio_seek (TagFile.mio, 0L, SEEK_SET) != 0)
+		error (FATAL | PERROR, "cannot rewind the output of a worker");
+	internalSortTagsToMio (output, TagFile.mio, TagFile.numTags.added, NULL);
+#endif
+}
+
+/*  Merge MIO, the NUMTAGS tags sorted in a worker process, into the tag
+ *  file when it is closed. MIO and NAME, the name of its temporary file,
+ *  are released then.
+ */
+extern void addSortedShardToTagFile (MIO *mio, char *name, unsigned long numTags)
+{
+	struct sShards *shards = &TagFile.shards;
+
+	shards->mios = xRealloc (shards->mios, shards->count + 1, MIO *);
+	shards->names = xRealloc (shards->names, shards->count + 1, char *);
+	shards->counts = xRealloc (shards->counts, shards->count + 1, unsigned long);
+	shards->levels = xRealloc (shards->levels, shards->count + 1, unsigned int);
+	shards->mios [shards->count] = mio;
+	shards->names [shards->count] = name;
+	shards->counts [shards->count] = numTags;
+	shards->levels [shards->count] = 0;
+	shards->count++;
+	shards->numTags += numTags;
+
+	TagFile.numTags.added += numTags;
+}
+
+static void deleteShards (void)
+{
+	struct sShards *shards = &TagFile.shards;
+
+	for (unsigned int i = 0; i < shards->count; i++)
+	{
+		mio_unref (shards->mios [i]);
+		remove (shards->names [i]);
+		eFree (shards->names [i]);
+	}
+	if (shards->mios)
+	{
+		eFree (shards->mios);
+		eFree (shards->names);
+		eFree (shards->counts);
+		eFree (shards->levels);
+	}
+	memset (shards, 0, sizeof (*shards));
+}
+
+#ifndef EXTERNAL_SORT
+static void prepareShards (sortedShards *shards)
+{
+	shards->mios = TagFile.shards.mios;
+	shards->count = TagFile.shards.count;
+	shards->numTags = TagFile.shards.numTags;
+	shards->drop = NULL;
+	shards->rewrite = NULL;
+
+	for (unsigned int i = 0; i < shards->count; i++)
+		if (mio_seek (shards->mios [i], 0L, SEEK_SET) != 0)
+			failedSort (NULL, NULL);
+}
+
+/*  Merge the last COUNT shards into one shard of LEVEL.
+ */
+static void mergeLastShards (unsigned int count, unsigned int level)
+{
+	struct sShards *shards = &TagFile.shards;
+	const unsigned int first = shards->count - count;
+	sortedShards merged = {
+		.mios = shards->mios + first,
+		.count = count,
+	};
+	MIO *none = mio_new_memory (NULL, 0, NULL, NULL);
+	char *name = NULL;
+	MIO *mio = tempFile ("w+", &name);
+
+	for (unsigned int i = first; i < shards->count; i++)
+	{
+		if (mio_seek (shards->mios [i], 0L, SEEK_SET) != 0)
+			failedSort (NULL, NULL);
+		merged.numTags += shards->counts [i];
+	}
+	verbose ("merging %u sorted runs of %lu tags into %s\n",
+			 count, (unsigned long) merged.numTags, name);
+	internalSortTagsToMio (mio, none, 0, &merged);
+	abort_if_ferror (mio);
+	mio_unref (none);
+
+	for (unsigned int i = first; i < shards->count; i++)
+	{
+		mio_unref (shards->mios [i]);
+		remove (shards->names [i]);
+		eFree (shards->names [i]);
+	}
+	shards->count = first;
+	shards->numTags -= merged.numTags;
+	TagFile.numTags.added -= merged.numTags;
+	addSortedShardToTagFile (mio, name, merged.numTags);
+	shards->levels [first] = level;
+}
+
+/*  Sort the tags kept in memory into a temporary file, which is merged
+ *  into the tag file when it is closed like the tags sorted in a worker
+ *  process. The tags are not written unsorted and read back then.
+ *  Not to keep too many files open, every MergedRuns runs of a level
+ *  are merged into a run of the next level, like carrying a digit; each
+ *  tag is merged a logarithmic number of times.
+ */
+static void spillSortedRun (void)
+{
+	enum { MergedRuns = 16 };
+	struct sShards *shards = &TagFile.shards;
+	unsigned long numTags = TagFile.numTags.added - shards->numTags;
+	char *name = NULL;
+	MIO *run = tempFile ("w+", &name);
+
+	verbose ("sorting %lu tags kept in memory into %s\n", numTags, name);
+	if (mio_seek (TagFile.mio, 0L, SEEK_SET) != 0)
+		error (FATAL | PERROR, "cannot rewind the tags kept in memory");
+	internalSortTagsToMio (run, TagFile.mio, numTags, NULL);
+	abort_if_ferror (run);
+
+	mio_unref (TagFile.mio);
+	TagFile.mio = newTagFileInMemory ();
+	TagFile.numTags.added -= numTags;
+	addSortedShardToTagFile (run, name, numTags);
+
+	while (shards->count >= MergedRuns)
+	{
+		const unsigned int level = shards->levels [shards->count - 1];
+		unsigned int i;
+
+		for (i = 1; i < MergedRuns; i++)
+			if (shards->levels [shards->count - 1 - i] != level)
+				break;
+		if (i < MergedRuns)
+			break;
+		mergeLastShards (MergedRuns, level + 1);
+	}
+}
+#endif
+
+/*  Move the tags kept in memory to the tag file, or to a temporary file
+ *  when writing to the standard output or merging into the tag file.
+ */
+static void spillTagFile (void)
+{
+	size_t size;
+	unsigned char *data = mio_memory_get_data (TagFile.mio, &size);
+	MIO *mio;
+
+	Assert (TagFile.inMemory);
+
+	if (TagsToStdout || TagFile.mergeName)
+		mio = tempFile ("w+", &TagFile.name);
+	else
+		mio = mio_new_file (TagFile.name, "w+");
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open tag file");
+
+	verbose ("writing %lu bytes of tags kept in memory to %s\n",
+			 (unsigned long) size, TagFile.name);
+	if (size > 0 && mio_write (mio, data, 1, size) < size)
+		error (FATAL | PERROR, "cannot complete write");
+	abort_if_ferror (mio);
+
+	mio_unref (TagFile.mio);
+	TagFile.mio = mio;
+	TagFile.inMemory = false;
+}
+
+/*  This must not be called while a position of the tag file is saved
+ *  with tagFilePosition (): the position is valid only for the MIO
+ *  kept in memory.
+ */
+extern void spillTagFileMaybe (void)
+{
+	size_t size;
+
+	if (!TagFile.inMemory)
+		return;
+
+	mio_memory_get_data (TagFile.mio, &size);
+	if (size <= Option.sortMemoryLimit)
+	{
+		const memoryTotals spilled = { .spilled = 1 };
+
+		/* The tags are the biggest block kept over the input files;
+		 * a small one is not worth a temporary file. */
+		if (size < Option.memoryLimit / 16 || !isMemoryTight ())
+			return;
+		verbose ("spilling the tags for --memory-limit\n");
+		addMemoryTotals (&spilled);
+	}
+#ifndef EXTERNAL_SORT
+	if (canMergeSortedShards ())
+		spillSortedRun ();
+	else
+#endif
+		spillTagFile ();
+}
+
+/*  Write LINE, a tag line taken from an old tag file, to the tag file.
+ *  LINE must be terminated with a newline.
+ */
+extern void copyLineToTagFile (const char *const line)
+{
+	const char *tab = strchr (line, '\t');
+	const size_t length = strlen (line);
+
+	if (mio_write (TagFile.mio, line, 1, length) < length)
+		error (FATAL | PERROR, "cannot complete write");
+	abort_if_ferror (TagFile.mio);
+
+	++TagFile.numTags.added;
+	rememberMaxLengths (tab? (size_t) (tab - line): length, length);
+	spillTagFileMaybe ();
+}
+
 #ifdef USE_REPLACEMENT_TRUNCATE
 
 static void copyBytes (MIO* const fromMio, MIO* const toMio, const long size)
@@ -531,10 +1230,11 @@ static int replacementTruncate (const char *const name, const long size)
 static void internalSortTagFile (void)
 {
 	MIO *mio;
+	sortedShards shards;
 
 	/*  Open/Prepare the tag file and place its lines into allocated buffers.
 	 */
-	if (TagsToStdout)
+	if (TagsToStdout || TagFile.inMemory)
 	{
 		mio = TagFile.mio;
 		mio_seek (mio, 0, SEEK_SET);
@@ -546,38 +1246,84 @@ static void internalSortTagFile (void)
 			failedSort (mio, NULL);
 	}
 
+	prepareShards (&shards);
 	internalSortTags (TagsToStdout,
 			  mio,
-			  TagFile.numTags.added + TagFile.numTags.prev);
+			  TagFile.numTags.added + TagFile.numTags.prev - shards.numTags,
+			  &shards);
 
-	if (! TagsToStdout)
+	if (! TagsToStdout && ! TagFile.inMemory)
 		mio_unref (mio);
 }
+
+/*  Sort the tags added with --append and merge them into the tag file,
+ *  which is moved aside while being read.
+ */
+static void mergeIntoTagFile (void)
+{
+	vString *prevName = vStringNewInit (TagFile.mergeName);
+	MIO *mio, *prev;
+	sortedShards shards;
+
+	vStringCatS (prevName, ".prev");
+	if (rename (TagFile.mergeName, vStringValue (prevName)) != 0)
+		error (FATAL | PERROR, "cannot move \"%s\" aside", TagFile.mergeName);
+	prev = mio_new_file (vStringValue (prevName), "r");
+	if (prev == NULL)
+		error (FATAL | PERROR, "cannot open \"%s\"", vStringValue (prevName));
+
+	if (TagFile.inMemory)
+		mio = TagFile.mio;
+	else
+	{
+		mio = mio_new_file (TagFile.name, "r");
+		if (mio == NULL)
+			failedSort (mio, NULL);
+	}
+
+	prepareShards (&shards);
+	TagFile.numTags.prev = internalMergeTags (mio, TagFile.numTags.added - shards.numTags,
+											  &shards, prev,
+											  Option.appendReplace? isTagOfReplacedInputFile: NULL,
+											  TagFile.mergeName);
+
+	if (! TagFile.inMemory)
+		mio_unref (mio);
+	mio_unref (prev);
+	remove (vStringValue (prevName));
+	vStringDelete (prevName);
+}
 #endif
 
 static void sortTagFile (void)
 {
-	if (TagFile.numTags.added > 0L)
+	if (TagFile.numTags.added > 0L
+		|| (TagFile.mergeName  &&  TagFile.replacedInputs))
 	{
-		if (Option.sorted != SO_UNSORTED)
+		if (Option.sorted != SO_UNSORTED && !writerSortsTags ())
 		{
 			verbose ("sorting tag file\n");
 #ifdef EXTERNAL_SORT
 			externalSortTags (TagsToStdout, TagFile.mio);
 #else
-			internalSortTagFile ();
+			if (TagFile.mergeName)
+				mergeIntoTagFile ();
+			else
+				internalSortTagFile ();
 #endif
 		}
 		else if (TagsToStdout)
 			catFile (TagFile.mio);
 	}
+	else if (TagFile.inMemory && ! TagsToStdout && ! TagFile.mergeName)
+		spillTagFile ();
 }
 
 static void resizeTagFile (const long newSize)
 {
 	int result;
 
-	if (!TagFile.name)
+	if (!TagFile.name || TagFile.inMemory)
 	{
 		mio_try_resize (TagFile.mio, newSize);
 		return;
@@ -623,19 +1369,172 @@ static void writeEtagsIncludes (MIO *const mio)
 	}
 }
 
+/*  Writes the name index of the sorted tag file. Each line of the index
+ *  has the file offset and the name of a tag line; the lines come in the
+ *  order of the tag file. The header records the size of the tag file so
+ *  that readers can tell a stale index.
+ */
+extern void writeNameIndex (const char *const tagFileName)
+{
+	vString *indexName = vStringNewInit (tagFileName);
+	vString *vLine = vStringNew ();
+	unsigned long count = 0;
+	long next = 0;
+	MIO *tags, *index;
+
+	vStringCatS (indexName, NAME_INDEX_SUFFIX);
+
+	tags = mio_new_file (tagFileName, "r");
+	if (tags == NULL)
+		error (FATAL | PERROR, "cannot open tag file \"%s\"", tagFileName);
+	mio_seek (tags, 0L, SEEK_END);
+
+	index = mio_new_file (vStringValue (indexName), "w");
+	if (index == NULL)
+		error (FATAL | PERROR, "cannot open name index \"%s\"", vStringValue (indexName));
+	mio_printf (index, NAME_INDEX_HEADER "\t%ld\n", mio_tell (tags));
+	mio_seek (tags, 0L, SEEK_SET);
+
+	while (true)
+	{
+		const long offset = mio_tell (tags);
+		const char *line = readLineRaw (vLine, tags);
+		size_t nameLength;
+
+		if (line == NULL)
+			break;
+		if (offset < next
+			|| strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+			continue;
+
+		nameLength = strcspn (line, "\t\r\n");
+		if (nameLength == 0)
+			continue;
+		mio_printf (index, "%ld\t%.*s\n", offset, (int) nameLength, line);
+		next = offset + NAME_INDEX_STRIDE;
+		count++;
+	}
+	if (mio_error (tags))
+		error (FATAL | PERROR, "cannot read tag file \"%s\"", tagFileName);
+	if (mio_unref (index) != 0)
+		error (FATAL | PERROR, "cannot write name index \"%s\"", vStringValue (indexName));
+	mio_unref (tags);
+
+	verbose ("wrote %lu entries to %s\n", count, vStringValue (indexName));
+
+	vStringDelete (vLine);
+	vStringDelete (indexName);
+}
+
+/*  In filter mode, the tag file kept in memory is opened for the first
+ *  input file and reused for the next ones: endFilterTagFile () writes
+ *  the tags of an input file to the standard output through a stream
+ *  kept open until closeFilterTagFile (), and clears them. Neither
+ *  flushes the standard output; the caller does it once per input file
+ *  after writing --filter-terminator.
+ */
+extern void beginFilterTagFile (void)
+{
+	if (TagFile.mio == NULL)
+		openTagFile ();
+	else if (isXtagEnabled (XTAG_PSEUDO_TAGS))
+		addCommonPseudoTags ();
+}
+
+extern void endFilterTagFile (const bool resize)
+{
+	long desiredSize;
+
+	if (! TagFile.inMemory)
+	{
+		/* An external sort command reads the tags from a temporary file. */
+		closeTagFile (resize);
+		return;
+	}
+
+	writerFinish (TagFile.mio);
+	if (Option.etags)
+		writeEtagsIncludes (TagFile.mio);
+
+	desiredSize = mio_tell (TagFile.mio);
+	mio_seek (TagFile.mio, 0L, SEEK_END);
+	if (resize  &&  desiredSize < mio_tell (TagFile.mio))
+		mio_try_resize (TagFile.mio, desiredSize);
+
+	if (TagFile.filterOutput == NULL)
+		TagFile.filterOutput = mio_new_fp (stdout, NULL);
+
+	beginTraceEvent (TRACE_EVENT_SORT, NULL);
+	if (TagFile.numTags.added > 0L)
+	{
+		if (canSortInMemory ())
+			internalSortTagsToMio (TagFile.filterOutput, TagFile.mio,
+								   TagFile.numTags.added, NULL);
+		else
+		{
+			size_t size;
+			unsigned char *data = mio_memory_get_data (TagFile.mio, &size);
+
+			if (size > 0)
+				mio_write (TagFile.filterOutput, data, 1, size);
+		}
+	}
+	endTraceEvent (TRACE_EVENT_SORT);
+	abort_if_ferror (TagFile.filterOutput);
+
+	mio_try_resize (TagFile.mio, 0);
+	mio_seek (TagFile.mio, 0L, SEEK_SET);
+	TagFile.numTags.added = 0;
+	TagFile.patternCacheValid = false;
+}
+
+extern void closeFilterTagFile (void)
+{
+	if (TagFile.mio != NULL)
+	{
+		mio_unref (TagFile.mio);
+		TagFile.mio = NULL;
+		TagFile.inMemory = false;
+	}
+	if (TagFile.filterOutput != NULL)
+	{
+		mio_flush (TagFile.filterOutput);
+		mio_unref (TagFile.filterOutput);
+		TagFile.filterOutput = NULL;
+	}
+}
+
+/*  Writes the sidecar indexes of the sorted tag file asked for with
+ *  --name-index, --trigram-index and --secondary-index.
+ */
+extern void writeSidecarIndexes (const char *const tagFileName)
+{
+	if (Option.nameIndex)
+		writeNameIndex (tagFileName);
+	if (Option.trigramIndex)
+		writeTrigramIndex (tagFileName);
+	if (Option.secondaryIndex)
+		writeSecondaryIndex (tagFileName);
+}
+
 extern void closeTagFile (const bool resize)
 {
 	long desiredSize, size;
+	const bool inMemory = TagFile.inMemory;
 
+	if (hasExtraOutputs ())
+		closeExtraOutputs ();
+	writerFinish (TagFile.mio);
 	if (Option.etags)
 		writeEtagsIncludes (TagFile.mio);
+	usdtProbe0 (flush);
 	mio_flush (TagFile.mio);
 
 	abort_if_ferror (TagFile.mio);
 	desiredSize = mio_tell (TagFile.mio);
 	mio_seek (TagFile.mio, 0L, SEEK_END);
 	size = mio_tell (TagFile.mio);
-	if (! TagsToStdout)
+	if (! TagsToStdout && ! inMemory)
 		/* The tag file should be closed before resizing. */
 		if (mio_unref (TagFile.mio) != 0)
 			error (FATAL | PERROR, "cannot close tag file");
@@ -647,16 +1546,45 @@ extern void closeTagFile (const bool resize)
 				TagFile.name? TagFile.name: "<mio>", size, desiredSize); )
 		resizeTagFile (desiredSize);
 	}
+	beginTraceEvent (TRACE_EVENT_SORT, NULL);
 	sortTagFile ();
-	if (TagsToStdout)
+#ifndef EXTERNAL_SORT
+	endSortDelta ();
+#endif
+	endTraceEvent (TRACE_EVENT_SORT);
+	deleteShards ();
+	if (TagsToStdout || inMemory)
 	{
 		if (mio_unref (TagFile.mio) != 0)
 			error (FATAL | PERROR, "cannot close tag file");
+		if (TagsToStdout && TagFile.name)
+			remove (TagFile.name);  /* remove temporary file */
+	}
+	if (TagFile.mergeName)
+	{
 		if (TagFile.name)
 			remove (TagFile.name);  /* remove temporary file */
+		writeSidecarIndexes (TagFile.mergeName);
+		eFree (TagFile.mergeName);
+		TagFile.mergeName = NULL;
+	}
+	if (TagFile.replacedInputs)
+	{
+		hashTableDelete (TagFile.replacedInputs);
+		TagFile.replacedInputs = NULL;
 	}
+	else if (! TagsToStdout && TagFile.name)
+		writeSidecarIndexes (TagFile.name);
+	if (TagFile.inputFileIds)
+	{
+		hashTableDelete (TagFile.inputFileIds);
+		TagFile.inputFileIds = NULL;
+	}
+	vStringDelete (TagFile.lastInputFileId);
+	TagFile.lastInputFileId = NULL;
 
 	TagFile.mio = NULL;
+	TagFile.inMemory = false;
 	if (TagFile.name)
 		eFree (TagFile.name);
 	TagFile.name = NULL;
@@ -670,45 +1598,71 @@ extern void closeTagFile (const bool resize)
  *  effect on the fileGetc () function.  During copying, any '\' characters
  *  are doubled and a leading '^' or trailing '$' is also quoted. End of line
  *  characters (line feed or carriage return) are dropped.
+ *
+ *  The runs of bytes needing no quote are written at once with WRITE_FUNC.
  */
-static size_t appendInputLine (int putc_func (char , void *), const char *const line,
-							   unsigned int patternLengthLimit,
+static size_t appendInputLine (int write_func (const char *, size_t, void *),
+							   const char *const line,
+							   size_t lineLength, unsigned int patternLengthLimit,
 							   void * data, bool *omitted)
 {
 	size_t length = 0;
-	const char *p;
+	const unsigned char *p = (const unsigned char *) line;
+	const unsigned char *const end = p + lineLength;
+	const unsigned char searchChar = Option.backward ? '?' : '/';
+	const unsigned char stops [] = { '\0', '\r', '\n', '\\', '$', searchChar };
 	int extraLength = 0;
 
 	/*  Write everything up to, but not including, a line end character.
+	 *  LINE may not be terminated with '\0'; LINELENGTH bounds it.
 	 */
 	*omitted = false;
-	for (p = line  ;  *p != '\0'  ;  ++p)
+	while (p < end)
 	{
-		const int next = *(p + 1);
-		const int c = *p;
+		const unsigned char *q = findByteInSet (p, end, stops, ARRAY_SIZE (stops));
+		size_t n = q - p;
+		int c;
+
+		if (patternLengthLimit != 0)
+		{
+			if (length >= patternLengthLimit)
+				n = 0;
+			else if (n > patternLengthLimit - length)
+				n = patternLengthLimit - length;
+		}
+		if (n > 0)
+		{
+			write_func ((const char *) p, n, data);
+			length += n;
+			p += n;
+			if (p == end)
+				break;
+		}
 
-		if (c == '\r'  ||  c == '\n')
+		c = *p;
+		if (c == '\0'  ||  c == '\r'  ||  c == '\n')
 			break;
 
 		if (patternLengthLimit != 0 && length >= patternLengthLimit &&
 			/* Do not cut inside a multi-byte UTF-8 character, but safe-guard it not to
 			 * allow more than one extra valid UTF-8 character in case it's not actually
 			 * UTF-8.  To do that, limit to an extra 3 UTF-8 sub-bytes (0b10xxxxxx). */
-			((((unsigned char) c) & 0xc0) != 0x80 || ++extraLength > 3))
+			((c & 0xc0) != 0x80 || ++extraLength > 3))
 		{
 			*omitted = true;
 			break;
 		}
 		/*  If character is '\', or a terminal '$', then quote it.
 		 */
-		if (c == '\\'  ||  c == (Option.backward ? '?' : '/')  ||
-			(c == '$'  &&  (next == '\n'  ||  next == '\r')))
+		if (c == '\\'  ||  c == searchChar  ||
+			(c == '$'  &&  p + 1 < end  &&  (p[1] == '\n'  ||  p[1] == '\r')))
 		{
-			putc_func ('\\', data);
+			write_func ("\\", 1, data);
 			++length;
 		}
-		putc_func (c, data);
+		write_func ((const char *) p, 1, data);
 		++length;
+		++p;
 	}
 
 	return length;
@@ -721,6 +1675,13 @@ static int vstring_putc (char c, void *data)
 	return 1;
 }
 
+static int vstring_write (const char* s, size_t len, void *data)
+{
+	vString *str = data;
+	vStringNCatSUnsafe (str, s, len);
+	return (int) len;
+}
+
 static int vstring_puts (const char* s, void *data)
 {
 	vString *str = data;
@@ -831,6 +1792,123 @@ static char* getFullQualifiedScopeNameFromCorkQueue (const tagEntryInfo * inner_
 	return vStringDeleteUnwrap (n);
 }
 
+/* The entry of CORKINDEX in the cork queue. The entries released by
+ * flushCorkQueue () are removed from the queue; the cork index of an
+ * entry is its position in the queue plus the number of them. */
+static void *corkQueueItem (int corkIndex)
+{
+	if (corkIndex == CORK_NIL)
+		return ptrArrayItem (TagFile.corkQueue, 0);
+	Assert ((unsigned int) corkIndex > TagFile.corkReleased);
+	return ptrArrayItem (TagFile.corkQueue,
+						 (unsigned int) corkIndex - TagFile.corkReleased);
+}
+
+/* The position in the cork queue of the entry of CORKINDEX, or CORK_NIL
+ * if the entry is released. */
+static int corkQueuePosition (int corkIndex)
+{
+	if (corkIndex <= CORK_NIL || (unsigned int) corkIndex <= TagFile.corkReleased)
+		return CORK_NIL;
+	return corkIndex - (int) TagFile.corkReleased;
+}
+
+/* The table is indexed by the positions in the cork queue. */
+static corkScopeTable *newCorkScopeTable (void)
+{
+	unsigned int count = ptrArrayCount (TagFile.corkQueue);
+	corkScopeTable *table = xMalloc (1, corkScopeTable);
+
+	table->scopes = xMalloc (count, corkScope);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		const tagEntryInfo *e = ptrArrayItem (TagFile.corkQueue, i);
+		corkScope *s = table->scopes + i;
+		int scopeIndex = corkQueuePosition (e->extensionFields.scopeIndex);
+
+		s->loop = (i != CORK_NIL && scopeIndex == (int) i);
+		if (s->loop || scopeIndex <= CORK_NIL || (unsigned int) scopeIndex >= count)
+			scopeIndex = CORK_NIL;
+		s->scopeIndex = scopeIndex;
+		s->namedIndex = CORK_NIL;
+		s->kindIndex = e->kindIndex;
+		s->langType = e->langType;
+		s->name = e->name;
+		s->fqName = NULL;
+		s->placeholder = e->placeholder;
+	}
+	table->chain = intArrayNew ();
+	table->buffer = vStringNew ();
+	return table;
+}
+
+static void deleteCorkScopeTable (corkScopeTable *table)
+{
+	vStringDelete (table->buffer);
+	intArrayDelete (table->chain);
+	eFree (table->scopes);
+	eFree (table);
+}
+
+/* Same as getFullQualifiedScopeNameFromCorkQueue but the names built for
+ * the outer scopes are reused. */
+static const char *getFullQualifiedScopeNameFromCorkScopes (corkScopeTable *table,
+															 int index)
+{
+	corkScope *const scopes = table->scopes;
+	vString *const buffer = table->buffer;
+
+	/* Find the innermost scope having its name built. */
+	while (index != CORK_NIL && scopes [index].fqName == NULL)
+	{
+		intArrayAdd (table->chain, index);
+		index = scopes [index].scopeIndex;
+	}
+
+	/* Build the names from the outermost scope. */
+	while (!intArrayIsEmpty (table->chain))
+	{
+		int named = (index == CORK_NIL)? CORK_NIL: scopes [index].namedIndex;
+		corkScope *s;
+		const char *sep;
+
+		index = intArrayRemoveLast (table->chain);
+		s = scopes + index;
+
+		if (s->loop)
+		{
+			const tagEntryInfo *e = ptrArrayItem (TagFile.corkQueue, index);
+			error (WARNING,
+				   "interanl error: scope information made a loop structure: %s in %s:%lu",
+				   e->name, e->inputFileName, e->lineNumber);
+		}
+
+		if (s->placeholder)
+		{
+			s->namedIndex = named;
+			s->fqName = (named == CORK_NIL)? internString (""): scopes [named].fqName;
+			continue;
+		}
+
+		vStringClear (buffer);
+		if (named == CORK_NIL)
+			sep = scopeSeparatorFor (s->langType, s->kindIndex, KIND_GHOST_INDEX);
+		else
+		{
+			vStringCatS (buffer, scopes [named].fqName);
+			sep = scopeSeparatorFor (s->langType, s->kindIndex, scopes [named].kindIndex);
+		}
+		if (sep)
+			vStringCatS (buffer, sep);
+		vStringCatS (buffer, s->name);
+
+		s->namedIndex = index;
+		s->fqName = internStringN (vStringValue (buffer), vStringLength (buffer));
+	}
+
+	return scopes [index].fqName;
+}
+
 extern void getTagScopeInformation (tagEntryInfo *const tag,
 									const char **kind, const char **name)
 {
@@ -845,13 +1923,25 @@ extern void getTagScopeInformation (tagEntryInfo *const tag,
 		&& scope
 		&& ptrArrayCount (TagFile.corkQueue) > 0)
 	{
-		char *full_qualified_scope_name = getFullQualifiedScopeNameFromCorkQueue(scope);
-		Assert (full_qualified_scope_name);
-
 		/* Make the information reusable to generate full qualified entry, and xformat output*/
 		tag->extensionFields.scopeLangType = scope->langType;
 		tag->extensionFields.scopeKindIndex = scope->kindIndex;
-		tag->extensionFields.scopeName = full_qualified_scope_name;
+		/* While the cork queue is written, the name of each scope is
+		 * built once from the name of its outer scope and shared by
+		 * the inner tags, the scope fields, and the qualified tags.
+		 * Walking the chain is left only for a tag looked at before
+		 * its queue is written. */
+		if (TagFile.corkScopes)
+			tag->extensionFields.scopeName =
+				getFullQualifiedScopeNameFromCorkScopes (TagFile.corkScopes,
+														 corkQueuePosition (tag->extensionFields.scopeIndex));
+		else
+		{
+			char *full_qualified_scope_name = getFullQualifiedScopeNameFromCorkQueue(scope);
+			Assert (full_qualified_scope_name);
+			tag->extensionFields.scopeName = internString (full_qualified_scope_name);
+			eFree (full_qualified_scope_name);
+		}
 	}
 
 	if (tag->extensionFields.scopeKindIndex != KIND_GHOST_INDEX  &&
@@ -875,11 +1965,12 @@ extern void getTagScopeInformation (tagEntryInfo *const tag,
 static int   makePatternStringCommon (const tagEntryInfo *const tag,
 									  int (* putc_func) (char , void *),
 									  int (* puts_func) (const char* , void *),
+									  int (* write_func) (const char* , size_t, void *),
 									  void *output)
 {
 	int length = 0;
 
-	char *line;
+	const char *line;
 	int searchChar;
 	const char *terminator;
 	bool  omitted;
@@ -889,31 +1980,47 @@ static int   makePatternStringCommon (const tagEntryInfo *const tag,
 	int (* puts_o_func)(const char* , void *);
 	void * o_output;
 
-	static vString *cached_pattern;
-	static MIOPos   cached_location;
+	static CTAGS_THREAD_LOCAL vString *cached_pattern;
+	static CTAGS_THREAD_LOCAL MIOPos   cached_location;
 	if (TagFile.patternCacheValid
 		&& (! tag->truncateLineAfterTag)
 		&& (memcmp (&tag->filePosition, &cached_location, sizeof(MIOPos)) == 0))
 		return puts_func (vStringValue (cached_pattern), output);
 
-	line = readLineFromBypassForTag (TagFile.vLine, tag, NULL);
+	/* The line can be taken from the input buffer directly unless it
+	   is truncated. appendInputLine () takes no more than a few bytes
+	   over the limit of the pattern length; the rest of a long line
+	   is not looked at. */
+	line = tag->truncateLineAfterTag
+		? NULL
+		: peekLineFromBypass (tag->filePosition,
+							  Option.patternLengthLimit
+							  ? Option.patternLengthLimit + 8: 0,
+							  &line_len);
 	if (line == NULL)
 	{
-		/* This can be occurs if the size of input file is zero, and
-		   an empty regex pattern (//) matches to the input. */
-		line = "";
-		line_len = 0;
-	}
-	else
-		line_len = vStringLength (TagFile.vLine);
+		char *copy = readLineFromBypassForTag (TagFile.vLine, tag, NULL);
 
-	if (tag->truncateLineAfterTag)
-	{
-		size_t truncted_len;
+		if (copy == NULL)
+		{
+			/* This can be occurs if the size of input file is zero, and
+			   an empty regex pattern (//) matches to the input. */
+			line = "";
+			line_len = 0;
+		}
+		else
+		{
+			line_len = vStringLength (TagFile.vLine);
+			if (tag->truncateLineAfterTag)
+			{
+				size_t truncted_len;
 
-		truncted_len = truncateTagLineAfterTag (line, tag->name, false);
-		if (truncted_len > 0)
-			line_len = truncted_len;
+				truncted_len = truncateTagLineAfterTag (copy, tag->name, false);
+				if (truncted_len > 0)
+					line_len = truncted_len;
+			}
+			line = copy;
+		}
 	}
 
 	searchChar = Option.backward ? '?' : '/';
@@ -928,14 +2035,15 @@ static int   makePatternStringCommon (const tagEntryInfo *const tag,
 		o_output    = output;
 		putc_func   = vstring_putc;
 		puts_func   = vstring_puts;
+		write_func  = vstring_write;
 		output      = cached_pattern;
 	}
 
 	length += putc_func(searchChar, output);
 	if ((tag->boundaryInfo & INPUT_BOUNDARY_START) == 0)
 		length += putc_func('^', output);
-	length += appendInputLine (putc_func, line, Option.patternLengthLimit,
-							   output, &omitted);
+	length += appendInputLine (write_func, line, line_len,
+							   Option.patternLengthLimit, output, &omitted);
 	length += puts_func (omitted? "": terminator, output);
 	length += putc_func (searchChar, output);
 
@@ -952,10 +2060,39 @@ static int   makePatternStringCommon (const tagEntryInfo *const tag,
 extern char* makePatternString (const tagEntryInfo *const tag)
 {
 	vString* pattern = vStringNew ();
-	makePatternStringCommon (tag, vstring_putc, vstring_puts, pattern);
+	makePatternStringCommon (tag, vstring_putc, vstring_puts, vstring_write,
+							 pattern);
 	return vStringDeleteUnwrap (pattern);
 }
 
+/* The hash is FNV-1a over the first LINE_HASH_PREFIX bytes of the line
+ * without its line end. tagsLineHash () in libreadtags computes the same
+ * value; keep them in sync. */
+#define LINE_HASH_PREFIX 64
+
+extern unsigned long makeLineHash (const tagEntryInfo *const tag)
+{
+	const char *line;
+	size_t line_len;
+
+	/* No pattern is made, so the line is looked at only for its prefix. */
+	line = peekLineFromBypass (tag->filePosition, LINE_HASH_PREFIX + 2, &line_len);
+	if (line == NULL)
+	{
+		line = readLineFromBypassForTag (TagFile.vLine, tag, NULL);
+		line_len = line? vStringLength (TagFile.vLine): 0;
+	}
+
+	if (line_len > 0 && line [line_len - 1] == '\n')
+		line_len--;
+	if (line_len > 0 && line [line_len - 1] == '\r')
+		line_len--;
+	if (line_len > LINE_HASH_PREFIX)
+		line_len = LINE_HASH_PREFIX;
+
+	return (unsigned long) hashFnv1a32 (line, line_len);
+}
+
 static tagField* tagFieldNew (fieldType ftype, const char *value, bool valueOwner)
 {
 	tagField *f = xMalloc (1, tagField);
@@ -1073,26 +2210,42 @@ static void copyParserFields (const tagEntryInfo *const tag, tagEntryInfo* slot)
 
 static tagEntryInfo *newNilTagEntry (unsigned int corkFlags)
 {
-	tagEntryInfoX *x = xCalloc (1, tagEntryInfoX);
+	tagEntryInfoX *x = arenaAlloc (TagFile.corkArena, sizeof (tagEntryInfoX));
+	memset (x, 0, sizeof (tagEntryInfoX));
 	x->corkIndex = CORK_NIL;
 	x->symtab = RB_ROOT;
 	x->slot.kindIndex = KIND_FILE_INDEX;
 	x->slot.inputFileName = getInputFileName ();
-	x->slot.inputFileName = eStrdup (x->slot.inputFileName);
+	x->slot.inputFileName = arenaStrdup (TagFile.corkArena, x->slot.inputFileName);
 	x->slot.sourceFileName = getSourceFileTagPath();
 	if (x->slot.sourceFileName)
-		x->slot.sourceFileName = eStrdup (x->slot.sourceFileName);
+		x->slot.sourceFileName = arenaStrdup (TagFile.corkArena, x->slot.sourceFileName);
 	return &(x->slot);
 }
 
-static void copyExtraDynamic (const tagEntryInfo *const src, tagEntryInfo *const dst)
+/* The bits of the dynamic extras are in TagFile.corkArena for an entry
+ * in the cork queue, and in the parser arena for the others. */
+static uint8_t *newExtraDynamic (bool inCorkQueue)
+{
+	unsigned int n = countXtags () - XTAG_COUNT;
+	uint8_t *r;
+
+	if (!inCorkQueue)
+		return parserArenaAlloc ((n / 8) + 1);
+
+	r = arenaAlloc (TagFile.corkArena, (n / 8) + 1);
+	memset (r, 0, (n / 8) + 1);
+	return r;
+}
+
+static void copyExtraDynamic (const tagEntryInfo *const src, tagEntryInfo *const dst,
+							  bool inCorkQueue)
 {
 	if (dst->extraDynamic)
 	{
 		unsigned int n = countXtags () - XTAG_COUNT;
-		dst->extraDynamic = xCalloc ((n / 8) + 1, uint8_t);
+		dst->extraDynamic = newExtraDynamic (inCorkQueue);
 		memcpy (dst->extraDynamic, src->extraDynamic, (n / 8) + 1);
-		PARSER_TRASH_BOX(dst->extraDynamic, eFree);
 	}
 }
 
@@ -1101,8 +2254,9 @@ static tagEntryInfoX *copyTagEntry (const tagEntryInfo *const tag,
 									const char *sharedSourceFileName,
 									unsigned int corkFlags)
 {
-	tagEntryInfoX *x = xMalloc (1, tagEntryInfoX);
+	tagEntryInfoX *x = arenaAlloc (TagFile.corkArena, sizeof (tagEntryInfoX));
 	x->symtab = RB_ROOT;
+	RB_CLEAR_NODE (&x->symnode);
 	x->corkIndex = CORK_NIL;
 	memset(&x->intervalnode, 0, sizeof (x->intervalnode));
 	x->__intervalnode_subtree_last = 0;
@@ -1111,7 +2265,7 @@ static tagEntryInfoX *copyTagEntry (const tagEntryInfo *const tag,
 	*slot = *tag;
 
 	if (slot->pattern)
-		slot->pattern = eStrdup (slot->pattern);
+		slot->pattern = arenaStrdup (TagFile.corkArena, slot->pattern);
 
 	if (slot->inputFileName == getInputFileName ())
 	{
@@ -1120,33 +2274,31 @@ static tagEntryInfoX *copyTagEntry (const tagEntryInfo *const tag,
 	}
 	else
 	{
-		slot->inputFileName = eStrdup (slot->inputFileName);
+		slot->inputFileName = arenaStrdup (TagFile.corkArena, slot->inputFileName);
 		slot->isInputFileNameShared = 0;
 	}
 
 	slot->name = eStrdup (slot->name);
 	if (slot->extensionFields.access)
-		slot->extensionFields.access = eStrdup (slot->extensionFields.access);
+		slot->extensionFields.access = internString (slot->extensionFields.access);
 	if (slot->extensionFields.implementation)
-		slot->extensionFields.implementation = eStrdup (slot->extensionFields.implementation);
+		slot->extensionFields.implementation = internString (slot->extensionFields.implementation);
 	if (slot->extensionFields.inheritance)
 		slot->extensionFields.inheritance = eStrdup (slot->extensionFields.inheritance);
 	if (slot->extensionFields.scopeName)
-		slot->extensionFields.scopeName = eStrdup (slot->extensionFields.scopeName);
+		slot->extensionFields.scopeName = internString (slot->extensionFields.scopeName);
 	if (slot->extensionFields.signature)
 		slot->extensionFields.signature = eStrdup (slot->extensionFields.signature);
 	if (slot->extensionFields.typeRef[0])
-		slot->extensionFields.typeRef[0] = eStrdup (slot->extensionFields.typeRef[0]);
+		slot->extensionFields.typeRef[0] = internString (slot->extensionFields.typeRef[0]);
 	if (slot->extensionFields.typeRef[1])
-		slot->extensionFields.typeRef[1] = eStrdup (slot->extensionFields.typeRef[1]);
+		slot->extensionFields.typeRef[1] = internString (slot->extensionFields.typeRef[1]);
 #ifdef HAVE_LIBXML
 	if (slot->extensionFields.xpath)
 		slot->extensionFields.xpath = eStrdup (slot->extensionFields.xpath);
 #endif
 
-	copyExtraDynamic (tag, slot);
-	if (slot->extraDynamic)
-		PARSER_TRASH_BOX_TAKE_BACK(slot->extraDynamic);
+	copyExtraDynamic (tag, slot, true);
 
 	if (slot->sourceFileName == NULL)
 		slot->isSourceFileNameShared = 0;
@@ -1164,7 +2316,7 @@ static tagEntryInfoX *copyTagEntry (const tagEntryInfo *const tag,
 	}
 	else
 	{
-		slot->sourceFileName = eStrdup (slot->sourceFileName);
+		slot->sourceFileName = arenaStrdup (TagFile.corkArena, slot->sourceFileName);
 		slot->isSourceFileNameShared = 0;
 	}
 
@@ -1202,55 +2354,42 @@ static void clearParserFields (tagEntryInfo *const tag)
 	}
 }
 
+/* The entry itself, the pattern, the file names, and the dynamic extras
+ * are in TagFile.corkArena. */
 static void deleteTagEnry (void *data)
 {
 	tagEntryInfo *slot = data;
 
 	if (slot->kindIndex == KIND_FILE_INDEX)
-	{
-		eFree ((char *)slot->inputFileName);
-		if (slot->sourceFileName)
-			eFree ((char *)slot->sourceFileName);
-		goto out;
-	}
-
-	if (slot->pattern)
-		eFree ((char *)slot->pattern);
-
-	if (!slot->isInputFileNameShared)
-		eFree ((char *)slot->inputFileName);
+		return;
 
 	eFree ((char *)slot->name);
 
-	if (slot->extensionFields.access)
+	if (slot->extensionFields.access
+		&& !isInternedString (slot->extensionFields.access))
 		eFree ((char *)slot->extensionFields.access);
-	if (slot->extensionFields.implementation)
+	if (slot->extensionFields.implementation
+		&& !isInternedString (slot->extensionFields.implementation))
 		eFree ((char *)slot->extensionFields.implementation);
 	if (slot->extensionFields.inheritance)
 		eFree ((char *)slot->extensionFields.inheritance);
-	if (slot->extensionFields.scopeName)
+	if (slot->extensionFields.scopeName
+		&& !isInternedString (slot->extensionFields.scopeName))
 		eFree ((char *)slot->extensionFields.scopeName);
 	if (slot->extensionFields.signature)
 		eFree ((char *)slot->extensionFields.signature);
-	if (slot->extensionFields.typeRef[0])
+	if (slot->extensionFields.typeRef[0]
+		&& !isInternedString (slot->extensionFields.typeRef[0]))
 		eFree ((char *)slot->extensionFields.typeRef[0]);
-	if (slot->extensionFields.typeRef[1])
+	if (slot->extensionFields.typeRef[1]
+		&& !isInternedString (slot->extensionFields.typeRef[1]))
 		eFree ((char *)slot->extensionFields.typeRef[1]);
 #ifdef HAVE_LIBXML
 	if (slot->extensionFields.xpath)
 		eFree ((char *)slot->extensionFields.xpath);
 #endif
 
-	if (slot->extraDynamic)
-		eFree (slot->extraDynamic);
-
-	if (slot->sourceFileName && !slot->isSourceFileNameShared)
-		eFree ((char *)slot->sourceFileName);
-
 	clearParserFields (slot);
-
- out:
-	eFree (slot);
 }
 
 static void corkSymtabPut (tagEntryInfoX *scope, const char* name, tagEntryInfoX *item)
@@ -1308,6 +2447,7 @@ static void corkSymtabUnlink (tagEntryInfoX *scope, tagEntryInfoX *item)
 {
 	struct rb_root *root = &scope->symtab;
 	rb_erase (&item->symnode, root);
+	RB_CLEAR_NODE (&item->symnode);
 }
 
 extern bool foreachEntriesInScope (int corkIndex,
@@ -1315,7 +2455,7 @@ extern bool foreachEntriesInScope (int corkIndex,
 								   entryForeachFunc func,
 								   void *data)
 {
-	tagEntryInfoX *x = ptrArrayItem (TagFile.corkQueue, corkIndex);
+	tagEntryInfoX *x = corkQueueItem (corkIndex);
 
 	struct rb_root *root = &x->symtab;
 	tagEntryInfoX *rep = NULL;
@@ -1559,9 +2699,9 @@ extern void registerEntry (int corkIndex)
 	Assert (TagFile.corkFlags & CORK_SYMTAB);
 	Assert (corkIndex != CORK_NIL);
 
-	tagEntryInfoX *e = ptrArrayItem (TagFile.corkQueue, corkIndex);
+	tagEntryInfoX *e = corkQueueItem (corkIndex);
 	{
-		tagEntryInfoX *scope = ptrArrayItem (TagFile.corkQueue, e->slot.extensionFields.scopeIndex);
+		tagEntryInfoX *scope = corkQueueItem (e->slot.extensionFields.scopeIndex);
 		corkSymtabPut (scope, e->slot.name, e);
 	}
 }
@@ -1571,9 +2711,9 @@ extern void unregisterEntry (int corkIndex)
 	Assert (TagFile.corkFlags & CORK_SYMTAB);
 	Assert (corkIndex != CORK_NIL);
 
-	tagEntryInfoX *e = ptrArrayItem (TagFile.corkQueue, corkIndex);
+	tagEntryInfoX *e = corkQueueItem (corkIndex);
 	{
-		tagEntryInfoX *scope = ptrArrayItem (TagFile.corkQueue, e->slot.extensionFields.scopeIndex);
+		tagEntryInfoX *scope = corkQueueItem (e->slot.extensionFields.scopeIndex);
 		corkSymtabUnlink (scope, e);
 	}
 
@@ -1588,7 +2728,7 @@ static int queueTagEntry (const tagEntryInfo *const tag)
 	tagEntryInfoX * entry = copyTagEntry (tag, nil->inputFileName, nil->sourceFileName,
 										TagFile.corkFlags);
 
-	if (ptrArrayCount (TagFile.corkQueue) == (size_t)INT_MAX)
+	if (ptrArrayCount (TagFile.corkQueue) + TagFile.corkReleased == (size_t)INT_MAX)
 	{
 		if (!warned)
 		{
@@ -1602,7 +2742,7 @@ static int queueTagEntry (const tagEntryInfo *const tag)
 	}
 	warned = false;
 
-	corkIndex = (int)ptrArrayAdd (TagFile.corkQueue, entry);
+	corkIndex = (int)(ptrArrayAdd (TagFile.corkQueue, entry) + TagFile.corkReleased);
 	entry->corkIndex = corkIndex;
 	entry->slot.inCorkQueue = 1;
 
@@ -1614,8 +2754,7 @@ static int queueTagEntry (const tagEntryInfo *const tag)
 		&& entry->slot.extensionFields._endLine > entry->slot.lineNumber
 		&& !isTagExtraBitMarked (tag, XTAG_QUALIFIED_TAGS))
 	{
-		intervaltab_insert(entry, &TagFile.intervaltab);
-		entry->slot.inIntevalTab = 1;
+		insertToIntervalTab (entry);
 	}
 	return corkIndex;
 }
@@ -1635,10 +2774,7 @@ extern void updateTagLine (tagEntryInfo *tag, unsigned long lineNumber,
 	tag->boundaryInfo = getNestedInputBoundaryInfo (lineNumber);
 
 	if (entry && tag->lineNumber < tag->extensionFields._endLine)
-	{
-		intervaltab_insert(entry, &TagFile.intervaltab);
-		tag->inIntevalTab = 1;
-	}
+		insertToIntervalTab (entry);
 }
 
 extern void setTagEndLine(tagEntryInfo *tag, unsigned long endLine)
@@ -1669,10 +2805,7 @@ extern void setTagEndLine(tagEntryInfo *tag, unsigned long endLine)
 
 	tag->extensionFields._endLine = endLine;
 	if (endLine > tag->lineNumber)
-	{
-		intervaltab_insert(entry, &TagFile.intervaltab);
-		tag->inIntevalTab = 1;
-	}
+		insertToIntervalTab (entry);
 }
 
 extern void setTagEndLineToCorkEntry (int corkIndex, unsigned long endLine)
@@ -1716,21 +2849,8 @@ static bool isTagWritable (const tagEntryInfo *const tag)
 			(makeRoleBit(available_roles)))
 			return false;
 
-		/* TODO: optimization
-		   A Bitmasks representing all enabled roles can be calculated at the
-		   end of initializing the parser. Calculating each time when checking
-		   a tag entry is not needed. */
-		for (unsigned int roleIndex = 0; roleIndex < available_roles; roleIndex++)
-		{
-			if (isRoleAssigned(tag, roleIndex))
-			{
-				if (isLanguageRoleEnabled (tag->langType, tag->kindIndex,
-											 roleIndex))
-					return true;
-			}
-
-		}
-		return false;
+		return (tag->extensionFields.roleBits
+				& getLanguageEnabledRoleBits (tag->langType, tag->kindIndex)) != 0;
 	}
 	else if (isLanguageKindRefOnly(tag->langType, tag->kindIndex))
 	{
@@ -1745,9 +2865,21 @@ static bool isTagWritable (const tagEntryInfo *const tag)
 		&& isTagExtraBitMarked(tag, XTAG_ANONYMOUS))
 		return false;
 
+	if (TagFile.topLevelOnly
+		&& (tag->extensionFields.scopeIndex != CORK_NIL
+			|| tag->extensionFields.scopeName != NULL))
+		return false;
+
 	return true;
 }
 
+/* The tags having a scope are not written while parsing an input file
+ * looking minified with --minified=toplevel. */
+extern void setTagFileTopLevelOnly (bool topLevelOnly)
+{
+	TagFile.topLevelOnly = topLevelOnly;
+}
+
 static void buildFqTagCache (tagEntryInfo *const tag)
 {
 	getTagScopeInformation (tag, NULL, NULL);
@@ -1756,9 +2888,15 @@ static void buildFqTagCache (tagEntryInfo *const tag)
 static void writeTagEntry (const tagEntryInfo *const tag)
 {
 	int length = 0;
+	statsTime start;
 
 	Assert (tag->kindIndex != KIND_GHOST_INDEX);
 
+	/* The tags emitted in uncorkTagFile () are not traced one by one. */
+	if (TagFile.corkQueue == NULL)
+		beginTraceEvent (TRACE_EVENT_WRITE, NULL);
+	startStatsPhase (&start);
+
 	DebugStatement ( debugEntry (tag); )
 
 #ifdef _WIN32
@@ -1785,16 +2923,36 @@ static void writeTagEntry (const tagEntryInfo *const tag)
 		buildFqTagCache ( (tagEntryInfo *const)tag);
 	}
 
+	/* A tag on a line longer than --max-line-bytes is located with its
+	 * line number; the line is not read again for making a pattern.
+	 * const is discarded to update the locator of TAG. */
+	if (!tag->lineNumberEntry && !tag->isFileEntry && tag->pattern == NULL
+		&& isLongLineInInputFile (tag->filePosition))
+		((tagEntryInfo *const)tag)->lineNumberEntry = true;
+
+	usdtProbe3 (tag, tag->name, getLanguageName (tag->langType),
+				getTagKindName (tag));
 	length = writerWriteTag (TagFile.mio, tag);
 
 	if (length > 0)
 	{
 		++TagFile.numTags.added;
 		rememberMaxLengths (strlen (tag->name), (size_t) length);
+		if (TagWriteObserver)
+			TagWriteObserver (tag, TagWriteObserverData);
 	}
 	DebugStatement ( if (TagFile.mio) mio_flush (TagFile.mio); )
 
 	abort_if_ferror (TagFile.mio);
+	endStatsPhase (STATS_PHASE_WRITE, &start);
+	if (TagFile.corkQueue == NULL)
+		endTraceEvent (TRACE_EVENT_WRITE);
+}
+
+extern void setTagWriteObserver (tagWriteObserver observer, void *data)
+{
+	TagWriteObserver = observer;
+	TagWriteObserverData = data;
 }
 
 extern bool writePseudoTag (const ptagDesc *desc,
@@ -1824,26 +2982,167 @@ extern void corkTagFile (unsigned int corkFlags)
 	{
 		TagFile.corkFlags = corkFlags;
 		TagFile.corkQueue = ptrArrayNew (deleteTagEnry);
+		TagFile.corkArena = arenaNew (64 * sizeof (tagEntryInfoX));
+		TagFile.corkReleased = 0;
 		tagEntryInfo *nil = newNilTagEntry (corkFlags);
 		ptrArrayAdd (TagFile.corkQueue, nil);
 		TagFile.intervaltab = RB_ROOT;
+		TagFile.intervalSweep.intervals = 0;
+		invalidateIntervalSweep ();
 	}
 }
 
-extern void uncorkTagFile (void)
+/* The reference tags of the same name, kind, roles and input file in
+ * the cork queue, written once as the first of them with
+ * --aggregate-references. */
+typedef struct sRefAggregate {
+	unsigned long count;
+	ulongArray *lines;
+} refAggregate;
+
+static unsigned int hashRefTag (const void *const key)
 {
-	unsigned int i;
+	const tagEntryInfo *tag = key;
+	unsigned int h = hashCstrhash (tag->name);
 
-	TagFile.cork--;
+	h = h * 31 + (unsigned int) tag->langType;
+	h = h * 31 + (unsigned int) tag->kindIndex;
+	return h * 31 + (unsigned int) (tag->extensionFields.roleBits
+									^ (tag->extensionFields.roleBits >> 32));
+}
 
-	if (TagFile.cork > 0)
-		return ;
+static bool isSameNullableString (const char *a, const char *b)
+{
+	return (a == b) || (a && b && strcmp (a, b) == 0);
+}
+
+static bool isSameRefTag (const void *a, const void *b)
+{
+	const tagEntryInfo *ta = a;
+	const tagEntryInfo *tb = b;
+
+	return ta->langType == tb->langType
+		&& ta->kindIndex == tb->kindIndex
+		&& ta->extensionFields.roleBits == tb->extensionFields.roleBits
+		&& strcmp (ta->name, tb->name) == 0
+		&& strcmp (ta->inputFileName, tb->inputFileName) == 0
+		&& isSameNullableString (ta->sourceFileName, tb->sourceFileName);
+}
+
+static void deleteRefAggregate (void *data)
+{
+	refAggregate *aggregate = data;
+
+	ulongArrayDelete (aggregate->lines);
+	eFree (aggregate);
+}
+
+/* Aggregate the writable reference tags in the cork queue into the
+ * first ones of them, and return the flags of the tags aggregated,
+ * which are not written, indexed by cork index. */
+static bool *aggregateRefTags (void)
+{
+	const unsigned int count = ptrArrayCount (TagFile.corkQueue);
+	bool *aggregated = xCalloc (count, bool);
+
+	TagFile.refAggregates = hashTableNew (256, hashRefTag, isSameRefTag,
+										  NULL, deleteRefAggregate);
+	for (unsigned int i = 1; i < count; i++)
+	{
+		tagEntryInfo *tag = ptrArrayItem (TagFile.corkQueue, i);
+		refAggregate *aggregate;
+		unsigned long line;
+
+		if (tag->extensionFields.roleBits == 0 || !isTagWritable (tag))
+			continue;
+
+		aggregate = hashTableGetItem (TagFile.refAggregates, tag);
+		if (aggregate == NULL)
+		{
+			aggregate = xMalloc (1, refAggregate);
+			aggregate->count = 0;
+			aggregate->lines = ulongArrayNew ();
+			hashTablePutItem (TagFile.refAggregates, tag, aggregate);
+		}
+		else
+			aggregated [i] = true;
+
+		line = tag->lineNumber;
+		if (Option.lineDirectives)
+			line += tag->sourceLineNumberDifference;
+		aggregate->count++;
+		ulongArrayAdd (aggregate->lines, line);
+	}
+	return aggregated;
+}
+
+static refAggregate *getRefAggregate (const tagEntryInfo *const tag)
+{
+	if (TagFile.refAggregates == NULL || tag->extensionFields.roleBits == 0)
+		return NULL;
+	return hashTableGetItem (TagFile.refAggregates, tag);
+}
+
+extern unsigned long getTagReferenceCount (const tagEntryInfo *const tag)
+{
+	refAggregate *aggregate = getRefAggregate (tag);
+
+	return aggregate? aggregate->count: 0;
+}
+
+/* The lines are written in ascending order without duplicates, and
+ * the runs of consecutive lines as ranges: "3,7-9,20". */
+extern void catTagReferenceLines (const tagEntryInfo *const tag, vString *b)
+{
+	refAggregate *aggregate = getRefAggregate (tag);
+	const char *sep = "";
+	unsigned int count;
+	char buf [48];
+
+	if (aggregate == NULL)
+		return;
+
+	ulongArraySort (aggregate->lines, false);
+	count = ulongArrayCount (aggregate->lines);
+	for (unsigned int i = 0; i < count; )
+	{
+		unsigned long first = ulongArrayItem (aggregate->lines, i);
+		unsigned long last = first;
+
+		for (i++; i < count; i++)
+		{
+			unsigned long line = ulongArrayItem (aggregate->lines, i);
+
+			if (line > last + 1)
+				break;
+			last = line;
+		}
+		if (last == first)
+			snprintf (buf, sizeof (buf), "%s%lu", sep, first);
+		else
+			snprintf (buf, sizeof (buf), "%s%lu-%lu", sep, first, last);
+		vStringCatS (b, buf);
+		sep = ",";
+	}
+}
+
+/* Write the entries in the cork queue. This must be called with
+ * TagFile.cork 0 so that the qualified tags made here are written
+ * without being queued. */
+static void writeCorkQueue (void)
+{
+	unsigned int i;
+	bool *aggregated = NULL;
 
+	if (Option.aggregateReferences)
+		aggregated = aggregateRefTags ();
+
+	TagFile.corkScopes = newCorkScopeTable ();
 	for (i = 1; i < ptrArrayCount (TagFile.corkQueue); i++)
 	{
 		tagEntryInfo *tag = ptrArrayItem (TagFile.corkQueue, i);
 
-		if (!isTagWritable(tag))
+		if (!isTagWritable(tag) || (aggregated && aggregated [i]))
 			continue;
 
 		writeTagEntry (tag);
@@ -1860,15 +3159,117 @@ extern void uncorkTagFile (void)
 					&& tag->extensionFields.scopeIndex == CORK_NIL)))
 			makeQualifiedTagEntry (tag);
 	}
+	deleteCorkScopeTable (TagFile.corkScopes);
+	TagFile.corkScopes = NULL;
+
+	if (aggregated)
+	{
+		eFree (aggregated);
+		hashTableDelete (TagFile.refAggregates);
+		TagFile.refAggregates = NULL;
+	}
+}
+
+extern void uncorkTagFile (void)
+{
+	statsTime start;
+
+	TagFile.cork--;
+
+	if (TagFile.cork > 0)
+		return ;
+
+	beginTraceEvent (TRACE_EVENT_UNCORK, NULL);
+	startStatsPhase (&start);
+
+	writeCorkQueue ();
 
 	ptrArrayDelete (TagFile.corkQueue);
 	TagFile.corkQueue = NULL;
+	arenaDelete (TagFile.corkArena);
+	TagFile.corkArena = NULL;
+	endStatsPhase (STATS_PHASE_UNCORK, &start);
+	endTraceEvent (TRACE_EVENT_UNCORK);
+}
+
+extern void flushCorkQueue (void)
+{
+	unsigned int count;
+	arena *oldArena;
+	tagEntryInfo *oldNil, *nil;
+	statsTime start;
+
+	if (TagFile.cork != 1 || !isCorkQueueFlushable ())
+		return;
+
+	count = ptrArrayCount (TagFile.corkQueue);
+	if (count <= 1)
+		return;
+
+	if (Option.aggregateReferences)
+	{
+		const memoryTotals flushed = { .corkFlushed = 1 };
+		addMemoryTotals (&flushed);
+	}
+
+	beginTraceEvent (TRACE_EVENT_UNCORK, NULL);
+	startStatsPhase (&start);
+
+	TagFile.cork = 0;
+	writeCorkQueue ();
+	TagFile.cork = 1;
+
+	/* No interval is left. */
+	TagFile.intervaltab = RB_ROOT;
+	TagFile.intervalSweep.intervals = 0;
+	invalidateIntervalSweep ();
+
+	/* The nil entry is made again in a new arena for the entries queued
+	 * from now on; the top-level entries registered in it are gone. */
+	oldArena = TagFile.corkArena;
+	oldNil = ptrArrayItem (TagFile.corkQueue, 0);
+	TagFile.corkArena = arenaNew (64 * sizeof (tagEntryInfoX));
+	nil = newNilTagEntry (TagFile.corkFlags);
+	nil->inputFileName = arenaStrdup (TagFile.corkArena, oldNil->inputFileName);
+	nil->sourceFileName = oldNil->sourceFileName
+		? arenaStrdup (TagFile.corkArena, oldNil->sourceFileName)
+		: NULL;
+
+	ptrArrayDeleteLastInBatch (TagFile.corkQueue, count);
+	ptrArrayAdd (TagFile.corkQueue, nil);
+	TagFile.corkReleased += count - 1;
+	arenaDelete (oldArena);
+
+	endStatsPhase (STATS_PHASE_UNCORK, &start);
+	endTraceEvent (TRACE_EVENT_UNCORK);
+}
+
+/* Drop the entries queued after the first COUNT ones. */
+extern void truncateCorkQueue (size_t count)
+{
+	size_t n = countEntryInCorkQueue ();
+
+	Assert (count > TagFile.corkReleased && count <= n);
+
+	for (size_t i = n; i > count; i--)
+	{
+		tagEntryInfoX *x = corkQueueItem ((int) (i - 1));
+		int scopeIndex = x->slot.extensionFields.scopeIndex;
+
+		removeFromIntervalTabMaybe (x->corkIndex);
+		/* Top-level entries are registered in the nil entry at 0. */
+		if (!RB_EMPTY_NODE (&x->symnode) && (size_t) scopeIndex < count)
+			corkSymtabUnlink (corkQueueItem (scopeIndex), x);
+	}
+	ptrArrayDeleteLastInBatch (TagFile.corkQueue, (unsigned int) (n - count));
 }
 
 extern tagEntryInfo *getEntryInCorkQueue (int n)
 {
-	if ((CORK_NIL < n) && (((size_t)n) < ptrArrayCount (TagFile.corkQueue)))
-		return ptrArrayItem (TagFile.corkQueue, n);
+	int position = corkQueuePosition (n);
+
+	if ((CORK_NIL < position) && (((size_t)position) < ptrArrayCount (TagFile.corkQueue)))
+		return ptrArrayItem (TagFile.corkQueue, (unsigned int) position);
 	else
 		return NULL;
 }
@@ -1882,7 +3283,7 @@ extern tagEntryInfo *getEntryOfNestingLevel (const NestingLevel *nl)
 
 extern size_t countEntryInCorkQueue (void)
 {
-	return ptrArrayCount (TagFile.corkQueue);
+	return ptrArrayCount (TagFile.corkQueue) + TagFile.corkReleased;
 }
 
 extern void markTagAsPlaceholder (tagEntryInfo *e, bool placeholder)
@@ -2035,7 +3436,8 @@ static void initTagEntryFull (tagEntryInfo *const e, const char *const name,
 	Assert (getInputFileName() != NULL);
 
 	memset (e, 0, sizeof (tagEntryInfo));
-	e->lineNumberEntry = (bool) (Option.locate == EX_LINENUM);
+	e->lineNumberEntry = (bool) (Option.locate == EX_LINENUM
+								 || Option.locate == EX_HASH);
 	e->lineNumber      = lineNumber;
 	e->boundaryInfo    = getNestedInputBoundaryInfo (lineNumber);
 	e->langType        = langType_;
@@ -2145,10 +3547,7 @@ static void markTagExtraBitFull (tagEntryInfo *const tag, xtagType extra, bool m
 	{
 		Assert (extra < countXtags ());
 		Assert (XTAG_COUNT <= countXtags ());
-		unsigned int n = countXtags () - XTAG_COUNT;
-		tag->extraDynamic = xCalloc ((n / 8) + 1, uint8_t);
-		if (!tag->inCorkQueue)
-			PARSER_TRASH_BOX(tag->extraDynamic, eFree);
+		tag->extraDynamic = newExtraDynamic (tag->inCorkQueue);
 		markTagExtraBitFull (tag, extra, mark);
 		return;
 	}
@@ -2214,7 +3613,7 @@ extern void resetTagCorkState (tagEntryInfo *const tag,
 	switch (xtagAction)
 	{
 	case RESET_TAG_MEMBER_COPY:
-		copyExtraDynamic (&original, tag);
+		copyExtraDynamic (&original, tag, false);
 		break;
 	case RESET_TAG_MEMBER_CLEAR:
 		tag->extraDynamic = NULL;
@@ -2317,6 +3716,12 @@ extern void tagFilePosition (MIOPos *p)
 			   "failed to get file position of the tag file\n");
 }
 
+extern long tagFileOffset (void)
+{
+	/* The captured tags are written at the end of the tag file later. */
+	return mio_tell (TagFile.capturedMio? TagFile.capturedMio: TagFile.mio);
+}
+
 extern void setTagFilePosition (MIOPos *p, bool truncation)
 {
 	/* mini-geany doesn't set TagFile.mio. */
@@ -2347,6 +3752,10 @@ extern void setTagFilePosition (MIOPos *p, bool truncation)
 		if (!mio_try_resize (TagFile.mio, (size_t)t1))
 			error (FATAL|PERROR,
 				   "failed to truncate the tag file %ld -> %ld\n", t0, t1);
+
+		/* The pseudo tag for the input file may be dropped. */
+		if (TagFile.lastInputFileId)
+			vStringClear (TagFile.lastInputFileId);
 	}
 }
 
@@ -2367,9 +3776,69 @@ extern void markAllEntriesInScopeAsPlaceholder (int index)
 	foreachEntriesInScope (index, NULL, markAsPlaceholderRecursively, NULL);
 }
 
+static void buildIntervalSweep (void)
+{
+	intervalSweep *sweep = &TagFile.intervalSweep;
+	tagEntryInfoX *ex;
+
+	if (sweep->allocated < sweep->intervals)
+	{
+		sweep->allocated = sweep->intervals;
+		sweep->items = xRealloc (sweep->items, sweep->allocated, tagEntryInfoX *);
+		sweep->stack = xRealloc (sweep->stack, sweep->allocated, tagEntryInfoX *);
+	}
+
+	sweep->count = 0;
+	for (ex = intervaltab_iter_first(&TagFile.intervaltab, 0, ULONG_MAX);
+		 ex;
+		 ex = intervaltab_iter_next(ex, 0, ULONG_MAX))
+		sweep->items [sweep->count++] = ex;
+	Assert (sweep->count == sweep->intervals);
+
+	sweep->next = 0;
+	sweep->depth = 0;
+	sweep->line = 0;
+	sweep->valid = true;
+}
+
+/* The stack holds the items having started at or before the last line,
+ * in the order of the tree. An item whose end is before the line is
+ * popped only when it is on the top; the top after popping is the last
+ * item in the tree containing the line, as intervaltab_iter_next()
+ * would find at the end. */
+static int sweepIntervalTab (unsigned long lineNum)
+{
+	intervalSweep *sweep = &TagFile.intervalSweep;
+
+	if (lineNum < sweep->line)
+	{
+		sweep->next = 0;
+		sweep->depth = 0;
+	}
+	sweep->line = lineNum;
+
+	while (sweep->next < sweep->count
+		   && INTERVAL_START (sweep->items [sweep->next]) <= lineNum)
+		sweep->stack [sweep->depth++] = sweep->items [sweep->next++];
+	while (sweep->depth > 0
+		   && INTERVAL_END (sweep->stack [sweep->depth - 1]) < lineNum)
+		sweep->depth--;
+
+	return sweep->depth? sweep->stack [sweep->depth - 1]->corkIndex: CORK_NIL;
+}
+
 extern int queryIntervalTabByLine(unsigned long lineNum)
 {
-	return queryIntervalTabByRange(lineNum, lineNum);
+	intervalSweep *sweep = &TagFile.intervalSweep;
+
+	/* Flattening the table costs as much as a few queries for each
+	 * interval. Until it pays, the tree is used. */
+	if (!sweep->valid && sweep->queries++ < sweep->intervals / 8)
+		return queryIntervalTabByRange(lineNum, lineNum);
+
+	if (!sweep->valid)
+		buildIntervalSweep ();
+	return sweepIntervalTab (lineNum);
 }
 
 extern int queryIntervalTabByRange(unsigned long start, unsigned long end)
@@ -2388,7 +3857,7 @@ extern int queryIntervalTabByCorkEntry(int corkIndex)
 {
 	Assert (corkIndex != CORK_NIL);
 
-	tagEntryInfoX *ex = ptrArrayItem (TagFile.corkQueue, corkIndex);
+	tagEntryInfoX *ex = corkQueueItem (corkIndex);
 	tagEntryInfo *e = &ex->slot;
 
 	if (e->extensionFields._endLine == 0)
@@ -2401,12 +3870,14 @@ extern bool removeFromIntervalTabMaybe(int corkIndex)
 	if (corkIndex == CORK_NIL)
 		return false;
 
-	tagEntryInfoX *ex = ptrArrayItem (TagFile.corkQueue, corkIndex);
+	tagEntryInfoX *ex = corkQueueItem (corkIndex);
 	tagEntryInfo *e = &ex->slot;
 	if (!e->inIntevalTab)
 		return false;
 
 	intervaltab_remove(ex, &TagFile.intervaltab);
 	e->inIntevalTab = 0;
+	TagFile.intervalSweep.intervals--;
+	invalidateIntervalSweep ();
 	return true;
 }
@@ -198,6 +198,16 @@ tagEntryInfo *getEntryInCorkQueue   (int n);
 tagEntryInfo *getEntryOfNestingLevel (const NestingLevel *nl);
 size_t        countEntryInCorkQueue (void);
 
+/* flushCorkQueue writes the tags queued in the cork queue so far, and
+ * releases them to keep the memory for the input small. A parser may
+ * call it where none of the queued tags is referred or changed anymore,
+ * typically after closing a top-level scope; getEntryInCorkQueue()
+ * returns NULL for the cork indexes of the released tags.
+ * Nothing is done when a subparser, a regex pattern with a scope action
+ * or a script, or a rescan point may refer to the queued tags.
+ */
+void          flushCorkQueue (void);
+
 /* If a parser sets (CORK_QUEUE and )CORK_SYMTAB to useCork,
  * the parsesr can use symbol lookup tables for the current input.
  * Each scope has a symbol lookup table.
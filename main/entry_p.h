@@ -30,6 +30,43 @@ extern void freeTagFileResources (void);
 extern const char *tagFileName (void);
 extern void openTagFile (void);
 extern void closeTagFile (const bool resize);
+/* For --filter: the tag file is kept open across the input files */
+extern void beginFilterTagFile (void);
+extern void endFilterTagFile (const bool resize);
+extern void closeFilterTagFile (void);
+extern void spillTagFileMaybe (void);
+extern void setTagFileTopLevelOnly (bool topLevelOnly);
+/* For running parsers in worker processes */
+extern void flushTagFile (void);
+extern void redirectTagFile (MIO *mio);
+extern void appendToTagFile (MIO *mio, long offset, long size, unsigned long numTags);
+extern bool canMergeSortedShards (void);
+extern void sortTagFileShard (MIO *output);
+extern void addSortedShardToTagFile (MIO *mio, char *name, unsigned long numTags);
+/* For --name-index: write TAGFILENAME.index for the sorted tag file */
+extern void writeNameIndex (const char *const tagFileName);
+/* Write the sidecar indexes of TAGFILENAME asked for in the options */
+extern void writeSidecarIndexes (const char *const tagFileName);
+
+/* For incremental mode */
+extern void copyLineToTagFile (const char *const line);
+
+/* For --dedup-content: record the tags written for an input file */
+extern void beginTagFileCapture (void);
+extern MIO *endTagFileCapture (void);
+
+/* The input field of the tags for FILENAME as written to the tag file. */
+extern vString *makeTagFileInputField (const char *const fileName);
+
+/* For --append=replace: drop the tags for FILENAME in the tag file. */
+extern void replaceTagsOfInputFile (const char *const fileName);
+
+/* For the TAG_INPUT_FILE_ID pseudo tag */
+extern bool isInputFileIdEnabled (void);
+extern bool getInputFileId (const char *const tagPath, vString *id);
+/* The id written in the input field of the tags for FILENAME, or NULL
+ * if the field is not an id. The pseudo tag defining the id is written. */
+extern vString *makeTagFileInputFileId (const char *const fileName);
 extern void  setupWriter (void *writerClientData);
 extern bool  teardownWriter (const char *inputFilename);
 
@@ -38,7 +75,14 @@ extern void setNumTagsAdded (unsigned long nadded);
 extern unsigned long numTagsTotal(void);
 extern unsigned long maxTagsLine(void);
 extern void invalidatePatternCache(void);
+/* OBSERVER is called with each tag written to the tag file until NULL
+ * is set. */
+typedef void (* tagWriteObserver) (const tagEntryInfo *const tag, void *data);
+extern void setTagWriteObserver (tagWriteObserver observer, void *data);
+
 extern void tagFilePosition (MIOPos *p);
+/* The offset of the tag written next in the tag file. */
+extern long tagFileOffset (void);
 extern void setTagFilePosition (MIOPos *p, bool truncation);
 extern const char* getTagFileDirectory (void);
 extern void getTagScopeInformation (tagEntryInfo *const tag,
@@ -51,6 +95,14 @@ extern char *readLineFromBypassForTag (vString *const vLine, const tagEntryInfo
 /* Generating pattern associated tag, caller must do eFree for the returned value. */
 extern char* makePatternString (const tagEntryInfo *const tag);
 
+/* Hashing the prefix of the line of the tag for the linehash field */
+extern unsigned long makeLineHash (const tagEntryInfo *const tag);
+
+/* The references aggregated into TAG with --aggregate-references, for
+ * the refcount and reflines fields; 0 for the other tags. */
+extern unsigned long getTagReferenceCount (const tagEntryInfo *const tag);
+extern void catTagReferenceLines (const tagEntryInfo *const tag, vString *b);
+
 
 /* language is optional: can be NULL. */
 extern bool writePseudoTag (const ptagDesc *pdesc,
@@ -60,6 +112,7 @@ extern bool writePseudoTag (const ptagDesc *pdesc,
 
 void          corkTagFile(unsigned int corkFlags);
 void          uncorkTagFile(void);
+void          truncateCorkQueue (size_t count);
 
 extern void makeFileTag (const char *const fileName);
 
@@ -0,0 +1,366 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for recording the begin and end of the
+*   steps of making tags (--_event-trace=<file>).
+*
+*   An event is a timestamp and a few integers stored in a ring buffer;
+*   recording it costs a clock reading, and an allocation only when a
+*   string argument is seen first, so the tracing can be enabled for a
+*   long run. When the ring buffer is full, the
+*   oldest events are overwritten. At exit, the events are written in
+*   the Trace Event Format (JSON) that chrome://tracing, Perfetto UI
+*   (https://ui.perfetto.dev), and speedscope can load.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "debug.h"
+#include "eventtrace_p.h"
+#include "htable.h"
+#include "ptrarray.h"
+#include "routines.h"
+
+/*
+*   MACROS
+*/
+#define TRACE_EVENT_RING_SIZE (1u << 18)	/* must be a power of 2 */
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sTraceEvent {
+	uint64_t time;				/* in nanoseconds from startEventTrace () */
+	unsigned int arg;			/* index in Names + 1, or 0 */
+	unsigned char type;
+	unsigned char begin;
+} traceEvent;
+
+/* The record passed from a worker is this header, traceEvent [eventCount],
+ * and the nameCount arguments terminated by '\0'. */
+typedef struct sTraceEventRecordHeader {
+	unsigned long dropped;
+	unsigned int eventCount;
+	unsigned int nameCount;
+	size_t nameBytes;
+} traceEventRecordHeader;
+
+typedef struct sWorkerTrace {
+	int pid;
+	traceEventRecordHeader header;
+	traceEvent *events;
+	char **names;
+	char *nameBuffer;
+} workerTrace;
+
+/*
+*   DATA DEFINITIONS
+*/
+bool EventTraceEnabled;
+
+static char *TraceFileName;
+static uint64_t BaseTime;
+static traceEvent *Ring;
+static unsigned long long RecordedCount;
+static ptrArray *Names;
+static hashTable *NameTable;	/* name -> index in Names + 1 */
+static ptrArray *WorkerTraces;
+
+const char *const TraceEventNames [COUNT_TRACE_EVENT] = {
+	[TRACE_EVENT_FILE]    = "file",
+	[TRACE_EVENT_GUESS]   = "guess",
+	[TRACE_EVENT_OPEN]    = "open",
+	[TRACE_EVENT_PARSE]   = "parse",
+	[TRACE_EVENT_PROMISE] = "promise",
+	[TRACE_EVENT_UNCORK]  = "uncork",
+	[TRACE_EVENT_WRITE]   = "write",
+	[TRACE_EVENT_SORT]    = "sort",
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static uint64_t readTraceClock (void)
+{
+#ifdef HAVE_CLOCK_GETTIME
+	struct timespec ts;
+
+	if (clock_gettime (CLOCK_MONOTONIC, &ts) == 0)
+		return (uint64_t) ts.tv_sec * 1000000000u + (uint64_t) ts.tv_nsec;
+#endif
+	return (uint64_t) ((double) clock () * 1e9 / CLOCKS_PER_SEC);
+}
+
+static void deleteWorkerTrace (void *data)
+{
+	workerTrace *w = data;
+
+	eFree (w->events);
+	eFree (w->names);
+	eFree (w->nameBuffer);
+	eFree (w);
+}
+
+extern void startEventTrace (const char *const fileName)
+{
+	if (EventTraceEnabled)
+	{
+		eFree (TraceFileName);
+		TraceFileName = eStrdup (fileName);
+		return;
+	}
+
+	TraceFileName = eStrdup (fileName);
+	Ring = xMalloc (TRACE_EVENT_RING_SIZE, traceEvent);
+	Names = ptrArrayNew (eFree);
+	NameTable = hashTableNew (256, hashCstrhash, hashCstreq, NULL, NULL);
+	WorkerTraces = ptrArrayNew (deleteWorkerTrace);
+	BaseTime = readTraceClock ();
+	EventTraceEnabled = true;
+}
+
+static unsigned int internTraceArg (const char *arg)
+{
+	void *index = hashTableGetItem (NameTable, arg);
+
+	if (index == NULL)
+	{
+		char *name = eStrdup (arg);
+
+		index = HT_INT_TO_PTR (ptrArrayAdd (Names, name) + 1);
+		hashTablePutItem (NameTable, name, index);
+	}
+	return (unsigned int) HT_PTR_TO_INT (index);
+}
+
+extern void recordTraceEvent (traceEventType type, bool begin, const char *arg)
+{
+	traceEvent *e = Ring + (RecordedCount++ & (TRACE_EVENT_RING_SIZE - 1));
+
+	e->type = (unsigned char) type;
+	e->begin = begin;
+	e->arg = arg? internTraceArg (arg): 0;
+	e->time = readTraceClock () - BaseTime;
+}
+
+static unsigned int countTraceEventsInRing (void)
+{
+	return (RecordedCount < TRACE_EVENT_RING_SIZE)
+		? (unsigned int) RecordedCount
+		: TRACE_EVENT_RING_SIZE;
+}
+
+static const traceEvent *getTraceEventInRing (unsigned int i)
+{
+	unsigned long long first = RecordedCount - countTraceEventsInRing ();
+
+	return Ring + ((first + i) & (TRACE_EVENT_RING_SIZE - 1));
+}
+
+extern size_t getTraceEventRecordSize (void)
+{
+	size_t size = sizeof (traceEventRecordHeader);
+
+	if (!EventTraceEnabled)
+		return 0;
+
+	size += countTraceEventsInRing () * sizeof (traceEvent);
+	for (unsigned int i = 0; i < ptrArrayCount (Names); i++)
+		size += strlen (ptrArrayItem (Names, i)) + 1;
+	return size;
+}
+
+extern void writeTraceEventRecord (void *buf)
+{
+	traceEventRecordHeader header;
+	char *p = buf;
+
+	header.dropped = (unsigned long) (RecordedCount - countTraceEventsInRing ());
+	header.eventCount = countTraceEventsInRing ();
+	header.nameCount = ptrArrayCount (Names);
+	header.nameBytes = getTraceEventRecordSize () - sizeof (header)
+		- header.eventCount * sizeof (traceEvent);
+
+	memcpy (p, &header, sizeof (header));
+	p += sizeof (header);
+	for (unsigned int i = 0; i < header.eventCount; i++)
+	{
+		memcpy (p, getTraceEventInRing (i), sizeof (traceEvent));
+		p += sizeof (traceEvent);
+	}
+	for (unsigned int i = 0; i < header.nameCount; i++)
+	{
+		const char *name = ptrArrayItem (Names, i);
+		size_t len = strlen (name) + 1;
+
+		memcpy (p, name, len);
+		p += len;
+	}
+}
+
+extern bool mergeTraceEventRecord (int pid, const void *buf, size_t size)
+{
+	const char *p = buf;
+	workerTrace *w;
+	size_t eventBytes;
+	char *name;
+
+	if (!EventTraceEnabled || size < sizeof (traceEventRecordHeader))
+		return false;
+
+	w = xCalloc (1, workerTrace);
+	w->pid = pid;
+	memcpy (&w->header, p, sizeof (w->header));
+	p += sizeof (w->header);
+	eventBytes = (size_t) w->header.eventCount * sizeof (traceEvent);
+	if (sizeof (w->header) + eventBytes + w->header.nameBytes != size)
+	{
+		eFree (w);
+		return false;
+	}
+
+	w->events = xMalloc (w->header.eventCount? w->header.eventCount: 1, traceEvent);
+	memcpy (w->events, p, eventBytes);
+	p += eventBytes;
+
+	w->nameBuffer = xMalloc (w->header.nameBytes + 1, char);
+	memcpy (w->nameBuffer, p, w->header.nameBytes);
+	w->nameBuffer [w->header.nameBytes] = '\0';
+	w->names = xMalloc (w->header.nameCount? w->header.nameCount: 1, char *);
+	name = w->nameBuffer;
+	for (unsigned int i = 0; i < w->header.nameCount; i++)
+	{
+		if (name >= w->nameBuffer + w->header.nameBytes)
+		{
+			deleteWorkerTrace (w);
+			return false;
+		}
+		w->names [i] = name;
+		name += strlen (name) + 1;
+	}
+
+	ptrArrayAdd (WorkerTraces, w);
+	return true;
+}
+
+static void writeJSONString (FILE *fp, const char *s)
+{
+	fputc ('"', fp);
+	for (; *s; s++)
+	{
+		if (*s == '"' || *s == '\\')
+			fprintf (fp, "\\%c", *s);
+		else if ((unsigned char) *s < 0x20)
+			fprintf (fp, "\\u%04x", (unsigned char) *s);
+		else
+			fputc (*s, fp);
+	}
+	fputc ('"', fp);
+}
+
+static void writeProcessName (FILE *fp, int pid, const char *name)
+{
+	fprintf (fp, "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":",
+			 pid, pid);
+	writeJSONString (fp, name);
+	fputs ("}},\n", fp);
+}
+
+/* W is NULL for the events of this process.
+ * The begin events of the first end events may be overwritten in the
+ * ring buffer. Such end events are skipped. */
+static void writeTraceEvents (FILE *fp, int pid, const workerTrace *w)
+{
+	unsigned int count = w? w->header.eventCount: countTraceEventsInRing ();
+	unsigned int depth = 0;
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		const traceEvent *e = w? w->events + i: getTraceEventInRing (i);
+
+		if (e->begin)
+			depth++;
+		else if (depth == 0)
+			continue;
+		else
+			depth--;
+
+		fprintf (fp, "{\"name\":\"%s\",\"cat\":\"ctags\",\"ph\":\"%c\",\"ts\":%.3f,\"pid\":%d,\"tid\":%d",
+				 TraceEventNames [e->type], e->begin? 'B': 'E',
+				 (double) e->time / 1000.0, pid, pid);
+		if (e->arg)
+		{
+			fputs (",\"args\":{\"name\":", fp);
+			writeJSONString (fp, w? w->names [e->arg - 1]: ptrArrayItem (Names, e->arg - 1));
+			fputc ('}', fp);
+		}
+		fputs ("},\n", fp);
+	}
+}
+
+extern void finishEventTrace (void)
+{
+	unsigned long dropped;
+	FILE *fp;
+
+	if (!EventTraceEnabled)
+		return;
+
+	EventTraceEnabled = false;
+	fp = fopen (TraceFileName, "w");
+	if (fp == NULL)
+		error (FATAL | PERROR, "cannot open event trace file: %s", TraceFileName);
+
+	fputs ("{\"traceEvents\":[\n", fp);
+
+	writeProcessName (fp, 0, "ctags");
+	writeTraceEvents (fp, 0, NULL);
+	dropped = (unsigned long) (RecordedCount - countTraceEventsInRing ());
+
+	for (unsigned int i = 0; i < ptrArrayCount (WorkerTraces); i++)
+	{
+		workerTrace *w = ptrArrayItem (WorkerTraces, i);
+		char name [32];
+
+		snprintf (name, sizeof (name), "ctags worker %d", w->pid);
+		writeProcessName (fp, w->pid, name);
+		writeTraceEvents (fp, w->pid, w);
+		dropped += w->header.dropped;
+	}
+
+	/* The trailing element makes the commas after the events valid. */
+	fprintf (fp, "{\"name\":\"dropped_events\",\"ph\":\"M\",\"pid\":0,\"tid\":0,\"args\":{\"count\":%lu}}\n",
+			 dropped);
+	fputs ("],\"displayTimeUnit\":\"ms\"}\n", fp);
+
+	if (fclose (fp) != 0)
+		error (FATAL | PERROR, "cannot write event trace file: %s", TraceFileName);
+
+	ptrArrayDelete (WorkerTraces);
+	WorkerTraces = NULL;
+	hashTableDelete (NameTable);
+	NameTable = NULL;
+	ptrArrayDelete (Names);
+	Names = NULL;
+	eFree (Ring);
+	Ring = NULL;
+	eFree (TraceFileName);
+	TraceFileName = NULL;
+}
+
+extern void clearTraceEvents (void)
+{
+	RecordedCount = 0;
+}
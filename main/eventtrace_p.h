@@ -0,0 +1,92 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Recording the begin and end of the steps of making tags (--_event-trace).
+*/
+#ifndef CTAGS_MAIN_EVENTTRACE_PRIVATE_H
+#define CTAGS_MAIN_EVENTTRACE_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stddef.h>
+#ifdef HAVE_USDT
+#include <sys/sdt.h>
+#endif
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef enum eTraceEventType {
+	TRACE_EVENT_FILE,			/* making tags for an input file */
+	TRACE_EVENT_GUESS,			/* choosing the parser */
+	TRACE_EVENT_OPEN,			/* opening the input file */
+	TRACE_EVENT_PARSE,			/* running a parser */
+	TRACE_EVENT_PROMISE,		/* running the guest parsers */
+	TRACE_EVENT_UNCORK,			/* emitting the corked tags */
+	TRACE_EVENT_WRITE,			/* writing a tag not corked */
+	TRACE_EVENT_SORT,			/* sorting the tag file */
+	COUNT_TRACE_EVENT
+} traceEventType;
+
+/*
+*   MACROS
+*/
+
+/* The static probes of the "ctags" provider for USDT and DTrace
+ * (configure --enable-usdt). A probe not attached is a nop; the
+ * arguments are still evaluated, so they must be cheap. */
+#ifdef HAVE_USDT
+#define usdtProbe0(NAME) DTRACE_PROBE (ctags, NAME)
+#define usdtProbe1(NAME,A) DTRACE_PROBE1 (ctags, NAME, A)
+#define usdtProbe2(NAME,A,B) DTRACE_PROBE2 (ctags, NAME, A, B)
+#define usdtProbe3(NAME,A,B,C) DTRACE_PROBE3 (ctags, NAME, A, B, C)
+#else
+#define usdtProbe0(NAME) do { } while (0)
+#define usdtProbe1(NAME,A) do { } while (0)
+#define usdtProbe2(NAME,A,B) do { } while (0)
+#define usdtProbe3(NAME,A,B,C) do { } while (0)
+#endif
+
+/* ARG is a string like a file name or a language name shown with the
+ * event. It is copied. Each event also fires the begin and end probes
+ * with the name of the event type. */
+#define beginTraceEvent(TYPE,ARG) \
+	do { \
+		usdtProbe2 (begin, TraceEventNames [(TYPE)], (ARG)); \
+		if (EventTraceEnabled) recordTraceEvent ((TYPE), true, (ARG)); \
+	} while (0)
+#define endTraceEvent(TYPE) \
+	do { \
+		usdtProbe1 (end, TraceEventNames [(TYPE)]); \
+		if (EventTraceEnabled) recordTraceEvent ((TYPE), false, NULL); \
+	} while (0)
+
+/*
+*   DATA DEFINITIONS
+*/
+extern bool EventTraceEnabled;
+extern const char *const TraceEventNames [COUNT_TRACE_EVENT];
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern void startEventTrace (const char *const fileName);
+extern void recordTraceEvent (traceEventType type, bool begin, const char *arg);
+
+/* Write the events to the file passed to startEventTrace(). */
+extern void finishEventTrace (void);
+
+/* For passing the events recorded in a --jobs worker to the parent
+ * process. */
+extern size_t getTraceEventRecordSize (void);
+extern void writeTraceEventRecord (void *buf);
+extern bool mergeTraceEventRecord (int pid, const void *buf, size_t size);
+extern void clearTraceEvents (void);
+
+#endif	/* CTAGS_MAIN_EVENTTRACE_PRIVATE_H */
@@ -69,6 +69,9 @@ static const char *renderFieldScopeKindName(const tagEntryInfo *const tag, const
 static const char *renderFieldEnd (const tagEntryInfo *const tag, const char *value, vString* b);
 static const char *renderFieldEpoch (const tagEntryInfo *const tag, const char *value, vString* b);
 static const char *renderFieldNth (const tagEntryInfo *const tag, const char *value, vString* b);
+static const char *renderFieldLineHash (const tagEntryInfo *const tag, const char *value, vString* b);
+static const char *renderFieldRefCount (const tagEntryInfo *const tag, const char *value, vString* b);
+static const char *renderFieldRefLines (const tagEntryInfo *const tag, const char *value, vString* b);
 
 static bool doesContainAnyCharInName (const tagEntryInfo *const tag, const char *value, const char *chars);
 static bool doesContainAnyCharInInput (const tagEntryInfo *const tag, const char*value, const char *chars);
@@ -86,6 +89,8 @@ static bool     isXpathFieldAvailable     (const tagEntryInfo *const tag);
 static bool     isEndFieldAvailable       (const tagEntryInfo *const tag);
 static bool     isEpochAvailable          (const tagEntryInfo *const tag);
 static bool     isNthAvailable            (const tagEntryInfo *const tag);
+static bool     isLineHashAvailable       (const tagEntryInfo *const tag);
+static bool     isRefAggregateAvailable   (const tagEntryInfo *const tag);
 
 static EsObject* getFieldValueForName (const tagEntryInfo *, const fieldDefinition *);
 static EsObject* setFieldValueForName (tagEntryInfo *, const fieldDefinition *, const EsObject *);
@@ -457,6 +462,39 @@ static fieldDefinition fieldDefinitionsUniversal [] = {
 		.isValueAvailable	= isNthAvailable,
 		.dataType			= FIELDTYPE_INTEGER,
 	},
+	[FIELD_LINE_HASH - FIELDS_UCTAGS_START] = {
+		.letter				= 'H',
+		.name				= "linehash",
+		.description		= "hash of the beginning of the line (for verifying the line number)",
+		.enabled			= false,
+		.render				= renderFieldLineHash,
+		.renderNoEscaping	= NULL,
+		.doesContainAnyChar = NULL,
+		.isValueAvailable	= isLineHashAvailable,
+		.dataType			= FIELDTYPE_STRING,
+	},
+	[FIELD_REF_COUNT - FIELDS_UCTAGS_START] = {
+		.letter				= 'c',
+		.name				= "refcount",
+		.description		= "the number of the references aggregated into the tag",
+		.enabled			= false,
+		.render				= renderFieldRefCount,
+		.renderNoEscaping	= NULL,
+		.doesContainAnyChar = NULL,
+		.isValueAvailable	= isRefAggregateAvailable,
+		.dataType			= FIELDTYPE_INTEGER,
+	},
+	[FIELD_REF_LINES - FIELDS_UCTAGS_START] = {
+		.letter				= 'L',
+		.name				= "reflines",
+		.description		= "the lines of the references aggregated into the tag",
+		.enabled			= false,
+		.render				= renderFieldRefLines,
+		.renderNoEscaping	= NULL,
+		.doesContainAnyChar = NULL,
+		.isValueAvailable	= isRefAggregateAvailable,
+		.dataType			= FIELDTYPE_STRING,
+	},
 };
 
 
@@ -464,6 +502,9 @@ static unsigned int       fieldObjectUsed = 0;
 static unsigned int       fieldObjectAllocated = 0;
 static fieldObject* fieldObjects = NULL;
 
+/* Incremented whenever a field is enabled or disabled. */
+static unsigned int EnabledFieldsEpoch = 1;
+
 extern void initFieldObjects (void)
 {
 	unsigned int i;
@@ -689,13 +730,27 @@ static bool doesContainAnyCharInName (const tagEntryInfo *const tag, const char
 	return strpbrk (tag->name, chars)? true: false;
 }
 
+/* The tags written in a row have the same input file name mostly.
+ * The name escaped for the last tag is kept for the next one. The name
+ * is compared, not the pointer: the name of a corked tag is in the
+ * arena freed after writing the tags of the input file. */
 static const char *renderFieldInput (const tagEntryInfo *const tag, const char *value CTAGS_ATTR_UNUSED, vString* b)
 {
+	static vString *lastInput;
+	static vString *lastRendered;
 	const char *f = tag->inputFileName;
 
 	if (Option.lineDirectives && tag->sourceFileName)
 		f = tag->sourceFileName;
-	return renderEscapedString (f, tag, b);
+
+	if (lastInput && strcmp (vStringValue (lastInput), f) == 0)
+		return vStringValue (lastRendered);
+
+	lastInput = vStringNewOrClearWithAutoRelease (lastInput);
+	lastRendered = vStringNewOrClearWithAutoRelease (lastRendered);
+	vStringCatS (lastInput, f);
+	renderEscapedString (f, tag, lastRendered);
+	return renderAsIs (b, vStringValue (lastRendered));
 }
 
 static const char *renderFieldInputNoEscape (const tagEntryInfo *const tag, const char *value CTAGS_ATTR_UNUSED, vString* b)
@@ -1164,6 +1219,16 @@ static const char *renderFieldNth (const tagEntryInfo *const tag,
 #undef buf_len
 }
 
+static const char *renderFieldLineHash (const tagEntryInfo *const tag,
+										const char *value CTAGS_ATTR_UNUSED,
+										vString* b)
+{
+	static char buf[9];
+
+	snprintf (buf, sizeof (buf), "%08lx", makeLineHash (tag));
+	return renderAsIs (b, buf);
+}
+
 static bool     isTyperefFieldAvailable  (const tagEntryInfo *const tag)
 {
 	return (tag->extensionFields.typeRef [0] != NULL
@@ -1221,6 +1286,34 @@ static bool isEpochAvailable (const tagEntryInfo *const tag)
 		: false;
 }
 
+static bool isLineHashAvailable (const tagEntryInfo *const tag)
+{
+	return !tag->isFileEntry;
+}
+
+static const char *renderFieldRefCount (const tagEntryInfo *const tag,
+										const char *value CTAGS_ATTR_UNUSED,
+										vString* b)
+{
+	static char buf[21];
+
+	snprintf (buf, sizeof (buf), "%lu", getTagReferenceCount (tag));
+	return renderAsIs (b, buf);
+}
+
+static const char *renderFieldRefLines (const tagEntryInfo *const tag,
+										const char *value CTAGS_ATTR_UNUSED,
+										vString* b)
+{
+	catTagReferenceLines (tag, b);
+	return vStringValue (b);
+}
+
+static bool isRefAggregateAvailable (const tagEntryInfo *const tag)
+{
+	return getTagReferenceCount (tag) > 1;
+}
+
 static bool isNthAvailable (const tagEntryInfo *const tag)
 {
 	Assert (tag->langType >= NO_NTH_FIELD);
@@ -1232,11 +1325,24 @@ extern bool isFieldEnabled (fieldType type)
 	return getFieldObject(type)->def->enabled;
 }
 
+extern unsigned int getEnabledFieldsEpoch (void)
+{
+	return EnabledFieldsEpoch;
+}
+
+extern bool isFieldValueNeeded (fieldType type)
+{
+	return isFieldEnabled (type)
+		|| getTagWriterType () == WRITER_CUSTOM
+		|| doesInputLanguageRunScript ();
+}
+
 extern bool enableField (fieldType type, bool state)
 {
 	fieldDefinition *def = getFieldObject(type)->def;
 	bool old = def->enabled;
 	getFieldObject(type)->def->enabled = state;
+	EnabledFieldsEpoch++;
 
 	if (isCommonField (type))
 		verbose ("enable field \"%s\": %s\n",
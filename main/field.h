@@ -65,8 +65,11 @@ typedef enum eFieldType { /* extension field content control */
 	FIELD_END_LINE,
 	FIELD_EPOCH,
 	FIELD_NTH,
+	FIELD_LINE_HASH,
+	FIELD_REF_COUNT,
+	FIELD_REF_LINES,
 
-	FIELD_BUILTIN_LAST = FIELD_NTH,
+	FIELD_BUILTIN_LAST = FIELD_REF_LINES,
 } fieldType ;
 
 #define fieldDataTypeFlags "sib" /* used in --list-fields */
@@ -119,4 +122,10 @@ struct sFieldDefinition {
 
 extern bool isFieldEnabled (fieldType type);
 
+/* Return true if the value of the field TYPE filled in a tag may be used.
+ * Even if the field is disabled, a custom tag writer (see mini-geany.c)
+ * or optscript code can read the value. A parser can skip computing an
+ * expensive value like a signature if this returns false. */
+extern bool isFieldValueNeeded (fieldType type);
+
 #endif	/* CTAGS_MAIN_FIELD_H */
@@ -48,6 +48,9 @@ extern fieldType getFieldTypeForLetter (char letter);
 extern fieldType getFieldTypeForName (const char *name);
 extern fieldType getFieldTypeForNameAndLanguage (const char *fieldName, langType language);
 extern bool enableField (fieldType type, bool state);
+/* Changes whenever a field is enabled or disabled. A value computed
+ * from the enabled fields is valid while this returns the same. */
+extern unsigned int getEnabledFieldsEpoch (void);
 extern bool isCommonField (fieldType type);
 
 /* Return LANG_IGNORE if the field is a common field.*/
@@ -27,7 +27,7 @@ extern const char *flagsEval (const char* flags_original, flagDefinition* defs,
 	char *flags;
 	const char *optscript = NULL;
 
-	if (!flags_original)
+	if (!flags_original || flags_original [0] == '\0')
 		return NULL;
 
 	flags = eStrdup (flags_original);
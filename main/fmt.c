@@ -22,55 +22,92 @@
 #include <errno.h>
 
 typedef union uFmtSpec {
-	char *const_str;
+	struct {
+		char *str;
+		size_t len;
+	} literal;
 	struct {
 		fieldType ftype;
-		int width;
-		char *raw_fmtstr;
+		bool common;
+		bool truncation;
+		bool leftJustified;
+		unsigned int width;
+		/* ftype and the fields following it in the sibling chain.
+		 * Rebuilt when a field is defined after the last tag. */
+		fieldType *siblings;
+		unsigned int siblingCount;
+		unsigned int fieldCount;
 	} field;
 } fmtSpec;
 
+/* A format is compiled to an array of elements, terminated by an
+ * element having no printer. */
 struct sFmtElement {
 	union uFmtSpec spec;
 	int (* printer) (fmtSpec*, MIO* fp, const tagEntryInfo *);
-	struct sFmtElement *next;
 };
 
 static int printLiteral (fmtSpec* fspec, MIO* fp, const tagEntryInfo * tag CTAGS_ATTR_UNUSED)
 {
-	return mio_puts (fp, fspec->const_str);
+	mio_write (fp, fspec->literal.str, 1, fspec->literal.len);
+	return fspec->literal.len;
 }
 
-static bool isParserFieldCompatibleWithFtype (const tagField *pfield, int baseFtype)
+static void updateSiblings (fmtSpec* fspec)
 {
+	fieldType ftype = fspec->field.ftype;
+	unsigned int n = 0;
+
 	do {
-		if (pfield->ftype == baseFtype)
+		fspec->field.siblings = xRealloc (fspec->field.siblings, n + 1, fieldType);
+		fspec->field.siblings [n++] = ftype;
+		ftype = nextSiblingField (ftype);
+	} while (ftype != FIELD_UNKNOWN);
+
+	fspec->field.siblingCount = n;
+	fspec->field.fieldCount = countFields ();
+}
+
+static bool isParserFieldCompatibleWithFtype (const tagField *pfield, fmtSpec* fspec)
+{
+	for (unsigned int i = 0; i < fspec->field.siblingCount; i++)
+		if (pfield->ftype == fspec->field.siblings [i])
 			return true;
-		baseFtype = nextSiblingField (baseFtype);
-	} while (baseFtype != FIELD_UNKNOWN);
 	return false;
 }
 
+static void printPadding (MIO* fp, size_t len)
+{
+	static const char spaces [] = "                                ";
+
+	while (len > sizeof spaces - 1)
+	{
+		mio_write (fp, spaces, 1, sizeof spaces - 1);
+		len -= sizeof spaces - 1;
+	}
+	mio_write (fp, spaces, 1, len);
+}
+
 static int printTagField (fmtSpec* fspec, MIO* fp, const tagEntryInfo * tag)
 {
-	int i;
-	int width = fspec->field.width;
-	int ftype;
+	unsigned int width = fspec->field.width;
+	size_t len, padding = 0;
 	const char* str = NULL;
 
-	ftype = fspec->field.ftype;
-
-	if (isCommonField (ftype))
-		str = renderField (ftype, tag, NO_PARSER_FIELD);
-	else
+	if (fspec->field.common)
+		str = renderField (fspec->field.ftype, tag, NO_PARSER_FIELD);
+	else if (tag->usedParserFields > 0)
 	{
 		unsigned int findex;
 		const tagField *f = NULL;
 
+		if (fspec->field.fieldCount != countFields ())
+			updateSiblings (fspec);
+
 		for (findex = 0; findex < tag->usedParserFields; findex++)
 		{
 			f = getParserFieldForIndex(tag, findex);
-			if (isParserFieldCompatibleWithFtype (f, ftype))
+			if (isParserFieldCompatibleWithFtype (f, fspec))
 				break;
 		}
 
@@ -104,25 +141,45 @@ static int printTagField (fmtSpec* fspec, MIO* fp, const tagEntryInfo * tag)
 	if (str == NULL)
 		str = "";
 
+	len = strlen (str);
 	if (width)
-		i = mio_printf (fp, fspec->field.raw_fmtstr, width, str);
-	else
 	{
-		mio_puts (fp, str);
-		i = strlen (str);
+		/* Same as "%.*s", "%-*s", and "%*s" of printf. */
+		if (fspec->field.truncation)
+		{
+			if (len > width)
+				len = width;
+		}
+		else if (len < width)
+			padding = width - len;
 	}
-	return i;
+
+	if (padding && !fspec->field.leftJustified)
+		printPadding (fp, padding);
+	mio_write (fp, str, 1, len);
+	if (padding && fspec->field.leftJustified)
+		printPadding (fp, padding);
+
+	return len + padding;
+}
+
+static fmtElement *queueElement (fmtElement **code, unsigned int *count)
+{
+	fmtElement *cur;
+
+	*code = xRealloc (*code, *count + 1, fmtElement);
+	cur = *code + (*count)++;
+	memset (cur, 0, sizeof (*cur));
+	return cur;
 }
 
-static fmtElement** queueLiteral (fmtElement **last, char *literal)
+static void queueLiteral (fmtElement **code, unsigned int *count, char *literal)
 {
-	fmtElement *cur = xMalloc (1, fmtElement);
+	fmtElement *cur = queueElement (code, count);
 
-	cur->spec.const_str = literal;
+	cur->spec.literal.str = literal;
+	cur->spec.literal.len = strlen (literal);
 	cur->printer = printLiteral;
-	cur->next = NULL;
-	*last = cur;
-	return &(cur->next);
 }
 
 /* `getLanguageComponentInFieldName' is used as part of the option parameter
@@ -181,8 +238,8 @@ static langType getLanguageComponentInFieldName (const char *fullName,
 	return language;
 }
 
-static fmtElement** queueTagField (fmtElement **last, long width, bool truncation,
-								   char field_letter, const char *field_name)
+static void queueTagField (fmtElement **code, unsigned int *count, long width, bool truncation,
+						   char field_letter, const char *field_name)
 {
 	fieldType ftype;
 	fmtElement *cur;
@@ -217,20 +274,15 @@ static fmtElement** queueTagField (fmtElement **last, long width, bool truncatio
 		error (FATAL, "The field cannot be printed in format output: %c", field_letter);
 	}
 
-	cur = xMalloc (1, fmtElement);
+	cur = queueElement (code, count);
 
-	cur->spec.field.width = width;
 	cur->spec.field.ftype = ftype;
-
-	if (width < 0)
-	{
-		cur->spec.field.width *= -1;
-		cur->spec.field.raw_fmtstr = (truncation? "%-.*s": "%-*s");
-	}
-	else if (width > 0)
-		cur->spec.field.raw_fmtstr = (truncation? "%.*s": "%*s");
-	else
-		cur->spec.field.raw_fmtstr = NULL;
+	cur->spec.field.common = isCommonField (ftype);
+	cur->spec.field.truncation = truncation;
+	cur->spec.field.leftJustified = (width < 0);
+	cur->spec.field.width = (width < 0)? -width: width;
+	if (!cur->spec.field.common)
+		updateSiblings (&cur->spec);
 
 	enableField (ftype, true);
 	if (language == LANG_AUTO)
@@ -242,9 +294,6 @@ static fmtElement** queueTagField (fmtElement **last, long width, bool truncatio
 	}
 
 	cur->printer = printTagField;
-	cur->next = NULL;
-	*last = cur;
-	return &(cur->next);
 }
 
 extern fmtElement *fmtNew (const char*  fmtString)
@@ -252,7 +301,7 @@ extern fmtElement *fmtNew (const char*  fmtString)
 	int i;
 	vString *literal = NULL;
 	fmtElement *code  = NULL;
-	fmtElement **last = &code;
+	unsigned int count = 0;
 	bool found_percent = false;
 	long column_width;
 	const char*  cursor;
@@ -279,7 +328,7 @@ extern fmtElement *fmtNew (const char*  fmtString)
 				{
 					char* l = vStringDeleteUnwrap (literal);
 					literal = NULL;
-					last = queueLiteral (last, l);
+					queueLiteral (&code, &count, l);
 				}
 				if (cursor [i] == '-')
 				{
@@ -331,14 +380,14 @@ extern fmtElement *fmtNew (const char*  fmtString)
 					for (; cursor[i] != '}'; i++)
 						vStringPut (field_name, cursor[i]);
 
-					last = queueTagField (last, column_width, truncation,
-										  NUL_FIELD_LETTER, vStringValue (field_name));
+					queueTagField (&code, &count, column_width, truncation,
+								   NUL_FIELD_LETTER, vStringValue (field_name));
 
 					vStringDelete (field_name);
 				}
 				else
-					last = queueTagField (last, column_width, truncation,
-										  cursor[i], NULL);
+					queueTagField (&code, &count, column_width, truncation,
+								   cursor[i], NULL);
 			}
 
 		}
@@ -359,38 +408,39 @@ extern fmtElement *fmtNew (const char*  fmtString)
 	{
 		char* l = vStringDeleteUnwrap (literal);
 		literal = NULL;
-		last = queueLiteral (last, l);
+		queueLiteral (&code, &count, l);
 	}
+	if (code)
+		queueElement (&code, &count);
 	return code;
 }
 
 extern int fmtPrint   (fmtElement * fmtelts, MIO* fp, const tagEntryInfo *tag)
 {
-	fmtElement *f = fmtelts;
+	fmtElement *f;
 	int i = 0;
-	while (f)
-	{
+
+	if (fmtelts == NULL)
+		return 0;
+
+	for (f = fmtelts; f->printer; f++)
 		i += f->printer (&(f->spec), fp, tag);
-		f = f->next;
-	}
 	return i;
 }
 
 extern void fmtDelete  (fmtElement * fmtelts)
 {
-	fmtElement *f = fmtelts;
-	fmtElement *next;
+	fmtElement *f;
+
+	if (fmtelts == NULL)
+		return;
 
-	while (f)
+	for (f = fmtelts; f->printer; f++)
 	{
-		next = f->next;
 		if (f->printer == printLiteral)
-		{
-			eFree (f->spec.const_str);
-			f->spec.const_str = NULL;
-		}
-		f->next = NULL;
-		eFree (f);
-		f = next;
+			eFree (f->spec.literal.str);
+		else if (f->spec.field.siblings)
+			eFree (f->spec.field.siblings);
 	}
+	eFree (fmtelts);
 }
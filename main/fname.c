@@ -22,12 +22,21 @@ struct comp {
 };
 
 
+/* The value stored for an input file name in the cache table */
+struct canonFname {
+	const char *input;			/* the key in the cache table */
+	const char *canon;			/* interned in canon_table */
+};
+
 struct canonFnameCacheTable {
 	hashTable *table;
+	/* Each canonicalized name is stored once here, so the same name is
+	 * returned as the same pointer for the different input names. */
+	hashTable *canon_table;
 	const char *cwd;
 	size_t cwd_len;
-	char *input_last;
-	char *return_last;
+	const char *input_last;
+	const char *return_last;
 	bool absoluteOnly;
 };
 
@@ -36,6 +45,8 @@ extern struct canonFnameCacheTable *canonFnameCacheTableNew (const char *cwd, bo
 	struct canonFnameCacheTable *r = xMalloc (1, struct canonFnameCacheTable);
 	r->table = hashTableNew (7, hashCstrhash, hashCstreq,
 				 eFree, eFree);
+	r->canon_table = hashTableNew (7, hashCstrhash, hashCstreq,
+				 eFree, NULL);
 	r->input_last = NULL;
 	r->return_last = NULL;
 
@@ -53,6 +64,7 @@ extern void canonFnameCacheTableDelete (struct canonFnameCacheTable *cache_table
 {
 	eFree ((void *)cache_table->cwd);
 	hashTableDelete (cache_table->table);
+	hashTableDelete (cache_table->canon_table);
 	eFree (cache_table);
 }
 
@@ -251,22 +263,32 @@ static char *canonicalizePathNew(const char *dir, size_t dir_len, const char *re
 extern const char *canonicalizeFileName (struct canonFnameCacheTable *cache_table,
 										 const char *input)
 {
-	if (cache_table->input_last)
-	{
-		if (strcmp (input, cache_table->input_last) == 0)
-			return cache_table->return_last;
-		cache_table->input_last = NULL;
-	}
+	if (cache_table->input_last
+		&& strcmp (input, cache_table->input_last) == 0)
+		return cache_table->return_last;
 
-	char *r = hashTableGetItem (cache_table->table, input);
-	if (r)
-		return r;
+	struct canonFname *c = hashTableGetItem (cache_table->table, input);
+	if (c == NULL)
+	{
+		char *r = canonicalizePathNew (cache_table->cwd, cache_table->cwd_len,
+									   input, cache_table->absoluteOnly);
+		char *canon = hashTableGetItem (cache_table->canon_table, r);
+		if (canon)
+			eFree (r);
+		else
+		{
+			canon = r;
+			hashTablePutItem (cache_table->canon_table, canon, canon);
+		}
 
-	r = canonicalizePathNew (cache_table->cwd, cache_table->cwd_len, input,
-							 cache_table->absoluteOnly);
+		char *key = eStrdup (input);
+		c = xMalloc (1, struct canonFname);
+		c->input = key;
+		c->canon = canon;
+		hashTablePutItem (cache_table->table, key, c);
+	}
 
-	cache_table->input_last = eStrdup (input);
-	cache_table->return_last = r;
-	hashTablePutItem (cache_table->table, cache_table->input_last, cache_table->return_last);
-	return cache_table->return_last;
+	cache_table->input_last = c->input;
+	cache_table->return_last = c->canon;
+	return c->canon;
 }
@@ -32,6 +32,9 @@ extern void canonFnameCacheTableDelete (struct canonFnameCacheTable *cache_table
  * If the resolved file name is the same as CWD canonFnameCacheTableNew(),
  * this function returns just ".".
  *
+ * The same cstring is returned for the INPUTs resolved to the same file
+ * name, so the results can be compared by pointer.
+ *
  * Don't free the cstring returned from this function directly.
  * This function stores the cstring to the CACHE_TABLE for processing the
  * same INPUT more than twice. canonFnameCacheTableDelete() destroys all C
@@ -46,6 +46,17 @@
 # endif
 #endif
 
+/*  Storage class for the state bound to the input file being parsed.
+ *  With it, parsers for different input files can run in different
+ *  threads of a process. */
+#if !defined(CTAGS_THREAD_LOCAL)
+# if defined(_MSC_VER)
+#  define CTAGS_THREAD_LOCAL __declspec(thread)
+# else
+#  define CTAGS_THREAD_LOCAL
+# endif
+#endif
+
 /*
 *   DATA DECLARATIONS
 */
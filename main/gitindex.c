@@ -0,0 +1,273 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for reading the names of the tracked
+*   files from the index file of a git worktree (--git-index).
+*
+*   The index file is "DIRC", a version number (2, 3, or 4), and the
+*   number of entries, followed by the entries sorted by path, the
+*   extensions, and a checksum. All numbers are big-endian. An entry has
+*   the stat data of the file, the object name, 16 bits of flags, 16 more
+*   bits of flags from version 3 if the extended flag is set, and the path.
+*   Up to version 3, the path is NUL-terminated and the entry is padded to
+*   a multiple of 8 bytes. In version 4, the path is compressed as the
+*   number of bytes to remove from the previous path and a NUL-terminated
+*   suffix, with no padding.
+*
+*   See gitformat-index(5).
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "gitindex_p.h"
+#include "mio.h"
+#include "options.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "strlist.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define INDEX_HEADER_SIZE 12
+#define INDEX_HASH_SIZE 20			/* SHA-1 */
+#define INDEX_ENTRY_FIXED_SIZE (40 + INDEX_HASH_SIZE + 2)
+
+#define INDEX_FLAG_EXTENDED 0x4000
+#define INDEX_FLAG_STAGE_MASK 0x3000
+#define INDEX_EXTENDED_FLAG_SKIP_WORKTREE 0x4000
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static unsigned int getBE16 (const unsigned char *p)
+{
+	return ((unsigned int) p [0] << 8) | p [1];
+}
+
+static unsigned long getBE32 (const unsigned char *p)
+{
+	return ((unsigned long) p [0] << 24) | ((unsigned long) p [1] << 16)
+		| ((unsigned long) p [2] << 8) | p [3];
+}
+
+/* Return the name of the index file of WORKTREE. .git can be a file
+ * having the path to the git directory in a linked worktree or a
+ * submodule. */
+static char *getGitIndexFileName (const char *const worktree)
+{
+	char *gitPath = combinePathAndFile (worktree, ".git");
+	fileStatus *status = eStat (gitPath);
+	char *indexFile = NULL;
+
+	if (status->isDirectory)
+		indexFile = combinePathAndFile (gitPath, "index");
+	else if (status->isNormalFile)
+	{
+		stringList *lines = stringListNewFromFile (gitPath);
+		const char *prefix = "gitdir: ";
+		const char *line;
+
+		if (lines && stringListCount (lines) > 0
+			&& strncmp ((line = vStringValue (stringListItem (lines, 0))),
+						prefix, strlen (prefix)) == 0)
+		{
+			const char *gitDir = line + strlen (prefix);
+
+			if (isAbsolutePath (gitDir))
+				indexFile = combinePathAndFile (gitDir, "index");
+			else
+			{
+				char *dir = combinePathAndFile (worktree, gitDir);
+				indexFile = combinePathAndFile (dir, "index");
+				eFree (dir);
+			}
+		}
+		if (lines)
+			stringListDelete (lines);
+	}
+	eStatFree (status);
+	eFree (gitPath);
+	return indexFile;
+}
+
+static unsigned char *readGitIndexFile (const char *const indexFile, size_t *size)
+{
+	fileStatus *status = eStat (indexFile);
+	unsigned char *buffer = NULL;
+	MIO *mio;
+
+	*size = (size_t) status->size;
+	if (status->isNormalFile && *size > 0
+		&& (mio = mio_new_file (indexFile, "rb")) != NULL)
+	{
+		buffer = eMalloc (*size);
+		if (mio_read (mio, buffer, 1, *size) != *size)
+		{
+			eFree (buffer);
+			buffer = NULL;
+		}
+		mio_unref (mio);
+	}
+	eStatFree (status);
+	return buffer;
+}
+
+/* Walk the entries in BUFFER. If FUNC is NULL, only check that all the
+ * entries are in BUFFER and the index is not split. */
+static bool walkGitIndex (const unsigned char *const buffer, size_t size,
+						  const char *const worktree,
+						  gitIndexEntryFunc func, void *data)
+{
+	const unsigned char *end;
+	const unsigned char *p = buffer + INDEX_HEADER_SIZE;
+	unsigned long version, count;
+	vString *path = vStringNew ();
+	vString *reported = vStringNew ();
+	bool result = false;
+
+	if (size < INDEX_HEADER_SIZE + INDEX_HASH_SIZE
+		|| memcmp (buffer, "DIRC", 4) != 0)
+		goto out;
+	end = buffer + size - INDEX_HASH_SIZE;
+	version = getBE32 (buffer + 4);
+	if (version < 2 || version > 4)
+		goto out;
+	count = getBE32 (buffer + 8);
+
+	for (unsigned long i = 0; i < count; i++)
+	{
+		const unsigned char *entry = p;
+		const unsigned char *nul;
+		unsigned int mode, flags, extendedFlags = 0;
+
+		if (end - p < INDEX_ENTRY_FIXED_SIZE)
+			goto out;
+		mode = (unsigned int) getBE32 (p + 24);
+		flags = getBE16 (p + 40 + INDEX_HASH_SIZE);
+		p += INDEX_ENTRY_FIXED_SIZE;
+
+		if (flags & INDEX_FLAG_EXTENDED)
+		{
+			if (version < 3 || end - p < 2)
+				goto out;
+			extendedFlags = getBE16 (p);
+			p += 2;
+		}
+
+		if (version == 4)
+		{
+			size_t strip = 0;
+			unsigned char c;
+
+			do
+			{
+				if (p == end)
+					goto out;
+				c = *p++;
+				strip = (strip << 7) | (c & 0x7f);
+				if (c & 0x80)
+					strip++;
+			} while (c & 0x80);
+
+			if (strip > vStringLength (path))
+				goto out;
+			vStringTruncate (path, vStringLength (path) - strip);
+		}
+		else
+			vStringClear (path);
+
+		nul = memchr (p, '\0', end - p);
+		if (nul == NULL)
+			goto out;
+		vStringNCatSUnsafe (path, (const char *) p, nul - p);
+		p = nul + 1;
+
+		if (version < 4)
+		{
+			/* 1 to 8 NULs pad the entry to a multiple of 8 bytes. */
+			size_t length = ((nul - entry) + 8) & ~(size_t) 7;
+			if ((size_t) (end - entry) < length)
+				goto out;
+			p = entry + length;
+		}
+
+		if (func == NULL
+			|| (extendedFlags & INDEX_EXTENDED_FLAG_SKIP_WORKTREE))
+			continue;
+
+		if ((flags & INDEX_FLAG_STAGE_MASK)
+			&& strcmp (vStringValue (path), vStringValue (reported)) == 0)
+			continue;
+		vStringCopy (reported, path);
+
+		switch (mode >> 12)
+		{
+		case GIT_INDEX_REGULAR:
+		case GIT_INDEX_SYMLINK:
+		case GIT_INDEX_GITLINK:
+			func (vStringValue (path), mode >> 12, data);
+			break;
+		default:
+			/* e.g. a directory out of the cone in a sparse index */
+			break;
+		}
+	}
+
+	/* The entries of a split index are in the shared index file. */
+	while (func == NULL && end - p >= 8)
+	{
+		unsigned long extensionSize = getBE32 (p + 4);
+
+		if (memcmp (p, "link", 4) == 0)
+		{
+			verbose ("split git index is not supported\n");
+			goto out;
+		}
+		if ((unsigned long) (end - p - 8) < extensionSize)
+			break;
+		p += 8 + extensionSize;
+	}
+	result = true;
+
+ out:
+	if (func == NULL && !result)
+		verbose ("cannot use the git index of \"%s\"\n", worktree);
+	vStringDelete (reported);
+	vStringDelete (path);
+	return result;
+}
+
+extern bool foreachGitIndexEntry (const char *const worktree,
+								  gitIndexEntryFunc func, void *data)
+{
+	char *indexFile = getGitIndexFileName (worktree);
+	unsigned char *buffer;
+	size_t size;
+	bool result = false;
+
+	if (indexFile == NULL)
+		return false;
+
+	verbose ("reading git index \"%s\"\n", indexFile);
+	buffer = readGitIndexFile (indexFile, &size);
+	if (buffer)
+	{
+		result = walkGitIndex (buffer, size, worktree, NULL, NULL);
+		if (result)
+			walkGitIndex (buffer, size, worktree, func, data);
+		eFree (buffer);
+	}
+	eFree (indexFile);
+	return result;
+}
@@ -0,0 +1,43 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to reading the index file of a git worktree.
+*/
+#ifndef CTAGS_MAIN_GITINDEX_PRIVATE_H
+#define CTAGS_MAIN_GITINDEX_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+/*
+*   DATA DECLARATIONS
+*/
+
+/* The file type bits of the mode of an index entry */
+enum gitIndexEntryType {
+	GIT_INDEX_REGULAR = 010,
+	GIT_INDEX_SYMLINK = 012,
+	GIT_INDEX_GITLINK = 016,	/* a submodule */
+};
+
+/* PATH is relative to the worktree, and separated with '/'. */
+typedef void (* gitIndexEntryFunc) (const char *const path,
+									enum gitIndexEntryType type, void *data);
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Call FUNC for each file tracked in the worktree WORKTREE in the order
+ * of the index. The entries of a conflicted file are reported once, and
+ * the entries out of a sparse checkout are not reported.
+ * Return false without calling FUNC if the index cannot be read. */
+extern bool foreachGitIndexEntry (const char *const worktree,
+								  gitIndexEntryFunc func, void *data);
+
+#endif	/* CTAGS_MAIN_GITINDEX_PRIVATE_H */
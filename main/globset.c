@@ -0,0 +1,180 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for matching a file name with a set of
+*   patterns at once.
+*
+*   Trying the patterns of a stringList one by one with fnmatch costs a
+*   lot when the list is long, e.g. hundreds of --exclude patterns. A
+*   globSet sorts the patterns by form in advance:
+*
+*   - NAME: patterns without wildcards, looked up in a hash table,
+*   - *.EXT: looked up in a hash table with the part after the last dot,
+*   - *SUFFIX and PREFIX*: compared with the tail or head of the name,
+*   - anything else: matched with fnmatch as before.
+*
+*   The result is the same as stringListFileMatched with the same list.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "globset_p.h"
+#include "htable.h"
+#include "ptrarray.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "vstring.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+struct sGlobSet {
+	hashTable *names;
+	hashTable *extensions;
+	ptrArray *suffixes;			/* vString, without the leading '*' */
+	ptrArray *prefixes;			/* vString, without the trailing '*' */
+	ptrArray *globs;			/* the items of the original list */
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static bool hasWildcard (const char *s, size_t length)
+{
+	for (size_t i = 0; i < length; i++)
+	{
+		if (strchr ("*?[\\", s[i]))
+			return true;
+	}
+	return false;
+}
+
+static void addKey (hashTable *table, const char *key, size_t length)
+{
+	char *k = eStrndup (key, length);
+
+	if (hashTableHasItem (table, k))
+		eFree (k);
+	else
+		hashTablePutItem (table, k, table);	/* any non-NULL value */
+}
+
+extern globSet *globSetNew (const stringList *const patterns)
+{
+	globSet *set = xMalloc (1, globSet);
+#ifdef CASE_INSENSITIVE_FILENAMES
+	hashTableHashFunc hash = hashCstrcasehash;
+	hashTableEqualFunc eq = hashCstrcaseeq;
+#else
+	hashTableHashFunc hash = hashCstrhash;
+	hashTableEqualFunc eq = hashCstreq;
+#endif
+
+	set->names = hashTableNew (64, hash, eq, eFree, NULL);
+	set->extensions = hashTableNew (64, hash, eq, eFree, NULL);
+	set->suffixes = ptrArrayNew ((ptrArrayDeleteFunc) vStringDelete);
+	set->prefixes = ptrArrayNew ((ptrArrayDeleteFunc) vStringDelete);
+	set->globs = ptrArrayNew (NULL);
+
+	for (unsigned int i = 0; patterns && i < stringListCount (patterns); i++)
+	{
+		vString *item = stringListItem (patterns, i);
+		const char *p = vStringValue (item);
+		size_t length = vStringLength (item);
+
+		if (!hasWildcard (p, length))
+			addKey (set->names, p, length);
+		else if (p[0] == '*' && !hasWildcard (p + 1, length - 1))
+		{
+			const char *dot = strrchr (p + 1, '.');
+			if (dot == p + 1)
+				addKey (set->extensions, p + 2, length - 2);
+			else
+				ptrArrayAdd (set->suffixes, vStringNewNInit (p + 1, length - 1));
+		}
+		else if (length > 1 && p[length - 1] == '*'
+				 && !hasWildcard (p, length - 1))
+			ptrArrayAdd (set->prefixes, vStringNewNInit (p, length - 1));
+		else
+			ptrArrayAdd (set->globs, item);
+	}
+
+	return set;
+}
+
+extern void globSetDelete (globSet *set)
+{
+	hashTableDelete (set->names);
+	hashTableDelete (set->extensions);
+	ptrArrayDelete (set->suffixes);
+	ptrArrayDelete (set->prefixes);
+	ptrArrayDelete (set->globs);
+	eFree (set);
+}
+
+static bool matchedAt (const char *const s, const vString *const v)
+{
+#ifdef CASE_INSENSITIVE_FILENAMES
+	return strncasecmp (s, vStringValue (v), vStringLength (v)) == 0;
+#else
+	return strncmp (s, vStringValue (v), vStringLength (v)) == 0;
+#endif
+}
+
+static bool globSetMatchedNormalized (const globSet *const set, const char *const fileName)
+{
+	size_t length = strlen (fileName);
+	const char *dot;
+
+	if (hashTableHasItem (set->names, fileName))
+		return true;
+
+	dot = strrchr (fileName, '.');
+	if (dot && hashTableHasItem (set->extensions, dot + 1))
+		return true;
+
+	for (unsigned int i = 0; i < ptrArrayCount (set->suffixes); i++)
+	{
+		const vString *suffix = ptrArrayItem (set->suffixes, i);
+		if (vStringLength (suffix) <= length
+			&& matchedAt (fileName + length - vStringLength (suffix), suffix))
+			return true;
+	}
+
+	for (unsigned int i = 0; i < ptrArrayCount (set->prefixes); i++)
+	{
+		const vString *prefix = ptrArrayItem (set->prefixes, i);
+		if (vStringLength (prefix) <= length && matchedAt (fileName, prefix))
+			return true;
+	}
+
+	for (unsigned int i = 0; i < ptrArrayCount (set->globs); i++)
+	{
+		if (fileNameMatched (ptrArrayItem (set->globs, i), fileName))
+			return true;
+	}
+
+	return false;
+}
+
+extern bool globSetMatched (const globSet *const set, const char *const fileName)
+{
+#if defined (_WIN32)
+	vString *tmp = vStringNewInit (fileName);
+	vStringTranslate (tmp, PATH_SEPARATOR, OUTPUT_PATH_SEPARATOR);
+	bool r = globSetMatchedNormalized (set, vStringValue (tmp));
+	vStringDelete (tmp);
+	return r;
+#else
+	return globSetMatchedNormalized (set, fileName);
+#endif
+}
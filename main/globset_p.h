@@ -0,0 +1,36 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to a set of file name patterns matched at once.
+*/
+#ifndef CTAGS_MAIN_GLOBSET_PRIVATE_H
+#define CTAGS_MAIN_GLOBSET_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "strlist.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sGlobSet globSet;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Compile PATTERNS. The set refers to the items of PATTERNS; the list must
+ * not be changed while the set is used. */
+extern globSet *globSetNew (const stringList *const patterns);
+extern void globSetDelete (globSet *set);
+
+/* Same as stringListFileMatched (PATTERNS, FILENAME) */
+extern bool globSetMatched (const globSet *const set, const char *const fileName);
+
+#endif	/* CTAGS_MAIN_GLOBSET_PRIVATE_H */
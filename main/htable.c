@@ -40,8 +40,21 @@ struct sHashEntry {
 	hentry *next;
 };
 
+/* A slot of a flat table. */
+typedef struct sHashSlot hslot;
+struct sHashSlot {
+	void *key;
+	void *value;
+	unsigned int hash;
+	bool used;
+};
+
 struct sHashTable {
 	hentry** table;
+	/* Not NULL if the table is a flat one. The size of a flat table
+	 * is a power of 2. */
+	hslot *slots;
+	unsigned int bits;
 	unsigned int size;
 	unsigned int count;
 	hashTableHashFunc hashfn;
@@ -182,6 +195,145 @@ static bool  entry_foreach (hentry *entry, hashTableForeachFunc proc, void *user
 	return true;
 }
 
+/* Flat tables: open addressing with linear probing.
+ *
+ * A slot is found from the hash by Fibonacci hashing, so hashPtrhash
+ * giving aligned addresses still spreads over the table. The slots
+ * between the home slot of an item and the item are never empty; an
+ * item is deleted by moving the following items back (no tombstone).
+ *
+ * The items for a key are kept newest first along the probe sequence
+ * as the chain of a chained table is: hashTablePutItem() puts the new
+ * item in the place of the first older item for the key, and pushes
+ * the older one forward. */
+#define FLAT_MAX_LOAD(SIZE) ((SIZE) / 4 * 3)
+
+static unsigned int flat_home (hashTable *htable, unsigned int hash)
+{
+	return (unsigned int)(hash * 2654435769U) >> (32 - htable->bits);
+}
+
+static hslot *flat_find (hashTable *htable, const void *key, unsigned int hash)
+{
+	unsigned int mask = htable->size - 1;
+	unsigned int i = flat_home (htable, hash);
+
+	while (htable->slots[i].used)
+	{
+		hslot *slot = htable->slots + i;
+		if (slot->hash == hash && htable->equalfn (key, slot->key))
+			return slot;
+		i = (i + 1) & mask;
+	}
+	return NULL;
+}
+
+static void flat_insert (hashTable *htable, hslot item, bool ordering)
+{
+	unsigned int mask = htable->size - 1;
+	unsigned int i = flat_home (htable, item.hash);
+
+	while (htable->slots[i].used)
+	{
+		hslot *slot = htable->slots + i;
+		if (ordering && slot->hash == item.hash
+			&& htable->equalfn (item.key, slot->key))
+		{
+			hslot tmp = *slot;
+			*slot = item;
+			item = tmp;
+		}
+		i = (i + 1) & mask;
+	}
+	htable->slots[i] = item;
+}
+
+static void flat_grow (hashTable *htable)
+{
+	hslot *old_slots = htable->slots;
+	unsigned int old_size = htable->size;
+	unsigned int start;
+
+	htable->bits++;
+	htable->size = old_size * 2;
+	htable->slots = xCalloc (htable->size, hslot);
+
+	/* Starting from an empty slot, each probe sequence is visited in
+	 * its order; the order of the items for a key is kept. */
+	for (start = 0; old_slots[start].used; start++)
+		;
+	for (unsigned int n = 1; n <= old_size; n++)
+	{
+		hslot *slot = old_slots + ((start + n) & (old_size - 1));
+		if (slot->used)
+			flat_insert (htable, *slot, false);
+	}
+	eFree (old_slots);
+}
+
+static void flat_put (hashTable *htable, void *key, void *value, unsigned int hash)
+{
+	hslot item = {
+		.key = key,
+		.value = value,
+		.hash = hash,
+		.used = true,
+	};
+
+	if (htable->count + 1 > FLAT_MAX_LOAD (htable->size))
+		flat_grow (htable);
+	flat_insert (htable, item, true);
+	htable->count++;
+}
+
+static void flat_remove (hashTable *htable, hslot *slot)
+{
+	unsigned int mask = htable->size - 1;
+	unsigned int i = slot - htable->slots;
+	unsigned int j = i;
+
+	for (j = (j + 1) & mask; htable->slots[j].used; j = (j + 1) & mask)
+	{
+		unsigned int k = flat_home (htable, htable->slots[j].hash);
+
+		/* Can the item at j move to i? Not if its home is in (i, j]. */
+		if (i <= j? (i < k && k <= j): (i < k || k <= j))
+			continue;
+		htable->slots[i] = htable->slots[j];
+		i = j;
+	}
+	htable->slots[i].used = false;
+	htable->count--;
+}
+
+static void flat_clear (hashTable *htable)
+{
+	for (unsigned int i = 0; i < htable->size; i++)
+	{
+		hslot *slot = htable->slots + i;
+
+		if (!slot->used)
+			continue;
+		if (htable->keyfreefn)
+			htable->keyfreefn (slot->key);
+		if (htable->valfreefn)
+			htable->valfreefn (slot->value);
+		slot->used = false;
+	}
+}
+
+static bool flat_update (hashTable *htable, const void *key, void *value, unsigned int hash)
+{
+	hslot *slot = flat_find (htable, key, hash);
+
+	if (!slot)
+		return false;
+	if (htable->valfreefn)
+		htable->valfreefn (slot->value);
+	slot->value = value;
+	return true;
+}
+
 extern hashTable *hashTableNew    (unsigned int size,
 				   hashTableHashFunc hashfn,
 				   hashTableEqualFunc equalfn,
@@ -200,6 +352,37 @@ extern hashTable *hashTableNew    (unsigned int size,
 	htable->size = size;
 	htable->count = 0;
 	htable->table = xCalloc (size, hentry*);
+	htable->slots = NULL;
+	htable->bits = 0;
+
+	htable->hashfn = hashfn;
+	htable->equalfn = equalfn;
+	htable->keyfreefn = keyfreefn;
+	htable->valfreefn = valfreefn;
+	htable->valForNotUnknownKey = NULL;
+	htable->valForNotUnknownKeyfreefn = NULL;
+
+	return htable;
+}
+
+extern hashTable *hashTableNewFlat (unsigned int size,
+				   hashTableHashFunc hashfn,
+				   hashTableEqualFunc equalfn,
+				   hashTableDeleteFunc keyfreefn,
+				   hashTableDeleteFunc valfreefn)
+{
+	hashTable *htable;
+
+	htable = xMalloc (1, hashTable);
+
+	htable->bits = 3;
+	while ((1U << htable->bits) < size && htable->bits < 31)
+		htable->bits++;
+
+	htable->size = 1U << htable->bits;
+	htable->count = 0;
+	htable->table = NULL;
+	htable->slots = xCalloc (htable->size, hslot);
 
 	htable->hashfn = hashfn;
 	htable->equalfn = equalfn;
@@ -231,7 +414,10 @@ extern void       hashTableDelete (hashTable *htable)
 
 	if (htable->valForNotUnknownKeyfreefn)
 		htable->valForNotUnknownKeyfreefn (htable->valForNotUnknownKey);
-	eFree (htable->table);
+	if (htable->slots)
+		eFree (htable->slots);
+	else
+		eFree (htable->table);
 	eFree (htable);
 }
 
@@ -241,14 +427,20 @@ extern void       hashTableClear (hashTable *htable)
 	if (!htable)
 		return;
 
-	for (i = 0; i < htable->size; i++)
+	if (htable->slots)
+		flat_clear (htable);
+	else
 	{
-		hentry *entry;
+		for (i = 0; i < htable->size; i++)
+		{
+			hentry *entry;
 
-		entry = htable->table[i];
-		entry_reclaim (entry, htable->keyfreefn, htable->valfreefn);
-		htable->table[i] = NULL;
+			entry = htable->table[i];
+			entry_reclaim (entry, htable->keyfreefn, htable->valfreefn);
+			htable->table[i] = NULL;
+		}
 	}
+	htable->count = 0;
 }
 
 static void       hashTablePutItem00    (hashTable *htable, void *key, void *value, unsigned int h)
@@ -311,6 +503,12 @@ static void       hashTableGrow        (hashTable *htable)
 
 static void       hashTablePutItem0    (hashTable *htable, void *key, void *value, unsigned int h)
 {
+	if (htable->slots)
+	{
+		flat_put (htable, key, value, h);
+		return;
+	}
+
 	if (((double)htable->count / (double)htable->size) < 0.8)
 	{
 		hashTablePutItem00 (htable, key, value,  h);
@@ -331,6 +529,12 @@ extern void*      hashTableGetItem   (hashTable *htable, const void * key)
 	unsigned int h, i;
 
 	h = htable->hashfn (key);
+	if (htable->slots)
+	{
+		hslot *slot = flat_find (htable, key, h);
+		return slot? slot->value: htable->valForNotUnknownKey;
+	}
+
 	i = h % htable->size;
 	return entry_find(& (htable->table[i]), key, htable->equalfn, htable->valForNotUnknownKey);
 }
@@ -340,6 +544,19 @@ extern bool     hashTableDeleteItem (hashTable *htable, const void *key)
 	unsigned int h;
 	unsigned int i;
 	h = htable->hashfn (key);
+	if (htable->slots)
+	{
+		hslot *slot = flat_find (htable, key, h);
+		if (!slot)
+			return false;
+		if (htable->keyfreefn)
+			htable->keyfreefn (slot->key);
+		if (htable->valfreefn)
+			htable->valfreefn (slot->value);
+		flat_remove (htable, slot);
+		return true;
+	}
+
 	i = h % htable->size;
 
 	bool r = entry_delete(&htable->table[i], key,
@@ -354,6 +571,9 @@ extern bool    hashTableUpdateItem (hashTable *htable, const void *key, void *va
 	unsigned int h, i;
 
 	h = htable->hashfn (key);
+	if (htable->slots)
+		return flat_update (htable, key, value, h);
+
 	i = h % htable->size;
 	bool r = entry_update(htable->table[i], (void *)key, value,
 						  htable->equalfn, NULL, htable->valfreefn);
@@ -365,6 +585,14 @@ extern bool    hashTableUpdateOrPutItem (hashTable *htable, void *key, void *val
 	unsigned int h, i;
 
 	h = htable->hashfn (key);
+	if (htable->slots)
+	{
+		bool r = flat_update (htable, key, value, h);
+		if (!r)
+			flat_put (htable, key, value, h);
+		return r;
+	}
+
 	i = h % htable->size;
 	bool r = entry_update(htable->table[i], key, value,
 						  htable->equalfn, NULL, htable->valfreefn);
@@ -383,6 +611,17 @@ extern bool       hashTableForeachItem (hashTable *htable, hashTableForeachFunc
 {
 	unsigned int i;
 
+	if (htable->slots)
+	{
+		for (i = 0; i < htable->size; i++)
+		{
+			hslot *slot = htable->slots + i;
+			if (slot->used && !proc (slot->key, slot->value, user_data))
+				return false;
+		}
+		return true;
+	}
+
 	for (i = 0; i < htable->size; i++)
 		if (!entry_foreach(htable->table[i], proc, user_data))
 			return false;
@@ -412,6 +651,20 @@ extern bool       hashTableForeachItemOnChain (hashTable *htable, const void *ke
 	};
 
 	h = htable->hashfn (key);
+	if (htable->slots)
+	{
+		for (i = flat_home (htable, h);
+			 htable->slots[i].used;
+			 i = (i + 1) & (htable->size - 1))
+		{
+			hslot *slot = htable->slots + i;
+			if (slot->hash == h
+				&& !track_chain (slot->key, slot->value, &chain_tracker))
+				return false;
+		}
+		return true;
+	}
+
 	i = h % htable->size;
 	if (!entry_foreach(htable->table[i], track_chain, &chain_tracker))
 		return false;
@@ -424,6 +677,27 @@ extern void hashTablePrintStatistics(hashTable *htable)
 		fprintf(stderr, "size: %u, count: %u, average: 0\n",
 				htable->size, htable->count);
 
+	if (htable->slots)
+	{
+		/* The distance of an item from its home slot. */
+		double sum = 0.0;
+		unsigned int longest = 0;
+		for (unsigned int i = 0; i < htable->size; i++)
+		{
+			hslot *slot = htable->slots + i;
+			if (!slot->used)
+				continue;
+			unsigned int d = (i - flat_home (htable, slot->hash)) & (htable->size - 1);
+			sum += (double)d;
+			if (d > longest)
+				longest = d;
+		}
+		fprintf(stderr, "size: %u, count: %u, average probe: %lf, longest probe: %u\n",
+				htable->size, htable->count,
+				htable->count? sum / (double)htable->count: 0.0, longest);
+		return;
+	}
+
 	double sum = 0.0;
 	for (size_t i = 0; i < htable->size; i++)
 	{
@@ -477,40 +751,91 @@ bool hashPtreq (const void *const a, const void *const b)
 }
 
 
-/* http://www.cse.yorku.ca/~oz/hash.html */
-static unsigned long
-djb2(const unsigned char *str)
+/* A string is hashed 8 bytes at a time: each word is mixed into the
+ * state with a multiplication, and the state is finished as
+ * splitmix64 does. The values depend on the byte order; don't store
+ * them. */
+#define HASH_K0 UINT64_C(0x9E3779B97F4A7C15)
+#define HASH_K1 UINT64_C(0xBF58476D1CE4E5B9)
+#define HASH_K2 UINT64_C(0x94D049BB133111EB)
+
+/* Lower the ASCII letters in W. Other bytes are not changed. */
+static uint64_t foldWord (uint64_t w)
+{
+	uint64_t low7 = w & UINT64_C(0x7F7F7F7F7F7F7F7F);
+	/* The top bit of a byte is set if the byte is >= 'A', or > 'Z'. */
+	uint64_t ge_a = low7 + UINT64_C(0x3F3F3F3F3F3F3F3F);
+	uint64_t gt_z = low7 + UINT64_C(0x2525252525252525);
+	uint64_t upper = ge_a & ~gt_z & ~w & UINT64_C(0x8080808080808080);
+
+	return w | (upper >> 2);
+}
+
+static uint64_t readWord (const unsigned char *p)
 {
-	unsigned long hash = 5381;
-	int c;
+	uint64_t w;
+	memcpy (&w, p, sizeof w);
+	return w;
+}
 
-	while ((c = *str++))
-		hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
+static uint64_t readHalfWord (const unsigned char *p)
+{
+	uint32_t w;
+	memcpy (&w, p, sizeof w);
+	return w;
+}
 
-	return hash;
+static uint64_t mixWord (uint64_t h, uint64_t w, bool folding)
+{
+	if (folding)
+		w = foldWord (w);
+	h = (h ^ w) * HASH_K1;
+	return h ^ (h >> 31);
 }
 
-static unsigned long
-casedjb2(const unsigned char *str)
+static unsigned int hashWords (const char *s, size_t len, bool folding)
 {
-	unsigned long hash = 5381;
-	int c;
+	const unsigned char *p = (const unsigned char *)s;
+	uint64_t h = HASH_K0 ^ ((uint64_t)len * HASH_K1);
 
-	while ((c = *str++))
+	/* The last bytes are read as a whole word overlapping the bytes
+	 * already read, so no byte-sized loop nor memcpy of a variable
+	 * length is needed. */
+	if (len > 8)
 	{
-		if (('a' <= c) && (c <= 'z'))
-			c += ('A' - 'a');
-		hash = ((hash << 5) + hash) + c; /* hash * 33 + c */
+		const unsigned char *last = p + len - 8;
+
+		for (; p < last; p += 8)
+			h = mixWord (h, readWord (p), folding);
+		h = mixWord (h, readWord (last), folding);
 	}
+	else if (len >= 4)
+		h = mixWord (h, (readHalfWord (p) << 32) | readHalfWord (p + len - 4),
+					 folding);
+	else if (len > 0)
+		h = mixWord (h, ((uint64_t)p[0] << 16) | ((uint64_t)p[len >> 1] << 8)
+					 | p[len - 1], folding);
+
+	h ^= h >> 30;
+	h *= HASH_K2;
+	h ^= h >> 31;
+	return (unsigned int)(h ^ (h >> 32));
+}
 
-	return hash;
+unsigned int hashCstrnhash (const char *s, size_t len)
+{
+	return hashWords (s, len, false);
 }
 
+unsigned int hashCstrncasehash (const char *s, size_t len)
+{
+	return hashWords (s, len, true);
+}
 
 unsigned int hashCstrhash (const void *const x)
 {
 	const char *const s = x;
-	return (unsigned int)djb2((const unsigned char *)s);
+	return hashWords (s, strlen (s), false);
 }
 
 bool hashCstreq (const void * const a, const void *const b)
@@ -542,7 +867,7 @@ bool hashInteq (const void *const a, const void *const b)
 unsigned int hashCstrcasehash (const void *const x)
 {
 	const char *const s = x;
-	return (unsigned int)casedjb2((const unsigned char *)s);
+	return hashWords (s, strlen (s), true);
 }
 
 bool hashCstrcaseeq (const void *const a, const void *const b)
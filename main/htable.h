@@ -45,6 +45,12 @@ bool hashCstreq (const void * a, const void * b);
 unsigned int hashCstrcasehash (const void * x);
 bool hashCstrcaseeq (const void * a, const void * b);
 
+/* The hash of LEN bytes at S. hashCstrncasehash() ignores the case of
+ * ASCII letters. hashCstrhash (s) == hashCstrnhash (s, strlen (s)).
+ * These don't call tolower(); non-ASCII bytes are hashed as they are. */
+unsigned int hashCstrnhash (const char *s, size_t len);
+unsigned int hashCstrncasehash (const char *s, size_t len);
+
 unsigned int hashInthash (const void * x);
 bool hashInteq (const void * a, const void * b);
 
@@ -54,6 +60,19 @@ extern hashTable* hashTableNew         (unsigned int size,
 					hashTableDeleteFunc keyfreefn,
 					hashTableDeleteFunc valfreefn);
 
+/* Same as hashTableNew() but the items are stored in an array of slots
+ * (open addressing) instead of the chains of entries. A lookup reads
+ * the slots next to each other, and putting an item allocates nothing
+ * unless the table grows.
+ *
+ * The order of items in hashTableForeachItem() differs from that of
+ * hashTableNew(). Don't add or delete items during the iteration. */
+extern hashTable* hashTableNewFlat     (unsigned int size,
+					hashTableHashFunc hashfn,
+					hashTableEqualFunc equalfn,
+					hashTableDeleteFunc keyfreefn,
+					hashTableDeleteFunc valfreefn);
+
 /* By default, hashTableGetItem() returns NULL for a unknown key.
  * It means you cannot store NULL as a value for a key.
  * With hashTableSetValueForUnknownKey(), you can specific
@@ -0,0 +1,352 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for skipping the files and directories
+*   listed in the ignore files (.gitignore and .ignore) while recursing
+*   into directories (--respect-gitignore).
+*
+*   The patterns of the ignore files in a directory are kept on a stack
+*   while recursing into it. As git does, the patterns in a deeper
+*   directory take precedence over the patterns in its parents, and in
+*   one directory, the last matched pattern decides. An ignored directory
+*   is not opened at all, so a pattern cannot re-include a file in it.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "debug.h"
+#include "ignore_p.h"
+#include "options.h"
+#include "ptrarray.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "strlist.h"
+#include "trashbox.h"
+#include "vstring.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sIgnoreRule {
+	vString *pattern;
+	bool negated;				/* !PATTERN */
+	bool dirOnly;				/* PATTERN/ */
+	bool anchored;				/* matched with the path from the directory */
+} ignoreRule;
+
+typedef struct sIgnoreLevel {
+	char *dirName;
+	ptrArray *rules;
+} ignoreLevel;
+
+/*
+*   DATA DEFINITIONS
+*/
+static const char *const IgnoreFileNames [] = {
+	".gitignore",
+	".ignore",
+};
+
+static ptrArray *IgnoreLevels;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deleteIgnoreRule (void *data)
+{
+	ignoreRule *rule = data;
+
+	vStringDelete (rule->pattern);
+	eFree (rule);
+}
+
+static void deleteIgnoreLevel (void *data)
+{
+	ignoreLevel *level = data;
+
+	eFree (level->dirName);
+	ptrArrayDelete (level->rules);
+	eFree (level);
+}
+
+static void addIgnoreRule (ptrArray *rules, vString *line)
+{
+	const char *p;
+	size_t length;
+	ignoreRule *rule;
+
+	/* stringListNewFromFile strips the trailing spaces even when the
+	 * last one is escaped. */
+	if (vStringLast (line) == '\\')
+		vStringPut (line, ' ');
+
+	p = vStringValue (line);
+	if (p [0] == '#')
+		return;
+
+	rule = xMalloc (1, ignoreRule);
+	rule->negated = (p [0] == '!');
+	if (rule->negated)
+		p++;
+
+	length = strlen (p);
+	rule->dirOnly = (length > 1 && p [length - 1] == '/');
+	if (rule->dirOnly)
+		length--;
+
+	rule->anchored = (memchr (p, '/', length) != NULL);
+	if (p [0] == '/')
+	{
+		p++;
+		length--;
+	}
+
+	rule->pattern = vStringNewNInit (p, length);
+	ptrArrayAdd (rules, rule);
+}
+
+static void loadIgnoreFile (ptrArray *rules, const char *const fileName)
+{
+	stringList *lines = stringListNewFromFile (fileName);
+
+	if (lines == NULL)
+		return;
+
+	verbose ("loading ignore file \"%s\"\n", fileName);
+	for (unsigned int i = 0; i < stringListCount (lines); i++)
+		addIgnoreRule (rules, stringListItem (lines, i));
+	stringListDelete (lines);
+}
+
+extern void pushIgnoreFiles (const char *const dirName)
+{
+	ignoreLevel *level;
+
+	if (IgnoreLevels == NULL)
+	{
+		IgnoreLevels = ptrArrayNew (deleteIgnoreLevel);
+		DEFAULT_TRASH_BOX (IgnoreLevels, ptrArrayDelete);
+	}
+
+	level = xMalloc (1, ignoreLevel);
+	level->dirName = eStrdup (dirName);
+	level->rules = ptrArrayNew (deleteIgnoreRule);
+	for (unsigned int i = 0; i < ARRAY_SIZE (IgnoreFileNames); i++)
+	{
+		char *fileName = combinePathAndFile (dirName, IgnoreFileNames [i]);
+		loadIgnoreFile (level->rules, fileName);
+		eFree (fileName);
+	}
+	ptrArrayAdd (IgnoreLevels, level);
+}
+
+extern void popIgnoreFiles (void)
+{
+	Assert (IgnoreLevels && ptrArrayCount (IgnoreLevels) > 0);
+	deleteIgnoreLevel (ptrArrayRemoveLast (IgnoreLevels));
+}
+
+static const char *matchBracket (const char *p, const char c, bool *matched)
+{
+	const char *start;
+	bool negated = false;
+
+	*matched = false;
+	p++;						/* '[' */
+	if (*p == '!' || *p == '^')
+	{
+		negated = true;
+		p++;
+	}
+	start = p;
+	while (*p != '\0' && (*p != ']' || p == start))
+	{
+		char lo = *p, hi;
+
+		if (lo == '\\' && p [1] != '\0')
+			lo = *++p;
+		hi = lo;
+		if (p [1] == '-' && p [2] != '\0' && p [2] != ']')
+		{
+			p += 2;
+			hi = *p;
+			if (hi == '\\' && p [1] != '\0')
+				hi = *++p;
+		}
+		if (lo <= c && c <= hi)
+			*matched = true;
+		p++;
+	}
+	if (*p != ']')
+		return NULL;
+
+	if (negated)
+		*matched = !*matched;
+	return p + 1;
+}
+
+/* Like fnmatch with FNM_PATHNAME, but "**" matches across directories. */
+static bool matchIgnorePattern (const char *p, const char *s)
+{
+	while (*p != '\0')
+	{
+		switch (*p)
+		{
+		case '*':
+			if (p [1] == '*')
+			{
+				p += 2;
+				if (*p == '/')
+				{
+					/* "**" followed by '/' matches zero or more directories. */
+					p++;
+					for (;;)
+					{
+						if (matchIgnorePattern (p, s))
+							return true;
+						s = strchr (s, '/');
+						if (s == NULL)
+							return false;
+						s++;
+					}
+				}
+				for (;; s++)
+				{
+					if (matchIgnorePattern (p, s))
+						return true;
+					if (*s == '\0')
+						return false;
+				}
+			}
+			p++;
+			for (;; s++)
+			{
+				if (matchIgnorePattern (p, s))
+					return true;
+				if (*s == '\0' || *s == '/')
+					return false;
+			}
+		case '?':
+			if (*s == '\0' || *s == '/')
+				return false;
+			p++;
+			s++;
+			break;
+		case '[':
+		{
+			bool matched;
+			const char *next = matchBracket (p, *s, &matched);
+
+			if (next)
+			{
+				if (*s == '\0' || *s == '/' || !matched)
+					return false;
+				p = next;
+				s++;
+				break;
+			}
+			/* An unterminated '[' is taken literally. */
+			if (*s != '[')
+				return false;
+			p++;
+			s++;
+			break;
+		}
+		case '\\':
+			if (p [1] != '\0')
+				p++;
+			/* Fall through */
+		default:
+			if (*p != *s)
+				return false;
+			p++;
+			s++;
+			break;
+		}
+	}
+	return *s == '\0';
+}
+
+/* Return FILENAME relative to DIRNAME, or NULL if FILENAME is not in it. */
+static const char *relativeFileName (const char *const fileName,
+									 const char *const dirName)
+{
+	size_t length = strlen (dirName);
+
+	if (strncmp (fileName, dirName, length) == 0)
+	{
+		const char *rest = fileName + length;
+
+		if (isPathSeparator (*rest))
+			return rest + 1;
+		else if (length > 0 && isPathSeparator (dirName [length - 1]))
+			return rest;
+	}
+	if (strcmp (dirName, ".") == 0)
+		return fileName;
+	return NULL;
+}
+
+extern bool isIgnoredFile (const char *const fileName, bool isDirectory)
+{
+	const char *const base = baseFilename (fileName);
+
+	if (IgnoreLevels == NULL)
+		return false;
+
+	for (unsigned int i = ptrArrayCount (IgnoreLevels); i > 0; i--)
+	{
+		ignoreLevel *level = ptrArrayItem (IgnoreLevels, i - 1);
+		const char *relative = NULL;
+
+		if (ptrArrayCount (level->rules) == 0)
+			continue;
+
+		for (unsigned int j = ptrArrayCount (level->rules); j > 0; j--)
+		{
+			ignoreRule *rule = ptrArrayItem (level->rules, j - 1);
+			bool matched;
+
+			if (rule->dirOnly && !isDirectory)
+				continue;
+
+			if (rule->anchored)
+			{
+				if (relative == NULL)
+				{
+					relative = relativeFileName (fileName, level->dirName);
+					if (relative == NULL)
+						break;
+#ifdef MSDOS_STYLE_PATH
+					/* The patterns are written with '/'. */
+					static vString *normalized;
+					if (normalized == NULL)
+					{
+						normalized = vStringNew ();
+						DEFAULT_TRASH_BOX (normalized, vStringDelete);
+					}
+					vStringCopyS (normalized, relative);
+					vStringTranslate (normalized, '\\', '/');
+					relative = vStringValue (normalized);
+#endif
+				}
+				matched = matchIgnorePattern (vStringValue (rule->pattern), relative);
+			}
+			else
+				matched = matchIgnorePattern (vStringValue (rule->pattern), base);
+
+			if (matched)
+				return !rule->negated;
+		}
+	}
+	return false;
+}
@@ -0,0 +1,30 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to the ignore files (.gitignore and .ignore) found
+*   while recursing into directories.
+*/
+#ifndef CTAGS_MAIN_IGNORE_PRIVATE_H
+#define CTAGS_MAIN_IGNORE_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Load the ignore files in DIRNAME on entering it. The patterns are
+ * used until the matching popIgnoreFiles () on leaving DIRNAME. */
+extern void pushIgnoreFiles (const char *const dirName);
+extern void popIgnoreFiles (void);
+
+/* FILENAME must be a file or a directory in one of the pushed directories. */
+extern bool isIgnoredFile (const char *const fileName, bool isDirectory);
+
+#endif	/* CTAGS_MAIN_IGNORE_PRIVATE_H */
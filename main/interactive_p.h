@@ -17,6 +17,7 @@
 struct interactiveModeArgs
 {
 	bool sandbox;
+	bool server;				/* answer "unchanged" for files tagged before */
 };
 
 void interactiveLoop (cookedArgs *args, void *user);
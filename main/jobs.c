@@ -0,0 +1,937 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for running parsers in worker processes
+*   (--jobs=<N>).
+*
+*   The list of input files is split into N contiguous ranges. Each worker
+*   process parses one range and writes its tags into a temporary file.
+*   After all workers exit, the parent process concatenates the temporary
+*   files in the order of the ranges. As the result, the tag file has the
+*   same contents as one made by parsing the files one by one.
+*
+*   If the spec tells the cost of each job, like the size of an input
+*   file, the jobs are scheduled dynamically instead. The jobs are dealt
+*   to a deque per worker in the order of decreasing costs, so the
+*   largest jobs start first. A worker asks the parent process for a job
+*   each time it finishes one; the parent gives the next job of the
+*   worker's own deque, or the last job of the deque having the most
+*   cost left if the worker's deque is empty (stealing). Each worker
+*   tells where the tags of each job are in its output, and the parent
+*   process appends them in the order of the jobs.
+*
+*   When the tag file is sorted, each worker sorts its tags into one more
+*   temporary file instead, and the parent process merges these shards
+*   with the rest of the tags when closing the tag file. As the sort
+*   order is total and identical lines are dropped in either way, the
+*   tag file doesn't depend on the number of the workers.
+*
+*   The same workers run other kinds of jobs given as a jobSpec: the
+*   guest parsers for the areas of an input file (promises) are run in
+*   them when --jobs=<N> is given but only one file is parsed.
+*
+*   With --read-ahead=<N>, the system is asked to read the next N files
+*   of the list into the page cache while a file is parsed, so that the
+*   parser doesn't wait for reading a file not cached yet.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#ifdef HAVE_FORK
+# include <errno.h>
+# include <limits.h>
+# include <poll.h>
+# include <sys/types.h>
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+#if defined (HAVE_FCNTL_H) && defined (HAVE_UNISTD_H)
+# include <fcntl.h>
+# include <unistd.h>
+#endif
+
+#include "debug.h"
+#include "entry_p.h"
+#include "eventtrace_p.h"
+#include "jobs_p.h"
+#include "options.h"
+#include "parse_p.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "stats_p.h"
+#include "vstring.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+#ifdef HAVE_FORK
+typedef struct sJobReport {
+	long size;					/* valid bytes in the output */
+	unsigned long numTags;
+	long files, lines, bytes;	/* for --totals */
+	unsigned long allocations;
+	partialTotals partial;		/* for --minified and --max-file-* */
+	memoryTotals memory;		/* for --memory-limit */
+	bool resize;
+	unsigned int ptagCount;		/* followed by jobPseudoTag [ptagCount] */
+	size_t statsSize;			/* followed by the record of the statistics
+								   for --totals */
+	size_t traceSize;			/* followed by the record of the events
+								   for --_event-trace */
+	size_t recordSize;			/* followed by the record written by
+								   the jobSpec */
+	double busy;				/* seconds spent in running the jobs */
+} jobReport;
+
+/* Where a worker would have emitted the pseudo tags for a parser */
+typedef struct sJobPseudoTag {
+	langType lang;
+	long offset;				/* in the output of the worker */
+	unsigned int job;			/* running then, or NO_JOB if the jobs
+								   are not scheduled */
+	unsigned int seq;			/* the order of the recording */
+} jobPseudoTag;
+
+/* Sent by a worker scheduled dynamically: where the tags of the job
+ * just finished are in the output of the worker, and a request for the
+ * next job. The parent process replies with the number of the next job,
+ * or NO_JOB. */
+typedef struct sJobDone {
+	unsigned int job;			/* NO_JOB in the first request */
+	long offset, size;
+	unsigned long numTags;
+} jobDone;
+
+#define NO_JOB UINT_MAX
+
+/* The tags of a job scheduled dynamically */
+typedef struct sJobSegment {
+	unsigned int worker;
+	long offset, size;
+	unsigned long numTags;
+} jobSegment;
+
+typedef struct sJobCost {
+	unsigned long cost;
+	unsigned int job;
+} jobCost;
+
+typedef struct sJobDeque {
+	unsigned int *jobs;
+	unsigned int head, tail;	/* the jobs not started are [head, tail) */
+	unsigned long cost;			/* of the jobs not started */
+} jobDeque;
+
+typedef struct sJob {
+	pid_t pid;
+	int fd;						/* read end of the pipe for jobReport */
+	int replyFd;				/* write end of the pipe for the next job,
+								   or -1 if the jobs are not scheduled */
+	MIO *mio;					/* the output of the worker */
+	char *name;					/* the file name of MIO */
+	MIO *sorted;				/* the output sorted in the worker, or NULL */
+	char *sortedName;
+	jobReport report;
+	jobPseudoTag *ptags;
+	void *stats;
+	void *trace;
+	void *record;
+	unsigned int start, end;	/* the range of the jobs */
+	workerStats work;			/* for --totals */
+} parserJob;
+#endif
+
+/*
+*   DATA DEFINITIONS
+*/
+
+/* The number of the workers allowed by --jobs=<N> while the parent
+ * process parses input files by itself. */
+static unsigned int IdleJobs;
+
+#ifdef HAVE_FORK
+/* In a worker scheduled dynamically, the job running when each point
+ * of getParserPseudoTagPoints () was recorded */
+static unsigned int *PseudoTagJobs;
+static unsigned int PseudoTagJobCount;
+#endif
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+/* Start reading FILENAME into the page cache in the background. */
+static void readAheadFile (const char *const fileName)
+{
+#if defined (HAVE_FCNTL_H) && defined (HAVE_UNISTD_H) && defined (POSIX_FADV_WILLNEED)
+	int fd = open (fileName, O_RDONLY);
+
+	if (fd >= 0)
+	{
+		posix_fadvise (fd, 0, 0, POSIX_FADV_WILLNEED);
+		close (fd);
+	}
+#endif
+}
+
+static bool runParsersSerially (const stringList *const fileNames,
+								unsigned int start, unsigned int end)
+{
+	bool resize = false;
+	unsigned int next = start + 1;	/* the next file to read ahead */
+
+	for (unsigned int i = start; i < end; i++)
+	{
+		for (; next < end && next <= i + Option.readAhead; next++)
+			readAheadFile (vStringValue (stringListItem (fileNames, next)));
+		resize |= parseFile (vStringValue (stringListItem (fileNames, i)));
+	}
+
+	return resize;
+}
+
+#ifdef HAVE_FORK
+static bool writeFully (int fd, const void *buf, size_t len)
+{
+	const char *p = buf;
+
+	while (len > 0)
+	{
+		ssize_t n = write (fd, p, len);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= (size_t) n;
+	}
+	return true;
+}
+
+static bool readFully (int fd, void *buf, size_t len)
+{
+	char *p = buf;
+
+	while (len > 0)
+	{
+		ssize_t n = read (fd, p, len);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= (size_t) n;
+	}
+	return true;
+}
+
+/* Run the jobs given by the parent process one by one. */
+static void notePseudoTagJobs (unsigned int job)
+{
+	unsigned int count;
+
+	getParserPseudoTagPoints (&count);
+	if (count == PseudoTagJobCount)
+		return;
+
+	PseudoTagJobs = xRealloc (PseudoTagJobs, count, unsigned int);
+	while (PseudoTagJobCount < count)
+		PseudoTagJobs [PseudoTagJobCount++] = job;
+}
+
+static bool runScheduledJobs (const jobSpec *const spec, MIO *mio,
+							  int fd, int replyFd)
+{
+	jobDone done = { .job = NO_JOB };
+	bool resize = false;
+
+	for (;;)
+	{
+		unsigned int job;
+		unsigned long numTags;
+
+		if (!writeFully (fd, &done, sizeof (done))
+			|| !readFully (replyFd, &job, sizeof (job)))
+			_exit (1);
+		if (job == NO_JOB)
+			break;
+
+		done.job = job;
+		done.offset = mio_tell (mio);
+		numTags = numTagsAdded ();
+		resize |= spec->run (spec->data, job, job + 1);
+		done.size = mio_tell (mio) - done.offset;
+		done.numTags = numTagsAdded () - numTags;
+		notePseudoTagJobs (job);
+	}
+	close (replyFd);
+
+	return resize;
+}
+
+static void runWorker (const jobSpec *const spec,
+					   unsigned int start, unsigned int end,
+					   MIO *mio, MIO *sorted, int fd, int replyFd)
+{
+	statsTime t0, t1;
+	jobReport report;
+	long files0, lines0, bytes0;
+	partialTotals partial0;
+	memoryTotals memory0;
+	unsigned long allocations0 = getAllocationCount ();
+	int status = 0;
+	const parserPseudoTagPoint *points;
+
+	memset (&report, 0, sizeof (report));
+	getTotals (&files0, &lines0, &bytes0);
+	getPartialTotals (&partial0);
+	getMemoryTotals (&memory0);
+	/* The workers share the limit. */
+	if (Option.memoryLimit > 0)
+		setMemoryLimit (Option.memoryLimit / Option.jobs);
+	clearTraceEvents ();
+	clearStatsRecord ();
+	IdleJobs = 0;
+
+	redirectTagFile (mio);
+	deferParserPseudoTags ();
+
+	readStatsTime (&t0);
+	if (replyFd >= 0)
+		report.resize = runScheduledJobs (spec, mio, fd, replyFd);
+	else
+		report.resize = spec->run (spec->data, start, end);
+	readStatsTime (&t1);
+	report.busy = t1.wall - t0.wall;
+
+	if (mio_flush (mio) != 0 || mio_error (mio))
+		status = 1;
+	report.size = mio_tell (mio);
+	if (sorted && status == 0)
+	{
+		sortTagFileShard (sorted);
+		if (mio_flush (sorted) != 0 || mio_error (sorted))
+			status = 1;
+	}
+	report.numTags = numTagsAdded ();
+	getTotals (&report.files, &report.lines, &report.bytes);
+	report.files -= files0;
+	report.lines -= lines0;
+	report.bytes -= bytes0;
+	report.allocations = getAllocationCount () - allocations0;
+	getPartialTotals (&report.partial);
+	report.partial.skipped -= partial0.skipped;
+	report.partial.truncated -= partial0.truncated;
+	report.partial.topLevel -= partial0.topLevel;
+	report.partial.bytes -= partial0.bytes;
+	report.partial.overBudget -= partial0.overBudget;
+	report.partial.duplicates -= partial0.duplicates;
+	getMemoryTotals (&report.memory);
+	report.memory.streamed -= memory0.streamed;
+	report.memory.mlineSkipped -= memory0.mlineSkipped;
+	report.memory.corkFlushed -= memory0.corkFlushed;
+	report.memory.spilled -= memory0.spilled;
+
+	points = getParserPseudoTagPoints (&report.ptagCount);
+	if (isFileStatsEnabled ())
+		report.statsSize = getStatsRecordSize ();
+	report.traceSize = getTraceEventRecordSize ();
+	if (spec->getRecordSize)
+		report.recordSize = spec->getRecordSize (spec->data);
+
+	if (!writeFully (fd, &report, sizeof (report)))
+		status = 1;
+	for (unsigned int i = 0; i < report.ptagCount && status == 0; i++)
+	{
+		jobPseudoTag ptag = {
+			.lang = points [i].language,
+			.offset = points [i].offset,
+			.job = (i < PseudoTagJobCount)? PseudoTagJobs [i]: NO_JOB,
+			.seq = i,
+		};
+		if (!writeFully (fd, &ptag, sizeof (ptag)))
+			status = 1;
+	}
+	if (report.statsSize > 0 && status == 0)
+	{
+		void *stats = eMalloc (report.statsSize);
+		writeStatsRecord (stats);
+		if (!writeFully (fd, stats, report.statsSize))
+			status = 1;
+		eFree (stats);
+	}
+	if (report.traceSize > 0 && status == 0)
+	{
+		void *trace = eMalloc (report.traceSize);
+		writeTraceEventRecord (trace);
+		if (!writeFully (fd, trace, report.traceSize))
+			status = 1;
+		eFree (trace);
+	}
+	if (report.recordSize > 0 && status == 0)
+	{
+		void *record = eMalloc (report.recordSize);
+		spec->writeRecord (spec->data, record);
+		if (!writeFully (fd, record, report.recordSize))
+			status = 1;
+		eFree (record);
+	}
+
+	fflush (stdout);
+	fflush (stderr);
+
+	/* Don't run exit(): the stdio streams inherited from the parent
+	 * process must not be flushed or closed here. */
+	_exit (status);
+}
+
+/* Group the points by the jobs. */
+static int comparePseudoTags (const void *a, const void *b)
+{
+	const jobPseudoTag *pa = a, *pb = b;
+
+	if (pa->job != pb->job)
+		return (pa->job < pb->job)? -1: 1;
+	return (pa->seq < pb->seq)? -1: (pa->seq > pb->seq);
+}
+
+static void receiveReport (parserJob *job, const char *what)
+{
+	int status;
+
+	if (!readFully (job->fd, &job->report, sizeof (job->report)))
+		job->report.size = -1;
+	else if (job->report.ptagCount > 0)
+	{
+		job->ptags = xMalloc (job->report.ptagCount, jobPseudoTag);
+		if (!readFully (job->fd, job->ptags,
+						sizeof (jobPseudoTag) * job->report.ptagCount))
+			job->report.size = -1;
+		else
+			qsort (job->ptags, job->report.ptagCount, sizeof (jobPseudoTag),
+				   comparePseudoTags);
+	}
+	if (job->report.size >= 0 && job->report.statsSize > 0)
+	{
+		job->stats = eMalloc (job->report.statsSize);
+		if (!readFully (job->fd, job->stats, job->report.statsSize))
+			job->report.size = -1;
+	}
+	if (job->report.size >= 0 && job->report.traceSize > 0)
+	{
+		job->trace = eMalloc (job->report.traceSize);
+		if (!readFully (job->fd, job->trace, job->report.traceSize))
+			job->report.size = -1;
+	}
+	if (job->report.size >= 0 && job->report.recordSize > 0)
+	{
+		job->record = eMalloc (job->report.recordSize);
+		if (!readFully (job->fd, job->record, job->report.recordSize))
+			job->report.size = -1;
+	}
+	close (job->fd);
+
+	while (waitpid (job->pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+			error (FATAL | PERROR, "failed to wait a worker (pid: %d)", (int) job->pid);
+	}
+
+	if (! (WIFEXITED (status) && WEXITSTATUS (status) == 0)
+		|| job->report.size < 0)
+		error (FATAL, "a worker (pid: %d) for %s failed", (int) job->pid, what);
+}
+
+static void mergeReport (parserJob *job)
+{
+	addTotals ((unsigned int) job->report.files,
+			   (unsigned long) job->report.lines,
+			   (unsigned long) job->report.bytes);
+	addStatsAllocations (job->report.allocations);
+	addPartialTotals (&job->report.partial);
+	addMemoryTotals (&job->report.memory);
+	if (job->stats
+		&& !mergeStatsRecord (job->stats, job->report.statsSize))
+		error (FATAL, "broken statistics from a worker (pid: %d)", (int) job->pid);
+	if (job->trace
+		&& !mergeTraceEventRecord ((int) job->pid, job->trace, job->report.traceSize))
+		error (FATAL, "broken event trace from a worker (pid: %d)", (int) job->pid);
+}
+
+static int compareJobCosts (const void *a, const void *b)
+{
+	const jobCost *x = a;
+	const jobCost *y = b;
+
+	if (x->cost != y->cost)
+		return (x->cost > y->cost)? -1: 1;
+	return (x->job < y->job)? -1: (x->job > y->job);
+}
+
+/* Deal the jobs to the deques of the workers in the order of
+ * decreasing costs. */
+static jobDeque *makeJobDeques (const unsigned long *costs,
+								unsigned int count, unsigned int jobs)
+{
+	jobDeque *deques = xCalloc (jobs, jobDeque);
+	jobCost *order = xMalloc (count, jobCost);
+
+	for (unsigned int i = 0; i < count; i++)
+	{
+		order [i].cost = costs [i];
+		order [i].job = i;
+	}
+	qsort (order, count, sizeof (order [0]), compareJobCosts);
+
+	for (unsigned int k = 0; k < jobs; k++)
+		deques [k].jobs = xMalloc (count / jobs + 1, unsigned int);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		jobDeque *d = deques + (i % jobs);
+		d->jobs [d->tail++] = order [i].job;
+		d->cost += order [i].cost;
+	}
+
+	eFree (order);
+	return deques;
+}
+
+/* Take the next job for worker K from its deque, or steal the last one
+ * of the deque having the most cost left. The victim keeps its larger
+ * jobs, and the thief takes the smaller ones. */
+static unsigned int takeJob (jobDeque *deques, unsigned int jobs,
+							 unsigned int k, const unsigned long *costs,
+							 bool *stolen)
+{
+	jobDeque *d = deques + k;
+	unsigned int job;
+
+	*stolen = false;
+	if (d->head < d->tail)
+		job = d->jobs [d->head++];
+	else
+	{
+		d = NULL;
+		for (unsigned int v = 0; v < jobs; v++)
+		{
+			jobDeque *victim = deques + v;
+
+			if (victim->head == victim->tail)
+				continue;
+			if (d == NULL || victim->cost > d->cost
+				|| (victim->cost == d->cost
+					&& victim->tail - victim->head > d->tail - d->head))
+				d = victim;
+		}
+		if (d == NULL)
+			return NO_JOB;
+		job = d->jobs [--d->tail];
+		*stolen = true;
+	}
+	d->cost -= costs [job];
+	return job;
+}
+
+/* Let the jobs run after the next job of DEQUE be prefetched. */
+static void prefetchJobs (const jobSpec *const spec, const jobDeque *deque,
+						  bool first)
+{
+	unsigned int start = deque->head + (first? 0: Option.readAhead - 1);
+	unsigned int end = deque->head + Option.readAhead;
+
+	if (spec->prefetch == NULL || Option.readAhead == 0)
+		return;
+	for (unsigned int i = start; i < end && i < deque->tail; i++)
+		spec->prefetch (spec->data, deque->jobs [i]);
+}
+
+/* Give the workers the jobs they ask for until all the jobs are run. */
+static void scheduleJobs (const jobSpec *const spec, parserJob *jobTable,
+						  unsigned int count, unsigned int jobs,
+						  jobSegment *segments)
+{
+	unsigned long *costs = xMalloc (count, unsigned long);
+	struct pollfd *fds = xMalloc (jobs, struct pollfd);
+	unsigned int active = jobs;
+	jobDeque *deques;
+
+	for (unsigned int i = 0; i < count; i++)
+		costs [i] = spec->getJobCost (spec->data, i);
+	deques = makeJobDeques (costs, count, jobs);
+	for (unsigned int k = 0; k < jobs; k++)
+		prefetchJobs (spec, deques + k, true);
+
+	while (active > 0)
+	{
+		for (unsigned int k = 0; k < jobs; k++)
+		{
+			fds [k].fd = (jobTable [k].replyFd >= 0)? jobTable [k].fd: -1;
+			fds [k].events = POLLIN;
+			fds [k].revents = 0;
+		}
+		if (poll (fds, jobs, -1) < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			error (FATAL | PERROR, "cannot wait for the workers");
+		}
+
+		for (unsigned int k = 0; k < jobs; k++)
+		{
+			parserJob *job = jobTable + k;
+			jobDone done;
+			unsigned int next;
+			bool stolen;
+
+			if (fds [k].fd < 0 || fds [k].revents == 0)
+				continue;
+			if (!readFully (job->fd, &done, sizeof (done))
+				|| (done.job != NO_JOB && done.job >= count))
+				error (FATAL, "a worker (pid: %d) for %s failed",
+					   (int) job->pid, spec->what);
+			if (done.job != NO_JOB)
+			{
+				segments [done.job].worker = k;
+				segments [done.job].offset = done.offset;
+				segments [done.job].size = done.size;
+				segments [done.job].numTags = done.numTags;
+			}
+
+			next = takeJob (deques, jobs, k, costs, &stolen);
+			if (!writeFully (job->replyFd, &next, sizeof (next)))
+				error (FATAL | PERROR, "cannot give a job to a worker (pid: %d)",
+					   (int) job->pid);
+			if (next == NO_JOB)
+			{
+				close (job->replyFd);
+				job->replyFd = -1;
+				active--;
+			}
+			else
+			{
+				job->work.jobs++;
+				job->work.cost += costs [next];
+				if (stolen)
+				{
+					job->work.stolen++;
+					verbose ("worker %u steals %s %u\n", k, spec->what, next);
+				}
+				else
+					prefetchJobs (spec, deques + k, false);
+			}
+		}
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+		eFree (deques [k].jobs);
+	eFree (deques);
+	eFree (fds);
+	eFree (costs);
+}
+
+/* Emit the pseudo tags for the parsers used in the workers before the
+ * regular tags, in the order of the parsers so that the order doesn't
+ * depend on which worker used which parser. This is for the outputs
+ * sorted in the workers, where the order of the lines doesn't matter. */
+static void makeWorkerParserPseudoTags (parserJob *jobTable, unsigned int jobs)
+{
+	bool *used = xCalloc (countParsers (), bool);
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		parserJob *job = jobTable + k;
+		for (unsigned int i = 0; i < job->report.ptagCount; i++)
+			if (job->ptags [i].lang >= 0
+				&& (unsigned int) job->ptags [i].lang < countParsers ())
+				used [job->ptags [i].lang] = true;
+	}
+	for (unsigned int i = 0; i < countParsers (); i++)
+		if (used [i])
+			makeParserPseudoTags (i);
+
+	eFree (used);
+}
+
+/* Append the tags in [OFFSET, OFFSET + SIZE) of the output of JOB to
+ * the tag file: the whole output if SEGMENT is NO_JOB, or the tags of
+ * the job SEGMENT scheduled dynamically. The pseudo tags for a parser
+ * are emitted at the first point where a worker deferred them, so that
+ * an unsorted tag file is the same as the one made serially. */
+static void appendJobOutput (parserJob *job, long offset, long size,
+							 unsigned long numTags, unsigned int segment)
+{
+	const long end = offset + size;
+	unsigned int lo = 0, hi = job->report.ptagCount;
+
+	/* Find the first point of SEGMENT. */
+	while (lo < hi)
+	{
+		unsigned int mid = lo + (hi - lo) / 2;
+		if (job->ptags [mid].job < segment)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+
+	for (unsigned int i = lo;
+		 i < job->report.ptagCount && job->ptags [i].job == segment; i++)
+	{
+		const jobPseudoTag *ptag = job->ptags + i;
+
+		if (ptag->lang < 0 || (unsigned int) ptag->lang >= countParsers ()
+			|| isParserPseudoTagPrinted (ptag->lang))
+			continue;
+		if (offset < ptag->offset && ptag->offset <= end)
+		{
+			appendToTagFile (job->mio, offset, ptag->offset - offset, 0);
+			offset = ptag->offset;
+		}
+		makeParserPseudoTags (ptag->lang);
+	}
+	appendToTagFile (job->mio, offset, end - offset, numTags);
+}
+
+static bool runJobsWithFork (const jobSpec *const spec, unsigned int count, unsigned int jobs)
+{
+	parserJob *jobTable = xCalloc (jobs, parserJob);
+	bool *accepted = xMalloc (jobs, bool);
+	void **records;
+	bool resize = false;
+	const bool sortShards = spec->mergeable && canMergeSortedShards ();
+	const bool scheduled = spec->getJobCost && !spec->checkRecords;
+	jobSegment *segments = NULL;
+	statsTime t0, t1;
+
+	verbose ("running %u workers for %u %s\n", jobs, count, spec->what);
+
+	/* Nothing buffered in the parent process should be written
+	 * twice by the children. */
+	flushTagFile ();
+	fflush (stdout);
+	fflush (stderr);
+
+	readStatsTime (&t0);
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		parserJob *job = jobTable + k;
+		unsigned int start = (unsigned int) (((unsigned long) count * k) / jobs);
+		unsigned int end   = (unsigned int) (((unsigned long) count * (k + 1)) / jobs);
+		int fds [2];
+		int replyFds [2] = { -1, -1 };
+
+		job->start = start;
+		job->end = end;
+		accepted [k] = true;
+		job->mio = tempFile ("w+", &job->name);
+		if (sortShards)
+			job->sorted = tempFile ("w+", &job->sortedName);
+		if (pipe (fds) != 0 || (scheduled && pipe (replyFds) != 0))
+			error (FATAL | PERROR, "cannot make a pipe for a worker");
+
+		job->pid = fork ();
+		if (job->pid < 0)
+			error (FATAL | PERROR, "cannot fork a worker");
+		else if (job->pid == 0)
+		{
+			close (fds [0]);
+			if (scheduled)
+			{
+				close (replyFds [1]);
+				/* Don't keep the pipes of the other workers open. */
+				for (unsigned int i = 0; i < k; i++)
+					close (jobTable [i].replyFd);
+			}
+			runWorker (spec, start, end, job->mio, job->sorted, fds [1],
+					   replyFds [0]);
+		}
+		close (fds [1]);
+		job->fd = fds [0];
+		job->replyFd = -1;
+		if (scheduled)
+		{
+			close (replyFds [0]);
+			job->replyFd = replyFds [1];
+			verbose ("worker %u (pid: %d) runs %s\n",
+					 k, (int) job->pid, spec->what);
+		}
+		else
+		{
+			job->work.jobs = end - start;
+			if (spec->getJobCost)
+				for (unsigned int i = start; i < end; i++)
+					job->work.cost += spec->getJobCost (spec->data, i);
+			verbose ("worker %u (pid: %d) runs %s [%u, %u)\n",
+					 k, (int) job->pid, spec->what, start, end);
+		}
+	}
+
+	if (scheduled)
+	{
+		segments = xCalloc (count, jobSegment);
+		scheduleJobs (spec, jobTable, count, jobs, segments);
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+		receiveReport (jobTable + k, spec->what);
+	readStatsTime (&t1);
+
+	if (sortShards)
+		makeWorkerParserPseudoTags (jobTable, jobs);
+
+	if (spec->checkRecords)
+	{
+		records = xMalloc (jobs, void *);
+		for (unsigned int k = 0; k < jobs; k++)
+			records [k] = jobTable [k].record;
+		spec->checkRecords (spec->data, jobs, records, accepted);
+		eFree (records);
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		parserJob *job = jobTable + k;
+
+		if (!accepted [k])
+		{
+			verbose ("running %s [%u, %u) of worker %u again\n",
+					 spec->what, job->start, job->end, k);
+			resize |= spec->run (spec->data, job->start, job->end);
+		}
+		else
+		{
+			mergeReport (job);
+			resize |= job->report.resize;
+			if (job->sorted)
+			{
+				addSortedShardToTagFile (job->sorted, job->sortedName,
+										 job->report.numTags);
+				job->sorted = NULL;
+			}
+			else if (!scheduled)
+				appendJobOutput (job, 0, job->report.size,
+								 job->report.numTags, NO_JOB);
+		}
+		job->work.busy = job->report.busy;
+		job->work.wall = t1.wall - t0.wall;
+		addWorkerStats (k, &job->work);
+	}
+
+	/* The tags of the jobs scheduled dynamically are scattered in the
+	 * outputs of the workers. */
+	for (unsigned int i = 0; segments && !sortShards && i < count; i++)
+	{
+		jobSegment *seg = segments + i;
+
+		appendJobOutput (jobTable + seg->worker,
+						 seg->offset, seg->size, seg->numTags, i);
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		parserJob *job = jobTable + k;
+
+		if (job->sorted)
+		{
+			mio_unref (job->sorted);
+			remove (job->sortedName);
+			eFree (job->sortedName);
+		}
+		mio_unref (job->mio);
+		remove (job->name);
+		eFree (job->name);
+		if (job->ptags)
+			eFree (job->ptags);
+		if (job->stats)
+			eFree (job->stats);
+		if (job->trace)
+			eFree (job->trace);
+		if (job->record)
+			eFree (job->record);
+	}
+
+	if (segments)
+		eFree (segments);
+	eFree (accepted);
+	eFree (jobTable);
+	return resize;
+}
+#endif
+
+extern bool runJobs (const jobSpec *const spec, unsigned int count, unsigned int jobs)
+{
+	if (jobs > count)
+		jobs = count;
+
+#ifdef HAVE_FORK
+	if (jobs > 1)
+		return runJobsWithFork (spec, count, jobs);
+#endif
+	return spec->run (spec->data, 0, count);
+}
+
+extern unsigned int countIdleJobs (void)
+{
+	return IdleJobs;
+}
+
+struct parserJobs {
+	const stringList *fileNames;
+	const ulongArray *sizes;
+};
+
+static bool runParsersInRange (void *data, unsigned int start, unsigned int end)
+{
+	struct parserJobs *pj = data;
+
+	return runParsersSerially (pj->fileNames, start, end);
+}
+
+static unsigned long getInputFileSize (void *data, unsigned int n)
+{
+	struct parserJobs *pj = data;
+
+	return ulongArrayItem (pj->sizes, n);
+}
+
+static void prefetchInputFile (void *data, unsigned int n)
+{
+	struct parserJobs *pj = data;
+
+	readAheadFile (vStringValue (stringListItem (pj->fileNames, n)));
+}
+
+extern bool runParserJobs (const stringList *const fileNames,
+						   const ulongArray *const sizes, unsigned int jobs)
+{
+	const unsigned int count = stringListCount (fileNames);
+	struct parserJobs pj = {
+		.fileNames = fileNames,
+		.sizes = sizes,
+	};
+	const jobSpec spec = {
+		.what = "input files",
+		.run = runParsersInRange,
+		.getJobCost = (sizes && ulongArrayCount (sizes) == count)? getInputFileSize: NULL,
+		.prefetch = prefetchInputFile,
+		.data = &pj,
+		.mergeable = true,
+	};
+	bool resize;
+
+	if (jobs > 1 && count > 1)
+		return runJobs (&spec, count, jobs);
+
+	IdleJobs = jobs;
+	resize = runParsersSerially (fileNames, 0, count);
+	IdleJobs = 0;
+	return resize;
+}
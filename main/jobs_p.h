@@ -0,0 +1,86 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for running parsers in worker processes.
+*/
+#ifndef CTAGS_MAIN_JOBS_PRIVATE_H
+#define CTAGS_MAIN_JOBS_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "numarray.h"
+#include "strlist.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+
+/* COUNT jobs numbered from 0 are divided into contiguous ranges, and
+ * each range is run in a worker process. The tags written in a worker
+ * are appended to the tag file in the order of the ranges. */
+typedef struct sJobSpec {
+	const char *what;			/* for messages */
+
+	/* Run the jobs [START, END). Returns true if the tag file may be
+	 * shrunk. */
+	bool (* run) (void *data, unsigned int start, unsigned int end);
+
+	/* Optional. In a worker, after running the jobs, the record made
+	 * with these is passed to the parent process. */
+	size_t (* getRecordSize) (void *data);
+	void (* writeRecord) (void *data, void *buf);
+
+	/* Optional. Called in the parent process with the records of the
+	 * JOBS workers. Setting ACCEPTED [K] to false discards the tags
+	 * written in worker K; its jobs are run again in the parent process
+	 * in the order of the ranges. */
+	void (* checkRecords) (void *data, unsigned int jobs,
+						   void *const *records, bool *accepted);
+
+	/* Optional. The cost of job N, like the size of an input file.
+	 * If given, the jobs are scheduled dynamically: RUN is called for
+	 * one job at a time, and the larger jobs start first. Ignored if
+	 * checkRecords is given. */
+	unsigned long (* getJobCost) (void *data, unsigned int n);
+
+	/* Optional. Called in the parent process for job N to be run soon
+	 * by a worker when the jobs are scheduled dynamically. */
+	void (* prefetch) (void *data, unsigned int n);
+
+	/* The tags written in a worker may be sorted in the worker and
+	 * merged into the tag file when it is closed. Must be false if the
+	 * parent process is parsing an input file, which may be parsed
+	 * again with the tag file truncated. */
+	bool mergeable;
+
+	void *data;
+} jobSpec;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Parse FILENAMES with up to JOBS worker processes. SIZES, the sizes
+ * of the files, can be NULL; if given, the larger files start first.
+ * The tags are written to the tag file in the order of FILENAMES
+ * as if the files were parsed one by one.
+ * Returns true if the tag file may be shrunk. */
+extern bool runParserJobs (const stringList *const fileNames,
+						   const ulongArray *const sizes, unsigned int jobs);
+
+/* Run the jobs of SPEC with up to JOBS worker processes. */
+extern bool runJobs (const jobSpec *const spec, unsigned int count, unsigned int jobs);
+
+/* The number of worker processes --jobs=<N> allows while parsing an
+ * input file in the parent process: N if the parent process parses
+ * the input files by itself because they are fewer than two, 0 in a
+ * worker process. */
+extern unsigned int countIdleJobs (void);
+
+#endif	/* CTAGS_MAIN_JOBS_PRIVATE_H */
@@ -13,9 +13,9 @@
 #include "general.h"  /* must always come first */
 
 #include <string.h>
-#include <ctype.h>
 
 #include "debug.h"
+#include "htable.h"
 #include "keyword.h"
 #include "keyword_p.h"
 #include "parse.h"
@@ -24,91 +24,94 @@
 /*
 *   DATA DECLARATIONS
 */
-typedef struct sHashEntry {
-	struct sHashEntry *next;
-	const char *string;
-	langType language;
+
+/* Each language has its own open addressing table. The hash value and
+ * the length are stored with the keyword, so a lookup usually costs one
+ * hash calculation and one comparison without walking a chain. */
+typedef struct sKeywordEntry {
+	const char *string;			/* NULL for an empty slot */
+	size_t length;
+	unsigned int hash;
 	int value;
-} hashEntry;
+} keywordEntry;
+
+typedef struct sKeywordTable {
+	keywordEntry *entries;
+	unsigned int size;			/* power of 2 */
+	unsigned int count;
+	size_t maxLength;
+} keywordSet;
 
 /*
 *   DATA DEFINITIONS
 */
-static const unsigned int TableSize = 2039;  /* prime */
-static hashEntry **HashTable = NULL;
-static unsigned int MaxEntryLen = 0;
+static const unsigned int InitialSetSize = 16;
+static keywordSet *KeywordSets = NULL;	/* indexed by langType */
+static unsigned int KeywordSetCount = 0;
 
 /*
 *   FUNCTION DEFINITIONS
 */
 
-static hashEntry **getHashTable (void)
+static keywordSet *getKeywordSet (langType language, bool creating)
 {
-	static bool allocated = false;
+	if (language < 0)
+		return NULL;
 
-	if (! allocated)
+	if ((unsigned int) language >= KeywordSetCount)
 	{
-		unsigned int i;
+		unsigned int count = KeywordSetCount;
 
-		HashTable = xMalloc (TableSize, hashEntry*);
+		if (! creating)
+			return NULL;
 
-		for (i = 0  ;  i < TableSize  ;  ++i)
-			HashTable [i] = NULL;
-
-		allocated = true;
+		KeywordSetCount = language + 1;
+		KeywordSets = xRealloc (KeywordSets, KeywordSetCount, keywordSet);
+		memset (KeywordSets + count, 0,
+				sizeof (keywordSet) * (KeywordSetCount - count));
 	}
-	return HashTable;
+	if (KeywordSets [language].entries == NULL && ! creating)
+		return NULL;
+	return KeywordSets + language;
 }
 
-static hashEntry *getHashTableEntry (unsigned long hashedValue)
+/* Return the hash of STRING up to MAXLEN bytes, storing its length to
+ * LENGTH. LENGTH is MAXLEN + 1 if STRING is longer than MAXLEN. */
+static unsigned int hashValue (const char *const string, size_t maxLen,
+							   size_t *length)
 {
-	hashEntry **const table = getHashTable ();
-	hashEntry *entry;
-
-	Assert (hashedValue < TableSize);
-	entry = table [hashedValue];
+	Assert (string != NULL);
 
-	return entry;
+	*length = strnlen (string, maxLen + 1);
+	if (*length > maxLen)
+		return 0;
+	return hashCstrncasehash (string, *length);
 }
 
-static unsigned int hashValue (const char *const string, langType language,
-	unsigned int maxLen, bool *maxLenReached)
+static void putEntry (keywordEntry *entries, unsigned int size,
+					  const keywordEntry *const entry)
 {
-	const char *p;
-	unsigned int h = 5381;
-
-	Assert (string != NULL);
-
-	/* "djb" hash as used in g_str_hash() in glib */
-	for (p = string; *p != '\0'; p++)
-	{
-		h = (h << 5) + h + (signed char) tolower ((unsigned char) *p);
-
-		if (p > string + maxLen)
-		{
-			*maxLenReached = true;
-			return 0;
-		}
-	}
+	unsigned int i = entry->hash & (size - 1);
 
-	/* consider language as an extra "character" and add it to the hash */
-	h = (h << 5) + h + language;
-
-	*maxLenReached = false;
-	return h;
+	while (entries [i].string != NULL)
+		i = (i + 1) & (size - 1);
+	entries [i] = *entry;
 }
 
-static hashEntry *newEntry (
-		const char *const string, langType language, int value)
+static void growKeywordSet (keywordSet *table)
 {
-	hashEntry *const entry = xMalloc (1, hashEntry);
-
-	entry->next     = NULL;
-	entry->string   = string;
-	entry->language = language;
-	entry->value    = value;
+	unsigned int size = table->size? table->size * 2: InitialSetSize;
+	keywordEntry *entries = xCalloc (size, keywordEntry);
 
-	return entry;
+	for (unsigned int i = 0; i < table->size; i++)
+	{
+		if (table->entries [i].string != NULL)
+			putEntry (entries, size, table->entries + i);
+	}
+	if (table->entries)
+		eFree (table->entries);
+	table->entries = entries;
+	table->size = size;
 }
 
 /*  Note that it is assumed that a "value" of zero means an undefined keyword
@@ -118,65 +121,60 @@ static hashEntry *newEntry (
  */
 extern void addKeyword (const char *const string, langType language, int value)
 {
-	bool dummy;
-	const unsigned int index = hashValue (string, language, 1000, &dummy) % TableSize;
-	hashEntry *entry = getHashTableEntry (index);
-	size_t len = strlen (string);
+	keywordSet *table = getKeywordSet (language, true);
+	keywordEntry entry;
+
+	Assert (table != NULL);
+	entry.string = string;
+	entry.length = strlen (string);
+	entry.hash = hashCstrncasehash (string, entry.length);
+	entry.value = value;
 
-	if (len > MaxEntryLen)
-		MaxEntryLen = len;
+	/* Keep the load factor at most 1/2. */
+	if ((table->count + 1) * 2 > table->size)
+		growKeywordSet (table);
 
-	if (entry == NULL)
+#ifdef DEBUG
+	for (unsigned int i = entry.hash & (table->size - 1);
+		 table->entries [i].string != NULL;
+		 i = (i + 1) & (table->size - 1))
 	{
-		hashEntry **const table = getHashTable ();
-		table [index] = newEntry (string, language, value);
+		if (strcmp (string, table->entries [i].string) == 0)
+			Assert (("Already in table" == NULL));
 	}
-	else
-	{
-		hashEntry *prev = NULL;
+#endif
 
-		while (entry != NULL)
-		{
-			if (language == entry->language  &&
-				strcmp (string, entry->string) == 0)
-			{
-				Assert (("Already in table" == NULL));
-			}
-			prev = entry;
-			entry = entry->next;
-		}
-		if (entry == NULL)
-		{
-			Assert (prev != NULL);
-			prev->next = newEntry (string, language, value);
-		}
-	}
+	putEntry (table->entries, table->size, &entry);
+	table->count++;
+	if (entry.length > table->maxLength)
+		table->maxLength = entry.length;
 }
 
 static int lookupKeywordFull (const char *const string, bool caseSensitive, langType language)
 {
-	bool maxLenReached;
-	const unsigned int index = hashValue (string, language, MaxEntryLen, &maxLenReached) % TableSize;
-	hashEntry *entry;
-	int result = KEYWORD_NONE;
+	const keywordSet *const table = getKeywordSet (language, false);
+	unsigned int hash, i;
+	size_t length;
 
-	if (maxLenReached)
+	if (table == NULL)
 		return KEYWORD_NONE;
 
-	entry = getHashTableEntry (index);
+	hash = hashValue (string, table->maxLength, &length);
+	if (length > table->maxLength)
+		return KEYWORD_NONE;
 
-	while (entry != NULL)
+	for (i = hash & (table->size - 1);
+		 table->entries [i].string != NULL;
+		 i = (i + 1) & (table->size - 1))
 	{
-		if (language == entry->language &&
-			((caseSensitive && strcmp (string, entry->string) == 0) ||
-			 (!caseSensitive && strcasecmp (string, entry->string) == 0)))
-		{
-			result = entry->value;
-			break;
-		}
-		entry = entry->next;
+		const keywordEntry *const entry = table->entries + i;
+
+		if (entry->hash == hash && entry->length == length
+			&& ((caseSensitive && memcmp (string, entry->string, length) == 0) ||
+				(!caseSensitive && strcasecmp (string, entry->string) == 0)))
+			return entry->value;
 	}
-	return result;
+	return KEYWORD_NONE;
 }
 
 extern int lookupKeyword (const char *const string, langType language)
@@ -191,90 +189,60 @@ extern int lookupCaseKeyword (const char *const string, langType language)
 
 extern void freeKeywordTable (void)
 {
-	if (HashTable != NULL)
+	if (KeywordSets != NULL)
 	{
-		unsigned int i;
-
-		for (i = 0  ;  i < TableSize  ;  ++i)
+		for (unsigned int i = 0; i < KeywordSetCount; i++)
 		{
-			hashEntry *entry = HashTable [i];
-
-			while (entry != NULL)
-			{
-				hashEntry *next = entry->next;
-				eFree (entry);
-				entry = next;
-			}
+			if (KeywordSets [i].entries)
+				eFree (KeywordSets [i].entries);
 		}
-		eFree (HashTable);
+		eFree (KeywordSets);
+		KeywordSets = NULL;
+		KeywordSetCount = 0;
 	}
 }
 
 #ifdef DEBUG
 
-static void printEntry (const hashEntry *const entry)
-{
-	printf ("  %-15s %-7s\n", entry->string, getLanguageName (entry->language));
-}
-
-static unsigned int printBucket (const unsigned int i)
+extern void printKeywordTable (void)
 {
-	hashEntry **const table = getHashTable ();
-	hashEntry *entry = table [i];
-	unsigned int measure = 1;
-	bool first = true;
-
-	printf ("%2d:", i);
-	if (entry == NULL)
-		printf ("\n");
-	else while (entry != NULL)
+	for (unsigned int l = 0; l < KeywordSetCount; l++)
 	{
-		if (! first)
-			printf ("    ");
-		else
-		{
-			printf (" ");
-			first = false;
-		}
-		printEntry (entry);
-		entry = entry->next;
-		measure = 2 * measure;
-	}
-	return measure - 1;
-}
+		const keywordSet *const table = KeywordSets + l;
+		unsigned long displaced = 0;
 
-extern void printKeywordTable (void)
-{
-	unsigned long emptyBucketCount = 0;
-	unsigned long measure = 0;
-	unsigned int i;
+		if (table->entries == NULL)
+			continue;
 
-	for (i = 0  ;  i < TableSize  ;  ++i)
-	{
-		const unsigned int pass = printBucket (i);
+		for (unsigned int i = 0; i < table->size; i++)
+		{
+			const keywordEntry *const entry = table->entries + i;
 
-		measure += pass;
-		if (pass == 0)
-			++emptyBucketCount;
+			if (entry->string == NULL)
+				continue;
+			printf ("  %-15s %-7s\n", entry->string, getLanguageName (l));
+			if ((entry->hash & (table->size - 1)) != i)
+				displaced++;
+		}
+		printf ("%s: %u keywords in %u slots, %lu displaced\n",
+				getLanguageName (l), table->count, table->size, displaced);
 	}
-
-	printf ("spread measure = %ld\n", measure);
-	printf ("%ld empty buckets\n", emptyBucketCount);
 }
 
 #endif
 
 extern void dumpKeywordTable (FILE *fp)
 {
-	unsigned int i;
-	for (i = 0  ;  i < TableSize  ;  ++i)
+	for (unsigned int l = 0; l < KeywordSetCount; l++)
 	{
-		hashEntry **const table = getHashTable ();
-		hashEntry *entry = table [i];
-		while (entry != NULL)
+		const keywordSet *const table = KeywordSets + l;
+
+		for (unsigned int i = 0; i < table->size; i++)
 		{
-			fprintf(fp, "%s	%s\n", entry->string, getLanguageName (entry->language));
-			entry = entry->next;
+			const keywordEntry *const entry = table->entries + i;
+
+			if (entry->string != NULL)
+				fprintf(fp, "%s	%s\n", entry->string, getLanguageName (l));
 		}
 	}
 }
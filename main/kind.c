@@ -20,6 +20,7 @@
 #include "ctags.h"
 #include "debug.h"
 #include "entry.h"
+#include "entry_p.h"
 #include "kind.h"
 #include "parse_p.h"
 #include "options.h"
@@ -43,6 +44,8 @@ typedef struct sKindObject {
 	freeKindDefFunc free;
 	struct roleControlBlock *rcb;
 	ptrArray * dynamicSeparators;
+	roleBitsType enabledRoleBits;	/* valid if enabledRoleBitsEpoch == RoleEpoch */
+	unsigned int enabledRoleBitsEpoch;
 } kindObject;
 
 struct kindControlBlock {
@@ -53,6 +56,10 @@ struct kindControlBlock {
 	scopeSeparator defaultRootScopeSeparator;
 };
 
+/* Incremented whenever a role is enabled, disabled, or defined. Zero
+ * marks enabledRoleBits of a kindObject never computed. */
+static unsigned int RoleEpoch = 1;
+
 extern const char *renderRole (const roleDefinition* const role, vString* b)
 {
 	vStringCatS (b, role->name);
@@ -84,6 +91,7 @@ extern void enableKind (kindDefinition *kind, bool enable)
 extern void enableRole (roleDefinition *role, bool enable)
 {
 	role->enabled = enable;
+	RoleEpoch++;
 }
 
 static void initRoleObject (roleObject *robj, roleDefinition *rdef, freeRoleDefFunc freefunc, int roleId)
@@ -146,6 +154,7 @@ extern struct kindControlBlock* allocKindControlBlock (parserDefinition *parser)
 		kind->def->id = i;
 		kind->rcb = allocRoleControlBlock (kind);
 		kind->dynamicSeparators = NULL;
+		kind->enabledRoleBitsEpoch = 0;
 	}
 
 	return kcb;
@@ -195,6 +204,7 @@ extern int  defineKind (struct kindControlBlock* kcb, kindDefinition *def,
 	kcb->kind [def->id].free = freeKindDef;
 	kcb->kind [def->id].rcb = allocRoleControlBlock(kcb->kind + def->id);
 	kcb->kind [def->id].dynamicSeparators = NULL;
+	kcb->kind [def->id].enabledRoleBitsEpoch = 0;
 
 	verbose ("Add kind[%d] \"%c,%s,%s\" to %s\n", def->id,
 			 def->letter, def->name, def->description,
@@ -220,6 +230,7 @@ extern int defineRole (struct kindControlBlock* kcb, int kindIndex,
 
 	rcb->role = xRealloc (rcb->role, rcb->count, roleObject);
 	initRoleObject (rcb->role + roleIndex, def, freeRoleDef, roleIndex);
+	RoleEpoch++;
 
 	return roleIndex;
 }
@@ -230,6 +241,25 @@ extern bool isRoleEnabled (struct kindControlBlock* kcb, int kindIndex, int role
 	return rdef->enabled;
 }
 
+extern roleBitsType getEnabledRoleBits (struct kindControlBlock* kcb, int kindIndex)
+{
+	kindObject *kind = kcb->kind + kindIndex;
+
+	if (kind->enabledRoleBitsEpoch != RoleEpoch)
+	{
+		struct roleControlBlock *rcb = kind->rcb;
+
+		kind->enabledRoleBits = 0;
+		for (unsigned int i = 0; i < rcb->count; i++)
+		{
+			if (rcb->role [i].def->enabled)
+				kind->enabledRoleBits |= makeRoleBit (i);
+		}
+		kind->enabledRoleBitsEpoch = RoleEpoch;
+	}
+	return kind->enabledRoleBits;
+}
+
 extern unsigned int countKinds (struct kindControlBlock* kcb)
 {
 	return kcb->count;
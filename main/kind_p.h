@@ -13,6 +13,7 @@
 */
 
 #include "general.h"
+#include "entry.h"
 #include "kind.h"
 #include "vstring.h"
 
@@ -41,6 +42,9 @@ extern int  defineKind (struct kindControlBlock* kcb, kindDefinition *def,
 extern int defineRole (struct kindControlBlock* kcb, int kindIndex,
 					   roleDefinition *def, freeRoleDefFunc freeRoleDef);
 extern bool isRoleEnabled (struct kindControlBlock* kcb, int kindIndex, int roleIndex);
+/* The bits (makeRoleBit ()) of the roles of the kind enabled now. The
+ * result is cached until a role is enabled, disabled, or defined. */
+extern roleBitsType getEnabledRoleBits (struct kindControlBlock* kcb, int kindIndex);
 
 extern unsigned int countKinds (struct kindControlBlock* kcb);
 extern unsigned int countRoles (struct kindControlBlock* kcb, int kindIndex);
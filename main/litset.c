@@ -0,0 +1,215 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for searching a string for many
+*   literals in one pass.
+*
+*   The literals are compiled into an Aho-Corasick automaton when the set
+*   is searched first. The automaton is a DFA: each byte of the input
+*   takes one transition. To keep the transition table small, the bytes
+*   not used in any literal share one column of the table.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "debug.h"
+#include "litset_p.h"
+#include "ptrarray.h"
+#include "routines.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sLiteral {
+	char *string;
+	unsigned int id;
+} literal;
+
+typedef struct sLiteralOutput {
+	unsigned int id;
+	unsigned int next;			/* index in outputs + 1, or 0 */
+} literalOutput;
+
+struct sLiteralSet {
+	ptrArray *literals;
+
+	/* The automaton. State 0 is the initial state. */
+	bool built;
+	unsigned char byteClass [256];
+	unsigned int classCount;
+	unsigned int stateCount;
+	unsigned int *transitions;	/* [state * classCount + class] */
+	unsigned int *ownOutput;	/* the literals ending at the state:
+								   index in outputs + 1, or 0 */
+	unsigned int *outputLink;	/* the longest proper suffix having
+								   outputs: a state, or 0 */
+	literalOutput *outputs;
+};
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deleteLiteral (void *data)
+{
+	literal *l = data;
+
+	eFree (l->string);
+	eFree (l);
+}
+
+extern literalSet *literalSetNew (void)
+{
+	literalSet *set = xCalloc (1, literalSet);
+
+	set->literals = ptrArrayNew (deleteLiteral);
+	return set;
+}
+
+extern void literalSetDelete (literalSet *set)
+{
+	ptrArrayDelete (set->literals);
+	if (set->built)
+	{
+		eFree (set->transitions);
+		eFree (set->ownOutput);
+		eFree (set->outputLink);
+		eFree (set->outputs);
+	}
+	eFree (set);
+}
+
+extern void literalSetAdd (literalSet *set, const char *const string, unsigned int id)
+{
+	literal *l;
+
+	Assert (!set->built);
+	Assert (string && string [0] != '\0');
+
+	l = xMalloc (1, literal);
+	l->string = eStrdup (string);
+	l->id = id;
+	ptrArrayAdd (set->literals, l);
+}
+
+static void buildLiteralSet (literalSet *set)
+{
+	const unsigned int count = ptrArrayCount (set->literals);
+	unsigned int maxStates = 1;
+	unsigned int *queue;
+	unsigned int *fail;
+	unsigned int head, tail;
+
+	memset (set->byteClass, 0, sizeof (set->byteClass));
+	set->classCount = 1;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		const literal *l = ptrArrayItem (set->literals, i);
+
+		for (const unsigned char *p = (const unsigned char *) l->string; *p; p++)
+		{
+			if (set->byteClass [*p] == 0)
+				set->byteClass [*p] = set->classCount++;
+			maxStates++;
+		}
+	}
+
+	/* The trie of the literals. 0 in transitions means no edge here:
+	 * no edge goes back to the initial state in the trie. */
+	set->transitions = xCalloc ((size_t) maxStates * set->classCount, unsigned int);
+	set->ownOutput = xCalloc (maxStates, unsigned int);
+	set->outputLink = xCalloc (maxStates, unsigned int);
+	set->outputs = xMalloc (count? count: 1, literalOutput);
+	set->stateCount = 1;
+	for (unsigned int i = 0; i < count; i++)
+	{
+		const literal *l = ptrArrayItem (set->literals, i);
+		unsigned int state = 0;
+
+		for (const unsigned char *p = (const unsigned char *) l->string; *p; p++)
+		{
+			unsigned int *t = set->transitions
+				+ (size_t) state * set->classCount + set->byteClass [*p];
+			if (*t == 0)
+				*t = set->stateCount++;
+			state = *t;
+		}
+		set->outputs [i].id = l->id;
+		set->outputs [i].next = set->ownOutput [state];
+		set->ownOutput [state] = i + 1;
+	}
+
+	/* Turn the trie into a DFA in breadth-first order: a missing edge
+	 * goes where the edge from the failure state goes. The row of a
+	 * state is rewritten only when the state is visited, so the non-zero
+	 * entries in it are still the edges of the trie then. */
+	queue = xMalloc (set->stateCount, unsigned int);
+	fail = xCalloc (set->stateCount, unsigned int);
+	head = tail = 0;
+	for (unsigned int c = 0; c < set->classCount; c++)
+	{
+		unsigned int child = set->transitions [c];
+		if (child)
+			queue [tail++] = child;
+	}
+	while (head < tail)
+	{
+		const unsigned int state = queue [head++];
+		unsigned int *row = set->transitions + (size_t) state * set->classCount;
+		const unsigned int *failRow = set->transitions
+			+ (size_t) fail [state] * set->classCount;
+
+		for (unsigned int c = 0; c < set->classCount; c++)
+		{
+			const unsigned int child = row [c];
+
+			if (child == 0)
+				row [c] = failRow [c];
+			else
+			{
+				const unsigned int f = failRow [c];
+
+				fail [child] = f;
+				set->outputLink [child] = set->ownOutput [f]? f: set->outputLink [f];
+				queue [tail++] = child;
+			}
+		}
+	}
+	eFree (fail);
+	eFree (queue);
+
+	set->built = true;
+}
+
+extern void literalSetSearch (literalSet *set, const char *const s, size_t length,
+							  bool *found)
+{
+	unsigned int state = 0;
+
+	if (!set->built)
+		buildLiteralSet (set);
+
+	for (size_t i = 0; i < length; i++)
+	{
+		unsigned int reported;
+
+		state = set->transitions [(size_t) state * set->classCount
+								  + set->byteClass [(unsigned char) s [i]]];
+		for (reported = set->ownOutput [state]? state: set->outputLink [state];
+			 reported != 0;
+			 reported = set->outputLink [reported])
+		{
+			for (unsigned int o = set->ownOutput [reported]; o != 0;
+				 o = set->outputs [o - 1].next)
+				found [set->outputs [o - 1].id] = true;
+		}
+	}
+}
@@ -0,0 +1,39 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface to searching a string for many literals at once.
+*/
+#ifndef CTAGS_MAIN_LITSET_PRIVATE_H
+#define CTAGS_MAIN_LITSET_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stddef.h>
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sLiteralSet literalSet;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern literalSet *literalSetNew (void);
+extern void literalSetDelete (literalSet *set);
+
+/* Add a non-empty LITERAL identified by ID. More than one literal can
+ * have the same ID. A literal cannot be added after searching. */
+extern void literalSetAdd (literalSet *set, const char *const literal, unsigned int id);
+
+/* Set FOUND [ID] to true for each literal found in the LENGTH bytes of S.
+ * The other elements of FOUND are not changed. */
+extern void literalSetSearch (literalSet *set, const char *const s, size_t length,
+							  bool *found);
+
+#endif	/* CTAGS_MAIN_LITSET_PRIVATE_H */
@@ -16,8 +16,14 @@
 */
 #include "general.h"  /* must always come first */
 
+#include <ctype.h>
 #include <regex.h>
+#include <string.h>
+
 #include "lregex_p.h"
+#include "options_p.h"
+#include "routines.h"
+#include "vstring.h"
 
 /*
 *    FUNCTION DECLARATIONS
@@ -25,11 +31,281 @@
 static int match (struct regexBackend *backend,
 				  void *code, const char *input, size_t size,
 				  regmatch_t pmatch[BACK_REFERENCE_COUNT]);
+/*  Find the bytes a match of an extended REGEXP anchored with '^' can start
+ *  with. The input of a multitable pattern begins at the current position,
+ *  so a pattern is run only where the byte there is in the set.
+ *  As for requiredLiteral, whatever the scanner doesn't know gives no set.
+ */
+struct firstByteScanner {
+	const char *p;
+	bool icase;
+	bool failed;
+};
+
+#define addFirstByte(SET,C) ((SET) [(unsigned char) (C) / 8] |= 1 << ((unsigned char) (C) % 8))
+
+static void addFirstChar (struct firstByteScanner *s, unsigned char *set, unsigned char c)
+{
+	if (s->icase && c >= 0x80)
+		s->failed = true;
+	else if (s->icase)
+	{
+		addFirstByte (set, tolower (c));
+		addFirstByte (set, toupper (c));
+	}
+	else
+		addFirstByte (set, c);
+}
+
+static void scanFirstBytesOfBracket (struct firstByteScanner *s, unsigned char *set)
+{
+	static const struct {
+		const char *name;
+		int (* test) (int);
+	} classes [] = {
+		{ "alnum", isalnum }, { "alpha", isalpha }, { "blank", isblank },
+		{ "cntrl", iscntrl }, { "digit", isdigit }, { "graph", isgraph },
+		{ "lower", islower }, { "print", isprint }, { "punct", ispunct },
+		{ "space", isspace }, { "upper", isupper }, { "xdigit", isxdigit },
+	};
+	unsigned char bracket [32] = { 0 };
+	const char *p = s->p + 1;	/* '[' */
+	const char *first;
+	bool negated = false;
+
+	if (*p == '^')
+	{
+		negated = true;
+		p++;
+	}
+	first = p;
+	while (*p != ']' || p == first)
+	{
+		unsigned char c = *p;
+
+		if (c == '\0')
+			goto failed;
+		else if (c == '[' && p [1] == ':')
+		{
+			const char *close = strstr (p + 2, ":]");
+			unsigned int i;
+
+			if (close == NULL)
+				goto failed;
+			for (i = 0; i < ARRAY_SIZE (classes); i++)
+			{
+				if (strlen (classes [i].name) == (size_t) (close - (p + 2))
+					&& strncmp (classes [i].name, p + 2, close - (p + 2)) == 0)
+					break;
+			}
+			if (i == ARRAY_SIZE (classes))
+				goto failed;
+			for (unsigned int b = 0; b < 0x80; b++)
+				if (classes [i].test (b)
+					|| (s->icase && (classes [i].test (tolower (b))
+									 || classes [i].test (toupper (b)))))
+					addFirstByte (bracket, b);
+			/* A non-ASCII character in the class depends on the locale. */
+			for (unsigned int b = 0x80; b < 0x100; b++)
+				addFirstByte (bracket, b);
+			p = close + 2;
+		}
+		else if (c == '[' && (p [1] == '.' || p [1] == '='))
+			goto failed;
+		else if (p [1] == '-' && p [2] != ']' && p [2] != '\0')
+		{
+			unsigned char last = p [2];
+
+			if (c >= 0x80 || last >= 0x80 || last == '[')
+				goto failed;
+			for (unsigned int b = c; b <= last; b++)
+				addFirstChar (s, bracket, b);
+			p += 3;
+		}
+		else
+		{
+			/* Each byte of a multi-byte character is added. */
+			if (c < 0x80)
+				addFirstChar (s, bracket, c);
+			else
+				addFirstByte (bracket, c);
+			p++;
+		}
+	}
+	s->p = p + 1;
+
+	for (unsigned int i = 0; i < 32; i++)
+		set [i] |= negated? (unsigned char) ~bracket [i]: bracket [i];
+	if (negated)
+		for (unsigned int b = 0x80; b < 0x100; b++)
+			addFirstByte (set, b);
+	return;
+
+ failed:
+	s->failed = true;
+}
+
+static bool scanFirstBytesOfAlternation (struct firstByteScanner *s, unsigned char *set,
+										 bool anchored);
+
+/* Return whether the atom and its quantifiers can match an empty string. */
+static bool scanFirstBytesOfPiece (struct firstByteScanner *s, unsigned char *set)
+{
+	bool nullable = false;
+	unsigned char c = *s->p;
+
+	if (c == '(')
+	{
+		s->p++;
+		nullable = scanFirstBytesOfAlternation (s, set, false);
+		if (*s->p != ')')
+		{
+			s->failed = true;
+			return true;
+		}
+		s->p++;
+	}
+	else if (c == '^' || c == '$')
+	{
+		nullable = true;
+		s->p++;
+	}
+	else if (c == '.')
+	{
+		memset (set, 0xff, 32);
+		s->p++;
+	}
+	else if (c == '[')
+		scanFirstBytesOfBracket (s, set);
+	else if (c == '\\')
+	{
+		c = s->p [1];
+		/* \w, \1, \<, \`, ... are operators in GNU regex. */
+		if (c == '\0' || c >= 0x80 || isalnum (c) || strchr ("<>`'", c))
+		{
+			s->failed = true;
+			return true;
+		}
+		addFirstChar (s, set, c);
+		s->p += 2;
+	}
+	else if (c == '*' || c == '+' || c == '?' || c == '{')
+	{
+		s->failed = true;
+		return true;
+	}
+	else
+	{
+		addFirstChar (s, set, c);
+		s->p++;
+	}
+
+	for (;;)
+	{
+		c = *s->p;
+		if (c == '*' || c == '?')
+		{
+			nullable = true;
+			s->p++;
+		}
+		else if (c == '+')
+			s->p++;
+		else if (c == '{')
+		{
+			const char *close = strchr (s->p, '}');
+
+			if (close == NULL || !isdigit ((unsigned char) s->p [1]))
+			{
+				s->failed = true;
+				return true;
+			}
+			if (atoi (s->p + 1) == 0)
+				nullable = true;
+			s->p = close + 1;
+		}
+		else
+			break;
+	}
+	return nullable;
+}
+
+/* Return whether the alternation can match an empty string. If ANCHORED,
+ * all the alternatives must start with '^'. */
+static bool scanFirstBytesOfAlternation (struct firstByteScanner *s, unsigned char *set,
+										 bool anchored)
+{
+	bool nullable = false;
+
+	for (;;)
+	{
+		bool prefixNullable = true;
+
+		if (anchored)
+		{
+			if (*s->p != '^')
+			{
+				s->failed = true;
+				return true;
+			}
+			s->p++;
+		}
+
+		while (*s->p != '\0' && *s->p != '|' && *s->p != ')' && !s->failed)
+		{
+			unsigned char piece [32] = { 0 };
+			bool pieceNullable = scanFirstBytesOfPiece (s, piece);
+
+			if (prefixNullable)
+				for (unsigned int i = 0; i < 32; i++)
+					set [i] |= piece [i];
+			prefixNullable = prefixNullable && pieceNullable;
+		}
+		nullable = nullable || prefixNullable;
+
+		if (s->failed || *s->p != '|')
+			break;
+		s->p++;
+	}
+	return nullable;
+}
+
+static unsigned char *firstBytes (const char *const regexp, int flags)
+{
+	struct firstByteScanner s = {
+		.p = regexp,
+		.icase = (flags & REG_ICASE),
+		.failed = false,
+	};
+	unsigned char set [32] = { 0 };
+	bool nullable;
+
+	/* With REG_NEWLINE, '^' matches after a newline, too. */
+	if (!(flags & REG_EXTENDED) || (flags & REG_NEWLINE))
+		return NULL;
+
+	nullable = scanFirstBytesOfAlternation (&s, set, true);
+	if (s.failed || nullable || *s.p != '\0')
+		return NULL;
+
+	unsigned char *r = eMalloc (sizeof (set));
+	memcpy (r, set, sizeof (set));
+	return r;
+}
+#undef addFirstByte
+
 static regexCompiledCode compile (struct regexBackend *backend,
 								  const char *const regexp,
 								  int flags);
 static void delete_code (void *code);
 static void set_icase_flag (int *flags);
+static regexCompiledCode compile_matcher (struct regexBackend *backend,
+										  const tagRegexMatcher *matcher,
+										  const char *const regexp,
+										  int flags);
+static int match_matcher (struct regexBackend *backend,
+						  void *code, const char *input, size_t size,
+						  regmatch_t pmatch[BACK_REFERENCE_COUNT]);
+static void delete_matcher (void *code);
 
 /*
 *    DATA DEFINITIONS
@@ -41,6 +317,19 @@ static struct regexBackend defaultRegexBackend = {
 	.compile = compile,
 	.match = match,
 	.delete_code = delete_code,
+	.compile_matcher = compile_matcher,
+};
+
+/* The code of a pattern of this backend is a tagRegexMatcher
+ * generated by misc/optlib2c. */
+static struct regexBackend matcherRegexBackend = {
+	.fdefs = NULL,
+	.fdef_count = 0,
+	.set_icase_flag = set_icase_flag,
+	.compile = compile,
+	.match = match_matcher,
+	.delete_code = delete_matcher,
+	.compile_matcher = compile_matcher,
 };
 
 /*
@@ -96,6 +385,212 @@ static void delete_code (void *code)
 	eFree (regex_code);
 }
 
+/*  Find the longest run of characters every match of REGEXP must include.
+ *  The parser of the pattern is conservative: whatever it doesn't know
+ *  ends the current run, and a pattern having an alternation gets no
+ *  literal at all. Non-ASCII bytes end the run, too; a quantifier
+ *  after a multi-byte character applies to all of its bytes.
+ */
+static char *requiredLiteral (const char *const regexp, int flags)
+{
+	const bool extended = (flags & REG_EXTENDED);
+	vString *run, *best;
+	int depth = 0;
+	char *literal = NULL;
+
+	if (flags & REG_ICASE)
+		return NULL;
+
+	run = vStringNew ();
+	best = vStringNew ();
+
+#define END_RUN() do {								\
+		if (vStringLength (run) > vStringLength (best))	\
+			vStringCopy (best, run);				\
+		vStringClear (run);							\
+	} while (0)
+	/* The previous atom is optional or repeated. */
+#define QUANTIFIER() do {							\
+		if (!vStringIsEmpty (run))					\
+			vStringChop (run);						\
+		END_RUN ();									\
+	} while (0)
+
+	for (const char *p = regexp; *p != '\0'; p++)
+	{
+		const unsigned char c = *p;
+
+		if (c == '\\')
+		{
+			const unsigned char e = *++p;
+
+			if (e == '\0')
+				break;
+			else if (e == '|')
+			{
+				if (!extended)
+					goto unknown;
+				else if (depth == 0)
+					vStringPut (run, e);
+				else
+					END_RUN ();
+			}
+			else if (!extended && e == '(')
+			{
+				END_RUN ();
+				depth++;
+			}
+			else if (!extended && e == ')')
+			{
+				END_RUN ();
+				depth--;
+			}
+			else if (!extended && e == '{')
+			{
+				QUANTIFIER ();
+				while (*p != '\0' && ! (p [0] == '\\' && p [1] == '}'))
+					p++;
+				if (*p == '\0')
+					break;
+				p++;
+			}
+			else if (!extended && (e == '+' || e == '?'))
+				QUANTIFIER ();
+			else if (depth == 0 && strchr (".[]()*+?{}|^$\\/", e))
+				vStringPut (run, e);
+			else
+				END_RUN ();	/* \w, \<, \1, ... */
+		}
+		else if (c == '[')
+		{
+			END_RUN ();
+			p++;
+			if (*p == '^')
+				p++;
+			if (*p == ']')
+				p++;
+			while (*p != '\0' && *p != ']')
+			{
+				if (*p == '[' && (p [1] == ':' || p [1] == '.' || p [1] == '='))
+				{
+					const char *close = strchr (p + 2, p [1]);
+					while (close && close [1] != ']')
+						close = strchr (close + 1, p [1]);
+					if (close == NULL)
+						goto unknown;
+					p = close + 2;
+				}
+				else
+					p++;
+			}
+			if (*p == '\0')
+				goto unknown;
+		}
+		else if (extended && c == '|')
+			goto unknown;
+		else if (extended && c == '(')
+		{
+			END_RUN ();
+			depth++;
+		}
+		else if (extended && c == ')')
+		{
+			END_RUN ();
+			depth--;
+		}
+		else if (extended && c == '{')
+		{
+			QUANTIFIER ();
+			while (*p != '\0' && *p != '}')
+				p++;
+			if (*p == '\0')
+				break;
+		}
+		else if (c == '*' || (extended && (c == '+' || c == '?')))
+			QUANTIFIER ();
+		else if (c == '.' || c == '^' || c == '$' || c >= 0x80
+				 || c == '+' || c == '?' || depth > 0)
+			END_RUN ();
+		else
+			vStringPut (run, c);
+	}
+	END_RUN ();
+
+	if (!vStringIsEmpty (best))
+		literal = vStringStrdup (best);
+ unknown:
+	vStringDelete (run);
+	vStringDelete (best);
+	return literal;
+#undef QUANTIFIER
+#undef END_RUN
+}
+
+/*  Find the string a match of an extended REGEXP anchored with '^' must
+ *  start with, after a run of the bytes of a bracket expression repeated
+ *  with '*' or '+' right after the '^', like "^[ \t]*function". The
+ *  bracket goes to *SKIP, or NULL if there is none. A line of a
+ *  single-line pattern not starting so is rejected without running
+ *  the pattern. As for requiredLiteral, a pattern with an alternation
+ *  or with REG_ICASE gets no prefix.
+ */
+static char *anchoredPrefix (const char *const regexp, int flags, unsigned char **skip)
+{
+	struct firstByteScanner s = {
+		.p = regexp + 1,
+		.icase = false,
+		.failed = false,
+	};
+	unsigned char set [32] = { 0 };
+	bool skipping = false;
+	vString *prefix;
+	char *r = NULL;
+
+	*skip = NULL;
+	if (!(flags & REG_EXTENDED) || (flags & REG_ICASE)
+		|| regexp [0] != '^' || strchr (regexp, '|'))
+		return NULL;
+
+	if (*s.p == '[')
+	{
+		scanFirstBytesOfBracket (&s, set);
+		if (s.failed || (*s.p != '*' && *s.p != '+'))
+			return NULL;
+		s.p++;
+		skipping = true;
+	}
+
+	prefix = vStringNew ();
+	for (const char *p = s.p; *p != '\0'; p++)
+	{
+		unsigned char c = *p;
+
+		if (c == '\\' && p [1] != '\0' && strchr (".[]()*+?{}|^$\\/", p [1]))
+			c = *++p;
+		else if (c >= 0x80 || strchr (".[]()*+?{}|^$\\", c))
+			break;
+		/* The byte is optional or repeated. */
+		if (p [1] != '\0' && strchr ("*+?{", p [1]))
+			break;
+		vStringPut (prefix, c);
+	}
+
+	/* The run before the prefix must end where the prefix starts. */
+	if (!vStringIsEmpty (prefix)
+		&& !(skipping && (set [(unsigned char) vStringChar (prefix, 0) / 8]
+						  & (1 << ((unsigned char) vStringChar (prefix, 0) % 8)))))
+	{
+		r = vStringStrdup (prefix);
+		if (skipping)
+		{
+			*skip = eMalloc (sizeof (set));
+			memcpy (*skip, set, sizeof (set));
+		}
+	}
+	vStringDelete (prefix);
+	return r;
+}
+
 static regexCompiledCode compile (struct regexBackend *backend,
 								  const char *const regexp,
 								  int flags)
@@ -111,17 +606,93 @@ static regexCompiledCode compile (struct regexBackend *backend,
 		eFree (regex_code);
 		return (regexCompiledCode) { .backend = NULL, .code = NULL };
 	}
-	return (regexCompiledCode) { .backend = &defaultRegexBackend, .code = regex_code };
+	regexCompiledCode cp = { .backend = &defaultRegexBackend, .code = regex_code,
+							 .literal = requiredLiteral (regexp, flags),
+							 .firstBytes = firstBytes (regexp, flags) };
+	cp.prefix = anchoredPrefix (regexp, flags, &cp.prefixSkip);
+#ifdef HAVE_PCRE2
+	if (Option.promoteRegex != REGEX_PROMOTION_NO)
+		cp = pcre2_promote_posix_code (cp, regexp, flags,
+									   Option.promoteRegex == REGEX_PROMOTION_VERIFY);
+#endif
+	return cp;
 }
 
 static int match (struct regexBackend *backend,
-				  void *code, const char *input, size_t size CTAGS_ATTR_UNUSED,
+				  void *code, const char *input, size_t size,
 				  regmatch_t pmatch[BACK_REFERENCE_COUNT])
 {
-	return regexec ((regex_t *)code, input, BACK_REFERENCE_COUNT, pmatch, 0);
+	regex_t *regex_code = code;
+	/* Ask only for the groups in the pattern. */
+	size_t nmatch = (regex_code->re_nsub + 1 < BACK_REFERENCE_COUNT)
+		? regex_code->re_nsub + 1
+		: BACK_REFERENCE_COUNT;
+	int r;
+
+#ifdef REG_STARTEND
+	/* Without REG_STARTEND, regexec calls strlen. For a multi-line
+	 * pattern, that is a scan to the end of the file for each match. */
+	pmatch [0].rm_so = 0;
+	pmatch [0].rm_eo = size;
+	r = regexec (regex_code, input, nmatch, pmatch, REG_STARTEND);
+#else
+	r = regexec (regex_code, input, nmatch, pmatch, 0);
+#endif
+	if (r == 0)
+		for (size_t i = nmatch; i < BACK_REFERENCE_COUNT; i++)
+			pmatch [i].rm_so = pmatch [i].rm_eo = -1;
+	return r;
 }
 
 static void set_icase_flag (int *flags)
 {
 	*flags |= REG_ICASE;
 }
+
+static regexCompiledCode compile_matcher (struct regexBackend *backend,
+										  const tagRegexMatcher *matcher,
+										  const char *const regexp,
+										  int flags)
+{
+	/* A matcher is generated for the default flags of the pattern; the
+	 * flags given at runtime may differ, e.g. {basic}. */
+	if (!(flags & REG_EXTENDED)
+		|| matcher->newline != !!(flags & REG_NEWLINE)
+		|| matcher->icase != !!(flags & REG_ICASE))
+		return compile (backend, regexp, flags);
+
+	regexCompiledCode cp = { .backend = &matcherRegexBackend,
+							 .code = (void *) matcher,
+							 .literal = requiredLiteral (regexp, flags),
+							 .firstBytes = firstBytes (regexp, flags) };
+	cp.prefix = anchoredPrefix (regexp, flags, &cp.prefixSkip);
+	return cp;
+}
+
+static int match_matcher (struct regexBackend *backend,
+						  void *code, const char *input, size_t size,
+						  regmatch_t pmatch[BACK_REFERENCE_COUNT])
+{
+	const tagRegexMatcher *matcher = code;
+	regexSpan groups [BACK_REFERENCE_COUNT];
+	size_t ngroups = (matcher->groups + 1 < BACK_REFERENCE_COUNT)
+		? matcher->groups + 1
+		: BACK_REFERENCE_COUNT;
+
+	for (size_t i = 0; i < ngroups; i++)
+		groups [i].start = groups [i].end = -1;
+	if (!matcher->match (input, size, groups))
+		return REG_NOMATCH;
+
+	for (size_t i = 0; i < BACK_REFERENCE_COUNT; i++)
+	{
+		pmatch [i].rm_so = (i < ngroups)? groups [i].start: -1;
+		pmatch [i].rm_eo = (i < ngroups)? groups [i].end: -1;
+	}
+	return 0;
+}
+
+static void delete_matcher (void *code CTAGS_ATTR_UNUSED)
+{
+	/* The matcher is static data of the parser. */
+}
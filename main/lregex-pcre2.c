@@ -23,10 +23,50 @@
 #endif
 
 #include "lregex_p.h"
+#include "options.h"
+#include "routines.h"
 #include "trashbox.h"
+#include "vstring.h"
 
+#include <ctype.h>
 #include <string.h>
 
+/*
+*    MACROS
+*/
+
+/* The stack for the machine code compiled by JIT. 32K is the size
+ * pcre2_match uses when no stack is given. */
+#define JIT_STACK_START_SIZE (32 * 1024)
+#define JIT_STACK_MAX_SIZE   (512 * 1024)
+
+/*
+*    DATA DECLARATIONS
+*/
+struct pcre2Code {
+	pcre2_code *code;
+	bool jit;				/* compiled to machine code with pcre2_jit_compile */
+	pcre2_match_data *match_data;	/* sized for the groups in the pattern */
+	uint32_t pairs;			/* the number of the pairs in match_data */
+};
+
+/* A Posix extended pattern compiled with both the backends for
+ * --promote-regex=verify. */
+struct verifiedCode {
+	regexCompiledCode posix;
+	struct pcre2Code *pcode;
+	char *regexp;
+	bool reported;			/* a mismatch is reported once */
+};
+
+/* An atom of a pattern being promoted: a byte, '.', or a bracket
+ * expression, with its quantifier. */
+struct promotedAtom {
+	unsigned char set [32];	/* the bytes the atom matches */
+	bool nullable;			/* the quantifier allows no repetition */
+	bool varying;			/* the number of repetitions is not fixed */
+};
+
 /*
 *    FUNCTION DECLARATIONS
 */
@@ -38,6 +78,10 @@ static regexCompiledCode compile (struct regexBackend *backend,
 								  int flags);
 static void delete_code (void *code);
 static void set_icase_flag (int *flags);
+static int match_verified (struct regexBackend *backend,
+						   void *code, const char *input, size_t size,
+						   regmatch_t pmatch[BACK_REFERENCE_COUNT]);
+static void delete_verified (void *code);
 
 /*
 *    DATA DEFINITIONS
@@ -51,6 +95,16 @@ static struct regexBackend pcre2RegexBackend = {
 	.delete_code = delete_code,
 };
 
+/* The code of a pattern of this backend is a verifiedCode. */
+static struct regexBackend verifiedRegexBackend = {
+	.fdefs = NULL,
+	.fdef_count = 0,
+	.set_icase_flag = set_icase_flag,
+	.compile = compile,
+	.match = match_verified,
+	.delete_code = delete_verified,
+};
+
 /*
 *    FUNCTOIN DEFINITIONS
 */
@@ -77,7 +131,36 @@ extern void pcre2_regex_flag_long (const char* const s, const char* const unused
 
 static void delete_code (void *code)
 {
-	pcre2_code_free (code);
+	struct pcre2Code *pcode = code;
+
+	pcre2_match_data_free (pcode->match_data);
+	pcre2_code_free (pcode->code);
+	eFree (pcode);
+}
+
+static struct pcre2Code *compile_pcode (const char *const regexp, uint32_t flags,
+										int *errornumber, PCRE2_SIZE *erroroffset)
+{
+	pcre2_code *regex_code = pcre2_compile((PCRE2_SPTR)regexp,
+										   PCRE2_ZERO_TERMINATED,
+										   flags,
+										   errornumber,
+										   erroroffset,
+										   NULL);
+	if (regex_code == NULL)
+		return NULL;
+
+	struct pcre2Code *pcode = xMalloc (1, struct pcre2Code);
+	pcode->code = regex_code;
+	/* pcre2_jit_compile fails if pcre2 is built without JIT, or JIT is not
+	 * available on the platform. The interpreter is used then. */
+	pcode->jit = (pcre2_jit_compile (regex_code, PCRE2_JIT_COMPLETE) == 0);
+
+	uint32_t captures = 0;
+	pcre2_pattern_info (regex_code, PCRE2_INFO_CAPTURECOUNT, &captures);
+	pcode->pairs = (captures + 1 < BACK_REFERENCE_COUNT)? captures + 1: BACK_REFERENCE_COUNT;
+	pcode->match_data = pcre2_match_data_create (pcode->pairs, NULL);
+	return pcode;
 }
 
 static regexCompiledCode compile (struct regexBackend *backend,
@@ -86,13 +169,9 @@ static regexCompiledCode compile (struct regexBackend *backend,
 {
 	int errornumber;
 	PCRE2_SIZE erroroffset;
-	pcre2_code *regex_code = pcre2_compile((PCRE2_SPTR)regexp,
-										   PCRE2_ZERO_TERMINATED,
-										   (uint32_t) flags,
-										   &errornumber,
-										   &erroroffset,
-										   NULL);
-	if (regex_code == NULL)
+	struct pcre2Code *pcode = compile_pcode (regexp, (uint32_t) flags,
+											 &errornumber, &erroroffset);
+	if (pcode == NULL)
 	{
 		PCRE2_UCHAR buffer[256];
 		pcre2_get_error_message(errornumber, buffer, sizeof(buffer));
@@ -100,34 +179,61 @@ static regexCompiledCode compile (struct regexBackend *backend,
 			   buffer);
 		return (regexCompiledCode) { .backend = NULL, .code = NULL };
 	}
-	return (regexCompiledCode) { .backend = &pcre2RegexBackend, .code = regex_code };
+	return (regexCompiledCode) { .backend = &pcre2RegexBackend, .code = pcode };
 }
 
-static int match (struct regexBackend *backend,
-				  void *code, const char *input, size_t size,
-				  regmatch_t pmatch[BACK_REFERENCE_COUNT])
+static pcre2_match_context *get_jit_match_context (void)
 {
-	static pcre2_match_data *match_data;
-	if (match_data == NULL)
+	static pcre2_match_context *match_context;
+	static pcre2_jit_stack *jit_stack;
+
+	if (match_context == NULL)
 	{
-		match_data = pcre2_match_data_create (BACK_REFERENCE_COUNT, NULL);
-		DEFAULT_TRASH_BOX (match_data, pcre2_match_data_free);
+		match_context = pcre2_match_context_create (NULL);
+		DEFAULT_TRASH_BOX (match_context, pcre2_match_context_free);
+		jit_stack = pcre2_jit_stack_create (JIT_STACK_START_SIZE,
+											JIT_STACK_MAX_SIZE, NULL);
+		if (jit_stack)
+		{
+			DEFAULT_TRASH_BOX (jit_stack, pcre2_jit_stack_free);
+			pcre2_jit_stack_assign (match_context, NULL, jit_stack);
+		}
 	}
+	return match_context;
+}
 
-	int rc = pcre2_match (code, (PCRE2_SPTR)input, size,
-						  0, 0, match_data, NULL);
+static int match (struct regexBackend *backend,
+				  void *code, const char *input, size_t size,
+				  regmatch_t pmatch[BACK_REFERENCE_COUNT])
+{
+	struct pcre2Code *pcode = code;
+	pcre2_match_data *match_data = pcode->match_data;
+	int rc = PCRE2_ERROR_JIT_BADOPTION;
+	if (pcode->jit)
+		rc = pcre2_jit_match (pcode->code, (PCRE2_SPTR)input, size,
+							  0, 0, match_data, get_jit_match_context ());
+	/* Retry with the interpreter if the JIT stack is exhausted. */
+	if (rc == PCRE2_ERROR_JIT_BADOPTION || rc == PCRE2_ERROR_JIT_STACKLIMIT)
+		rc = pcre2_match (pcode->code, (PCRE2_SPTR)input, size,
+						  0, PCRE2_NO_JIT, match_data, NULL);
+	/* 0 means all the pairs are used, and there are more groups. */
+	if (rc == 0)
+		rc = pcode->pairs;
 	if (rc > 0)
 	{
 		PCRE2_SIZE *ovector = pcre2_get_ovector_pointer(match_data);
 		if (ovector[0] <= ovector[1])
 		{
-			memset (pmatch, 0, sizeof(pmatch[0]) * BACK_REFERENCE_COUNT);
-			for (int i = 0; i < BACK_REFERENCE_COUNT; i++)
-			{
-				pmatch [i].rm_so = (i < rc)? ovector [2*i]  : -1;
-				pmatch [i].rm_eo = (i < rc)? ovector [2*i+1]: -1;
+			int i;
 
+			/* An unset group in the RC pairs is PCRE2_UNSET, -1 as regoff_t. */
+			for (i = 0; i < rc; i++)
+			{
+				pmatch [i].rm_so = ovector [2*i];
+				pmatch [i].rm_eo = ovector [2*i+1];
 			}
+			for (; i < BACK_REFERENCE_COUNT; i++)
+				pmatch [i].rm_so = pmatch [i].rm_eo = -1;
 			return 0;
 		}
 	}
@@ -138,3 +244,416 @@ static void set_icase_flag (int *flags)
 {
 	*flags |= PCRE2_CASELESS;
 }
+
+/*
+*    Promotion of Posix extended patterns
+*
+*    Posix regexec finds the leftmost longest match, and PCRE2 the first
+*    match its backtracking reaches. They agree on a pattern where the
+*    path of a match is fixed by the input: no alternation, quantifiers
+*    only on single-byte atoms, and no quantified atom sharing a byte
+*    with what can follow it. Then at each byte there is at most one way
+*    to go on, the greedy PCRE2 match takes it as far as it goes, and the
+*    two agree on the span of the match and of each group.
+*
+*    The pattern is written again for PCRE2 with the bytes as \xHH, so
+*    the differences in escaping don't matter. Whatever the translator
+*    doesn't know keeps the pattern in the Posix backend.
+*/
+#define addPromotedByte(SET,C) ((SET) [(unsigned char) (C) / 8] |= 1 << ((unsigned char) (C) % 8))
+
+static void addPromotedChar (unsigned char *set, unsigned char c, bool icase)
+{
+	addPromotedByte (set, c);
+	if (icase && c < 0x80)
+	{
+		addPromotedByte (set, tolower (c));
+		addPromotedByte (set, toupper (c));
+	}
+}
+
+static void catPromotedByte (vString *out, unsigned char c)
+{
+	if (isalnum (c) || c == '_')
+		vStringPut (out, c);
+	else
+	{
+		char hex [5];
+		snprintf (hex, sizeof hex, "\\x%02x", c);
+		vStringCatS (out, hex);
+	}
+}
+
+/* Translate the bracket expression at *P. Return false if it cannot be. */
+static bool promoteBracket (const char **p, vString *out, struct promotedAtom *atom,
+							bool icase, bool newline)
+{
+	static const struct {
+		const char *name;
+		int (* test) (int);
+	} classes [] = {
+		{ "alnum", isalnum }, { "alpha", isalpha }, { "blank", isblank },
+		{ "cntrl", iscntrl }, { "digit", isdigit }, { "graph", isgraph },
+		{ "lower", islower }, { "print", isprint }, { "punct", ispunct },
+		{ "space", isspace }, { "upper", isupper }, { "xdigit", isxdigit },
+	};
+	unsigned char bracket [32] = { 0 };
+	const char *q = *p + 1;
+	const char *first;
+	bool negated = false;
+
+	vStringPut (out, '[');
+	if (*q == '^')
+	{
+		negated = true;
+		vStringPut (out, '^');
+		/* In Posix, a newline doesn't match a negated bracket with
+		   REG_NEWLINE. */
+		if (newline)
+			vStringCatS (out, "\\x0a");
+		q++;
+	}
+	first = q;
+	while (*q != ']' || q == first)
+	{
+		unsigned char c = *q;
+
+		if (c == '\0')
+			return false;
+		else if (c == '[' && q [1] == ':')
+		{
+			const char *close = strstr (q + 2, ":]");
+			unsigned int i;
+
+			if (close == NULL)
+				return false;
+			for (i = 0; i < ARRAY_SIZE (classes); i++)
+			{
+				if (strlen (classes [i].name) == (size_t) (close - (q + 2))
+					&& strncmp (classes [i].name, q + 2, close - (q + 2)) == 0)
+					break;
+			}
+			if (i == ARRAY_SIZE (classes))
+				return false;
+			for (unsigned int b = 0; b < 0x80; b++)
+				if (classes [i].test (b))
+					addPromotedChar (bracket, b, icase);
+			vStringNCatS (out, q, close + 2 - q);
+			q = close + 2;
+		}
+		else if (c == '[' && (q [1] == '.' || q [1] == '='))
+			return false;
+		else if (q [1] == '-' && q [2] != ']' && q [2] != '\0')
+		{
+			unsigned char last = q [2];
+
+			if (c >= 0x80 || last >= 0x80 || last == '[' || c > last)
+				return false;
+			for (unsigned int b = c; b <= last; b++)
+				addPromotedChar (bracket, b, icase);
+			catPromotedByte (out, c);
+			vStringPut (out, '-');
+			catPromotedByte (out, last);
+			q += 3;
+		}
+		else
+		{
+			addPromotedChar (bracket, c, icase);
+			catPromotedByte (out, c);
+			q++;
+		}
+	}
+	vStringPut (out, ']');
+	*p = q + 1;
+
+	for (unsigned int i = 0; i < 32; i++)
+		atom->set [i] = negated? (unsigned char) ~bracket [i]: bracket [i];
+	if (negated && newline)
+		atom->set ['\n' / 8] &= ~(1 << ('\n' % 8));
+	return true;
+}
+
+/* Translate the quantifier at *P, if any. Return false if it cannot be. */
+static bool promoteQuantifier (const char **p, vString *out, struct promotedAtom *atom)
+{
+	const char *q = *p;
+	unsigned long min, max;
+	bool bounded = true;
+	char *end;
+	char interval [48];
+
+	if (*q == '*' || *q == '+' || *q == '?')
+	{
+		atom->nullable = (*q != '+');
+		atom->varying = true;
+		vStringPut (out, *q);
+		q++;
+	}
+	else if (*q == '{')
+	{
+		q++;
+		if (*q == ',')
+			min = 0;		/* {,n} of GNU regex */
+		else if (isdigit ((unsigned char) *q))
+		{
+			min = strtoul (q, &end, 10);
+			q = end;
+		}
+		else
+			return false;
+		max = min;
+		if (*q == ',')
+		{
+			q++;
+			if (isdigit ((unsigned char) *q))
+			{
+				max = strtoul (q, &end, 10);
+				q = end;
+			}
+			else
+				bounded = false;
+		}
+		if (*q != '}' || (bounded && max < min))
+			return false;
+		q++;
+		atom->nullable = (min == 0);
+		atom->varying = !bounded || max != min;
+		if (!bounded)
+			snprintf (interval, sizeof interval, "{%lu,}", min);
+		else
+			snprintf (interval, sizeof interval, "{%lu,%lu}", min, max);
+		vStringCatS (out, interval);
+	}
+	else
+		return true;
+
+	/* A quantifier after a quantifier means something else in PCRE2. */
+	if (*q == '*' || *q == '+' || *q == '?' || *q == '{')
+		return false;
+	*p = q;
+	return true;
+}
+
+/* Check that no quantified atom shares a byte with what can follow it.
+ * With REG_NEWLINE, '$' at the end can follow an atom with a newline. */
+static bool arePromotedAtomsDisjoint (const struct promotedAtom *atoms, unsigned int count,
+									  bool dollar, bool newline)
+{
+	for (unsigned int i = 0; i < count; i++)
+	{
+		unsigned char follow [32] = { 0 };
+		unsigned int j;
+
+		if (!atoms [i].varying)
+			continue;
+		for (j = i + 1; j < count; j++)
+		{
+			for (unsigned int k = 0; k < 32; k++)
+				follow [k] |= atoms [j].set [k];
+			if (!atoms [j].nullable)
+				break;
+		}
+		if (j == count && dollar && newline)
+			addPromotedByte (follow, '\n');
+		for (unsigned int k = 0; k < 32; k++)
+			if (follow [k] & atoms [i].set [k])
+				return false;
+	}
+	return true;
+}
+
+/* Write REGEXP, a Posix extended pattern, for PCRE2 if both of them
+ * match it the same. Return NULL if not. */
+static vString *promotePattern (const char *const regexp, int flags, uint32_t *pflags)
+{
+	const bool icase = (flags & REG_ICASE);
+	const bool newline = (flags & REG_NEWLINE);
+	struct promotedAtom *atoms = NULL;
+	unsigned int count = 0, depth = 0;
+	bool dollar = false;
+	vString *out = vStringNew ();
+	const char *p = regexp;
+
+	/* The newline convention of the library may be CRLF or ANY. */
+	vStringCatS (out, "(*LF)");
+	*pflags = newline? (PCRE2_MULTILINE | PCRE2_ALT_CIRCUMFLEX)
+		: (PCRE2_DOTALL | PCRE2_DOLLAR_ENDONLY);
+	if (icase)
+		*pflags |= PCRE2_CASELESS;
+
+	if (*p == '^')
+	{
+		vStringPut (out, '^');
+		p++;
+	}
+
+	while (*p != '\0')
+	{
+		struct promotedAtom atom = { .nullable = false, .varying = false };
+		unsigned char c = *p;
+
+		if (c == '(')
+		{
+			vStringPut (out, '(');
+			depth++;
+			p++;
+			continue;
+		}
+		else if (c == ')')
+		{
+			if (depth == 0)
+				goto failed;
+			vStringPut (out, ')');
+			depth--;
+			p++;
+			/* The groups are not quantified. */
+			if (*p == '*' || *p == '+' || *p == '?' || *p == '{')
+				goto failed;
+			continue;
+		}
+		else if (c == '$' && p [1] == '\0' && depth == 0)
+		{
+			vStringPut (out, '$');
+			dollar = true;
+			p++;
+			continue;
+		}
+		else if (c == '|' || c == '^' || c == '$'
+				 || c == '*' || c == '+' || c == '?' || c == '{')
+			goto failed;
+		else if (c == '.')
+		{
+			memset (atom.set, 0xff, sizeof (atom.set));
+			if (newline)
+			{
+				atom.set ['\n' / 8] &= ~(1 << ('\n' % 8));
+				vStringCatS (out, "[^\\x0a]");
+			}
+			else
+				vStringPut (out, '.');
+			p++;
+		}
+		else if (c == '[')
+		{
+			if (!promoteBracket (&p, out, &atom, icase, newline))
+				goto failed;
+		}
+		else if (c == '\\')
+		{
+			c = p [1];
+			/* \w, \1, \<, \`, ... are operators in GNU regex. */
+			if (c == '\0' || c >= 0x80 || isalnum (c) || strchr ("<>`'", c))
+				goto failed;
+			addPromotedChar (atom.set, c, icase);
+			catPromotedByte (out, c);
+			p += 2;
+		}
+		else
+		{
+			addPromotedChar (atom.set, c, icase);
+			catPromotedByte (out, c);
+			p++;
+		}
+
+		if (!promoteQuantifier (&p, out, &atom))
+			goto failed;
+		atoms = xRealloc (atoms, count + 1, struct promotedAtom);
+		atoms [count++] = atom;
+	}
+
+	if (depth == 0 && arePromotedAtomsDisjoint (atoms, count, dollar, newline))
+	{
+		if (atoms)
+			eFree (atoms);
+		return out;
+	}
+
+ failed:
+	if (atoms)
+		eFree (atoms);
+	vStringDelete (out);
+	return NULL;
+}
+#undef addPromotedByte
+
+extern regexCompiledCode pcre2_promote_posix_code (regexCompiledCode posix,
+												   const char *const regexp,
+												   int flags, bool verify)
+{
+	uint32_t pflags;
+	vString *pattern;
+	struct pcre2Code *pcode = NULL;
+	int errornumber;
+	PCRE2_SIZE erroroffset;
+
+	if (!(flags & REG_EXTENDED))
+		return posix;
+
+	pattern = promotePattern (regexp, flags, &pflags);
+	if (pattern)
+	{
+		pcode = compile_pcode (vStringValue (pattern), pflags,
+							   &errornumber, &erroroffset);
+		vStringDelete (pattern);
+	}
+	if (pcode == NULL)
+	{
+		verbose ("Not promoting regex to pcre2: %s\n", regexp);
+		return posix;
+	}
+	verbose ("Promoting regex to pcre2: %s\n", regexp);
+
+	regexCompiledCode cp = posix;
+	if (verify)
+	{
+		struct verifiedCode *vcode = xMalloc (1, struct verifiedCode);
+
+		vcode->posix = posix;
+		vcode->pcode = pcode;
+		vcode->regexp = eStrdup (regexp);
+		vcode->reported = false;
+		cp.backend = &verifiedRegexBackend;
+		cp.code = vcode;
+	}
+	else
+	{
+		posix.backend->delete_code (posix.code);
+		cp.backend = &pcre2RegexBackend;
+		cp.code = pcode;
+	}
+	return cp;
+}
+
+static int match_verified (struct regexBackend *backend,
+						   void *code, const char *input, size_t size,
+						   regmatch_t pmatch[BACK_REFERENCE_COUNT])
+{
+	struct verifiedCode *vcode = code;
+	regmatch_t promoted [BACK_REFERENCE_COUNT];
+	int r = vcode->posix.backend->match (vcode->posix.backend, vcode->posix.code,
+										 input, size, pmatch);
+	int pr = match (&pcre2RegexBackend, vcode->pcode, input, size, promoted);
+	bool same = ((r == 0) == (pr == 0));
+
+	for (unsigned int i = 0; same && r == 0 && i < BACK_REFERENCE_COUNT; i++)
+		same = (pmatch [i].rm_so == promoted [i].rm_so
+				&& pmatch [i].rm_eo == promoted [i].rm_eo);
+
+	if (!same && !vcode->reported)
+	{
+		error (WARNING, "pcre2 matches the promoted regex differently: %s",
+			   vcode->regexp);
+		vcode->reported = true;
+	}
+	return r;
+}
+
+static void delete_verified (void *code)
+{
+	struct verifiedCode *vcode = code;
+
+	vcode->posix.backend->delete_code (vcode->posix.code);
+	delete_code (vcode->pcode);
+	eFree (vcode->regexp);
+	eFree (vcode);
+}
@@ -33,6 +33,7 @@
 #include "flags_p.h"
 #include "htable.h"
 #include "kind.h"
+#include "litset_p.h"
 #include "options.h"
 #include "optscript.h"
 #include "parse_p.h"
@@ -139,7 +140,12 @@ struct mTableActionSpec {
 };
 
 typedef struct {
+	/* pattern.code is NULL until the pattern is used first.
+	 * See compilePattern(). */
 	regexCompiledCode pattern;
+	char *regex_source;			/* NULL after compiling */
+	int regex_flags;
+	const tagRegexMatcher *matcher;	/* generated by misc/optlib2c */
 	enum pType type;
 	bool exclusive;
 	bool accept_empty_name;
@@ -191,6 +197,8 @@ typedef struct {
 	struct {
 		unsigned int match;
 		unsigned int unmatch;
+		unsigned int skip;		/* unmatched without running the pattern */
+		unsigned int reject;	/* skipped for the anchored prefix */
 	} statistics;
 } regexTableEntry;
 
@@ -228,6 +236,12 @@ struct lregexControlBlock {
 	int currentScope;
 	ptrArray *entries [2];
 
+	/* The required literals of entries [REG_PARSER_SINGLE_LINE], built
+	 * when a line is matched first. literalFound [N] tells whether the
+	 * literal of the Nth entry is in the current line. */
+	literalSet *literals;
+	bool *literalFound;
+
 	ptrArray *tables;
 	ptrArray *tstack;
 
@@ -329,7 +343,18 @@ static void deletePattern (regexPattern *p)
 	if (p->refcount > 0)
 		return;
 
-	p->pattern.backend->delete_code (p->pattern.code);
+	if (p->pattern.code)
+		p->pattern.backend->delete_code (p->pattern.code);
+	if (p->regex_source)
+		eFree (p->regex_source);
+	if (p->pattern.literal)
+		eFree (p->pattern.literal);
+	if (p->pattern.firstBytes)
+		eFree (p->pattern.firstBytes);
+	if (p->pattern.prefix)
+		eFree (p->pattern.prefix);
+	if (p->pattern.prefixSkip)
+		eFree (p->pattern.prefixSkip);
 
 	if (p->type == PTRN_TAG)
 	{
@@ -359,8 +384,23 @@ static void deletePattern (regexPattern *p)
 	eFree (p);
 }
 
+static void invalidateLiteralSet (struct lregexControlBlock *lcb)
+{
+	if (lcb->literals)
+	{
+		literalSetDelete (lcb->literals);
+		lcb->literals = NULL;
+	}
+	if (lcb->literalFound)
+	{
+		eFree (lcb->literalFound);
+		lcb->literalFound = NULL;
+	}
+}
+
 static void clearPatternSet (struct lregexControlBlock *lcb)
 {
+	invalidateLiteralSet (lcb);
 	ptrArrayClear (lcb->entries [REG_PARSER_SINGLE_LINE]);
 	ptrArrayClear (lcb->entries [REG_PARSER_MULTI_LINE]);
 	ptrArrayClear (lcb->tables);
@@ -718,6 +758,10 @@ static regexPattern * newPattern (regexCompiledCode* const pattern,
 
 	ptrn->pattern.backend = pattern->backend;
 	ptrn->pattern.code = pattern->code;
+	ptrn->pattern.literal = pattern->literal;
+	ptrn->pattern.firstBytes = pattern->firstBytes;
+	ptrn->pattern.prefix = pattern->prefix;
+	ptrn->pattern.prefixSkip = pattern->prefixSkip;
 
 	ptrn->exclusive = false;
 	ptrn->postrun = false;
@@ -775,7 +819,11 @@ static regexPattern* addCompiledTagCommon (struct lregexControlBlock *lcb,
 		ptrArrayAdd (table->entries, entry);
 	}
 	else
+	{
 		ptrArrayAdd (lcb->entries[regptype], entry);
+		if (regptype == REG_PARSER_SINGLE_LINE)
+			invalidateLiteralSet (lcb);
+	}
 
 	useRegexMethod(lcb->owner);
 
@@ -1566,8 +1614,8 @@ static struct flagDefsDescriptor choose_backend (const char *flags, enum regexPa
 	return desc;
 }
 
-static regexCompiledCode compileRegex (enum regexParserType regptype,
-									   const char* const regexp, const char* const flags)
+static struct flagDefsDescriptor evalRegexFlags (enum regexParserType regptype,
+												  const char* const flags)
 {
 	struct flagDefsDescriptor desc = choose_backend (flags, regptype, false);
 
@@ -1582,9 +1630,60 @@ static regexCompiledCode compileRegex (enum regexParserType regptype,
 			   ARRAY_SIZE (backendCommonRegexFlagDefs),
 			   &desc);
 
+	return desc;
+}
+
+static regexCompiledCode compileRegex (enum regexParserType regptype,
+									   const char* const regexp, const char* const flags)
+{
+	struct flagDefsDescriptor desc = evalRegexFlags (regptype, flags);
+
 	return desc.backend->compile (desc.backend, regexp, desc.flags);
 }
 
+/* A tag pattern is compiled when it is used first; most of the patterns
+ * defined in optlib files loaded at startup are for languages not found
+ * in the input. TABLE and INDEX are for the warning.
+ * Return false if the pattern cannot be compiled. */
+static bool compilePattern (struct lregexControlBlock *lcb, regexPattern *ptrn,
+							struct regexTable *table, unsigned int index)
+{
+	if (ptrn->pattern.code)
+		return true;
+	if (ptrn->regex_source == NULL)
+		return false;			/* failed already */
+
+	struct regexBackend *backend = ptrn->pattern.backend;
+	regexCompiledCode cp = (ptrn->matcher && backend->compile_matcher)
+		? backend->compile_matcher (backend, ptrn->matcher,
+									ptrn->regex_source, ptrn->regex_flags)
+		: backend->compile (backend, ptrn->regex_source, ptrn->regex_flags);
+	if (cp.code == NULL)
+	{
+		error (WARNING, "pattern: %s", ptrn->regex_source);
+		if (table)
+		{
+			error (WARNING, "table: %s[%u]", table->name, index);
+			error (WARNING, "language: %s", getLanguageName (lcb->owner));
+		}
+		else
+			error (WARNING, "language: %s[%u]", getLanguageName (lcb->owner), index);
+	}
+	else
+	{
+		ptrn->pattern.backend = cp.backend;
+		ptrn->pattern.code = cp.code;
+		ptrn->pattern.literal = cp.literal;
+		ptrn->pattern.firstBytes = cp.firstBytes;
+		ptrn->pattern.prefix = cp.prefix;
+		ptrn->pattern.prefixSkip = cp.prefixSkip;
+	}
+
+	eFree (ptrn->regex_source);
+	ptrn->regex_source = NULL;
+	return (cp.code != NULL);
+}
+
 
 /* If a letter and/or a name are defined in kindSpec, return true. */
 static bool parseKinds (
@@ -1879,12 +1978,14 @@ static void matchTagPattern (struct lregexControlBlock *lcb,
 }
 
 static bool matchCallbackPattern (
-		const vString* const line, const regexPattern* const patbuf,
+		const char* const line, size_t length, const regexPattern* const patbuf,
 		const regmatch_t* const pmatch)
 {
 	regexMatch matches [BACK_REFERENCE_COUNT];
 	unsigned int count = 0;
 	int i;
+	bool r;
+	vString *copy = NULL;
 	for (i = 0  ;  i < BACK_REFERENCE_COUNT  ;  ++i)
 	{
 		matches [i].start  = pmatch [i].rm_so;
@@ -1896,8 +1997,14 @@ static bool matchCallbackPattern (
 		if (pmatch [i].rm_so != -1)
 			count = i + 1;
 	}
-	return patbuf->u.callback.function (vStringValue (line), matches, count,
-				     patbuf->u.callback.userData);
+	/* A line of the post-run pass is a part of the input not terminated
+	 * with '\0'. The callback takes a C string. */
+	if (patbuf->postrun)
+		copy = vStringNewNInit (line, length);
+	r = patbuf->u.callback.function (copy? vStringValue (copy): line, matches, count,
+									 patbuf->u.callback.userData);
+	vStringDelete (copy);
+	return r;
 }
 
 
@@ -1988,9 +2095,27 @@ static bool fillGuestRequest (const char *start,
 	return guestRequestIsFilled (guest_req);
 }
 
+/* Return whether LINE starts with the anchored prefix of CODE. */
+static bool hasAnchoredPrefix (const regexCompiledCode *code,
+							   const char *line, size_t length)
+{
+	const char *p = line;
+	const char *const end = line + length;
+	const size_t prefixLength = strlen (code->prefix);
+
+	if (code->prefixSkip)
+		while (p < end && REGEX_SET_HAS (code->prefixSkip, (unsigned char) *p))
+			p++;
+	return ((size_t) (end - p) >= prefixLength
+			&& memcmp (p, code->prefix, prefixLength) == 0);
+}
+
+/* LITERALFOUND is false if the line doesn't include the required literal
+ * of the pattern. */
 static bool matchRegexPattern (struct lregexControlBlock *lcb,
-							   const vString* const line,
-							   regexTableEntry *entry)
+							   const char* const line, size_t length,
+							   regexTableEntry *entry,
+							   bool literalFound)
 {
 	bool result = false;
 	regmatch_t pmatch [BACK_REFERENCE_COUNT];
@@ -2001,9 +2126,27 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 	if (patbuf->disabled && *(patbuf->disabled))
 		return false;
 
+	/* Compiled in buildLiteralSet(). */
+	if (patbuf->pattern.code == NULL)
+		return false;
+
+	if (!literalFound)
+	{
+		entry->statistics.unmatch++;
+		entry->statistics.skip++;
+		return false;
+	}
+
+	if (patbuf->pattern.prefix
+		&& !hasAnchoredPrefix (&patbuf->pattern, line, length))
+	{
+		entry->statistics.unmatch++;
+		entry->statistics.reject++;
+		return false;
+	}
+
 	match = patbuf->pattern.backend->match (patbuf->pattern.backend,
-											patbuf->pattern.code, vStringValue (line),
-											vStringLength (line),
+											patbuf->pattern.code, line, length,
 											pmatch);
 
 	if (match == 0)
@@ -2011,7 +2154,7 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 		result = true;
 		entry->statistics.match++;
 		scriptWindow window = {
-			.line = vStringValue (line),
+			.line = line,
 			.start = 0,
 			.patbuf = patbuf,
 			.pmatch = pmatch,
@@ -2031,19 +2174,19 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 		}
 
 		if (hasMessage(patbuf))
-			printMessage(lcb->owner, patbuf, 0, vStringValue (line), pmatch);
+			printMessage(lcb->owner, patbuf, 0, line, pmatch);
 
 		if (patbuf->type == PTRN_TAG)
 		{
-			matchTagPattern (lcb, vStringValue (line), patbuf, pmatch, 0,
+			matchTagPattern (lcb, line, patbuf, pmatch, 0,
 							 (patbuf->optscript && hasNameSlot (patbuf))? &window: NULL);
 
 			if (guest->lang.type != GUEST_LANG_UNKNOWN)
 			{
 				unsigned long ln = getInputLineNumber ();
 				long current = getInputFileOffsetForLine (ln);
-				if (fillGuestRequest (vStringValue (line) - current,
-									  vStringValue (line), pmatch, guest, lcb->guest_req))
+				if (fillGuestRequest (line - current,
+									  line, pmatch, guest, lcb->guest_req))
 				{
 					Assert (lcb->guest_req->lang != LANG_AUTO);
 					if (isGuestRequestConsistent(lcb->guest_req))
@@ -2053,7 +2196,7 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 			}
 		}
 		else if (patbuf->type == PTRN_CALLBACK)
-			result = matchCallbackPattern (line, patbuf, pmatch);
+			result = matchCallbackPattern (line, length, patbuf, pmatch);
 		else
 		{
 			Assert ("invalid pattern type" == NULL);
@@ -2065,9 +2208,26 @@ static bool matchRegexPattern (struct lregexControlBlock *lcb,
 	return result;
 }
 
+/* Find the first LITERAL in the LENGTH bytes from S. */
+static const char *findLiteral (const char *s, size_t length,
+								const char *literal, size_t literalLength)
+{
+	const char *const end = s + length;
+
+	while ((size_t) (end - s) >= literalLength
+		   && (s = memchr (s, literal [0], (end - s) - literalLength + 1)) != NULL)
+	{
+		if (memcmp (s, literal, literalLength) == 0)
+			return s;
+		s++;
+	}
+	return NULL;
+}
+
 static bool matchMultilineRegexPattern (struct lregexControlBlock *lcb,
-										const vString* const allLines,
-										regexTableEntry *entry)
+										const char *const input, size_t length,
+										regexTableEntry *entry,
+										unsigned int index)
 {
 	const char *start;
 	const char *current;
@@ -2079,18 +2239,42 @@ static bool matchMultilineRegexPattern (struct lregexControlBlock *lcb,
 	regmatch_t pmatch [BACK_REFERENCE_COUNT];
 	int match = 0;
 	unsigned int delta = 1;
+	const char *literal;
+	size_t literalLength;
+	const char *nextLiteral = NULL;
 
 	Assert (patbuf);
 
 	if (patbuf->disabled && *(patbuf->disabled))
 		return false;
 
-	current = start = vStringValue (allLines);
+	if (!compilePattern (lcb, patbuf, NULL, index))
+		return false;
+	literal = patbuf->pattern.literal;
+	literalLength = literal? strlen (literal): 0;
+
+	current = start = input;
 	do
 	{
+		/* A match from CURRENT includes a LITERAL after CURRENT. The one
+		 * found last is reused until CURRENT passes it, so the input is
+		 * searched for the literal only once. */
+		if (literal && (nextLiteral == NULL || nextLiteral < current))
+		{
+			nextLiteral = findLiteral (current,
+									   length - (current - start),
+									   literal, literalLength);
+			if (nextLiteral == NULL)
+			{
+				entry->statistics.unmatch++;
+				entry->statistics.skip++;
+				break;
+			}
+		}
+
 		match = patbuf->pattern.backend->match (patbuf->pattern.backend,
 												patbuf->pattern.code, current,
-												vStringLength (allLines) - (current - start),
+												length - (current - start),
 												pmatch);
 
 		if (match != 0)
@@ -2164,7 +2348,7 @@ static bool matchMultilineRegexPattern (struct lregexControlBlock *lcb,
 		}
 		current += delta;
 
-	} while (current < start + vStringLength (allLines));
+	} while (current < start + length);
 
 	return result;
 }
@@ -2188,10 +2372,59 @@ extern bool regexIsPostRun (struct lregexControlBlock *lcb)
 	return false;
 }
 
-extern bool matchRegex (struct lregexControlBlock *lcb, const vString* const line, bool postrun)
+static void buildLiteralSet (struct lregexControlBlock *lcb)
+{
+	ptrArray *entries = lcb->entries[REG_PARSER_SINGLE_LINE];
+	unsigned int count = ptrArrayCount (entries);
+
+	lcb->literalFound = xMalloc (count? count: 1, bool);
+	for (unsigned int i = 0; i < count; i++)
+	{
+		regexTableEntry *entry = ptrArrayItem (entries, i);
+
+		/* The literals are known after compiling. */
+		compilePattern (lcb, entry->pattern, NULL, i);
+
+		const char *literal = entry->pattern->pattern.literal;
+
+		/* Without a literal, the pattern is always run. */
+		lcb->literalFound [i] = (literal == NULL);
+		if (literal)
+		{
+			if (lcb->literals == NULL)
+				lcb->literals = literalSetNew ();
+			literalSetAdd (lcb->literals, literal, i);
+		}
+	}
+}
+
+/* Find the required literals of all the patterns in one pass over LINE. */
+static void findLiterals (struct lregexControlBlock *lcb,
+						  const char* const line, size_t length)
+{
+	ptrArray *entries = lcb->entries[REG_PARSER_SINGLE_LINE];
+
+	if (lcb->literalFound == NULL)
+		buildLiteralSet (lcb);
+	if (lcb->literals == NULL)
+		return;
+
+	for (unsigned int i = 0; i < ptrArrayCount (entries); i++)
+	{
+		regexTableEntry *entry = ptrArrayItem (entries, i);
+		if (entry->pattern->pattern.literal)
+			lcb->literalFound [i] = false;
+	}
+	literalSetSearch (lcb->literals, line, length, lcb->literalFound);
+}
+
+extern bool matchRegex (struct lregexControlBlock *lcb,
+						const char* const line, size_t length, bool postrun)
 {
 	bool result = false;
 	unsigned int i;
+
+	findLiterals (lcb, line, length);
 	for (i = 0  ;  i < ptrArrayCount(lcb->entries[REG_PARSER_SINGLE_LINE])  ;  ++i)
 	{
 		regexTableEntry *entry = ptrArrayItem(lcb->entries[REG_PARSER_SINGLE_LINE], i);
@@ -2206,7 +2439,7 @@ extern bool matchRegex (struct lregexControlBlock *lcb, const vString* const lin
 			&& (!isXtagEnabled (ptrn->xtagType)))
 				continue;
 
-		if (matchRegexPattern (lcb, line, entry))
+		if (matchRegexPattern (lcb, line, length, entry, lcb->literalFound [i]))
 		{
 			result = true;
 			if (ptrn->exclusive)
@@ -2216,6 +2449,16 @@ extern bool matchRegex (struct lregexControlBlock *lcb, const vString* const lin
 	return result;
 }
 
+/* A parser having neither a pattern nor a hook never runs optscript
+ * code. Setting up the dictionaries for it is skipped; it matters for
+ * a guest parser run for each of many small areas of a host file. */
+extern bool doesRegexRunScript (struct lregexControlBlock *lcb)
+{
+	return (lregexControlBlockHasAny (lcb)
+			|| ptrArrayCount (lcb->hook[SCRIPT_HOOK_PRELUDE])
+			|| ptrArrayCount (lcb->hook[SCRIPT_HOOK_SEQUEL]));
+}
+
 extern void notifyRegexInputStart (struct lregexControlBlock *lcb)
 {
 	lcb->currentScope = CORK_NIL;
@@ -2223,6 +2466,9 @@ extern void notifyRegexInputStart (struct lregexControlBlock *lcb)
 	ptrArrayClear (lcb->tstack);
 	guestRequestClear (lcb->guest_req);
 
+	if (!doesRegexRunScript (lcb))
+		return;
+
 	opt_vm_dstack_push (optvm, lregex_dict);
 
 	if (es_null (lcb->local_dict))
@@ -2234,10 +2480,13 @@ extern void notifyRegexInputStart (struct lregexControlBlock *lcb)
 
 extern void notifyRegexInputEnd (struct lregexControlBlock *lcb)
 {
-	scriptEvalHook (optvm, lcb, SCRIPT_HOOK_SEQUEL);
-	set_current_lcb (optvm, NULL);
-	opt_vm_clear (optvm, false);
-	opt_dict_clear (lcb->local_dict);
+	if (doesRegexRunScript (lcb))
+	{
+		scriptEvalHook (optvm, lcb, SCRIPT_HOOK_SEQUEL);
+		set_current_lcb (optvm, NULL);
+		opt_vm_clear (optvm, false);
+		opt_dict_clear (lcb->local_dict);
+	}
 	unsigned long endline = getInputLineNumber ();
 	fillEndLineFieldOfUpperScopes (lcb, endline);
 }
@@ -2295,6 +2544,29 @@ extern bool doesExpectCorkInRegex (struct lregexControlBlock *lcb)
 	return false;
 }
 
+extern bool doesRegexLookBeyondLine (struct lregexControlBlock *lcb)
+{
+	ptrArray *entries = lcb->entries[REG_PARSER_SINGLE_LINE];
+
+	if (regexNeedsMultilineBuffer (lcb)
+		|| doesExpectCorkInRegex (lcb)
+		|| ptrArrayCount (lcb->hook[SCRIPT_HOOK_PRELUDE])
+		|| ptrArrayCount (lcb->hook[SCRIPT_HOOK_SEQUEL]))
+		return true;
+
+	for (unsigned int i = 0; i < ptrArrayCount(entries); i++)
+	{
+		regexTableEntry *entry = ptrArrayItem(entries, i);
+		regexPattern *ptrn = entry->pattern;
+
+		if (ptrn->postrun
+			|| ptrn->anonymous_tag_prefix
+			|| ptrn->guest.lang.type != GUEST_LANG_UNKNOWN)
+			return true;
+	}
+	return false;
+}
+
 static char *escapeRegexPattern (const char* pattern)
 {
 	vString *p = vStringNew ();
@@ -2324,7 +2596,8 @@ static regexPattern *addTagRegexInternal (struct lregexControlBlock *lcb,
 					  const char* const name,
 					  const char* const kinds,
 					  const char* const flags,
-					  bool *disabled)
+					  bool *disabled,
+					  const tagRegexMatcher *matcher)
 {
 	Assert (regex != NULL);
 	Assert (name != NULL);
@@ -2332,21 +2605,11 @@ static regexPattern *addTagRegexInternal (struct lregexControlBlock *lcb,
 	if (!regexAvailable)
 		return NULL;
 
-	regexCompiledCode cp = compileRegex (regptype, regex, flags);
-	if (cp.code == NULL)
-	{
-		error (WARNING, "pattern: %s", regex);
-		if (table_index != TABLE_INDEX_UNUSED)
-		{
-			struct regexTable *table = ptrArrayItem (lcb->tables, table_index);
-			error (WARNING, "table: %s[%u]", table->name, ptrArrayCount (table->entries));
-			error (WARNING, "language: %s", getLanguageName (lcb->owner));
-		}
-		else
-			error (WARNING, "language: %s[%u]", getLanguageName (lcb->owner),
-				   ptrArrayCount (lcb->entries[regptype]));
-		return NULL;
-	}
+	struct flagDefsDescriptor desc = evalRegexFlags (regptype, flags);
+	regexCompiledCode cp = {
+		.backend = desc.backend,
+		.code = NULL,
+	};
 
 	char kindLetter;
 	char* kindName;
@@ -2415,6 +2678,9 @@ static regexPattern *addTagRegexInternal (struct lregexControlBlock *lcb,
 												kindLetter, kindName, description, flags,
 												explictly_defined,
 												disabled);
+	rptr->regex_source = eStrdup (regex);
+	rptr->regex_flags = desc.flags;
+	rptr->matcher = matcher;
 	rptr->pattern_string = escapeRegexPattern(regex);
 
 	eFree (kindName);
@@ -2442,18 +2708,21 @@ extern void addTagRegex (struct lregexControlBlock *lcb,
 			 const char* const name,
 			 const char* const kinds,
 			 const char* const flags,
-			 bool *disabled)
+			 bool *disabled,
+			 const tagRegexMatcher *matcher)
 {
 	addTagRegexInternal (lcb, TABLE_INDEX_UNUSED,
-						 REG_PARSER_SINGLE_LINE, regex, name, kinds, flags, disabled);
+						 REG_PARSER_SINGLE_LINE, regex, name, kinds, flags, disabled,
+						 matcher);
 }
 
 extern void addTagMultiLineRegex (struct lregexControlBlock *lcb, const char* const regex,
 								  const char* const name, const char* const kinds, const char* const flags,
-								  bool *disabled)
+								  bool *disabled, const tagRegexMatcher *matcher)
 {
 	regexPattern *ptrn = addTagRegexInternal (lcb, TABLE_INDEX_UNUSED,
-											  REG_PARSER_MULTI_LINE, regex, name, kinds, flags, disabled);
+											  REG_PARSER_MULTI_LINE, regex, name, kinds, flags, disabled,
+											  matcher);
 	if (ptrn->mgroup.forLineNumberDetermination == NO_MULTILINE)
 	{
 		if (hasNameSlot(ptrn))
@@ -2468,7 +2737,7 @@ extern void addTagMultiTableRegex(struct lregexControlBlock *lcb,
 								  const char* const table_name,
 								  const char* const regex,
 								  const char* const name, const char* const kinds, const char* const flags,
-								  bool *disabled)
+								  bool *disabled, const tagRegexMatcher *matcher)
 {
 	int table_index = getTableIndexForName (lcb, table_name);
 
@@ -2476,7 +2745,7 @@ extern void addTagMultiTableRegex(struct lregexControlBlock *lcb,
 		error (FATAL, "unknown table name: %s", table_name);
 
 	addTagRegexInternal (lcb, table_index, REG_PARSER_MULTI_TABLE, regex, name, kinds, flags,
-						 disabled);
+						 disabled, matcher);
 }
 
 extern void addCallbackRegex (struct lregexControlBlock *lcb,
@@ -2555,7 +2824,7 @@ static void addTagRegexOption (struct lregexControlBlock *lcb,
 	if (parseTagRegex (regptype, regex_pat, &name, &kinds, &flags))
 	{
 		regexPattern *ptrn = addTagRegexInternal (lcb, table_index, regptype, regex_pat, name, kinds, flags,
-												  NULL);
+												  NULL, NULL);
 		if (regptype == REG_PARSER_MULTI_LINE
 			&& ptrn->mgroup.forLineNumberDetermination == NO_MULTILINE)
 		{
@@ -2714,7 +2983,20 @@ extern bool regexNeedsMultilineBuffer (struct lregexControlBlock *lcb)
 		return false;
 }
 
-extern bool matchMultilineRegex (struct lregexControlBlock *lcb, const vString* const allLines)
+extern bool canRegexMatchUnterminatedInput (void)
+{
+	/* The pcre2 backend takes the length of the input. The default
+	 * backend does if regexec () accepts REG_STARTEND; it calls strlen
+	 * on the input otherwise. */
+#ifdef REG_STARTEND
+	return true;
+#else
+	return false;
+#endif
+}
+
+extern bool matchMultilineRegex (struct lregexControlBlock *lcb,
+								 const char *const input, size_t length)
 {
 	bool result = false;
 
@@ -2729,7 +3011,7 @@ extern bool matchMultilineRegex (struct lregexControlBlock *lcb, const vString*
 			&& (!isXtagEnabled (entry->pattern->xtagType)))
 			continue;
 
-		result = matchMultilineRegexPattern (lcb, allLines, entry) || result;
+		result = matchMultilineRegexPattern (lcb, input, length, entry, i) || result;
 	}
 	return result;
 }
@@ -2801,14 +3083,16 @@ static void dumpTstack(FILE* fp, ptrArray *tstack)
 	fprintf(fp, "\n");
 }
 
-static void printInputLine(FILE* vfp, const char *c, const off_t offset)
+/* The input ends at END; it is not terminated with '\0'. */
+static void printInputLine(FILE* vfp, const char *c, const char *const end,
+						   const off_t offset)
 {
 	vString *v = vStringNew ();
 
-	for (; *c && (*c != '\n'); c++)
+	for (; c < end && *c && (*c != '\n'); c++)
 		vStringPut(v, *c);
 
-	if (vStringLength (v) == 0 && *c == '\n')
+	if (vStringLength (v) == 0 && c < end && *c == '\n')
 		vStringCatS (v, "\\n");
 
 	fprintf (vfp, "\ninput : \"%s\" L%lu\n",
@@ -2846,29 +3130,31 @@ static void printMultitableMessage(const langType language,
 }
 
 static struct regexTable * matchMultitableRegexTable (struct lregexControlBlock *lcb,
-													  struct regexTable *table, const vString *const start, unsigned int *offset)
+													  struct regexTable *table,
+													  const char *const cstart, size_t length,
+													  unsigned int *offset)
 {
 	struct regexTable *next = NULL;
 	const char *current;
+	const char *const end = cstart + length;
 	regmatch_t pmatch [BACK_REFERENCE_COUNT];
-	const char *cstart = vStringValue(start);
 	unsigned int delta;
 
 
  restart:
 	current = cstart + *offset;
 
-	/* Accept the case *offset == vStringLength(start)
+	/* Accept the case *offset == length
 	   because we want an empty regex // still matches empty input. */
-	if (*offset > vStringLength(start))
+	if (*offset > length)
 	{
-		*offset = vStringLength(start);
+		*offset = length;
 		goto out;
 	}
 
 	BEGIN_VERBOSE(vfp);
 	{
-		printInputLine(vfp, current, *offset);
+		printInputLine(vfp, current, end, *offset);
 	}
 	END_VERBOSE();
 
@@ -2887,7 +3173,12 @@ static struct regexTable * matchMultitableRegexTable (struct lregexControlBlock
 		BEGIN_VERBOSE(vfp);
 		{
 			char s[3];
-			if (*current == '\n')
+			if (current == end)
+			{
+				s [0] = '\0';
+				s [1] = '\0';
+			}
+			else if (*current == '\n')
 			{
 				s [0] = '\\';
 				s [1] = 'n';
@@ -2926,9 +3217,24 @@ static struct regexTable * matchMultitableRegexTable (struct lregexControlBlock
 		if (ptrn->disabled && *(ptrn->disabled))
 			continue;
 
+		if (!compilePattern (lcb, ptrn, table, i))
+			continue;
+
+		/* Most of the patterns in a table fail at the first byte. The
+		 * input is not terminated with '\0'; an empty rest of the input
+		 * is left to the pattern. */
+		if (ptrn->pattern.firstBytes && current < end
+			&& !(ptrn->pattern.firstBytes [(unsigned char) *current / 8]
+				 & (1 << ((unsigned char) *current % 8))))
+		{
+			entry->statistics.unmatch++;
+			entry->statistics.skip++;
+			continue;
+		}
+
 		match = ptrn->pattern.backend->match (ptrn->pattern.backend,
 											  ptrn->pattern.code, current,
-											  vStringLength(start) - (current - cstart),
+											  length - (current - cstart),
 											  pmatch);
 		if (match == 0)
 		{
@@ -3132,6 +3438,41 @@ extern void extendRegexTable (struct lregexControlBlock *lcb, const char *src, c
 	}
 }
 
+extern void printRegexStatistics (struct lregexControlBlock *lcb)
+{
+	ptrArray *entries = lcb->entries [REG_PARSER_SINGLE_LINE];
+
+	if (ptrArrayCount (entries) == 0)
+		return;
+
+	fprintf(stderr, "\nREGEX STATISTICS of %s\n", getLanguageName (lcb->owner));
+	fputs("==============================================\n", stderr);
+	fprintf(stderr, "%21s %10s %10s %s\n", "match/tried", "skipped", "rejected", "pattern");
+	unsigned int match = 0, tried = 0, skip = 0, reject = 0, literals = 0, prefixes = 0;
+	for (unsigned int i = 0; i < ptrArrayCount (entries); i++)
+	{
+		regexTableEntry *entry = ptrArrayItem (entries, i);
+		Assert (entry && entry->pattern);
+		fprintf(stderr, "%10u/%-10u %10u %10u %s\n",
+				entry->statistics.match,
+				entry->statistics.unmatch + entry->statistics.match,
+				entry->statistics.skip,
+				entry->statistics.reject,
+				entry->pattern->pattern_string);
+		match += entry->statistics.match;
+		tried += entry->statistics.unmatch + entry->statistics.match;
+		skip += entry->statistics.skip;
+		reject += entry->statistics.reject;
+		if (entry->pattern->pattern.literal)
+			literals++;
+		if (entry->pattern->pattern.prefix)
+			prefixes++;
+	}
+	fputs("----------------------------------------------\n", stderr);
+	fprintf(stderr, "%10u/%-10u %10u %10u (%u of %u patterns have a literal, %u a prefix)\n",
+			match, tried, skip, reject, literals, ptrArrayCount (entries), prefixes);
+}
+
 extern void printMultitableStatistics (struct lregexControlBlock *lcb)
 {
 	if (ptrArrayCount(lcb->tables) == 0)
@@ -3158,7 +3499,8 @@ extern void printMultitableStatistics (struct lregexControlBlock *lcb)
 	}
 }
 
-extern bool matchMultitableRegex (struct lregexControlBlock *lcb, const vString* const allLines)
+extern bool matchMultitableRegex (struct lregexControlBlock *lcb,
+								  const char *const input, size_t length)
 {
 	if (ptrArrayCount (lcb->tables) == 0)
 		return false;
@@ -3173,7 +3515,7 @@ extern bool matchMultitableRegex (struct lregexControlBlock *lcb, const vString*
 	while (table)
 	{
 		last_offset = offset;
-		table = matchMultitableRegexTable(lcb, table, allLines, &offset);
+		table = matchMultitableRegexTable(lcb, table, input, length, &offset);
 
 		if (last_offset == offset)
 			motionless_counter++;
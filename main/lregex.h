@@ -21,9 +21,33 @@
 */
 #include "general.h"
 
+/*
+*   MACROS
+*/
+/* Whether the byte C is in SET, a bitmap of 32 bytes */
+#define REGEX_SET_HAS(SET,C) ((SET) [(C) >> 3] & (1 << ((C) & 7)))
+
 /*
 *   DATA DECLARATIONS
 */
+/* The span of a group of a match; -1 for a group not matched */
+typedef struct sRegexSpan {
+	long start;
+	long end;
+} regexSpan;
+
+/* A pattern compiled into C by misc/optlib2c. match () matches INPUT of
+ * SIZE bytes as regexec () does with the pattern compiled with
+ * REG_EXTENDED, and with REG_NEWLINE and REG_ICASE as given below. It
+ * sets GROUPS [0] to GROUPS [N] for the match, where N is the smaller
+ * of GROUPS and 9. */
+typedef struct sTagRegexMatcher {
+	bool (* match) (const char *input, size_t size, regexSpan *groups);
+	unsigned int groups;
+	bool newline;
+	bool icase;
+} tagRegexMatcher;
+
 typedef struct sTagRegexTable {
 	const char *const regex;
 	const char* const name;
@@ -31,6 +55,7 @@ typedef struct sTagRegexTable {
 	const char *const flags;
 	bool    *disabled;
 	bool  mline;
+	const tagRegexMatcher *matcher;	/* NULL for compiling REGEX at runtime */
 } tagRegexTable;
 
 typedef struct {
@@ -46,6 +46,18 @@ struct lregexControlBlock;
 typedef struct sRegexCompiledCode {
 	struct regexBackend *backend;
 	void * code;
+	/* A string that must appear in any input matching the pattern,
+	 * or NULL. With it, the pattern is skipped for inputs that don't
+	 * include the string. */
+	char *literal;
+	/* A bitmap of the bytes a match can start with when the pattern is
+	 * matched at the beginning of the input, or NULL if any. */
+	unsigned char *firstBytes;
+	/* A string a match must start with when the pattern is matched
+	 * against a line, after a run of the bytes in the bitmap prefixSkip
+	 * if it is not NULL; or NULL. */
+	char *prefix;
+	unsigned char *prefixSkip;
 } regexCompiledCode;
 
 struct regexBackend {
@@ -60,6 +72,12 @@ struct regexBackend {
 									   void *, const char *, size_t,
 									   regmatch_t[BACK_REFERENCE_COUNT]);
 	void              (* delete_code) (void *);
+	/* Use a matcher generated for the pattern instead of compiling it.
+	 * NULL if the backend cannot. */
+	regexCompiledCode (* compile_matcher) (struct regexBackend *,
+										   const tagRegexMatcher *,
+										   const char* const,
+										   int);
 };
 
 struct flagDefsDescriptor {
@@ -79,22 +97,29 @@ extern void processTagRegexOption (struct lregexControlBlock *lcb,
 								   const char* const parameter);
 extern void addTagRegex (struct lregexControlBlock *lcb, const char* const regex,
 						 const char* const name, const char* const kinds, const char* const flags,
-						 bool *disabled);
+						 bool *disabled, const tagRegexMatcher *matcher);
 extern void addTagMultiLineRegex (struct lregexControlBlock *lcb, const char* const regex,
 								  const char* const name, const char* const kinds, const char* const flags,
-								  bool *disabled);
+								  bool *disabled, const tagRegexMatcher *matcher);
 extern void addTagMultiTableRegex(struct lregexControlBlock *lcb,
 								  const char* const table_name,
 								  const char* const regex,
 								  const char* const name, const char* const kinds, const char* const flags,
-								  bool *disabled);
+								  bool *disabled, const tagRegexMatcher *matcher);
 
 extern bool lregexControlBlockHasAny(struct lregexControlBlock *lcb);
 
-extern bool matchRegex (struct lregexControlBlock *lcb, const vString* const line, bool postrun);
+/* LINE is not terminated with '\0' when POSTRUN is true. */
+extern bool matchRegex (struct lregexControlBlock *lcb,
+						const char* const line, size_t length, bool postrun);
 extern bool regexIsPostRun (struct lregexControlBlock *lcb);
 
 extern bool doesExpectCorkInRegex (struct lregexControlBlock *lcb);
+extern bool doesRegexRunScript (struct lregexControlBlock *lcb);
+/* Whether a pattern depends on the lines other than the one matched:
+ * multiline or multitable patterns, scope actions, scripts, guests,
+ * anonymous names, or patterns run after reading the input. */
+extern bool doesRegexLookBeyondLine (struct lregexControlBlock *lcb);
 extern void addCallbackRegex (struct lregexControlBlock *lcb,
 							  const char* const regex,
 							  const char* const flags,
@@ -102,8 +127,13 @@ extern void addCallbackRegex (struct lregexControlBlock *lcb,
 							  bool *disabled,
 							  void * userData);
 extern bool regexNeedsMultilineBuffer (struct lregexControlBlock *lcb);
-extern bool matchMultilineRegex (struct lregexControlBlock *lcb, const vString* const allLines);
-extern bool matchMultitableRegex (struct lregexControlBlock *lcb, const vString* const allLines);
+/* Whether the multiline and multitable patterns can be matched against
+ * an input not terminated with a NUL byte, like a mapped file. */
+extern bool canRegexMatchUnterminatedInput (void);
+extern bool matchMultilineRegex (struct lregexControlBlock *lcb,
+								 const char *const input, size_t length);
+extern bool matchMultitableRegex (struct lregexControlBlock *lcb,
+								  const char *const input, size_t length);
 
 extern void notifyRegexInputStart (struct lregexControlBlock *lcb);
 extern void notifyRegexInputEnd (struct lregexControlBlock *lcb);
@@ -117,6 +147,7 @@ extern void listRegexOpscriptOperators (FILE *fp);
 extern void addOptscriptToHook (struct lregexControlBlock *lcb, enum scriptHook hook, const char *code);
 extern void propagateParamToOptscript (struct lregexControlBlock *lcb, const char *param, const char *value);
 
+extern void printRegexStatistics (struct lregexControlBlock *lcb);
 extern void printMultitableStatistics (struct lregexControlBlock *lcb);
 
 extern void basic_regex_flag_short (char c, void* data);
@@ -126,6 +157,14 @@ extern void extend_regex_flag_long (const char* const s, const char* const unuse
 #ifdef HAVE_PCRE2
 extern void pcre2_regex_flag_short (char c, void* data);
 extern void pcre2_regex_flag_long (const char* const s, const char* const unused, void* data);
+
+/* Return the code of REGEXP, a pattern compiled to POSIX by the default
+ * backend, for pcre2 if pcre2 matches REGEXP the same. With VERIFY, the
+ * returned code matches with both, and warns if they differ. POSIX is
+ * returned if REGEXP is not promoted. */
+extern regexCompiledCode pcre2_promote_posix_code (regexCompiledCode posix,
+												   const char *const regexp,
+												   int flags, bool verify);
 #endif
 
 #endif	/* CTAGS_MAIN_LREGEX_PRIVATEH */
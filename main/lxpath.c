@@ -12,18 +12,49 @@
 #include "debug.h"
 #include "entry.h"
 #include "lxpath_p.h"
-#include "options.h"
+#include "options_p.h"
 #include "parse_p.h"
 #include "read.h"
 #include "read_p.h"
 #include "routines.h"
 #include "xtag.h"
 
+#include <ctype.h>
+#include <limits.h>
+#include <string.h>
+
 #ifdef HAVE_LIBXML
 #include <libxml/parser.h>
+#include <libxml/xmlreader.h>
 #include <libxml/xpath.h>
 #include <libxml/tree.h>
 
+/* An xpath expression in the subset evaluated without the xpath engine
+ * of libxml2: in the streaming mode (see the comment for the streamable
+ * field of tagXpathTableTable), and in a walk of a DOM evaluating all
+ * the entries of a table at once. The streaming mode takes only
+ * absolute expressions. */
+typedef enum {
+	XPATH_STREAM_ELEMENT,
+	XPATH_STREAM_ATTRIBUTE,
+	XPATH_STREAM_TEXT,
+} xpathStreamStepType;
+
+typedef struct sXpathStreamStep {
+	xpathStreamStepType type;
+	bool descendant;			/* "//" is before the step */
+	bool localName;				/* *[local-name()='NAME'] */
+	char *name;					/* NULL for "*" */
+} xpathStreamStep;
+
+struct sXpathStreamPattern {
+	bool relative;				/* to the context node */
+	unsigned int count;
+	xpathStreamStep *steps;
+};
+
+static bool RunningAfterStreaming;
+
 extern  void updateXMLTagLine (tagEntryInfo *e, xmlNode *node)
 {
 	unsigned long lineNumber = XML_GET_LINE (node);
@@ -77,6 +108,115 @@ out:
 	xmlFree (str);
 }
 
+static void deleteXpathStreamPattern (struct sXpathStreamPattern *pattern)
+{
+	for (unsigned int i = 0; i < pattern->count; i++)
+		eFreeNoNullCheck (pattern->steps [i].name);
+	eFree (pattern->steps);
+	eFree (pattern);
+}
+
+static char *compileXpathStreamName (const char **xpath)
+{
+	const char *start = *xpath;
+	const char *p;
+
+	if (!(isalpha ((unsigned char) *start) || *start == '_'))
+		return NULL;
+	for (p = start; isalnum ((unsigned char) *p) || *p == '_' || *p == '-' || *p == '.'; p++)
+		;
+	*xpath = p;
+	return eStrndup (start, p - start);
+}
+
+/* Return NULL if XPATH is out of the subset evaluated in the streaming mode. */
+static struct sXpathStreamPattern *compileXpathStreamPattern (const char *xpath)
+{
+	static const char localNamePrefix [] = "[local-name()='";
+	struct sXpathStreamPattern *pattern;
+	const char *p = xpath;
+	unsigned int slashes = 0;
+
+	for (const char *q = xpath; *q; q++)
+		slashes += (*q == '/');
+
+	pattern = xMalloc (1, struct sXpathStreamPattern);
+	pattern->relative = (*p != '/');
+	pattern->count = 0;
+	pattern->steps = xCalloc (slashes + 1, xpathStreamStep);
+
+	/* "./NAME" and "NAME" are the same. */
+	if (p [0] == '.' && p [1] == '/')
+		p++;
+
+	while (*p)
+	{
+		xpathStreamStep *step;
+
+		if (pattern->count > 0
+			&& pattern->steps [pattern->count - 1].type != XPATH_STREAM_ELEMENT)
+			goto fail;
+
+		step = pattern->steps + pattern->count++;
+		if (*p == '/')
+		{
+			p++;
+			/* libxml2 reads "///" as "//". */
+			for (; *p == '/'; p++)
+				step->descendant = true;
+		}
+		else if (pattern->count > 1)
+			goto fail;
+
+		if (*p == '@')
+		{
+			step->type = XPATH_STREAM_ATTRIBUTE;
+			p++;
+			step->name = compileXpathStreamName (&p);
+			if (step->name == NULL)
+				goto fail;
+		}
+		else if (strncmp (p, "text()", 6) == 0)
+		{
+			step->type = XPATH_STREAM_TEXT;
+			p += 6;
+			if (step->descendant)
+				goto fail;
+		}
+		else if (*p == '*')
+		{
+			step->type = XPATH_STREAM_ELEMENT;
+			p++;
+			if (strncmp (p, localNamePrefix, sizeof (localNamePrefix) - 1) == 0)
+			{
+				p += sizeof (localNamePrefix) - 1;
+				step->name = compileXpathStreamName (&p);
+				if (step->name == NULL || strncmp (p, "']", 2) != 0)
+					goto fail;
+				p += 2;
+				step->localName = true;
+			}
+		}
+		else
+		{
+			step->type = XPATH_STREAM_ELEMENT;
+			step->name = compileXpathStreamName (&p);
+			if (step->name == NULL)
+				goto fail;
+		}
+	}
+
+	if (pattern->count == 0
+		|| (!pattern->relative && pattern->steps [0].type != XPATH_STREAM_ELEMENT))
+		goto fail;
+
+	return pattern;
+
+ fail:
+	deleteXpathStreamPattern (pattern);
+	return NULL;
+}
+
 extern void addTagXpath (const langType language CTAGS_ATTR_UNUSED, tagXpathTable *xpathTable)
 {
 	Assert (xpathTable->xpath);
@@ -86,6 +226,9 @@ extern void addTagXpath (const langType language CTAGS_ATTR_UNUSED, tagXpathTabl
 	xpathTable->xpathCompiled = xmlXPathCompile ((xmlChar *)xpathTable->xpath);
 	if (!xpathTable->xpathCompiled)
 		error (WARNING, "Failed to compile the Xpath expression: %s", xpathTable->xpath);
+
+	Assert (!xpathTable->xpathStream);
+	xpathTable->xpathStream = compileXpathStreamPattern (xpathTable->xpath);
 }
 
 extern void removeTagXpath (const langType language CTAGS_ATTR_UNUSED, tagXpathTable *xpathTable)
@@ -95,6 +238,216 @@ extern void removeTagXpath (const langType language CTAGS_ATTR_UNUSED, tagXpathT
 		xmlXPathFreeCompExpr (xpathTable->xpathCompiled);
 		xpathTable->xpathCompiled = NULL;
 	}
+
+	if (xpathTable->xpathStream)
+	{
+		deleteXpathStreamPattern (xpathTable->xpathStream);
+		xpathTable->xpathStream = NULL;
+	}
+}
+
+static void applyXpathTableEntry (const tagXpathTable *elt, xmlNode *node,
+				  xmlXPathContext *ctx, void *userData)
+{
+	if (elt->specType == LXPATH_TABLE_DO_MAKE)
+		simpleXpathMakeTag (node, elt->xpath, &(elt->spec.makeTagSpec), userData);
+	else
+		elt->spec.recurSpec.enter (node, elt->xpath, &(elt->spec.recurSpec), ctx, userData);
+}
+
+static void suppressWarning (void *ctx CTAGS_ATTR_UNUSED, const char *msg CTAGS_ATTR_UNUSED, ...)
+{
+}
+
+static xmlDocPtr makeXMLDoc (void)
+{
+	const unsigned char* data;
+	size_t size;
+	xmlDocPtr doc;
+
+	doc = getInputFileUserData ();
+	if (doc)
+	{
+		verbose ("reuse xml doc data\n");
+		return doc;
+	}
+
+	data = getInputFileData (&size);
+	if (data)
+	{
+		xmlSetGenericErrorFunc (NULL, suppressWarning);
+		xmlLineNumbersDefault (1);
+		doc = xmlParseMemory((const char*)data, size);
+	}
+
+	return doc;
+}
+
+static bool matchXpathStreamStep (const xpathStreamStep *step, xmlNode *node)
+{
+	if (node == NULL || node->type != XML_ELEMENT_NODE)
+		return false;
+	if (step->name == NULL)
+		return true;
+	if (!step->localName && node->ns)
+		return false;
+	return (strcmp (step->name, (char *)node->name) == 0);
+}
+
+/* Match the first N steps against NODE and its ancestors. The steps are
+ * relative to ANCHOR, the context node or the document node. */
+static bool matchXpathStreamElements (const xpathStreamStep *steps, unsigned int n,
+				      xmlNode *node, xmlNode *anchor)
+{
+	const xpathStreamStep *step;
+
+	if (n == 0)
+		return (node == anchor);
+
+	step = steps + n - 1;
+	if (!matchXpathStreamStep (step, node))
+		return false;
+
+	for (xmlNode *parent = node->parent; parent; parent = parent->parent)
+	{
+		if (matchXpathStreamElements (steps, n - 1, parent, anchor))
+			return true;
+		if (!step->descendant || parent == anchor)
+			break;
+	}
+	return false;
+}
+
+/* CONTEXT is NULL for an absolute PATTERN.
+ * For "@NAME" and "text()", NODE is the element having the attribute
+ * or the text. */
+static bool matchXpathStreamPattern (const struct sXpathStreamPattern *pattern,
+				     xmlNode *node, xmlNode *context)
+{
+	const xpathStreamStep *last = pattern->steps + pattern->count - 1;
+	xmlNode *anchor = pattern->relative? context: (xmlNode *)node->doc;
+
+	if (last->type == XPATH_STREAM_ELEMENT)
+		return matchXpathStreamElements (pattern->steps, pattern->count, node, anchor);
+
+	/* "A//@NAME" is for the attributes of A and its descendants. */
+	for (; node; node = node->parent)
+	{
+		if (matchXpathStreamElements (pattern->steps, pattern->count - 1, node, anchor))
+			return true;
+		if (!last->descendant || node == anchor)
+			break;
+	}
+	return false;
+}
+
+/* NODE is the element the reader is at. READER is NULL when walking
+ * a DOM. */
+static void applyXpathStreamPattern (xmlTextReaderPtr reader, xmlNode *node,
+				     const tagXpathTable *elt,
+				     xmlXPathContext *ctx, void *userData)
+{
+	const struct sXpathStreamPattern *pattern = elt->xpathStream;
+	const xpathStreamStep *last = pattern->steps + pattern->count - 1;
+
+	switch (last->type)
+	{
+	case XPATH_STREAM_ELEMENT:
+		if (reader && !(elt->specType == LXPATH_TABLE_DO_RECUR
+						&& elt->spec.recurSpec.shallow))
+			node = xmlTextReaderExpand (reader);
+		if (node)
+			applyXpathTableEntry (elt, node, ctx, userData);
+		break;
+	case XPATH_STREAM_ATTRIBUTE:
+		for (xmlAttr *attr = node->properties; attr; attr = attr->next)
+		{
+			if (attr->ns == NULL && strcmp ((char *)attr->name, last->name) == 0)
+				applyXpathTableEntry (elt, (xmlNode *)attr, ctx, userData);
+		}
+		break;
+	case XPATH_STREAM_TEXT:
+		if (reader)
+			node = xmlTextReaderExpand (reader);
+		for (xmlNode *child = node? node->children: NULL; child; child = child->next)
+		{
+			if (child->type == XML_TEXT_NODE || child->type == XML_CDATA_SECTION_NODE)
+				applyXpathTableEntry (elt, child, ctx, userData);
+		}
+		break;
+	}
+}
+
+static void walkXpathTableFrom (xmlNode *node, unsigned int depth, unsigned int maxDepth,
+				xmlNode *context,
+				const tagXpathTableTable *xpathTableTable,
+				xmlXPathContext *ctx, void *userData)
+{
+	for (unsigned int i = 0; i < xpathTableTable->count; i++)
+	{
+		const tagXpathTable *elt = xpathTableTable->table + i;
+
+		if (matchXpathStreamPattern (elt->xpathStream, node, context))
+			applyXpathStreamPattern (NULL, node, elt, ctx, userData);
+	}
+
+	if (depth >= maxDepth)
+		return;
+
+	for (xmlNode *child = node->children; child; child = child->next)
+	{
+		if (child->type == XML_ELEMENT_NODE)
+			walkXpathTableFrom (child, depth + 1, maxDepth, context,
+					    xpathTableTable, ctx, userData);
+	}
+}
+
+/* Evaluate all the entries of the table in one walk of the tree instead
+ * of walking it for each entry. Tags are made in the order of the nodes
+ * in the document; the entries matching the same node are applied in
+ * the order in the table.
+ *
+ * Return false if an entry is out of the subset of xpath evaluated
+ * without libxml2, or the table mixes relative and absolute entries. */
+static bool walkXpathTable (xmlNode *root, const tagXpathTableTable *xpathTableTable,
+			    xmlXPathContext *ctx, void *userData)
+{
+	bool relative = false;
+	unsigned int maxDepth = 0;
+	xmlNode *start;
+
+	for (unsigned int i = 0; i < xpathTableTable->count; i++)
+	{
+		const tagXpathTable *elt = xpathTableTable->table + i;
+		const struct sXpathStreamPattern *pattern = elt->xpathStream;
+		unsigned int depth = 0;
+
+		if (!elt->xpathCompiled || !pattern)
+			return false;
+		if (i == 0)
+			relative = pattern->relative;
+		else if (relative != pattern->relative)
+			return false;
+
+		/* How deep the tree must be walked to reach the elements the
+		 * pattern can match or the elements having the attributes and
+		 * text it can match. */
+		for (unsigned int j = 0; j < pattern->count; j++)
+		{
+			if (pattern->steps [j].descendant)
+				depth = UINT_MAX;
+			else if (depth < UINT_MAX && pattern->steps [j].type == XPATH_STREAM_ELEMENT)
+				depth++;
+		}
+		if (maxDepth < depth)
+			maxDepth = depth;
+	}
+
+	if (relative)
+		walkXpathTableFrom (root, 0, maxDepth, root, xpathTableTable, ctx, userData);
+	else if ((start = xmlDocGetRootElement (root->doc)))
+		walkXpathTableFrom (start, 1, maxDepth, NULL, xpathTableTable, ctx, userData);
+	return true;
 }
 
 static void findXMLTagsCore (xmlXPathContext *ctx, xmlNode *root,
@@ -108,6 +461,10 @@ static void findXMLTagsCore (xmlXPathContext *ctx, xmlNode *root,
 	Assert (root);
 	Assert (xpathTableTable);
 
+	if (xpathTableTable->count > 1
+		&& walkXpathTable (root, xpathTableTable, ctx, userData))
+		return;
+
 	for (i = 0; i < xpathTableTable->count; ++i)
 	{
 		xmlXPathObject *object;
@@ -139,42 +496,126 @@ static void findXMLTagsCore (xmlXPathContext *ctx, xmlNode *root,
 			for (j = 0; j < xmlXPathNodeSetGetLength (set); ++j)
 			{
 				node = xmlXPathNodeSetItem(set, j);
-				if (elt->specType == LXPATH_TABLE_DO_MAKE)
-					simpleXpathMakeTag (node, elt->xpath, &(elt->spec.makeTagSpec), userData);
-				else
-					elt->spec.recurSpec.enter (node, elt->xpath, &(elt->spec.recurSpec), ctx, userData);
+				applyXpathTableEntry (elt, node, ctx, userData);
 			}
 		}
 		xmlXPathFreeObject (object);
 	}
 }
 
-static void suppressWarning (void *ctx CTAGS_ATTR_UNUSED, const char *msg CTAGS_ATTR_UNUSED, ...)
+/* Return false if no entry can match ROOT or a node under it. */
+static bool isXpathTableMatchingUnder (const tagXpathTableTable *xpathTableTable,
+				       xmlNode *root)
 {
+	for (unsigned int i = 0; i < xpathTableTable->count; i++)
+	{
+		const xpathStreamStep *first = xpathTableTable->table [i].xpathStream->steps;
+
+		if (first->descendant || matchXpathStreamStep (first, root))
+			return true;
+	}
+	return false;
 }
 
-static xmlDocPtr makeXMLDoc (void)
+static bool isXpathTableStreamable (const tagXpathTableTable *xpathTableTable)
+{
+	for (unsigned int i = 0; i < xpathTableTable->count; i++)
+	{
+		if (!xpathTableTable->table [i].xpathStream
+			|| xpathTableTable->table [i].xpathStream->relative)
+			return false;
+	}
+	return true;
+}
+
+static bool isInputLargeForDOM (void)
+{
+	size_t size;
+
+	/* The document parsed when choosing the parser is reused. */
+	if (getInputFileUserData ())
+		return false;
+
+	if (getInputFileData (&size) == NULL || size > INT_MAX)
+		return false;
+	return (size >= Option.xmlStreamThreshold);
+}
+
+/* Tags are made in the order of the elements in the input, not in the
+ * order of the entries in the table. Only the ancestors of the element
+ * being read, and its subtree if an entry needs it, are kept in memory.
+ *
+ * If PROBING is true, no tag is made; return true when an element
+ * matching an entry is found. */
+static bool findXMLTagsStreaming (const tagXpathTableTable *xpathTableTable,
+				  bool probing, void *userData)
 {
 	const unsigned char* data;
 	size_t size;
-	xmlDocPtr doc;
+	xmlTextReaderPtr reader;
+	xmlXPathContext *ctx = NULL;
+	bool found = false;
+	int r = 0;
 
-	doc = getInputFileUserData ();
-	if (doc)
+	data = getInputFileData (&size);
+
+	xmlSetGenericErrorFunc (NULL, suppressWarning);
+	xmlLineNumbersDefault (1);
+	reader = xmlReaderForMemory ((const char *)data, (int)size, NULL, NULL,
+				     XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+	if (reader == NULL)
 	{
-		verbose ("reuse xml doc data\n");
-		return doc;
+		verbose ("could not read %s as a XML file\n", getInputFileName());
+		return false;
 	}
 
-	data = getInputFileData (&size);
-	if (data)
+	verbose ("%s %s in the streaming mode\n",
+		 probing? "probe": "read", getInputFileName());
+	while (!(probing && found) && (r = xmlTextReaderRead (reader)) == 1)
 	{
-		xmlSetGenericErrorFunc (NULL, suppressWarning);
-		xmlLineNumbersDefault (1);
-		doc = xmlParseMemory((const char*)data, size);
+		xmlNode *node;
+
+		if (xmlTextReaderNodeType (reader) != XML_READER_TYPE_ELEMENT)
+			continue;
+
+		node = xmlTextReaderCurrentNode (reader);
+		if (node == NULL)
+			continue;
+
+		/* Most tables are for documents having a specific root element. */
+		if (xmlTextReaderDepth (reader) == 0
+			&& !isXpathTableMatchingUnder (xpathTableTable, node))
+			break;
+
+		if (ctx == NULL && !probing)
+		{
+			ctx = xmlXPathNewContext (node->doc);
+			if (ctx == NULL)
+				error (FATAL, "failed to make a new xpath context for %s", getInputFileName());
+		}
+
+		for (unsigned int i = 0; i < xpathTableTable->count; i++)
+		{
+			const tagXpathTable *elt = xpathTableTable->table + i;
+
+			if (!matchXpathStreamPattern (elt->xpathStream, node, NULL))
+				continue;
+
+			found = true;
+			if (probing)
+				break;
+			applyXpathStreamPattern (reader, node, elt, ctx, userData);
+		}
 	}
 
-	return doc;
+	if (r < 0)
+		verbose ("stop reading %s at line %d: not well-formed\n",
+			 getInputFileName(), xmlTextReaderGetParserLineNumber (reader));
+
+	if (ctx)
+		xmlXPathFreeContext (ctx);
+	xmlFreeTextReader (reader);
+	return found;
 }
 
 extern void findXMLTagsFull (xmlXPathContext *ctx, xmlNode *root,
@@ -193,7 +634,33 @@ extern void findXMLTagsFull (xmlXPathContext *ctx, xmlNode *root,
 	{
 		usedAsEntryPoint = true;
 
-		findRegexTags ();
+		/* A subparser run from RUNAFTER in the streaming mode comes
+		 * here with no CTX. */
+		if (!RunningAfterStreaming)
+			findRegexTags ();
+
+		if (isInputLargeForDOM () && isXpathTableStreamable (xpathTableTable))
+		{
+			if (xpathTableTable->streamable)
+			{
+				findXMLTagsStreaming (xpathTableTable, false, userData);
+				if (runAfter)
+				{
+					bool running = RunningAfterStreaming;
+
+					RunningAfterStreaming = true;
+					(* runAfter) (NULL, NULL, userData);
+					RunningAfterStreaming = running;
+				}
+				return;
+			}
+
+			/* The entries need the DOM. Avoid building it for an
+			 * input having nothing for them. */
+			if (runAfter == NULL
+				&& !findXMLTagsStreaming (xpathTableTable, true, NULL))
+				return;
+		}
 
 		doc = makeXMLDoc ();
 
@@ -234,6 +701,7 @@ out:
 extern void addTagXpath (const langType language, tagXpathTable *xpathTable)
 {
 	xpathTable->xpathCompiled = NULL;
+	xpathTable->xpathStream = NULL;
 }
 
 extern void removeTagXpath (const langType language CTAGS_ATTR_UNUSED, tagXpathTable *xpathTable CTAGS_ATTR_UNUSED)
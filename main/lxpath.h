@@ -61,6 +61,10 @@ typedef struct sTagXpathRecurSpec {
 	int  nextTable;		/* A parser can use this field any purpose.
 				   main/lxpath part doesn't touch this. */
 
+	/* In the streaming mode, enter is called with an element node
+	   whose children are not read yet if shallow is true.
+	   Otherwise, the subtree of the node is read before calling. */
+	bool shallow;
 } tagXpathRecurSpec;
 
 typedef struct sTagXpathTable
@@ -72,11 +76,24 @@ typedef struct sTagXpathTable
 		tagXpathRecurSpec   recurSpec;
 	} spec;
 	xmlXPathCompExpr* xpathCompiled;
+	struct sXpathStreamPattern *xpathStream; /* NULL if xpath is out of
+						    the streaming subset */
 } tagXpathTable;
 
 typedef struct sTagXpathTableTable {
 	tagXpathTable *table;
 	unsigned int   count;
+
+	/* Set true if the table can be evaluated in the streaming mode, used
+	   for a large input file: the input is read with xmlTextReader, and
+	   each element is matched against the xpath expressions when the
+	   reader visits it. Only the ancestors of the element, its
+	   attributes, and (if needed) its subtree are available then. The
+	   siblings of the element are not. The xpath expressions in the table
+	   must be absolute ones made of "/" and "//" steps with a name, "*",
+	   or "*[local-name()='NAME']", optionally followed by "@NAME" or
+	   "text()". */
+	bool streamable;
 } tagXpathTableTable;
 
 typedef struct sXpathFileSpec {
@@ -47,23 +47,39 @@
 #ifdef HAVE_IO_H
 # include <io.h>  /* to declare _findfirst() */
 #endif
+#ifdef HAVE_STAT_ST_INO
+# include <sys/stat.h>  /* to identify directories */
+#endif
 
 
 #include "ctags.h"
 #include "debug.h"
+#include "dedup_p.h"
 #include "entry_p.h"
 #include "error_p.h"
+#include "eventtrace_p.h"
 #include "field_p.h"
+#include "gitindex_p.h"
+#include "htable.h"
+#include "ignore_p.h"
+#include "jobs_p.h"
 #include "keyword_p.h"
 #include "main_p.h"
+#include "manifest_p.h"
+#include "numarray.h"
 #include "options_p.h"
 #include "optscript.h"
 #include "parse_p.h"
 #include "read_p.h"
 #include "routines_p.h"
+#include "shard_p.h"
 #include "stats_p.h"
+#include "symindex_p.h"
 #include "trace.h"
+#include "trashbox.h"
 #include "trashbox_p.h"
+#include "vstring.h"
+#include "watch_p.h"
 #include "writer_p.h"
 #include "xtag_p.h"
 
@@ -79,16 +95,57 @@
 static mainLoopFunc mainLoop;
 static void *mainData;
 
+/* Input files queued for running parsers in worker processes (--jobs) */
+static stringList *JobQueue;
+static ulongArray *JobSizes;	/* the sizes of the files in JobQueue */
+
+#ifdef HAVE_STAT_ST_INO
+/* A directory entered while recursing into an argument. Reaching one
+ * again through a symbolic link is a loop, or a duplicate of a subtree
+ * for which the tags are made already. */
+typedef struct sDirectoryId {
+	dev_t dev;
+	ino_t ino;
+} directoryId;
+
+/* directoryId -> the name the directory is entered with */
+static hashTable *VisitedDirectories;
+#endif
+
+/* What is known about an entry without calling stat */
+enum entryKind {
+	ENTRY_UNKNOWN,
+	ENTRY_FILE,					/* a regular file, not a symbolic link */
+	ENTRY_DIRECTORY,			/* a directory, not a symbolic link */
+};
+
 /*
 *   FUNCTION PROTOTYPES
 */
 static bool createTagsForEntry (const char *const entryName);
+static bool createTagsForEntryOfKind (const char *const entryName,
+									  enum entryKind kind);
 
 /*
 *   FUNCTION DEFINITIONS
 */
 
 #if defined (HAVE_OPENDIR) && (defined (HAVE_DIRENT_H) || defined (_MSC_VER))
+/* The type of the entry given by readdir saves calling stat for it. */
+static enum entryKind getDirectoryEntryKind (const struct dirent *const entry)
+{
+#ifdef _DIRENT_HAVE_D_TYPE
+	switch (entry->d_type)
+	{
+	case DT_REG:
+		return ENTRY_FILE;
+	case DT_DIR:
+		return ENTRY_DIRECTORY;
+	}
+#endif
+	return ENTRY_UNKNOWN;
+}
+
 static bool recurseUsingOpendir (const char *const dirName)
 {
 	bool resize = false;
@@ -112,7 +169,8 @@ static bool recurseUsingOpendir (const char *const dirName)
 					filePath = combinePathAndFile (dirName, entry->d_name);
 					free_p = true;
 				}
-				resize |= createTagsForEntry (filePath);
+				resize |= createTagsForEntryOfKind (filePath,
+													getDirectoryEntryKind (entry));
 				if (free_p)
 					eFree (filePath);
 			}
@@ -163,15 +221,73 @@ static bool createTagsForWildcardUsingFindfirst (const char *const pattern)
 #endif
 
 
-static bool recurseIntoDirectory (const char *const dirName)
+#ifdef HAVE_STAT_ST_INO
+static unsigned int hashDirectoryId (const void *const key)
+{
+	const directoryId *id = key;
+
+	return (unsigned int) id->ino * 31 + (unsigned int) id->dev;
+}
+
+static bool directoryIdEq (const void *a, const void *b)
+{
+	const directoryId *ida = a;
+	const directoryId *idb = b;
+
+	return ida->ino == idb->ino && ida->dev == idb->dev;
+}
+
+/* Return the name DIRNAME was entered with if it is visited already in
+ * the current argument. Otherwise, register DIRNAME and return NULL. */
+static const char *visitDirectory (const char *const dirName)
+{
+	struct stat st;
+	directoryId id;
+	const char *visited;
+
+	if (stat (dirName, &st) != 0)
+		return NULL;
+
+	id.dev = st.st_dev;
+	id.ino = st.st_ino;
+	visited = hashTableGetItem (VisitedDirectories, &id);
+	if (visited == NULL)
+	{
+		directoryId *key = xMalloc (1, directoryId);
+
+		*key = id;
+		hashTablePutItem (VisitedDirectories, key, eStrdup (dirName));
+	}
+	return visited;
+}
+#endif
+
+/* MAYBELINK is false if DIRNAME is known not to be a symbolic link. */
+static bool recurseIntoDirectory (const char *const dirName, bool maybeLink)
 {
 	static unsigned int recursionDepth = 0;
+	const char *visited = NULL;
 
 	recursionDepth++;
 
+#ifdef HAVE_STAT_ST_INO
+	/* Only a symbolic link leads to a directory visited already; the
+	 * directory may be reached through its real path after the link. */
+	if (recursionDepth == 1)
+		VisitedDirectories = hashTableNew (64, hashDirectoryId, directoryIdEq,
+										   eFree, eFree);
+	if (Option.followLinks && Option.recurse)
+		visited = visitDirectory (dirName);
+#else
+	if (maybeLink && isRecursiveLink (dirName))
+		visited = dirName;
+#endif
+
 	bool resize = false;
-	if (isRecursiveLink (dirName))
-		verbose ("ignoring \"%s\" (recursive link)\n", dirName);
+	if (Option.respectGitignore && isIgnoredFile (dirName, true))
+		verbose ("ignoring \"%s\" (listed in an ignore file)\n", dirName);
+	else if (visited)
+		verbose ("ignoring \"%s\" (visited already as \"%s\")\n", dirName, visited);
 	else if (! Option.recurse)
 		verbose ("ignoring \"%s\" (directory)\n", dirName);
 	else if(recursionDepth > Option.maxRecursionDepth)
@@ -180,6 +296,9 @@ static bool recurseIntoDirectory (const char *const dirName)
 	else
 	{
 		verbose ("RECURSING into directory \"%s\"\n", dirName);
+		noteWatchedDirectory (dirName);
+		if (Option.respectGitignore)
+			pushIgnoreFiles (dirName);
 #if defined (HAVE_OPENDIR) && (defined (HAVE_DIRENT_H) || defined (_MSC_VER))
 		resize = recurseUsingOpendir (dirName);
 #elif defined (HAVE__FINDFIRST)
@@ -192,35 +311,145 @@ static bool recurseIntoDirectory (const char *const dirName)
 			vStringDelete (pattern);
 		}
 #endif
+		if (Option.respectGitignore)
+			popIgnoreFiles ();
 	}
 
+#ifdef HAVE_STAT_ST_INO
+	if (recursionDepth == 1)
+	{
+		hashTableDelete (VisitedDirectories);
+		VisitedDirectories = NULL;
+	}
+#endif
 	recursionDepth--;
 
 	return resize;
 }
 
-static bool createTagsForEntry (const char *const entryName)
+/*  The size of an input file queued for the worker processes, by which
+ *  the larger files are parsed first.
+ */
+static unsigned long getJobSize (const char *const fileName,
+								 fileStatus *status)
+{
+	unsigned long size;
+
+	if (status)
+		return status->size;
+
+	status = eStat (fileName);
+	size = status->exists? status->size: 0;
+	eStatFree (status);
+	return size;
+}
+
+/* STATUS can be NULL if ENTRYNAME is known to be a regular file. */
+static bool createTagsForFile (const char *const entryName,
+							   fileStatus *status)
+{
+	bool resize = false;
+	bool reused = false;
+
+	if (isExcludedFile (entryName, false))
+	{
+		verbose ("excluding \"%s\"\n", entryName);
+		return false;
+	}
+
+	if (Option.respectGitignore && isIgnoredFile (entryName, false))
+	{
+		verbose ("ignoring \"%s\" (listed in an ignore file)\n", entryName);
+		return false;
+	}
+
+	if (! isInputFileInShard (entryName))
+	{
+		verbose ("ignoring \"%s\" (in another shard)\n", entryName);
+		return false;
+	}
+
+	noteWatchedInputFile (entryName);
+
+	if (Option.appendReplace)
+		replaceTagsOfInputFile (entryName);
+
+	if (Option.incremental)
+	{
+		if (status)
+			reused = registerManifestInputFile (entryName, status);
+		else
+		{
+			status = eStat (entryName);
+			reused = registerManifestInputFile (entryName, status);
+			eStatFree (status);
+		}
+	}
+
+	if (reused)
+		;  /* the tags are taken from the old tag file */
+	else if (JobQueue)
+	{
+		stringListAdd (JobQueue, vStringNewInit (entryName));
+		ulongArrayAdd (JobSizes, getJobSize (entryName, status));
+	}
+	else
+		resize = parseFile (entryName);
+
+	return resize;
+}
+
+static bool createTagsForEntryOfKind (const char *const entryName,
+									  enum entryKind kind)
 {
 	bool resize = false;
-	fileStatus *status = eStat (entryName);
 
 	Assert (entryName != NULL);
 	if (isExcludedFile (entryName, true))
 		verbose ("excluding \"%s\" (the early stage)\n", entryName);
-	else if (status->isSymbolicLink  &&  ! Option.followLinks)
-		verbose ("ignoring \"%s\" (symbolic link)\n", entryName);
-	else if (! status->exists)
-		error (WARNING | PERROR, "cannot open input file \"%s\"", entryName);
-	else if (status->isDirectory)
-		resize = recurseIntoDirectory (entryName);
-	else if (! status->isNormalFile)
-		verbose ("ignoring \"%s\" (special file)\n", entryName);
-	else if (isExcludedFile (entryName, false))
-		verbose ("excluding \"%s\"\n", entryName);
+	else if (kind == ENTRY_DIRECTORY)
+		resize = recurseIntoDirectory (entryName, false);
+	else if (kind == ENTRY_FILE)
+		resize = createTagsForFile (entryName, NULL);
 	else
-		resize = parseFile (entryName);
+	{
+		fileStatus *status = eStat (entryName);
+
+		if (status->isSymbolicLink  &&  ! Option.followLinks)
+			verbose ("ignoring \"%s\" (symbolic link)\n", entryName);
+		else if (! status->exists)
+			error (WARNING | PERROR, "cannot open input file \"%s\"", entryName);
+		else if (status->isDirectory)
+			resize = recurseIntoDirectory (entryName, true);
+		else if (! status->isNormalFile)
+			verbose ("ignoring \"%s\" (special file)\n", entryName);
+		else
+			resize = createTagsForFile (entryName, status);
+
+		eStatFree (status);
+	}
 
-	eStatFree (status);
+	return resize;
+}
+
+static bool createTagsForEntry (const char *const entryName)
+{
+	return createTagsForEntryOfKind (entryName, ENTRY_UNKNOWN);
+}
+
+/*  Parse the queued input files before processing an option that may
+ *  change how the files following it are parsed.
+ */
+static bool flushJobQueue (void)
+{
+	bool resize = false;
+
+	if (JobQueue && stringListCount (JobQueue) > 0)
+	{
+		resize = runParserJobs (JobQueue, JobSizes, Option.jobs);
+		stringListClear (JobQueue);
+		ulongArrayClear (JobSizes);
+	}
 	return resize;
 }
 
@@ -266,6 +495,8 @@ static bool createTagsForArgs (cookedArgs *const args)
 		resize |= createTagsForEntry (arg);
 #endif
 		cArgForth (args);
+		if (! cArgOff (args) && cArgIsOption (args))
+			resize |= flushJobQueue ();
 		parseCmdlineOptions (args);
 	}
 	return resize;
@@ -290,6 +521,8 @@ static bool createTagsFromFileInput (FILE *const fp, const bool filter)
 				fflush (stdout);
 			}
 			cArgForth (args);
+			if (! cArgOff (args) && cArgIsOption (args))
+				resize |= flushJobQueue ();
 			parseCmdlineOptions (args);
 		}
 		cArgDelete (args);
@@ -316,6 +549,99 @@ static bool createTagsFromListFile (const char *const fileName)
 	return resize;
 }
 
+struct gitIndexWalk {
+	const char *worktree;
+	vString *dir;				/* the directory of the last entry */
+	bool dirExcluded;
+	bool resize;
+};
+
+/* The directories are not visited when reading the index. Check them
+ * for --exclude. */
+static bool isInExcludedDirectory (const char *const fileName,
+								   size_t worktreeLength,
+								   struct gitIndexWalk *walk)
+{
+	const char *sep = strrchr (fileName + worktreeLength, '/');
+	size_t length;
+
+	if (sep == NULL)
+		return false;
+
+	length = sep - fileName;
+	if (vStringLength (walk->dir) == length
+		&& strncmp (vStringValue (walk->dir), fileName, length) == 0)
+		return walk->dirExcluded;
+
+	vStringNCopyS (walk->dir, fileName, length);
+	walk->dirExcluded = false;
+	for (const char *p = fileName + worktreeLength; p <= sep; p++)
+	{
+		if (*p == '/')
+		{
+			char *dir = eStrndup (fileName, p - fileName);
+			walk->dirExcluded = isExcludedFile (dir, true);
+			if (walk->dirExcluded)
+				verbose ("excluding \"%s\" (the early stage)\n", dir);
+			eFree (dir);
+			if (walk->dirExcluded)
+				break;
+		}
+	}
+	return walk->dirExcluded;
+}
+
+static void createTagsForGitIndexEntry (const char *const path,
+										enum gitIndexEntryType type,
+										void *data)
+{
+	struct gitIndexWalk *walk = data;
+	char *fileName = NULL;
+	const char *entryName = path;
+	size_t worktreeLength = 0;
+
+	if (strcmp (walk->worktree, ".") != 0)
+	{
+		fileName = combinePathAndFile (walk->worktree, path);
+		entryName = fileName;
+		worktreeLength = strlen (entryName) - strlen (path);
+	}
+
+	if (isInExcludedDirectory (entryName, worktreeLength, walk))
+		;
+	else if (type == GIT_INDEX_GITLINK)
+		verbose ("ignoring \"%s\" (submodule)\n", entryName);
+	else
+		walk->resize |= createTagsForEntryOfKind (entryName,
+												  type == GIT_INDEX_REGULAR
+												  ? ENTRY_FILE
+												  : ENTRY_UNKNOWN);
+
+	if (fileName)
+		eFree (fileName);
+}
+
+/*  Read the names of the files tracked in a git worktree from its index.
+ *  The files are not stat'ed unless needed.
+ */
+static bool createTagsFromGitIndex (const char *const worktree)
+{
+	struct gitIndexWalk walk = {
+		.worktree = worktree,
+		.dir = vStringNew (),
+		.dirExcluded = false,
+		.resize = false,
+	};
+
+	if (! foreachGitIndexEntry (worktree, createTagsForGitIndexEntry, &walk))
+	{
+		error (WARNING, "cannot read the git index of \"%s\"", worktree);
+		walk.resize = createTagsForEntry (worktree);
+	}
+	vStringDelete (walk.dir);
+	return walk.resize;
+}
+
 static bool etagsInclude (void)
 {
 	return (bool)(Option.etags && Option.etagsInclude != NULL);
@@ -332,12 +658,12 @@ static void runMainLoop (cookedArgs *args)
 	(* mainLoop) (args, mainData);
 }
 
-static void batchMakeTags (cookedArgs *args, void *user CTAGS_ATTR_UNUSED)
+extern void batchMakeTags (cookedArgs *args, void *user CTAGS_ATTR_UNUSED)
 {
-	clock_t timeStamps [3];
+	statsTime timeStamps [3];
 	bool resize = false;
 	bool files = (bool)(! cArgOff (args) || Option.fileList != NULL
-							  || Option.filter);
+							  || Option.gitIndex != NULL || Option.filter);
 
 	if (! files)
 	{
@@ -348,12 +674,22 @@ static void batchMakeTags (cookedArgs *args, void *user CTAGS_ATTR_UNUSED)
 			return;
 	}
 
-#define timeStamp(n) timeStamps[(n)]=(Option.printTotals ? clock():(clock_t)0)
+	if (Option.metricsFile)
+		enableMetrics ();
+
+#define timeStamp(n) do { if (isTotalsEnabled ()) readStatsTime (timeStamps + (n)); } while (0)
 	if ((! Option.filter) && (! Option.printLanguage))
 		openTagFile ();
 
 	timeStamp (0);
 
+	if ((Option.jobs > 1 || Option.readAhead > 0)
+		&& (! Option.filter) && (! Option.printLanguage))
+	{
+		JobQueue = stringListNew ();
+		JobSizes = ulongArrayNew ();
+	}
+
 	if (! cArgOff (args))
 	{
 		verbose ("Reading command line arguments\n");
@@ -364,33 +700,769 @@ static void batchMakeTags (cookedArgs *args, void *user CTAGS_ATTR_UNUSED)
 		verbose ("Reading list file\n");
 		resize = (bool) (createTagsFromListFile (Option.fileList) || resize);
 	}
+	if (Option.gitIndex != NULL)
+	{
+		verbose ("Reading git index\n");
+		resize = (bool) (createTagsFromGitIndex (Option.gitIndex) || resize);
+	}
 	if (Option.filter)
 	{
 		verbose ("Reading filter input\n");
 		resize = (bool) (createTagsFromFileInput (stdin, true) || resize);
 	}
 	if (! files  &&  Option.recurse)
-		resize = recurseIntoDirectory (".");
+		resize = recurseIntoDirectory (".", true);
+
+	if (JobQueue)
+	{
+		resize = (bool) (flushJobQueue () || resize);
+		stringListDelete (JobQueue);
+		JobQueue = NULL;
+		ulongArrayDelete (JobSizes);
+		JobSizes = NULL;
+	}
+
+	if (Option.incremental)
+		reuseTagsInManifest ();
+	if (Option.dedupContent)
+		freeDedupContent ();
 
 	timeStamp (1);
 
 	if ((! Option.filter) && (!Option.printLanguage))
 		closeTagFile (resize);
+	else if (Option.filter)
+		closeFilterTagFile ();
+
+	if (Option.incremental)
+		saveManifest ();
 
 	timeStamp (2);
 
 	if (Option.printTotals)
 	{
 		printTotals (timeStamps, Option.append, Option.sorted);
-		if (Option.printTotals > 1)
+		if (Option.printTotals == 2)
 			for (unsigned int i = 0; i < countParsers(); i++)
 				printParserStatisticsIfUsed (i);
 	}
+	if (Option.metricsFile)
+		writeMetricsFile (timeStamps);
 
 #undef timeStamp
 }
 
 #ifdef HAVE_JANSSON
+/* The contents of the input files tagged in the server submode of the
+ * interactive mode: file name -> interactiveCacheEntry */
+typedef struct sInteractiveCacheEntry {
+	uint64_t hash;
+	size_t size;
+	/* The first and the last lines of each top-level scope in the file,
+	 * or NULL if they are unknown. */
+	ulongArray *scopes;
+} interactiveCacheEntry;
+
+static hashTable *InteractiveCache;
+
+/* The definition tags of the files tagged in the server submode */
+static symbolIndex *InteractiveIndex;
+
+static void deleteInteractiveCacheEntry (void *data)
+{
+	interactiveCacheEntry *entry = data;
+
+	if (entry->scopes)
+		ulongArrayDelete (entry->scopes);
+	eFree (entry);
+}
+
+/* Read a request line of any length. The line break is not stored. */
+static bool readInteractiveRequest (vString *const line, FILE *const fp)
+{
+	int c;
+
+	vStringClear (line);
+	while ((c = getc (fp)) != EOF)
+	{
+		if (c == '\n')
+			return true;
+		vStringPut (line, c);
+	}
+	return !vStringIsEmpty (line);
+}
+
+/* Returns true if the contents of FILENAME are the same as the last time
+ * the file was tagged. Otherwise the new contents are recorded. A HASH of
+ * 0 means the contents are unknown. */
+static bool updateInteractiveCache (const char *const filename,
+									uint64_t hash, size_t size)
+{
+	interactiveCacheEntry *entry;
+
+	if (InteractiveCache == NULL)
+	{
+		InteractiveCache = hashTableNew (127, hashCstrhash, hashCstreq,
+										 eFree, deleteInteractiveCacheEntry);
+		DEFAULT_TRASH_BOX (InteractiveCache, hashTableDelete);
+	}
+
+	entry = hashTableGetItem (InteractiveCache, filename);
+	if (hash == 0)
+	{
+		if (entry)
+			hashTableDeleteItem (InteractiveCache, filename);
+		return false;
+	}
+	if (entry && entry->hash == hash && entry->size == size)
+		return true;
+
+	if (entry == NULL)
+	{
+		entry = xMalloc (1, interactiveCacheEntry);
+		entry->scopes = NULL;
+		hashTablePutItem (InteractiveCache, eStrdup (filename), entry);
+	}
+	entry->hash = hash;
+	entry->size = size;
+	return false;
+}
+
+/* ID is the "id" of the request, echoed in the responses. It can be
+ * NULL. */
+static void printResponse (json_t *response, json_t *id)
+{
+	if (id)
+		json_object_set (response, "id", id);
+	json_dumpf (response, stdout, JSON_PRESERVE_ORDER);
+	fprintf (stdout, "\n");
+	json_decref (response);
+}
+
+/* The scopes of FILENAME tagged in a worker process are not known. */
+static void forgetInteractiveScopes (const char *const filename)
+{
+	interactiveCacheEntry *entry = InteractiveCache
+		? hashTableGetItem (InteractiveCache, filename): NULL;
+
+	if (entry && entry->scopes)
+	{
+		ulongArrayDelete (entry->scopes);
+		entry->scopes = NULL;
+	}
+}
+
+static void printUnchanged (const char *const filename,
+							const char *const command, json_t *id)
+{
+	json_t *response = json_object ();
+
+	json_object_set_new (response, "_type", json_string ("unchanged"));
+	json_object_set_new (response, "command", json_string (command));
+	json_object_set_new (response, "filename", json_string (filename));
+	printResponse (response, id);
+}
+
+static void printCompleted (const char *const command, json_t *id)
+{
+	json_t *response = json_object ();
+
+	json_object_set_new (response, "_type", json_string ("completed"));
+	json_object_set_new (response, "command", json_string (command));
+	printResponse (response, id);
+	fflush (stdout);
+}
+
+/* Open the contents of an inline request FILEREQ: "size" bytes read
+ * from stdin, or the file at "mapped", typically on a tmpfs or a memfd
+ * of the client (/proc/<pid>/fd/<n>), mapped into memory without being
+ * copied. Returns NULL after reporting an error. */
+static MIO *openInlineContents (json_t *filereq, const char *command,
+								struct interactiveModeArgs *iargs)
+{
+	json_int_t size = -1;
+	const char *mapped = NULL;
+	unsigned char *data;
+
+	json_unpack (filereq, "{sI}", "size", &size);
+	json_unpack (filereq, "{ss}", "mapped", &mapped);
+
+	if (mapped)
+	{
+		MIO *mio = NULL;
+
+		if (size != -1)
+		{
+			error (FATAL, "invalid %s request: both size and mapped are given",
+				   command);
+			return NULL;
+		}
+		if (iargs->sandbox)
+		{
+			error (FATAL,
+				   "invalid request in sandbox submode: mapping file contents is limited");
+			return NULL;
+		}
+#ifdef HAVE_MMAP
+		mio = mio_new_mmap (mapped);
+#endif
+		if (mio == NULL)
+		{
+			fileStatus *status = eStat (mapped);
+			bool empty = status->exists && status->size == 0;
+
+			eStatFree (status);
+			if (!empty)
+			{
+				error (FATAL, "cannot map the contents of \"%s\"", mapped);
+				return NULL;
+			}
+			mio = mio_new_memory (NULL, 0, NULL, NULL);
+		}
+		return mio;
+	}
+
+	data = eMalloc (size + 1);
+	size = fread (data, 1, size, stdin);
+	data [size] = '\0';
+	return mio_new_memory (data, size, eRealloc, eFreeNoNullCheck);
+}
+
+static bool isInlineRequest (json_t *filereq)
+{
+	return json_object_get (filereq, "size")
+		|| json_object_get (filereq, "mapped");
+}
+
+static uint64_t hashInlineContents (MIO *mio, size_t *size)
+{
+	unsigned char *data = mio_memory_get_data (mio, size);
+	uint64_t hash = hashBytes (FNV1A_INITIAL_HASH, data, *size);
+
+	return hash? hash: 1;
+}
+
+static void recordTopLevelScope (const tagEntryInfo *const tag, ulongArray *scopes)
+{
+	if (tag->extensionFields.scopeIndex == CORK_NIL
+		&& tag->extensionFields.scopeName == NULL
+		&& tag->extensionFields._endLine > tag->lineNumber
+		&& !isTagExtraBitMarked (tag, XTAG_QUALIFIED_TAGS))
+	{
+		ulongArrayAdd (scopes, tag->lineNumber);
+		ulongArrayAdd (scopes, tag->extensionFields._endLine);
+	}
+}
+
+/* DATA is the ulongArray recording the top-level scopes, or NULL. */
+static void observeInteractiveTag (const tagEntryInfo *const tag, void *data)
+{
+	if (data)
+		recordTopLevelScope (tag, data);
+	symbolIndexCollectTag (tag, InteractiveIndex);
+}
+
+static void beginIndexingFile (const char *const filename)
+{
+	if (InteractiveIndex == NULL)
+	{
+		InteractiveIndex = symbolIndexNew ();
+		DEFAULT_TRASH_BOX (InteractiveIndex, symbolIndexDelete);
+	}
+	symbolIndexBeginFile (InteractiveIndex, filename);
+}
+
+/* If "edit" of FILEREQ, {"start": S, "end": E, "lines": N} telling the
+ * lines from S to E of the file tagged last time are replaced with N
+ * lines, is inside a top-level scope in ENTRY->scopes, parse only the
+ * scope again, from the line after the previous scope so that a return
+ * type or a comment before the scope is not lost. The lines parsed and
+ * the shift of the following lines are reported with a "delta" object
+ * before the tags of the lines. Returns false if the whole file must be
+ * parsed again; nothing is emitted then. SCOPES collects the top-level
+ * scopes written. */
+static bool reparseEditedScope (const char *const filename, MIO *mio,
+								json_t *filereq, json_t *id,
+								interactiveCacheEntry *entry, ulongArray *scopes)
+{
+	json_t *edit = json_object_get (filereq, "edit");
+	json_int_t start, end, lines;
+	unsigned long first = 0, last = 0, from = 1;
+	long shift;
+	MIOPos pos;
+
+	if (edit == NULL
+		|| json_unpack (edit, "{sIsIsI}", "start", &start, "end", &end,
+						"lines", &lines) == -1
+		|| start < 1 || end < start - 1 || lines < 0)
+		return false;
+
+	/* The first and the last lines of the scope must be left as they
+	 * are; the scope may end elsewhere otherwise. */
+	for (unsigned int i = 0; i + 1 < ulongArrayCount (entry->scopes); i += 2)
+	{
+		unsigned long f = ulongArrayItem (entry->scopes, i);
+		unsigned long l = ulongArrayItem (entry->scopes, i + 1);
+
+		if (f < (unsigned long) start && (unsigned long) end < l)
+		{
+			first = f;
+			last = l;
+			break;
+		}
+	}
+	if (first == 0)
+		return false;
+	for (unsigned int i = 0; i + 1 < ulongArrayCount (entry->scopes); i += 2)
+	{
+		unsigned long l = ulongArrayItem (entry->scopes, i + 1);
+
+		if (l < first && l + 1 > from)
+			from = l + 1;
+	}
+
+	shift = (long) lines - (long) (end - start + 1);
+	tagFilePosition (&pos);
+	parseFileRegionWithMio (filename, mio, from, last + shift);
+
+	/* The scope must still be one top-level scope, ending at the same
+	 * line as before. */
+	if (ulongArrayCount (scopes) != 2
+		|| ulongArrayItem (scopes, 0) != first
+		|| ulongArrayItem (scopes, 1) != last + shift)
+	{
+		verbose ("reparsing lines %lu-%lu of %s made a different scope; parsing the whole file\n",
+				 from, last + shift, filename);
+		setTagFilePosition (&pos, true);
+		ulongArrayClear (scopes);
+		symbolIndexBeginFile (InteractiveIndex, filename);
+		return false;
+	}
+
+	json_t *response = json_object ();
+	json_object_set_new (response, "_type", json_string ("delta"));
+	json_object_set_new (response, "command", json_string ("generate-tags"));
+	json_object_set_new (response, "filename", json_string (filename));
+	json_object_set_new (response, "start", json_integer (from));
+	json_object_set_new (response, "end", json_integer (last));
+	json_object_set_new (response, "shift", json_integer (shift));
+	printResponse (response, id);
+	symbolIndexCommitLines (InteractiveIndex, filename, from, last, shift);
+
+	ulongArrayClear (scopes);
+	for (unsigned int i = 0; i + 1 < ulongArrayCount (entry->scopes); i += 2)
+	{
+		unsigned long f = ulongArrayItem (entry->scopes, i);
+		unsigned long l = ulongArrayItem (entry->scopes, i + 1);
+
+		if (f == first)
+			l += shift;
+		else if (f > last)
+		{
+			f += shift;
+			l += shift;
+		}
+		ulongArrayAdd (scopes, f);
+		ulongArrayAdd (scopes, l);
+	}
+	return true;
+}
+
+/* Tag FILENAME read from MIO, or from the disk if MIO is NULL. In the
+ * server submode, the top-level scopes of the file are recorded for
+ * reparsing only the scope edited next time, and the definition tags
+ * replace the ones of the file in InteractiveIndex. */
+static void tagInteractiveFile (const char *const filename, MIO *mio,
+								json_t *filereq, json_t *id,
+								struct interactiveModeArgs *iargs)
+{
+	interactiveCacheEntry *entry = NULL;
+	ulongArray *scopes = NULL;
+
+	if (iargs->server && InteractiveCache)
+		entry = hashTableGetItem (InteractiveCache, filename);
+	if (entry)
+		scopes = ulongArrayNew ();
+	if (iargs->server)
+	{
+		beginIndexingFile (filename);
+		setTagWriteObserver (observeInteractiveTag, scopes);
+	}
+
+	if (! (entry && entry->scopes
+		   && reparseEditedScope (filename, mio, filereq, id, entry, scopes)))
+	{
+		if (mio)
+			parseFileWithMio (filename, mio, NULL);
+		else
+			createTagsForEntry (filename);
+		if (iargs->server)
+			symbolIndexCommit (InteractiveIndex);
+	}
+
+	if (iargs->server)
+		setTagWriteObserver (NULL, NULL);
+	if (entry)
+	{
+		if (entry->scopes)
+			ulongArrayDelete (entry->scopes);
+		entry->scopes = scopes;
+	}
+}
+
+/* Tag a file specified with FILEREQ, an object having "filename" and
+ * optionally "size" or "mapped". If one of them is given, the contents
+ * are read from stdin or from the mapped file. Returns false after
+ * reporting an error if the file cannot be tagged as requested. */
+static bool generateTagsForRequest (json_t *filereq, json_t *id,
+									struct interactiveModeArgs *iargs)
+{
+	const char *filename;
+
+	if (json_unpack (filereq, "{ss}", "filename", &filename) == -1)
+	{
+		error (FATAL, "invalid generate-tags request");
+		return false;
+	}
+
+	if (!isInlineRequest (filereq))
+	{					/* read from disk */
+		if (iargs->sandbox) {
+			error (FATAL,
+				   "invalid request in sandbox submode: reading file contents from a file is limited");
+			return false;
+		}
+
+		if (iargs->server)
+		{
+			fileStatus *status = eStat (filename);
+			uint64_t hash = (status->isNormalFile)? hashFileContents (filename): 0;
+			bool unchanged = updateInteractiveCache (filename, hash, (size_t) status->size);
+
+			eStatFree (status);
+			if (unchanged)
+			{
+				printUnchanged (filename, "generate-tags", id);
+				return true;
+			}
+		}
+		tagInteractiveFile (filename, NULL, filereq, id, iargs);
+	}
+	else
+	{					/* read nbytes from stream or a mapped file */
+		MIO *mio = openInlineContents (filereq, "generate-tags", iargs);
+
+		if (mio == NULL)
+			return false;
+
+		if (iargs->server)
+		{
+			size_t size;
+			/* SIZE is set here; it must not be read in the same call. */
+			uint64_t hash = hashInlineContents (mio, &size);
+
+			if (updateInteractiveCache (filename, hash, size))
+			{
+				mio_unref (mio);
+				printUnchanged (filename, "generate-tags", id);
+				return true;
+			}
+		}
+
+		tagInteractiveFile (filename, mio, filereq, id, iargs);
+		mio_unref (mio);
+	}
+	return true;
+}
+
+/* A file of a generate-tags-batch request. MIO is NULL for a file
+ * read from disk. */
+typedef struct sInteractiveFile {
+	const char *filename;
+	MIO *mio;
+	bool unchanged;
+	bool tagged;				/* tagged in this process */
+} interactiveFile;
+
+typedef struct sInteractiveBatch {
+	interactiveFile *files;
+	unsigned int count;
+} interactiveBatch;
+
+static bool runInteractiveBatch (void *data, unsigned int start, unsigned int end)
+{
+	interactiveBatch *batch = data;
+	bool resize = false;
+
+	for (unsigned int i = start; i < end; i++)
+	{
+		interactiveFile *file = batch->files + i;
+
+		if (file->unchanged)
+			continue;
+		file->tagged = true;
+		if (file->mio == NULL)
+			resize |= createTagsForEntry (file->filename);
+		else
+			resize |= parseFileWithMio (file->filename, file->mio, NULL);
+	}
+	return resize;
+}
+
+/* Tag the files of a generate-tags-batch request. The whole request,
+ * including the contents of the inline files, is read before tagging
+ * the files, so that they can be divided among the worker processes
+ * of --jobs=<N>. The tags are emitted in the order of the files. */
+static void generateTagsForBatch (json_t *request, json_t *id,
+								  struct interactiveModeArgs *iargs)
+{
+	json_t *files = json_object_get (request, "files");
+	interactiveBatch batch = { NULL, 0 };
+	const jobSpec spec = {
+		.what = "files of a batch request",
+		.run = runInteractiveBatch,
+		.data = &batch,
+	};
+
+	if (!files || !json_is_array (files))
+	{
+		error (FATAL, "invalid generate-tags-batch request");
+		return;
+	}
+
+	batch.count = (unsigned int) json_array_size (files);
+	batch.files = xCalloc (batch.count, interactiveFile);
+	for (unsigned int i = 0; i < batch.count; i++)
+	{
+		interactiveFile *file = batch.files + i;
+		json_t *filereq = json_array_get (files, i);
+
+		if (json_unpack (filereq, "{ss}", "filename", &file->filename) == -1)
+		{
+			error (FATAL, "invalid generate-tags-batch request");
+			goto out;
+		}
+		if (!isInlineRequest (filereq))
+		{
+			if (iargs->sandbox)
+			{
+				error (FATAL,
+					   "invalid request in sandbox submode: reading file contents from a file is limited");
+				goto out;
+			}
+		}
+		else if ((file->mio = openInlineContents (filereq, "generate-tags-batch", iargs)) == NULL)
+			goto out;
+	}
+
+	if (iargs->server)
+	{
+		for (unsigned int i = 0; i < batch.count; i++)
+		{
+			interactiveFile *file = batch.files + i;
+			uint64_t hash;
+			size_t size;
+
+			if (file->mio)
+				hash = hashInlineContents (file->mio, &size);
+			else
+			{
+				fileStatus *status = eStat (file->filename);
+				hash = (status->isNormalFile)? hashFileContents (file->filename): 0;
+				size = (size_t) status->size;
+				eStatFree (status);
+			}
+			file->unchanged = updateInteractiveCache (file->filename, hash, size);
+			if (file->unchanged)
+				printUnchanged (file->filename, "generate-tags-batch", id);
+			else
+			{
+				forgetInteractiveScopes (file->filename);
+				beginIndexingFile (file->filename);
+			}
+		}
+		setTagWriteObserver (observeInteractiveTag, NULL);
+	}
+
+	openTagFile ();
+	runJobs (&spec, batch.count, iargs->sandbox? 1: Option.jobs);
+	closeTagFile (false);
+
+	if (iargs->server)
+	{
+		/* The tags written in the worker processes are not seen. */
+		setTagWriteObserver (NULL, NULL);
+		for (unsigned int i = 0; i < batch.count; i++)
+			if (!batch.files [i].unchanged && !batch.files [i].tagged)
+				symbolIndexForgetFile (InteractiveIndex, batch.files [i].filename);
+		symbolIndexCommit (InteractiveIndex);
+	}
+	printCompleted ("generate-tags-batch", id);
+
+ out:
+	for (unsigned int i = 0; i < batch.count; i++)
+		if (batch.files [i].mio)
+			mio_unref (batch.files [i].mio);
+	eFree (batch.files);
+}
+
+static void printSymbol (const indexedSymbol *symbol, json_t *id)
+{
+	json_t *response = json_object ();
+
+	json_object_set_new (response, "_type", json_string ("symbol"));
+	json_object_set_new (response, "name", json_string (symbol->name));
+	json_object_set_new (response, "path", json_string (symbol->file));
+	json_object_set_new (response, "language", json_string (symbol->language));
+	json_object_set_new (response, "line", json_integer (symbol->line));
+	json_object_set_new (response, "kind", json_string (symbol->kind));
+	if (symbol->scope)
+	{
+		json_object_set_new (response, "scope", json_string (symbol->scope));
+		json_object_set_new (response, "scopeKind", json_string (symbol->scopeKind));
+	}
+	if (symbol->signature)
+		json_object_set_new (response, "signature", json_string (symbol->signature));
+	if (symbol->end)
+		json_object_set_new (response, "end", json_integer (symbol->end));
+	printResponse (response, id);
+}
+
+/* Answer a query about the definition tags of the files tagged in the
+ * server submode: find-definition with "name", list-members with
+ * "scope", or list-symbols with "filename". The symbols found, of
+ * "kind" if it is given, are printed in the order of their files and
+ * lines. Returns false after reporting an error. */
+static bool answerSymbolQuery (const char *const command, json_t *request,
+							   json_t *id, struct interactiveModeArgs *iargs)
+{
+	const char *key, *kind = NULL;
+	const ptrArray *found = NULL;
+	ptrArray *symbols;
+
+	if (!iargs->server)
+	{
+		error (FATAL, "%s is available only in the server submode", command);
+		return false;
+	}
+
+	if (json_unpack (request, "{ss}",
+					 !strcmp ("find-definition", command)? "name"
+					 : !strcmp ("list-members", command)? "scope": "filename",
+					 &key) == -1
+		|| (json_object_get (request, "kind")
+			&& json_unpack (request, "{ss}", "kind", &kind) == -1))
+	{
+		error (FATAL, "invalid %s request", command);
+		return false;
+	}
+
+	if (InteractiveIndex)
+	{
+		if (!strcmp ("find-definition", command))
+			found = symbolIndexFindByName (InteractiveIndex, key);
+		else if (!strcmp ("list-members", command))
+			found = symbolIndexFindByScope (InteractiveIndex, key);
+		else
+			found = symbolIndexFindByFile (InteractiveIndex, key);
+	}
+
+	symbols = ptrArrayNew (NULL);
+	for (unsigned int i = 0; found && i < ptrArrayCount (found); i++)
+	{
+		indexedSymbol *symbol = ptrArrayItem (found, i);
+
+		if (kind == NULL || !strcmp (kind, symbol->kind))
+			ptrArrayAdd (symbols, symbol);
+	}
+	symbolIndexSort (symbols);
+	for (unsigned int i = 0; i < ptrArrayCount (symbols); i++)
+		printSymbol (ptrArrayItem (symbols, i), id);
+	ptrArrayDelete (symbols);
+
+	printCompleted (command, id);
+	return true;
+}
+
+/* Report the statistics collected since START in the server submode,
+ * as a "metrics" object having "metrics", the statistics written by
+ * --metrics-format=json, or "text" for "format":"openmetrics". Returns
+ * false after reporting an error. */
+static bool answerMetrics (json_t *request, json_t *id,
+						   struct interactiveModeArgs *iargs,
+						   const statsTime *const start)
+{
+	const char *format = "json";
+	statsTime timeStamps [3];
+	json_t *response;
+	vString *text;
+	char buf [BUFSIZ];
+	size_t len;
+	FILE *fp;
+
+	if (!iargs->server)
+	{
+		error (FATAL, "metrics is available only in the server submode");
+		return false;
+	}
+
+	if ((json_object_get (request, "format")
+		 && json_unpack (request, "{ss}", "format", &format) == -1)
+		|| (strcmp (format, "json") && strcmp (format, "openmetrics")))
+	{
+		error (FATAL, "invalid metrics request");
+		return false;
+	}
+
+	fp = tmpfile ();
+	if (fp == NULL)
+	{
+		error (FATAL | PERROR, "cannot make a temporary file for metrics");
+		return false;
+	}
+
+	timeStamps [0] = *start;
+	readStatsTime (timeStamps + 1);
+	timeStamps [2] = timeStamps [1];
+	writeMetrics (fp, strcmp (format, "json")? METRICS_OPENMETRICS: METRICS_JSON,
+				  timeStamps);
+
+	text = vStringNew ();
+	rewind (fp);
+	while ((len = fread (buf, 1, sizeof (buf), fp)) > 0)
+		vStringNCatS (text, buf, len);
+	fclose (fp);
+
+	if (strcmp (format, "json"))
+	{
+		response = json_object ();
+		json_object_set_new (response, "_type", json_string ("metrics"));
+		json_object_set_new (response, "format", json_string (format));
+		json_object_set_new (response, "text", json_string (vStringValue (text)));
+		printResponse (response, id);
+	}
+	else
+	{
+		/* The statistics are spliced as they are; jansson would print
+		   the reals in them with 17 significant digits. */
+		vStringStripTrailing (text);
+		fprintf (stdout, "{\"_type\": \"metrics\", \"format\": \"json\", \"metrics\": %s",
+				 vStringValue (text));
+		if (id)
+		{
+			char *s = json_dumps (id, JSON_ENCODE_ANY);
+
+			fprintf (stdout, ", \"id\": %s", s);
+			free (s);
+		}
+		fputs ("}\n", stdout);
+	}
+	vStringDelete (text);
+
+	printCompleted ("metrics", id);
+	return true;
+}
+
 void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
 {
 	struct interactiveModeArgs *iargs = user;
@@ -412,18 +1484,23 @@ void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
 		}
 	}
 
-	char buffer[1024];
+	vString *buffer = vStringNew ();
 	json_t *request;
+	statsTime start;
+
+	if (iargs->server)
+		enableMetrics ();
+	readStatsTime (&start);
 
 	fputs ("{\"_type\": \"program\", \"name\": \"" PROGRAM_NAME "\", \"version\": \"" PROGRAM_VERSION "\"}\n", stdout);
 	fflush (stdout);
 
-	while (fgets (buffer, sizeof(buffer), stdin))
+	while (readInteractiveRequest (buffer, stdin))
 	{
-		if (buffer[0] == '\n')
+		if (vStringIsEmpty (buffer))
 			continue;
 
-		request = json_loads (buffer, JSON_DISABLE_EOF_CHECK, NULL);
+		request = json_loads (vStringValue (buffer), JSON_DISABLE_EOF_CHECK, NULL);
 		if (! request)
 		{
 			error (FATAL, "invalid json");
@@ -437,44 +1514,42 @@ void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
 			goto next;
 		}
 
+		json_t *id = json_object_get (request, "id");
+
 		if (!strcmp ("generate-tags", json_string_value (command)))
 		{
-			json_int_t size = -1;
-			const char *filename;
+			json_t *files = json_object_get (request, "files");
 
-			if (json_unpack (request, "{ss}", "filename", &filename) == -1)
+			if (files && !json_is_array (files))
 			{
 				error (FATAL, "invalid generate-tags request");
 				goto next;
 			}
 
-			json_unpack (request, "{sI}", "size", &size);
-
 			openTagFile ();
-			if (size == -1)
-			{					/* read from disk */
-				if (iargs->sandbox) {
-					error (FATAL,
-						   "invalid request in sandbox submode: reading file contents from a file is limited");
-					closeTagFile (false);
-					goto next;
-				}
-
-				createTagsForEntry (filename);
+			if (files)
+			{
+				/* A batch request: all the files are tagged before
+				   reporting the completion. */
+				for (size_t i = 0; i < json_array_size (files); i++)
+					generateTagsForRequest (json_array_get (files, i), id, iargs);
 			}
-			else
-			{					/* read nbytes from stream */
-				unsigned char *data = eMalloc (size);
-				size = fread (data, 1, size, stdin);
-				MIO *mio = mio_new_memory (data, size, eRealloc, eFreeNoNullCheck);
-				parseFileWithMio (filename, mio, NULL);
-				mio_unref (mio);
+			else if (!generateTagsForRequest (request, id, iargs))
+			{
+				closeTagFile (false);
+				goto next;
 			}
-
 			closeTagFile (false);
-			fputs ("{\"_type\": \"completed\", \"command\": \"generate-tags\"}\n", stdout);
-			fflush(stdout);
+			printCompleted ("generate-tags", id);
 		}
+		else if (!strcmp ("generate-tags-batch", json_string_value (command)))
+			generateTagsForBatch (request, id, iargs);
+		else if (!strcmp ("find-definition", json_string_value (command))
+				 || !strcmp ("list-members", json_string_value (command))
+				 || !strcmp ("list-symbols", json_string_value (command)))
+			answerSymbolQuery (json_string_value (command), request, id, iargs);
+		else if (!strcmp ("metrics", json_string_value (command)))
+			answerMetrics (request, id, iargs, &start);
 		else
 		{
 			error (FATAL, "unknown command name");
@@ -484,6 +1559,7 @@ void interactiveLoop (cookedArgs *args CTAGS_ATTR_UNUSED, void *user)
 	next:
 		json_decref (request);
 	}
+	vStringDelete (buffer);
 }
 #endif
 
@@ -583,7 +1659,15 @@ extern int ctags_cli_main (int argc CTAGS_ATTR_UNUSED, char **argv)
 	parseCmdlineOptions (args);
 	checkOptions ();
 
+#ifdef ALLOC_STATS
+	setAllocationLanguageFunc (getInputLanguageIfAny);
+#endif
 	runMainLoop (args);
+	finishEventTrace ();
+#ifdef ALLOC_STATS
+	if (Option.allocStatsSites)
+		printAllocationStats (stderr, Option.allocStatsSites, getLanguageName);
+#endif
 
 	/*  Clean up.
 	 */
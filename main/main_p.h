@@ -14,9 +14,14 @@
 */
 #include "general.h"  /* must always come first */
 
+#include "options_p.h"
+
 /*
 *   FUNCTION PROTOTYPES
 */
 extern int ctags_cli_main (int argc, char **argv);
 
+/* The main loop making the tag file once */
+extern void batchMakeTags (cookedArgs *args, void *user);
+
 #endif  /* CTAGS_MAIN_MAIN_PRIVATE_H */
@@ -0,0 +1,458 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for the manifest used in incremental
+*   mode (--incremental).
+*
+*   The manifest is a file placed next to the tag file. It records the
+*   modification time, the size, a hash of the contents, and the language
+*   for each input file parsed to make the tag file. In the next run, an
+*   input file whose record matches the file on the disk is not parsed
+*   again; its tags are taken from the old tag file instead, and its
+*   language is taken from the record instead of guessing it again. The
+*   tags of an input file are found by the input field of the tag lines,
+*   so the old tag file can be sorted or not.
+*
+*   The hash of a changed input file is computed from the stream opened
+*   for parsing it, so the file is read once.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "entry_p.h"
+#include "htable.h"
+#include "manifest_p.h"
+#include "options_p.h"
+#include "parse_p.h"
+#include "ptag_p.h"
+#include "ptrarray.h"
+#include "read.h"
+#include "read_p.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define MANIFEST_SUFFIX ".manifest"
+#define OLD_TAG_FILE_SUFFIX ".prev"
+#define MANIFEST_HEADER "!_CTAGS_MANIFEST\t2"
+#define MANIFEST_HEADER_V1 "!_CTAGS_MANIFEST\t1"	/* without languages */
+#define NO_LANGUAGE "-"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sManifestEntry {
+	char *name;
+	time_t mtime;
+	unsigned long size;
+	uint64_t hash;				/* 0 if unknown */
+	char *language;				/* NULL if unknown */
+	bool hashed;				/* false until hash is computed */
+} manifestEntry;
+
+/*
+*   DATA DEFINITIONS
+*/
+static char *ManifestName;
+static char *OldTagFileName;	/* NULL if no tag is reusable */
+static hashTable *OldEntries;	/* name -> manifestEntry */
+static ptrArray *NewEntries;
+static hashTable *NewEntryTable;	/* name -> an item of NewEntries */
+static hashTable *ReusedTagPaths;	/* the input fields of reusable tags */
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static char *makeFileNameWithSuffix (const char *const fileName,
+									 const char *const suffix)
+{
+	vString *v = vStringNewInit (fileName);
+
+	vStringCatS (v, suffix);
+	return vStringDeleteUnwrap (v);
+}
+
+static void deleteManifestEntry (void *data)
+{
+	manifestEntry *entry = data;
+
+	eFree (entry->name);
+	if (entry->language)
+		eFree (entry->language);
+	eFree (entry);
+}
+
+static manifestEntry *newManifestEntry (const char *const name, time_t mtime,
+										unsigned long size, uint64_t hash,
+										const char *const language)
+{
+	manifestEntry *entry = xMalloc (1, manifestEntry);
+
+	entry->name = eStrdup (name);
+	entry->mtime = mtime;
+	entry->size = size;
+	entry->hash = hash;
+	entry->language = language? eStrdup (language): NULL;
+	entry->hashed = true;
+	return entry;
+}
+
+static bool parseManifestLine (char *line, hashTable *entries,
+							   bool withLanguage)
+{
+	char *p = line;
+	char *end;
+	long long mtime;
+	unsigned long size;
+	unsigned long long hash;
+	const char *language = NULL;
+
+	mtime = strtoll (p, &end, 10);
+	if (end == p || *end != '\t')
+		return false;
+	p = end + 1;
+
+	size = strtoul (p, &end, 10);
+	if (end == p || *end != '\t')
+		return false;
+	p = end + 1;
+
+	hash = strtoull (p, &end, 16);
+	if (end == p || *end != '\t')
+		return false;
+	p = end + 1;
+
+	if (withLanguage)
+	{
+		end = strchr (p, '\t');
+		if (end == NULL || end == p)
+			return false;
+		*end = '\0';
+		language = (strcmp (p, NO_LANGUAGE) == 0)? NULL: p;
+		p = end + 1;
+	}
+
+	if (*p == '\0')
+		return false;
+
+	if (!hashTableHasItem (entries, p))
+	{
+		manifestEntry *entry = newManifestEntry (p, (time_t) mtime, size,
+												 (uint64_t) hash, language);
+		hashTablePutItem (entries, entry->name, entry);
+	}
+	return true;
+}
+
+static hashTable *readManifest (const char *const manifestName)
+{
+	MIO *mio = mio_new_file (manifestName, "r");
+	hashTable *entries;
+	vString *vLine;
+	bool ok = true;
+	bool withLanguage = true;
+
+	if (mio == NULL)
+		return NULL;
+
+	entries = hashTableNew (1024, hashCstrhash, hashCstreq,
+							NULL, deleteManifestEntry);
+	vLine = vStringNew ();
+
+	if (readLineRaw (vLine, mio) == NULL)
+		ok = false;
+	else
+	{
+		vStringStripNewline (vLine);
+		if (strcmp (vStringValue (vLine), MANIFEST_HEADER_V1) == 0)
+			withLanguage = false;
+		else
+			ok = (strcmp (vStringValue (vLine), MANIFEST_HEADER) == 0);
+	}
+
+	while (ok && readLineRaw (vLine, mio) != NULL)
+	{
+		vStringStripNewline (vLine);
+		ok = parseManifestLine (vStringValue (vLine), entries, withLanguage);
+	}
+
+	vStringDelete (vLine);
+	mio_unref (mio);
+
+	if (!ok)
+	{
+		error (WARNING, "ignoring broken manifest: %s", manifestName);
+		hashTableDelete (entries);
+		return NULL;
+	}
+	return entries;
+}
+
+extern void loadManifest (const char *const tagFileName)
+{
+	ManifestName = makeFileNameWithSuffix (tagFileName, MANIFEST_SUFFIX);
+	NewEntries = ptrArrayNew (deleteManifestEntry);
+	NewEntryTable = hashTableNew (1024, hashCstrhash, hashCstreq, NULL, NULL);
+	ReusedTagPaths = hashTableNew (1024, hashCstrhash, hashCstreq,
+								   eFree, NULL);
+
+	if (!doesFileExist (tagFileName))
+		return;
+
+	OldEntries = readManifest (ManifestName);
+	if (OldEntries == NULL)
+	{
+		/* A new tag file is made instead of rewriting the old one,
+		 * which may be linked to the tag file published by --watch. */
+		remove (tagFileName);
+		return;
+	}
+
+	OldTagFileName = makeFileNameWithSuffix (tagFileName, OLD_TAG_FILE_SUFFIX);
+	if (rename (tagFileName, OldTagFileName) != 0)
+	{
+		error (WARNING | PERROR, "cannot move \"%s\" aside; parsing all input files",
+			   tagFileName);
+		eFree (OldTagFileName);
+		OldTagFileName = NULL;
+		hashTableDelete (OldEntries);
+		OldEntries = NULL;
+		return;
+	}
+
+	verbose ("loaded manifest %s (%u entries)\n", ManifestName,
+			 hashTableCountItem (OldEntries));
+}
+
+static void rememberReusedTagPathKey (char *key)
+{
+	if (hashTableHasItem (ReusedTagPaths, key))
+		eFree (key);
+	else
+		hashTablePutItem (ReusedTagPaths, key, key);
+}
+
+static void rememberReusedTagPath (const char *const fileName)
+{
+	vString *id = makeTagFileInputFileId (fileName);
+
+	rememberReusedTagPathKey (vStringDeleteUnwrap (makeTagFileInputField (fileName)));
+
+	/* The old tags may refer to the file by its id. The pseudo tag
+	 * defining the id is written again as the old one is dropped. */
+	if (id)
+		rememberReusedTagPathKey (vStringDeleteUnwrap (id));
+}
+
+/* Return the language recorded for the unchanged input file OLD, or
+ * guess it if the record has no usable language. */
+static langType getLanguageOfUnchangedFile (const manifestEntry *const old)
+{
+	if (old->language && Option.language == LANG_AUTO)
+	{
+		langType lang = getNamedLanguage (old->language, 0);
+
+		if (lang != LANG_IGNORE && isLanguageEnabled (lang))
+		{
+			verbose ("	language of \"%s\" in manifest: %s\n",
+					 old->name, old->language);
+			return lang;
+		}
+	}
+	return getLanguageForFilenameAndContents (old->name);
+}
+
+extern bool registerManifestInputFile (const char *const fileName,
+									   const fileStatus *const status)
+{
+	manifestEntry *old = OldEntries? hashTableGetItem (OldEntries, fileName): NULL;
+	manifestEntry *entry;
+	uint64_t hash = 0;
+	bool reusable = false;
+
+	if (old && old->size == status->size)
+	{
+		if (old->mtime == status->mtime)
+		{
+			hash = old->hash;
+			reusable = true;
+		}
+		else
+		{
+			hash = hashFileContents (fileName);
+			reusable = (hash != 0 && hash == old->hash);
+		}
+	}
+
+	entry = newManifestEntry (fileName, status->mtime, status->size, hash,
+							  NULL);
+	/* The hash of a file to be parsed is computed with
+	 * noteManifestInputFile () while parsing. */
+	entry->hashed = (reusable || hash != 0);
+	ptrArrayAdd (NewEntries, entry);
+	if (!hashTableHasItem (NewEntryTable, entry->name))
+		hashTablePutItem (NewEntryTable, entry->name, entry);
+
+	if (reusable)
+	{
+		langType lang = getLanguageOfUnchangedFile (old);
+
+		verbose ("reusing tags for unchanged \"%s\"\n", fileName);
+		rememberReusedTagPath (fileName);
+		if (lang != LANG_IGNORE)
+		{
+			entry->language = eStrdup (getLanguageName (lang));
+			makeParserPseudoTags (lang);
+		}
+	}
+	return reusable;
+}
+
+extern void noteManifestInputFile (const char *const fileName,
+								   langType language, MIO *mio)
+{
+	manifestEntry *entry;
+
+	if (NewEntryTable == NULL)
+		return;
+
+	entry = hashTableGetItem (NewEntryTable, fileName);
+	if (entry == NULL)
+		return;
+
+	if (language != LANG_IGNORE && entry->language == NULL)
+		entry->language = eStrdup (getLanguageName (language));
+	if (mio && !entry->hashed)
+	{
+		entry->hash = hashMioContents (mio);
+		entry->hashed = true;
+	}
+}
+
+static bool isReusableTag (const char *const line, vString *field)
+{
+	const char *start = strchr (line, '\t');
+	const char *end;
+
+	if (start == NULL)
+		return false;
+	start++;
+	end = strchr (start, '\t');
+	if (end == NULL)
+		return false;
+
+	vStringNCopyS (field, start, end - start);
+	return hashTableHasItem (ReusedTagPaths, vStringValue (field));
+}
+
+extern void reuseTagsInManifest (void)
+{
+	MIO *mio;
+	vString *vLine;
+	vString *field;
+	unsigned long count = 0;
+
+	if (OldTagFileName == NULL)
+		return;
+
+	mio = mio_new_file (OldTagFileName, "r");
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open \"%s\"", OldTagFileName);
+
+	vLine = vStringNew ();
+	field = vStringNew ();
+	while (readLineRaw (vLine, mio) != NULL)
+	{
+		const char *line = vStringValue (vLine);
+		bool reusable;
+
+		/* Pseudo tags are made in this run. */
+		if (strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+			reusable = false;
+		else
+			reusable = isReusableTag (line, field);
+
+		if (reusable)
+		{
+			if (vStringLast (vLine) != '\n')
+				vStringPut (vLine, '\n');
+			copyLineToTagFile (vStringValue (vLine));
+			count++;
+		}
+	}
+	if (mio_error (mio))
+		error (FATAL | PERROR, "cannot read \"%s\"", OldTagFileName);
+
+	verbose ("reused %lu tags from %s\n", count, OldTagFileName);
+
+	vStringDelete (field);
+	vStringDelete (vLine);
+	mio_unref (mio);
+}
+
+extern void saveManifest (void)
+{
+	MIO *mio;
+
+	if (ManifestName == NULL)
+		return;
+
+	mio = mio_new_file (ManifestName, "w");
+	if (mio == NULL)
+		error (FATAL | PERROR, "cannot open manifest \"%s\"", ManifestName);
+
+	mio_puts (mio, MANIFEST_HEADER "\n");
+	for (unsigned int i = 0; i < ptrArrayCount (NewEntries); i++)
+	{
+		manifestEntry *entry = ptrArrayItem (NewEntries, i);
+
+		/* A file parsed in a worker process (--jobs), or not opened
+		 * at all, is hashed here. */
+		if (!entry->hashed)
+			entry->hash = hashFileContents (entry->name);
+		mio_printf (mio, "%lld\t%lu\t%016llx\t%s\t%s\n",
+					(long long) entry->mtime, entry->size,
+					(unsigned long long) entry->hash,
+					entry->language? entry->language: NO_LANGUAGE,
+					entry->name);
+	}
+	if (mio_unref (mio) != 0)
+		error (FATAL | PERROR, "cannot write manifest \"%s\"", ManifestName);
+
+	if (OldTagFileName)
+	{
+		remove (OldTagFileName);
+		eFree (OldTagFileName);
+		OldTagFileName = NULL;
+	}
+	if (OldEntries)
+	{
+		hashTableDelete (OldEntries);
+		OldEntries = NULL;
+	}
+	hashTableDelete (ReusedTagPaths);
+	ReusedTagPaths = NULL;
+	hashTableDelete (NewEntryTable);
+	NewEntryTable = NULL;
+	ptrArrayDelete (NewEntries);
+	NewEntries = NULL;
+	eFree (ManifestName);
+	ManifestName = NULL;
+}
@@ -0,0 +1,47 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for the manifest used in incremental mode.
+*/
+#ifndef CTAGS_MAIN_MANIFEST_PRIVATE_H
+#define CTAGS_MAIN_MANIFEST_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "mio.h"
+#include "routines_p.h"
+#include "types.h"
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Load the manifest for TAGFILENAME if both of them exist.
+ * The tag file is moved aside so that it can be rewritten while the tags
+ * for unchanged input files are taken from the old one. */
+extern void loadManifest (const char *const tagFileName);
+
+/* Record FILENAME in the new manifest.
+ * Returns true if the file is unchanged since the last run, and the tags
+ * for the file can be taken from the old tag file. */
+extern bool registerManifestInputFile (const char *const fileName,
+									   const fileStatus *const status);
+
+/* Record LANGUAGE chosen for FILENAME and the hash of its contents
+ * read from MIO, the stream opened for parsing it. MIO can be NULL. */
+extern void noteManifestInputFile (const char *const fileName,
+								   langType language, MIO *mio);
+
+/* Write the tags for the unchanged input files to the tag file. */
+extern void reuseTagsInManifest (void);
+
+/* Write the new manifest and release the old one. */
+extern void saveManifest (void);
+
+#endif	/* CTAGS_MAIN_MANIFEST_PRIVATE_H */
@@ -23,6 +23,9 @@
 #include <string.h>
 #include <iconv.h>
 #include <errno.h>
+#include <stdint.h>
+#include <stddef.h>
+#include "bytescan.h"
 #include "options.h"
 #include "mbcs.h"
 #include "mbcs_p.h"
@@ -30,6 +33,51 @@
 
 static iconv_t iconv_fd = (iconv_t) -1;
 
+/* The converter is kept open after closeConverter () and reused for
+ * the next input file if the encodings are the same; iconv_open () is
+ * not cheap. */
+static struct sConverter {
+	char *inputEncoding;
+	char *outputEncoding;
+	bool active;
+	/* Each ASCII character is converted to itself. */
+	bool asciiTransparent;
+	/* The destination of the conversions, reused. */
+	char *buffer;
+	size_t size;
+} Converter;
+
+static void resetConverter (void)
+{
+	iconv (iconv_fd, NULL, NULL, NULL, NULL);
+}
+
+static bool isAsciiTransparent (void)
+{
+	char src [128];
+	char dest [sizeof src * 4];
+	char *src_ptr = src, *dest_ptr = dest;
+	size_t src_len = sizeof src, dest_len = sizeof dest;
+	bool r;
+
+	for (unsigned int i = 0; i < sizeof src; i++)
+		src [i] = (char) i;
+
+	r = (iconv (iconv_fd, &src_ptr, &src_len, &dest_ptr, &dest_len) != (size_t) -1
+		 && src_len == 0
+		 && (size_t) (dest_ptr - dest) == sizeof src
+		 && memcmp (src, dest, sizeof src) == 0);
+	resetConverter ();
+	return r;
+}
+
+static bool isAsciiString (const char *s, size_t len)
+{
+	const unsigned char *end = (const unsigned char *) s + len;
+
+	return findNonAscii ((const unsigned char *) s, end) == end;
+}
+
 extern bool openConverter (const char* inputEncoding, const char* outputEncoding)
 {
 	if (!inputEncoding || !outputEncoding)
@@ -43,6 +91,17 @@ extern bool openConverter (const char* inputEncoding, const char* outputEncoding
 		}
 		return false;
 	}
+
+	if (iconv_fd != (iconv_t) -1
+		&& strcmp (Converter.inputEncoding, inputEncoding) == 0
+		&& strcmp (Converter.outputEncoding, outputEncoding) == 0)
+	{
+		resetConverter ();
+		Converter.active = true;
+		return true;
+	}
+
+	freeConverterResources ();
 	iconv_fd = iconv_open(outputEncoding, inputEncoding);
 	if (iconv_fd == (iconv_t) -1)
 	{
@@ -50,64 +109,103 @@ extern bool openConverter (const char* inputEncoding, const char* outputEncoding
 					"failed opening encoding from '%s' to '%s'", inputEncoding, outputEncoding);
 		return false;
 	}
+	Converter.inputEncoding = eStrdup (inputEncoding);
+	Converter.outputEncoding = eStrdup (outputEncoding);
+	Converter.asciiTransparent = isAsciiTransparent ();
+	Converter.active = true;
 	return true;
 }
 
 extern bool isConverting (void)
 {
-	return iconv_fd != (iconv_t) -1;
+	return Converter.active;
+}
+
+static char *growConverterBuffer (size_t used, size_t least)
+{
+	size_t size = Converter.size? Converter.size: 256;
+
+	while (size < least)
+		size *= 2;
+	if (size > Converter.size)
+	{
+		Converter.buffer = eRealloc (Converter.buffer, size);
+		Converter.size = size;
+	}
+	return Converter.buffer + used;
 }
 
 extern bool convertString (vString *const string)
 {
 	size_t dest_len, src_len;
-	char *dest, *dest_ptr, *src;
-	if (iconv_fd == (iconv_t) -1)
+	char *dest_ptr, *src;
+	if (!Converter.active)
 		return false;
 	src_len = vStringLength (string);
-	/* Should be longest length of bytes. so maybe utf8. */
-	dest_len = src_len * 4;
-	dest_ptr = dest = xCalloc (dest_len, char);
-	if (!dest)
-		return false;
 	src = vStringValue (string);
-retry:
-	if (iconv (iconv_fd, &src, &src_len, &dest_ptr, &dest_len) == (size_t) -1)
+	if (Converter.asciiTransparent && isAsciiString (src, src_len))
+		return true;
+
+	/* Should be longest length of bytes. so maybe utf8. */
+	dest_ptr = growConverterBuffer (0, src_len * 4 + 1);
+	dest_len = Converter.size - 1;
+	while (iconv (iconv_fd, &src, &src_len, &dest_ptr, &dest_len) == (size_t) -1)
 	{
-		if (errno == EILSEQ)
+		size_t used = dest_ptr - Converter.buffer;
+
+		if (errno == E2BIG || (errno == EILSEQ && dest_len == 0))
+		{
+			dest_ptr = growConverterBuffer (used, Converter.size * 2);
+			dest_len = Converter.size - used - 1;
+		}
+		else if (errno == EILSEQ)
 		{
 			*dest_ptr++ = '?';
 			dest_len--;
 			src++;
 			src_len--;
 			verbose ("  Encoding: %s\n", strerror(errno));
-			goto retry;
 		}
-		eFree (dest);
-		return false;
+		else
+		{
+			resetConverter ();
+			return false;
+		}
 	}
 
-	dest_len = dest_ptr - dest;
+	dest_len = dest_ptr - Converter.buffer;
 
 	vStringClear (string);
 	if (vStringSize (string) < dest_len + 1)
 		vStringResize (string, dest_len + 1);
-	memcpy (vStringValue (string), dest, dest_len + 1);
+	memcpy (vStringValue (string), Converter.buffer, dest_len);
 	vStringLength (string) = dest_len;
-	eFree (dest);
+	vStringValue (string) [dest_len] = '\0';
 
-	iconv (iconv_fd, NULL, NULL, NULL, NULL);
+	resetConverter ();
 
 	return true;
 }
 
 extern void closeConverter (void)
+{
+	Converter.active = false;
+}
+
+extern void freeConverterResources (void)
 {
 	if (iconv_fd != (iconv_t) -1)
 	{
 		iconv_close(iconv_fd);
 		iconv_fd = (iconv_t) -1;
 	}
+	if (Converter.inputEncoding)
+		eFree (Converter.inputEncoding);
+	if (Converter.outputEncoding)
+		eFree (Converter.outputEncoding);
+	if (Converter.buffer)
+		eFree (Converter.buffer);
+	memset (&Converter, 0, sizeof Converter);
 }
 
 #endif	/* HAVE_ICONV */
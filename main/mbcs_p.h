@@ -26,6 +26,7 @@
 extern bool openConverter (const char*, const char*);
 extern bool convertString (vString *const);
 extern void closeConverter (void);
+extern void freeConverterResources (void);
 
 #endif /* HAVE_ICONV */
 
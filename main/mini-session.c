@@ -0,0 +1,93 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Provides a simple application running the parsers through the session
+*   interface of libctags.a. "make tlib" compares its output with
+*   misc/mini-session.expected.
+*/
+
+#include "general.h"  /* must always come first */
+
+#include "parse_p.h"
+#include "session.h"
+
+#include <stdio.h>
+
+static const char cSource[] =
+	"struct point { int x; int y; };\n"
+	"int area (struct point *p)\n"
+	"{\n"
+	"	int a = p->x * p->y;\n"
+	"	return a;\n"
+	"}\n";
+
+static const char pythonSource[] =
+	"class Shape:\n"
+	"    def area(self):\n"
+	"        return 0\n";
+
+
+static unsigned int tagCount;
+
+
+static void printTag (const tagEntryInfo *const tag, void *data CTAGS_ATTR_UNUSED)
+{
+	kindDefinition *kdef = getLanguageKind (tag->langType, tag->kindIndex);
+
+	printf ("%s\t%s\tline: %lu\tkind: %s\tlang: %s",
+			tag->name, tag->inputFileName, tag->lineNumber,
+			kdef->name, getLanguageName (tag->langType));
+	if (tag->extensionFields.scopeName)
+		printf ("\tscope: %s", tag->extensionFields.scopeName);
+	putchar ('\n');
+
+	tagCount++;
+}
+
+
+static void parse (ctagsSession *session, const char *fileName,
+				   const char *source, size_t size, const char *language)
+{
+	bool r;
+
+	tagCount = 0;
+	printf ("Parsing %s as %s:\n", fileName, language? language: "guessed");
+	r = ctagsSessionParse (session, fileName,
+						   (const unsigned char *)source, size, language);
+	printf ("%s, %u tag(s)\n\n", r? "parsed": "no parser", tagCount);
+}
+
+
+extern int main (int argc CTAGS_ATTR_UNUSED, char **argv CTAGS_ATTR_UNUSED)
+{
+	static const ctagsSessionCallbacks callbacks = {
+		.tag = printTag,
+	};
+	const char *const options[] = { "--kinds-C=+l", NULL };
+	const char *const pythonOptions[] = { "--kinds-Python=-m", NULL };
+	const char *const badOptions[] = { "input.c", NULL };
+	ctagsSession *session;
+
+	/* Parsing more than one input in a session */
+	session = ctagsSessionNew (options, &callbacks, NULL);
+	parse (session, "point.c", cSource, sizeof (cSource) - 1, "C");
+	parse (session, "shape.py", pythonSource, sizeof (pythonSource) - 1, NULL);
+	parse (session, "shape.unknown", pythonSource, sizeof (pythonSource) - 1, NULL);
+	parse (session, "point.c", cSource, sizeof (cSource) - 1, "NoSuchLanguage");
+	ctagsSessionDelete (session);
+
+	/* The parsers are reused, and the options are applied on top of
+	 * the ones of the first session. */
+	session = ctagsSessionNew (pythonOptions, &callbacks, NULL);
+	parse (session, "shape.py", pythonSource, sizeof (pythonSource) - 1, "Python");
+	parse (session, "point.c", cSource, sizeof (cSource) - 1, NULL);
+	ctagsSessionDelete (session);
+
+	printf ("A non-option argument is %s\n",
+			ctagsSessionNew (badOptions, &callbacks, NULL)? "accepted": "rejected");
+
+	return 0;
+}
@@ -48,6 +48,23 @@
 #include <unistd.h>
 #endif
 
+/* A MIO is read by a thread at a time, so the lock of the FILE taken for
+ * each character by fgetc() is not needed. */
+#if defined (HAVE_GETC_UNLOCKED)
+#define fgetc_nolock getc_unlocked
+#elif defined (_MSC_VER)
+#define fgetc_nolock _fgetc_nolock
+#else
+#define fgetc_nolock fgetc
+#endif
+
+#ifdef HAVE_MMAP
+#include <fcntl.h>
+#include <stdint.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 #ifdef READTAGS_DSL
 #define xMalloc(n,Type)    (Type *)eMalloc((size_t)(n) * sizeof (Type))
 #define xRealloc(p,n,Type) (Type *)eRealloc((p), (n) * sizeof (Type))
@@ -155,6 +172,7 @@ struct _MIO {
 			size_t allocated_size;
 			MIOReallocFunc realloc_func;
 			MIODestroyNotify free_func;
+			bool mapped;
 			bool error;
 			bool eof;
 		} mem;
@@ -336,6 +354,7 @@ MIO *mio_new_memory (unsigned char *data,
 		mio->impl.mem.allocated_size = size;
 		mio->impl.mem.realloc_func = realloc_func;
 		mio->impl.mem.free_func = free_func;
+		mio->impl.mem.mapped = false;
 		mio->impl.mem.eof = false;
 		mio->impl.mem.error = false;
 		mio->refcount = 1;
@@ -346,6 +365,58 @@ MIO *mio_new_memory (unsigned char *data,
 	return mio;
 }
 
+#ifdef HAVE_MMAP
+/**
+ * mio_new_mmap:
+ * @filename: Filename to map
+ *
+ * Creates a new #MIO object working on the contents of the given file
+ * mapped into memory. The stream is a memory stream: mio_memory_get_data()
+ * returns the mapped contents without copying them. The mapping is
+ * private; writes on the stream are not carried to the file, and the
+ * stream cannot grow.
+ *
+ * The file must not be truncated while the stream is alive.
+ *
+ * Free-function: mio_unref()
+ *
+ * Returns: A new #MIO on success, or %NULL on failure or if the file is
+ *          empty.
+ */
+MIO *mio_new_mmap (const char *filename)
+{
+	MIO *mio = NULL;
+	struct stat st;
+	void *addr;
+	int fd;
+
+	fd = open (filename, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	if (fstat (fd, &st) != 0 || st.st_size <= 0
+		|| (uintmax_t) st.st_size > (uintmax_t) SIZE_MAX)
+	{
+		close (fd);
+		return NULL;
+	}
+
+	addr = mmap (NULL, (size_t) st.st_size, PROT_READ | PROT_WRITE,
+				 MAP_PRIVATE, fd, 0);
+	close (fd);
+	if (addr == MAP_FAILED)
+		return NULL;
+
+	mio = mio_new_memory (addr, (size_t) st.st_size, NULL, NULL);
+	if (mio)
+		mio->impl.mem.mapped = true;
+	else
+		munmap (addr, (size_t) st.st_size);
+
+	return mio;
+}
+#endif
+
 /**
  * mio_new_mio:
  * @base: The original mio
@@ -389,7 +460,9 @@ MIO *mio_new_mio (MIO *base, long start, long size)
 	if (mio_seek (base, start, SEEK_SET) != 0)
 		return NULL;
 
-	data = xMalloc (size, unsigned char);
+	/* Terminated as the input files read into memory are. */
+	data = xMalloc (size + 1, unsigned char);
+	data [size] = '\0';
 	r= mio_read (base, data, 1, size);
 	mio_seek (base, original_pos, SEEK_SET);
 
@@ -473,6 +546,42 @@ unsigned char *mio_memory_get_data (MIO *mio, size_t *size)
 	return ptr;
 }
 
+/**
+ * mio_memory_get_data_at:
+ * @mio: A #MIO object
+ * @pos: A position of @mio obtained with mio_getpos()
+ * @size: (allow-none) (out): Return location for the length of the memory
+ *        from @pos to the end of the buffer, or %NULL
+ *
+ * Gets the underlying memory buffer associated with a #MIO memory stream
+ * at the position @pos. Unlike mio_setpos(), this doesn't change the
+ * state of the stream.
+ *
+ * The same warning as mio_memory_get_data() applies to the returned
+ * pointer and size.
+ *
+ * Returns: The memory buffer of the given #MIO stream at @pos, or %NULL if
+ *          the stream is not a memory stream or @pos is out of the buffer.
+ */
+unsigned char *mio_memory_get_data_at (MIO *mio, const MIOPos *pos, size_t *size)
+{
+	unsigned char *ptr = NULL;
+
+	if (mio->type == MIO_TYPE_MEMORY && pos->type == MIO_TYPE_MEMORY
+		&& pos->impl.mem <= mio->impl.mem.size)
+	{
+#ifdef MIO_DEBUG
+		if (pos->tag != mio)
+			return NULL;
+#endif
+		ptr = mio->impl.mem.buf + pos->impl.mem;
+		if (size)
+			*size = mio->impl.mem.size - pos->impl.mem;
+	}
+
+	return ptr;
+}
+
 /**
  * mio_unref:
  * @mio: A #MIO object
@@ -503,6 +612,10 @@ int mio_unref (MIO *mio)
 		}
 		else if (mio->type == MIO_TYPE_MEMORY)
 		{
+#ifdef HAVE_MMAP
+			if (mio->impl.mem.mapped)
+				munmap (mio->impl.mem.buf, mio->impl.mem.allocated_size);
+#endif
 			if (mio->impl.mem.free_func)
 				mio->impl.mem.free_func (mio->impl.mem.buf);
 			mio->impl.mem.buf = NULL;
@@ -623,7 +736,10 @@ static int mem_try_resize (MIO *mio, size_t new_size)
 					size_t newsize;
 					unsigned char *newbuf;
 
-					newsize = MAX (mio->impl.mem.allocated_size + MIO_CHUNK_SIZE,
+					/* Growing geometrically keeps the cost of writing
+					 * a large buffer linear. */
+					newsize = MAX (mio->impl.mem.allocated_size
+								   + MAX (mio->impl.mem.allocated_size / 2, MIO_CHUNK_SIZE),
 								   new_size);
 					newbuf = mio->impl.mem.realloc_func (mio->impl.mem.buf, newsize);
 					if (newbuf)
@@ -909,7 +1025,7 @@ int mio_printf (MIO *mio, const char *format, ...)
 int mio_getc (MIO *mio)
 {
 	if (mio->type == MIO_TYPE_FILE)
-		return fgetc (mio->impl.file.fp);
+		return fgetc_nolock (mio->impl.file.fp);
 	else if (mio->type == MIO_TYPE_MEMORY)
 	{
 		int rv = EOF;
@@ -1045,6 +1161,48 @@ char *mio_gets (MIO *mio, char *s, size_t size)
 	}
 }
 
+/**
+ * mio_memory_gets:
+ * @mio: A #MIO object
+ * @length: (out): Return location for the length of the line
+ *
+ * Reads a line from a #MIO memory stream without copying it, stopping after
+ * the first new-line character or at the end of the stream. This behaves
+ * the same as mio_gets() with a buffer large enough for the line, except
+ * that the returned line is a part of the buffer of the stream, and is not
+ * terminated with '\0'.
+ *
+ * The same warning as mio_memory_get_data() applies to the returned
+ * pointer.
+ *
+ * Returns: The line on success, %NULL if the stream is not a memory
+ *          stream, a character is pushed back with mio_ungetc(), or at the
+ *          end of the stream.
+ */
+const char *mio_memory_gets (MIO *mio, size_t *length)
+{
+	const unsigned char *line;
+	const unsigned char *newline;
+	size_t size;
+
+	if (mio->type != MIO_TYPE_MEMORY
+		|| mio->impl.mem.ungetch != EOF
+		|| mio->impl.mem.pos >= mio->impl.mem.size)
+		return NULL;
+
+	line = mio->impl.mem.buf + mio->impl.mem.pos;
+	size = mio->impl.mem.size - mio->impl.mem.pos;
+	newline = memchr (line, '\n', size);
+	if (newline)
+		size = newline - line + 1;
+	else
+		mio->impl.mem.eof = true;
+	mio->impl.mem.pos += size;
+
+	*length = size;
+	return (const char *) line;
+}
+
 /**
  * mio_clearerr:
  * @mio: A #MIO object
@@ -1347,6 +1505,62 @@ int mio_setpos (MIO *mio, MIOPos *pos)
 	return rv;
 }
 
+/**
+ * mio_getpos_after:
+ * @mio: A #MIO object
+ * @base: (in): A #MIOPos object filled-in by a previous call of mio_getpos() on
+ *        the same stream
+ * @delta: Number of bytes after @base
+ * @pos: (out): A #MIOPos object to fill-in
+ *
+ * Fills @pos as mio_getpos() would after reading @delta bytes from @base,
+ * without moving the cursor of the stream. For a memory stream this is just
+ * arithmetic; a file stream is seeked and then restored.
+ *
+ * Returns: 0 on success, -1 otherwise, in which case errno is set to indicate
+ *          the error.
+ */
+int mio_getpos_after (MIO *mio, const MIOPos *base, long delta, MIOPos *pos)
+{
+	int rv = -1;
+
+	if (mio->type == MIO_TYPE_FILE)
+	{
+		fpos_t current;
+
+		if (fgetpos (mio->impl.file.fp, &current) != 0)
+			return -1;
+		pos->type = mio->type;
+		if (fsetpos (mio->impl.file.fp, &base->impl.file) == 0
+			&& fseek (mio->impl.file.fp, delta, SEEK_CUR) == 0
+			&& fgetpos (mio->impl.file.fp, &pos->impl.file) == 0)
+			rv = 0;
+		if (fsetpos (mio->impl.file.fp, &current) != 0)
+			rv = -1;
+	}
+	else if (mio->type == MIO_TYPE_MEMORY)
+	{
+		if (delta < 0 ? (size_t) -delta > base->impl.mem
+			: base->impl.mem + (size_t) delta > mio->impl.mem.size)
+			errno = EINVAL;
+		else
+		{
+			pos->type = mio->type;
+			pos->impl.mem = base->impl.mem + delta;
+			rv = 0;
+		}
+	}
+	else
+		AssertNotReached ();
+
+#ifdef MIO_DEBUG
+	if (rv != -1)
+		pos->tag = mio;
+#endif /* MIO_DEBUG */
+
+	return rv;
+}
+
 /**
  * mio_flush:
  * @mio: A #MIO object
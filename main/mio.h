@@ -122,6 +122,9 @@ MIO *mio_new_memory (unsigned char *data,
 					 size_t size,
 					 MIOReallocFunc realloc_func,
 					 MIODestroyNotify free_func);
+#ifdef HAVE_MMAP
+MIO *mio_new_mmap (const char *filename);
+#endif
 
 MIO *mio_new_mio    (MIO *base, long start, long size);
 MIO *mio_ref        (MIO *mio);
@@ -129,6 +132,7 @@ MIO *mio_ref        (MIO *mio);
 int mio_unref (MIO *mio);
 FILE *mio_file_get_fp (MIO *mio);
 unsigned char *mio_memory_get_data (MIO *mio, size_t *size);
+unsigned char *mio_memory_get_data_at (MIO *mio, const MIOPos *pos, size_t *size);
 size_t mio_read (MIO *mio,
 				 void *ptr,
 				 size_t size,
@@ -139,6 +143,7 @@ size_t mio_write (MIO *mio,
 				  size_t nmemb);
 int mio_getc (MIO *mio);
 char *mio_gets (MIO *mio, char *s, size_t size);
+const char *mio_memory_gets (MIO *mio, size_t *length);
 int mio_ungetc (MIO *mio, int ch);
 int mio_putc (MIO *mio, int c);
 int mio_puts (MIO *mio, const char *s);
@@ -154,6 +159,7 @@ long mio_tell (MIO *mio);
 void mio_rewind (MIO *mio);
 int mio_getpos (MIO *mio, MIOPos *pos);
 int mio_setpos (MIO *mio, MIOPos *pos);
+int mio_getpos_after (MIO *mio, const MIOPos *base, long delta, MIOPos *pos);
 int mio_flush (MIO *mio);
 
 void  mio_attach_user_data (MIO *mio, void *user_data, MIODestroyNotify user_data_free_func);
@@ -170,9 +170,9 @@
 	extern void prefix##ArraySort (prefix##Array *const current, bool descendingOrder) \
 	{																	\
 		if (descendingOrder)											\
-			qsort (current->array, current->count, sizeof (type), prefix##GreaterThan); \
-		else															\
 			qsort (current->array, current->count, sizeof (type), prefix##LessThan); \
+		else															\
+			qsort (current->array, current->count, sizeof (type), prefix##GreaterThan); \
 	}
 
 /* We expect the linker we use is enough clever to delete dead code. */
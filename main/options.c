@@ -26,7 +26,9 @@
 #include "ctags.h"
 #include "debug.h"
 #include "entry_p.h"
+#include "eventtrace_p.h"
 #include "field_p.h"
+#include "globset_p.h"
 #include "gvars.h"
 #include "keyword_p.h"
 #include "parse_p.h"
@@ -37,6 +39,8 @@
 #include "param.h"
 #include "error_p.h"
 #include "interactive_p.h"
+#include "shard_p.h"
+#include "watch_p.h"
 #include "writer_p.h"
 #include "trace.h"
 
@@ -125,6 +129,7 @@ typedef stringList searchPathList;
 static searchPathList *OptlibPathList;
 
 static stringList *Excluded, *ExcludedException;
+static globSet *ExcludedSet, *ExcludedExceptionSet; /* compiled from the above on demand */
 static bool FilesRequired = true;
 static bool SkipConfiguration;
 
@@ -137,6 +142,15 @@ bool ctags_verbose = false;
 
 optionValues Option = {
 	.append = false,
+	.appendReplace = false,
+	.incremental = false,
+	.dedupContent = false,
+	.watch = false,
+	.nameIndex = false,
+	.trigramIndex = false,
+	.secondaryIndex = false,
+	.aggregateReferences = false,
+	.merge = false,
 	.backward = false,
 	.etags = false,
 	.locate =
@@ -147,11 +161,14 @@ optionValues Option = {
 #endif
 	,
 	.recurse = false,
+	.respectGitignore = false,
 	.sorted = SO_SORTED,
 	.xref = false,
 	.customXfmt = NULL,
 	.fileList = NULL,
+	.gitIndex = NULL,
 	.tagFileName = NULL,
+	.deltaFileName = NULL,
 	.headerExt = NULL,
 	.etagsInclude = NULL,
 	.tagFileFormat = DEFAULT_FILE_FORMAT,
@@ -165,14 +182,33 @@ optionValues Option = {
 	.filterTerminator = NULL,
 	.tagRelative = TREL_NO,
 	.printTotals = 0,
+	.slowFiles = 0,
+	.metricsFile = NULL,
+	.metricsFormat = METRICS_OPENMETRICS,
+#ifdef ALLOC_STATS
+	.allocStatsSites = 0,
+#endif
 	.lineDirectives = false,
 	.printLanguage =false,
 	.guessLanguageEagerly = false,
 	.quiet = false,
 	.fatalWarnings = false,
 	.patternLengthLimit = 96,
+	.promoteRegex = REGEX_PROMOTION_NO,
 	.putFieldPrefix = false,
 	.maxRecursionDepth = 0xffffffff,
+	.jobs = 1,
+	.readAhead = 0,
+	.shardIndex = 0,
+	.shardCount = 0,
+	.minified = MINIFIED_PARSE,
+	.minifiedLimit = 64 * 1024,
+	.maxFileTime = 0,
+	.maxFileBytes = 0,
+	.maxLineBytes = 0,
+	.sortMemoryLimit = 64 * 1024 * 1024,
+	.memoryLimit = 0,
+	.xmlStreamThreshold = 32 * 1024 * 1024,
 	.interactive = false,
 	.fieldsReset = false,
 #ifdef _WIN32
@@ -222,6 +258,17 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"  --filter-terminator=<string>"},
  {1,0,"       Specify <string> to print to stdout following the tags for each file"},
  {1,0,"       parsed when --filter is enabled."},
+ {1,0,"  --git-index=<dir>"},
+ {1,0,"       Read the names of the files tracked in the git worktree <dir>"},
+ {1,0,"       from its index instead of recursing into it."},
+ {1,0,"  --jobs=<N>"},
+#ifdef HAVE_FORK
+ {1,0,"       Run parsers for input files in <N> worker processes [1]."},
+#else
+ {1,0,"       Not supported on this platform."},
+#endif
+ {1,0,"  --read-ahead=<N>"},
+ {1,0,"       Let the system read <N> input files ahead of the parser [0]."},
  {1,0,"  --links[=(yes|no)]"},
  {1,0,"       Indicate whether symbolic links should be followed [yes]."},
  {1,0,"  --maxdepth=<N>"},
@@ -230,6 +277,15 @@ static optionDescription LongOptionDescription [] = {
 #else
  {1,0,"       Not supported on this platform."},
 #endif
+ {1,0,"  --max-file-bytes=<size>[K|M|G]"},
+ {1,0,"       Stop parsing an input file after reading the lines in its first <size> bytes [0]."},
+ {1,0,"  --max-file-time=<seconds>"},
+ {1,0,"       Stop parsing an input file after reading it for <seconds> [0]."},
+ {1,0,"  --max-line-bytes=<size>[K|M|G]"},
+ {1,0,"       Match regex patterns against the first <size> bytes of a longer line, and"},
+ {1,0,"       locate the tags on it with line numbers [0]."},
+ {1,0,"  --minified=(parse|skip|toplevel|truncate[:<size>[K|M|G]])"},
+ {1,0,"       Specify how to handle an input file looking minified or generated [parse]."},
  {1,0,"  --recurse[=(yes|no)]"},
 #ifdef RECURSE_SUPPORTED
  {1,0,"       Recurse into directories supplied on command line [no]."},
@@ -237,17 +293,44 @@ static optionDescription LongOptionDescription [] = {
 #else
  {1,0,"       Not supported on this platform."},
  {1,0,"  -R   Not supported on this platform."},
+#endif
+ {1,0,"  --respect-gitignore[=(yes|no)]"},
+#ifdef RECURSE_SUPPORTED
+ {1,0,"       Skip files and directories listed in .gitignore and .ignore files"},
+ {1,0,"       found while recursing [no]."},
+#else
+ {1,0,"       Not supported on this platform."},
 #endif
  {1,0,"  -L <file>"},
  {1,0,"       A list of input file names is read from the specified <file>."},
  {1,0,"       If specified as \"-\", then standard input is read."},
- {1,0,"  --append[=(yes|no)]"},
+ {1,0,"  --append[=(yes|no|replace)]"},
  {1,0,"       Should tags should be appended to existing tag file [no]?"},
+ {1,0,"       With replace, the tags of the input files already in the tag file"},
+ {1,0,"       are dropped."},
  {1,0,"  -a   Append the tags to an existing tag file."},
  {1,0,"  -f <tagfile>"},
  {1,0,"       Write tags to specified <tagfile>. Value of \"-\" writes tags to stdout"},
  {1,0,"       [\"tags\"; or \"TAGS\" when -e supplied]."},
  {1,0,"  -o   Alternative for -f."},
+ {1,0,"  --incremental[=(yes|no)]"},
+ {1,0,"       Parse only input files changed since the last run, recorded in"},
+ {1,0,"       <tagfile>.manifest [no]."},
+ {1,0,"  --watch[=(yes|no)]"},
+#ifdef WATCH_SUPPORTED
+ {1,0,"       Make the tag file, and make it again in incremental mode each time"},
+ {1,0,"       the input files change [no]."},
+#else
+ {1,0,"       Not supported on this platform."},
+#endif
+ {1,0,"  --dedup-content[=(yes|no)]"},
+ {1,0,"       Tag an input file with the same contents as one tagged before from"},
+ {1,0,"       the tags of that file instead of parsing it again [no]."},
+ {1,0,"  --shard=<K>/<N>"},
+ {1,0,"       Parse only the input files in the <K>th of <N> shards, chosen by"},
+ {1,0,"       a hash of the path."},
+ {1,0,"  --merge[=(yes|no)]"},
+ {1,0,"       Merge the sorted tag files given as arguments into the tag file [no]."},
  {1,0,""},
  {1,0,"Output Format Options"},
  {0,0,"  --format=(1|2)"},
@@ -256,17 +339,39 @@ static optionDescription LongOptionDescription [] = {
 #else
  {0,0,"       Force output of specified tag file format [2]."},
 #endif
+ {0,0,"  --output-format=(u-ctags|e-ctags|etags|xref"
 #ifdef HAVE_JANSSON
- {0,0,"  --output-format=(u-ctags|e-ctags|etags|xref|json)"},
-#else
- {0,0,"  --output-format=(u-ctags|e-ctags|etags|xref)"},
+  "|json"
 #endif
+  "|binary"
+#ifdef HAVE_ZLIB
+  "|compressed"
+#endif
+  "|stream)"},
  {0,0,"      Specify the output format. [u-ctags]"},
  {0,0,"  -e   Output tag file for use with Emacs."},
  {1,0,"  -x   Print a tabular cross reference file to standard output."},
+ {1,0,"  --extra-output=(u-ctags|e-ctags|etags"
+#ifdef HAVE_JANSSON
+  "|json"
+#endif
+  "):<file>"},
+ {1,0,"       Also write the tags in the format to <file>; an empty value clears them."},
  {0,0,"  --sort=(yes|no|foldcase)"},
  {0,0,"       Should tags be sorted (optionally ignoring case) [yes]?"},
  {0,0,"  -u   Equivalent to --sort=no."},
+ {1,0,"  --sort-memory-limit=<size>[K|M|G]"},
+ {1,0,"       Sort tags in memory up to <size> bytes; use temporary files beyond it [64M]."},
+ {1,0,"  --memory-limit=<size>[K|M|G]"},
+ {1,0,"       Switch to low-memory modes as the memory allocated nears <size>; 0 for no limit [0]."},
+ {1,0,"  --name-index[=(yes|no)]"},
+ {1,0,"       Write <tagfile>.index for looking up tag names quickly in a sorted tag file [no]."},
+ {1,0,"  --trigram-index[=(yes|no)]"},
+ {1,0,"       Write <tagfile>.trigrams for looking up tag names containing a string [no]."},
+ {1,0,"  --secondary-index[=(yes|no)]"},
+ {1,0,"       Write <tagfile>.secondary for listing the tags of an input file or a scope [no]."},
+ {1,0,"  --delta=<prevfile>"},
+ {1,0,"       Write the tags added to and removed from the tag file <prevfile> to <tagfile>.delta."},
  {1,0,"  --etags-include=<file>"},
  {1,0,"       Include reference to <file> in Emacs-style tag file (requires -e)."},
 #ifdef HAVE_ICONV
@@ -310,7 +415,7 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"       Unlike --langmap the change with this option affects mapping of <LANG> only."},
  {1,0,""},
  {1,0,"Tags File Contents Options"},
- {0,0,"  --excmd=(number|pattern|mix|combine)"},
+ {0,0,"  --excmd=(number|pattern|mix|combine|hash)"},
 #ifdef MACROS_USE_PATTERNS
  {0,0,"       Uses the specified type of EX command to locate tags [pattern]."},
 #else
@@ -323,6 +428,9 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"  --extras-(<LANG>|all)=[+|-][<flags>|*]"},
  {1,0,"       Include <LANG> own extra tag entries for selected information"},
  {1,0,"       (<flags>: see the output of --list-extras=<LANG> option)."},
+ {1,0,"  --aggregate-references[=(yes|no)]"},
+ {1,0,"       Write the references to a name of a kind and roles in an input file"},
+ {1,0,"       once, with the refcount and reflines fields [no]."},
  {1,0,"  --fields=[+|-][<flags>|*]"},
  {1,0,"       Include selected extension fields (<flags>: \"aCeEfFikKlmnNpPrRsStxzZ\") [fks]."},
  {1,0,"  --fields-(<LANG>|all)=[+|-][<flags>|*]"},
@@ -372,6 +480,9 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"       Define a new language to be parsed with regular expressions."},
  {1,0,"  --mline-regex-<LANG>=/<line_pattern>/<name_pattern>/<kind-spec>/[<flags>]"},
  {1,0,"       Define multiline regular expression for locating tags in specific language."},
+ {1,0,"  --promote-regex=(no|yes|verify)"},
+ {1,0,"       Match the extended regular expressions with pcre2 where it matches them the same."},
+ {1,0,"       verify matches with both, and warns if they differ [no]."},
  {1,0,"  --regex-<LANG>=/<line_pattern>/<name_pattern>/<kind-spec>/[<flags>]"},
  {1,0,"       Define single-line regular expression for locating tags in specific language."},
  {1,1,"  --_extradef-<LANG>=<name>,<description>"},
@@ -479,12 +590,16 @@ static optionDescription LongOptionDescription [] = {
  {1,0,"       Print this option summary including experimental features."},
  {1,0,"  --license"},
  {1,0,"       Print details of software license."},
+ {1,0,"  --metrics-file=<file>"},
+ {1,0,"       Write statistics about input and tag files to <file>."},
+ {1,0,"  --metrics-format=(openmetrics|json)"},
+ {1,0,"       Specify the format of --metrics-file [openmetrics]."},
  {0,0,"  --print-language"},
  {0,0,"       Don't make tags file but just print the guessed language name for"},
  {0,0,"       input file."},
  {1,0,"  --quiet[=(yes|no)]"},
  {0,0,"       Don't print NOTICE class messages [no]."},
- {1,0,"  --totals[=(yes|no|extra)]"},
+ {1,0,"  --totals[=(yes|no|extra|json|slow:<N>)]"},
  {1,0,"       Print statistics about input and tag files [no]."},
  {1,0,"  --verbose[=(yes|no)]"},
  {1,0,"       Enable verbose messages describing actions on each input file."},
@@ -514,10 +629,13 @@ static optionDescription LongOptionDescription [] = {
 #ifdef HAVE_JANSSON
  {0,1,"  --_interactive"
 #ifdef HAVE_SECCOMP
-  "[=(default|sandbox)]"
+  "[=(default|server|sandbox)]"
+#else
+  "[=(default|server)]"
 #endif
  },
  {0,1,"       Enter interactive mode (JSON over stdio)."},
+ {0,1,"       Answer \"unchanged\" for files tagged before with the same contents if server is specified."},
 #ifdef HAVE_SECCOMP
  {0,1,"       Enter file I/O limited interactive mode if sandbox is specified. [default]"},
 #endif
@@ -525,6 +643,16 @@ static optionDescription LongOptionDescription [] = {
 #ifdef DO_TRACING
  {1,1,"  --_trace=<list>"},
  {1,1,"       Trace parsers for the languages."},
+#endif
+ {1,1,"  --_xml-stream-threshold=<size>[K|M|G]"},
+ {1,1,"       Read XML input files of <size> bytes or more in the streaming mode [32M]."},
+ {1,1,"  --_event-trace=<file>"},
+ {1,1,"       Write the begin and end of the steps of making tags to <file> at exit"},
+ {1,1,"       in the Trace Event Format (JSON) for chrome://tracing or Perfetto."},
+#ifdef ALLOC_STATS
+ {1,1,"  --_alloc-stats[=<N>]"},
+ {1,1,"       Print the memory allocations by language and by the N busiest call sites at exit."},
+ {1,1,"       [20]"},
 #endif
  {1,1, NULL}
 };
@@ -590,6 +718,9 @@ static struct Feature {
 	{"json", "supports json format output"},
 	{"interactive", "accepts source code from stdin"},
 #endif
+#ifdef HAVE_ZLIB
+	{"zlib", "supports compressed tag file output"},
+#endif
 #ifdef HAVE_SECCOMP
 	{"sandbox", "linked with code for system call level sandbox"},
 #endif
@@ -609,6 +740,12 @@ static struct Feature {
 	{"optscript", "can use the interpreter"},
 #ifdef HAVE_PCRE2
 	{"pcre2", "has pcre2 regex engine"},
+#endif
+#ifdef HAVE_FORK
+	{"jobs", "can run parsers in worker processes"},
+#endif
+#ifdef WATCH_SUPPORTED
+	{"watch", "can watch input files for changes"},
 #endif
 	{NULL,}
 };
@@ -739,6 +876,12 @@ extern void setDefaultTagFileName (void)
 	}
 }
 
+extern void setTagFileName (const char *const name)
+{
+	freeString (&Option.tagFileName);
+	Option.tagFileName = stringCopy (name);
+}
+
 extern bool filesRequired (void)
 {
 	bool result = FilesRequired;
@@ -747,6 +890,22 @@ extern bool filesRequired (void)
 	return result;
 }
 
+/* Return whether a sidecar index of the tag file can be made. If not,
+ * tell why after NOTICE. */
+static bool canMakeSidecarIndex (const char *const notice)
+{
+	if (isDestinationStdout () || Option.filter)
+		error (WARNING, "%s tags to stdout", notice);
+	else if (Option.sorted == SO_UNSORTED)
+		error (WARNING, "%s unsorted tag file", notice);
+	else if (getTagWriterType () != WRITER_U_CTAGS
+			 && getTagWriterType () != WRITER_E_CTAGS)
+		error (WARNING, "%s output formats other than u-ctags and e-ctags", notice);
+	else
+		return true;
+	return false;
+}
+
 extern void checkOptions (void)
 {
 	const char* notice;
@@ -759,12 +918,163 @@ extern void checkOptions (void)
 			enableXtag (XTAG_FILE_NAMES, false);
 		}
 	}
+	if (Option.watch)
+	{
+#ifdef WATCH_SUPPORTED
+		notice = "--watch is not compatible with";
+		if (Option.fileList && strcmp (Option.fileList, "-") == 0)
+			error (FATAL, "%s reading input file names from standard input", notice);
+		if (Option.printLanguage)
+			error (FATAL, "%s --print-language", notice);
+		/* The tag file is made again in incremental mode. */
+		Option.incremental = true;
+		setMainLoop (watchTagFile, NULL);
+#else
+		error (FATAL, "--watch is not supported on this platform");
+#endif
+	}
+	if (Option.merge)
+	{
+		notice = "--merge is not compatible with";
+		if (Option.append)
+			error (FATAL, "%s append mode", notice);
+		if (Option.incremental)
+			error (FATAL, "%s incremental mode", notice);
+		if (Option.filter || Option.interactive)
+			error (FATAL, "%s %s mode", notice,
+				   Option.filter? "filter": "interactive");
+		if (getTagWriterType () != WRITER_U_CTAGS
+			&& getTagWriterType () != WRITER_E_CTAGS)
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+		setMainLoop (mergeTagFiles, NULL);
+	}
 	if (Option.append)
 	{
 		notice = "append mode is not compatible with";
 		if (isDestinationStdout ())
 			error (FATAL, "%s tags to stdout", notice);
 	}
+	if (Option.appendReplace)
+	{
+		/* The old tags are dropped while merging the new tags into the
+		 * tag file. */
+		notice = "--append=replace is not compatible with";
+		if (getTagWriterType () != WRITER_U_CTAGS
+			&& getTagWriterType () != WRITER_E_CTAGS)
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+		if (Option.sorted == SO_UNSORTED)
+			error (FATAL, "%s unsorted tag files", notice);
+#ifdef EXTERNAL_SORT
+		error (FATAL, "%s the external sort command", notice);
+#endif
+	}
+	if (Option.incremental)
+	{
+		notice = "incremental mode is not compatible with";
+		if (isDestinationStdout () || Option.filter)
+			error (FATAL, "%s tags to stdout", notice);
+		if (Option.append)
+			error (FATAL, "%s append mode", notice);
+		if (getTagWriterType () != WRITER_U_CTAGS
+			&& getTagWriterType () != WRITER_E_CTAGS)
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+	}
+	if (Option.dedupContent)
+	{
+		/* The input field is the only part of a tag line depending on
+		 * the path of the input file, except the file name tag. */
+		notice = "--dedup-content is not compatible with";
+		if (Option.filter || Option.interactive)
+			error (FATAL, "%s %s mode", notice,
+				   Option.filter? "filter": "interactive");
+		if (getTagWriterType () != WRITER_U_CTAGS
+			&& getTagWriterType () != WRITER_E_CTAGS)
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+		if (isXtagEnabled (XTAG_FILE_NAMES) && isFieldEnabled (FIELD_EPOCH))
+		{
+			error (WARNING, "%s file name tags with the epoch field; disabled",
+				   notice);
+			Option.dedupContent = false;
+		}
+	}
+	if (getTagWriterType () == WRITER_BINARY
+		|| getTagWriterType () == WRITER_COMPRESSED
+		|| getTagWriterType () == WRITER_STREAM)
+	{
+		notice = (getTagWriterType () == WRITER_BINARY)
+			? "binary output"
+			: (getTagWriterType () == WRITER_COMPRESSED)
+			? "compressed output": "stream output";
+		/* The records are written in the order the parsers make the
+		 * tags; a line-oriented sort would break them. */
+		if (getTagWriterType () == WRITER_STREAM)
+			Option.sorted = SO_UNSORTED;
+		if (Option.append)
+			error (FATAL, "append mode is not compatible with %s", notice);
+		if (Option.jobs > 1)
+		{
+			error (WARNING, "%s doesn't run parsers in worker processes", notice);
+			Option.jobs = 1;
+		}
+	}
+	if (hasExtraOutputs ())
+	{
+		notice = "--extra-output is not compatible with";
+		if (Option.filter || Option.interactive)
+			error (FATAL, "%s %s mode", notice,
+				   Option.filter? "filter": "interactive");
+		if (Option.append)
+			error (FATAL, "%s append mode", notice);
+		if (Option.incremental)
+			error (FATAL, "%s incremental mode", notice);
+		if (Option.merge)
+			error (FATAL, "%s --merge", notice);
+		if (getTagWriterType () == WRITER_BINARY
+			|| getTagWriterType () == WRITER_COMPRESSED
+			|| getTagWriterType () == WRITER_STREAM)
+			error (FATAL, "%s %s output", notice,
+				   (getTagWriterType () == WRITER_BINARY)? "binary"
+				   : (getTagWriterType () == WRITER_COMPRESSED)? "compressed"
+				   : "stream");
+		if (Option.jobs > 1)
+		{
+			error (WARNING, "extra outputs are not written by worker processes; --jobs is ignored");
+			Option.jobs = 1;
+		}
+#ifdef EXTERNAL_SORT
+		if (Option.sorted != SO_UNSORTED)
+			error (WARNING, "extra outputs are not sorted with the external sort command");
+#endif
+	}
+	if (Option.deltaFileName)
+	{
+		notice = "--delta is not compatible with";
+		if (isDestinationStdout () || Option.filter || Option.interactive)
+			error (FATAL, "%s tags to stdout", notice);
+		if (Option.append)
+			error (FATAL, "%s append mode", notice);
+		if (Option.incremental)
+			error (FATAL, "%s incremental mode", notice);
+		if (Option.sorted == SO_UNSORTED)
+			error (FATAL, "%s unsorted tag files", notice);
+		if (getTagWriterType () != WRITER_U_CTAGS
+			&& getTagWriterType () != WRITER_E_CTAGS)
+			error (FATAL, "%s output formats other than u-ctags and e-ctags", notice);
+#ifdef EXTERNAL_SORT
+		error (FATAL, "%s the external sort command", notice);
+#endif
+	}
+	if (Option.memoryLimit > 0 && ! setMemoryLimit (Option.memoryLimit))
+	{
+		error (WARNING, "--memory-limit is not supported on this platform");
+		Option.memoryLimit = 0;
+	}
+	if (Option.nameIndex && ! canMakeSidecarIndex ("name index is not made for"))
+		Option.nameIndex = false;
+	if (Option.trigramIndex && ! canMakeSidecarIndex ("trigram index is not made for"))
+		Option.trigramIndex = false;
+	if (Option.secondaryIndex && ! canMakeSidecarIndex ("secondary index is not made for"))
+		Option.secondaryIndex = false;
 	if (Option.filter)
 	{
 		notice = "filter mode";
@@ -772,6 +1082,7 @@ extern void checkOptions (void)
 		{
 			error (WARNING, "%s disables totals", notice);
 			Option.printTotals = 0;
+			Option.slowFiles = 0;
 		}
 		if (Option.tagFileName != NULL)
 			error (WARNING, "%s ignores output tag file name", notice);
@@ -1166,9 +1477,16 @@ static void processEtagsInclude (
 }
 
 static void processExcludeOptionCommon (
-	stringList** list, const char *const optname, const char *const parameter)
+	stringList** list, globSet** set, const char *const optname, const char *const parameter)
 {
 	const char *const fileName = parameter + 1;
+
+	if (*set)
+	{
+		globSetDelete (*set);
+		*set = NULL;
+	}
+
 	if (parameter [0] == '\0')
 		freeList (list);
 	else if (parameter [0] == '@')
@@ -1198,13 +1516,13 @@ static void processExcludeOptionCommon (
 static void processExcludeOption (
 		const char *const option, const char *const parameter)
 {
-	processExcludeOptionCommon (&Excluded, option, parameter);
+	processExcludeOptionCommon (&Excluded, &ExcludedSet, option, parameter);
 }
 
 static void processExcludeExceptionOption (
 		const char *const option, const char *const parameter)
 {
-	processExcludeOptionCommon (&ExcludedException, option, parameter);
+	processExcludeOptionCommon (&ExcludedException, &ExcludedExceptionSet, option, parameter);
 }
 
 extern bool isExcludedFile (const char* const name,
@@ -1220,18 +1538,22 @@ extern bool isExcludedFile (const char* const name,
 
 	if (Excluded != NULL)
 	{
-		result = stringListFileMatched (Excluded, base);
+		if (ExcludedSet == NULL)
+			ExcludedSet = globSetNew (Excluded);
+		result = globSetMatched (ExcludedSet, base);
 		if (! result  &&  name != base)
-			result = stringListFileMatched (Excluded, name);
+			result = globSetMatched (ExcludedSet, name);
 	}
 
 	if (result && ExcludedException != NULL)
 	{
 		bool result_exception;
 
-		result_exception = stringListFileMatched (ExcludedException, base);
+		if (ExcludedExceptionSet == NULL)
+			ExcludedExceptionSet = globSetNew (ExcludedException);
+		result_exception = globSetMatched (ExcludedExceptionSet, base);
 		if (! result_exception && name != base)
-			result_exception = stringListFileMatched (ExcludedException, name);
+			result_exception = globSetMatched (ExcludedExceptionSet, name);
 
 		if (result_exception)
 			result = false;
@@ -1250,6 +1572,11 @@ static void processExcmdOption (
 		default:
 			if (strcmp(parameter, "combine") == 0)
 				Option.locate = EX_COMBINE;
+			else if (strcmp(parameter, "hash") == 0)
+			{
+				Option.locate = EX_HASH;
+				enableField (FIELD_LINE_HASH, true);
+			}
 			else
 				error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
 			break;
@@ -1438,6 +1765,24 @@ static void processFilterTerminatorOption (
 	Option.filterTerminator = stringCopy (parameter);
 }
 
+static void processDeltaOption (
+		const char *const option, const char *const parameter)
+{
+	freeString (&Option.deltaFileName);
+	if (parameter [0] == '\0')
+		error (FATAL, "no previous tag file specified for \"%s\" option", option);
+	Option.deltaFileName = stringCopy (parameter);
+}
+
+static void processGitIndexOption (
+		const char *const option, const char *const parameter)
+{
+	if (parameter [0] == '\0')
+		error (FATAL, "no worktree specified for \"%s\" option", option);
+	freeString (&Option.gitIndex);
+	Option.gitIndex = stringCopy (parameter);
+}
+
 static void processFormatOption (
 		const char *const option, const char *const parameter)
 {
@@ -1667,16 +2012,25 @@ static void processInteractiveOption (
 	{
 		Option.interactive = INTERACTIVE_SANDBOX;
 		args.sandbox = true;
+		args.server = false;
+	}
+	else if (parameter && (strcmp (parameter, "server") == 0))
+	{
+		Option.interactive = INTERACTIVE_SERVER;
+		args.sandbox = false;
+		args.server = true;
 	}
 	else if (parameter && (strcmp (parameter, "default") == 0))
 	{
 		Option.interactive = INTERACTIVE_DEFAULT;
 		args.sandbox = false;
+		args.server = false;
 	}
 	else if ((!parameter) || *parameter == '\0')
 	{
 		Option.interactive = INTERACTIVE_DEFAULT;
 		args.sandbox = false;
+		args.server = false;
 	}
 	else
 		error (FATAL, "Unknown option argument \"%s\" for --%s option",
@@ -2402,11 +2756,54 @@ static void processOutputFormat (const char *const option CTAGS_ATTR_UNUSED,
 #ifdef HAVE_JANSSON
 	else if (strcmp (parameter, "json") == 0)
 		setJsonMode ();
+#endif
+	else if (strcmp (parameter, "binary") == 0)
+		setTagWriter (WRITER_BINARY, NULL);
+	else if (strcmp (parameter, "stream") == 0)
+		setTagWriter (WRITER_STREAM, NULL);
+#ifdef HAVE_ZLIB
+	else if (strcmp (parameter, "compressed") == 0)
+		setTagWriter (WRITER_COMPRESSED, NULL);
 #endif
 	else
 		error (FATAL, "unknown output format name supplied for \"%s=%s\"", option, parameter);
 }
 
+static void processExtraOutputOption (const char *const option,
+				      const char *const parameter)
+{
+	const char *const sep = strchr (parameter, ':');
+	writerType wtype = WRITER_DEFAULT;
+	vString *format;
+
+	if (parameter [0] == '\0')
+	{
+		clearExtraOutputs ();
+		return;
+	}
+	if (sep == NULL || sep [1] == '\0')
+		error (FATAL, "no file name supplied for \"%s=%s\"", option, parameter);
+
+	format = vStringNew ();
+	vStringNCopyS (format, parameter, sep - parameter);
+	if (strcmp (vStringValue (format), "u-ctags") == 0)
+		wtype = WRITER_U_CTAGS;
+	else if (strcmp (vStringValue (format), "e-ctags") == 0)
+		wtype = WRITER_E_CTAGS;
+	else if (strcmp (vStringValue (format), "etags") == 0)
+		wtype = WRITER_ETAGS;
+#ifdef HAVE_JANSSON
+	else if (strcmp (vStringValue (format), "json") == 0)
+		wtype = WRITER_JSON;
+#endif
+	else
+		error (FATAL, "unknown or unsupported output format name supplied for \"%s=%s\"",
+			   option, parameter);
+	vStringDelete (format);
+
+	addExtraOutput (wtype, sep + 1);
+}
+
 static void processPseudoTags (const char *const option CTAGS_ATTR_UNUSED,
 			       const char *const parameter)
 {
@@ -2477,6 +2874,28 @@ static void processPseudoTags (const char *const option CTAGS_ATTR_UNUSED,
 	vStringDelete (str);
 }
 
+static void processAppendOption (
+		const char *const option, const char *const parameter)
+{
+	if (isFalse (parameter))
+	{
+		Option.append = false;
+		Option.appendReplace = false;
+	}
+	else if (isTrue (parameter) || *parameter == '\0')
+	{
+		Option.append = true;
+		Option.appendReplace = false;
+	}
+	else if (strcasecmp (parameter, "replace") == 0)
+	{
+		Option.append = true;
+		Option.appendReplace = true;
+	}
+	else
+		error (FATAL, "Invalid value for \"%s\" option", option);
+}
+
 static void processSortOption (
 		const char *const option, const char *const parameter)
 {
@@ -2492,6 +2911,62 @@ static void processSortOption (
 		error (FATAL, "Invalid value for \"%s\" option", option);
 }
 
+/* Return false if PARAMETER is not <size>[K|M|G]. */
+static bool parseMemorySize (const char *const parameter, bool zeroAllowed,
+							 unsigned long *size)
+{
+	vString *number;
+	unsigned long n;
+	unsigned long unit = 1;
+	bool ok;
+
+	if (parameter [0] == '\0')
+		return false;
+
+	number = vStringNewInit (parameter);
+	switch (toupper ((unsigned char) vStringLast (number)))
+	{
+	case 'G':
+		unit *= 1024;
+		/* Fall through */
+	case 'M':
+		unit *= 1024;
+		/* Fall through */
+	case 'K':
+		unit *= 1024;
+		vStringChop (number);
+		break;
+	}
+
+	ok = isdigit ((unsigned char) parameter [0])
+		&& strToULong (vStringValue (number), 10, &n)
+		&& (zeroAllowed || n > 0) && n <= ((unsigned long) -1) / unit;
+	vStringDelete (number);
+	if (ok)
+		*size = n * unit;
+	return ok;
+}
+
+static void processSortMemoryLimitOption (
+		const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!parseMemorySize (parameter, false, &Option.sortMemoryLimit))
+		error (FATAL, "-%s: Invalid memory size", option);
+}
+
+static void processMemoryLimitOption (
+		const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!parseMemorySize (parameter, true, &Option.memoryLimit))
+		error (FATAL, "-%s: Invalid memory size", option);
+}
+
 static void processTagRelative (
 		const char *const option, const char *const parameter)
 {
@@ -2510,16 +2985,74 @@ static void processTagRelative (
 static void processTotals (
 		const char *const option, const char *const parameter)
 {
+	const char *const slow = "slow:";
+
 	if (isFalse (parameter))
+	{
 		Option.printTotals = 0;
+		Option.slowFiles = 0;
+	}
+	else if (strncasecmp (parameter, slow, strlen (slow)) == 0)
+	{
+		if (!strToUInt (parameter + strlen (slow), 0, &Option.slowFiles)
+			|| Option.slowFiles == 0)
+			error (FATAL, "Invalid number of files for \"%s\" option: %s",
+				   option, parameter + strlen (slow));
+		if (Option.printTotals == 0)
+			Option.printTotals = 1;
+	}
 	else if (isTrue (parameter) || *parameter == '\0')
 		Option.printTotals = 1;
 	else if (strcasecmp (parameter, "extra") == 0)
 		Option.printTotals = 2;
+	else if (strcasecmp (parameter, "json") == 0)
+		Option.printTotals = 3;
 	else
 		error (FATAL, "Invalid value for \"%s\" option", option);
 }
 
+static void processMetricsFileOption (
+		const char *const option, const char *const parameter)
+{
+	if (parameter [0] == '\0')
+		error (FATAL, "No file name given for \"%s\" option", option);
+	freeString (&Option.metricsFile);
+	Option.metricsFile = stringCopy (parameter);
+}
+
+static void processMetricsFormatOption (
+		const char *const option, const char *const parameter)
+{
+	if (strcasecmp (parameter, "openmetrics") == 0)
+		Option.metricsFormat = METRICS_OPENMETRICS;
+	else if (strcasecmp (parameter, "json") == 0)
+		Option.metricsFormat = METRICS_JSON;
+	else
+		error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
+}
+
+static void processPromoteRegexOption (
+		const char *const option, const char *const parameter)
+{
+	regexPromotion promotion = REGEX_PROMOTION_NO;
+
+	if (parameter [0] == '\0' || strcasecmp (parameter, "yes") == 0)
+		promotion = REGEX_PROMOTION_YES;
+	else if (strcasecmp (parameter, "no") == 0)
+		promotion = REGEX_PROMOTION_NO;
+	else if (strcasecmp (parameter, "verify") == 0)
+		promotion = REGEX_PROMOTION_VERIFY;
+	else
+		error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
+
+#ifdef HAVE_PCRE2
+	Option.promoteRegex = promotion;
+#else
+	if (promotion != REGEX_PROMOTION_NO)
+		error (WARNING, "\"%s\" option is ignored: pcre2 regex engine is not linked.", option);
+#endif
+}
+
 static void installHeaderListDefaults (void)
 {
 	Option.headerExt = stringListNewFromArgv (HeaderExtensions);
@@ -2716,6 +3249,34 @@ static void processTraceOption(const char *const option CTAGS_ATTR_UNUSED,
 }
 #endif
 
+#ifdef ALLOC_STATS
+static void processAllocStatsOption (const char *const option,
+									 const char *const parameter)
+{
+	if (*parameter == '\0')
+		Option.allocStatsSites = 20;
+	else if (!strToUInt (parameter, 0, &Option.allocStatsSites)
+			 || Option.allocStatsSites == 0)
+		error (FATAL, "Invalid number of call sites for \"%s\" option: %s",
+			   option, parameter);
+}
+#endif
+
+static void processEventTraceOption (const char *const option,
+									 const char *const parameter)
+{
+	if (*parameter == '\0')
+		error (FATAL, "No file name given for \"%s\" option", option);
+	startEventTrace (parameter);
+}
+
+static void processXmlStreamThresholdOption (const char *const option,
+											 const char *const parameter)
+{
+	if (!parseMemorySize (parameter, true, &Option.xmlStreamThreshold))
+		error (FATAL, "-%s: Invalid size", option);
+}
+
 static void processXformatOption (const char *const option CTAGS_ATTR_UNUSED,
 				  const char *const parameter)
 {
@@ -2780,6 +3341,111 @@ static void processMaxRecursionDepthOption (const char *const option, const char
 	Option.maxRecursionDepth = atol(parameter);
 }
 
+static void processJobsOption (const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!strToUInt (parameter, 0, &Option.jobs) || Option.jobs < 1)
+		error (FATAL, "-%s: Invalid number of jobs", option);
+
+#ifndef HAVE_FORK
+	if (Option.jobs > 1)
+	{
+		error (WARNING, "--%s: running parsers in worker processes is not supported on this platform",
+			   option);
+		Option.jobs = 1;
+	}
+#endif
+}
+
+static void processShardOption (const char *const option, const char *const parameter)
+{
+	const char *slash;
+
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	slash = strchr (parameter, '/');
+	if (slash == NULL)
+		error (FATAL, "-%s: Specify a shard as <K>/<N>", option);
+	else
+	{
+		char *k = eStrndup (parameter, slash - parameter);
+
+		if (!strToUInt (k, 0, &Option.shardIndex)
+			|| !strToUInt (slash + 1, 0, &Option.shardCount)
+			|| Option.shardCount < 1
+			|| Option.shardIndex < 1 || Option.shardIndex > Option.shardCount)
+			error (FATAL, "-%s: Invalid shard \"%s\"", option, parameter);
+		eFree (k);
+	}
+}
+
+static void processReadAheadOption (const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!strToUInt (parameter, 0, &Option.readAhead))
+		error (FATAL, "-%s: Invalid number of files", option);
+}
+
+static void processMaxFileBytesOption (const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!parseMemorySize (parameter, true, &Option.maxFileBytes))
+		error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
+}
+
+static void processMaxLineBytesOption (const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!parseMemorySize (parameter, true, &Option.maxLineBytes))
+		error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
+}
+
+static void processMaxFileTimeOption (const char *const option, const char *const parameter)
+{
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (!strToUInt (parameter, 0, &Option.maxFileTime))
+		error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
+}
+
+static void processMinifiedOption (const char *const option, const char *const parameter)
+{
+	const char *const truncate = "truncate";
+
+	if (parameter == NULL || parameter[0] == '\0')
+		error (FATAL, "A parameter is needed after \"%s\" option", option);
+
+	if (strcasecmp (parameter, "parse") == 0)
+		Option.minified = MINIFIED_PARSE;
+	else if (strcasecmp (parameter, "skip") == 0)
+		Option.minified = MINIFIED_SKIP;
+	else if (strcasecmp (parameter, "toplevel") == 0)
+		Option.minified = MINIFIED_TOPLEVEL;
+	else if (strncasecmp (parameter, truncate, strlen (truncate)) == 0
+			 && (parameter [strlen (truncate)] == '\0'
+				 || parameter [strlen (truncate)] == ':'))
+	{
+		const char *size = parameter + strlen (truncate);
+
+		if (*size == ':'
+			&& !parseMemorySize (size + 1, false, &Option.minifiedLimit))
+			error (FATAL, "Invalid size for \"%s\" option: %s", option, size + 1);
+		Option.minified = MINIFIED_TRUNCATE;
+	}
+	else
+		error (FATAL, "Invalid value for \"%s\" option: %s", option, parameter);
+}
+
 static void processPatternLengthLimit(const char *const option, const char *const parameter)
 {
 	if (parameter == NULL || parameter[0] == '\0')
@@ -2819,6 +3485,16 @@ static void setBooleanToXtagWithWarning(booleanOption *const option, bool value)
 	enableXtag (t, value);
 }
 
+static void setAggregateReferences (booleanOption *const option, bool value)
+{
+	*option->pValue = value;
+	if (value)
+	{
+		enableField (FIELD_REF_COUNT, true);
+		enableField (FIELD_REF_LINES, true);
+	}
+}
+
 /*
  *  Option tables
  */
@@ -2827,18 +3503,23 @@ static void processDumpOptionsOption (const char *const option, const char *cons
 static void processDumpPreludeOption (const char *const option, const char *const parameter);
 
 static parametricOption ParametricOptions [] = {
+	{ "append",                 processAppendOption,            true,   STAGE_ANY },
+	{ "delta",                  processDeltaOption,             true,   STAGE_ANY },
 	{ "etags-include",          processEtagsInclude,            false,  STAGE_ANY },
 	{ "exclude",                processExcludeOption,           false,  STAGE_ANY },
 	{ "exclude-exception",      processExcludeExceptionOption,  false,  STAGE_ANY },
 	{ "excmd",                  processExcmdOption,             false,  STAGE_ANY },
 	{ "extra",                  processExtraTagsOption,         false,  STAGE_ANY },
 	{ "extras",                 processExtraTagsOption,         false,  STAGE_ANY },
+	{ "extra-output",           processExtraOutputOption,       false,  STAGE_ANY },
 	{ "fields",                 processFieldsOption,            false,  STAGE_ANY },
 	{ "filter-terminator",      processFilterTerminatorOption,  true,   STAGE_ANY },
 	{ "format",                 processFormatOption,            true,   STAGE_ANY },
+	{ "git-index",              processGitIndexOption,          true,   STAGE_ANY },
 	{ "help",                   processHelpOption,              true,   STAGE_ANY },
 	{ "help-full",              processHelpFullOption,          true,   STAGE_ANY },
 	{ "if0",                    processIf0Option,               false,  STAGE_ANY },
+	{ "jobs",                   processJobsOption,              true,   STAGE_ANY },
 #ifdef HAVE_ICONV
 	{ "input-encoding",         processInputEncodingOption,     false,  STAGE_ANY },
 	{ "output-encoding",        processOutputEncodingOption,    false,  STAGE_ANY },
@@ -2867,22 +3548,37 @@ static parametricOption ParametricOptions [] = {
 	{ "list-regex-flags",       processListRegexFlagsOptions,   true,   STAGE_ANY },
 	{ "list-roles",             processListRolesOptions,        true,   STAGE_ANY },
 	{ "list-subparsers",        processListSubparsersOptions,   true,   STAGE_ANY },
+	{ "max-file-bytes",         processMaxFileBytesOption,      true,   STAGE_ANY },
+	{ "max-file-time",          processMaxFileTimeOption,       true,   STAGE_ANY },
+	{ "max-line-bytes",         processMaxLineBytesOption,      true,   STAGE_ANY },
 	{ "maxdepth",               processMaxRecursionDepthOption, true,   STAGE_ANY },
+	{ "memory-limit",           processMemoryLimitOption,       true,   STAGE_ANY },
+	{ "metrics-file",           processMetricsFileOption,       true,   STAGE_ANY },
+	{ "metrics-format",         processMetricsFormatOption,     true,   STAGE_ANY },
+	{ "minified",               processMinifiedOption,          true,   STAGE_ANY },
 	{ "optlib-dir",             processOptlibDir,               false,  STAGE_ANY },
 	{ "options",                processOptionFile,              false,  STAGE_ANY },
 	{ "options-maybe",          processOptionFileMaybe,         false,  STAGE_ANY },
 	{ "output-format",          processOutputFormat,            true,   STAGE_ANY },
 	{ "pattern-length-limit",   processPatternLengthLimit,      true,   STAGE_ANY },
+	{ "promote-regex",          processPromoteRegexOption,      true,   STAGE_ANY },
 	{ "pseudo-tags",            processPseudoTags,              false,  STAGE_ANY },
+	{ "read-ahead",             processReadAheadOption,         true,   STAGE_ANY },
+	{ "shard",                  processShardOption,             true,   STAGE_ANY },
 	{ "sort",                   processSortOption,              true,   STAGE_ANY },
+	{ "sort-memory-limit",      processSortMemoryLimitOption,   true,   STAGE_ANY },
 	{ "tag-relative",           processTagRelative,             true,   STAGE_ANY },
 	{ "totals",                 processTotals,                  true,   STAGE_ANY },
 	{ "version",                processVersionOption,           true,   STAGE_ANY },
+#ifdef ALLOC_STATS
+	{ "_alloc-stats",           processAllocStatsOption,        false,  STAGE_ANY },
+#endif
 	{ "_anonhash",              processAnonHashOption,          false,  STAGE_ANY },
 	{ "_dump-keywords",         processDumpKeywordsOption,      false,  STAGE_ANY },
 	{ "_dump-options",          processDumpOptionsOption,       false,  STAGE_ANY },
 	{ "_dump-prelude",          processDumpPreludeOption,       false,  STAGE_ANY },
 	{ "_echo",                  processEchoOption,              false,  STAGE_ANY },
+	{ "_event-trace",           processEventTraceOption,        false,  STAGE_ANY },
 	{ "_force-initializing",    processForceInitOption,         false,  STAGE_ANY },
 	{ "_force-quit",            processForceQuitOption,         false,  STAGE_ANY },
 #ifdef HAVE_JANSSON
@@ -2896,24 +3592,33 @@ static parametricOption ParametricOptions [] = {
 	{ "_trace",                 processTraceOption,             false,  STAGE_ANY },
 #endif
 	{ "_xformat",               processXformatOption,           false,  STAGE_ANY },
+	{ "_xml-stream-threshold",  processXmlStreamThresholdOption, false, STAGE_ANY },
 };
 
 static booleanOption BooleanOptions [] = {
-	{ "append",         &Option.append,                 true,  STAGE_ANY },
+	{ "aggregate-references", &Option.aggregateReferences, true, STAGE_ANY, setAggregateReferences },
+	{ "dedup-content",  &Option.dedupContent,           true,  STAGE_ANY },
 	{ "file-scope",     ((bool *)XTAG_FILE_SCOPE),      false, STAGE_ANY, setBooleanToXtagWithWarning },
 	{ "file-tags",      ((bool *)XTAG_FILE_NAMES),      false, STAGE_ANY, setBooleanToXtagWithWarning },
 	{ "filter",         &Option.filter,                 true,  STAGE_ANY },
 	{ "guess-language-eagerly", &Option.guessLanguageEagerly, false, STAGE_ANY },
+	{ "incremental",    &Option.incremental,            true,  STAGE_ANY },
 	{ "line-directives",&Option.lineDirectives,         false, STAGE_ANY },
 	{ "links",          &Option.followLinks,            false, STAGE_ANY },
 	{ "machinable",     &localOption.machinable,        true,  STAGE_ANY },
+	{ "merge",          &Option.merge,                  true,  STAGE_ANY },
+	{ "name-index",     &Option.nameIndex,              true,  STAGE_ANY },
 	{ "put-field-prefix", &Option.putFieldPrefix,       false, STAGE_ANY },
 	{ "print-language", &Option.printLanguage,          true,  STAGE_ANY },
 	{ "quiet",          &Option.quiet,                  false, STAGE_ANY },
 #ifdef RECURSE_SUPPORTED
 	{ "recurse",        &Option.recurse,                false, STAGE_ANY },
+	{ "respect-gitignore", &Option.respectGitignore,    false, STAGE_ANY },
 #endif
+	{ "secondary-index", &Option.secondaryIndex,        true,  STAGE_ANY },
+	{ "trigram-index",  &Option.trigramIndex,           true,  STAGE_ANY },
 	{ "verbose",        &ctags_verbose,                 false, STAGE_ANY },
+	{ "watch",          &Option.watch,                  true,  STAGE_ANY },
 #ifdef _WIN32
 	{ "use-slash-as-filename-separator", (bool *)&Option.useSlashAsFilenameSeparator, false, STAGE_ANY },
 #endif
@@ -3926,9 +4631,18 @@ extern void initOptions (void)
 extern void freeOptionResources (void)
 {
 	freeString (&Option.tagFileName);
+	freeString (&Option.deltaFileName);
 	freeString (&Option.fileList);
+	freeString (&Option.gitIndex);
 	freeString (&Option.filterTerminator);
-
+	freeString (&Option.metricsFile);
+
+	if (ExcludedSet)
+		globSetDelete (ExcludedSet);
+	ExcludedSet = NULL;
+	if (ExcludedExceptionSet)
+		globSetDelete (ExcludedExceptionSet);
+	ExcludedExceptionSet = NULL;
 	freeList (&Excluded);
 	freeList (&ExcludedException);
 	freeList (&Option.headerExt);
@@ -3981,3 +4695,8 @@ extern bool isDestinationStdout (void)
 
 	return toStdout;
 }
+
+extern void setSortOrder (sortType sorted)
+{
+	Option.sorted = sorted;
+}
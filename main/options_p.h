@@ -55,6 +55,7 @@ typedef enum eLocate {
 	EX_LINENUM,  /* -n  only line numbers in tag file */
 	EX_PATTERN,  /* -N  only patterns in tag file */
 	EX_COMBINE,  /* Combine linenum and pattern with `;'*/
+	EX_HASH,     /* line numbers verified by the linehash field */
 } exCmd;
 
 typedef enum sortType {
@@ -63,6 +64,28 @@ typedef enum sortType {
 	SO_FOLDSORTED
 } sortType;
 
+/* What --minified=<policy> does for an input file looking minified */
+typedef enum eMinifiedPolicy {
+	MINIFIED_PARSE,
+	MINIFIED_SKIP,
+	MINIFIED_TOPLEVEL,
+	MINIFIED_TRUNCATE,
+	COUNT_MINIFIED_POLICY
+} minifiedPolicy;
+
+/* The formats of --metrics-file */
+typedef enum eMetricsFormat {
+	METRICS_OPENMETRICS,
+	METRICS_JSON,
+} metricsFormat;
+
+/* --promote-regex */
+typedef enum eRegexPromotion {
+	REGEX_PROMOTION_NO,
+	REGEX_PROMOTION_YES,
+	REGEX_PROMOTION_VERIFY,
+} regexPromotion;
+
 typedef enum eTagRelative {
 	TREL_NO,
 	TREL_YES,
@@ -74,15 +97,27 @@ typedef enum eTagRelative {
  */
 typedef struct sOptionValues {
 	bool append;         /* -a  append to "tags" file */
+	bool appendReplace;  /* --append=replace  drop the old tags of the input files */
+	bool incremental;    /* --incremental  reuse tags of unchanged files */
+	bool dedupContent;   /* --dedup-content  reuse tags of files with the same contents */
+	bool watch;          /* --watch  make the tag file again when input files change */
+	bool nameIndex;      /* --name-index  write <tagfile>.index */
+	bool trigramIndex;   /* --trigram-index  write <tagfile>.trigrams */
+	bool secondaryIndex; /* --secondary-index  write <tagfile>.secondary */
+	bool aggregateReferences; /* --aggregate-references  write a reference tag once per input file */
+	bool merge;          /* --merge  merge sorted tag files */
 	bool backward;       /* -B  regexp patterns search backwards */
 	bool etags;          /* -e  output Emacs style tags file */
 	exCmd locate;           /* --excmd  EX command used to locate tag */
 	bool recurse;        /* -R  recurse into directories */
+	bool respectGitignore; /* --respect-gitignore  skip files listed in ignore files */
 	sortType sorted;        /* -u,--sort  sort tags */
 	bool xref;           /* -x  generate xref output instead */
 	fmtElement *customXfmt;	/* compiled code for --xformat=XFMT */
 	char *fileList;         /* -L  name of file containing names of files */
+	char *gitIndex;         /* --git-index  worktree whose index lists the files */
 	char *tagFileName;      /* -o  name of tags file */
+	char *deltaFileName;    /* --delta  previous tag file compared with the tag file */
 	stringList* headerExt;  /* -h  header extensions */
 	stringList* etagsInclude;/* --etags-include  list of TAGS files to include*/
 	unsigned int tagFileFormat;/* --format  tag file format (level) */
@@ -95,19 +130,41 @@ typedef struct sOptionValues {
 	bool filter;         /* --filter  behave as filter: files in, tags out */
 	char* filterTerminator; /* --filter-terminator  string to output */
 	tagRelative tagRelative;    /* --tag-relative file paths relative to tag file */
-	int  printTotals;    /* --totals  print cumulative statistics */
+	int  printTotals;    /* --totals  print cumulative statistics:
+	                        1 (yes), 2 (extra), or 3 (json) */
+	unsigned int slowFiles; /* --totals=slow:N  print the N slowest files */
+	char *metricsFile;      /* --metrics-file  write the statistics to the file */
+	metricsFormat metricsFormat; /* --metrics-format */
+#ifdef ALLOC_STATS
+	unsigned int allocStatsSites; /* --_alloc-stats[=N]  print the allocations
+	                                 and the N busiest call sites */
+#endif
 	bool lineDirectives; /* --line-directives  process #line directives */
 	bool printLanguage;  /* --print-language */
 	bool guessLanguageEagerly; /* --guess-language-eagerly|-G */
 	bool quiet;		      /* --quiet */
 	bool fatalWarnings;	/* --_fatal-warnings */
 	unsigned int patternLengthLimit; /* --pattern-length-limit=N */
+	regexPromotion promoteRegex; /* --promote-regex  match Posix patterns with pcre2 */
 	bool putFieldPrefix;		 /* --put-field-prefix */
 	unsigned int maxRecursionDepth; /* --maxdepth=<max-recursion-depth> */
+	unsigned int jobs;			/* --jobs=<N> */
+	unsigned int readAhead;		/* --read-ahead=<N> */
+	unsigned int shardIndex;	/* --shard=<K>/<N>: K, from 1 */
+	unsigned int shardCount;	/* --shard=<K>/<N>: N, 0 if not given */
+	minifiedPolicy minified;	/* --minified=<policy> */
+	unsigned long minifiedLimit; /* --minified=truncate:<size> */
+	unsigned int maxFileTime;	/* --max-file-time=<seconds> */
+	unsigned long maxFileBytes;	/* --max-file-bytes=<size> */
+	unsigned long maxLineBytes;	/* --max-line-bytes=<size> */
+	unsigned long sortMemoryLimit; /* --sort-memory-limit=<size> */
+	unsigned long memoryLimit;	/* --memory-limit=<size>, 0 for no limit */
+	unsigned long xmlStreamThreshold; /* --_xml-stream-threshold=<size> */
 	bool fieldsReset;				/* --fields=[^+-] */
 	enum interactiveMode { INTERACTIVE_NONE = 0,
 						   INTERACTIVE_DEFAULT,
-						   INTERACTIVE_SANDBOX, } interactive; /* --interactive */
+						   INTERACTIVE_SANDBOX,
+						   INTERACTIVE_SERVER, } interactive; /* --interactive */
 #ifdef _WIN32
 	enum filenameSepOp { FILENAME_SEP_NO_REPLACE = false,
 						 FILENAME_SEP_USE_SLASH  = true,
@@ -133,6 +190,8 @@ extern CONST_OPTION optionValues		Option;
 */
 extern void freeList (stringList** const pString);
 extern void setDefaultTagFileName (void);
+/* For --watch: write the tags to NAME instead */
+extern void setTagFileName (const char *const name);
 extern void checkOptions (void);
 extern bool filesRequired (void);
 extern void testEtagsInvocation (void);
@@ -184,5 +243,8 @@ extern bool isDestinationStdout (void);
 
 extern void setMainLoop (mainLoopFunc func, void *data);
 
+/* For --merge: the tags are compared as the merged tag files are sorted. */
+extern void setSortOrder (sortType sorted);
+
 extern bool ptagMakePatternLengthLimit (ptagDesc *pdesc, langType langType, const void *data);
 #endif  /* CTAGS_MAIN_OPTIONS_PRIVATE_H */
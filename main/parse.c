@@ -21,12 +21,16 @@
 
 #include "ctags.h"
 #include "debug.h"
+#include "dedup_p.h"
 #include "entry_p.h"
+#include "eventtrace_p.h"
 #include "field_p.h"
 #include "flags_p.h"
 #include "htable.h"
+#include "jobs_p.h"
 #include "keyword.h"
 #include "lxpath_p.h"
+#include "manifest_p.h"
 #include "param.h"
 #include "param_p.h"
 #include "parse_p.h"
@@ -91,7 +95,6 @@ typedef struct sParserObject {
 	unsigned int justRunForSchedulingBase:1;
 	unsigned int used;			/* Used for printing language specific statistics. */
 
-	unsigned int anonymousIdentiferId; /* managed by anon* functions */
 
 	struct slaveControlBlock *slaveControlBlock;
 	struct kindControlBlock  *kindControlBlock;
@@ -116,11 +119,13 @@ static void addParserPseudoTags (langType language);
 static void installKeywordTable (const langType language);
 static void installTagRegexTable (const langType language);
 static void installTagXpathTable (const langType language);
-static void anonResetMaybe (parserObject *parser);
 static void setupAnon (void);
 static void teardownAnon (void);
+static unsigned int *anonymousIdOf (langType language);
 static void uninstallTagXpathTable (const langType language);
 static bool hasLanguageAnyRegexPatterns (const langType language);
+static bool doesLanguageRunScript (const langType language);
+static bool lregexQueryParserAndSubparsers (const langType language, bool (* predicate) (struct lregexControlBlock *));
 
 /*
 *   DATA DEFINITIONS
@@ -157,6 +162,7 @@ static parserDefinitionFunc* BuiltInParsers[] = {
 };
 static parserObject* LanguageTable = NULL;
 static unsigned int LanguageCount = 0;
+static unsigned int LanguageTableSize = 0;	/* allocated for --langdef */
 static hashTable* LanguageHTable = NULL;
 static kindDefinition defaultFileKind = {
 	.enabled     = false,
@@ -167,6 +173,51 @@ static kindDefinition defaultFileKind = {
 
 static langType ctagsSelfTestLang;
 
+/* Whether matching the regex patterns of the current parser is timed
+ * for --totals=extra. */
+static bool RegexTimed;
+/* True while running a parser whose optscript code may read the fields
+ * of the tags. */
+static bool InputRunsScript;
+/* False while running a parser whose regex patterns may keep cork
+ * indexes with scope actions or scripts. */
+static bool CorkFlushable;
+
+/* The point marked with markRescanPoint () by the parser running for
+ * LANGUAGE in the current pass. */
+static struct sRescanPoint {
+	langType language;
+	bool marked;
+	inputLinePoint input;
+	unsigned long numTags;
+	MIOPos tagfpos;
+	int lastPromise;
+	bool corked;
+	size_t corkCount;
+	unsigned int anonymousId;
+	unsigned long passStartLine;
+} RescanPoint = { .language = LANG_IGNORE, .passStartLine = 1 };
+
+/* The lines of the input file parsed by parseFileRegionWithMio ().
+ * START is 0 when the whole input file is parsed. */
+static struct sParseRegion {
+	unsigned long start, end;
+} ParseRegion;
+
+/* A line-oriented input is split into parts parsed in worker processes
+ * only when each part has this many lines. */
+#define INPUT_PART_LINES 16384
+
+/* The parts of an input file parsed in worker processes */
+struct inputParts {
+	langType language;
+	unsigned long lines;
+	unsigned int count;
+};
+
+/* Whether an anonymous name is made for the input file parsed last */
+static CTAGS_THREAD_LOCAL bool anonNamesMade;
+
 /*
 *   FUNCTION DEFINITIONS
 */
@@ -384,23 +435,33 @@ extern langType getNamedLanguageFull (const char *const name, size_t len, bool n
 			result = def->id;
 	}
 	else
+	{
+		/* This is called for each option with a language name like
+		 * --regex-<LANG>=..., so NAME is not copied for each language. */
+		vString* vstr = NULL;
+
 		for (i = 0  ;  i < LanguageCount  &&  result == LANG_IGNORE  ;  ++i)
 		{
 			const parserDefinition* const lang = LanguageTable [i].def;
 			Assert (lang->name);
-			vString* vstr = vStringNewInit (name);
-			vStringTruncate (vstr, len);
 
-			if (strcasecmp (vStringValue (vstr), lang->name) == 0)
+			if (strncasecmp (name, lang->name, len) == 0
+				&& lang->name [len] == '\0')
 				result = i;
 			else if (include_aliases)
 			{
 				stringList* const aliases = LanguageTable [i].currentAliases;
+				if (aliases && vstr == NULL)
+				{
+					vstr = vStringNewInit (name);
+					vStringTruncate (vstr, len);
+				}
 				if (aliases && stringListCaseMatched (aliases, vStringValue (vstr)))
 					result = i;
 			}
-			vStringDelete (vstr);
 		}
+		vStringDelete (vstr);
+	}
 
 	if (result != LANG_IGNORE
 		&& (!noPretending)
@@ -468,56 +529,230 @@ extern langType getLanguageForCommand (const char *const command, langType start
 											&tmp_specType);
 }
 
-static langType getPatternLanguageAndSpec (const char *const baseName, langType start_index,
-					   const char **const spec, enum specType *specType)
+/*
+ * An index of the language maps
+ *
+ * Choosing a parser for a file name with the maps of all the parsers
+ * costs several hundred comparisons per input file. The index finds the
+ * candidates in hash tables instead. Extensions are looked up as a
+ * whole. Patterns without wildcards are looked up as file names. Only
+ * the patterns having wildcards are tried one by one, and those in the
+ * "*SUFFIX" form are compared with the tail of the name without fnmatch.
+ *
+ * The index is built on the first lookup, and dropped whenever a map is
+ * changed, e.g. with --langmap or --map-<LANG>. Whether a parser is
+ * enabled is checked at lookup.
+ */
+typedef struct sLanguageMapEntry {
+	langType language;
+	unsigned int order;			/* in the map of the language */
+	vString *spec;
+	const char *suffix;			/* for "*SUFFIX" patterns */
+	size_t suffixLength;
+} languageMapEntry;
+
+static struct languageMapIndex {
+	bool built;
+	ptrArray *entries;			/* owns all the entries */
+	hashTable *extensions;		/* extension -> ptrArray of entries */
+	hashTable *names;			/* pattern without wildcards -> ptrArray of entries */
+	ptrArray *globs;			/* entries of patterns with wildcards */
+} LanguageMapIndex;
+
+static void invalidateLanguageMapIndex (void)
 {
-	langType result = LANG_IGNORE;
-	unsigned int i;
+	struct languageMapIndex *index = &LanguageMapIndex;
 
-	if (start_index == LANG_AUTO)
-	        start_index = 0;
-	else if (start_index == LANG_IGNORE || start_index >= (int) LanguageCount)
-		return result;
+	if (!index->built)
+		return;
 
-	*spec = NULL;
-	for (i = start_index  ;  i < LanguageCount  &&  result == LANG_IGNORE  ;  ++i)
+	hashTableDelete (index->extensions);
+	hashTableDelete (index->names);
+	ptrArrayDelete (index->globs);
+	ptrArrayDelete (index->entries);
+	memset (index, 0, sizeof (*index));
+}
+
+static languageMapEntry *newLanguageMapEntry (struct languageMapIndex *index,
+											  langType language, unsigned int order,
+											  vString *spec)
+{
+	languageMapEntry *entry = xMalloc (1, languageMapEntry);
+
+	entry->language = language;
+	entry->order = order;
+	entry->spec = spec;
+	entry->suffix = NULL;
+	entry->suffixLength = 0;
+	ptrArrayAdd (index->entries, entry);
+	return entry;
+}
+
+/* Entries in a list are ordered by language as the languages are
+ * indexed in order. Only the first spec matching a key is recorded for a
+ * language; that is what stringListFinds returns. */
+static void addLanguageMapEntryToTable (hashTable *table, const char *key,
+										languageMapEntry *entry)
+{
+	ptrArray *list = hashTableGetItem (table, key);
+
+	if (list == NULL)
 	{
-		if (! isLanguageEnabled (i))
-			continue;
+		list = ptrArrayNew (NULL);
+		hashTablePutItem (table, eStrdup (key), list);
+	}
+	else
+	{
+		languageMapEntry *last = ptrArrayLast (list);
+		if (last->language == entry->language)
+			return;
+	}
+	ptrArrayAdd (list, entry);
+}
+
+static bool hasWildcard (const char *pattern)
+{
+	return strpbrk (pattern, "*?[\\") != NULL;
+}
 
+static void buildLanguageMapIndex (struct languageMapIndex *index)
+{
+#ifdef CASE_INSENSITIVE_FILENAMES
+	hashTableHashFunc hash = hashCstrcasehash;
+	hashTableEqualFunc eq = hashCstrcaseeq;
+#else
+	hashTableHashFunc hash = hashCstrhash;
+	hashTableEqualFunc eq = hashCstreq;
+#endif
+
+	index->entries = ptrArrayNew (eFree);
+	index->extensions = hashTableNewFlat (512, hash, eq, eFree,
+										  (hashTableDeleteFunc) ptrArrayDelete);
+	index->names = hashTableNewFlat (64, hash, eq, eFree,
+									 (hashTableDeleteFunc) ptrArrayDelete);
+	index->globs = ptrArrayNew (NULL);
+
+	for (unsigned int i = 0; i < LanguageCount; i++)
+	{
 		parserObject *parser = LanguageTable + i;
-		stringList* const ptrns = parser->currentPatterns;
-		vString* tmp;
+		stringList *const ptrns = parser->currentPatterns;
+		stringList *const exts = parser->currentExtensions;
 
-		if (ptrns != NULL && (tmp = stringListFileFinds (ptrns, baseName)))
+		for (unsigned int j = 0; ptrns && j < stringListCount (ptrns); j++)
 		{
-			result = i;
-			*spec = vStringValue(tmp);
-			*specType = SPEC_PATTERN;
-			goto found;
+			vString *ptrn = stringListItem (ptrns, j);
+			languageMapEntry *entry = newLanguageMapEntry (index, i, j, ptrn);
+			const char *p = vStringValue (ptrn);
+
+			if (!hasWildcard (p))
+				addLanguageMapEntryToTable (index->names, p, entry);
+			else
+			{
+				if (p[0] == '*' && !hasWildcard (p + 1))
+				{
+					entry->suffix = p + 1;
+					entry->suffixLength = vStringLength (ptrn) - 1;
+				}
+				ptrArrayAdd (index->globs, entry);
+			}
+		}
+
+		for (unsigned int j = 0; exts && j < stringListCount (exts); j++)
+		{
+			vString *ext = stringListItem (exts, j);
+			languageMapEntry *entry = newLanguageMapEntry (index, i, j, ext);
+			addLanguageMapEntryToTable (index->extensions, vStringValue (ext), entry);
 		}
 	}
+	index->built = true;
+}
 
-	for (i = start_index  ;  i < LanguageCount  &&  result == LANG_IGNORE  ;  ++i)
+static bool globMatched (const languageMapEntry *entry, const char *const baseName,
+						 size_t baseNameLength)
+{
+	if (entry->suffix == NULL)
+		return fileNameMatched (entry->spec, baseName);
+
+	if (baseNameLength < entry->suffixLength)
+		return false;
+#ifdef CASE_INSENSITIVE_FILENAMES
+	return strcasecmp (baseName + baseNameLength - entry->suffixLength,
+					   entry->suffix) == 0;
+#else
+	return strcmp (baseName + baseNameLength - entry->suffixLength,
+				   entry->suffix) == 0;
+#endif
+}
+
+/* The first enabled entry for START_INDEX or a later language in LIST */
+static languageMapEntry *findLanguageMapEntry (ptrArray *list, langType start_index)
+{
+	for (unsigned int i = 0; list && i < ptrArrayCount (list); i++)
 	{
-		if (! isLanguageEnabled (i))
-			continue;
+		languageMapEntry *entry = ptrArrayItem (list, i);
+		if (entry->language >= start_index && isLanguageEnabled (entry->language))
+			return entry;
+	}
+	return NULL;
+}
 
-		parserObject *parser = LanguageTable + i;
-		stringList* const exts = parser->currentExtensions;
-		vString* tmp;
+static langType getPatternLanguageAndSpec (const char *const baseName, langType start_index,
+					   const char **const spec, enum specType *specType)
+{
+	struct languageMapIndex *index = &LanguageMapIndex;
+	languageMapEntry *entry;
+
+	if (start_index == LANG_AUTO)
+	        start_index = 0;
+	else if (start_index == LANG_IGNORE || start_index >= (int) LanguageCount)
+		return LANG_IGNORE;
+
+	if (!index->built)
+		buildLanguageMapIndex (index);
+
+	*spec = NULL;
 
-		if (exts != NULL && (tmp = stringListExtensionFinds (exts,
-								     fileExtension (baseName))))
+	/* A pattern in the map of the first language having a matching one.
+	 * If the language has both a file name and a glob matching, the one
+	 * coming first in the map wins. */
+	entry = findLanguageMapEntry (hashTableGetItem (index->names, baseName),
+								  start_index);
+	size_t baseNameLength = strlen (baseName);
+	for (unsigned int i = 0; i < ptrArrayCount (index->globs); i++)
+	{
+		languageMapEntry *glob = ptrArrayItem (index->globs, i);
+
+		if (glob->language < start_index)
+			continue;
+		if (entry && (glob->language > entry->language
+					  || (glob->language == entry->language
+						  && glob->order > entry->order)))
+			break;
+		if (isLanguageEnabled (glob->language)
+			&& globMatched (glob, baseName, baseNameLength))
 		{
-			result = i;
-			*spec = vStringValue(tmp);
-			*specType = SPEC_EXTENSION;
-			goto found;
+			entry = glob;
+			break;
 		}
 	}
-found:
-	return result;
+	if (entry)
+	{
+		*spec = vStringValue (entry->spec);
+		*specType = SPEC_PATTERN;
+		return entry->language;
+	}
+
+	entry = findLanguageMapEntry (hashTableGetItem (index->extensions,
+													fileExtension (baseName)),
+								  start_index);
+	if (entry)
+	{
+		*spec = vStringValue (entry->spec);
+		*specType = SPEC_EXTENSION;
+		return entry->language;
+	}
+
+	return LANG_IGNORE;
 }
 
 extern langType getLanguageForFilename (const char *const filename, langType startFrom)
@@ -963,6 +1198,28 @@ static vString* determineVimFileType (const char *const modeline)
 	return filetype;
 }
 
+static vString* determineVimFileTypeInLine (const char *const line)
+{
+	const char* const prefix[] = {
+		"vim:", "vi:", "ex:"
+	};
+	const char* p;
+	unsigned int k;
+
+	for (k = 0; k < ARRAY_SIZE(prefix); k++)
+		if ((p = strstr (line, prefix[k])) != NULL)
+		{
+			p += strlen(prefix[k]);
+			for ( ;  isspace ((unsigned char) *p)  ;  ++p)
+				;  /* no-op */
+			return determineVimFileType(p);
+		}
+	return NULL;
+}
+
+/* Look for a vim modeline in the first lines (BOF) or the last lines
+ * (EOF) of INPUT. */
+#define VIM_MODELINES 5
 static vString* extractVimFileTypeCommon(MIO* input, bool eof)
 {
 	/* http://vimdoc.sourceforge.net/htmldoc/options.html#modeline
@@ -977,52 +1234,22 @@ static vString* extractVimFileTypeCommon(MIO* input, bool eof)
 	    checked for set commands. */
 
 	vString* filetype = NULL;
-#define RING_SIZE 5
-	vString* ring[RING_SIZE];
-	int i, j;
-	unsigned int k;
-	const char* const prefix[] = {
-		"vim:", "vi:", "ex:"
-	};
+	vString* ring[VIM_MODELINES + 1];  /* one more for reading at EOF */
+	unsigned int n, i;
 
-	for (i = 0; i < RING_SIZE; i++)
+	for (i = 0; i < ARRAY_SIZE(ring); i++)
 		ring[i] = vStringNew ();
 
-	i = 0;
-	while ((readLineRaw (ring[i++], input)) != NULL)
-		if (i == RING_SIZE)
-		{
-			i = 0;
-			if (!eof)
-			{
-				i++;
-				break;
-			}
-		}
-
-	j = i;
-	do
-	{
-		const char* p;
-
-		j--;
-		if (j < 0)
-			j = RING_SIZE - 1;
+	for (n = 0; eof || n < VIM_MODELINES; n++)
+		if (readLineRaw (ring[n % ARRAY_SIZE(ring)], input) == NULL)
+			break;
 
-		for (k = 0; k < ARRAY_SIZE(prefix); k++)
-			if ((p = strstr (vStringValue (ring[j]), prefix[k])) != NULL)
-			{
-				p += strlen(prefix[k]);
-				for ( ;  isspace ((unsigned char) *p)  ;  ++p)
-					;  /* no-op */
-				filetype = determineVimFileType(p);
-				break;
-			}
-	} while (((i == RING_SIZE)? (j != RING_SIZE - 1): (j != i)) && (!filetype));
+	/* A later modeline wins as in vim. */
+	for (i = 0; i < n && i < VIM_MODELINES && !filetype; i++)
+		filetype = determineVimFileTypeInLine (vStringValue (ring[(n - 1 - i) % ARRAY_SIZE(ring)]));
 
-	for (i = RING_SIZE - 1; i >= 0; i--)
+	for (i = 0; i < ARRAY_SIZE(ring); i++)
 		vStringDelete (ring[i]);
-#undef RING_SIZE
 
 	if (filetype && (vStringLength (filetype) == 0))
 	{
@@ -1101,6 +1328,8 @@ static vString* extractPHPMark(MIO* input)
 struct getLangCtx {
     const char *fileName;
     MIO        *input;
+    MIO        *head;		/* the first lines of input for the tasters */
+    MIO        *tail;		/* the last lines of input for the tasters */
     bool     err;
 };
 
@@ -1132,15 +1361,140 @@ struct getLangCtx {
 	} while (0)
 
 #define GLC_FCLOSE(_glc_) do {                              \
+    if ((_glc_)->head) {                                    \
+        mio_unref((_glc_)->head);                           \
+        mio_unref((_glc_)->tail);                           \
+        (_glc_)->head = (_glc_)->tail = NULL;               \
+    }                                                       \
     if ((_glc_)->input) {                                   \
         mio_unref((_glc_)->input);                             \
         (_glc_)->input = NULL;                              \
     }                                                       \
 } while (0)
 
+/* The tasters read two windows of the input instead of the input itself:
+ * the head window for the tasters looking at the first lines, and the
+ * tail window for the tasters looking at the last lines. The windows are
+ * made once for an input file. The head window has at least
+ * TASTE_HEAD_LINES lines. The tail window has the last TASTE_TAIL_BYTES
+ * bytes, the range of the Emacs local variables list, and at least
+ * TASTE_TAIL_LINES lines. Either window is cut at TASTE_WINDOW_LIMIT bytes;
+ * a window smaller than that can be the whole input.
+ */
+#define TASTE_HEAD_LINES 5
+#define TASTE_TAIL_BYTES 3000
+#define TASTE_TAIL_LINES (VIM_MODELINES + 1)
+#define TASTE_WINDOW_LIMIT (64 * 1024)
+
+static size_t countNewlines (const unsigned char *data, size_t size, size_t max)
+{
+	size_t n = 0;
+	const unsigned char *end = data + size;
+
+	while (n < max && (data = memchr (data, '\n', end - data)) != NULL)
+	{
+		n++;
+		data++;
+	}
+	return n;
+}
+
+/* Return a memory stream for SIZE bytes of INPUT from OFFSET. If INPUT
+ * is a memory stream, the returned stream refers to its buffer. */
+static MIO *newTasteWindow (MIO *input, long offset, size_t size)
+{
+	size_t length;
+	unsigned char *data = mio_memory_get_data (input, &length);
+
+	if (data)
+		return mio_new_memory (data + offset, size, NULL, NULL);
+
+	data = eMalloc (size? size: 1);
+	if (mio_seek (input, offset, SEEK_SET) != 0)
+		length = 0;
+	else
+		length = mio_read (input, data, 1, size);
+	return mio_new_memory (data, length, eRealloc, eFreeNoNullCheck);
+}
+
+/* Return the number of the first bytes of INPUT (SIZE bytes) having
+ * NLINES lines, or the bytes up to TASTE_WINDOW_LIMIT. */
+static size_t measureHeadWindow (MIO *input, size_t size, size_t nlines)
+{
+	unsigned char buf [4096];
+	size_t length = 0;
+	size_t n = 0;
+
+	mio_rewind (input);
+	while (length < size && length < TASTE_WINDOW_LIMIT)
+	{
+		size_t r = mio_read (input, buf, 1, sizeof (buf));
+		if (r == 0)
+			break;
+		n += countNewlines (buf, r, nlines - n);
+		length += r;
+		if (n >= nlines)
+			break;
+	}
+	return length < size? length: size;
+}
+
+/* Return the offset of the tail window of INPUT (SIZE bytes): the last
+ * TASTE_TAIL_BYTES bytes extended back to have NLINES newlines. */
+static size_t measureTailWindow (MIO *input, size_t size, size_t nlines)
+{
+	unsigned char buf [4096];
+	size_t offset = size > TASTE_TAIL_BYTES? size - TASTE_TAIL_BYTES: 0;
+	size_t n;
+
+	if (offset == 0)
+		return 0;
+
+	if (mio_seek (input, (long) offset, SEEK_SET) != 0)
+		return 0;
+	n = countNewlines (buf, mio_read (input, buf, 1, sizeof (buf)), nlines);
+	/* The first read covers the whole range of TASTE_TAIL_BYTES. */
+	while (n < nlines && offset > 0 && size - offset < TASTE_WINDOW_LIMIT)
+	{
+		size_t r = offset < sizeof (buf)? offset: sizeof (buf);
+
+		offset -= r;
+		if (mio_seek (input, (long) offset, SEEK_SET) != 0
+			|| mio_read (input, buf, 1, r) != r)
+			return offset + r;
+		n += countNewlines (buf, r, nlines - n);
+	}
+	return offset;
+}
+
+static void prepareTasteWindows (struct getLangCtx *glc)
+{
+	size_t size, headSize, tailOffset;
+
+	if (glc->head)
+		return;
+
+	if (mio_seek (glc->input, 0, SEEK_END) != 0)
+		size = 0;
+	else
+		size = (size_t) mio_tell (glc->input);
+
+	headSize = measureHeadWindow (glc->input, size, TASTE_HEAD_LINES);
+	tailOffset = measureTailWindow (glc->input, size, TASTE_TAIL_LINES);
+
+	glc->head = newTasteWindow (glc->input, 0, headSize);
+	if (tailOffset == 0 && headSize == size)
+		glc->tail = mio_ref (glc->head);
+	else
+		glc->tail = newTasteWindow (glc->input, (long) tailOffset,
+									size - tailOffset);
+	mio_rewind (glc->input);
+}
+
 static const struct taster {
 	vString* (* taste) (MIO *);
 	const char     *msg;
+	bool           atEOF;	/* reads the tail window */
 } eager_tasters[] = {
 	{
 		.taste  = extractInterpreter,
@@ -1157,6 +1511,7 @@ static const struct taster {
 	{
 		.taste  = extractEmacsModeLanguageAtEOF,
 		.msg    = "emacs mode at the EOF",
+		.atEOF  = true,
 	},
 	{
 		.taste  = extractVimFileTypeAtBOF,
@@ -1165,6 +1520,7 @@ static const struct taster {
 	{
 		.taste  = extractVimFileTypeAtEOF,
 		.msg    = "vim modeline at the EOF",
+		.atEOF  = true,
 	},
 	{
 		.taste  = extractPHPMark,
@@ -1405,12 +1761,14 @@ tasteLanguage (struct getLangCtx *glc, const struct taster *const tasters, int n
 
     if (fallback)
 	    *fallback = LANG_IGNORE;
+    prepareTasteWindows (glc);
     for (i = 0; i < n_tasters; ++i) {
         langType language;
         vString* spec;
+        MIO *window = tasters[i].atEOF? glc->tail: glc->head;
 
-        mio_rewind(glc->input);
-	spec = tasters[i].taste(glc->input);
+        mio_rewind(window);
+	spec = tasters[i].taste(window);
 
         if (NULL != spec) {
             verbose ("	%s: %s\n", tasters[i].msg, vStringValue (spec));
@@ -1471,6 +1829,8 @@ getFileLanguageForRequestInternal (struct GetLanguageRequest *req)
     struct getLangCtx glc = {
         .fileName = fileName,
         .input    = (req->type == GLR_REUSE)? mio_ref (req->mio): NULL,
+        .head     = NULL,
+        .tail     = NULL,
         .err      = false,
     };
     const char* const baseName = baseFilename (fileName);
@@ -1630,6 +1990,7 @@ extern void installLanguageMapDefault (const langType language)
 	parserObject* parser;
 	Assert (0 <= language  &&  language < (int) LanguageCount);
 	parser = LanguageTable + language;
+	invalidateLanguageMapIndex ();
 	if (parser->currentPatterns != NULL)
 		stringListDelete (parser->currentPatterns);
 	if (parser->currentExtensions != NULL)
@@ -1704,6 +2065,7 @@ extern void installLanguageAliasesDefaults (void)
 extern void clearLanguageMap (const langType language)
 {
 	Assert (0 <= language  &&  language < (int) LanguageCount);
+	invalidateLanguageMapIndex ();
 	stringListClear ((LanguageTable + language)->currentPatterns);
 	stringListClear ((LanguageTable + language)->currentExtensions);
 }
@@ -1724,6 +2086,7 @@ static bool removeLanguagePatternMap1(const langType language, const char *const
 
 	if (ptrn != NULL && stringListDeleteItemExtension (ptrn, pattern))
 	{
+		invalidateLanguageMapIndex ();
 		verbose (" (removed from %s)", getLanguageName (language));
 		result = true;
 	}
@@ -1754,6 +2117,7 @@ extern void addLanguagePatternMap (const langType language, const char* ptrn,
 	parser = LanguageTable + language;
 	if (exclusiveInAllLanguages)
 		removeLanguagePatternMap (LANG_AUTO, ptrn);
+	invalidateLanguageMapIndex ();
 	stringListAdd (parser->currentPatterns, str);
 }
 
@@ -1764,6 +2128,7 @@ static bool removeLanguageExtensionMap1 (const langType language, const char *co
 
 	if (exts != NULL  &&  stringListDeleteItemExtension (exts, extension))
 	{
+		invalidateLanguageMapIndex ();
 		verbose (" (removed from %s)", getLanguageName (language));
 		result = true;
 	}
@@ -1793,6 +2158,7 @@ extern void addLanguageExtensionMap (
 	Assert (0 <= language  &&  language < (int) LanguageCount);
 	if (exclusiveInAllLanguages)
 		removeLanguageExtensionMap (LANG_AUTO, extension);
+	invalidateLanguageMapIndex ();
 	stringListAdd ((LanguageTable + language)->currentExtensions, str);
 }
 
@@ -2015,6 +2381,7 @@ extern void initializeParsing (void)
 
 	builtInCount = ARRAY_SIZE (BuiltInParsers);
 	LanguageTable = xMalloc (builtInCount, parserObject);
+	LanguageTableSize = builtInCount;
 	memset(LanguageTable, 0, builtInCount * sizeof (parserObject));
 	for (i = 0; i < builtInCount; ++i)
 	{
@@ -2022,11 +2389,11 @@ extern void initializeParsing (void)
 		LanguageTable [i].pretendedAsLanguage = LANG_IGNORE;
 	}
 
-	LanguageHTable = hashTableNew (127,
-								   hashCstrcasehash,
-								   hashCstrcaseeq,
-								   NULL,
-								   NULL);
+	LanguageHTable = hashTableNewFlat (127,
+									   hashCstrcasehash,
+									   hashCstrcaseeq,
+									   NULL,
+									   NULL);
 	DEFAULT_TRASH_BOX(LanguageHTable, hashTableDelete);
 
 	verbose ("Installing parsers: ");
@@ -2058,6 +2425,8 @@ extern void initializeParsing (void)
 extern void freeParserResources (void)
 {
 	unsigned int i;
+
+	invalidateLanguageMapIndex ();
 	for (i = 0  ;  i < LanguageCount  ;  ++i)
 	{
 		parserObject* const parser = LanguageTable + i;
@@ -2090,6 +2459,7 @@ extern void freeParserResources (void)
 		eFree (LanguageTable);
 	LanguageTable = NULL;
 	LanguageCount = 0;
+	LanguageTableSize = 0;
 }
 
 static void doNothing (void)
@@ -2390,7 +2760,12 @@ extern void processLanguageDefineOption (
 			error (FATAL, "don't use `%c' in a language name (%s)", c, name);
 	}
 
-	LanguageTable = xRealloc (LanguageTable, LanguageCount + 1, parserObject);
+	/* Optlib files may define many languages. */
+	if (LanguageCount == LanguageTableSize)
+	{
+		LanguageTableSize = LanguageTableSize? LanguageTableSize * 2: 16;
+		LanguageTable = xRealloc (LanguageTable, LanguageTableSize, parserObject);
+	}
 	memset (LanguageTable + LanguageCount, 0, sizeof(parserObject));
 
 	struct preLangDefFlagData data = {
@@ -2471,6 +2846,12 @@ extern bool isLanguageRoleEnabled (const langType language, int kindIndex, int r
 						 kindIndex, roleIndex);
 }
 
+extern roleBitsType getLanguageEnabledRoleBits (const langType language, int kindIndex)
+{
+	return getEnabledRoleBits (LanguageTable [language].kindControlBlock,
+							   kindIndex);
+}
+
 extern bool isLanguageKindRefOnly (const langType language, int kindIndex)
 {
 	kindDefinition * def =  getLanguageKind(language, kindIndex);
@@ -4038,12 +4419,18 @@ extern bool processFielddefOption (const char *const option, const char *const p
 */
 
 static rescanReason createTagsForFile (const langType language,
-				       const unsigned int passCount)
+				       const unsigned int passCount,
+				       const inputLinePoint *const resumePoint)
 {
 	parserDefinition *const lang = LanguageTable [language].def;
 	rescanReason rescan = RESCAN_NONE;
 
-	resetInputFile (language, passCount > 1);
+	if (resumePoint)
+		resumeInputFile (language, resumePoint);
+	else
+		resetInputFile (language, passCount > 1);
+	RescanPoint.passStartLine = resumePoint? resumePoint->lineNumber: 1;
+	RescanPoint.marked = false;
 
 	Assert (lang->parser || lang->parser2);
 
@@ -4141,10 +4528,73 @@ extern void printParserStatisticsIfUsed (langType language)
 			fputs("==============================================\n", stderr);
 			parser->def->printStats (language);
 		}
+		printLanguageRegexStatistics (language);
 		printLanguageMultitableStatistics (language);
 	}
 }
 
+extern bool markRescanPoint (void)
+{
+	inputLinePoint input;
+
+	Assert (RescanPoint.language != LANG_IGNORE);
+
+	if (!getInputLinePoint (&input))
+		return false;
+
+	RescanPoint.marked = true;
+	RescanPoint.input = input;
+	RescanPoint.numTags = numTagsAdded ();
+	tagFilePosition (&RescanPoint.tagfpos);
+	RescanPoint.lastPromise = getLastPromise ();
+	if (RescanPoint.corked)
+		RescanPoint.corkCount = countEntryInCorkQueue ();
+	RescanPoint.anonymousId = *anonymousIdOf (RescanPoint.language);
+	return true;
+}
+
+/* Whether the tags in the cork queue can be written and released in the
+ * middle of the input: no rescan point may roll them back, and no
+ * subparser or regex pattern may refer to them. The references kept for
+ * --aggregate-references are released only when the memory is tight
+ * under --memory-limit; they are aggregated in each part written then. */
+extern bool isCorkQueueFlushable (void)
+{
+	return CorkFlushable
+		&& (!Option.aggregateReferences || isMemoryTight ())
+		&& !RescanPoint.marked
+		&& getNextSubparser (NULL, false) == NULL;
+}
+
+extern unsigned long getPassStartLine (void)
+{
+	return RescanPoint.passStartLine;
+}
+
+/* Give up the tags, the promises and the anonymous names made after the
+ * point marked in the last pass, and return the number of the tags
+ * kept. */
+static unsigned long rollbackToRescanPoint (void)
+{
+	if (RescanPoint.corked)
+		truncateCorkQueue (RescanPoint.corkCount);
+	setTagFilePosition (&RescanPoint.tagfpos, true);
+	setNumTagsAdded (RescanPoint.numTags);
+	breakPromisesAfter (RescanPoint.lastPromise);
+	*anonymousIdOf (RescanPoint.language) = RescanPoint.anonymousId;
+	return RescanPoint.numTags;
+}
+
+/* The bytes read in the pass started at START, or at the start of the
+ * input if START is NULL. */
+static unsigned long countBytesRead (const inputLinePoint *const start)
+{
+	inputLinePoint end;
+
+	getInputLinePoint (&end);
+	return end.offset - (start? start->offset: 0);
+}
+
 static bool createTagsWithFallback1 (const langType language,
 									 langType *exclusive_subparser)
 {
@@ -4157,16 +4607,33 @@ static bool createTagsWithFallback1 (const langType language,
 	parserObject *parser;
 	unsigned int corkFlags;
 	bool useCork = false;
+	bool regexTimed = RegexTimed;
+	bool inputRunsScript = InputRunsScript;
+	bool corkFlushable = CorkFlushable;
+	struct sRescanPoint rescanPoint = RescanPoint;
+	inputLinePoint resumePoint;
+	bool resuming = false;
+	unsigned long rescannedBytes = 0;
 
 	initializeParser (language);
 	parser = &(LanguageTable [language]);
+	beginTraceEvent (TRACE_EVENT_PARSE, parser->def->name);
 
 	setupLanguageSubparsersInUse (language);
+	RegexTimed = isStatsBreakdownEnabled ()
+		&& hasLanguageAnyRegexPatterns (language);
+	InputRunsScript = doesLanguageRunScript (language);
+	CorkFlushable = !doesLanguageExpectCorkInRegex (language);
+	RescanPoint.language = language;
 
 	corkFlags = parserCorkFlags (parser->def);
+	/* The references are aggregated in the cork queue. */
+	if (Option.aggregateReferences)
+		corkFlags |= CORK_QUEUE;
 	useCork = corkFlags & CORK_QUEUE;
 	if (useCork)
 		corkTagFile(corkFlags);
+	RescanPoint.corked = useCork;
 
 	if (isXtagEnabled (XTAG_PSEUDO_TAGS))
 		addParserPseudoTags (language);
@@ -4174,13 +4641,26 @@ static bool createTagsWithFallback1 (const langType language,
 	numTags = numTagsAdded ();
 	tagFilePosition (&tagfpos);
 
-	anonResetMaybe (parser);
 	parser->justRunForSchedulingBase = 0;
 
 	while ( ( whyRescan =
-		  createTagsForFile (language, ++passCount) )
+		  createTagsForFile (language, ++passCount,
+							 resuming? &resumePoint: NULL) )
 		!= RESCAN_NONE)
 	{
+		if (passCount > 1)
+			rescannedBytes += countBytesRead (resuming? &resumePoint: NULL);
+
+		resuming = (whyRescan == RESCAN_FAILED && RescanPoint.marked);
+		if (resuming)
+		{
+			/* The tags before the point stay in the cork queue. */
+			resumePoint = RescanPoint.input;
+			writerRescanFailed (rollbackToRescanPoint ());
+			tagFileResized = true;
+			continue;
+		}
+
 		if (useCork)
 		{
 			uncorkTagFile();
@@ -4221,6 +4701,14 @@ static bool createTagsWithFallback1 (const langType language,
 			*exclusive_subparser = getSubparserLanguage (s);
 	}
 
+	if (passCount > 1)
+		rescannedBytes += countBytesRead (resuming? &resumePoint: NULL);
+	addStatsRescans (language, passCount - 1, rescannedBytes);
+	RegexTimed = regexTimed;
+	InputRunsScript = inputRunsScript;
+	CorkFlushable = corkFlushable;
+	RescanPoint = rescanPoint;
+	endTraceEvent (TRACE_EVENT_PARSE);
 	return tagFileResized;
 }
 
@@ -4254,24 +4742,102 @@ extern bool runParserInNarrowedInputStream (const langType language,
 
 }
 
+/* The number of the parts the input file is split into, or 0. The
+ * parts are parsed in worker processes, and their tags are appended in
+ * the order of the parts: the result is the same as parsing the whole
+ * input file only if the tags of a line depend on nothing but the
+ * line. */
+static unsigned int countInputParts (const langType language,
+									 unsigned long *lines)
+{
+	parserObject *parser = LanguageTable + language;
+	unsigned int jobs = countIdleJobs ();
+	size_t size;
+
+	if (!parser->def->lineOriented || jobs < 2
+		|| writerSortsTags () || writerBuffersInput ())
+		return 0;
+
+	/* The workers must not share the file offset of the input. */
+	if (getInputFileData (&size) == NULL
+		|| size / INPUT_PART_LINES < 2)
+		return 0;
+
+	if (getFirstSubparser (parser->slaveControlBlock)
+		|| lregexQueryParserAndSubparsers (language, doesRegexLookBeyondLine))
+		return 0;
+
+	*lines = readToEndOfInputFile ();
+	if (*lines / INPUT_PART_LINES < jobs)
+		jobs = (unsigned int) (*lines / INPUT_PART_LINES);
+	return jobs;
+}
+
+static bool createTagsForInputParts (void *data, unsigned int start, unsigned int end)
+{
+	struct inputParts *parts = data;
+	bool tagFileResized = false;
+
+	for (unsigned int i = start; i < end; i++)
+	{
+		unsigned long first = parts->lines * i / parts->count + 1;
+		unsigned long last = parts->lines * (i + 1) / parts->count;
+
+		pushInputRegion (doesParserRequireMemoryStream (parts->language),
+						 first, last);
+		tagFileResized = createTagsWithFallback1 (parts->language, NULL)
+			? true
+			: tagFileResized;
+		popNarrowedInputStream ();
+	}
+	return tagFileResized;
+}
+
 static bool createTagsWithFallback (
 	const char *const fileName, const langType language,
 	MIO *mio, time_t mtime, bool *failureInOpenning)
 {
 	langType exclusive_subparser = LANG_IGNORE;
 	bool tagFileResized = false;
+	struct inputParts parts = { .language = language };
 
 	Assert (0 <= language  &&  language < (int) LanguageCount);
 
+	beginTraceEvent (TRACE_EVENT_OPEN, NULL);
 	if (!openInputFile (fileName, language, mio, mtime))
 	{
+		endTraceEvent (TRACE_EVENT_OPEN);
 		*failureInOpenning = true;
 		return false;
 	}
+	endTraceEvent (TRACE_EVENT_OPEN);
 	*failureInOpenning = false;
 
-	tagFileResized = createTagsWithFallback1 (language,
-											  &exclusive_subparser);
+	if (ParseRegion.start > 0)
+	{
+		pushInputRegion (doesParserRequireMemoryStream (language),
+						 ParseRegion.start, ParseRegion.end);
+		tagFileResized = createTagsWithFallback1 (language, NULL);
+		tagFileResized = forcePromises()? true: tagFileResized;
+		popNarrowedInputStream ();
+		closeInputFile ();
+		return tagFileResized;
+	}
+
+	parts.count = countInputParts (language, &parts.lines);
+	if (parts.count > 1)
+	{
+		const jobSpec spec = {
+			.what = "parts of the input",
+			.run = createTagsForInputParts,
+			.data = &parts,
+		};
+
+		tagFileResized = runJobs (&spec, parts.count, parts.count);
+	}
+	else
+		tagFileResized = createTagsWithFallback1 (language,
+												  &exclusive_subparser);
 	tagFileResized = forcePromises()? true: tagFileResized;
 
 	pushLanguage ((exclusive_subparser == LANG_IGNORE)
@@ -4354,6 +4920,7 @@ extern void freeEncodingResources (void)
 		eFree (Option.inputEncoding);
 	if (Option.outputEncoding)
 		eFree (Option.outputEncoding);
+	freeConverterResources ();
 }
 
 extern const char *getLanguageEncoding (const langType language)
@@ -4365,10 +4932,34 @@ extern const char *getLanguageEncoding (const langType language)
 }
 #endif
 
+/* A worker process doesn't emit the pseudo tags for parsers.
+ * Instead, it records where it would have emitted them for each input
+ * file, and the parent process emits them at the first of the points
+ * in its output. This avoids duplicated pseudo tags in the merged
+ * output. */
+static bool ParserPseudoTagsDeferred;
+static parserPseudoTagPoint *ParserPseudoTagPoints;
+static unsigned int ParserPseudoTagPointCount;
+static unsigned int ParserPseudoTagPointSize;
+
 static void addParserPseudoTags (langType language)
 {
 	parserObject *parser = LanguageTable + language;
-	if (!parser->pseudoTagPrinted)
+	if (ParserPseudoTagsDeferred)
+	{
+		if (ParserPseudoTagPointCount == ParserPseudoTagPointSize)
+		{
+			ParserPseudoTagPointSize = ParserPseudoTagPointSize? ParserPseudoTagPointSize * 2: 64;
+			ParserPseudoTagPoints = xRealloc (ParserPseudoTagPoints,
+											  ParserPseudoTagPointSize,
+											  parserPseudoTagPoint);
+		}
+		ParserPseudoTagPoints [ParserPseudoTagPointCount].language = language;
+		ParserPseudoTagPoints [ParserPseudoTagPointCount].offset = tagFileOffset ();
+		ParserPseudoTagPointCount++;
+		parser->pseudoTagPrinted = 1;
+	}
+	else if (!parser->pseudoTagPrinted)
 	{
 		for (int i = 0; i < PTAG_COUNT; i++)
 		{
@@ -4379,6 +4970,48 @@ static void addParserPseudoTags (langType language)
 	}
 }
 
+extern void deferParserPseudoTags (void)
+{
+	ParserPseudoTagsDeferred = true;
+}
+
+extern const parserPseudoTagPoint *getParserPseudoTagPoints (unsigned int *count)
+{
+	*count = ParserPseudoTagPointCount;
+	return ParserPseudoTagPoints;
+}
+
+extern bool isParserPseudoTagPrinted (const langType language)
+{
+	Assert (0 <= language  &&  language < (int) LanguageCount);
+	return LanguageTable [language].pseudoTagPrinted;
+}
+
+extern void makeParserPseudoTags (const langType language)
+{
+	Assert (0 <= language  &&  language < (int) LanguageCount);
+	if (!isXtagEnabled (XTAG_PSEUDO_TAGS))
+		return;
+
+	initializeParser (language);
+	addParserPseudoTags (language);
+
+	/* A subparser running its base parser makes the base parser
+	 * print its pseudo tags, too. */
+	parserDefinition *const lang = LanguageTable [language].def;
+	for (unsigned int i = 0; i < lang->dependencyCount; i++)
+	{
+		parserDependency *d = lang->dependencies + i;
+		if (d->type == DEPTYPE_SUBPARSER &&
+			((subparser *)(d->data))->direction & SUBPARSER_SUB_RUNS_BASE)
+		{
+			langType baseParser = getNamedLanguage (d->upperParser, 0);
+			if (baseParser != LANG_IGNORE)
+				makeParserPseudoTags (baseParser);
+		}
+	}
+}
+
 extern bool doesParserRequireMemoryStream (const langType language)
 {
 	Assert (0 <= language  &&  language < (int) LanguageCount);
@@ -4420,6 +5053,20 @@ extern bool parseFile (const char *const fileName)
 	return bRet;
 }
 
+extern bool parseFileRegionWithMio (const char *const fileName, MIO *mio,
+									unsigned long startLine, unsigned long endLine)
+{
+	bool tagFileResized;
+
+	Assert (startLine > 0 && startLine <= endLine);
+	ParseRegion.start = startLine;
+	ParseRegion.end = endLine;
+	tagFileResized = parseFileWithMio (fileName, mio, NULL);
+	ParseRegion.start = 0;
+	ParseRegion.end = 0;
+	return tagFileResized;
+}
+
 static bool parseMio (const char *const fileName, langType language, MIO* mio, time_t mtime, bool useSourceFileTagPath,
 					  void *clientData)
 {
@@ -4444,6 +5091,125 @@ static bool parseMio (const char *const fileName, langType language, MIO* mio, t
 		return teardownWriter(fileName);
 }
 
+/* An input file looks minified or generated if the lines in its first
+ * MINIFIED_SAMPLE_SIZE bytes are long and have few blanks. */
+#define MINIFIED_SAMPLE_SIZE (64 * 1024)
+#define MINIFIED_SAMPLE_MIN 1024
+#define MINIFIED_AVERAGE_LINE 200
+#define MINIFIED_LONGEST_LINE 4096
+#define MINIFIED_NONBLANK_PERCENT 85
+
+static bool looksMinified (MIO *mio)
+{
+	unsigned char *sample = eMalloc (MINIFIED_SAMPLE_SIZE);
+	size_t size = mio_read (mio, sample, 1, MINIFIED_SAMPLE_SIZE);
+	size_t lines = 0, longest = 0, length = 0, blanks = 0;
+	bool r = false;
+
+	mio_rewind (mio);
+	if (size < MINIFIED_SAMPLE_MIN)
+		goto out;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		if (sample [i] == '\n')
+		{
+			lines++;
+			if (length > longest)
+				longest = length;
+			length = 0;
+			blanks++;
+			continue;
+		}
+		length++;
+		if (isspace (sample [i]))
+			blanks++;
+	}
+	if (length > 0)
+	{
+		lines++;
+		if (length > longest)
+			longest = length;
+	}
+
+	r = (size / lines >= MINIFIED_AVERAGE_LINE
+		 || longest >= MINIFIED_LONGEST_LINE)
+		&& (size - blanks) * 100 >= size * MINIFIED_NONBLANK_PERCENT;
+ out:
+	eFree (sample);
+	return r;
+}
+
+/* Open the input file if the parser is chosen without reading it.
+ * Return false if it cannot be opened. */
+static bool openRequestedInput (struct GetLanguageRequest *req,
+								langType language)
+{
+	if (req->mio == NULL)
+	{
+		req->mio = getMio (req->fileName, "rb",
+						   doesParserRequireMemoryStream (language));
+		if (req->mio == NULL)
+			return false;
+
+		fileStatus *status = eStat (req->fileName);
+		req->mtime = status->mtime;
+		eStatFree (status);
+	}
+	return true;
+}
+
+/* Return the policy of --minified applied to the input file, and the
+ * size of the file in SIZE. */
+static minifiedPolicy checkMinified (struct GetLanguageRequest *req,
+									 langType language, unsigned long *size)
+{
+	if (Option.minified == MINIFIED_PARSE)
+		return MINIFIED_PARSE;
+
+	if (!openRequestedInput (req, language))
+		return MINIFIED_PARSE;
+
+	if (mio_seek (req->mio, 0, SEEK_END) != 0)
+		return MINIFIED_PARSE;
+	*size = (unsigned long) mio_tell (req->mio);
+	mio_rewind (req->mio);
+
+	if (!looksMinified (req->mio))
+		return MINIFIED_PARSE;
+
+	verbose ("%s looks minified\n", req->fileName);
+	return Option.minified;
+}
+
+/* Return a memory stream for the first --minified=truncate:<size> bytes
+ * of MIO, cut at the end of the last line. */
+static MIO *truncateMinifiedInput (MIO *mio, unsigned long size,
+								   unsigned long *dropped)
+{
+	unsigned char *data;
+	size_t length;
+
+	if (size <= Option.minifiedLimit)
+		return NULL;
+
+	data = eMalloc (Option.minifiedLimit + 1);
+	length = mio_read (mio, data, 1, Option.minifiedLimit);
+	mio_rewind (mio);
+	for (size_t i = length; i > 0; i--)
+	{
+		if (data [i - 1] == '\n')
+		{
+			length = i;
+			break;
+		}
+	}
+
+	*dropped = size - length;
+	data [length] = '\0';
+	return mio_new_memory (data, length, NULL, eFreeNoNullCheck);
+}
+
 extern bool parseFileWithMio (const char *const fileName, MIO *mio,
 							  void *clientData)
 {
@@ -4454,36 +5220,116 @@ extern bool parseFileWithMio (const char *const fileName, MIO *mio,
 		.fileName = fileName,
 		.mio = mio,
 	};
+	statsTime start;
 	memset (&req.mtime, 0, sizeof (req.mtime));
 
+	beginTraceEvent (TRACE_EVENT_FILE, fileName);
+	beginTraceEvent (TRACE_EVENT_GUESS, NULL);
+	startStatsPhase (&start);
 	language = getFileLanguageForRequest (&req);
+	endStatsPhase (STATS_PHASE_GUESS, &start);
+	endTraceEvent (TRACE_EVENT_GUESS);
 	Assert (language != LANG_AUTO);
+	usdtProbe2 (language, fileName,
+				language == LANG_IGNORE? NULL: getLanguageName (language));
 
 	if (Option.printLanguage)
 	{
 		printGuessedParser (fileName, language);
+		endTraceEvent (TRACE_EVENT_FILE);
 		return tagFileResized;
 	}
 
+	minifiedPolicy minified = MINIFIED_PARSE;
+	partialTotals partial = { 0 };
+	unsigned long size = 0;
+	bool dedup = false;
+
+	if (language != LANG_IGNORE)
+		minified = checkMinified (&req, language, &size);
+	if (Option.dedupContent && language != LANG_IGNORE
+		&& minified == MINIFIED_PARSE && clientData == NULL
+		&& ParseRegion.start == 0)
+		dedup = openRequestedInput (&req, language);
+
+	if (Option.incremental)
+		noteManifestInputFile (fileName, language, req.mio);
+
 	if (language == LANG_IGNORE)
 		verbose ("ignoring %s (unknown language/language disabled)\n",
 			 fileName);
+	else if (minified == MINIFIED_SKIP)
+	{
+		verbose ("skipping %s (minified)\n", fileName);
+		partial.skipped = 1;
+		partial.bytes = size;
+		addPartialTotals (&partial);
+	}
+	else if (dedup && beginDedupContent (fileName, language, req.mio))
+	{
+		partial.duplicates = 1;
+		addPartialTotals (&partial);
+	}
 	else
 	{
 		Assert(isLanguageEnabled (language));
 
+		MIO *input = req.mio;
+		MIO *truncated = NULL;
+		if (minified == MINIFIED_TRUNCATE)
+		{
+			truncated = truncateMinifiedInput (req.mio, size,
+											   &partial.bytes);
+			if (truncated)
+			{
+				input = truncated;
+				partial.truncated = 1;
+			}
+		}
+		else if (minified == MINIFIED_TOPLEVEL)
+		{
+			setTagFileTopLevelOnly (true);
+			partial.topLevel = 1;
+		}
+		addPartialTotals (&partial);
+
 		if (Option.filter && ! Option.interactive)
-			openTagFile ();
+			beginFilterTagFile ();
 
 #ifdef HAVE_ICONV
 		/* TODO: checkUTF8BOM can be used to update the encodings. */
 		openConverter (getLanguageEncoding (language), Option.outputEncoding);
 #endif
-		tagFileResized = parseMio (fileName, language, req.mio, req.mtime, true, clientData);
+		long files0, lines0 = 0, bytes0 = 0;
+		unsigned long tags0 = 0;
+		if (isFileStatsEnabled ())
+		{
+			getTotals (&files0, &lines0, &bytes0);
+			tags0 = numTagsAdded ();
+			readStatsTime (&start);
+		}
+
+		tagFileResized = parseMio (fileName, language, input, req.mtime, true, clientData);
+		if (dedup)
+			endDedupContent (anonNamesMade);
+		if (minified == MINIFIED_TOPLEVEL)
+			setTagFileTopLevelOnly (false);
+		if (truncated)
+			mio_unref (truncated);
 		if (Option.filter && ! Option.interactive)
-			closeTagFile (tagFileResized);
+			endFilterTagFile (tagFileResized);
+		else
+			spillTagFileMaybe ();
 		addTotals (1, 0L, 0L);
 
+		if (isFileStatsEnabled ())
+		{
+			long files, lines, bytes;
+			getTotals (&files, &lines, &bytes);
+			addFileStats (fileName, language, lines - lines0, bytes - bytes0,
+						  numTagsAdded () - tags0, &start);
+		}
+
 #ifdef HAVE_ICONV
 		closeConverter ();
 #endif
@@ -4492,6 +5338,7 @@ extern bool parseFileWithMio (const char *const fileName, MIO *mio,
 	if (req.type == GLR_OPEN && req.mio)
 		mio_unref (req.mio);
 
+	endTraceEvent (TRACE_EVENT_FILE);
 	return tagFileResized;
 }
 
@@ -4513,31 +5360,40 @@ extern bool parseRawBuffer(const char *fileName, unsigned char *buffer,
 }
 
 static void matchLanguageMultilineRegexCommon (const langType language,
-											   bool (* func) (struct lregexControlBlock *, const vString* const),
-											   const vString* const allLines)
+											   bool (* func) (struct lregexControlBlock *,
+															  const char *const, size_t),
+											   const char *const input, size_t length)
 {
 	subparser *tmp;
 
-	func ((LanguageTable + language)->lregexControlBlock, allLines);
+	func ((LanguageTable + language)->lregexControlBlock, input, length);
 	foreachSubparser(tmp, true)
 	{
 		langType t = getSubparserLanguage (tmp);
 		enterSubparser (tmp);
-		matchLanguageMultilineRegexCommon (t, func, allLines);
+		matchLanguageMultilineRegexCommon (t, func, input, length);
 		leaveSubparser ();
 	}
 }
 
 extern void matchLanguageMultilineRegex (const langType language,
-										 const vString* const allLines)
+										 const char *const input, size_t length)
 {
-	matchLanguageMultilineRegexCommon(language, matchMultilineRegex, allLines);
+	statsTime start;
+
+	startStatsPhase (&start);
+	matchLanguageMultilineRegexCommon(language, matchMultilineRegex, input, length);
+	endStatsPhase (STATS_PHASE_REGEX, &start);
 }
 
 extern void matchLanguageMultitableRegex (const langType language,
-										  const vString* const allLines)
+										  const char *const input, size_t length)
 {
-	matchLanguageMultilineRegexCommon(language, matchMultitableRegex, allLines);
+	statsTime start;
+
+	startStatsPhase (&start);
+	matchLanguageMultilineRegexCommon(language, matchMultitableRegex, input, length);
+	endStatsPhase (STATS_PHASE_REGEX, &start);
 }
 
 extern void processLanguageMultitableExtendingOption (langType language, const char *const parameter)
@@ -4601,6 +5457,16 @@ static bool hasLanguageAnyRegexPatterns (const langType language)
 	return lregexQueryParserAndSubparsers (language, lregexControlBlockHasAny);
 }
 
+static bool doesLanguageRunScript (const langType language)
+{
+	return lregexQueryParserAndSubparsers (language, doesRegexRunScript);
+}
+
+extern bool doesInputLanguageRunScript (void)
+{
+	return InputRunsScript;
+}
+
 extern void addLanguageCallbackRegex (const langType language, const char *const regex, const char *const flags,
 									  const regexCallback callback, bool *disabled, void *userData)
 {
@@ -4618,20 +5484,39 @@ extern bool doesLanguageExpectCorkInRegex (const langType language)
 	return hasScopeAction;
 }
 
-extern void matchLanguageRegex (const langType language, const vString* const line, bool postrun)
+static void matchLanguageRegex1 (const langType language,
+								 const char* const line, size_t length, bool postrun)
 {
 	subparser *tmp;
 
-	matchRegex ((LanguageTable + language)->lregexControlBlock, line, postrun);
+	matchRegex ((LanguageTable + language)->lregexControlBlock, line, length, postrun);
 	foreachSubparser(tmp, true)
 	{
 		langType t = getSubparserLanguage (tmp);
 		enterSubparser (tmp);
-		matchLanguageRegex (t, line, postrun);
+		matchLanguageRegex1 (t, line, length, postrun);
 		leaveSubparser ();
 	}
 }
 
+extern void matchLanguageRegex (const langType language,
+								const char* const line, size_t length, bool postrun)
+{
+	statsTime start;
+
+	/* Reading the clocks for each line costs more than matching no
+	 * pattern. */
+	if (!RegexTimed)
+	{
+		matchLanguageRegex1 (language, line, length, postrun);
+		return;
+	}
+
+	readStatsTime (&start);
+	matchLanguageRegex1 (language, line, length, postrun);
+	endStatsPhase (STATS_PHASE_REGEX, &start);
+}
+
 extern bool processLanguageRegexOption (langType language,
 										enum regexParserType regptype,
 										const char *const parameter)
@@ -4702,14 +5587,16 @@ static void installTagRegexTable (const langType language)
 									  lang->tagRegexTable [i].name,
 									  lang->tagRegexTable [i].kinds,
 									  lang->tagRegexTable [i].flags,
-									  (lang->tagRegexTable [i].disabled));
+									  (lang->tagRegexTable [i].disabled),
+									  lang->tagRegexTable [i].matcher);
 			else
 				addTagRegex (parser->lregexControlBlock,
 							 lang->tagRegexTable [i].regex,
 							 lang->tagRegexTable [i].name,
 							 lang->tagRegexTable [i].kinds,
 							 lang->tagRegexTable [i].flags,
-							 (lang->tagRegexTable [i].disabled));
+							 (lang->tagRegexTable [i].disabled),
+							 lang->tagRegexTable [i].matcher);
 		}
 	}
 }
@@ -5073,25 +5960,53 @@ extern unsigned int getLanguageVersionAge (const langType language)
 *
 *   Anonymous name generator
 */
-static ptrArray *parsersUsedInCurrentInput;
+
+/* The counters for anonymous names are indexed by langType.
+ * They are bound to the current input, not to the parser. */
+static CTAGS_THREAD_LOCAL unsigned int *anonymousIdentiferIds;
+
+/* The hash of the input file name put in the anonymous names, computed
+ * at the first anonymous name made for each input file. */
+static CTAGS_THREAD_LOCAL const char *anonHashedFileName;
+static CTAGS_THREAD_LOCAL char anonFileNameHash [9];
 
 static void setupAnon (void)
 {
-	parsersUsedInCurrentInput = ptrArrayNew (NULL);
+	anonymousIdentiferIds = xCalloc (LanguageCount, unsigned int);
+	anonHashedFileName = NULL;
 }
 
 static void teardownAnon (void)
 {
-	ptrArrayDelete (parsersUsedInCurrentInput);
+	anonNamesMade = false;
+	for (unsigned int i = 0; i < LanguageCount; i++)
+	{
+		if (anonymousIdentiferIds [i])
+		{
+			anonNamesMade = true;
+			break;
+		}
+	}
+	eFree (anonymousIdentiferIds);
+	anonymousIdentiferIds = NULL;
 }
 
-static void anonResetMaybe (parserObject *parser)
+static unsigned int *anonymousIdOf (langType language)
 {
-	if (ptrArrayHas (parsersUsedInCurrentInput, parser))
-		return;
+	return anonymousIdentiferIds + language;
+}
 
-	parser -> anonymousIdentiferId = 0;
-	ptrArrayAdd (parsersUsedInCurrentInput, parser);
+/* For running the guest parsers for an input file in worker processes.
+ * IDS has an element for each parser. */
+extern void getAnonymousIds (unsigned int *ids)
+{
+	memcpy (ids, anonymousIdentiferIds, sizeof (unsigned int) * LanguageCount);
+}
+
+extern void addAnonymousIds (const unsigned int *ids)
+{
+	for (unsigned int i = 0; i < LanguageCount; i++)
+		anonymousIdentiferIds [i] += ids [i];
 }
 
 static unsigned int anonHash(const unsigned char *str)
@@ -5115,21 +6030,47 @@ extern void anonConcatFull (vString *buffer, langType lang, int kind)
 	anonGenerateFull (buffer, NULL, lang, kind);
 }
 
+/* Same as sprintf (p, "%02x", n) without parsing the format. */
+static char *anonFormatHex (char *p, unsigned int n)
+{
+	static const char digits [] = "0123456789abcdef";
+	char reversed [sizeof (n) * 2];
+	unsigned int i = 0;
+
+	do
+	{
+		reversed [i++] = digits [n & 0xf];
+		n >>= 4;
+	} while (n != 0 || i < 2);
+
+	while (i > 0)
+		*p++ = reversed [--i];
+	return p;
+}
+
 extern void anonGenerateFull (vString *buffer, const char *prefix, langType lang, int kind)
 {
 	Assert(lang != LANG_IGNORE);
-	parserObject* parser = LanguageTable + ((lang == LANG_AUTO)? getInputLanguage (): lang);
-	parser -> anonymousIdentiferId ++;
+	langType l = (lang == LANG_AUTO)? getInputLanguage (): lang;
+	Assert (0 <= l && l < (int) LanguageCount);
+	anonymousIdentiferIds [l] ++;
 
-	char szNum[32];
-	char buf [9];
+	const char *fileName = getInputFileName ();
+	char szNum[8 + 2 * sizeof (unsigned int) * 2];
+	char *p;
 
 	if (prefix)
 		vStringCopyS(buffer, prefix);
 
-	anonHashString (getInputFileName(), buf);
-	sprintf(szNum,"%s%02x%02x",buf,parser -> anonymousIdentiferId, kind);
-	vStringCatS(buffer,szNum);
+	if (fileName != anonHashedFileName)
+	{
+		anonHashString (fileName, anonFileNameHash);
+		anonHashedFileName = fileName;
+	}
+	memcpy (szNum, anonFileNameHash, 8);
+	p = anonFormatHex (szNum + 8, anonymousIdentiferIds [l]);
+	p = anonFormatHex (p, (unsigned int) kind);
+	vStringNCatSUnsafe (buffer, szNum, (size_t) (p - szNum));
 }
 
 extern vString *anonGenerateNewFull (const char *prefix, langType lang, int kind)
@@ -5148,13 +6089,26 @@ extern bool applyLanguageParam (const langType language, const char *name, const
 	return applyParam (LanguageTable [language].paramControlBlock, name, args);
 }
 
+extern struct slaveControlBlock *getSlaveControlBlock (langType language)
+{
+	return LanguageTable [language].slaveControlBlock;
+}
+
+extern bool isSubparserRunnable (subparser *s, bool includingNoneCraftedParser)
+{
+	langType t = getSubparserLanguage(s);
+
+	return (isLanguageEnabled (t) &&
+			(includingNoneCraftedParser
+			 || ((((LanguageTable + t)->def->method) & METHOD_NOT_CRAFTED) == 0)));
+}
+
 extern subparser *getNextSubparser(subparser *last,
 								   bool includingNoneCraftedParser)
 {
 	langType lang = getInputLanguage ();
 	parserObject *parser = LanguageTable + lang;
 	subparser *r;
-	langType t;
 
 	if (last == NULL)
 		r = getFirstSubparser(parser->slaveControlBlock);
@@ -5164,10 +6118,7 @@ extern subparser *getNextSubparser(subparser *last,
 	if (r == NULL)
 		return r;
 
-	t = getSubparserLanguage(r);
-	if (isLanguageEnabled (t) &&
-		(includingNoneCraftedParser
-		 || ((((LanguageTable + t)->def->method) & METHOD_NOT_CRAFTED) == 0)))
+	if (isSubparserRunnable (r, includingNoneCraftedParser))
 		return r;
 	else
 		return getNextSubparser (r, includingNoneCraftedParser);
@@ -5325,6 +6276,12 @@ extern void printKinddefFlags (bool withListHeader, bool machinable, FILE *fp)
 	colprintTableDelete(table);
 }
 
+extern void printLanguageRegexStatistics (langType language)
+{
+	parserObject* const parser = LanguageTable + language;
+	printRegexStatistics (parser->lregexControlBlock);
+}
+
 extern void printLanguageMultitableStatistics (langType language)
 {
 	parserObject* const parser = LanguageTable + language;
@@ -5341,11 +6298,12 @@ extern void addLanguageTagMultiTableRegex(const langType language,
 										  const char* const table_name,
 										  const char* const regex,
 										  const char* const name, const char* const kinds, const char* const flags,
-										  bool *disabled)
+										  bool *disabled,
+										  const tagRegexMatcher *matcher)
 {
 	parserObject* const parser = LanguageTable + language;
 	addTagMultiTableRegex (parser->lregexControlBlock, table_name, regex,
-						   name, kinds, flags, disabled);
+						   name, kinds, flags, disabled, matcher);
 }
 
 extern void addLanguageOptscriptToHook (langType language, enum scriptHook hook, const char *const src)
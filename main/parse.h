@@ -114,6 +114,9 @@ struct sParserDefinition {
 	bool useMemoryStreamInput;
 	bool allowNullTag;
 	bool requestAutomaticFQTag;
+	bool lineOriented;			   /* the tags of a line depend only on the line;
+									  the input may be split into parts parsed
+									  in parallel (--jobs) */
 	tagRegexTable *tagRegexTable;
 	unsigned int tagRegexCount;
 	const keywordTable *keywordTable;
@@ -197,10 +200,30 @@ extern void addLanguageTagMultiTableRegex(const langType language,
 										  const char* const table_name,
 										  const char* const regex,
 										  const char* const name, const char* const kinds, const char* const flags,
-										  bool *disabled);
+										  bool *disabled,
+										  const tagRegexMatcher *matcher);
 
 extern void addLanguageOptscriptToHook (langType language, enum scriptHook hook, const char *const src);
 
+/* Rescan interface
+ *
+ * A parser returning RESCAN_FAILED can make the next pass start at the
+ * last point it marked in the pass instead of the start of the input.
+ * The point is the start of the line after the lines read so far. Mark
+ * it before making a tag for the line, and only where the parser and its
+ * subparsers can parse the rest of the input in the state they have at
+ * the start of a pass (e.g. between two top-level declarations). The
+ * tags, the promises and the anonymous names made after the point are
+ * dropped; the ones made before it are kept.
+ *
+ * Return false if the input can't be read again from the point; the
+ * point marked before stays then. */
+extern bool markRescanPoint (void);
+
+/* The line the current pass started at: 1 unless the pass restarted at a
+ * point marked in the pass before. */
+extern unsigned long getPassStartLine (void);
+
 extern void anonGenerateFull (vString *buffer, const char *prefix, langType lang, int kind);
 #define anonGenerate(B,P,K) anonGenerateFull((B), (P), LANG_AUTO, (K))
 extern void anonConcatFull   (vString *buffer, langType lang, int kind);
@@ -65,6 +65,9 @@ extern parserDefinitionFunc OPTLIB2C_PCRE2_PARSER_LIST;
 
 extern bool doesLanguageAllowNullTag (const langType language);
 extern bool doesLanguageRequestAutomaticFQTag (const langType language);
+/* True if optscript code (regex patterns or hooks) runs for the parser
+ * parsing the current input. */
+extern bool doesInputLanguageRunScript (void);
 
 extern langType getNamedLanguageFull (const char *const name, size_t len, bool noPretending, bool include_aliases);
 
@@ -79,6 +82,7 @@ extern int defineLanguageKind (const langType language, kindDefinition *def,
 
 extern unsigned int countLanguageKinds (const langType language);
 extern unsigned int countLanguageRoles (const langType language, int kindIndex);
+extern roleBitsType getLanguageEnabledRoleBits (const langType language, int kindIndex);
 
 extern bool isLanguageKindRefOnly (const langType language, int kindIndex);
 
@@ -125,6 +129,12 @@ extern void printKinddefFlags (bool withListHeader, bool machinable, FILE *fp);
 extern bool doesParserRequireMemoryStream (const langType language);
 extern bool parseFile (const char *const fileName);
 extern bool parseFileWithMio (const char *const fileName, MIO *mio, void *clientData);
+/* Parse only the lines from STARTLINE to ENDLINE of FILENAME read from
+ * MIO, as if they were the whole input file. The line numbers of the
+ * tags are those in the whole input file. For reparsing the part of a
+ * file edited in the interactive mode. */
+extern bool parseFileRegionWithMio (const char *const fileName, MIO *mio,
+									unsigned long startLine, unsigned long endLine);
 extern bool parseRawBuffer(const char *fileName, unsigned char *buffer,
 			    size_t bufferSize, const langType language, void *clientData);
 
@@ -146,7 +156,8 @@ extern void notifyLanguageRegexInputStart (langType language);
 extern void notifyLanguageRegexInputEnd (langType language);
 
 extern bool hasLanguagePostRunRegexPatterns (const langType language);
-extern void matchLanguageRegex (const langType language, const vString* const line, bool postrun);
+extern void matchLanguageRegex (const langType language,
+								const char* const line, size_t length, bool postrun);
 extern void freeRegexResources (void);
 extern bool checkRegex (void);
 extern void useRegexMethod (const langType language);
@@ -154,11 +165,14 @@ extern void printRegexFlags (bool withListHeader, bool machinable, const char *f
 extern void printMultilineRegexFlags (bool withListHeader, bool machinable, const char *flags, FILE *fp);
 extern void printMultitableRegexFlags (bool withListHeader, bool machinable, const char *flags, FILE *fp);
 extern bool doesLanguageExpectCorkInRegex (const langType language);
+extern bool isCorkQueueFlushable (void);
 
 /* Multiline Regex Interface */
 extern bool hasLanguageMultilineRegexPatterns (const langType language);
-extern void matchLanguageMultilineRegex (const langType language, const vString* const allLines);
-extern void matchLanguageMultitableRegex (const langType language, const vString* const allLines);
+extern void matchLanguageMultilineRegex (const langType language,
+										 const char *const input, size_t length);
+extern void matchLanguageMultitableRegex (const langType language,
+										  const char *const input, size_t length);
 
 extern void processLanguageMultitableExtendingOption (langType language, const char *const parameter);
 
@@ -180,6 +194,24 @@ extern bool makeRoleDescriptionsPseudoTags (const langType language,
 extern bool makeParserVersionPseudoTags (const langType language,
 										 const ptagDesc *pdesc);
 
+/* Where a worker process would have emitted the pseudo tags for a
+ * parser */
+typedef struct sParserPseudoTagPoint {
+	langType language;
+	long offset;				/* in the tag file */
+} parserPseudoTagPoint;
+
+extern void deferParserPseudoTags (void);
+/* The points recorded since deferParserPseudoTags (), in the order of
+ * the recording. */
+extern const parserPseudoTagPoint *getParserPseudoTagPoints (unsigned int *count);
+extern bool isParserPseudoTagPrinted (const langType language);
+extern void makeParserPseudoTags (const langType language);
+
+extern void getAnonymousIds (unsigned int *ids);
+extern void addAnonymousIds (const unsigned int *ids);
+
+extern void printLanguageRegexStatistics (langType language);
 extern void printLanguageMultitableStatistics (langType language);
 extern void printParserStatisticsIfUsed (langType lang);
 
@@ -11,20 +11,29 @@
  */
 
 #include "general.h"
+#include "eventtrace_p.h"
+#include "jobs_p.h"
+#include "options_p.h"
 #include "parse_p.h"
 #include "promise.h"
 #include "promise_p.h"
 #include "ptrarray.h"
 #include "debug.h"
+#include "read.h"
 #include "read_p.h"
 #include "trashbox.h"
 #include "xtag.h"
 #include "numarray.h"
 #include "routines.h"
 #include "options.h"
+#include "writer_p.h"
 
 #include <string.h>
 
+/* The promises are run in worker processes only when they have this
+ * many lines per worker. */
+#define PROMISE_JOB_LINES 8192
+
 struct promise {
 	langType lang;
 	unsigned long startLine;
@@ -169,12 +178,11 @@ void breakPromisesAfter (int promise)
 	promise_count = promise;
 }
 
-bool forcePromises (void)
+static bool forcePromisesInRange (int start, int end)
 {
-	int i;
 	bool tagFileResized = false;
 
-	for (i = 0; i < promise_count; ++i)
+	for (int i = start; i < end; ++i)
 	{
 		current_promise = i;
 		struct promise *p = promises + i;
@@ -190,6 +198,150 @@ bool forcePromises (void)
 				? true
 				: tagFileResized;
 	}
+	return tagFileResized;
+}
+
+/* Run the promises from START including the ones made while running
+ * them. */
+static bool forcePromisesFrom (int start)
+{
+	bool tagFileResized = false;
+
+	while (start < promise_count)
+	{
+		int end = promise_count;
+		tagFileResized = forcePromisesInRange (start, end)? true: tagFileResized;
+		start = end;
+	}
+	return tagFileResized;
+}
+
+/*
+ * Running promises in worker processes
+ *
+ * The names of anonymous tags are numbered per parser. A worker reports
+ * how many numbers each parser took in it. The tags of a worker are
+ * kept only if no other worker used the parsers it used; then the
+ * numbers are the same as the ones of running the promises one by one.
+ * The promises of the other workers are run again in the parent
+ * process.
+ */
+struct promiseJobs {
+	unsigned int *anonIds;		/* before forking */
+	unsigned int *users;		/* the number of the workers using each parser */
+};
+
+static bool runPromiseJobs (void *data, unsigned int start, unsigned int end)
+{
+	int made = promise_count;
+	bool tagFileResized = forcePromisesInRange ((int) start, (int) end);
+
+	/* The promises made in a worker cannot be passed to the parent
+	 * process. In the parent process, they are run after the others
+	 * as forcePromises() does. */
+	if (countIdleJobs () == 0)
+		tagFileResized = forcePromisesFrom (made)? true: tagFileResized;
+	return tagFileResized;
+}
+
+static size_t getPromiseJobsRecordSize (void *data CTAGS_ATTR_UNUSED)
+{
+	return sizeof (unsigned int) * countParsers ();
+}
+
+static void writePromiseJobsRecord (void *data, void *buf)
+{
+	struct promiseJobs *pj = data;
+	unsigned int *ids = buf;
+
+	getAnonymousIds (ids);
+	for (unsigned int i = 0; i < countParsers (); i++)
+		ids [i] -= pj->anonIds [i];
+}
+
+static void checkPromiseJobsRecords (void *data, unsigned int jobs,
+									 void *const *records, bool *accepted)
+{
+	struct promiseJobs *pj = data;
+	const unsigned int count = countParsers ();
+
+	memset (pj->users, 0, sizeof (unsigned int) * count);
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		const unsigned int *ids = records [k];
+		for (unsigned int i = 0; i < count; i++)
+			if (ids [i] > 0)
+				pj->users [i]++;
+	}
+
+	for (unsigned int k = 0; k < jobs; k++)
+	{
+		const unsigned int *ids = records [k];
+		for (unsigned int i = 0; i < count && accepted [k]; i++)
+			if (ids [i] > 0 && pj->users [i] > 1)
+				accepted [k] = false;
+		if (accepted [k])
+			addAnonymousIds (ids);
+	}
+}
+
+static unsigned int countPromiseJobs (void)
+{
+	unsigned int jobs = countIdleJobs ();
+	unsigned long lines = 0;
+
+	/* The workers write tags in an order different from the one of
+	 * running the promises one by one. */
+	if (jobs < 2 || Option.sorted == SO_UNSORTED || writerSortsTags ())
+		return 0;
+
+	/* The workers must not share the file offset of the input. */
+	if (getInputFileData (NULL) == NULL)
+		return 0;
+
+	for (int i = 0; i < promise_count; i++)
+		lines += promises [i].endLine - promises [i].startLine + 1;
+
+	if (lines / PROMISE_JOB_LINES < jobs)
+		jobs = (unsigned int) (lines / PROMISE_JOB_LINES);
+	return jobs;
+}
+
+bool forcePromises (void)
+{
+	bool tagFileResized = false;
+	unsigned int jobs;
+
+	if (promise_count == 0)
+		return false;
+
+	beginTraceEvent (TRACE_EVENT_PROMISE, NULL);
+	jobs = countPromiseJobs ();
+	if (jobs > 1)
+	{
+		int count = promise_count;
+		struct promiseJobs pj = {
+			.anonIds = xMalloc (countParsers (), unsigned int),
+			.users = xMalloc (countParsers (), unsigned int),
+		};
+		const jobSpec spec = {
+			.what = "promises",
+			.run = runPromiseJobs,
+			.getRecordSize = getPromiseJobsRecordSize,
+			.writeRecord = writePromiseJobsRecord,
+			.checkRecords = checkPromiseJobsRecords,
+			.data = &pj,
+		};
+
+		getAnonymousIds (pj.anonIds);
+		tagFileResized = runJobs (&spec, (unsigned int) count, jobs);
+		tagFileResized = forcePromisesFrom (count)? true: tagFileResized;
+		eFree (pj.users);
+		eFree (pj.anonIds);
+	}
+	else
+		tagFileResized = forcePromisesFrom (0);
+	endTraceEvent (TRACE_EVENT_PROMISE);
 
 	freeModifiers (0);
 	current_promise  = NO_PROMISE;
@@ -315,8 +467,17 @@ void runModifiers (int promise,
 				   unsigned char *input,
 				   size_t size)
 {
-	ptrArray *modifiers = ptrArrayNew (NULL);
+	ptrArray *modifiers;
+	int p;
+
+	/* Most of promises have no modifier. */
+	for (p = promise; p != NO_PROMISE; p = promises[p].parent_promise)
+		if (promises[p].modifiers)
+			break;
+	if (p == NO_PROMISE)
+		return;
 
+	modifiers = ptrArrayNew (NULL);
 	collectModifiers (promise, modifiers);
 	for (int i = ptrArrayCount (modifiers); i > 0 ; i--)
 	{
@@ -148,6 +148,17 @@ static bool ptagMakeOutputVersion (ptagDesc *desc, langType language,
 	return writePseudoTag (desc, buf, "current.age", NULL);
 }
 
+static bool ptagMakeInputFileId (ptagDesc *desc, langType language CTAGS_ATTR_UNUSED,
+								 const void *data)
+{
+	/* Made for each input file while writing tags; see getInputFileId (). */
+	const char *const *pathAndId = data;
+
+	if (data == NULL)
+		return false;
+	return writePseudoTag (desc, pathAndId [0], pathAndId [1], NULL);
+}
+
 static ptagDesc ptagDescs [] = {
 	{
 	  /* The prefix is not "TAG_".
@@ -235,6 +246,10 @@ static ptagDesc ptagDescs [] = {
 	  "the version of the output interface (current.age)",
 	  ptagMakeOutputVersion,
 	  PTAGF_COMMON },
+	{ false, "TAG_INPUT_FILE_ID",
+	  "the input file referred to by an id in the input field of tags",
+	  ptagMakeInputFileId,
+	  0 },
 };
 
 extern bool makePtagIfEnabled (ptagType type, langType language, const void *data)
@@ -45,6 +45,7 @@ typedef enum ePtagType { /* pseudo tag content control */
 	PTAG_OUTPUT_EXCMD,
 	PTAG_PARSER_VERSION,
 	PTAG_OUTPUT_VERSION,
+	PTAG_INPUT_FILE_ID,
 	PTAG_COUNT
 } ptagType;
 
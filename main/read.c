@@ -20,8 +20,10 @@
 #define FILE_WRITE
 #include "read.h"
 #include "read_p.h"
+#include "bytescan.h"
 #include "debug.h"
 #include "entry_p.h"
+#include "lregex_p.h"
 #include "routines.h"
 #include "routines_p.h"
 #include "options_p.h"
@@ -72,12 +74,50 @@ typedef struct sComputPos {
 	size_t posInAllLines;
 } compoundPos;
 
+/* The starts of lines are kept in blocks of LINE_FPOS_BLOCK lines.
+ * The first line of a block is stored as a whole. Each of the other
+ * lines is stored as two variable-length deltas from the line before
+ * it: the offset (shifted, with the CR adjustment in the lowest bit)
+ * and posInAllLines. The MIOPos of a line is made from the one of the
+ * first line in its block when it is asked for. */
+#define LINE_FPOS_BLOCK 64
+
+typedef struct sLineFposBlock {
+	compoundPos first;			/* .open is not used */
+	size_t deltas;				/* the deltas of the second line */
+} lineFposBlock;
+
 typedef struct sInputLineFposMap {
-	compoundPos *pos;
-	unsigned int count;
-	unsigned int size;
+	MIO *mio;					/* the stream the positions are for */
+	lineFposBlock *blocks;
+	unsigned int blockSize;
+	unsigned char *deltas;
+	size_t deltaCount;
+	size_t deltaSize;
+	unsigned int count;			/* lines */
+	compoundPos last;			/* the line appended last */
 } inputLineFposMap;
 
+/* A line in inputLineFposMap. pos.pos is the MIOPos of the first
+ * line in the block, not of the line. */
+typedef struct sLineFposCursor {
+	const inputLineFposMap *map;
+	unsigned int index;
+	size_t next;				/* the deltas of the next line */
+	compoundPos pos;
+} lineFposCursor;
+
+/* The budget of --max-file-time and --max-file-bytes for the input
+ * file. The time is checked at every BUDGET_TIME_INTERVAL lines. */
+#define BUDGET_TIME_INTERVAL 64
+
+typedef struct sInputBudget {
+	double deadline;			/* in the wall-clock time of readStatsTime () */
+	unsigned int countdown;		/* the lines to read until checking the time */
+	bool timeExceeded;
+	bool stopped;				/* iFileGetLine () returned EOF for the budget */
+} inputBudget;
+
 typedef struct sNestedInputStreamInfo {
 	unsigned long startLine;
 	long startCharOffset;
@@ -88,7 +128,8 @@ typedef struct sNestedInputStreamInfo {
 typedef struct sInputFile {
 	vString    *path;          /* path of input file (if any) */
 	vString    *line;          /* last line read from file */
-	const unsigned char* currentLine;  /* current line being worked on */
+	const unsigned char* currentLineEnd;  /* the end of the current line
+											 where InputCursor.current is */
 	MIO        *mio;           /* MIO stream used for reading the file */
 	compoundPos    filePosition;  /* file position of current line */
 	unsigned int ungetchIdx;
@@ -112,13 +153,29 @@ typedef struct sInputFile {
 	   in sourceTagPathHolder are destroyed. */
 	stringList  * sourceTagPathHolder;
 	inputLineFposMap lineFposMap;
+
+	/* The lines read for the multiline and multitable patterns and the
+	 * post-run pass. They are matched in place in the memory stream from
+	 * allLinesStart. allLines is a copy of them, made while reading only
+	 * if the stream can't be used in place, or at the end if a CR-LF or
+	 * a NUL byte made the lines differ from the bytes in the stream. */
+	bool allLinesRequired;
+	long allLinesStart;
+	size_t allLinesLength;
 	vString *allLines;
+
 	int thinDepth;
 	time_t mtime;
+	bool filePositionDeferred;	/* filePosition.pos is not computed yet */
+
+	/* The line isLongLineInInputFile () looked at last, and the result.
+	 * The tags on a line ask about the same line one after another. */
+	const char *lineCheckedForLength;
+	bool longLineFound;
 } inputFile;
 
-static inputLangInfo inputLang;
-static langType sourceLang;
+static CTAGS_THREAD_LOCAL inputLangInfo inputLang;
+static CTAGS_THREAD_LOCAL langType sourceLang;
 
 /*
 *   FUNCTION DECLARATIONS
@@ -134,9 +191,13 @@ static void     langStackClear(langStack *langStack);
 /*
 *   DATA DEFINITIONS
 */
-static inputFile File;  /* static read through functions */
-static inputFile BackupFile;	/* File is copied here when a nested parser is pushed */
-static compoundPos StartOfLine;  /* holds deferred position of start of line */
+static CTAGS_THREAD_LOCAL inputFile File;  /* static read through functions */
+static CTAGS_THREAD_LOCAL inputFile BackupFile;	/* File is copied here when a nested parser is pushed */
+static CTAGS_THREAD_LOCAL compoundPos StartOfLine;  /* holds deferred position of start of line */
+static CTAGS_THREAD_LOCAL inputCursor BackupCursor;	/* InputCursor for BackupFile */
+static CTAGS_THREAD_LOCAL inputBudget Budget;
+
+CTAGS_THREAD_LOCAL inputCursor InputCursor;	/* in the current line of File */
 
 /*
 *   FUNCTION DEFINITIONS
@@ -152,8 +213,8 @@ extern int getInputLineOffset (void)
 	unsigned char *base = (unsigned char *) vStringValue (File.line);
 	int ret;
 
-	if (File.currentLine)
-		ret = File.currentLine - base - File.ungetchIdx;
+	if (InputCursor.current)
+		ret = InputCursor.current - base - File.ungetchIdx;
 	else if (File.input.lineNumber)
 	{
 		/* When EOF is saw, currentLine is set to NULL.
@@ -178,39 +239,65 @@ extern const char *getInputFileName (void)
 	return vStringValue (File.input.name);
 }
 
-extern MIOPos getInputFilePosition (void)
+static void setLineFposCursor (lineFposCursor *cursor, const inputLineFposMap *map,
+							   unsigned int index);
+
+static unsigned int getLineFposIndex (unsigned int line)
 {
-	return File.filePosition.pos;
+	if (line > 0 && File.lineFposMap.count > (line - 1))
+		return line - 1;
+	else if (line > 0 && File.lineFposMap.count != 0)
+		return File.lineFposMap.count - 1;
+	else
+		return 0;
 }
 
-static compoundPos* getInputFileCompoundPosForLine (unsigned int line)
+static MIOPos getLineFposCursorPosition (const lineFposCursor *cursor)
 {
-	int index;
-	if (line > 0)
+	const lineFposBlock *block = cursor->map->blocks + cursor->index / LINE_FPOS_BLOCK;
+	MIOPos pos = cursor->pos.pos;
+
+	if (cursor->pos.offset != block->first.offset
+		&& mio_getpos_after (cursor->map->mio, &block->first.pos,
+							 cursor->pos.offset - block->first.offset, &pos) != 0)
+		error (FATAL | PERROR, "cannot compute the position of line %u in %s",
+			   cursor->index + 1, getInputFileName ());
+	return pos;
+}
+
+extern MIOPos getInputFilePosition (void)
+{
+	if (File.filePositionDeferred)
 	{
-		if (File.lineFposMap.count > (line - 1))
-			index = line - 1;
-		else if (File.lineFposMap.count != 0)
-			index = File.lineFposMap.count - 1;
-		else
-			index = 0;
+		File.filePosition.pos = getInputFilePositionForLine (File.input.lineNumber);
+		File.filePositionDeferred = false;
 	}
-	else
-		index = 0;
-
-	return File.lineFposMap.pos + index;
+	return File.filePosition.pos;
 }
 
 extern MIOPos getInputFilePositionForLine (unsigned int line)
 {
-	compoundPos *cpos = getInputFileCompoundPosForLine (line);
-	return cpos->pos;
+	lineFposCursor cursor;
+
+	if (File.lineFposMap.count == 0)
+	{
+		MIOPos pos;
+		memset (&pos, 0, sizeof (pos));
+		return pos;
+	}
+	setLineFposCursor (&cursor, &File.lineFposMap, getLineFposIndex (line));
+	return getLineFposCursorPosition (&cursor);
 }
 
 extern long getInputFileOffsetForLine (unsigned int line)
 {
-	compoundPos *cpos = getInputFileCompoundPosForLine (line);
-	long r = cpos->offset - (File.bomFound? 3: 0) - cpos->crAdjustment;
+	lineFposCursor cursor;
+	long r;
+
+	if (File.lineFposMap.count == 0)
+		return 0;
+	setLineFposCursor (&cursor, &File.lineFposMap, getLineFposIndex (line));
+	r = cursor.pos.offset - (File.bomFound? 3: 0) - cursor.pos.crAdjustment;
 	Assert (r >= 0);
 	return r;
 }
@@ -220,6 +307,13 @@ extern langType getInputLanguage (void)
 	return langStackTop (&inputLang.stack);
 }
 
+extern langType getInputLanguageIfAny (void)
+{
+	if (inputLang.stack.count == 0)
+		return LANG_IGNORE;
+	return langStackTop (&inputLang.stack);
+}
+
 extern const char *getInputLanguageName (void)
 {
 	return getLanguageName (getInputLanguage());
@@ -320,85 +414,184 @@ extern const unsigned char *getInputFileData (size_t *size)
  */
 static void freeLineFposMap (inputLineFposMap *lineFposMap)
 {
-	if (lineFposMap->pos)
+	if (lineFposMap->blocks)
 	{
-		eFree (lineFposMap->pos);
-		lineFposMap->pos = NULL;
-		lineFposMap->count = 0;
-		lineFposMap->size = 0;
+		eFree (lineFposMap->blocks);
+		eFree (lineFposMap->deltas);
+		memset (lineFposMap, 0, sizeof (*lineFposMap));
 	}
 }
 
-static void allocLineFposMap (inputLineFposMap *lineFposMap)
+static void allocLineFposMap (inputLineFposMap *lineFposMap, MIO *mio)
 {
-#define INITIAL_lineFposMap_LEN 256
-	lineFposMap->pos = xCalloc (INITIAL_lineFposMap_LEN, compoundPos);
-	lineFposMap->size = INITIAL_lineFposMap_LEN;
+#define INITIAL_lineFposMap_BLOCKS 8
+	lineFposMap->mio = mio;
+	lineFposMap->blocks = xMalloc (INITIAL_lineFposMap_BLOCKS, lineFposBlock);
+	lineFposMap->blockSize = INITIAL_lineFposMap_BLOCKS;
+	lineFposMap->deltaSize = INITIAL_lineFposMap_BLOCKS * LINE_FPOS_BLOCK * 2;
+	lineFposMap->deltas = xMalloc (lineFposMap->deltaSize, unsigned char);
+	lineFposMap->deltaCount = 0;
 	lineFposMap->count = 0;
 }
 
 static void resetLineFposMap (inputLineFposMap *lineFposMap)
 {
-	memset(lineFposMap->pos, 0, sizeof(compoundPos) * lineFposMap->size);
+	lineFposMap->deltaCount = 0;
 	lineFposMap->count = 0;
 }
 
+static void putLineFposDelta (inputLineFposMap *lineFposMap, size_t delta)
+{
+	/* 7 bits in a byte, the highest bit tells another byte follows. */
+	if (lineFposMap->deltaSize - lineFposMap->deltaCount < (sizeof (delta) * 8 + 6) / 7)
+	{
+		lineFposMap->deltaSize *= 2;
+		lineFposMap->deltas = xRealloc (lineFposMap->deltas,
+										lineFposMap->deltaSize, unsigned char);
+	}
+	while (delta >= 0x80)
+	{
+		lineFposMap->deltas [lineFposMap->deltaCount++] = (unsigned char) (delta | 0x80);
+		delta >>= 7;
+	}
+	lineFposMap->deltas [lineFposMap->deltaCount++] = (unsigned char) delta;
+}
+
+static size_t getLineFposDelta (const inputLineFposMap *lineFposMap, size_t *next)
+{
+	size_t delta = 0;
+	unsigned int shift = 0;
+	unsigned char c;
+
+	do {
+		c = lineFposMap->deltas [(*next)++];
+		delta |= (size_t) (c & 0x7f) << shift;
+		shift += 7;
+	} while (c & 0x80);
+	return delta;
+}
+
 static void appendLineFposMap (inputLineFposMap *lineFposMap, compoundPos *pos,
 							   bool crAdjustment, size_t posInAllLines)
 {
-	int lastCrAdjustment = 0;
+	int lastCrAdjustment = lineFposMap->count? lineFposMap->last.crAdjustment: 0;
 
-	if (lineFposMap->size == lineFposMap->count)
+	if (lineFposMap->count % LINE_FPOS_BLOCK == 0)
 	{
-		lineFposMap->size *= 2;
-		lineFposMap->pos = xRealloc (lineFposMap->pos,
-					     lineFposMap->size,
-					     compoundPos);
-	}
+		unsigned int b = lineFposMap->count / LINE_FPOS_BLOCK;
+		lineFposBlock *block;
 
-	if (lineFposMap->count != 0)
+		if (lineFposMap->blockSize == b)
+		{
+			lineFposMap->blockSize *= 2;
+			lineFposMap->blocks = xRealloc (lineFposMap->blocks,
+											lineFposMap->blockSize,
+											lineFposBlock);
+		}
+		block = lineFposMap->blocks + b;
+		block->first = *pos;
+		block->first.crAdjustment = lastCrAdjustment + ((crAdjustment)? 1: 0);
+		block->first.posInAllLines = posInAllLines;
+		block->deltas = lineFposMap->deltaCount;
+	}
+	else
 	{
-		lineFposMap->pos [lineFposMap->count - 1].open = false;
-		lastCrAdjustment = lineFposMap->pos [lineFposMap->count - 1].crAdjustment;
+		Assert (pos->offset > lineFposMap->last.offset);
+		Assert (posInAllLines >= lineFposMap->last.posInAllLines);
+		putLineFposDelta (lineFposMap,
+						  ((size_t) (pos->offset - lineFposMap->last.offset) << 1)
+						  | ((crAdjustment)? 1: 0));
+		putLineFposDelta (lineFposMap,
+						  posInAllLines - lineFposMap->last.posInAllLines);
 	}
 
-	lineFposMap->pos [lineFposMap->count] = *pos;
-	lineFposMap->pos [lineFposMap->count].open = true;
-	lineFposMap->pos [lineFposMap->count].crAdjustment
-		= lastCrAdjustment + ((crAdjustment)? 1: 0);
-	lineFposMap->pos [lineFposMap->count].posInAllLines = posInAllLines;
+	lineFposMap->last.offset = pos->offset;
+	lineFposMap->last.crAdjustment = lastCrAdjustment + ((crAdjustment)? 1: 0);
+	lineFposMap->last.posInAllLines = posInAllLines;
 	lineFposMap->count++;
 }
 
-static int compoundPosForOffset (const void* oft, const void *p)
+/* Move CURSOR to the next line. The next line must be in the map. */
+static void stepLineFposCursor (lineFposCursor *cursor)
 {
-	long offset = *(long *)oft;
-	const compoundPos *pos = p;
-	const compoundPos *next = (compoundPos *)(((char *)pos) + sizeof (compoundPos));
+	const inputLineFposMap *map = cursor->map;
+	size_t delta;
 
-	if (offset < (pos->offset - pos->crAdjustment))
-		return -1;
-	else if (((pos->offset - pos->crAdjustment) <= offset)
-		 && (pos->open
-		     || (offset < (next->offset - next->crAdjustment))))
-		return 0;
-	else
-		return 1;
+	Assert (cursor->index + 1 < map->count);
+	cursor->index++;
+	if (cursor->index % LINE_FPOS_BLOCK == 0)
+	{
+		const lineFposBlock *block = map->blocks + cursor->index / LINE_FPOS_BLOCK;
+		cursor->pos = block->first;
+		cursor->next = block->deltas;
+		return;
+	}
+
+	delta = getLineFposDelta (map, &cursor->next);
+	cursor->pos.offset += delta >> 1;
+	cursor->pos.crAdjustment += delta & 1;
+	cursor->pos.posInAllLines += getLineFposDelta (map, &cursor->next);
+}
+
+static void setLineFposCursor (lineFposCursor *cursor, const inputLineFposMap *map,
+							   unsigned int index)
+{
+	const lineFposBlock *block = map->blocks + index / LINE_FPOS_BLOCK;
+
+	Assert (index < map->count);
+	cursor->map = map;
+	cursor->index = index - index % LINE_FPOS_BLOCK;
+	cursor->pos = block->first;
+	cursor->next = block->deltas;
+	while (cursor->index < index)
+		stepLineFposCursor (cursor);
+}
+
+static long getLineFposCursorStart (const lineFposCursor *cursor)
+{
+	return cursor->pos.offset - cursor->pos.crAdjustment;
 }
 
 extern unsigned long getInputLineNumberForFileOffset(long offset)
 {
-	compoundPos *p;
+	const inputLineFposMap *map = &File.lineFposMap;
+	unsigned int lo, hi;
+	lineFposCursor cursor;
 
 	if (File.bomFound)
 		offset += 3;
 
-	p = bsearch (&offset, File.lineFposMap.pos, File.lineFposMap.count, sizeof (compoundPos),
-		     compoundPosForOffset);
-	if (p == NULL)
+	if (map->count == 0
+		|| offset < map->blocks[0].first.offset - map->blocks[0].first.crAdjustment)
 		return 1;	/* TODO: 0? */
-	else
-		return 1 + (p - File.lineFposMap.pos);
+
+	/* The last block starting at or before OFFSET */
+	lo = 0;
+	hi = (map->count + LINE_FPOS_BLOCK - 1) / LINE_FPOS_BLOCK;
+	while (hi - lo > 1)
+	{
+		unsigned int mid = lo + (hi - lo) / 2;
+		const compoundPos *first = &map->blocks[mid].first;
+
+		if (first->offset - first->crAdjustment <= offset)
+			lo = mid;
+		else
+			hi = mid;
+	}
+
+	/* The last line starting at or before OFFSET in the block */
+	setLineFposCursor (&cursor, map, lo * LINE_FPOS_BLOCK);
+	while (cursor.index + 1 < map->count
+		   && (cursor.index + 1) % LINE_FPOS_BLOCK != 0)
+	{
+		lineFposCursor next = cursor;
+
+		stepLineFposCursor (&next);
+		if (offset < getLineFposCursorStart (&next))
+			break;
+		cursor = next;
+	}
+	return 1 + cursor.index;
 }
 
 /*
@@ -422,9 +615,26 @@ static void setOwnerDirectoryOfInputFile (const char *const fileName)
 	}
 }
 
+extern vString *makeInputFileTagPath (const char *const fileName)
+{
+	if (  Option.tagRelative == TREL_ALWAYS )
+		return vStringNewOwn (relativeFilename (fileName,
+												getTagFileDirectory ()));
+	else if ( Option.tagRelative == TREL_NEVER )
+		return vStringNewOwn (absoluteFilename (fileName));
+	else if ( Option.tagRelative == TREL_NO || isAbsolutePath (fileName) )
+		return vStringNewInit (fileName);
+	else
+		return vStringNewOwn (relativeFilename (fileName,
+												getTagFileDirectory ()));
+}
+
+/* If SAME is given, it is the info of the same file; its tag path and
+ * header check are copied instead of being computed again. */
 static void setInputFileParametersCommon (inputFileInfo *finfo, vString *const fileName,
 					  const langType language,
-					  stringList *holder)
+					  stringList *holder,
+					  const inputFileInfo *same)
 {
 	if (finfo->name != NULL)
 		vStringDelete (finfo->name);
@@ -438,21 +648,14 @@ static void setInputFileParametersCommon (inputFileInfo *finfo, vString *const f
 			vStringDelete (finfo->tagPath);
 	}
 
-	if (0)
-		;
-	else if (  Option.tagRelative == TREL_ALWAYS )
-		finfo->tagPath =
-			vStringNewOwn (relativeFilename (vStringValue (fileName),
-							 getTagFileDirectory ()));
-	else if ( Option.tagRelative == TREL_NEVER )
-		finfo->tagPath =
-			vStringNewOwn (absoluteFilename (vStringValue (fileName)));
-	else if ( Option.tagRelative == TREL_NO || isAbsolutePath (vStringValue (fileName)) )
-		finfo->tagPath = vStringNewCopy (fileName);
-	else
-		finfo->tagPath =
-			vStringNewOwn (relativeFilename (vStringValue (fileName),
-							 getTagFileDirectory ()));
+	if (same)
+	{
+		finfo->tagPath = vStringNewCopy (same->tagPath);
+		finfo->isHeader = same->isHeader;
+		return;
+	}
+
+	finfo->tagPath = makeInputFileTagPath (vStringValue (fileName));
 
 	finfo->isHeader = isIncludeFile (vStringValue (fileName));
 }
@@ -488,17 +691,23 @@ static void clearLangOnStack (inputLangInfo *langInfo)
 static void setInputFileParameters (vString *const fileName, const langType language)
 {
 	setInputFileParametersCommon (&File.input, fileName,
-				      language, NULL);
+				      language, NULL, NULL);
 	pushLangOnStack(&inputLang, language);
 }
 
-static void setSourceFileParameters (vString *const fileName, const langType language)
+static void setSourceFileParametersFull (vString *const fileName, const langType language,
+										 const inputFileInfo *same)
 {
 	setInputFileParametersCommon (&File.source, fileName,
-				      language, File.sourceTagPathHolder);
+				      language, File.sourceTagPathHolder, same);
 	sourceLang = language;
 }
 
+static void setSourceFileParameters (vString *const fileName, const langType language)
+{
+	setSourceFileParametersFull (fileName, language, NULL);
+}
+
 static bool setSourceFileName (vString *const fileName)
 {
 	const langType language = getLanguageForFilenameAndContents (vStringValue (fileName));
@@ -643,21 +852,48 @@ static MIO *getMioFull (const char *const fileName, const char *const openMode,
 	fileStatus *st;
 	unsigned long size;
 	unsigned char *data;
+	bool tight;
+	const memoryTotals streamed = { .streamed = 1 };
 
 	st = eStat (fileName);
 	size = st->size;
 	if (mtime)
 		*mtime = st->mtime;
 	eStatFree (st);
+
+	/* The memory is kept for the others under --memory-limit. */
+	tight = (size > 0 && size <= MAX_IN_MEMORY_FILE_SIZE
+			 && (isMemoryTight () || size > getMemoryAvailable ()));
+#ifdef HAVE_MMAP
+	/* Large files are mapped instead of being read into a buffer. */
+	if (size > MAX_IN_MEMORY_FILE_SIZE || tight)
+	{
+		MIO *mio = mio_new_mmap (fileName);
+		if (mio)
+		{
+			if (tight)
+				addMemoryTotals (&streamed);
+			return mio;
+		}
+	}
+#endif
+
 	if ((!memStreamRequired)
-	    && (size > MAX_IN_MEMORY_FILE_SIZE || size == 0))
+	    && (size > MAX_IN_MEMORY_FILE_SIZE || size == 0 || tight))
+	{
+		if (tight)
+			addMemoryTotals (&streamed);
 		return mio_new_file (fileName, openMode);
+	}
 
 	src = fopen (fileName, openMode);
 	if (!src)
 		return NULL;
 
-	data = eMalloc (size);
+	/* The '\0' after the data keeps a reader looking for it, like
+	 * regexec () without REG_STARTEND, in the buffer. */
+	data = eMalloc (size + 1);
+	data [size] = '\0';
 	if (fread (data, 1, size, src) != size)
 	{
 		eFree (data);
@@ -739,16 +975,21 @@ extern bool openInputFile (const char *const fileName, const langType language,
 
 	memStreamRequired = doesParserRequireMemoryStream (language);
 
+	MIO *copied = NULL;
 	if (mio)
 	{
-		size_t tmp;
-		if (memStreamRequired && (!mio_memory_get_data (mio, &tmp)))
-			mio = NULL;
-		else
+		/* Copy the input opened for guessing the language into memory
+		   instead of opening the file again. */
+		if (memStreamRequired && (!mio_memory_get_data (mio, NULL)))
+			mio = copied = mio_new_mio (mio, 0, -1);
+		if (mio)
 			mio_rewind (mio);
 	}
 
 	File.mio = mio? mio_ref (mio): getMioFull (fileName, openMode, memStreamRequired, &File.mtime);
+	File.lineCheckedForLength = NULL;
+	if (copied)
+		mio_unref (copied);
 
 	if (File.mio == NULL)
 		error (WARNING | PERROR, "cannot open \"%s\"", fileName);
@@ -765,7 +1006,7 @@ extern bool openInputFile (const char *const fileName, const langType language,
 		mio_getpos (File.mio, &StartOfLine.pos);
 		mio_getpos (File.mio, &File.filePosition.pos);
 		File.filePosition.offset = StartOfLine.offset = mio_tell (File.mio);
-		File.currentLine  = NULL;
+		InputCursor.current = InputCursor.end = NULL;
 
 		File.line = vStringNewOrClear (File.line);
 		File.ungetchIdx = 0;
@@ -773,12 +1014,22 @@ extern bool openInputFile (const char *const fileName, const langType language,
 		setInputFileParameters  (vStringNewInit (fileName), language);
 		File.input.lineNumberOrigin = 0L;
 		File.input.lineNumber = File.input.lineNumberOrigin;
-		setSourceFileParameters (vStringNewInit (fileName), language);
+		setSourceFileParametersFull (vStringNewInit (fileName), language,
+									 &File.input);
 		File.source.lineNumberOrigin = 0L;
 		File.source.lineNumber = File.source.lineNumberOrigin;
-		allocLineFposMap (&File.lineFposMap);
+		allocLineFposMap (&File.lineFposMap, File.mio);
 
 		File.thinDepth = 0;
+
+		memset (&Budget, 0, sizeof (Budget));
+		if (Option.maxFileTime > 0)
+		{
+			statsTime now;
+			readStatsTime (&now);
+			Budget.deadline = now.wall + Option.maxFileTime;
+		}
+
 		verbose ("OPENING%s %s as %s language %sfile [%s%s]\n",
 				 (File.bomFound? "(skipping utf-8 bom)": ""),
 				 fileName,
@@ -795,6 +1046,31 @@ extern time_t getInputFileMtime (void)
 	return File.mtime;
 }
 
+/* Whether the lines of the input would be copied for the multiline and
+ * post-run regex patterns though the memory is tight under
+ * --memory-limit. The patterns are not matched then. */
+static bool isAllLinesCopyTooLarge (void)
+{
+	size_t size = 0;
+	const memoryTotals skipped = { .mlineSkipped = 1 };
+
+	if (Option.memoryLimit == 0)
+		return false;
+
+	if (mio_memory_get_data (File.mio, &size)
+		&& File.thinDepth == 0
+		&& canRegexMatchUnterminatedInput ())
+		return false;			/* matched in place */
+
+	if (!isMemoryTight () && size <= getMemoryAvailable ())
+		return false;
+
+	verbose ("not matching multiline regex patterns to %s for --memory-limit\n",
+			 getInputFileName ());
+	addMemoryTotals (&skipped);
+	return true;
+}
+
 extern void resetInputFile (const langType language, bool resetLineFposMap_)
 {
 	Assert (File.mio);
@@ -803,15 +1079,24 @@ extern void resetInputFile (const langType language, bool resetLineFposMap_)
 	mio_getpos (File.mio, &StartOfLine.pos);
 	mio_getpos (File.mio, &File.filePosition.pos);
 	File.filePosition.offset = StartOfLine.offset = mio_tell (File.mio);
-	File.currentLine  = NULL;
+	InputCursor.current = InputCursor.end = NULL;
 
 	Assert (File.line);
 	vStringClear (File.line);
 	File.ungetchIdx = 0;
 
-	if (hasLanguageMultilineRegexPatterns (language)
-		|| hasLanguagePostRunRegexPatterns (language))
-		File.allLines = vStringNew ();
+	if ((hasLanguageMultilineRegexPatterns (language)
+		 || hasLanguagePostRunRegexPatterns (language))
+		&& !isAllLinesCopyTooLarge ())
+	{
+		File.allLinesRequired = true;
+		File.allLinesStart = StartOfLine.offset;
+		File.allLinesLength = 0;
+		if (!mio_memory_get_data (File.mio, NULL)
+			|| File.thinDepth > 0
+			|| !canRegexMatchUnterminatedInput ())
+			File.allLines = vStringNew ();
+	}
 
 	if (resetLineFposMap_)
 		resetLineFposMap(&File.lineFposMap);
@@ -822,6 +1107,44 @@ extern void resetInputFile (const langType language, bool resetLineFposMap_)
 	File.source.lineNumber = File.source.lineNumberOrigin;
 }
 
+/* A guest parser reads lines of the host's input; #line directives
+ * change the source line number without a record of it; the lines for
+ * the multiline patterns are collected from the start of the input. The
+ * reading can't be restarted from the middle in these cases. */
+extern bool getInputLinePoint (inputLinePoint *point)
+{
+	point->lineNumber = File.input.lineNumber + 1;
+	point->pos = StartOfLine.pos;
+	point->offset = StartOfLine.offset;
+
+	return (BackupFile.mio == NULL
+			&& File.thinDepth == 0
+			&& !File.allLinesRequired
+			&& !Option.lineDirectives
+			&& !Budget.stopped
+			&& File.input.lineNumber > File.input.lineNumberOrigin
+			&& File.ungetchIdx == 0
+			&& (InputCursor.current == NULL
+				|| InputCursor.current >= File.currentLineEnd));
+}
+
+/* The lines before POINT are kept in lineFposMap. */
+extern void resumeInputFile (const langType language, const inputLinePoint *point)
+{
+	resetInputFile (language, false);
+
+	if (mio_setpos (File.mio, (MIOPos *) &point->pos) != 0)
+		error (FATAL | PERROR, "cannot restart reading %s at line %lu",
+			   getInputFileName (), point->lineNumber);
+	StartOfLine.pos = point->pos;
+	StartOfLine.offset = point->offset;
+	File.filePosition = StartOfLine;
+
+	File.input.lineNumber = point->lineNumber - 1;
+	File.source.lineNumber = File.source.lineNumberOrigin
+		+ (File.input.lineNumber - File.input.lineNumberOrigin);
+}
+
 extern void closeInputFile (void)
 {
 	if (File.mio != NULL)
@@ -831,11 +1154,16 @@ extern void closeInputFile (void)
 		/*  The line count of the file is 1 too big, since it is one-based
 		 *  and is incremented upon each newline.
 		 */
-		if (Option.printTotals)
+		if (isTotalsEnabled ())
 		{
 			fileStatus *status = eStat (vStringValue (File.input.name));
 			addTotals (0, File.input.lineNumber - 1L, status->size);
 		}
+		if (Budget.stopped)
+		{
+			partialTotals partial = { .overBudget = 1 };
+			addPartialTotals (&partial);
+		}
 		mio_unref (File.mio);
 		File.mio = NULL;
 		freeLineFposMap (&File.lineFposMap);
@@ -853,7 +1181,10 @@ static void fileNewline (bool crAdjustment, size_t posInAllLines)
 {
 	File.filePosition = StartOfLine;
 
-	if (BackupFile.mio == NULL)
+	/* The lines before the point given to resumeInputFile () are
+	 * in the map already. */
+	if (BackupFile.mio == NULL
+		&& File.lineFposMap.count <= File.input.lineNumber)
 		appendLineFposMap (&File.lineFposMap, &File.filePosition,
 						   crAdjustment, posInAllLines);
 
@@ -870,7 +1201,11 @@ extern void ungetcToInputFile (int c)
 	Assert (File.ungetchIdx < len);
 	/* we cannot rely on the assertion that might be disabled in non-debug mode */
 	if (File.ungetchIdx < len)
+	{
 		File.ungetchBuf[File.ungetchIdx++] = c;
+		/* Make getcFromInputFile () take the slow path. */
+		InputCursor.end = InputCursor.current;
+	}
 }
 
 typedef enum eEolType {
@@ -879,12 +1214,50 @@ typedef enum eEolType {
 	eol_cr_nl,
 } eolType;
 
+/* Read a line of a memory stream by copying it at once from the buffer
+ * of the stream. The number of bytes read is stored to LENGTH. NULL is
+ * returned, and the stream is not moved, if the stream isn't a memory
+ * stream, is at the end, or the line includes a NUL byte; readLine ()
+ * reads the line then. */
+static vString *readLineFromMemory (vString *const vLine, MIO *const mio,
+									eolType *const eol, size_t *const length)
+{
+	const char *line = mio_memory_gets (mio, length);
+	size_t size = *length;
+
+	if (line == NULL)
+		return NULL;
+	if (memchr (line, '\0', size))
+	{
+		mio_seek (mio, - (long) size, SEEK_CUR);
+		return NULL;
+	}
+
+	if (line [size - 1] != '\n')
+		*eol = eol_eof;
+	else if (size > 1 && line [size - 2] == '\r')
+	{
+		size--;
+		*eol = eol_cr_nl;
+	}
+	else
+		*eol = eol_nl;
+
+	vStringNCopySUnsafe (vLine, line, size);
+	if (*eol == eol_cr_nl)
+		vStringChar (vLine, size - 1) = '\n';
+	return vLine;
+}
+
 static eolType readLine (vString *const vLine, MIO *const mio)
 {
 	char *str;
 	size_t size;
 	eolType r = eol_nl;
 
+	if (readLineFromMemory (vLine, mio, &r, &size))
+		return r;
+
 	vStringClear (vLine);
 
 	str = vStringValue (vLine);
@@ -928,31 +1301,141 @@ static eolType readLine (vString *const vLine, MIO *const mio)
 	return r;
 }
 
-static vString *iFileGetLine (bool chop_newline)
+/* The limit of --max-file-bytes applies to the input file, not to the
+ * areas of it given to the guest parsers. They are in the part of the
+ * input file read by the host parser. */
+static bool isInputOverBudget (void)
+{
+	const char *what;
+
+	if (Budget.timeExceeded)
+		return true;
+
+	if (Option.maxFileBytes > 0 && BackupFile.mio == NULL
+		&& (unsigned long) StartOfLine.offset >= Option.maxFileBytes)
+		what = "bytes";
+	else if (Option.maxFileTime > 0 && Budget.countdown-- == 0)
+	{
+		statsTime now;
+
+		Budget.countdown = BUDGET_TIME_INTERVAL;
+		readStatsTime (&now);
+		if (now.wall < Budget.deadline)
+			return false;
+		Budget.timeExceeded = true;
+		what = "time";
+	}
+	else
+		return false;
+
+	if (!Budget.stopped)
+	{
+		notice ("stop parsing %s after line %lu: over --max-file-%s",
+				getInputFileName (), getInputLineNumber (), what);
+		Budget.stopped = true;
+	}
+	return true;
+}
+
+/* Return the lines read for the multiline patterns. They are in the
+ * memory stream as they are unless a line ended with CR-LF or included
+ * a NUL byte; the lines are read again into a copy then. The lines in
+ * the memory stream are not terminated with '\0': the matchers must not
+ * read past their length. The input files read into memory have a '\0'
+ * after their data, but the mapped ones and the buffers given to
+ * parseRawBuffer () don't. */
+static const char *getAllLines (void)
+{
+	const unsigned char *data;
+	size_t length;
+	vString *line;
+	MIO *mio;
+	eolType eol;
+
+	if (File.allLines)
+		return vStringValue (File.allLines);
+
+	data = mio_memory_get_data (File.mio, NULL) + File.allLinesStart;
+	length = StartOfLine.offset - File.allLinesStart;
+	if (length == File.allLinesLength)
+		return (const char *) data;
+
+	File.allLines = vStringNew ();
+	vStringResize (File.allLines, File.allLinesLength + 1);
+	line = vStringNew ();
+	mio = mio_new_memory ((unsigned char *) data, length, NULL, NULL);
+	do
+	{
+		eol = readLine (line, mio);
+		vStringCat (File.allLines, line);
+	} while (eol != eol_eof);
+	mio_unref (mio);
+	vStringDelete (line);
+	Assert (vStringLength (File.allLines) == File.allLinesLength);
+	return vStringValue (File.allLines);
+}
+
+/* The regex patterns see the first --max-line-bytes bytes of a line. */
+static size_t getRegexInputLength (size_t length)
+{
+	if (Option.maxLineBytes > 0 && length > Option.maxLineBytes)
+		return Option.maxLineBytes;
+	return length;
+}
+
+static vString *iFileGetLine (bool chop_newline, bool matching)
 {
 	eolType eol;
+	size_t length = 0;
 	langType lang = getInputLanguage();
 
 	Assert (File.line);
-	eol = readLine (File.line, File.mio);
+	if (isInputOverBudget ())
+	{
+		vStringClear (File.line);
+		eol = eol_eof;
+	}
+	else if (!readLineFromMemory (File.line, File.mio, &eol, &length))
+	{
+		length = 0;
+		eol = readLine (File.line, File.mio);
+	}
 
 	if (vStringLength (File.line) > 0)
 	{
 		/* Use StartOfLine from previous iFileGetLine() call */
-		fileNewline (eol == eol_cr_nl, File.allLines? vStringLength(File.allLines): 0);
+		fileNewline (eol == eol_cr_nl, File.allLinesLength);
 		/* Store StartOfLine for the next iFileGetLine() call */
 		mio_getpos (File.mio, &StartOfLine.pos);
-		StartOfLine.offset = mio_tell (File.mio);
+		StartOfLine.offset = (length > 0)
+			? StartOfLine.offset + (long) length
+			: mio_tell (File.mio);
 
 		if (Option.lineDirectives && vStringChar (File.line, 0) == '#')
 			parseLineDirective (vStringValue (File.line) + 1);
 
-		if (File.allLines)
-			vStringCat (File.allLines, File.line);
+		if (File.allLinesRequired)
+		{
+			File.allLinesLength += vStringLength (File.line);
+			if (File.allLines)
+				vStringCat (File.allLines, File.line);
+		}
 
 		bool chopped = vStringStripNewline (File.line);
+		size_t regexLength = getRegexInputLength (vStringLength (File.line));
 
-		matchLanguageRegex (lang, File.line, false);
+		if (matching && regexLength < vStringLength (File.line)
+			&& !canRegexMatchUnterminatedInput ())
+		{
+			/* The regex backend looks for the NUL. */
+			char c = vStringChar (File.line, regexLength);
+
+			vStringChar (File.line, regexLength) = '\0';
+			matchLanguageRegex (lang, vStringValue (File.line), regexLength, false);
+			vStringChar (File.line, regexLength) = c;
+		}
+		else if (matching)
+			matchLanguageRegex (lang, vStringValue (File.line), regexLength, false);
 
 		if (chopped && !chop_newline)
 			vStringPutNewlinAgainUnsafe (File.line);
@@ -961,36 +1444,56 @@ static vString *iFileGetLine (bool chop_newline)
 	}
 	else
 	{
-		if (File.allLines)
+		if (File.allLinesRequired)
 		{
-			matchLanguageMultilineRegex (lang, File.allLines);
-			matchLanguageMultitableRegex (lang, File.allLines);
+			const char *allLines = getAllLines ();
 
-			if (hasLanguagePostRunRegexPatterns (lang))
+			if (matching)
+			{
+				matchLanguageMultilineRegex (lang, allLines, File.allLinesLength);
+				matchLanguageMultitableRegex (lang, allLines, File.allLinesLength);
+			}
+
+			if (matching && hasLanguagePostRunRegexPatterns (lang))
 			{
 
 				unsigned input_ln = File.input.lineNumber;
 				unsigned source_ln = File.source.lineNumber;
 				MIOPos pos = File.filePosition.pos;
+				lineFposCursor cursor;
 
-				vString *line = vStringNew();
+				/* The lines are matched in place unless the regex
+				 * backend needs a NUL after each of them. */
+				vString *line = canRegexMatchUnterminatedInput ()? NULL: vStringNew ();
+				if (File.lineFposMap.count > 0)
+					setLineFposCursor (&cursor, &File.lineFposMap, 0);
 				for (size_t i = 0; i < File.lineFposMap.count; i++)
 				{
+					size_t start = cursor.pos.posInAllLines;
+					size_t length;
+
 					File.input.lineNumber = i + 1;
 					File.source.lineNumber = File.input.lineNumber;
-					File.filePosition.pos = File.lineFposMap.pos[i].pos;
-
-					vStringNCopySUnsafe(line,
-										vStringValue(File.allLines) +
-										File.lineFposMap.pos[i].posInAllLines,
-										(((i + 1) < File.lineFposMap.count)
-										 ? File.lineFposMap.pos[i+1].posInAllLines
-										 : vStringLength (File.allLines))
-										- File.lineFposMap.pos[i].posInAllLines);
-					matchLanguageRegex (lang, line, true);
+					/* Computed only if a tag is made on the line. */
+					File.filePositionDeferred = true;
+
+					if ((i + 1) < File.lineFposMap.count)
+						stepLineFposCursor (&cursor);
+					length = (((i + 1) < File.lineFposMap.count)
+							  ? cursor.pos.posInAllLines
+							  : File.allLinesLength) - start;
+					length = getRegexInputLength (length);
+					if (line)
+					{
+						vStringNCopySUnsafe (line, allLines + start, length);
+						matchLanguageRegex (lang, vStringValue (line), length, true);
+					}
+					else
+						matchLanguageRegex (lang, allLines + start, length, true);
 				}
-				vStringDelete(line);
+				vStringDelete (line);
 
+				File.filePositionDeferred = false;
 				File.filePosition.pos = pos;
 				File.input.lineNumber = input_ln;
 				File.source.lineNumber = source_ln;
@@ -998,6 +1501,7 @@ static vString *iFileGetLine (bool chop_newline)
 
 			/* To limit the execution of multiline/multitable parser(s) only
 			   ONCE, clear File.allLines field. */
+			File.allLinesRequired = false;
 			vStringDelete (File.allLines);
 			File.allLines = NULL;
 		}
@@ -1007,7 +1511,7 @@ static vString *iFileGetLine (bool chop_newline)
 
 /*  Do not mix use of readLineFromInputFile () and getcFromInputFile () for the same file.
  */
-extern int getcFromInputFile (void)
+extern int getcFromInputFileSlow (void)
 {
 	int c;
 
@@ -1018,25 +1522,36 @@ extern int getcFromInputFile (void)
 	if (File.ungetchIdx > 0)
 	{
 		c = File.ungetchBuf[--File.ungetchIdx];
+		if (File.ungetchIdx == 0 && InputCursor.current != NULL)
+			InputCursor.end = File.currentLineEnd;
 		return c;  /* return here to avoid re-calling debugPutc () */
 	}
 	do
 	{
-		if (File.currentLine != NULL)
+		if (InputCursor.current != NULL)
 		{
-			c = *File.currentLine++;
-			if (c == '\0')
-				File.currentLine = NULL;
+			if (InputCursor.current < File.currentLineEnd)
+				c = *InputCursor.current++;
+			else
+			{
+				c = '\0';
+				InputCursor.current = InputCursor.end = NULL;
+			}
 		}
 		else
 		{
-			vString* const line = iFileGetLine (false);
-			if (line != NULL)
-				File.currentLine = (unsigned char*) vStringValue (line);
-			if (File.currentLine == NULL)
+			vString* const line = iFileGetLine (false, true);
+			if (line == NULL)
 				c = EOF;
 			else
+			{
+				/* A NUL in the line ends the line. */
+				InputCursor.current = (unsigned char*) vStringValue (line);
+				File.currentLineEnd = InputCursor.current
+					+ strlen ((const char *) InputCursor.current);
+				InputCursor.end = File.currentLineEnd;
 				c = '\0';
+			}
 		}
 	} while (c == '\0');
 	DebugStatement ( debugPutc (DEBUG_READ, c); )
@@ -1050,8 +1565,8 @@ extern int getNthPrevCFromInputFile (unsigned int nth, int def)
 	const unsigned char *base = (unsigned char *) vStringValue (File.line);
 	const unsigned int offset = File.ungetchIdx + 1 + nth;
 
-	if (File.currentLine != NULL && File.currentLine >= base + offset)
-		return (int) *(File.currentLine - offset);
+	if (InputCursor.current != NULL && InputCursor.current >= base + offset)
+		return (int) *(InputCursor.current - offset);
 	else
 		return def;
 }
@@ -1061,6 +1576,8 @@ extern int skipToCharacterInInputFile (int c)
 	int d;
 	do
 	{
+		InputCursor.current = findByte (InputCursor.current, InputCursor.end,
+										(unsigned char) c);
 		d = getcFromInputFile ();
 	} while (d != EOF && d != c);
 	return d;
@@ -1086,7 +1603,7 @@ extern int skipToCharacterInInputFile2 (int c0, int c1)
  */
 extern const unsigned char *readLineFromInputFileWithLength (size_t *length)
 {
-	vString* const line = iFileGetLine (true);
+	vString* const line = iFileGetLine (true, true);
 	const unsigned char* result = NULL;
 	if (line != NULL)
 	{
@@ -1103,6 +1620,13 @@ extern const unsigned char *readLineFromInputFile (void)
 	return readLineFromInputFileWithLength(&dummy);
 }
 
+extern unsigned long readToEndOfInputFile (void)
+{
+	while (iFileGetLine (true, false) != NULL)
+		;
+	return getInputLineNumber ();
+}
+
 /*
  *   Raw file line reading with automatic buffer sizing
  */
@@ -1144,6 +1668,75 @@ extern char *readLineFromBypass (
 	return result;
 }
 
+/*  Returns the line referenced by "location" in the buffer of the input
+ *  file without copying it. The line is not terminated with '\0'; its
+ *  length including the line break is stored to "length". NULL is
+ *  returned if readLineFromBypass () must be used instead: the input
+ *  file isn't a memory stream, it is converted, or the line includes a
+ *  '\0' character. If "limit" is not 0, only the first "limit" bytes of
+ *  the line are looked at, and a longer line is returned cut there
+ *  unless a '\r' character is in them.
+ */
+extern const char *peekLineFromBypass (MIOPos location, size_t limit,
+									   size_t *const length)
+{
+	size_t size, whole;
+	const char *line;
+	const char *newline;
+
+#ifdef HAVE_ICONV
+	if (isConverting ())
+		return NULL;
+#endif
+
+	line = (const char *) mio_memory_get_data_at (File.mio, &location, &size);
+	if (line == NULL || size == 0)
+		return NULL;
+
+	whole = size;
+	if (limit > 0 && size > limit)
+		size = limit;
+	newline = memchr (line, '\n', size);
+	if (newline == NULL && size < whole && memchr (line, '\r', size))
+	{
+		/* The caller looking at the line up to the CR must know
+		 * whether the whole line ends with a newline. */
+		size = whole;
+		newline = memchr (line, '\n', size);
+	}
+	if (newline)
+		size = (size_t) (newline - line) + 1;
+	if (memchr (line, '\0', size))
+		return NULL;
+
+	*length = size;
+	return line;
+}
+
+/*  Returns whether the line referenced by "location" is longer than
+ *  --max-line-bytes. Only the first bytes of the line are looked at.
+ *  false is returned if the input file isn't a memory stream.
+ */
+extern bool isLongLineInInputFile (MIOPos location)
+{
+	size_t size;
+	const char *line;
+
+	if (Option.maxLineBytes == 0)
+		return false;
+
+	line = (const char *) mio_memory_get_data_at (File.mio, &location, &size);
+	if (line == NULL || size <= Option.maxLineBytes)
+		return false;
+
+	if (line != File.lineCheckedForLength)
+	{
+		File.lineCheckedForLength = line;
+		File.longLineFound = (memchr (line, '\n', Option.maxLineBytes + 1) == NULL);
+	}
+	return File.longLineFound;
+}
+
 extern void   pushNarrowedInputStream (
 				       bool useMemoryStreamInput,
 				       unsigned long startLine, long startCharOffset,
@@ -1212,8 +1805,10 @@ extern void   pushNarrowedInputStream (
 				  size);
 
 	BackupFile = File;
+	BackupCursor = InputCursor;
 
 	File.mio = subio;
+	File.lineCheckedForLength = NULL;
 	File.bomFound = false;
 	File.nestedInputStreamInfo.startLine = startLine;
 	File.nestedInputStreamInfo.startCharOffset = startCharOffset;
@@ -1224,6 +1819,19 @@ extern void   pushNarrowedInputStream (
 	File.source.lineNumberOrigin = ((sourceLineOffset == 0)? 0: sourceLineOffset - 1);
 }
 
+extern void   pushInputRegion (bool useMemoryStreamInput,
+							   unsigned long startLine, unsigned long endLine)
+{
+	/* The positions of the lines are known after reading them. */
+	readToEndOfInputFile ();
+
+	pushNarrowedInputStream (useMemoryStreamInput,
+							 startLine, 0, endLine, EOL_CHAR_OFFSET,
+							 startLine, -1);
+	/* The parser doesn't run as a guest. */
+	memset (&File.nestedInputStreamInfo, 0, sizeof (File.nestedInputStreamInfo));
+}
+
 extern bool doesParserRunAsGuest (void)
 {
 	return !(File.nestedInputStreamInfo.startLine == 0
@@ -1261,6 +1869,8 @@ extern void   popNarrowedInputStream  (void)
 	mio_unref (File.mio);
 	File = BackupFile;
 	memset (&BackupFile, 0, sizeof (BackupFile));
+	InputCursor = BackupCursor;
+	memset (&BackupCursor, 0, sizeof (BackupCursor));
 }
 
 extern void pushLanguage (const langType language)
@@ -17,6 +17,7 @@
 #include <stdio.h>
 #include <ctype.h>
 
+#include "inline.h"
 #include "types.h"
 #include "vstring.h"
 #include "mio.h"
@@ -29,6 +30,18 @@
 *   DATA DECLARATIONS
 */
 
+/* The characters of the current input line not read yet with
+ * getcFromInputFile (). END is CURRENT while a character pushed back with
+ * ungetcToInputFile () is waiting, so a scanning loop can read the
+ * characters in [CURRENT, END) directly and call getcFromInputFile ()
+ * when it reaches END. Both are NULL before the first line is read. */
+typedef struct sInputCursor {
+	const unsigned char *current;
+	const unsigned char *end;
+} inputCursor;
+
+extern CTAGS_THREAD_LOCAL inputCursor InputCursor;
+
 /*
 *   FUNCTION PROTOTYPES
 */
@@ -48,7 +61,19 @@ extern bool isInputLanguageRoleEnabled (int kindIndex, int roleIndex);
 
 extern const unsigned char *getInputFileData (size_t *size);
 
-extern int getcFromInputFile (void);
+/* Read the next character from the next line, the ungetc buffer, or EOF. */
+extern int getcFromInputFileSlow (void);
+#ifdef DEBUG
+/* DEBUG_READ prints every character read. */
+#define getcFromInputFile getcFromInputFileSlow
+#else
+CTAGS_INLINE int getcFromInputFile (void)
+{
+	if (InputCursor.current < InputCursor.end)
+		return *InputCursor.current++;
+	return getcFromInputFileSlow ();
+}
+#endif
 extern int getNthPrevCFromInputFile (unsigned int nth, int def);
 extern int skipToCharacterInInputFile (int c);
 extern int skipToCharacterInInputFile2 (int c0, int c1);
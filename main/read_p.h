@@ -22,6 +22,13 @@
 *   DATA DECLARATIONS
 */
 
+/* The start of a line of the input, where reading can be restarted. */
+typedef struct sInputLinePoint {
+	unsigned long lineNumber;	/* of the line starting at the point */
+	MIOPos pos;
+	long offset;
+} inputLinePoint;
+
 enum nestedInputBoundaryFlag {
 	INPUT_BOUNDARY_START = 1UL << 0,
 	INPUT_BOUNDARY_END   = 1UL << 1,
@@ -32,6 +39,8 @@ enum nestedInputBoundaryFlag {
 */
 
 extern const char *getInputLanguageName (void);
+/* LANG_IGNORE when no input file is open. */
+extern langType getInputLanguageIfAny (void);
 extern const char *getInputFileTagPath (void);
 
 extern long getInputFileOffsetForLine (unsigned int line);
@@ -56,6 +65,12 @@ extern bool openInputFile (const char *const fileName, const langType language,
 extern MIO *getMio (const char *const fileName, const char *const openMode,
 				    bool memStreamRequired);
 extern void resetInputFile (const langType language, bool resetLineFposMap_);
+
+/* Fill POINT with the start of the line after the lines read so far.
+ * Return true if no character of those lines is left unread, and the
+ * input can be read again from POINT with resumeInputFile (). */
+extern bool getInputLinePoint (inputLinePoint *point);
+extern void resumeInputFile (const langType language, const inputLinePoint *point);
 extern void closeInputFile (void);
 extern void *getInputFileUserData(void);
 
@@ -64,10 +79,16 @@ extern unsigned int getNestedInputBoundaryInfo (unsigned long lineNumber);
 extern const char *getSourceFileTagPath (void);
 extern langType getSourceLanguage (void);
 
+/* Make the name of FILENAME written to the input field of tags. */
+extern vString *makeInputFileTagPath (const char *const fileName);
+
 extern time_t getInputFileMtime (void);
 
 /* Bypass: reading from fp in inputFile WITHOUT updating fields in input fields */
 extern char *readLineFromBypass (vString *const vLine, MIOPos location, long *const pSeekValue);
+extern const char *peekLineFromBypass (MIOPos location, size_t limit,
+									   size_t *const length);
+extern bool isLongLineInInputFile (MIOPos location);
 extern void   pushNarrowedInputStream (
 				       bool useMemoryStreamInput,
 				       unsigned long startLine, long startCharOffset,
@@ -76,6 +97,18 @@ extern void   pushNarrowedInputStream (
 				       int promise);
 extern void   popNarrowedInputStream  (void);
 
+/* Read the rest of the input file without matching the regex patterns,
+ * so that the positions of all the lines are known. Returns the number
+ * of the last line read. */
+extern unsigned long readToEndOfInputFile (void);
+
+/* Narrow the input file to the lines from STARTLINE to ENDLINE as
+ * pushNarrowedInputStream () does, but the parser runs on them as on a
+ * whole input file, not as a guest. The line numbers of the tags are
+ * those in the whole input file. Pop it with popNarrowedInputStream (). */
+extern void   pushInputRegion (bool useMemoryStreamInput,
+							   unsigned long startLine, unsigned long endLine);
+
 #define THIN_STREAM_SPEC 0, 0, 0, 0, 0
 extern bool isThinStreamSpec(unsigned long startLine, long startCharOffset,
 							 unsigned long endLine, long endCharOffset,
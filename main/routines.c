@@ -52,6 +52,9 @@
 #ifdef HAVE_IO_H
 # include <io.h>  /* to declare open() */
 #endif
+#ifdef HAVE_MALLOC_USABLE_SIZE
+# include <malloc.h>  /* to declare malloc_usable_size () */
+#endif
 #include "debug.h"
 #include "routines.h"
 #include "routines_p.h"
@@ -167,7 +170,6 @@ extern int lstat (const char *, struct stat *);
 # define lstat(fn,buf) stat(fn,buf)
 #endif
 
-static bool isPathSeparator (const int c);
 static char *strSeparator (const char *s);
 static char *strRSeparator (const char *s);
 static void canonicalizePath (char *const path);
@@ -215,13 +217,347 @@ static bool fnmChEq (int c1, int c2)
  *  Memory allocation functions
  */
 
+/* The memory is tight when the bytes allocated take more than
+ * MEMORY_TIGHT_PERCENT of the limit. */
+#define MEMORY_TIGHT_PERCENT 75
+
+#ifdef HAVE_MALLOC_USABLE_SIZE
+# define allocatedSize(ptr) malloc_usable_size (ptr)
+#else
+# define allocatedSize(ptr) ((size_t) 0)
+#endif
+
+static unsigned long AllocationCount;
+
+/* For --memory-limit */
+static struct {
+	size_t limit;				/* 0 for no limit */
+	size_t tight;
+	size_t live;
+	size_t peak;
+} Memory;
+
+extern unsigned long getAllocationCount (void)
+{
+	return AllocationCount;
+}
+
+extern bool setMemoryLimit (size_t limit)
+{
+#ifdef HAVE_MALLOC_USABLE_SIZE
+	Memory.limit = limit;
+	Memory.tight = limit / 100 * MEMORY_TIGHT_PERCENT;
+	return true;
+#else
+	return limit == 0;
+#endif
+}
+
+extern bool isMemoryTight (void)
+{
+	return Memory.limit > 0 && Memory.live > Memory.tight;
+}
+
+extern size_t getMemoryAvailable (void)
+{
+	if (Memory.limit == 0)
+		return SIZE_MAX;
+	return (Memory.live < Memory.limit)? Memory.limit - Memory.live: 0;
+}
+
+extern size_t getMemoryPeak (void)
+{
+	return Memory.peak;
+}
+
+/* The blocks are counted only under --memory-limit; asking malloc
+ * for their sizes costs each allocation. The peak memory reported
+ * without the limit is taken from getrusage (). */
+#define isMemoryTracked() (Memory.limit > 0)
+
+/* oldSize is the size of the block passed to realloc (). */
+static void trackMemory (void *buffer, size_t oldSize)
+{
+#ifdef HAVE_MALLOC_USABLE_SIZE
+	if (!isMemoryTracked ())
+		return;
+
+	Memory.live -= (oldSize < Memory.live)? oldSize: Memory.live;
+	Memory.live += allocatedSize (buffer);
+	if (Memory.live > Memory.peak)
+		Memory.peak = Memory.live;
+#endif
+}
+
+static void trackFree (void *const ptr)
+{
+#ifdef HAVE_MALLOC_USABLE_SIZE
+	size_t size;
+
+	if (!isMemoryTracked ())
+		return;
+
+	size = allocatedSize (ptr);
+	Memory.live -= (size < Memory.live)? size: Memory.live;
+#endif
+}
+
+#ifdef ALLOC_STATS
+/* With ALLOC_STATS, the macros in routines.h pass the call site to
+ * e*At () functions. They store the site to AllocFile and AllocLine,
+ * and call the plain functions below where the allocation is counted.
+ * The call sites and the languages are stored in the tables allocated
+ * with malloc () directly; they must not be counted. */
+#undef eMalloc
+#undef eCalloc
+#undef eRealloc
+#undef eStrdup
+#undef eStrndup
+
+typedef struct sAllocSite {
+	const char *file;			/* NULL means an unused slot */
+	int line;
+	unsigned long count;
+	unsigned long long bytes;
+} allocSite;
+
+typedef struct sAllocCounter {
+	unsigned long count;
+	unsigned long long bytes;
+} allocCounter;
+
+static const char *AllocFile;
+static int AllocLine;
+
+static struct {
+	allocSite *sites;
+	unsigned int siteSize;		/* always a power of 2 */
+	unsigned int siteCount;
+
+	allocCounter *languages;	/* [language + 1]; 0 is for LANG_IGNORE */
+	unsigned int languageSize;
+	langType (* getLanguage) (void);
+
+	unsigned long reallocations;
+	unsigned long frees;
+	unsigned long long bytes;
+	unsigned long long live;
+	unsigned long long peak;
+} AllocStats;
+
+static unsigned int hashAllocSite (const char *file, int line)
+{
+	uintptr_t h = (uintptr_t) file;
+
+	h ^= h >> 7;
+	return (unsigned int) (h * 31 + (unsigned int) line);
+}
+
+static allocSite *findAllocSite (const char *file, int line)
+{
+	unsigned int i;
+
+	if (AllocStats.siteCount * 2 >= AllocStats.siteSize)
+	{
+		allocSite *old = AllocStats.sites;
+		unsigned int oldSize = AllocStats.siteSize;
+
+		AllocStats.siteSize = oldSize? oldSize * 2: 1024;
+		AllocStats.sites = calloc (AllocStats.siteSize, sizeof (allocSite));
+		if (AllocStats.sites == NULL)
+			error (FATAL, "out of memory");
+		for (i = 0; i < oldSize; i++)
+		{
+			if (old [i].file)
+			{
+				unsigned int j = hashAllocSite (old [i].file, old [i].line);
+				while (AllocStats.sites [j & (AllocStats.siteSize - 1)].file)
+					j++;
+				AllocStats.sites [j & (AllocStats.siteSize - 1)] = old [i];
+			}
+		}
+		free (old);
+	}
+
+	for (i = hashAllocSite (file, line);; i++)
+	{
+		allocSite *site = AllocStats.sites + (i & (AllocStats.siteSize - 1));
+
+		if (site->file == NULL)
+		{
+			site->file = file;
+			site->line = line;
+			AllocStats.siteCount++;
+			return site;
+		}
+		if (site->file == file && site->line == line)
+			return site;
+	}
+}
+
+static allocCounter *getLanguageAllocCounter (void)
+{
+	langType lang = AllocStats.getLanguage? AllocStats.getLanguage (): -1;
+	/* A negative value is LANG_IGNORE or LANG_AUTO: no parser is running. */
+	unsigned int index = (lang < 0)? 0: (unsigned int) lang + 1;
+
+	if (index >= AllocStats.languageSize)
+	{
+		unsigned int size = index + 64;
+		allocCounter *languages = realloc (AllocStats.languages,
+										   size * sizeof (allocCounter));
+		if (languages == NULL)
+			error (FATAL, "out of memory");
+		memset (languages + AllocStats.languageSize, 0,
+				(size - AllocStats.languageSize) * sizeof (allocCounter));
+		AllocStats.languages = languages;
+		AllocStats.languageSize = size;
+	}
+	return AllocStats.languages + index;
+}
+
+/* oldSize is the size of the block passed to realloc (). */
+static void countAllocation (size_t size, void *buffer, size_t oldSize)
+{
+	allocSite *site = findAllocSite (AllocFile? AllocFile: "(unknown)",
+									 AllocFile? AllocLine: 0);
+	allocCounter *language = getLanguageAllocCounter ();
+
+	AllocFile = NULL;
+
+	site->count++;
+	site->bytes += size;
+	language->count++;
+	language->bytes += size;
+	AllocStats.bytes += size;
+
+	AllocStats.live += allocatedSize (buffer);
+	AllocStats.live -= (oldSize < AllocStats.live)? oldSize: AllocStats.live;
+	if (AllocStats.live > AllocStats.peak)
+		AllocStats.peak = AllocStats.live;
+}
+
+static void countFree (void *const ptr)
+{
+	size_t size;
+
+	if (ptr == NULL)
+		return;
+
+	AllocStats.frees++;
+	size = allocatedSize (ptr);
+	AllocStats.live -= (size < AllocStats.live)? size: AllocStats.live;
+}
+
+extern void setAllocationLanguageFunc (langType (* getLanguage) (void))
+{
+	AllocStats.getLanguage = getLanguage;
+}
+
+static int compareAllocSites (const void *a, const void *b)
+{
+	const allocSite *sa = a;
+	const allocSite *sb = b;
+
+	if (sa->bytes != sb->bytes)
+		return (sa->bytes < sb->bytes)? 1: -1;
+	if (sa->count != sb->count)
+		return (sa->count < sb->count)? 1: -1;
+	return 0;
+}
+
+extern void printAllocationStats (FILE *fp, unsigned int topSites,
+								  const char *(* languageName) (langType))
+{
+	allocSite *sites;
+	unsigned int count = 0;
+
+	fprintf (fp, "ALLOCATIONS:\n");
+	fprintf (fp, "  allocations: %lu\n", AllocationCount);
+	fprintf (fp, "  reallocations: %lu\n", AllocStats.reallocations);
+	fprintf (fp, "  frees: %lu\n", AllocStats.frees);
+	fprintf (fp, "  bytes: %llu\n", AllocStats.bytes);
+#ifdef HAVE_MALLOC_USABLE_SIZE
+	fprintf (fp, "  live at exit: %llu\n", AllocStats.live);
+	fprintf (fp, "  peak live: %llu\n", AllocStats.peak);
+#endif
+
+	fprintf (fp, "ALLOCATIONS BY LANGUAGE:\n");
+	for (unsigned int i = 0; i < AllocStats.languageSize; i++)
+	{
+		const allocCounter *c = AllocStats.languages + i;
+		if (c->count == 0)
+			continue;
+		fprintf (fp, "  %-20s %10lu %14llu\n",
+				 i == 0? "(none)": languageName ((langType) i - 1),
+				 c->count, c->bytes);
+	}
+
+	sites = malloc ((AllocStats.siteCount? AllocStats.siteCount: 1) * sizeof (allocSite));
+	if (sites == NULL)
+		return;
+	for (unsigned int i = 0; i < AllocStats.siteSize; i++)
+		if (AllocStats.sites [i].file)
+			sites [count++] = AllocStats.sites [i];
+	qsort (sites, count, sizeof (allocSite), compareAllocSites);
+
+	fprintf (fp, "ALLOCATIONS BY CALL SITE (top %u of %u):\n",
+			 topSites < count? topSites: count, count);
+	for (unsigned int i = 0; i < count && i < topSites; i++)
+		fprintf (fp, "  %10lu %14llu  %s:%d\n",
+				 sites [i].count, sites [i].bytes, sites [i].file, sites [i].line);
+	free (sites);
+}
+
+extern void *eMallocAt (const size_t size, const char *file, int line)
+{
+	AllocFile = file;
+	AllocLine = line;
+	return eMalloc (size);
+}
+
+extern void *eCallocAt (const size_t count, const size_t size, const char *file, int line)
+{
+	AllocFile = file;
+	AllocLine = line;
+	return eCalloc (count, size);
+}
+
+extern void *eReallocAt (void *const ptr, const size_t size, const char *file, int line)
+{
+	AllocFile = file;
+	AllocLine = line;
+	return eRealloc (ptr, size);
+}
+
+extern char *eStrdupAt (const char* str, const char *file, int line)
+{
+	AllocFile = file;
+	AllocLine = line;
+	return eStrdup (str);
+}
+
+extern char *eStrndupAt (const char* str, size_t len, const char *file, int line)
+{
+	AllocFile = file;
+	AllocLine = line;
+	return eStrndup (str, len);
+}
+#endif	/* ALLOC_STATS */
+
 extern void *eMalloc (const size_t size)
 {
 	void *buffer = malloc (size);
 
+	AllocationCount++;
+
 	if (buffer == NULL && size != 0)
 		error (FATAL, "out of memory");
 
+	trackMemory (buffer, 0);
+#ifdef ALLOC_STATS
+	countAllocation (size, buffer, 0);
+#endif
 	return buffer;
 }
 
@@ -229,9 +565,15 @@ extern void *eCalloc (const size_t count, const size_t size)
 {
 	void *buffer = calloc (count, size);
 
+	AllocationCount++;
+
 	if (buffer == NULL && count != 0 && size != 0)
 		error (FATAL, "out of memory");
 
+	trackMemory (buffer, 0);
+#ifdef ALLOC_STATS
+	countAllocation (count * size, buffer, 0);
+#endif
 	return buffer;
 }
 
@@ -242,9 +584,21 @@ extern void *eRealloc (void *const ptr, const size_t size)
 		buffer = eMalloc (size);
 	else
 	{
+#ifdef ALLOC_STATS
+		const size_t oldSize = allocatedSize (ptr);
+#else
+		const size_t oldSize = isMemoryTracked ()? allocatedSize (ptr): 0;
+#endif
+
+		AllocationCount++;
 		buffer = realloc (ptr, size);
 		if (buffer == NULL && size != 0)
 			error (FATAL, "out of memory");
+		trackMemory (buffer, oldSize);
+#ifdef ALLOC_STATS
+		AllocStats.reallocations++;
+		countAllocation (size, buffer, oldSize);
+#endif
 	}
 	return buffer;
 }
@@ -252,11 +606,19 @@ extern void *eRealloc (void *const ptr, const size_t size)
 extern void eFree (void *const ptr)
 {
 	Assert (ptr != NULL);
+	trackFree (ptr);
+#ifdef ALLOC_STATS
+	countFree (ptr);
+#endif
 	free (ptr);
 }
 
 extern void eFreeNoNullCheck (void *const ptr)
 {
+	trackFree (ptr);
+#ifdef ALLOC_STATS
+	countFree (ptr);
+#endif
 	free (ptr);
 }
 
@@ -521,7 +883,7 @@ extern bool isRecursiveLink (const char* const dirName)
  *  Pathname manipulation (O/S dependent!!!)
  */
 
-static bool isPathSeparator (const int c)
+extern bool isPathSeparator (const int c)
 {
 	bool result;
 #if defined (MSDOS_STYLE_PATH)
@@ -947,3 +1309,61 @@ extern MIO *tempFile (const char *const mode, char **const pName)
 	FILE *fp = tempFileFP (mode, pName);
 	return mio_new_fp (fp, fclose);
 }
+
+/*  FNV-1a hash of SIZE bytes at DATA following the bytes hashed into HASH.
+ *  Pass FNV1A_INITIAL_HASH as HASH to start.
+ */
+extern uint64_t hashBytes (uint64_t hash, const void *const data, size_t size)
+{
+	const unsigned char *p = data;
+
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= p [i];
+		hash *= UINT64_C(1099511628211);
+	}
+	return hash;
+}
+
+/*  FNV-1a hash of the contents of FILENAME.
+ *  Returns 0 if the file cannot be read.
+ */
+extern uint64_t hashFileContents (const char *const fileName)
+{
+	MIO *mio = mio_new_file (fileName, "rb");
+	uint64_t hash;
+
+	if (mio == NULL)
+		return 0;
+
+	hash = hashMioContents (mio);
+	mio_unref (mio);
+	return hash;
+}
+
+/*  Same as hashFileContents() but for the whole contents of MIO.
+ *  MIO is rewound after reading.
+ */
+extern uint64_t hashMioContents (MIO *mio)
+{
+	enum { BufferSize = 8192 };
+	unsigned char buffer [BufferSize];
+	uint64_t hash = FNV1A_INITIAL_HASH;
+	unsigned char *data;
+	size_t n;
+
+	data = mio_memory_get_data (mio, &n);
+	if (data)
+		hash = hashBytes (hash, data, n);
+	else
+	{
+		mio_rewind (mio);
+		while ((n = mio_read (mio, buffer, 1, BufferSize)) > 0)
+			hash = hashBytes (hash, buffer, n);
+		bool failed = mio_error (mio);
+		mio_rewind (mio);
+		if (failed)
+			return 0;
+	}
+	return hash? hash: 1;
+}
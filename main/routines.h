@@ -14,6 +14,7 @@
 */
 #include "general.h"  /* must always come first */
 
+#include <stdint.h>
 #include <stdio.h>
 
 
@@ -60,6 +61,20 @@ extern int strnuppercmp (const char *s1, const char *s2, size_t n);
 extern char* strrstr (const char *str, const char *substr);
 extern char* eStrdup (const char* str);
 extern char* eStrndup (const char* str, size_t len);
+#ifdef ALLOC_STATS
+/* With "./configure --enable-alloc-stats", the allocations are counted
+ * for each call site. See printAllocationStats () in routines_p.h. */
+extern void *eMallocAt (const size_t size, const char *file, int line);
+extern void *eCallocAt (const size_t count, const size_t size, const char *file, int line);
+extern void *eReallocAt (void *const ptr, const size_t size, const char *file, int line);
+extern char *eStrdupAt (const char* str, const char *file, int line);
+extern char *eStrndupAt (const char* str, size_t len, const char *file, int line);
+#define eMalloc(size)       eMallocAt ((size), __FILE__, __LINE__)
+#define eCalloc(count,size) eCallocAt ((count), (size), __FILE__, __LINE__)
+#define eRealloc(ptr,size)  eReallocAt ((ptr), (size), __FILE__, __LINE__)
+#define eStrdup(str)        eStrdupAt ((str), __FILE__, __LINE__)
+#define eStrndup(str,len)   eStrndupAt ((str), (len), __FILE__, __LINE__)
+#endif
 extern void toLowerString (char* str);
 extern void toUpperString (char* str);
 extern char* newLowerString (const char* str);
@@ -75,4 +90,7 @@ extern const char *fileExtension (const char *const fileName);
 
 extern FILE *tempFileFP (const char *const mode, char **const pName);
 
+#define FNV1A_INITIAL_HASH UINT64_C(14695981039346656037)
+extern uint64_t hashBytes (uint64_t hash, const void *const data, size_t size);
+
 #endif  /* CTAGS_MAIN_ROUTINES_H */
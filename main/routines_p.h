@@ -13,7 +13,10 @@
 *   INCLUDE FILES
 */
 #include "general.h"  /* must always come first */
+#include <stdint.h>
+#include <stdio.h>
 #include "mio.h"
+#include "types.h"
 #include "portable-dirent_p.h"
 
 /*
@@ -77,6 +80,25 @@ typedef struct {
 *   FUNCTION PROTOTYPES
 */
 extern void freeRoutineResources (void);
+
+/* The number of calls of eMalloc(), eCalloc(), and eRealloc(). */
+extern unsigned long getAllocationCount (void);
+
+/* --memory-limit: LIMIT applies to the bytes of the blocks allocated with
+ * eMalloc() and its family, and not freed yet; 0 for no limit. Return
+ * false if they cannot be counted on the platform. */
+extern bool setMemoryLimit (size_t limit);
+/* Whether the bytes counted are getting near the limit; the subsystems
+ * switch to their low-memory modes then. */
+extern bool isMemoryTight (void);
+/* The bytes left under the limit, or SIZE_MAX without a limit. */
+extern size_t getMemoryAvailable (void);
+extern size_t getMemoryPeak (void);
+#ifdef ALLOC_STATS
+extern void setAllocationLanguageFunc (langType (* getLanguage) (void));
+extern void printAllocationStats (FILE *fp, unsigned int topSites,
+								  const char *(* languageName) (langType));
+#endif
 extern void setExecutableName (const char *const path);
 
 /* File system functions */
@@ -89,6 +111,7 @@ extern bool doesFileExist (const char *const fileName);
 extern bool doesExecutableExist (const char *const fileName);
 extern bool isRecursiveLink (const char* const dirName);
 extern bool isSameFile (const char *const name1, const char *const name2);
+extern bool isPathSeparator (const int c);
 extern bool isAbsolutePath (const char *const path);
 extern char *combinePathAndFile (const char *const path, const char *const file);
 extern char* absoluteFilename (const char *file);
@@ -98,4 +121,7 @@ extern MIO *tempFile (const char *const mode, char **const pName);
 
 extern char* baseFilenameSansExtensionNew (const char *const fileName, const char *const templateExt);
 
+extern uint64_t hashFileContents (const char *const fileName);
+extern uint64_t hashMioContents (MIO *mio);
+
 #endif  /* CTAGS_MAIN_ROUTINES_PRIVATE_H */
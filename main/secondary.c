@@ -0,0 +1,312 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for writing the sidecar secondary index
+*   of a tag file (--secondary-index).
+*
+*   The index maps each input file and each scope to the offsets of the
+*   lines of the tags in it, so that a reader can list the tags of a file
+*   or the members of a class without reading the whole tag file, which
+*   is sorted by name.
+*
+*   The index is a text file:
+*
+*     !_CTAGS_SECONDARY_INDEX	1	<tag file size>	<inputs>	<scopes>
+*     I	<input field>	<offset> <delta> <delta>...    ... one line per input
+*     S	<scope>	<offset> <delta> <delta>...    ... one line per scope
+*
+*   The keys are written as they appear in the tag file: an input field
+*   is the second column of a tag line, and a scope is the value of a
+*   scope field, "<kind>:<name>". The lines of each type are sorted by
+*   their keys. A posting list has the offset of the first line followed
+*   by the differences between the following offsets.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "field_p.h"
+#include "htable.h"
+#include "mio.h"
+#include "options.h"
+#include "parse_p.h"
+#include "ptag_p.h"
+#include "ptrarray.h"
+#include "read.h"
+#include "routines.h"
+#include "secondary_p.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define SECONDARY_INDEX_SUFFIX ".secondary"
+#define SECONDARY_INDEX_HEADER "!_CTAGS_SECONDARY_INDEX\t1"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sSecondaryPosting {
+	char *key;					/* the key in the table */
+	unsigned long lastOffset;
+	vString *offsets;			/* the posting list in the file format */
+} secondaryPosting;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deletePosting (void *data)
+{
+	secondaryPosting *posting = data;
+
+	vStringDelete (posting->offsets);
+	eFree (posting->key);
+	eFree (posting);
+}
+
+static void addPosting (hashTable *table, const char *key, size_t length,
+						unsigned long offset)
+{
+	char *k = eStrndup (key, length);
+	secondaryPosting *posting = hashTableGetItem (table, k);
+	char buffer [32];
+
+	if (posting == NULL)
+	{
+		posting = xMalloc (1, secondaryPosting);
+		posting->key = k;
+		posting->offsets = vStringNew ();
+		snprintf (buffer, sizeof (buffer), "%lu", offset);
+		hashTablePutItem (table, posting->key, posting);
+	}
+	else
+	{
+		eFree (k);
+		snprintf (buffer, sizeof (buffer), " %lu", offset - posting->lastOffset);
+	}
+	vStringCatS (posting->offsets, buffer);
+	posting->lastOffset = offset;
+}
+
+/* Skip the address of a tag line, returning the head of the extension
+ * fields, or NULL if the line has none. A delimiter of a pattern is
+ * skipped with the characters of the pattern, which may contain ;" */
+static const char *skipAddress (const char *p)
+{
+	while (*p != '\0' && *p != '\n' && *p != '\r')
+	{
+		if (*p == '/' || *p == '?')
+		{
+			const char delimiter = *p++;
+
+			for (; *p != '\0' && *p != delimiter; p++)
+			{
+				if (*p == '\\' && p [1] != '\0')
+					p++;
+			}
+			if (*p == '\0')
+				return NULL;
+			p++;
+		}
+		else if (p [0] == ';' && p [1] == '"')
+			return (p [2] == '\t')? p + 3: NULL;
+		else
+			p++;
+	}
+	return NULL;
+}
+
+static bool isFieldKey (const char *field, size_t length, const char *name)
+{
+	return name != NULL && strlen (name) == length && strncmp (field, name, length) == 0;
+}
+
+/* Find the scope of a tag from its extension fields FIELDS. A scope is
+ * written as "scope:<kind>:<name>" with the scope key enabled, or else
+ * as "<kind>:<name>" where <kind> is not a name of a field. */
+static const char *findScope (const char *fields, hashTable *fieldNames,
+							  vString *key, size_t *length)
+{
+	const char *const kindKey = getFieldName (FIELD_KIND_KEY);
+	const char *const lineKey = getFieldName (FIELD_LINE_NUMBER);
+	const char *const languageKey = getFieldName (FIELD_LANGUAGE);
+	const char *const scopeKey = getFieldName (FIELD_SCOPE_KEY);
+	const char *field = fields;
+
+	while (field != NULL && *field != '\0')
+	{
+		const size_t fieldLength = strcspn (field, "\t\r\n");
+		const char *colon = memchr (field, ':', fieldLength);
+		const char *next = (field [fieldLength] == '\t')? field + fieldLength + 1: NULL;
+		size_t keyLength;
+
+		if (colon == NULL)		/* the kind without its key */
+		{
+			field = next;
+			continue;
+		}
+		keyLength = colon - field;
+		if (isFieldKey (field, keyLength, kindKey)
+			|| isFieldKey (field, keyLength, lineKey)
+			|| isFieldKey (field, keyLength, languageKey))
+		{
+			field = next;
+			continue;
+		}
+		if (isFieldKey (field, keyLength, scopeKey))
+		{
+			*length = fieldLength - keyLength - 1;
+			return colon + 1;
+		}
+
+		/* The scope comes before the other fields. */
+		vStringNCopyS (key, field, keyLength);
+		if (hashTableHasItem (fieldNames, vStringValue (key)))
+			return NULL;
+		*length = fieldLength;
+		return field;
+	}
+	return NULL;
+}
+
+static hashTable *makeFieldNameTable (void)
+{
+	hashTable *fieldNames = hashTableNew (64, hashCstrhash, hashCstreq, NULL, NULL);
+
+	/* The fields of a parser are defined when it is initialized. */
+	initializeParser (LANG_AUTO);
+	for (unsigned int i = 0; i < countFields (); i++)
+	{
+		const char *name = getFieldName (i);
+
+		if (name != NULL && ! hashTableHasItem (fieldNames, name))
+			hashTablePutItem (fieldNames, (void *) name, (void *) name);
+	}
+	return fieldNames;
+}
+
+static bool collectPosting (const void *key CTAGS_ATTR_UNUSED, void *value,
+							void *user_data)
+{
+	ptrArrayAdd (user_data, value);
+	return true;
+}
+
+static int comparePostings (const void *a, const void *b)
+{
+	const secondaryPosting *pa = a;
+	const secondaryPosting *pb = b;
+
+	return strcmp (pa->key, pb->key);
+}
+
+static ptrArray *sortPostings (hashTable *table)
+{
+	ptrArray *postings = ptrArrayNew (NULL);
+
+	hashTableForeachItem (table, collectPosting, postings);
+	ptrArraySort (postings, comparePostings);
+	return postings;
+}
+
+static void writePostings (MIO *index, char type, ptrArray *postings)
+{
+	for (unsigned int i = 0; i < ptrArrayCount (postings); i++)
+	{
+		const secondaryPosting *posting = ptrArrayItem (postings, i);
+		mio_printf (index, "%c\t%s\t%s\n", type, posting->key,
+					vStringValue (posting->offsets));
+	}
+}
+
+extern void writeSecondaryIndex (const char *const tagFileName)
+{
+	vString *indexName = vStringNewInit (tagFileName);
+	vString *vLine = vStringNew ();
+	vString *key = vStringNew ();
+	hashTable *inputTable = hashTableNew (256, hashCstrhash, hashCstreq,
+										  NULL, deletePosting);
+	hashTable *scopeTable = hashTableNew (1024, hashCstrhash, hashCstreq,
+										  NULL, deletePosting);
+	hashTable *fieldNames = makeFieldNameTable ();
+	ptrArray *inputs, *scopes;
+	bool inPseudoTags = true;
+	long size;
+	MIO *tags, *index;
+
+	vStringCatS (indexName, SECONDARY_INDEX_SUFFIX);
+
+	tags = mio_new_file (tagFileName, "r");
+	if (tags == NULL)
+		error (FATAL | PERROR, "cannot open tag file \"%s\"", tagFileName);
+	mio_seek (tags, 0L, SEEK_END);
+	size = mio_tell (tags);
+	mio_seek (tags, 0L, SEEK_SET);
+
+	while (true)
+	{
+		const long offset = mio_tell (tags);
+		const char *line = readLineRaw (vLine, tags);
+		const char *input, *scope;
+		size_t length;
+
+		if (line == NULL)
+			break;
+		if (inPseudoTags
+			&& strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+			continue;
+		inPseudoTags = false;
+
+		input = strchr (line, '\t');
+		if (input == NULL)
+			continue;
+		input++;
+		length = strcspn (input, "\t\r\n");
+		if (input [length] != '\t')
+			continue;
+		addPosting (inputTable, input, length, (unsigned long) offset);
+
+		scope = findScope (skipAddress (input + length + 1), fieldNames, key, &length);
+		if (scope != NULL && length > 0)
+			addPosting (scopeTable, scope, length, (unsigned long) offset);
+	}
+	if (mio_error (tags))
+		error (FATAL | PERROR, "cannot read tag file \"%s\"", tagFileName);
+	mio_unref (tags);
+
+	inputs = sortPostings (inputTable);
+	scopes = sortPostings (scopeTable);
+
+	index = mio_new_file (vStringValue (indexName), "w");
+	if (index == NULL)
+		error (FATAL | PERROR, "cannot open secondary index \"%s\"", vStringValue (indexName));
+	mio_printf (index, SECONDARY_INDEX_HEADER "\t%ld\t%u\t%u\n",
+				size, ptrArrayCount (inputs), ptrArrayCount (scopes));
+	writePostings (index, 'I', inputs);
+	writePostings (index, 'S', scopes);
+	if (mio_unref (index) != 0)
+		error (FATAL | PERROR, "cannot write secondary index \"%s\"", vStringValue (indexName));
+
+	verbose ("wrote %u inputs and %u scopes to %s\n",
+			 ptrArrayCount (inputs), ptrArrayCount (scopes), vStringValue (indexName));
+
+	ptrArrayDelete (scopes);
+	ptrArrayDelete (inputs);
+	hashTableDelete (fieldNames);
+	hashTableDelete (scopeTable);
+	hashTableDelete (inputTable);
+	vStringDelete (key);
+	vStringDelete (vLine);
+	vStringDelete (indexName);
+}
@@ -10,12 +10,13 @@
 #include "general.h"
 
 #include <ctype.h>
+#include <limits.h>
 #include <stdio.h>
 #include <string.h>
 
 #include "debug.h"
 #include "parse_p.h"
-#include "options.h"
+#include "options_p.h"
 #include "selectors.h"
 #include "vstring.h"
 #include "mio.h"
@@ -421,6 +422,7 @@ selectVOrVerilogByKeywords (MIO *input,
 
 #ifdef HAVE_LIBXML
 #include <libxml/parser.h>
+#include <libxml/xmlreader.h>
 #include <libxml/xpath.h>
 #include <libxml/tree.h>
 
@@ -442,6 +444,38 @@ xmlParseMIO (MIO *input)
 	return xmlParseMemory((const char *)buf, len);
 }
 
+/* For a large input, read INPUT only up to the start tag of the root
+ * element. The returned document, owned by *READER, has the DTD and
+ * the root element without its children. */
+static xmlDocPtr
+xmlReadPrologMIO (MIO *input, xmlTextReaderPtr *reader)
+{
+	const unsigned char *buf;
+	size_t len;
+
+	buf = mio_memory_get_data (input, &len);
+	Assert (buf);
+	if (len > INT_MAX)
+		return NULL;
+
+	xmlSetGenericErrorFunc (NULL, suppressWarning);
+	xmlLineNumbersDefault (1);
+	*reader = xmlReaderForMemory ((const char *)buf, (int)len, NULL, NULL,
+								  XML_PARSE_NOERROR | XML_PARSE_NOWARNING);
+	if (*reader == NULL)
+		return NULL;
+
+	while (xmlTextReaderRead (*reader) == 1)
+	{
+		if (xmlTextReaderNodeType (*reader) == XML_READER_TYPE_ELEMENT)
+			return xmlTextReaderCurrentNode (*reader)->doc;
+	}
+
+	xmlFreeTextReader (*reader);
+	*reader = NULL;
+	return NULL;
+}
+
 static bool
 matchXpathFileSpec (xmlDocPtr doc, xpathFileSpec *spec)
 {
@@ -613,6 +647,22 @@ selectByXpathFileSpec (MIO *input,
 {
 	xmlDocPtr doc;
 	const char *r = NULL;
+	size_t len;
+
+	mio_memory_get_data (input, &len);
+	if (len >= Option.xmlStreamThreshold)
+	{
+		/* The parser chosen reads the input in the streaming mode
+		 * instead of reusing a document. */
+		xmlTextReaderPtr reader = NULL;
+
+		doc = xmlReadPrologMIO (input, &reader);
+		if (doc)
+			r = selectParserForXmlDoc (doc, candidates, nCandidates);
+		if (reader)
+			xmlFreeTextReader (reader);
+		return r;
+	}
 
 	doc = xmlParseMIO (input);
 	if (doc == NULL)
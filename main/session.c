@@ -0,0 +1,210 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines the interface for running the parsers in a program linking
+*   libctags.a. A session installs a custom tag writer handing each tag to
+*   the callback of the client, so no tag is formatted as text.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "debug.h"
+#include "entry_p.h"
+#include "error_p.h"
+#include "field_p.h"
+#include "lregex_p.h"
+#include "options_p.h"
+#include "parse_p.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "session.h"
+#include "stats_p.h"
+#include "trashbox_p.h"
+#include "writer_p.h"
+#include "xtag_p.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+struct sCtagsSession {
+	ctagsSessionCallbacks callbacks;
+	void *data;
+
+	/* The number of tags counted before parsing the current input */
+	unsigned long tagsBase;
+};
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+static int writeSessionEntry (tagWriter *writer, MIO *mio,
+							  const tagEntryInfo *const tag, void *clientData);
+static void rescanFailedSessionEntry (tagWriter *writer, unsigned long validTagNum,
+									  void *clientData);
+
+/*
+*   DATA DEFINITIONS
+*/
+static tagWriter sessionWriter = {
+	.writeEntry = writeSessionEntry,
+	.writePtagEntry = NULL,
+	.preWriteEntry = NULL,
+	.postWriteEntry = NULL,
+	.rescanFailedEntry = rescanFailedSessionEntry,
+	.treatFieldAsFixed = NULL,
+	.defaultFileName = "-",
+};
+
+static bool SessionInitialized;
+static ctagsSession *CurrentSession;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+static int writeSessionEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+							  MIO *mio CTAGS_ATTR_UNUSED,
+							  const tagEntryInfo *const tag, void *clientData)
+{
+	ctagsSession *session = clientData;
+
+	/* const is discarded to fill the scope fields of TAG. */
+	getTagScopeInformation ((tagEntryInfo *)tag, NULL, NULL);
+	session->callbacks.tag (tag, session->data);
+
+	/* Nothing is written to MIO, but the tag must be counted for
+	 * rescanFailedSessionEntry (). */
+	return 1;
+}
+
+static void rescanFailedSessionEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+									  unsigned long validTagNum, void *clientData)
+{
+	ctagsSession *session = clientData;
+
+	if (session->callbacks.rescan)
+		session->callbacks.rescan (validTagNum - session->tagsBase,
+								   session->data);
+}
+
+CTAGS_ATTR_PRINTF(2, 0)
+static bool sessionErrorPrinter (const errorSelection selection,
+								 const char *const format,
+								 va_list ap, void *data CTAGS_ATTR_UNUSED)
+{
+	/* A parser reporting a fatal error must not exit the client. */
+	stderrDefaultErrorPrinter (selection & ~FATAL, format, ap, NULL);
+	return false;
+}
+
+static void initializeSession (void)
+{
+	initDefaultTrashBox ();
+
+	setExecutableName ("ctags");
+	checkRegex ();
+	initFieldObjects ();
+	initXtagObjects ();
+
+	initializeParsing ();
+	initOptions ();
+	initRegexOptscript ();
+
+	SessionInitialized = true;
+}
+
+static bool applySessionOptions (const char *const *options)
+{
+	cookedArgs *args;
+	bool r;
+
+	if (options == NULL)
+		return true;
+
+	args = cArgNewFromArgv ((char *const *)options);
+	parseCmdlineOptions (args);
+	r = cArgOff (args);
+	cArgDelete (args);
+
+	return r;
+}
+
+extern ctagsSession *ctagsSessionNew (const char *const *options,
+									  const ctagsSessionCallbacks *callbacks,
+									  void *data)
+{
+	ctagsSession *session;
+
+	Assert (callbacks && callbacks->tag);
+	Assert (CurrentSession == NULL);
+
+	if (!SessionInitialized)
+		initializeSession ();
+
+	/* An error in an option is fatal like in the ctags command. */
+	setErrorPrinter (stderrDefaultErrorPrinter, NULL);
+	if (!applySessionOptions (options))
+		return NULL;
+
+	/* --output-format and the like may have changed the writer. */
+	setTagWriter (WRITER_CUSTOM, &sessionWriter);
+	setErrorPrinter (sessionErrorPrinter, NULL);
+
+	session = xCalloc (1, ctagsSession);
+	session->callbacks = *callbacks;
+	session->data = data;
+	CurrentSession = session;
+
+	return session;
+}
+
+extern bool ctagsSessionParse (ctagsSession *session, const char *fileName,
+							   const unsigned char *buffer, size_t size,
+							   const char *language)
+{
+	Assert (session == CurrentSession);
+
+	session->tagsBase = numTagsAdded ();
+
+	if (language)
+	{
+		langType lang = getNamedLanguage (language, 0);
+
+		if (lang == LANG_IGNORE || !isLanguageEnabled (lang))
+			return false;
+		parseRawBuffer (fileName, (unsigned char *)buffer, size, lang, session);
+		return true;
+	}
+	else
+	{
+		MIO *mio = NULL;
+		long files0, files, lines, bytes;
+
+		if (buffer)
+			mio = mio_new_memory ((unsigned char *)buffer, size, NULL, NULL);
+
+		/* parseFileWithMio () counts the input only if a parser runs. */
+		getTotals (&files0, &lines, &bytes);
+		parseFileWithMio (fileName, mio, session);
+		getTotals (&files, &lines, &bytes);
+
+		if (mio)
+			mio_unref (mio);
+		return (files > files0);
+	}
+}
+
+extern void ctagsSessionDelete (ctagsSession *session)
+{
+	Assert (session == CurrentSession);
+
+	CurrentSession = NULL;
+	eFree (session);
+}
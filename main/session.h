@@ -0,0 +1,69 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines the interface for running the parsers in a program linking
+*   libctags.a.
+*/
+#ifndef CTAGS_MAIN_SESSION_H
+#define CTAGS_MAIN_SESSION_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "entry.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sCtagsSession ctagsSession;
+
+typedef struct sCtagsSessionCallbacks {
+	/* Called for each tag. TAG and the strings it points to are valid
+	 * only during the call; the scope fields are filled. */
+	void (* tag) (const tagEntryInfo *const tag, void *data);
+
+	/* Called when a parser gives up its first try and parses the input
+	 * again. Only the first VALIDTAGS tags delivered for the current
+	 * input are valid; the client must drop the rest. Can be NULL if
+	 * the client doesn't use a parser doing so (e.g. C and C++). */
+	void (* rescan) (unsigned long validTags, void *data);
+} ctagsSessionCallbacks;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Create a session delivering tags to CALLBACKS with DATA.
+ *
+ * OPTIONS is a NULL terminated array of command line options like
+ * "--kinds-C=+l" or "--fields=+S", applied in order; it can be NULL.
+ * No option file is read. Options about the tag file and its format are
+ * ignored. NULL is returned if OPTIONS has a non-option argument.
+ *
+ * The parsers are initialized by the first session, and kept for the
+ * later sessions. The parsers, the options, and the parser parameters
+ * are shared in the process, so at most one session can exist at a
+ * time, and the options of a session stay effective in the following
+ * sessions. */
+extern ctagsSession *ctagsSessionNew (const char *const *options,
+									  const ctagsSessionCallbacks *callbacks,
+									  void *data);
+
+/* Parse SIZE bytes at BUFFER as the contents of FILENAME, or the file
+ * itself if BUFFER is NULL. LANGUAGE is the name of a parser; if it is
+ * NULL, the parser is chosen from FILENAME and the contents in the way
+ * the ctags command does.
+ *
+ * Return false if no parser runs for the input. */
+extern bool ctagsSessionParse (ctagsSession *session, const char *fileName,
+							   const unsigned char *buffer, size_t size,
+							   const char *language);
+
+extern void ctagsSessionDelete (ctagsSession *session);
+
+#endif	/* CTAGS_MAIN_SESSION_H */
@@ -0,0 +1,401 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for dividing the input files into
+*   shards tagged separately (--shard), and for merging the sorted tag
+*   files made for the shards into one (--merge).
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "debug.h"
+#include "entry_p.h"
+#include "error_p.h"
+#include "htable.h"
+#include "options_p.h"
+#include "ptag_p.h"
+#include "read.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "shard_p.h"
+#include "sort_p.h"
+#include "strlist.h"
+#include "vstring.h"
+
+/*
+*   DATA DEFINITIONS
+*/
+
+/* The pseudo tags having one value in a tag file, like TAG_FILE_SORTED:
+ * name -> the line taken from the first tag file having it. */
+static hashTable *SingleValuedPtags;
+
+/* With --tag-relative other than "no", the relative input fields of a
+ * tag file are taken as relative to the directory of the tag file, and
+ * rewritten for the directory of the merged tag file. */
+typedef struct sRebase {
+	char *directory;			/* absolute, ending with a separator; NULL
+								 * if the input fields are kept */
+	hashTable *inputFields;		/* input field -> rewritten one */
+} tagFileRebase;
+
+static tagFileRebase *Rebases;			/* for each tag file merged */
+static char *OutputDirectory;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+/*  The path is hashed as written in the tag file relative to the
+ *  current directory: "./" at the head is skipped, and backslashes are
+ *  taken as slashes, so "./src\a.c" and "src/a.c" are in the same shard.
+ */
+extern bool isInputFileInShard (const char *const fileName)
+{
+	const char *p = fileName;
+	uint64_t hash = FNV1A_INITIAL_HASH;
+
+	if (Option.shardCount == 0)
+		return true;
+
+	while (p [0] == '.' && (p [1] == '/' || p [1] == '\\'))
+	{
+		p += 2;
+		while (*p == '/' || *p == '\\')
+			p++;
+	}
+	for (; *p != '\0'; p++)
+	{
+		const char c = (*p == '\\')? '/': *p;
+		hash = hashBytes (hash, &c, 1);
+	}
+
+	return (hash % Option.shardCount) == Option.shardIndex - 1;
+}
+
+#ifndef EXTERNAL_SORT
+/*  Store the name of the pseudo tag LINE, without the prefix, to NAME.
+ *  Return false if LINE is not a pseudo tag.
+ */
+static bool getPseudoTagName (const char *const line, vString *name)
+{
+	const size_t prefixLength = strlen (PSEUDO_TAG_PREFIX);
+	const char *tab;
+
+	if (strncmp (line, PSEUDO_TAG_PREFIX, prefixLength) != 0)
+		return false;
+
+	tab = strchr (line + prefixLength, '\t');
+	if (tab == NULL)
+		return false;
+
+	vStringNCopyS (name, line + prefixLength, tab - (line + prefixLength));
+	return true;
+}
+
+static bool isSingleValuedPtag (const char *const name)
+{
+	ptagType type;
+
+	/* "TAG_KIND_DESCRIPTION!C" and the like are made for each parser. */
+	if (strstr (name, PSEUDO_TAG_SEPARATOR))
+		return false;
+
+	type = getPtagTypeForName (name);
+	return type != PTAG_UNKNOWN
+		&& isPtagCommonInParsers (type) && !isPtagParserSpecific (type);
+}
+
+static bool dropSingleValuedPtag (const char *const line)
+{
+	static vString *name;
+	bool r;
+
+	if (name == NULL)
+		name = vStringNew ();
+
+	r = getPseudoTagName (line, name)
+		&& hashTableHasItem (SingleValuedPtags, vStringValue (name));
+	vStringClear (name);
+	return r;
+}
+
+/*  Read the pseudo tags at the head of the tag file MIO, and rewind it.
+ *  The lines of the single-valued pseudo tags not seen in the former tag
+ *  files are stored. The value of TAG_FILE_SORTED is stored to *SORTED,
+ *  or -1 if the tag file doesn't have it. Whether the tag file has
+ *  TAG_INPUT_FILE_ID is stored to *USESIDS.
+ */
+static void scanPseudoTags (MIO *mio, const char *const fileName, int *sorted,
+							bool *usesIds)
+{
+	vString *line = vStringNew ();
+	vString *name = vStringNew ();
+
+	*sorted = -1;
+	*usesIds = false;
+	while (readLineRaw (line, mio) != NULL)
+	{
+		const char *known;
+
+		vStringStripNewline (line);
+		if (! getPseudoTagName (vStringValue (line), name))
+			break;
+		if (strcmp (vStringValue (name), "TAG_INPUT_FILE_ID") == 0)
+			*usesIds = true;
+		if (! isSingleValuedPtag (vStringValue (name)))
+			continue;
+
+		if (strcmp (vStringValue (name), "TAG_FILE_SORTED") == 0)
+			*sorted = vStringChar (line, vStringLength (name)
+								   + strlen (PSEUDO_TAG_PREFIX) + 1) - '0';
+
+		known = hashTableGetItem (SingleValuedPtags, vStringValue (name));
+		if (known == NULL)
+			hashTablePutItem (SingleValuedPtags, vStringStrdup (name),
+							  vStringStrdup (line));
+		else if (strcmp (known, vStringValue (line)) != 0)
+			verbose ("%s: ignoring %s different from the former tag files\n",
+					 fileName, vStringValue (name));
+	}
+	if (mio_error (mio))
+		error (FATAL | PERROR, "cannot read tag file \"%s\"", fileName);
+	mio_rewind (mio);
+
+	vStringDelete (name);
+	vStringDelete (line);
+}
+
+static char *rebaseInputField (const char *const directory,
+								const char *const inputField)
+{
+	char *path, *r;
+
+	if (isAbsolutePath (inputField))
+	{
+		if (Option.tagRelative == TREL_YES)
+			return eStrdup (inputField);
+		path = absoluteFilename (inputField);
+	}
+	else
+	{
+		char *combined = combinePathAndFile (directory, inputField);
+		path = absoluteFilename (combined);
+		eFree (combined);
+	}
+
+	if (Option.tagRelative == TREL_NEVER)
+		return path;
+
+	r = relativeFilename (path, OutputDirectory);
+	eFree (path);
+	return r;
+}
+
+static void rewriteInputField (unsigned int shard, vString *const line)
+{
+	static vString *rewritten;
+	tagFileRebase *rebase = Rebases + shard;
+	const char *head = vStringValue (line);
+	const char *field, *end;
+	char *inputField;
+	const char *newField;
+
+	if (rebase->directory == NULL
+		|| strncmp (head, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+		return;
+
+	field = strchr (head, '\t');
+	if (field == NULL)
+		return;
+	field++;
+	end = strchr (field, '\t');
+	if (end == NULL)
+		return;
+
+	inputField = eStrndup (field, end - field);
+	newField = hashTableGetItem (rebase->inputFields, inputField);
+	if (newField == NULL)
+	{
+		newField = rebaseInputField (rebase->directory, inputField);
+		hashTablePutItem (rebase->inputFields, inputField, (void *) newField);
+	}
+	else
+		eFree (inputField);
+
+	if (rewritten == NULL)
+		rewritten = vStringNew ();
+	vStringNCopyS (rewritten, head, field - head);
+	vStringCatS (rewritten, newField);
+	vStringCatS (rewritten, end);
+	vStringCopy (line, rewritten);
+}
+
+/*  Decide whether the input fields of the tag file FILENAME are
+ *  rewritten for the directory of the merged tag file.
+ */
+static void prepareRebase (tagFileRebase *rebase, const char *const fileName,
+						   bool usesIds)
+{
+	char *name;
+
+	if (Option.tagRelative == TREL_NO)
+		return;
+
+	name = eStrdup (fileName);
+	rebase->directory = absoluteDirname (name);
+	eFree (name);
+
+	if (Option.tagRelative == TREL_YES
+		&& strcmp (rebase->directory, OutputDirectory) == 0)
+	{
+		eFree (rebase->directory);
+		rebase->directory = NULL;
+		return;
+	}
+
+	if (usesIds)
+		error (FATAL, "cannot rewrite the input fields of \"%s\", which refers to input files by ids",
+			   fileName);
+	rebase->inputFields = hashTableNew (64, hashCstrhash, hashCstreq, eFree, eFree);
+	verbose ("rewriting the input fields of \"%s\" relative to %s\n",
+			 fileName, rebase->directory);
+}
+
+static void clearRebases (unsigned int count)
+{
+	for (unsigned int i = 0; i < count; i++)
+	{
+		if (Rebases [i].directory)
+			eFree (Rebases [i].directory);
+		if (Rebases [i].inputFields)
+			hashTableDelete (Rebases [i].inputFields);
+	}
+	eFree (Rebases);
+	Rebases = NULL;
+	eFree (OutputDirectory);
+	OutputDirectory = NULL;
+}
+
+static bool writeSingleValuedPtag (const void *key CTAGS_ATTR_UNUSED, void *value,
+								   void *user_data)
+{
+	MIO *mio = user_data;
+
+	mio_puts (mio, value);
+	mio_putc (mio, '\n');
+	return true;
+}
+
+static void mergeSortedTagFiles (stringList *fileNames)
+{
+	const char *outputName;
+	const char *sortedBy = NULL;
+	sortedShards shards = {
+		.mios = xMalloc (stringListCount (fileNames), MIO *),
+		.count = 0,
+		.numTags = 0,
+		.drop = dropSingleValuedPtag,
+		.rewrite = rewriteInputField,
+	};
+	MIO *ptags;
+
+	setDefaultTagFileName ();
+	outputName = isDestinationStdout ()? NULL: Option.tagFileName;
+	if (outputName)
+	{
+		char *name = eStrdup (outputName);
+		OutputDirectory = absoluteDirname (name);
+		eFree (name);
+	}
+	else
+		OutputDirectory = eStrdup (CurrentDirectory);
+	Rebases = xCalloc (stringListCount (fileNames), tagFileRebase);
+
+	SingleValuedPtags = hashTableNew (32, hashCstrhash, hashCstreq, eFree, eFree);
+	for (unsigned int i = 0; i < stringListCount (fileNames); i++)
+	{
+		const char *const fileName = vStringValue (stringListItem (fileNames, i));
+		MIO *mio;
+		int sorted;
+		bool usesIds;
+
+		if (outputName && isSameFile (outputName, fileName))
+			error (FATAL, "cannot merge \"%s\" into itself", fileName);
+
+		mio = mio_new_file (fileName, "r");
+		if (mio == NULL)
+			error (FATAL | PERROR, "cannot open tag file \"%s\"", fileName);
+		scanPseudoTags (mio, fileName, &sorted, &usesIds);
+		if (sorted >= 0)
+		{
+			/* The tag lines are compared in the same way in all the files. */
+			if (sorted != SO_SORTED && sorted != SO_FOLDSORTED)
+				error (FATAL, "cannot merge \"%s\", which is not sorted", fileName);
+			if (sortedBy && (int) Option.sorted != sorted)
+				error (FATAL, "\"%s\" and \"%s\" are sorted differently",
+					   sortedBy, fileName);
+			setSortOrder ((sortType) sorted);
+			sortedBy = fileName;
+		}
+
+		verbose ("merging \"%s\"\n", fileName);
+		prepareRebase (Rebases + shards.count, fileName, usesIds);
+		shards.mios [shards.count++] = mio;
+	}
+
+	/* The single-valued pseudo tags are dropped from all the tag files,
+	 * and put back once. The others, like TAG_KIND_DESCRIPTION, are
+	 * merged; the identical lines are written once. */
+	if (Option.deltaFileName)
+		beginSortDelta (Option.deltaFileName, outputName);
+	ptags = mio_new_memory (NULL, 0, eRealloc, eFree);
+	hashTableForeachItem (SingleValuedPtags, writeSingleValuedPtag, ptags);
+	if (! internalMergeShards (ptags, hashTableCountItem (SingleValuedPtags),
+							   &shards, outputName)
+		&& outputName == NULL)
+		error (WARNING, "the merged tags are not sorted because an input tag file is not");
+	endSortDelta ();
+
+	if (outputName)
+		writeSidecarIndexes (outputName);
+
+	mio_unref (ptags);
+	for (unsigned int i = 0; i < shards.count; i++)
+		mio_unref (shards.mios [i]);
+	eFree (shards.mios);
+	clearRebases (shards.count);
+	hashTableDelete (SingleValuedPtags);
+	SingleValuedPtags = NULL;
+}
+#endif
+
+extern void mergeTagFiles (cookedArgs *args, void *data CTAGS_ATTR_UNUSED)
+{
+	stringList *fileNames = stringListNew ();
+
+	while (! cArgOff (args))
+	{
+		stringListAdd (fileNames, vStringNewInit (cArgItem (args)));
+		cArgForth (args);
+		parseCmdlineOptions (args);
+	}
+	if (stringListCount (fileNames) == 0)
+		error (FATAL, "No tag files to merge specified. Try \"%s --help\".",
+			   getExecutableName ());
+
+#ifdef EXTERNAL_SORT
+	error (FATAL, "--merge is not supported with the external sort command");
+#else
+	mergeSortedTagFiles (fileNames);
+#endif
+	stringListDelete (fileNames);
+}
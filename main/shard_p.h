@@ -0,0 +1,34 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for dividing the input files into shards tagged
+*   separately, and for merging the tag files made for the shards.
+*/
+#ifndef CTAGS_MAIN_SHARD_PRIVATE_H
+#define CTAGS_MAIN_SHARD_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "options_p.h"
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Return true if FILENAME is in the shard chosen with --shard=<K>/<N>,
+ * or --shard is not given. The shard of a file depends only on its
+ * path, so every file is in exactly one of the N shards in the runs
+ * made with the same input files. */
+extern bool isInputFileInShard (const char *const fileName);
+
+/* The main loop of --merge. The arguments are the sorted tag files to
+ * be merged into the tag file. */
+extern void mergeTagFiles (cookedArgs *args, void *data);
+
+#endif	/* CTAGS_MAIN_SHARD_PRIVATE_H */
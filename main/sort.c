@@ -12,10 +12,13 @@
 */
 #include "general.h"  /* must always come first */
 
+#include <ctype.h>
 #include <errno.h>
+#include <limits.h>
 #if defined (HAVE_IO_H)
 # include <io.h>
 #endif
+#include <stdint.h>
 #include <stdlib.h>  /* to declare malloc () */
 #if defined (HAVE_UNISTD_H)
 # include <unistd.h>
@@ -28,7 +31,10 @@
 #include "options_p.h"
 #include "read.h"
 #include "routines.h"
+#include "routines_p.h"
 #include "sort_p.h"
+#include "stats_p.h"
+#include "vstring.h"
 
 /*
 *   FUNCTION DEFINITIONS
@@ -172,11 +178,91 @@ extern void externalSortTags (const bool toStdout, MIO *tagFile)
 #else
 
 /*
- *  These functions provide a basic internal sort. No great memory
- *  optimization is performed (e.g. recursive subdivided sorts),
- *  so have lots of memory if you have large tag files.
+ *  These functions provide an internal external-merge sort. The lines
+ *  of the tag file are collected into a run in memory. When the run
+ *  grows larger than --sort-memory-limit, it is sorted and spilled to
+ *  a temporary file. At the end, the spilled runs are merged into the
+ *  tag file. Identical lines are removed unless making an xref.
+ *
+ *  The lines of a run are stored in large chunks of memory instead of
+ *  one allocation per line. Each entry in the table to be sorted caches
+ *  the first bytes of its line as an integer so that most comparisons
+ *  don't touch the chunks at all.
+ *
+ *  When the tags are kept in a memory MIO, its buffer is sorted in
+ *  place; the lines are not copied.
+ *
+ *  The last run is merged from memory without being spilled. An
+ *  existing tag file already sorted can take part in the merge as one
+ *  more run: tags appended to it are sorted alone and merged into it.
+ *  So can the tags sorted in each worker process with --jobs=<N>.
  */
 
+#define SORT_CHUNK_SIZE (1024 * 1024)
+
+typedef struct sSortChunk {
+	struct sSortChunk *next;
+	size_t size;
+	size_t used;
+	char data [];
+} sortChunk;
+
+typedef struct sSortLine {
+	uint64_t prefix;			/* the first bytes of the line, big endian */
+	const char *line;
+} sortLine;
+
+typedef struct sSortRun {
+	MIO *mio;
+	char *name;					/* NULL unless spilled to a temporary file */
+	vString *line;
+	const char *head;			/* the head line of the run */
+	sortLine *table;			/* the lines of the run kept in memory */
+	size_t next;
+	size_t count;				/* lines in the table, or read from mio */
+	bool (* drop) (const char *const line);
+	unsigned long dropped;
+	void (* rewrite) (unsigned int shard, vString *const line);
+	unsigned int shard;			/* the index of the shard read in the run */
+	bool done;
+} sortRun;
+
+typedef struct sSortState {
+	int (*cmpFunc)(const void *, const void *);
+	int (*cmpLines)(const char *, const char *);
+	bool folded;
+	sortLine *table;			/* lines in the current run */
+	size_t tableSize;
+	size_t count;
+	size_t runBytes;
+	sortChunk *chunks;			/* storage for the lines in the current run */
+	size_t chunkBytes;
+	sortRun *runs;				/* runs to be merged */
+	unsigned int runCount;
+	size_t peakMemory;
+	bool disordered;			/* the merged lines were not in order */
+	struct sSortDelta *delta;	/* NULL unless --delta is given */
+} sortState;
+
+/*  The lines of the previous tag file (--delta), read in step with the
+ *  sorted lines written to the tag file.
+ */
+typedef struct sSortDelta {
+	int (*cmpLines)(const char *, const char *);
+	MIO *previous;
+	vString *line;				/* the head line of the previous tag file */
+	vString *last;
+	bool done;
+	MIO *output;
+	unsigned long added;
+	unsigned long removed;
+} sortDelta;
+
+static char *DeltaPrevious;		/* the previous tag file */
+static char *DeltaName;			/* <tagfile>.delta */
+static bool DeltaMovedAside;	/* DeltaPrevious was the tag file */
+static bool DeltaWritten;
+
 extern void failedSort (MIO *const mio, const char* msg)
 {
 	const char* const cannotSort = "cannot sort tag file";
@@ -188,74 +274,480 @@ extern void failedSort (MIO *const mio, const char* msg)
 		error (FATAL, "%s: %s", msg, cannotSort);
 }
 
+/*  The characters folded to uppercase for --sort=foldcase, looked up
+ *  instead of calling toupper () for each character compared.
+ */
+static unsigned char FoldTable [UCHAR_MAX + 1];
+
+static void initFoldTable (void)
+{
+	if (FoldTable ['a'] != 0)
+		return;
+	for (unsigned int c = 0; c <= UCHAR_MAX; c++)
+		FoldTable [c] = (unsigned char) toupper ((int) c);
+}
+
+static uint64_t linePrefix (const char *line, bool folded)
+{
+	uint64_t prefix = 0;
+	unsigned int i;
+
+	for (i = 0; i < sizeof (prefix) && line [i] != '\0'; i++)
+	{
+		unsigned char c = (unsigned char) line [i];
+		prefix = (prefix << 8) | (folded? FoldTable [c]: c);
+	}
+	for (; i < sizeof (prefix); i++)
+		prefix <<= 8;
+
+	return prefix;
+}
+
+static int comparePrefixes (const sortLine *const line1, const sortLine *const line2)
+{
+	if (line1->prefix < line2->prefix)
+		return -1;
+	else if (line1->prefix > line2->prefix)
+		return 1;
+	return 0;
+}
+
+/*  Lines equal when folded are ordered by strcmp so that the result
+ *  doesn't depend on how the lines are divided into runs. Both orders
+ *  are decided in one pass: the first byte differing only in case is
+ *  remembered until the lines turn out to be equal when folded.
+ */
+static int compareLinesFolded (const char *line1, const char *line2)
+{
+	const unsigned char *s1 = (const unsigned char *) line1;
+	const unsigned char *s2 = (const unsigned char *) line2;
+	int tie = 0;
+
+	for (;; s1++, s2++)
+	{
+		if (*s1 != *s2)
+		{
+			int r = FoldTable [*s1] - FoldTable [*s2];
+
+			if (r != 0)
+				return r;
+			if (tie == 0)
+				tie = *s1 - *s2;
+		}
+		else if (*s1 == '\0')
+			return tie;
+	}
+}
+
 static int compareTagsFolded(const void *const one, const void *const two)
 {
-	const char *const line1 = *(const char* const*) one;
-	const char *const line2 = *(const char* const*) two;
+	const sortLine *const line1 = one;
+	const sortLine *const line2 = two;
+	int r = comparePrefixes (line1, line2);
 
-	return struppercmp (line1, line2);
+	return r? r: compareLinesFolded (line1->line, line2->line);
 }
 
 static int compareTags (const void *const one, const void *const two)
 {
-	const char *const line1 = *(const char* const*) one;
-	const char *const line2 = *(const char* const*) two;
+	const sortLine *const line1 = one;
+	const sortLine *const line2 = two;
+	int r = comparePrefixes (line1, line2);
 
-	return strcmp (line1, line2);
+	return r? r: strcmp (line1->line, line2->line);
 }
 
-static void writeSortedTags (
-		char **const table, const size_t numTags, const bool toStdout, bool newlineReplaced)
+/*  NAME is NULL for the standard output.
+ */
+static MIO *openSortedOutput (const char *const name)
 {
 	MIO *mio;
-	size_t i;
 
-	/*  Write the sorted lines back into the tag file.
-	 */
-	if (toStdout)
+	if (name == NULL)
 		mio = mio_new_fp (stdout, NULL);
 	else
 	{
-		mio = mio_new_file (tagFileName (), "w");
+		mio = mio_new_file (name, "w");
 		if (mio == NULL)
 			failedSort (mio, NULL);
 	}
+	return mio;
+}
+
+static void closeSortedOutput (MIO *mio, const char *const name)
+{
+	if (name == NULL)
+		mio_flush (mio);
+	mio_unref (mio);
+}
+
+static void writeSortedLine (MIO *mio, const char *line, bool newline)
+{
+	if (mio_puts (mio, line) == EOF)
+		failedSort (mio, NULL);
+	else if (newline)
+		mio_putc (mio, '\n');
+}
+
+static void readDeltaHead (sortDelta *delta)
+{
+	vStringCopy (delta->last, delta->line);
+	for (;;)
+	{
+		if (readLineRaw (delta->line, delta->previous) == NULL)
+		{
+			if (mio_error (delta->previous))
+				error (FATAL | PERROR, "cannot read \"%s\"", DeltaPrevious);
+			delta->done = true;
+			return;
+		}
+		vStringStripNewline (delta->line);
+		if (! vStringIsEmpty (delta->line))
+			break;
+	}
+	if (! vStringIsEmpty (delta->last)
+		&& delta->cmpLines (vStringValue (delta->line), vStringValue (delta->last)) < 0)
+		error (FATAL, "\"%s\" is not sorted in the way the tags are", DeltaPrevious);
+}
+
+static void writeDeltaLine (sortDelta *delta, char sign, const char *line)
+{
+	if (mio_putc (delta->output, sign) == EOF
+		|| mio_puts (delta->output, line) == EOF
+		|| mio_putc (delta->output, '\n') == EOF)
+		error (FATAL | PERROR, "cannot write \"%s\"", DeltaName);
+}
+
+/*  Write the lines of the previous tag file coming before LINE, the
+ *  next line of the tag file, as removed, and LINE as added unless the
+ *  previous tag file has it too. LINE is NULL at the end of the tag file.
+ */
+static void compareDelta (sortDelta *delta, const char *line)
+{
+	int r = -1;
+
+	while (! delta->done
+		   && (line == NULL
+			   || (r = delta->cmpLines (vStringValue (delta->line), line)) < 0))
+	{
+		writeDeltaLine (delta, '-', vStringValue (delta->line));
+		delta->removed++;
+		readDeltaHead (delta);
+	}
+	if (line == NULL)
+		return;
+	if (! delta->done && r == 0)
+		readDeltaHead (delta);
+	else
+	{
+		writeDeltaLine (delta, '+', line);
+		delta->added++;
+	}
+}
+
+static sortDelta *openDelta (int (*cmpLines)(const char *, const char *))
+{
+	sortDelta *delta = xCalloc (1, sortDelta);
+
+	delta->cmpLines = cmpLines;
+	delta->line = vStringNew ();
+	delta->last = vStringNew ();
+	if (doesFileExist (DeltaPrevious))
+	{
+		delta->previous = mio_new_file (DeltaPrevious, "r");
+		if (delta->previous == NULL)
+			error (FATAL | PERROR, "cannot open \"%s\"", DeltaPrevious);
+		readDeltaHead (delta);
+	}
+	else
+	{
+		verbose ("%s doesn't exist; all the tags are added\n", DeltaPrevious);
+		delta->done = true;
+	}
+
+	delta->output = mio_new_file (DeltaName, "w");
+	if (delta->output == NULL)
+		error (FATAL | PERROR, "cannot open \"%s\"", DeltaName);
+	DeltaWritten = true;
+	return delta;
+}
+
+static void closeDelta (sortDelta *delta)
+{
+	compareDelta (delta, NULL);
+	if (mio_unref (delta->output) != 0)
+		error (FATAL | PERROR, "cannot write \"%s\"", DeltaName);
+	if (delta->previous)
+		mio_unref (delta->previous);
+
+	verbose ("%lu tags added and %lu removed; written to %s\n",
+			 delta->added, delta->removed, DeltaName);
+
+	vStringDelete (delta->last);
+	vStringDelete (delta->line);
+	eFree (delta);
+}
+
+static void writeSortedTags (
+		sortLine *const table, const size_t numTags, MIO *mio, bool newlineReplaced,
+		sortDelta *delta)
+{
+	size_t i;
+
+	/*  Write the sorted lines back into the tag file.
+	 */
 	for (i = 0 ; i < numTags ; ++i)
 	{
 		/*  Here we filter out identical tag *lines* (including search
 		 *  pattern) if this is not an xref file.
 		 */
-		if (i == 0  ||  Option.xref  ||  strcmp (table [i], table [i-1]) != 0)
+		if (i == 0  ||  Option.xref  ||  strcmp (table [i].line, table [i-1].line) != 0)
 		{
-			if (mio_puts (mio, table [i]) == EOF)
-				failedSort (mio, NULL);
-			else if (newlineReplaced)
-				mio_putc (mio, '\n');
+			writeSortedLine (mio, table [i].line, newlineReplaced);
+			if (delta)
+				compareDelta (delta, table [i].line);
 		}
 	}
-	if (toStdout)
-		mio_flush (mio);
-	mio_unref (mio);
 }
 
-extern void internalSortTags (const bool toStdout, MIO* mio, size_t numTags)
+static char *storeLine (sortState *state, const char *line, size_t size)
+{
+	sortChunk *chunk = state->chunks;
+
+	if (chunk == NULL || chunk->size - chunk->used < size)
+	{
+		size_t chunkSize = size > SORT_CHUNK_SIZE? size: SORT_CHUNK_SIZE;
+
+		chunk = malloc (sizeof (sortChunk) + chunkSize);
+		if (chunk == NULL)
+			return NULL;
+		chunk->next = state->chunks;
+		chunk->size = chunkSize;
+		chunk->used = 0;
+		state->chunks = chunk;
+		state->chunkBytes += sizeof (sortChunk) + chunkSize;
+	}
+
+	char *copy = chunk->data + chunk->used;
+	memcpy (copy, line, size);
+	chunk->used += size;
+	return copy;
+}
+
+static void clearRun (sortState *state)
+{
+	while (state->chunks)
+	{
+		sortChunk *next = state->chunks->next;
+		free (state->chunks);
+		state->chunks = next;
+	}
+	state->chunkBytes = 0;
+	state->count = 0;
+	state->runBytes = 0;
+}
+
+static sortRun *addRun (sortState *state)
+{
+	sortRun *run;
+
+	state->runs = xRealloc (state->runs, state->runCount + 1, sortRun);
+	run = state->runs + state->runCount++;
+	memset (run, 0, sizeof (*run));
+	return run;
+}
+
+static void spillRun (sortState *state)
+{
+	sortRun *run = addRun (state);
+
+	run->mio = tempFile ("w+", &run->name);
+	run->line = vStringNew ();
+
+	verbose ("spilling %lu lines of tag file to %s\n",
+			 (unsigned long) state->count, run->name);
+
+	qsort (state->table, state->count, sizeof (*state->table), state->cmpFunc);
+	writeSortedTags (state->table, state->count, run->mio, true, NULL);
+	if (mio_flush (run->mio) != 0)
+		failedSort (NULL, NULL);
+	mio_seek (run->mio, 0, SEEK_SET);
+
+	clearRun (state);
+}
+
+static void readRunHead (sortRun *run)
+{
+	if (run->table)
+	{
+		if (run->next < run->count)
+			run->head = run->table [run->next++].line;
+		else
+			run->done = true;
+		return;
+	}
+
+	for (;;)
+	{
+		if (readLineRaw (run->line, run->mio) == NULL)
+		{
+			if (mio_error (run->mio))
+				failedSort (NULL, NULL);
+			run->done = true;
+			return;
+		}
+		vStringStripNewline (run->line);
+		if (vStringIsEmpty (run->line))
+			continue;  /* ignore blank lines */
+		if (run->drop == NULL || ! run->drop (vStringValue (run->line)))
+			break;
+		run->dropped++;
+	}
+	if (run->rewrite)
+		run->rewrite (run->shard, run->line);
+
+	run->head = vStringValue (run->line);
+	run->count++;
+}
+
+static int compareRuns (const sortState *state, const sortRun *a, const sortRun *b)
+{
+	return state->cmpLines (a->head, b->head);
+}
+
+static void siftDownRun (const sortState *state, sortRun **heap,
+						 unsigned int count, unsigned int i)
+{
+	for (;;)
+	{
+		unsigned int smallest = i;
+		unsigned int l = 2 * i + 1;
+		unsigned int r = l + 1;
+
+		if (l < count && compareRuns (state, heap [l], heap [smallest]) < 0)
+			smallest = l;
+		if (r < count && compareRuns (state, heap [r], heap [smallest]) < 0)
+			smallest = r;
+		if (smallest == i)
+			break;
+
+		sortRun *tmp = heap [i];
+		heap [i] = heap [smallest];
+		heap [smallest] = tmp;
+		i = smallest;
+	}
+}
+
+/*  Merge the runs with a binary heap keyed on the head line of each
+ *  run. If a run is not sorted, the output isn't either; it is noted
+ *  in STATE.
+ */
+static void mergeRuns (sortState *state, MIO *mio, bool newlineReplaced)
+{
+	sortRun **heap = xMalloc (state->runCount, sortRun *);
+	unsigned int count = 0;
+	vString *last = vStringNew ();
+	bool first = true;
+
+	for (unsigned int i = 0 ; i < state->runCount ; ++i)
+	{
+		readRunHead (state->runs + i);
+		if (! state->runs [i].done)
+			heap [count++] = state->runs + i;
+	}
+	for (unsigned int i = count / 2 ; i > 0 ; --i)
+		siftDownRun (state, heap, count, i - 1);
+
+	while (count > 0)
+	{
+		sortRun *run = heap [0];
+		int r = first? 1: state->cmpLines (run->head, vStringValue (last));
+
+		if (r < 0)
+			state->disordered = true;
+		if (r != 0  ||  Option.xref)
+		{
+			writeSortedLine (mio, run->head, newlineReplaced);
+			if (state->delta)
+				compareDelta (state->delta, run->head);
+			vStringCopyS (last, run->head);
+			first = false;
+		}
+
+		readRunHead (run);
+		if (run->done)
+			heap [0] = heap [--count];
+		siftDownRun (state, heap, count, 0);
+	}
+
+	vStringDelete (last);
+	eFree (heap);
+}
+
+static void deleteRuns (sortState *state)
+{
+	for (unsigned int i = 0 ; i < state->runCount ; ++i)
+	{
+		sortRun *run = state->runs + i;
+
+		if (run->name)
+		{
+			mio_unref (run->mio);
+			remove (run->name);
+			eFree (run->name);
+		}
+		if (run->line)
+			vStringDelete (run->line);
+	}
+	if (state->runs)
+		eFree (state->runs);
+	state->runs = NULL;
+	state->runCount = 0;
+}
+
+/*  Make the table point to the lines in the buffer of a memory MIO.
+ *  The newline characters in the buffer are overwritten.
+ */
+static bool tableLinesInMemory (sortState *state, MIO *mio, size_t numTags)
+{
+	size_t size;
+	char *data = (char *) mio_memory_get_data (mio, &size);
+	char *end = data + size;
+
+	if (data == NULL || size == 0 || end [-1] != '\n')
+		return false;
+
+	for (char *line = data; line < end && state->count < numTags; )
+	{
+		char *newline = memchr (line, '\n', (size_t) (end - line));
+
+		*newline = '\0';
+		if (*line != '\0')
+		{
+			state->table [state->count].line = line;
+			state->table [state->count].prefix = linePrefix (line, state->folded);
+			state->count++;
+		}
+		line = newline + 1;
+	}
+	state->peakMemory = state->tableSize;
+	return true;
+}
+
+/*  Read the lines of MIO into the table. The runs grown larger than the
+ *  limit are spilled on the way.
+ */
+static bool tableLinesFromMio (sortState *state, MIO *mio, size_t numTags)
 {
 	vString *vLine = vStringNew ();
 	const char *line;
 	size_t i;
-	int (*cmpFunc)(const void *, const void *);
 	bool newlineReplaced = false;
-
-	/*  Allocate a table of line pointers to be sorted.
-	 */
-	const size_t tableSize = numTags * sizeof (char *);
-	char **table = (char **) malloc (tableSize);  /* line pointers */
-	DebugStatement ( size_t mallocSize = tableSize; )  /* cumulative total */
-
-
-	cmpFunc = Option.sorted == SO_FOLDSORTED ? compareTagsFolded : compareTags;
-	if (table == NULL)
-		failedSort (mio, "out of memory");
+	/* The lines are not counted for --memory-limit, but they are kept
+	 * within the memory left. */
+	const size_t runLimit = (getMemoryAvailable () < Option.sortMemoryLimit)
+		? getMemoryAvailable (): Option.sortMemoryLimit;
+	const memoryTotals spilled = { .spilled = 1 };
 
 	for (i = 0  ;  i < numTags  &&  ! mio_eof (mio)  ;  )
 	{
@@ -271,33 +763,234 @@ extern void internalSortTags (const bool toStdout, MIO* mio, size_t numTags)
 		else
 		{
 			const size_t stringSize = strlen (line) + 1;
+			char *copy;
 
-			table [i] = (char *) malloc (stringSize);
-			if (table [i] == NULL)
+			if (state->runBytes + stringSize > runLimit
+				&& state->count > 0)
+			{
+				if (runLimit < Option.sortMemoryLimit)
+					addMemoryTotals (&spilled);
+				spillRun (state);
+			}
+
+			copy = storeLine (state, line, stringSize);
+			if (copy == NULL)
 				failedSort (mio, "out of memory");
-			DebugStatement ( mallocSize += stringSize; )
-			strcpy (table [i], line);
-			if (table[i][stringSize - 2] == '\n')
+			if (copy [stringSize - 2] == '\n')
 			{
-				table[i][stringSize - 2] = '\0';
+				copy [stringSize - 2] = '\0';
 				newlineReplaced = true;
 			}
+			state->table [state->count].line = copy;
+			state->table [state->count].prefix = linePrefix (copy, state->folded);
+			state->count++;
+			state->runBytes += stringSize;
+			if (state->tableSize + state->chunkBytes > state->peakMemory)
+				state->peakMemory = state->tableSize + state->chunkBytes;
 			++i;
 		}
 	}
-	numTags = i;
 	vStringDelete (vLine);
 
+	return newlineReplaced;
+}
+
+/*  Sort the lines of MIO, and merge them with the lines of SHARDS and
+ *  SORTED if they are not NULL, into GIVENOUTPUT, which is left open, if it is not
+ *  NULL, or else into the file OUTPUTNAME or the standard output if
+ *  OUTPUTNAME is NULL. The lines of SORTED for which DROP returns true
+ *  are left out. Return the number of lines taken from SORTED in *NUMSORTED.
+ *  Return false if the output is not sorted because SORTED was not.
+ */
+static bool sortLines (const char *const outputName, MIO *givenOutput,
+					   MIO* mio, size_t numTags,
+					   const sortedShards *shards,
+					   MIO *sorted, bool (* drop) (const char *const line),
+					   unsigned long *numSorted)
+{
+	bool newlineReplaced;
+	sortState state = {
+		.cmpFunc = Option.sorted == SO_FOLDSORTED ? compareTagsFolded : compareTags,
+		.cmpLines = Option.sorted == SO_FOLDSORTED ? compareLinesFolded : strcmp,
+		.folded = Option.sorted == SO_FOLDSORTED,
+	};
+	sortRun *sortedRun = NULL;
+	MIO *output;
+
+	if (state.folded)
+		initFoldTable ();
+
+	/*  Allocate a table of line pointers to be sorted.
+	 */
+	state.tableSize = numTags * sizeof (sortLine);
+	state.table = (sortLine *) malloc (state.tableSize);
+	if (state.table == NULL  &&  state.tableSize > 0)
+		failedSort (mio, "out of memory");
+
+	if (tableLinesInMemory (&state, mio, numTags))
+		newlineReplaced = true;
+	else
+		newlineReplaced = tableLinesFromMio (&state, mio, numTags);
+
 	/*  Sort the lines.
 	 */
-	qsort (table, numTags, sizeof (*table), cmpFunc);
+	qsort (state.table, state.count, sizeof (*state.table), state.cmpFunc);
+
+	output = givenOutput? givenOutput: openSortedOutput (outputName);
+	if (DeltaName && ! givenOutput)
+		state.delta = openDelta (state.cmpLines);
+	if (state.runCount == 0  &&  sorted == NULL
+		&&  (shards == NULL  ||  shards->count == 0))
+		writeSortedTags (state.table, state.count, output, newlineReplaced,
+						 state.delta);
+	else
+	{
+		if (state.count > 0)
+		{
+			sortRun *run = addRun (&state);
+			run->table = state.table;
+			run->count = state.count;
+		}
+		for (unsigned int i = 0 ; shards && i < shards->count ; ++i)
+		{
+			sortRun *run = addRun (&state);
+			run->mio = shards->mios [i];
+			run->line = vStringNew ();
+			run->drop = shards->drop;
+			run->rewrite = shards->rewrite;
+			run->shard = i;
+			newlineReplaced = true;
+		}
+		if (sorted)
+		{
+			sortedRun = addRun (&state);
+			sortedRun->mio = sorted;
+			sortedRun->line = vStringNew ();
+			sortedRun->drop = drop;
+			newlineReplaced = true;
+		}
+		mergeRuns (&state, output, newlineReplaced);
+	}
+	if (! givenOutput)
+		closeSortedOutput (output, outputName);
+	if (state.delta)
+		closeDelta (state.delta);
+
+	if (numSorted)
+		*numSorted = sortedRun? sortedRun->count: 0;
+	if (sortedRun && sortedRun->dropped > 0)
+		verbose ("dropped %lu lines of %s\n", sortedRun->dropped, outputName);
+
+	PrintStatus (("sort memory: %ld bytes\n", (long) state.peakMemory));
+	clearRun (&state);
+	deleteRuns (&state);
+	free (state.table);
+
+	return !state.disordered;
+}
+
+extern void internalSortTags (const bool toStdout, MIO* mio, size_t numTags,
+							  const sortedShards *shards)
+{
+	sortLines (toStdout? NULL: tagFileName (), NULL, mio, numTags, shards,
+			   NULL, NULL, NULL);
+}
+
+extern void internalSortTagsToMio (MIO *output, MIO *mio, size_t numTags,
+								   const sortedShards *shards)
+{
+	sortLines (NULL, output, mio, numTags, shards, NULL, NULL, NULL);
+}
 
-	writeSortedTags (table, numTags, toStdout, newlineReplaced);
+extern unsigned long internalMergeTags (MIO *mio, size_t numTags,
+										const sortedShards *shards, MIO *sorted,
+										bool (* drop) (const char *const line),
+										const char *const outputName)
+{
+	unsigned long numSorted;
 
-	PrintStatus (("sort memory: %ld bytes\n", (long) mallocSize));
-	for (i = 0 ; i < numTags ; ++i)
-		free (table [i]);
-	free (table);
+	if (! sortLines (outputName, NULL, mio, numTags, shards, sorted, drop, &numSorted))
+	{
+		MIO *merged = mio_new_file (outputName, "r");
+
+		verbose ("%s was not sorted; sorting all the tags\n", outputName);
+		if (merged == NULL)
+			failedSort (merged, NULL);
+		sortLines (outputName, NULL, merged,
+				   numTags + numSorted + (shards? shards->numTags: 0),
+				   NULL, NULL, NULL, NULL);
+		mio_unref (merged);
+	}
+	return numSorted;
 }
 
+extern bool internalMergeShards (MIO *mio, size_t numTags,
+								 const sortedShards *shards,
+								 const char *const outputName)
+{
+	if (sortLines (outputName, NULL, mio, numTags, shards, NULL, NULL, NULL))
+		return true;
+
+	if (outputName)
+	{
+		MIO *merged = mio_new_file (outputName, "r");
+		size_t numMerged = 0;
+		int c;
+
+		verbose ("%s was not sorted; sorting all the tags\n", outputName);
+		if (merged == NULL)
+			failedSort (merged, NULL);
+		while ((c = mio_getc (merged)) != EOF)
+			if (c == '\n')
+				numMerged++;
+		mio_rewind (merged);
+		sortLines (outputName, NULL, merged, numMerged,
+				   NULL, NULL, NULL, NULL);
+		mio_unref (merged);
+	}
+	return false;
+}
+
+extern void beginSortDelta (const char *const previous, const char *const tagFileName)
+{
+	vString *name = vStringNewInit (tagFileName);
+
+	vStringCatS (name, ".delta");
+	DeltaName = vStringDeleteUnwrap (name);
+	DeltaWritten = false;
+
+	if (isSameFile (previous, tagFileName))
+	{
+		name = vStringNewInit (tagFileName);
+		vStringCatS (name, ".prev");
+		DeltaPrevious = vStringDeleteUnwrap (name);
+		if (rename (tagFileName, DeltaPrevious) != 0)
+			error (FATAL | PERROR, "cannot move \"%s\" aside", tagFileName);
+		DeltaMovedAside = true;
+	}
+	else
+		DeltaPrevious = eStrdup (previous);
+}
+
+extern void endSortDelta (void)
+{
+	if (DeltaName == NULL)
+		return;
+
+	/* No tag was sorted; all the lines of the previous tag file are
+	 * removed. */
+	if (! DeltaWritten)
+		closeDelta (openDelta (Option.sorted == SO_FOLDSORTED
+							   ? compareLinesFolded : strcmp));
+
+	if (DeltaMovedAside)
+		remove (DeltaPrevious);
+	DeltaMovedAside = false;
+	eFree (DeltaPrevious);
+	DeltaPrevious = NULL;
+	eFree (DeltaName);
+	DeltaName = NULL;
+}
+
+
 #endif
@@ -17,6 +17,7 @@
 #include <stdio.h>
 
 #include "mio.h"
+#include "vstring.h"
 
 /*
 *   FUNCTION PROTOTYPES
@@ -26,9 +27,57 @@ extern void catFile (MIO *mio);
 #ifdef EXTERNAL_SORT
 extern void externalSortTags (const bool toStdout, MIO *tagFile);
 #else
+/* Tag files sorted in worker processes, merged with the lines being
+ * sorted. Each MIO is read from its current position. */
+typedef struct sSortedShards {
+	MIO **mios;
+	unsigned int count;
+	size_t numTags;				/* the lines in all the shards, or 0 if unknown */
+	/* The lines of the shards for which DROP returns true are left
+	 * out; DROP can be NULL. */
+	bool (* drop) (const char *const line);
+	/* Called with the index of the shard for each line of the shards
+	 * not dropped, before it is merged; REWRITE can be NULL. */
+	void (* rewrite) (unsigned int shard, vString *const line);
+} sortedShards;
+
+/* SHARDS can be NULL. */
 extern void internalSortTags (const bool toStdout,
 			      MIO *mio,
-			      size_t numTags);
+			      size_t numTags,
+			      const sortedShards *shards);
+/* Same as internalSortTags() but the sorted lines are written to OUTPUT,
+ * which is left open and not flushed. */
+extern void internalSortTagsToMio (MIO *output, MIO *mio, size_t numTags,
+				   const sortedShards *shards);
+
+/* Sort the NUMTAGS lines of MIO and merge them with SHARDS and SORTED,
+ * the lines of a tag file already sorted, into OUTPUTNAME. The lines of SORTED for
+ * which DROP returns true are left out; DROP can be NULL. If SORTED turns
+ * out not to be sorted, all the lines are sorted again. Return the number
+ * of lines taken from SORTED. */
+extern unsigned long internalMergeTags (MIO *mio, size_t numTags,
+					const sortedShards *shards,
+					MIO *sorted,
+					bool (* drop) (const char *const line),
+					const char *const outputName);
+
+/* Merge the NUMTAGS lines of MIO, which are sorted here, and SHARDS
+ * into OUTPUTNAME, or the standard output if OUTPUTNAME is NULL.
+ * Return false if the output is not sorted because a shard was not;
+ * the output file is sorted again then, but the standard output
+ * cannot be. */
+extern bool internalMergeShards (MIO *mio, size_t numTags,
+				 const sortedShards *shards,
+				 const char *const outputName);
+
+/* Compare the lines written to TAGFILENAME by the calls above until
+ * endSortDelta() with the lines of PREVIOUS, a tag file sorted in the same
+ * way, and write the lines only in one of them to TAGFILENAME.delta, with
+ * '+' or '-' put before. If PREVIOUS is TAGFILENAME, it is moved aside
+ * here; call this before TAGFILENAME is written. */
+extern void beginSortDelta (const char *const previous, const char *const tagFileName);
+extern void endSortDelta (void);
 #endif
 
 /* mio is closed in this function. */
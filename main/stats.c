@@ -15,22 +15,93 @@
 */
 #include "general.h"  /* must always come first */
 
+#include <stddef.h>
 #include <stdio.h>
+#include <string.h>
+#include <time.h>
+#ifdef HAVE_SYS_RESOURCE_H
+# include <sys/resource.h>  /* to get the peak resident set size */
+#endif
 
 #include "entry_p.h"
 #include "options_p.h"
+#include "parse_p.h"
+#include "routines.h"
+#include "routines_p.h"
 #include "stats_p.h"
+#include "vstring.h"
 
 /*
 *   MACROS
 */
 #define plural(value)  (((unsigned long)(value) == 1L) ? "" : "s")
+#define COUNT_PARSE_TIME_BOUNDS 8
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sLanguageStats {
+	unsigned long files, lines, bytes, tags;
+	unsigned long rescans, rescannedBytes;
+	statsTime time;
+} languageStats;
+
+/* The histogram of the wall-clock time for parsing an input file. The
+ * counts are not cumulative; the last bucket has no bound. */
+typedef struct sParseTimeHistogram {
+	unsigned long counts [COUNT_PARSE_TIME_BOUNDS + 1];
+	double sum;
+} parseTimeHistogram;
+
+typedef struct sFileStats {
+	char *name;
+	langType language;
+	unsigned long bytes, tags;
+	unsigned int rescans;
+	statsTime time;
+} fileStats;
 
 /*
 *   DATA DEFINITIONS
 */
 static struct { long files, lines, bytes; } Totals = { 0, 0, 0 };
+static partialTotals PartialTotals;
+static memoryTotals MemoryTotals;
+
+static statsTime PhaseTimes [COUNT_STATS_PHASE];
+static const char *const PhaseNames [COUNT_STATS_PHASE] = {
+	[STATS_PHASE_GUESS]  = "guess",
+	[STATS_PHASE_REGEX]  = "regex",
+	[STATS_PHASE_UNCORK] = "uncork",
+	[STATS_PHASE_WRITE]  = "write",
+	[STATS_PHASE_SORT]   = "sort",
+};
+
+/* Indexed by langType; allocated when the first input file is parsed. */
+static languageStats *LanguageStats;
+static unsigned int LanguageStatsCount;
 
+/* The slowest files for --totals=slow:N, sorted by wall-clock time in
+ * descending order. */
+static fileStats *SlowFiles;
+static unsigned int SlowFileCount;
+static unsigned int FileRescans;	/* in parsing the current input file */
+static unsigned long WorkerAllocations;
+
+/* Indexed by the number of the worker; summed up over the runs of the
+ * workers. */
+static workerStats *WorkerStats;
+static unsigned int WorkerStatsCount;
+
+/* The upper bounds of the buckets of ParseTimes in seconds */
+static const double ParseTimeBounds [COUNT_PARSE_TIME_BOUNDS] = {
+	0.001, 0.005, 0.01, 0.05, 0.1, 0.5, 1.0, 5.0,
+};
+static parseTimeHistogram ParseTimes;
+
+/* Collecting the statistics of the breakdown without --totals, for
+ * --metrics-file and the metrics request of the interactive mode. */
+static bool MetricsEnabled;
 
 /*
 *   FUNCTION DEFINITIONS
@@ -44,18 +115,772 @@ extern void addTotals (
 	Totals.bytes += bytes;
 }
 
-extern void printTotals (const clock_t *const timeStamps, bool append, sortType sorted)
+extern void getTotals (long *const files, long *const lines, long *const bytes)
+{
+	*files = Totals.files;
+	*lines = Totals.lines;
+	*bytes = Totals.bytes;
+}
+
+extern void readStatsTime (statsTime *t)
+{
+#if defined (HAVE_CLOCK_GETTIME) && defined (CLOCK_MONOTONIC)
+	struct timespec ts;
+
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	t->wall = (double) ts.tv_sec + (double) ts.tv_nsec / 1e9;
+	t->cpu = (double) clock () / CLOCKS_PER_SEC;
+#else
+	t->wall = t->cpu = (double) clock () / CLOCKS_PER_SEC;
+#endif
+}
+
+extern void addPartialTotals (const partialTotals *const partial)
+{
+	PartialTotals.skipped += partial->skipped;
+	PartialTotals.truncated += partial->truncated;
+	PartialTotals.topLevel += partial->topLevel;
+	PartialTotals.bytes += partial->bytes;
+	PartialTotals.overBudget += partial->overBudget;
+	PartialTotals.duplicates += partial->duplicates;
+}
+
+extern void getPartialTotals (partialTotals *const partial)
+{
+	*partial = PartialTotals;
+}
+
+extern void addMemoryTotals (const memoryTotals *const memory)
+{
+	MemoryTotals.streamed += memory->streamed;
+	MemoryTotals.mlineSkipped += memory->mlineSkipped;
+	MemoryTotals.corkFlushed += memory->corkFlushed;
+	MemoryTotals.spilled += memory->spilled;
+	if (memory->peak > MemoryTotals.peak)
+		MemoryTotals.peak = memory->peak;
+}
+
+extern void getMemoryTotals (memoryTotals *const memory)
+{
+	*memory = MemoryTotals;
+	if (Option.memoryLimit > 0 && getMemoryPeak () > memory->peak)
+		memory->peak = getMemoryPeak ();
+}
+
+extern void enableMetrics (void)
+{
+	MetricsEnabled = true;
+}
+
+extern bool isTotalsEnabled (void)
+{
+	return Option.printTotals || MetricsEnabled;
+}
+
+extern bool isStatsBreakdownEnabled (void)
+{
+	return Option.printTotals > 1 || MetricsEnabled;
+}
+
+extern void startStatsPhase (statsTime *start)
+{
+	if (isStatsBreakdownEnabled ())
+		readStatsTime (start);
+}
+
+static void addStatsTime (statsTime *sum, const statsTime *const start)
+{
+	statsTime now;
+
+	readStatsTime (&now);
+	sum->wall += now.wall - start->wall;
+	sum->cpu += now.cpu - start->cpu;
+}
+
+extern void endStatsPhase (statsPhase phase, const statsTime *const start)
+{
+	if (isStatsBreakdownEnabled ())
+		addStatsTime (PhaseTimes + phase, start);
+}
+
+static languageStats *getLanguageStats (langType language)
+{
+	if (LanguageStats == NULL)
+	{
+		LanguageStatsCount = countParsers ();
+		LanguageStats = xCalloc (LanguageStatsCount, languageStats);
+	}
+	return ((unsigned int) language < LanguageStatsCount)
+		? LanguageStats + language
+		: NULL;
+}
+
+static void addLanguageStats (langType language, unsigned long files,
+							  unsigned long lines, unsigned long bytes,
+							  unsigned long tags, const statsTime *const time)
+{
+	languageStats *stats = getLanguageStats (language);
+
+	if (stats == NULL)
+		return;
+
+	stats->files += files;
+	stats->lines += lines;
+	stats->bytes += bytes;
+	stats->tags += tags;
+	stats->time.wall += time->wall;
+	stats->time.cpu += time->cpu;
+}
+
+/* Take the ownership of FILE->name. */
+static void addSlowFile (fileStats *file)
+{
+	unsigned int i;
+
+	if (SlowFiles == NULL)
+		SlowFiles = xMalloc (Option.slowFiles, fileStats);
+
+	if (SlowFileCount == Option.slowFiles
+		&& SlowFiles [SlowFileCount - 1].time.wall >= file->time.wall)
+	{
+		eFree (file->name);
+		return;
+	}
+
+	if (SlowFileCount == Option.slowFiles)
+		eFree (SlowFiles [--SlowFileCount].name);
+	for (i = SlowFileCount; i > 0 && SlowFiles [i - 1].time.wall < file->time.wall; i--)
+		SlowFiles [i] = SlowFiles [i - 1];
+	SlowFiles [i] = *file;
+	SlowFileCount++;
+}
+
+extern bool isFileStatsEnabled (void)
+{
+	return isStatsBreakdownEnabled () || Option.slowFiles > 0;
+}
+
+/* A guest parser rescanning an area of the input counts for the
+ * language of the guest. */
+extern void addStatsRescans (langType language, unsigned int count,
+							 unsigned long bytes)
+{
+	languageStats *stats;
+
+	if (count == 0)
+		return;
+
+	FileRescans += count;
+	if (isStatsBreakdownEnabled () && (stats = getLanguageStats (language)))
+	{
+		stats->rescans += count;
+		stats->rescannedBytes += bytes;
+	}
+}
+
+extern void addFileStats (const char *const fileName, langType language,
+						  unsigned long lines, unsigned long bytes,
+						  unsigned long tags, const statsTime *const start)
+{
+	statsTime time;
+	fileStats file;
+
+	if (!isFileStatsEnabled ())
+		return;
+
+	readStatsTime (&time);
+	time.wall -= start->wall;
+	time.cpu -= start->cpu;
+
+	if (isStatsBreakdownEnabled ())
+	{
+		unsigned int i = 0;
+
+		addLanguageStats (language, 1, lines, bytes, tags, &time);
+		while (i < COUNT_PARSE_TIME_BOUNDS && time.wall > ParseTimeBounds [i])
+			i++;
+		ParseTimes.counts [i]++;
+		ParseTimes.sum += time.wall;
+	}
+
+	if (Option.slowFiles > 0)
+	{
+		file.name = eStrdup (fileName);
+		file.language = language;
+		file.bytes = bytes;
+		file.tags = tags;
+		file.rescans = FileRescans;
+		file.time = time;
+		addSlowFile (&file);
+	}
+	FileRescans = 0;
+}
+
+extern void addWorkerStats (unsigned int worker, const workerStats *const stats)
+{
+	workerStats *w;
+
+	if (worker >= WorkerStatsCount)
+	{
+		WorkerStats = xRealloc (WorkerStats, worker + 1, workerStats);
+		memset (WorkerStats + WorkerStatsCount, 0,
+				sizeof (workerStats) * (worker + 1 - WorkerStatsCount));
+		WorkerStatsCount = worker + 1;
+	}
+
+	w = WorkerStats + worker;
+	w->jobs += stats->jobs;
+	w->stolen += stats->stolen;
+	w->cost += stats->cost;
+	w->busy += stats->busy;
+	w->wall += stats->wall;
+}
+
+static double getWorkerUtilization (const workerStats *const w)
+{
+	return (w->wall > 0.0)? 100.0 * w->busy / w->wall: 0.0;
+}
+
+static void printWorkerSummary (void)
+{
+	double sum = 0.0, min = 0.0, max = 0.0;
+
+	for (unsigned int i = 0; i < WorkerStatsCount; i++)
+	{
+		double u = getWorkerUtilization (WorkerStats + i);
+
+		sum += u;
+		if (i == 0 || u < min)
+			min = u;
+		if (i == 0 || u > max)
+			max = u;
+	}
+	fprintf (stderr, "%u worker%s busy %.0f%% of the time on average (%.0f%% to %.0f%%)\n",
+			 WorkerStatsCount, plural (WorkerStatsCount),
+			 sum / WorkerStatsCount, min, max);
+}
+
+static void printWorkerStats (void)
+{
+	fputs ("\nPER-WORKER TOTALS\n", stderr);
+	fputs ("==============================================\n", stderr);
+	fprintf (stderr, "%-8s %8s %8s %12s %9s %9s %6s\n",
+			 "worker", "jobs", "stolen", "cost", "busy(s)", "wall(s)", "util");
+	for (unsigned int i = 0; i < WorkerStatsCount; i++)
+	{
+		const workerStats *w = WorkerStats + i;
+
+		fprintf (stderr, "%-8u %8lu %8lu %12lu %9.3f %9.3f %5.1f%%\n",
+				 i, w->jobs, w->stolen, w->cost, w->busy, w->wall,
+				 getWorkerUtilization (w));
+	}
+}
+
+extern void addStatsAllocations (unsigned long count)
+{
+	WorkerAllocations += count;
+}
+
+/* The record is the phase times, the histogram of the parse times, the
+ * statistics of all the languages, the number of the slowest files,
+ * and the slowest files each followed by the length of its name and the
+ * name. */
+extern size_t getStatsRecordSize (void)
+{
+	size_t size = sizeof (PhaseTimes) + sizeof (ParseTimes)
+		+ sizeof (languageStats) * countParsers () + sizeof (SlowFileCount);
+
+	for (unsigned int i = 0; i < SlowFileCount; i++)
+		size += sizeof (fileStats) + sizeof (size_t) + strlen (SlowFiles [i].name);
+	return size;
+}
+
+extern void writeStatsRecord (void *buf)
+{
+	char *p = buf;
+
+	memcpy (p, PhaseTimes, sizeof (PhaseTimes));
+	p += sizeof (PhaseTimes);
+	memcpy (p, &ParseTimes, sizeof (ParseTimes));
+	p += sizeof (ParseTimes);
+	for (unsigned int i = 0; i < countParsers (); i++)
+	{
+		languageStats zero = { 0 };
+		const languageStats *stats = (i < LanguageStatsCount)? LanguageStats + i: &zero;
+
+		memcpy (p, stats, sizeof (languageStats));
+		p += sizeof (languageStats);
+	}
+
+	memcpy (p, &SlowFileCount, sizeof (SlowFileCount));
+	p += sizeof (SlowFileCount);
+	for (unsigned int i = 0; i < SlowFileCount; i++)
+	{
+		size_t length = strlen (SlowFiles [i].name);
+
+		memcpy (p, SlowFiles + i, sizeof (fileStats));
+		p += sizeof (fileStats);
+		memcpy (p, &length, sizeof (length));
+		p += sizeof (length);
+		memcpy (p, SlowFiles [i].name, length);
+		p += length;
+	}
+}
+
+extern bool mergeStatsRecord (const void *buf, size_t size)
+{
+	const char *p = buf;
+	const char *const end = p + size;
+	statsTime phases [COUNT_STATS_PHASE];
+	parseTimeHistogram parseTimes;
+	unsigned int slowFileCount;
+
+	if (size < sizeof (phases) + sizeof (parseTimes)
+		+ sizeof (languageStats) * countParsers () + sizeof (slowFileCount))
+		return false;
+
+	memcpy (phases, p, sizeof (phases));
+	p += sizeof (phases);
+	for (unsigned int i = 0; i < COUNT_STATS_PHASE; i++)
+	{
+		PhaseTimes [i].wall += phases [i].wall;
+		PhaseTimes [i].cpu += phases [i].cpu;
+	}
+
+	memcpy (&parseTimes, p, sizeof (parseTimes));
+	p += sizeof (parseTimes);
+	for (unsigned int i = 0; i <= COUNT_PARSE_TIME_BOUNDS; i++)
+		ParseTimes.counts [i] += parseTimes.counts [i];
+	ParseTimes.sum += parseTimes.sum;
+
+	for (unsigned int i = 0; i < countParsers (); i++)
+	{
+		languageStats in;
+
+		memcpy (&in, p, sizeof (in));
+		p += sizeof (in);
+		if (in.files == 0 && in.rescans == 0)
+			continue;
+		addLanguageStats (i, in.files, in.lines, in.bytes, in.tags, &in.time);
+		LanguageStats [i].rescans += in.rescans;
+		LanguageStats [i].rescannedBytes += in.rescannedBytes;
+	}
+
+	memcpy (&slowFileCount, p, sizeof (slowFileCount));
+	p += sizeof (slowFileCount);
+	for (unsigned int i = 0; i < slowFileCount; i++)
+	{
+		fileStats file;
+		size_t length;
+
+		if ((size_t) (end - p) < sizeof (file) + sizeof (length))
+			return false;
+		memcpy (&file, p, sizeof (file));
+		p += sizeof (file);
+		memcpy (&length, p, sizeof (length));
+		p += sizeof (length);
+		if ((size_t) (end - p) < length || Option.slowFiles == 0)
+			return false;
+		file.name = eStrndup (p, length);
+		p += length;
+		addSlowFile (&file);
+	}
+
+	return p == end;
+}
+
+/* A worker process forked while parsing starts with the statistics of
+ * the parent process. They are cleared so that the record of the worker
+ * doesn't count them twice. */
+extern void clearStatsRecord (void)
+{
+	memset (PhaseTimes, 0, sizeof (PhaseTimes));
+	memset (&ParseTimes, 0, sizeof (ParseTimes));
+	if (LanguageStats)
+		memset (LanguageStats, 0, sizeof (languageStats) * LanguageStatsCount);
+	for (unsigned int i = 0; i < SlowFileCount; i++)
+		eFree (SlowFiles [i].name);
+	SlowFileCount = 0;
+}
+
+static void printStatsBreakdown (void)
+{
+	fputs ("\nPER-LANGUAGE TOTALS\n", stderr);
+	fputs ("==============================================\n", stderr);
+	fprintf (stderr, "%-16s %8s %10s %12s %10s %8s %12s %9s %9s\n",
+			 "language", "files", "lines", "bytes", "tags",
+			 "rescans", "reread", "wall(s)", "cpu(s)");
+	for (unsigned int i = 0; i < LanguageStatsCount; i++)
+	{
+		const languageStats *stats = LanguageStats + i;
+
+		if (stats->files == 0 && stats->rescans == 0)
+			continue;
+		fprintf (stderr, "%-16s %8lu %10lu %12lu %10lu %8lu %12lu %9.3f %9.3f\n",
+				 getLanguageName (i),
+				 stats->files, stats->lines, stats->bytes, stats->tags,
+				 stats->rescans, stats->rescannedBytes,
+				 stats->time.wall, stats->time.cpu);
+	}
+
+	/* The time for writing tags includes the time for the tags
+	 * written in uncorking. */
+	fputs ("\nPER-PHASE TOTALS\n", stderr);
+	fputs ("==============================================\n", stderr);
+	fprintf (stderr, "%-16s %9s %9s\n", "phase", "wall(s)", "cpu(s)");
+	for (unsigned int i = 0; i < COUNT_STATS_PHASE; i++)
+		fprintf (stderr, "%-16s %9.3f %9.3f\n",
+				 PhaseNames [i], PhaseTimes [i].wall, PhaseTimes [i].cpu);
+}
+
+static void printSlowFiles (void)
+{
+	fputs ("\nSLOWEST FILES\n", stderr);
+	fputs ("==============================================\n", stderr);
+	fprintf (stderr, "%9s %9s %12s %10s %8s %-16s %s\n",
+			 "wall(s)", "cpu(s)", "bytes", "tags", "rescans", "language", "file");
+	for (unsigned int i = 0; i < SlowFileCount; i++)
+	{
+		const fileStats *file = SlowFiles + i;
+
+		fprintf (stderr, "%9.3f %9.3f %12lu %10lu %8u %-16s %s\n",
+				 file->time.wall, file->time.cpu,
+				 file->bytes, file->tags, file->rescans,
+				 getLanguageName (file->language), file->name);
+	}
+}
+
+static void printStringAsJSON (FILE *fp, const char *s)
+{
+	fputc ('"', fp);
+	for (; *s; s++)
+	{
+		if (*s == '"' || *s == '\\')
+			fprintf (fp, "\\%c", *s);
+		else if ((unsigned char) *s < 0x20)
+			fprintf (fp, "\\u%04x", (unsigned char) *s);
+		else
+			fputc (*s, fp);
+	}
+	fputc ('"', fp);
+}
+
+static void printStatsTimeAsJSON (FILE *fp, const statsTime *const t)
+{
+	fprintf (fp, "{\"wall\": %.6f, \"cpu\": %.6f}", t->wall, t->cpu);
+}
+
+/* The peak resident set size in bytes of this process, or of the
+ * largest of its children, the --jobs workers, waited for. 0 if it is
+ * unknown. */
+static unsigned long getPeakRss (bool children)
+{
+#if defined (HAVE_SYS_RESOURCE_H) && defined (HAVE_GETRUSAGE)
+	struct rusage usage;
+
+	if (getrusage (children? RUSAGE_CHILDREN: RUSAGE_SELF, &usage) != 0)
+		return 0;
+# ifdef __APPLE__
+	return (unsigned long) usage.ru_maxrss;
+# else
+	return (unsigned long) usage.ru_maxrss * 1024UL;
+# endif
+#else
+	return 0;
+#endif
+}
+
+static statsTime getScanTime (const statsTime *const timeStamps)
+{
+	statsTime scan = {
+		.wall = timeStamps [1].wall - timeStamps [0].wall,
+		.cpu  = timeStamps [1].cpu  - timeStamps [0].cpu,
+	};
+
+	return scan;
+}
+
+/* Language names consist of the characters needing no escape in JSON. */
+static void printTotalsAsJSON (FILE *fp, const statsTime *const timeStamps)
+{
+	statsTime scan = getScanTime (timeStamps);
+	bool first = true;
+	memoryTotals memory;
+
+	getMemoryTotals (&memory);
+	fprintf (fp, "{\"files\": %ld, \"lines\": %ld, \"bytes\": %ld, \"tags\": %lu, \"total\": %lu, \"allocations\": %lu, \"scan\": ",
+			 Totals.files, Totals.lines, Totals.bytes,
+			 numTagsAdded (), numTagsTotal (),
+			 getAllocationCount () + WorkerAllocations);
+	printStatsTimeAsJSON (fp, &scan);
+
+	fprintf (fp, ", \"minified\": {\"skipped\": %lu, \"truncated\": %lu, \"toplevel\": %lu, \"bytes\": %lu}",
+			 PartialTotals.skipped, PartialTotals.truncated,
+			 PartialTotals.topLevel, PartialTotals.bytes);
+	fprintf (fp, ", \"over_budget\": %lu", PartialTotals.overBudget);
+	fprintf (fp, ", \"duplicates\": %lu", PartialTotals.duplicates);
+	fprintf (fp, ", \"memory\": {\"limit\": %lu, \"peak\": %lu, \"streamed\": %lu, \"mline_skipped\": %lu, \"cork_flushed\": %lu, \"spilled\": %lu}",
+			 Option.memoryLimit, (unsigned long) memory.peak,
+			 memory.streamed, memory.mlineSkipped,
+			 memory.corkFlushed, memory.spilled);
+	fprintf (fp, ", \"peak_rss\": {\"self\": %lu, \"workers\": %lu}",
+			 getPeakRss (false), getPeakRss (true));
+
+	fputs (", \"languages\": {", fp);
+	for (unsigned int i = 0; i < LanguageStatsCount; i++)
+	{
+		const languageStats *stats = LanguageStats + i;
+
+		if (stats->files == 0 && stats->rescans == 0)
+			continue;
+		fprintf (fp, "%s\"%s\": {\"files\": %lu, \"lines\": %lu, \"bytes\": %lu, \"tags\": %lu, \"rescans\": %lu, \"rescanned_bytes\": %lu, \"time\": ",
+				 first? "": ", ", getLanguageName (i),
+				 stats->files, stats->lines, stats->bytes, stats->tags,
+				 stats->rescans, stats->rescannedBytes);
+		printStatsTimeAsJSON (fp, &stats->time);
+		fputc ('}', fp);
+		first = false;
+	}
+
+	fputs ("}, \"phases\": {", fp);
+	for (unsigned int i = 0; i < COUNT_STATS_PHASE; i++)
+	{
+		fprintf (fp, "%s\"%s\": ", i? ", ": "", PhaseNames [i]);
+		printStatsTimeAsJSON (fp, PhaseTimes + i);
+	}
+
+	fputs ("}, \"parse_time\": {\"bounds\": [", fp);
+	for (unsigned int i = 0; i < COUNT_PARSE_TIME_BOUNDS; i++)
+		fprintf (fp, "%s%g", i? ", ": "", ParseTimeBounds [i]);
+	fputs ("], \"counts\": [", fp);
+	for (unsigned int i = 0; i <= COUNT_PARSE_TIME_BOUNDS; i++)
+		fprintf (fp, "%s%lu", i? ", ": "", ParseTimes.counts [i]);
+	fprintf (fp, "], \"sum\": %.6f", ParseTimes.sum);
+
+	fputs ("}, \"slowest\": [", fp);
+	for (unsigned int i = 0; i < SlowFileCount; i++)
+	{
+		const fileStats *file = SlowFiles + i;
+
+		fputs (i? ", {\"file\": ": "{\"file\": ", fp);
+		printStringAsJSON (fp, file->name);
+		fprintf (fp, ", \"language\": \"%s\", \"bytes\": %lu, \"tags\": %lu, \"rescans\": %u, \"time\": ",
+				 getLanguageName (file->language),
+				 file->bytes, file->tags, file->rescans);
+		printStatsTimeAsJSON (fp, &file->time);
+		fputc ('}', fp);
+	}
+
+	fputs ("], \"workers\": [", fp);
+	for (unsigned int i = 0; i < WorkerStatsCount; i++)
+	{
+		const workerStats *w = WorkerStats + i;
+
+		fprintf (fp, "%s{\"jobs\": %lu, \"stolen\": %lu, \"cost\": %lu, \"busy\": %.6f, \"wall\": %.6f}",
+				 i? ", ": "", w->jobs, w->stolen, w->cost, w->busy, w->wall);
+	}
+	fputs ("]}\n", fp);
+}
+
+static void printMetricFamily (FILE *fp, const char *name, const char *type,
+							   const char *help)
+{
+	fprintf (fp, "# TYPE ctags_%s %s\n", name, type);
+	fprintf (fp, "# HELP ctags_%s %s\n", name, help);
+}
+
+static void printTimeMetric (FILE *fp, const char *name, const char *labels,
+							 const statsTime *const t)
+{
+	fprintf (fp, "ctags_%s{%s%sclock=\"wall\"} %.6f\n", name,
+			 labels, *labels? ",": "", t->wall);
+	fprintf (fp, "ctags_%s{%s%sclock=\"cpu\"} %.6f\n", name,
+			 labels, *labels? ",": "", t->cpu);
+}
+
+/* The statistics in the OpenMetrics text format. The counters of the
+ * languages, the phases, and the workers are labeled. */
+static void printTotalsAsOpenMetrics (FILE *fp, const statsTime *const timeStamps)
+{
+	static const struct {
+		const char *name, *help;
+		size_t offset;
+	} languageCounters [] = {
+		{ "language_files", "Input files parsed.", offsetof (languageStats, files) },
+		{ "language_lines", "Lines of the input files parsed.", offsetof (languageStats, lines) },
+		{ "language_bytes", "Bytes of the input files parsed.", offsetof (languageStats, bytes) },
+		{ "language_tags", "Tags made.", offsetof (languageStats, tags) },
+		{ "language_rescans", "Rescans of input files.", offsetof (languageStats, rescans) },
+		{ "language_rescanned_bytes", "Bytes read again in rescans.", offsetof (languageStats, rescannedBytes) },
+	};
+	statsTime scan = getScanTime (timeStamps);
+	memoryTotals memory;
+	vString *labels = vStringNew ();
+	unsigned long cumulative = 0;
+
+	getMemoryTotals (&memory);
+
+	printMetricFamily (fp, "files", "counter", "Input files read.");
+	fprintf (fp, "ctags_files_total %ld\n", Totals.files);
+	printMetricFamily (fp, "lines", "counter", "Lines of the input files read.");
+	fprintf (fp, "ctags_lines_total %ld\n", Totals.lines);
+	printMetricFamily (fp, "bytes", "counter", "Bytes of the input files read.");
+	fprintf (fp, "ctags_bytes_total %ld\n", Totals.bytes);
+	printMetricFamily (fp, "tags_added", "counter", "Tags added to the tag file.");
+	fprintf (fp, "ctags_tags_added_total %lu\n", numTagsAdded ());
+	printMetricFamily (fp, "tags", "gauge", "Tags in the tag file.");
+	fprintf (fp, "ctags_tags %lu\n", numTagsTotal ());
+	printMetricFamily (fp, "scan_seconds", "gauge", "Time spent in reading the input files.");
+	printTimeMetric (fp, "scan_seconds", "", &scan);
+
+	printMetricFamily (fp, "minified_files", "counter", "Input files looking minified.");
+	fprintf (fp, "ctags_minified_files_total{action=\"skipped\"} %lu\n", PartialTotals.skipped);
+	fprintf (fp, "ctags_minified_files_total{action=\"truncated\"} %lu\n", PartialTotals.truncated);
+	fprintf (fp, "ctags_minified_files_total{action=\"toplevel\"} %lu\n", PartialTotals.topLevel);
+	printMetricFamily (fp, "over_budget_files", "counter", "Input files stopped at --max-file-time or --max-file-bytes.");
+	fprintf (fp, "ctags_over_budget_files_total %lu\n", PartialTotals.overBudget);
+	printMetricFamily (fp, "duplicate_files", "counter", "Input files tagged from the tags of a file with the same contents.");
+	fprintf (fp, "ctags_duplicate_files_total %lu\n", PartialTotals.duplicates);
+	printMetricFamily (fp, "memory_peak_bytes", "gauge", "The most bytes counted for --memory-limit.");
+	fprintf (fp, "ctags_memory_peak_bytes %lu\n", (unsigned long) memory.peak);
+	printMetricFamily (fp, "peak_rss_bytes", "gauge", "The peak resident set size.");
+	fprintf (fp, "ctags_peak_rss_bytes{process=\"self\"} %lu\n", getPeakRss (false));
+	fprintf (fp, "ctags_peak_rss_bytes{process=\"workers\"} %lu\n", getPeakRss (true));
+
+	for (unsigned int c = 0; c < ARRAY_SIZE (languageCounters); c++)
+	{
+		printMetricFamily (fp, languageCounters [c].name, "counter", languageCounters [c].help);
+		for (unsigned int i = 0; i < LanguageStatsCount; i++)
+		{
+			const languageStats *stats = LanguageStats + i;
+
+			if (stats->files == 0 && stats->rescans == 0)
+				continue;
+			fprintf (fp, "ctags_%s_total{language=\"%s\"} %lu\n",
+					 languageCounters [c].name, getLanguageName (i),
+					 *(const unsigned long *) ((const char *) stats + languageCounters [c].offset));
+		}
+	}
+	printMetricFamily (fp, "language_seconds", "counter", "Time spent in parsing the input files.");
+	for (unsigned int i = 0; i < LanguageStatsCount; i++)
+	{
+		const languageStats *stats = LanguageStats + i;
+
+		if (stats->files == 0 && stats->rescans == 0)
+			continue;
+		vStringCopyS (labels, "language=\"");
+		vStringCatS (labels, getLanguageName (i));
+		vStringPut (labels, '"');
+		printTimeMetric (fp, "language_seconds_total", vStringValue (labels), &stats->time);
+	}
+
+	printMetricFamily (fp, "phase_seconds", "counter", "Time spent in each phase of making tags.");
+	for (unsigned int i = 0; i < COUNT_STATS_PHASE; i++)
+	{
+		vStringCopyS (labels, "phase=\"");
+		vStringCatS (labels, PhaseNames [i]);
+		vStringPut (labels, '"');
+		printTimeMetric (fp, "phase_seconds_total", vStringValue (labels), PhaseTimes + i);
+	}
+
+	printMetricFamily (fp, "parse_seconds", "histogram", "Wall-clock time for parsing an input file.");
+	for (unsigned int i = 0; i < COUNT_PARSE_TIME_BOUNDS; i++)
+	{
+		cumulative += ParseTimes.counts [i];
+		fprintf (fp, "ctags_parse_seconds_bucket{le=\"%g\"} %lu\n",
+				 ParseTimeBounds [i], cumulative);
+	}
+	cumulative += ParseTimes.counts [COUNT_PARSE_TIME_BOUNDS];
+	fprintf (fp, "ctags_parse_seconds_bucket{le=\"+Inf\"} %lu\n", cumulative);
+	fprintf (fp, "ctags_parse_seconds_count %lu\n", cumulative);
+	fprintf (fp, "ctags_parse_seconds_sum %.6f\n", ParseTimes.sum);
+
+	if (WorkerStatsCount > 0)
+	{
+		printMetricFamily (fp, "worker_jobs", "counter", "Jobs run by each --jobs worker.");
+		for (unsigned int i = 0; i < WorkerStatsCount; i++)
+			fprintf (fp, "ctags_worker_jobs_total{worker=\"%u\"} %lu\n", i, WorkerStats [i].jobs);
+		printMetricFamily (fp, "worker_busy_seconds", "counter", "Time each --jobs worker spent in running jobs.");
+		for (unsigned int i = 0; i < WorkerStatsCount; i++)
+			fprintf (fp, "ctags_worker_busy_seconds_total{worker=\"%u\"} %.6f\n", i, WorkerStats [i].busy);
+	}
+
+	fputs ("# EOF\n", fp);
+	vStringDelete (labels);
+}
+
+/* The time of sorting is measured by the caller. */
+static void setSortTime (const statsTime *const timeStamps)
+{
+	PhaseTimes [STATS_PHASE_SORT].wall = timeStamps [2].wall - timeStamps [1].wall;
+	PhaseTimes [STATS_PHASE_SORT].cpu = timeStamps [2].cpu - timeStamps [1].cpu;
+}
+
+extern void writeMetrics (FILE *fp, metricsFormat format,
+						  const statsTime *const timeStamps)
+{
+	setSortTime (timeStamps);
+	if (format == METRICS_JSON)
+		printTotalsAsJSON (fp, timeStamps);
+	else
+		printTotalsAsOpenMetrics (fp, timeStamps);
+}
+
+extern void writeMetricsFile (const statsTime *const timeStamps)
+{
+	FILE *fp = fopen (Option.metricsFile, "w");
+
+	if (fp == NULL)
+	{
+		error (WARNING | PERROR, "cannot open metrics file \"%s\"", Option.metricsFile);
+		return;
+	}
+	writeMetrics (fp, Option.metricsFormat, timeStamps);
+	if (fclose (fp) != 0)
+		error (WARNING | PERROR, "cannot write metrics file \"%s\"", Option.metricsFile);
+}
+
+static void printMemoryTotals (void)
+{
+	memoryTotals memory;
+
+	getMemoryTotals (&memory);
+	fprintf (stderr, "%lu kB of %lu kB of --memory-limit used at most\n",
+			 (unsigned long) memory.peak/1024L, Option.memoryLimit/1024L);
+	if (memory.streamed > 0)
+		fprintf (stderr, "%lu input file%s read from the disk instead of memory\n",
+				 memory.streamed, plural (memory.streamed));
+	if (memory.mlineSkipped > 0)
+		fprintf (stderr, "%lu input file%s not matched with multiline regex patterns\n",
+				 memory.mlineSkipped, plural (memory.mlineSkipped));
+	if (memory.corkFlushed > 0)
+		fprintf (stderr, "%lu cork queue%s written before the end of the input file\n",
+				 memory.corkFlushed, plural (memory.corkFlushed));
+	if (memory.spilled > 0)
+		fprintf (stderr, "tags spilled to the disk early %lu time%s\n",
+				 memory.spilled, plural (memory.spilled));
+}
+
+extern void printTotals (const statsTime *const timeStamps, bool append, sortType sorted)
 {
 	const unsigned long totalTags = numTagsTotal();
 	const unsigned long addedTags = numTagsAdded();
 
+	if (Option.printTotals > 1)
+		setSortTime (timeStamps);
+
+	if (Option.printTotals == 3)
+	{
+		printTotalsAsJSON (stderr, timeStamps);
+		return;
+	}
+
 	fprintf (stderr, "%ld file%s, %ld line%s (%ld kB) scanned",
 			Totals.files, plural (Totals.files),
 			Totals.lines, plural (Totals.lines),
 			Totals.bytes/1024L);
 
-	const double interval = ((double) (timeStamps [1] - timeStamps [0])) /
-							CLOCKS_PER_SEC;
+	const double interval = timeStamps [1].cpu - timeStamps [0].cpu;
 
 	fprintf (stderr, " in %.01f seconds", interval);
 	if (interval != (double) 0.0)
@@ -64,6 +889,28 @@ extern void printTotals (const clock_t *const timeStamps, bool append, sortType
 
 	fputc ('\n', stderr);
 
+	if (PartialTotals.skipped > 0)
+		fprintf (stderr, "%lu minified file%s skipped\n",
+				 PartialTotals.skipped, plural (PartialTotals.skipped));
+	if (PartialTotals.truncated > 0)
+		fprintf (stderr, "%lu minified file%s truncated\n",
+				 PartialTotals.truncated, plural (PartialTotals.truncated));
+	if (PartialTotals.topLevel > 0)
+		fprintf (stderr, "%lu minified file%s parsed for top-level tags only\n",
+				 PartialTotals.topLevel, plural (PartialTotals.topLevel));
+	if (PartialTotals.bytes > 0)
+		fprintf (stderr, "%lu kB of minified files not parsed\n",
+				 PartialTotals.bytes/1024L);
+	if (PartialTotals.overBudget > 0)
+		fprintf (stderr, "%lu file%s stopped at --max-file-time or --max-file-bytes\n",
+				 PartialTotals.overBudget, plural (PartialTotals.overBudget));
+	if (PartialTotals.duplicates > 0)
+		fprintf (stderr, "%lu file%s tagged from the tags of a file with the same contents\n",
+				 PartialTotals.duplicates, plural (PartialTotals.duplicates));
+
+	if (Option.memoryLimit > 0)
+		printMemoryTotals ();
+
 	fprintf (stderr, "%lu tag%s added to tag file",
 			addedTags, plural(addedTags));
 	if (append)
@@ -74,12 +921,22 @@ extern void printTotals (const clock_t *const timeStamps, bool append, sortType
 	{
 		fprintf (stderr, "%lu tag%s sorted", totalTags, plural (totalTags));
 		fprintf (stderr, " in %.02f seconds",
-				((double) (timeStamps [2] - timeStamps [1])) / CLOCKS_PER_SEC);
+				timeStamps [2].cpu - timeStamps [1].cpu);
 		fputc ('\n', stderr);
 	}
 
+	if (WorkerStatsCount > 0)
+		printWorkerSummary ();
+
 #ifdef DEBUG
 	fprintf (stderr, "longest tag line = %lu\n",
 		 (unsigned long) maxTagsLine ());
 #endif
+
+	if (Option.printTotals > 1)
+		printStatsBreakdown ();
+	if (Option.printTotals > 1 && WorkerStatsCount > 0)
+		printWorkerStats ();
+	if (Option.slowFiles > 0)
+		printSlowFiles ();
 }
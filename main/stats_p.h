@@ -18,11 +18,110 @@
 */
 #include "general.h"  /* must always come first */
 #include "options_p.h"
+#include "types.h"
+
+#include <stddef.h>
+#include <stdio.h>
+
+/*
+*   DATA DECLARATIONS
+*/
+
+/* The phases of making tags timed for --totals=extra. */
+typedef enum eStatsPhase {
+	STATS_PHASE_GUESS,			/* choosing the parser for an input file */
+	STATS_PHASE_REGEX,			/* matching regex patterns */
+	STATS_PHASE_UNCORK,			/* emitting the corked tags */
+	STATS_PHASE_WRITE,			/* writing tags to the tag file */
+	STATS_PHASE_SORT,			/* closing and sorting the tag file */
+	COUNT_STATS_PHASE
+} statsPhase;
+
+/* The input files not parsed wholly */
+typedef struct sPartialTotals {
+	/* looking minified for --minified=<policy> */
+	unsigned long skipped, truncated, topLevel;
+	unsigned long bytes;		/* not parsed in the skipped and truncated files */
+	/* stopped by --max-file-time or --max-file-bytes */
+	unsigned long overBudget;
+	/* tagged from the tags of a file with the same contents for
+	 * --dedup-content */
+	unsigned long duplicates;
+} partialTotals;
+
+/* The work done in the low-memory modes of the subsystems when the
+ * memory got tight under --memory-limit */
+typedef struct sMemoryTotals {
+	unsigned long streamed;		/* input files read from the disk, not memory */
+	unsigned long mlineSkipped;	/* input files not matched with the regex
+								   patterns needing all the lines */
+	unsigned long corkFlushed;	/* cork queues written before the end of
+								   the input file */
+	unsigned long spilled;		/* tag files and sort runs written to the
+								   disk before reaching --sort-memory-limit */
+	size_t peak;				/* the most bytes counted in a process */
+} memoryTotals;
+
+typedef struct sStatsTime {
+	double wall;				/* in seconds */
+	double cpu;
+} statsTime;
+
+/* The work done by a --jobs worker */
+typedef struct sWorkerStats {
+	unsigned long jobs;			/* run by the worker */
+	unsigned long stolen;		/* of the jobs, taken from the other workers */
+	unsigned long cost;			/* of the jobs, like the bytes of input files */
+	double busy;				/* seconds spent in running the jobs */
+	double wall;				/* seconds from starting to stopping the workers */
+} workerStats;
 
 /*
 *   FUNCTION PROTOTYPES
 */
 extern void addTotals (const unsigned int files, const long unsigned int lines, const long unsigned int bytes);
-extern void printTotals (const clock_t *const timeStamps, bool append, sortType sorted);
+extern void getTotals (long *const files, long *const lines, long *const bytes);
+extern void printTotals (const statsTime *const timeStamps, bool append, sortType sorted);
+
+extern void addPartialTotals (const partialTotals *const partial);
+extern void getPartialTotals (partialTotals *const partial);
+
+extern void addMemoryTotals (const memoryTotals *const memory);
+extern void getMemoryTotals (memoryTotals *const memory);
+
+extern void readStatsTime (statsTime *t);
+
+/* The metrics are the statistics of --totals=json written for a
+ * monitoring system. Enabling them enables the collection of the
+ * statistics even without --totals. */
+extern void enableMetrics (void);
+extern bool isTotalsEnabled (void);
+extern void writeMetrics (FILE *fp, metricsFormat format,
+						  const statsTime *const timeStamps);
+extern void writeMetricsFile (const statsTime *const timeStamps);
+
+/* Per-phase and per-language statistics are collected only with
+ * --totals=extra, --totals=json, or the metrics enabled. */
+extern bool isStatsBreakdownEnabled (void);
+extern void startStatsPhase (statsTime *start);
+extern void endStatsPhase (statsPhase phase, const statsTime *const start);
+
+/* Per-file statistics are collected for the breakdown and for
+ * --totals=slow:N. */
+extern bool isFileStatsEnabled (void);
+extern void addStatsRescans (langType language, unsigned int count,
+							 unsigned long bytes);
+extern void addFileStats (const char *const fileName, langType language,
+						  unsigned long lines, unsigned long bytes,
+						  unsigned long tags, const statsTime *const start);
+
+/* For passing the statistics collected in a --jobs worker to the
+ * parent process. */
+extern void addWorkerStats (unsigned int worker, const workerStats *const stats);
+extern void addStatsAllocations (unsigned long count);
+extern size_t getStatsRecordSize (void);
+extern void writeStatsRecord (void *buf);
+extern bool mergeStatsRecord (const void *buf, size_t size);
+extern void clearStatsRecord (void);
 
 #endif  /* CTAGS_MAIN_STATS_PRIVATE_H */
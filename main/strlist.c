@@ -222,7 +222,7 @@ extern vString* stringListCaseFinds (const stringList* const list, const char* c
 	return stringListFinds (list, str, compareStringInsensitive);
 }
 
-static bool fileNameMatched (
+extern bool fileNameMatched (
 		const vString* const vpattern, const char* const fileName)
 {
 	const char* const pattern = vStringValue (vpattern);
@@ -65,6 +65,9 @@ extern vString* stringListFileFinds (const stringList* const list, const char* c
 extern bool stringListCaseMatched (const stringList* const list, const char* const str);
 extern vString* stringListCaseFinds (const stringList* const list, const char* const str);
 
+/* The glob-matching stringListFile{Matched,Finds} do with each item. */
+extern bool fileNameMatched (const vString* const vpattern, const char* const fileName);
+
 extern void stringListPrint (const stringList *const current, FILE *fp);
 extern void stringListReverse (const stringList *const current);
 
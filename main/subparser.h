@@ -48,6 +48,12 @@ struct sSubparser {
 	void (* inputEnd) (subparser *s);
 	void (* exclusiveSubparserChosenNotify) (subparser *s, void *data);
 	void (* makeTagEntryNotify) (subparser *s, const tagEntryInfo *tag, int corkIndex);
+
+	/* The kinds of the base parser for which makeTagEntryNotify is called.
+	 * The array is terminated with KIND_GHOST_INDEX. NULL means all kinds.
+	 * makeTagEntryNotify is called for all the tags made by a parser other
+	 * than the base parser. */
+	const int *makeTagEntryNotifyKinds;
 };
 
 /*
@@ -25,6 +25,8 @@
 *   FUNCTION PROTOTYPES
 */
 extern subparser *getFirstSubparser(struct slaveControlBlock *controlBlock);
+extern struct slaveControlBlock *getSlaveControlBlock (langType language);
+extern bool isSubparserRunnable (subparser *s, bool includingNoneCraftedParser);
 
 /* A base parser doesn't have to call the following three functions.
    The main part calls them internally. */
@@ -0,0 +1,351 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for the in-memory index of the tags
+*   emitted in the server submode of the interactive mode.
+*
+*   The definition tags written for a file are collected through the
+*   observer of the tag writer, and replace the tags of the file in the
+*   index when the request tagging it completes. The index maps names,
+*   input files, and scopes to the tags, so that a client can look up a
+*   definition or the members of a class without reading tags again.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "debug.h"
+#include "entry_p.h"
+#include "htable.h"
+#include "parse.h"
+#include "ptrarray.h"
+#include "routines.h"
+#include "symindex_p.h"
+#include "xtag.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+struct sSymbolIndex {
+	hashTable *files;			/* file -> indexedFile */
+	hashTable *names;			/* name -> ptrArray of indexedSymbol (borrowed) */
+	hashTable *scopes;			/* scope -> ptrArray of indexedSymbol (borrowed) */
+	hashTable *collected;		/* file -> ptrArray of indexedSymbol */
+	unsigned long lastSeq;
+};
+
+typedef struct sIndexedFile {
+	char *name;					/* the key in the table; shared by the symbols */
+	ptrArray *symbols;
+} indexedFile;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deleteSymbol (void *data)
+{
+	indexedSymbol *symbol = data;
+
+	eFree (symbol->name);
+	if (symbol->scope)
+		eFree (symbol->scope);
+	if (symbol->signature)
+		eFree (symbol->signature);
+	eFree (symbol);
+}
+
+static void deleteSymbols (void *data)
+{
+	ptrArrayDelete (data);
+}
+
+static void deleteIndexedFile (void *data)
+{
+	indexedFile *file = data;
+
+	ptrArrayDelete (file->symbols);
+	eFree (file->name);
+	eFree (file);
+}
+
+extern symbolIndex *symbolIndexNew (void)
+{
+	symbolIndex *index = xMalloc (1, symbolIndex);
+
+	index->files = hashTableNew (127, hashCstrhash, hashCstreq,
+								 NULL, deleteIndexedFile);
+	index->names = hashTableNew (1021, hashCstrhash, hashCstreq,
+								 eFree, deleteSymbols);
+	index->scopes = hashTableNew (255, hashCstrhash, hashCstreq,
+								  eFree, deleteSymbols);
+	index->collected = hashTableNew (31, hashCstrhash, hashCstreq,
+									 eFree, deleteSymbols);
+	index->lastSeq = 0;
+	return index;
+}
+
+extern void symbolIndexDelete (symbolIndex *index)
+{
+	hashTableDelete (index->collected);
+	hashTableDelete (index->scopes);
+	hashTableDelete (index->names);
+	hashTableDelete (index->files);
+	eFree (index);
+}
+
+static ptrArray *getSymbols (hashTable *table, const char *key, bool owner)
+{
+	ptrArray *symbols = hashTableGetItem (table, key);
+
+	if (symbols == NULL)
+	{
+		symbols = ptrArrayNew (owner? deleteSymbol: NULL);
+		hashTablePutItem (table, eStrdup (key), symbols);
+	}
+	return symbols;
+}
+
+static void unlinkSymbol (hashTable *table, const char *key, indexedSymbol *symbol)
+{
+	ptrArray *symbols = hashTableGetItem (table, key);
+
+	Assert (symbols);
+	for (unsigned int i = 0; i < ptrArrayCount (symbols); i++)
+	{
+		if (ptrArrayItem (symbols, i) == symbol)
+		{
+			ptrArrayRemoveItem (symbols, i);
+			break;
+		}
+	}
+	if (ptrArrayIsEmpty (symbols))
+		hashTableDeleteItem (table, key);
+}
+
+static void linkSymbol (symbolIndex *index, indexedSymbol *symbol)
+{
+	ptrArrayAdd (getSymbols (index->names, symbol->name, false), symbol);
+	if (symbol->scope)
+		ptrArrayAdd (getSymbols (index->scopes, symbol->scope, false), symbol);
+}
+
+static void unlinkSymbols (symbolIndex *index, ptrArray *symbols)
+{
+	for (unsigned int i = 0; i < ptrArrayCount (symbols); i++)
+	{
+		indexedSymbol *symbol = ptrArrayItem (symbols, i);
+
+		unlinkSymbol (index->names, symbol->name, symbol);
+		if (symbol->scope)
+			unlinkSymbol (index->scopes, symbol->scope, symbol);
+	}
+}
+
+extern void symbolIndexBeginFile (symbolIndex *index, const char *file)
+{
+	ptrArrayClear (getSymbols (index->collected, file, true));
+}
+
+/* A rescan of the input drops the tags written after the point where
+ * the rescan starts; the number of the tags written goes back. */
+static bool dropRescannedSymbols (const void *key CTAGS_ATTR_UNUSED,
+								  void *value, void *user_data)
+{
+	ptrArray *symbols = value;
+	unsigned long seq = *(unsigned long *) user_data;
+
+	while (!ptrArrayIsEmpty (symbols)
+		   && ((indexedSymbol *) ptrArrayLast (symbols))->seq >= seq)
+		ptrArrayDeleteLast (symbols);
+	return true;
+}
+
+extern void symbolIndexCollectTag (const tagEntryInfo *const tag, void *data)
+{
+	symbolIndex *index = data;
+	unsigned long seq = numTagsAdded ();
+	const char *scopeKind, *scope;
+	indexedSymbol *symbol;
+
+	if (seq <= index->lastSeq)
+		hashTableForeachItem (index->collected, dropRescannedSymbols, &seq);
+	index->lastSeq = seq;
+
+	if (tag->extensionFields.roleBits
+		|| isTagExtraBitMarked (tag, XTAG_QUALIFIED_TAGS)
+		|| tag->inputFileName == NULL)
+		return;
+
+	/* const is discarded to fill the scope fields of TAG. */
+	getTagScopeInformation ((tagEntryInfo *) tag, &scopeKind, &scope);
+
+	symbol = xMalloc (1, indexedSymbol);
+	symbol->name = eStrdup (tag->name);
+	symbol->file = NULL;
+	symbol->language = getLanguageName (tag->langType);
+	symbol->kind = getTagKindName (tag);
+	symbol->scopeKind = scope? scopeKind: NULL;
+	symbol->scope = scope? eStrdup (scope): NULL;
+	symbol->signature = tag->extensionFields.signature
+		? eStrdup (tag->extensionFields.signature): NULL;
+	symbol->line = tag->lineNumber;
+	symbol->end = tag->extensionFields._endLine;
+	symbol->seq = seq;
+	ptrArrayAdd (getSymbols (index->collected, tag->inputFileName, true), symbol);
+}
+
+static indexedFile *getIndexedFile (symbolIndex *index, const char *name)
+{
+	indexedFile *file = hashTableGetItem (index->files, name);
+
+	if (file == NULL)
+	{
+		file = xMalloc (1, indexedFile);
+		file->name = eStrdup (name);
+		file->symbols = ptrArrayNew (deleteSymbol);
+		hashTablePutItem (index->files, file->name, file);
+	}
+	return file;
+}
+
+/* Move the symbols collected for FILE to the index. */
+static void addCollectedSymbols (symbolIndex *index, indexedFile *file,
+								 ptrArray *collected)
+{
+	for (unsigned int i = 0; i < ptrArrayCount (collected); i++)
+	{
+		indexedSymbol *symbol = ptrArrayItem (collected, i);
+
+		symbol->file = file->name;
+		linkSymbol (index, symbol);
+		ptrArrayAdd (file->symbols, symbol);
+	}
+	/* The symbols are owned by FILE now. */
+	while (!ptrArrayIsEmpty (collected))
+		ptrArrayRemoveLast (collected);
+}
+
+static bool collectFileName (const void *key, void *value CTAGS_ATTR_UNUSED,
+							 void *user_data)
+{
+	ptrArrayAdd (user_data, (void *) key);
+	return true;
+}
+
+extern void symbolIndexCommit (symbolIndex *index)
+{
+	ptrArray *names = ptrArrayNew (NULL);
+
+	hashTableForeachItem (index->collected, collectFileName, names);
+	for (unsigned int i = 0; i < ptrArrayCount (names); i++)
+	{
+		const char *name = ptrArrayItem (names, i);
+		indexedFile *file = getIndexedFile (index, name);
+
+		unlinkSymbols (index, file->symbols);
+		ptrArrayClear (file->symbols);
+		addCollectedSymbols (index, file, hashTableGetItem (index->collected, name));
+		if (ptrArrayIsEmpty (file->symbols))
+			hashTableDeleteItem (index->files, name);
+	}
+	ptrArrayDelete (names);
+	hashTableClear (index->collected);
+	index->lastSeq = 0;
+}
+
+extern void symbolIndexCommitLines (symbolIndex *index, const char *name,
+									unsigned long from, unsigned long last,
+									long shift)
+{
+	ptrArray *collected = hashTableGetItem (index->collected, name);
+	indexedFile *file = getIndexedFile (index, name);
+	ptrArray *symbols = ptrArrayNew (deleteSymbol);
+
+	for (unsigned int i = 0; i < ptrArrayCount (file->symbols); i++)
+	{
+		indexedSymbol *symbol = ptrArrayItem (file->symbols, i);
+
+		if (from <= symbol->line && symbol->line <= last)
+		{
+			unlinkSymbol (index->names, symbol->name, symbol);
+			if (symbol->scope)
+				unlinkSymbol (index->scopes, symbol->scope, symbol);
+			deleteSymbol (symbol);
+			continue;
+		}
+		if (symbol->line > last)
+			symbol->line += shift;
+		if (symbol->end > last)
+			symbol->end += shift;
+		ptrArrayAdd (symbols, symbol);
+	}
+
+	/* The symbols kept are owned by SYMBOLS now. */
+	while (!ptrArrayIsEmpty (file->symbols))
+		ptrArrayRemoveLast (file->symbols);
+	ptrArrayDelete (file->symbols);
+	file->symbols = symbols;
+
+	if (collected)
+	{
+		addCollectedSymbols (index, file, collected);
+		hashTableDeleteItem (index->collected, name);
+	}
+	if (ptrArrayIsEmpty (file->symbols))
+		hashTableDeleteItem (index->files, name);
+}
+
+extern void symbolIndexForgetFile (symbolIndex *index, const char *name)
+{
+	indexedFile *file = hashTableGetItem (index->files, name);
+
+	hashTableDeleteItem (index->collected, name);
+	if (file)
+	{
+		unlinkSymbols (index, file->symbols);
+		hashTableDeleteItem (index->files, name);
+	}
+}
+
+extern const ptrArray *symbolIndexFindByName (symbolIndex *index, const char *name)
+{
+	return hashTableGetItem (index->names, name);
+}
+
+extern const ptrArray *symbolIndexFindByFile (symbolIndex *index, const char *name)
+{
+	indexedFile *file = hashTableGetItem (index->files, name);
+
+	return file? file->symbols: NULL;
+}
+
+extern const ptrArray *symbolIndexFindByScope (symbolIndex *index, const char *scope)
+{
+	return hashTableGetItem (index->scopes, scope);
+}
+
+static int compareSymbols (const void *a, const void *b)
+{
+	const indexedSymbol *sa = a;
+	const indexedSymbol *sb = b;
+	int r = strcmp (sa->file, sb->file);
+
+	if (r != 0)
+		return r;
+	if (sa->line != sb->line)
+		return (sa->line < sb->line)? -1: 1;
+	return (sa->seq < sb->seq)? -1: (sa->seq > sb->seq);
+}
+
+extern void symbolIndexSort (ptrArray *symbols)
+{
+	ptrArraySort (symbols, compareSymbols);
+}
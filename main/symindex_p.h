@@ -0,0 +1,75 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for the in-memory index of the tags emitted in the
+*   server submode of the interactive mode.
+*/
+#ifndef CTAGS_MAIN_SYMINDEX_PRIVATE_H
+#define CTAGS_MAIN_SYMINDEX_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "entry.h"
+#include "ptrarray.h"
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sSymbolIndex symbolIndex;
+
+/* A definition tag in the index. The names of the language and the
+ * kinds are the ones of the parsers; the other strings are owned by
+ * the index. */
+typedef struct sIndexedSymbol {
+	char *name;
+	const char *file;
+	const char *language;
+	const char *kind;
+	const char *scopeKind;		/* NULL if the tag has no scope */
+	char *scope;
+	char *signature;
+	unsigned long line;
+	unsigned long end;			/* 0 if unknown */
+	unsigned long seq;			/* the number of the tag in the tag file */
+} indexedSymbol;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern symbolIndex *symbolIndexNew (void);
+extern void symbolIndexDelete (symbolIndex *index);
+
+/* The tags written for FILE from now on replace the ones in the index
+ * when they are committed. The tags collected for FILE are dropped. */
+extern void symbolIndexBeginFile (symbolIndex *index, const char *file);
+
+/* A tagWriteObserver collecting the definition tags written */
+extern void symbolIndexCollectTag (const tagEntryInfo *const tag, void *data);
+
+/* Replace the tags of each file begun with the ones collected */
+extern void symbolIndexCommit (symbolIndex *index);
+
+/* Replace the tags of FILE at the lines from FROM to LAST with the ones
+ * collected. The following lines are moved by SHIFT. */
+extern void symbolIndexCommitLines (symbolIndex *index, const char *file,
+									unsigned long from, unsigned long last,
+									long shift);
+
+extern void symbolIndexForgetFile (symbolIndex *index, const char *file);
+
+/* The tags named NAME, in FILE, or in SCOPE, the name of a scope as
+ * written in the scope field. NULL is returned if nothing is found. */
+extern const ptrArray *symbolIndexFindByName (symbolIndex *index, const char *name);
+extern const ptrArray *symbolIndexFindByFile (symbolIndex *index, const char *file);
+extern const ptrArray *symbolIndexFindByScope (symbolIndex *index, const char *scope);
+
+/* Sort SYMBOLS by their files and lines */
+extern void symbolIndexSort (ptrArray *symbols);
+
+#endif	/* CTAGS_MAIN_SYMINDEX_PRIVATE_H */
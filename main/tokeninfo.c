@@ -20,10 +20,11 @@ static void* createToken (void *createArg)
 {
 	struct tokenInfoClass *klass = createArg;
 	tokenInfo *token;
+	vString *string;
 
-	token = eCalloc (1, sizeof (*token) + klass->extraSpace);
+	token = allocPooledToken (sizeof (*token) + klass->extraSpace, &string);
 	token->klass = klass;
-	token->string  = vStringNew ();
+	token->string  = string;
 
 	return token;
 }
@@ -49,8 +50,7 @@ static void deleteToken (void *data)
 	if (token->klass->delete)
 		token->klass->delete (token);
 
-	vStringDelete (token->string);
-	eFree (token);
+	freePooledToken (token, sizeof (*token) + token->klass->extraSpace);
 }
 
 void *newToken (struct tokenInfoClass *klass)
@@ -10,6 +10,7 @@
 #include "general.h"  /* must always come first */
 #include "mio.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "vstring.h"
 
 #ifndef CTAGS_MAIN_TOKEN_H
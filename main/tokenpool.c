@@ -0,0 +1,132 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines a pool of tokens shared by the parsers. A block has a token, a
+*   vString, and its inline buffer. The blocks are classified by the size of
+*   the token rounded up to a multiple of TOKEN_POOL_CLASS_SIZE. The vString
+*   is at the end of the class size, so any block of a class can hold any
+*   token of the class. Freed blocks are kept on a list per class for the
+*   next allocation; the vString keeps its buffer grown for a long string.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <string.h>
+
+#include "debug.h"
+#include "routines.h"
+#include "tokenpool.h"
+#include "trashbox.h"
+
+/*
+*   MACROS
+*/
+#define TOKEN_INLINE_STRING_SIZE 32
+#define TOKEN_POOL_CLASS_SIZE 32
+#define TOKEN_POOL_CLASSES 16	/* pooling the tokens up to 512 bytes */
+#define TOKEN_POOL_MAX_FREE 1024	/* per class */
+
+/*
+*   DATA DECLARATIONS
+*/
+struct pooledTokenLink {
+	struct pooledTokenLink *next;
+};
+
+/*
+*   DATA DEFINITIONS
+*/
+static struct pooledTokenLink *TokenPoolFree [TOKEN_POOL_CLASSES];
+static unsigned int TokenPoolFreeCount [TOKEN_POOL_CLASSES];
+static bool TokenPoolRegistered;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+static unsigned int getTokenPoolClass (size_t size)
+{
+	return (unsigned int) ((size + TOKEN_POOL_CLASS_SIZE - 1) / TOKEN_POOL_CLASS_SIZE) - 1;
+}
+
+static vString *getPooledTokenString (void *token, unsigned int klass)
+{
+	return (vString *) ((char *) token + (klass + 1) * TOKEN_POOL_CLASS_SIZE);
+}
+
+static void flushTokenPool (void *unused CTAGS_ATTR_UNUSED)
+{
+	for (unsigned int klass = 0; klass < TOKEN_POOL_CLASSES; klass++)
+	{
+		while (TokenPoolFree [klass])
+		{
+			struct pooledTokenLink *link = TokenPoolFree [klass];
+			TokenPoolFree [klass] = link->next;
+			vStringFinalizeInline (getPooledTokenString (link, klass));
+			eFree (link);
+		}
+		TokenPoolFreeCount [klass] = 0;
+	}
+}
+
+extern void *allocPooledToken (size_t size, vString **string)
+{
+	unsigned int klass = getTokenPoolClass (size);
+	void *token;
+	vString *vs;
+
+	Assert (size >= sizeof (struct pooledTokenLink));
+
+	if (klass < TOKEN_POOL_CLASSES && TokenPoolFree [klass])
+	{
+		struct pooledTokenLink *link = TokenPoolFree [klass];
+		TokenPoolFree [klass] = link->next;
+		TokenPoolFreeCount [klass]--;
+		token = link;
+		vs = getPooledTokenString (token, klass);
+		vStringClear (vs);
+	}
+	else
+	{
+		token = eMalloc ((klass + 1) * TOKEN_POOL_CLASS_SIZE
+						 + sizeof (vString) + TOKEN_INLINE_STRING_SIZE);
+		vs = getPooledTokenString (token, klass);
+		vStringInitInline (vs, TOKEN_INLINE_STRING_SIZE);
+	}
+
+	memset (token, 0, size);
+	*string = vs;
+	return token;
+}
+
+extern void freePooledToken (void *token, size_t size)
+{
+	unsigned int klass = getTokenPoolClass (size);
+
+	if (token == NULL)
+		return;
+
+	if (klass >= TOKEN_POOL_CLASSES
+		|| TokenPoolFreeCount [klass] >= TOKEN_POOL_MAX_FREE)
+	{
+		vStringFinalizeInline (getPooledTokenString (token, klass));
+		eFree (token);
+		return;
+	}
+
+	if (!TokenPoolRegistered)
+	{
+		DEFAULT_TRASH_BOX (TokenPoolFree, flushTokenPool);
+		TokenPoolRegistered = true;
+	}
+
+	struct pooledTokenLink *link = token;
+	link->next = TokenPoolFree [klass];
+	TokenPoolFree [klass] = link;
+	TokenPoolFreeCount [klass]++;
+}
@@ -0,0 +1,32 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines a pool of tokens shared by the parsers.
+*/
+#ifndef CTAGS_MAIN_TOKENPOOL_H
+#define CTAGS_MAIN_TOKENPOOL_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+#include "vstring.h"
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Return a zero-filled token of SIZE bytes, and store a vString for it
+ * to *STRING. The vString has an inline buffer for a short string, and
+ * it is a part of the memory block of the token; it must be neither
+ * deleted nor replaced. A parser having its own token type uses these
+ * functions in the create and delete functions of its objPool. */
+extern void *allocPooledToken (size_t size, vString **string);
+
+/* Take back TOKEN of SIZE bytes and its vString. */
+extern void freePooledToken (void *token, size_t size);
+
+#endif	/* CTAGS_MAIN_TOKENPOOL_H */
@@ -10,6 +10,9 @@
 
 #include "general.h"
 
+#include <string.h>
+
+#include "arena_p.h"
 #include "debug.h"
 #include "routines.h"
 #include "trashbox.h"
@@ -27,7 +30,9 @@ struct sTrashBox {
 };
 
 static TrashBox* defaultTrashBox;
-static TrashBox* parserTrashBox;
+static CTAGS_THREAD_LOCAL TrashBox* parserTrashBox;
+/* Kept over files for reusing its chunk */
+static CTAGS_THREAD_LOCAL arena* parserArena;
 
 static Trash* trashPut (Trash* trash, void* item,
 			TrashDestroyItemProc destrctor);
@@ -176,6 +181,12 @@ extern void finiDefaultTrashBox (void)
 {
 	trashBoxDelete (defaultTrashBox);
 	defaultTrashBox = NULL;
+
+	if (parserArena)
+	{
+		arenaDelete (parserArena);
+		parserArena = NULL;
+	}
 }
 
 extern void initParserTrashBox (void)
@@ -187,6 +198,9 @@ extern void finiParserTrashBox  (void)
 {
 	trashBoxDelete (parserTrashBox);
 	parserTrashBox = NULL;
+
+	if (parserArena)
+		arenaReset (parserArena);
 }
 
 extern void* parserTrashBoxPut  (void* item, TrashBoxDestroyItemProc destroy)
@@ -199,6 +213,26 @@ extern TrashBoxDestroyItemProc parserTrashBoxTakeBack  (void* item)
 	return trashBoxTakeBack(parserTrashBox, item);
 }
 
+extern void* parserArenaAlloc (size_t size)
+{
+	void *r;
+
+	if (!parserArena)
+		parserArena = arenaNew (4096);
+
+	r = arenaAlloc (parserArena, size);
+	memset (r, 0, size);
+	return r;
+}
+
+extern char* parserArenaStrdup (const char* str)
+{
+	if (!parserArena)
+		parserArena = arenaNew (4096);
+
+	return arenaStrdup (parserArena, str);
+}
+
 #ifdef TRASH_TEST
 #include <stdio.h>
 
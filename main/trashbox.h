@@ -63,4 +63,12 @@ extern void      trashBoxMakeEmpty (TrashBox* trash_box);
 extern void* parserTrashBoxPut  (void* item, TrashBoxDestroyItemProc destroy);
 extern TrashBoxDestroyItemProc parserTrashBoxTakeBack  (void* item);
 
+/* A parser arena is a bump allocator released with the parser trash box
+ * when `parser' method is finished. Use it instead of parserTrashBoxPut ()
+ * for memory objects freed with eFree (); it costs no allocation for most
+ * of the objects. The memory is zero-filled and aligned for any object,
+ * and cannot be freed nor taken back. */
+extern void* parserArenaAlloc  (size_t size);
+extern char* parserArenaStrdup (const char* str);
+
 #endif /* CTAGS_MAIN_TRASH_H */
@@ -0,0 +1,210 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for writing the sidecar trigram index
+*   of a tag file (--trigram-index).
+*
+*   The tag lines are divided into blocks of about TRIGRAM_INDEX_STRIDE
+*   bytes, each starting at the head of a line. For each trigram, three
+*   consecutive bytes, of the tag names with ASCII letters folded to lower
+*   case, the index records the blocks having a name with the trigram.
+*   A reader looking for the names containing a string intersects the
+*   posting lists of the trigrams in the string, and verifies the names
+*   only in the blocks left.
+*
+*   The index is a text file:
+*
+*     !_CTAGS_TRIGRAM_INDEX	1	<tag file size>	<blocks>	<trigrams>
+*     <offset of the first line of a block>    ... one line per block
+*     <trigram>	<block> <delta> <delta>...    ... one line per trigram
+*
+*   The trigram is written in 6 lower case hexadecimal digits, and the
+*   lines are sorted by it. A posting list has the number of the first
+*   block followed by the differences between the following numbers.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "debug.h"
+#include "htable.h"
+#include "mio.h"
+#include "options.h"
+#include "ptag_p.h"
+#include "ptrarray.h"
+#include "read.h"
+#include "routines.h"
+#include "trigram_p.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define TRIGRAM_INDEX_SUFFIX ".trigrams"
+#define TRIGRAM_INDEX_HEADER "!_CTAGS_TRIGRAM_INDEX\t1"
+#define TRIGRAM_INDEX_STRIDE 2048L
+
+/*
+*   DATA DECLARATIONS
+*/
+typedef struct sTrigramPosting {
+	int trigram;				/* the key in the table */
+	unsigned long lastBlock;
+	vString *blocks;			/* the posting list in the file format */
+} trigramPosting;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+static void deletePosting (void *data)
+{
+	trigramPosting *posting = data;
+
+	vStringDelete (posting->blocks);
+	eFree (posting);
+}
+
+static int foldTrigramByte (unsigned char c)
+{
+	return (c >= 'A' && c <= 'Z')? c - 'A' + 'a': c;
+}
+
+static void catNumber (vString *string, const char *const format, unsigned long n)
+{
+	char buffer [32];
+
+	snprintf (buffer, sizeof (buffer), format, n);
+	vStringCatS (string, buffer);
+}
+
+static void addTrigram (hashTable *table, int trigram, unsigned long block)
+{
+	trigramPosting *posting = hashTableGetItem (table, &trigram);
+
+	if (posting == NULL)
+	{
+		posting = xMalloc (1, trigramPosting);
+		posting->trigram = trigram;
+		posting->blocks = vStringNew ();
+		posting->lastBlock = block;
+		catNumber (posting->blocks, "%lu", block);
+		hashTablePutItem (table, &posting->trigram, posting);
+	}
+	else if (posting->lastBlock != block)
+	{
+		catNumber (posting->blocks, " %lu", block - posting->lastBlock);
+		posting->lastBlock = block;
+	}
+}
+
+static void addTrigramsOfName (hashTable *table, const char *name,
+							   size_t length, unsigned long block)
+{
+	for (size_t i = 0; i + 3 <= length; i++)
+	{
+		const int trigram = (foldTrigramByte (name [i]) << 16)
+			| (foldTrigramByte (name [i + 1]) << 8)
+			| foldTrigramByte (name [i + 2]);
+		addTrigram (table, trigram, block);
+	}
+}
+
+static bool collectPosting (const void *key CTAGS_ATTR_UNUSED, void *value,
+							void *user_data)
+{
+	ptrArrayAdd (user_data, value);
+	return true;
+}
+
+static int comparePostings (const void *a, const void *b)
+{
+	const trigramPosting *pa = a;
+	const trigramPosting *pb = b;
+
+	return (pa->trigram > pb->trigram) - (pa->trigram < pb->trigram);
+}
+
+extern void writeTrigramIndex (const char *const tagFileName)
+{
+	vString *indexName = vStringNewInit (tagFileName);
+	vString *vLine = vStringNew ();
+	vString *blockOffsets = vStringNew ();
+	hashTable *table = hashTableNewFlat (4096, hashInthash, hashInteq,
+										 NULL, deletePosting);
+	ptrArray *postings;
+	unsigned long blocks = 0;
+	long next = 0;
+	long size;
+	MIO *tags, *index;
+
+	vStringCatS (indexName, TRIGRAM_INDEX_SUFFIX);
+
+	tags = mio_new_file (tagFileName, "r");
+	if (tags == NULL)
+		error (FATAL | PERROR, "cannot open tag file \"%s\"", tagFileName);
+	mio_seek (tags, 0L, SEEK_END);
+	size = mio_tell (tags);
+	mio_seek (tags, 0L, SEEK_SET);
+
+	while (true)
+	{
+		const long offset = mio_tell (tags);
+		const char *line = readLineRaw (vLine, tags);
+
+		if (line == NULL)
+			break;
+		if (blocks == 0
+			&& strncmp (line, PSEUDO_TAG_PREFIX, strlen (PSEUDO_TAG_PREFIX)) == 0)
+			continue;
+
+		/* A block starts at the first line after the stride. */
+		if (blocks == 0 || offset >= next)
+		{
+			catNumber (blockOffsets, "%lu\n", (unsigned long) offset);
+			next = offset + TRIGRAM_INDEX_STRIDE;
+			blocks++;
+		}
+		addTrigramsOfName (table, line, strcspn (line, "\t\r\n"), blocks - 1);
+	}
+	if (mio_error (tags))
+		error (FATAL | PERROR, "cannot read tag file \"%s\"", tagFileName);
+	mio_unref (tags);
+
+	postings = ptrArrayNew (NULL);
+	hashTableForeachItem (table, collectPosting, postings);
+	ptrArraySort (postings, comparePostings);
+
+	index = mio_new_file (vStringValue (indexName), "w");
+	if (index == NULL)
+		error (FATAL | PERROR, "cannot open trigram index \"%s\"", vStringValue (indexName));
+	mio_printf (index, TRIGRAM_INDEX_HEADER "\t%ld\t%lu\t%u\n",
+				size, blocks, ptrArrayCount (postings));
+	mio_puts (index, vStringValue (blockOffsets));
+	for (unsigned int i = 0; i < ptrArrayCount (postings); i++)
+	{
+		const trigramPosting *posting = ptrArrayItem (postings, i);
+		mio_printf (index, "%06x\t%s\n", (unsigned int) posting->trigram,
+					vStringValue (posting->blocks));
+	}
+	if (mio_unref (index) != 0)
+		error (FATAL | PERROR, "cannot write trigram index \"%s\"", vStringValue (indexName));
+
+	verbose ("wrote %u trigrams of %lu blocks to %s\n",
+			 ptrArrayCount (postings), blocks, vStringValue (indexName));
+
+	ptrArrayDelete (postings);
+	hashTableDelete (table);
+	vStringDelete (blockOffsets);
+	vStringDelete (vLine);
+	vStringDelete (indexName);
+}
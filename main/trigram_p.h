@@ -0,0 +1,25 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for writing the sidecar trigram index of a tag file
+*   (--trigram-index).
+*/
+#ifndef CTAGS_MAIN_TRIGRAM_PRIVATE_H
+#define CTAGS_MAIN_TRIGRAM_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* Write TAGFILENAME.trigrams for the sorted tag file */
+extern void writeTrigramIndex (const char *const tagFileName);
+
+#endif	/* CTAGS_MAIN_TRIGRAM_PRIVATE_H */
@@ -19,205 +19,77 @@
 #include "general.h"
 
 #include "debug.h"
-#include "gcc-attr.h"
-#include "inline.h"
 #include "mio.h"
-#include "objpool.h"
-#include "ptrarray.h"
 #include "read.h"
 #include "routines.h"
-#include "trashbox.h"
 #include "unwindi.h"
 
 #include <string.h>
 
-typedef struct sUugcChar {
+typedef struct sUwiChar {
 	int c;
 	/* lineNumber before reading the char (frontLineNumber).
 	 * The lineNumber after reading the char (rearLineNumber) can be calculated:
 	 * If the char is \n, rearLineNumber is frontLineNumber + 1.
 	 * If the char is not, rearLineNumber is the same as frontLineNumber. */
 	unsigned long lineNumber;
-} uugcChar;
+} uwiChar;
+
+/* The chars read from the input file while a marker is set, and the
+ * chars unwound or injected back to the input stream, are kept in
+ * one contiguous array. The chars in [0, uwiCharsPos) have been read;
+ * the last ones of them are counted by the markers. The chars in
+ * [uwiCharsPos, uwiCharsLength) are read again before reading the
+ * input file. Unwinding chars just moves uwiCharsPos backward. */
+static uwiChar *uwiChars;
+static size_t uwiCharsPos;
+static size_t uwiCharsLength;
+static size_t uwiCharsSize;
+
+/* The char returned by the last uwiGetC() while it is in the array. */
+static uwiChar uwiCurrentChar;
+static bool uwiHasCurrentChar;
 
-
-static ptrArray *uugcInputFile;
-static uugcChar *uugcCurrentChar;
-static objPool  *uugcCharPool;
+static unsigned int *uwiMarkerStack;
+static unsigned int uwiMarkerStackLength;
+static unsigned int *uwiCurrentMarker;
 
 static struct sUwiStats uwiStats;
 
-static void deleteChar (void *c)
-{
-	eFree (c);
-}
-
-static void* newChar (void *data CTAGS_ATTR_UNUSED)
-{
-	return xMalloc (1, uugcChar);
-}
-
-CTAGS_INLINE void uugcDeleteC (uugcChar *c)
-{
-	if (c == uugcCurrentChar)
-		uugcCurrentChar = NULL;
-
-	objPoolPut (uugcCharPool, c);
-}
-
-static void uugcActivate (void)
-{
-	Assert (!uugcInputFile);
-	Assert (!uugcCurrentChar);
-
-	if (uugcCharPool == NULL)
-	{
-		uugcCharPool = objPoolNew(256,
-								  newChar,
-								  deleteChar,
-								  NULL,
-								  NULL);
-		DEFAULT_TRASH_BOX(uugcCharPool, objPoolDelete);
-	}
-
-	uugcInputFile = ptrArrayNew ((ptrArrayDeleteFunc)uugcDeleteC);
-}
-
-static void uugcDeactive(void)
-{
-	Assert (uugcInputFile);
-	ptrArrayDelete (uugcInputFile);
-	uugcInputFile = NULL;
-	uugcCurrentChar = NULL;
-}
-
-CTAGS_INLINE uugcChar *uugcNewC (int chr, unsigned long ln)
-{
-	Assert (uugcCharPool);
-
-	uugcChar *c = objPoolGet (uugcCharPool);
-	c->c = chr;
-	c->lineNumber = ln;
-	return c;
-}
-
-CTAGS_INLINE uugcChar *uugciGetC (void)
+static void uwiReserveChars (size_t count)
 {
-	uugcChar *c;
-
-	Assert (uugcInputFile);
-
-	if (ptrArrayCount (uugcInputFile) > 0)
-	{
-		c = ptrArrayLast (uugcInputFile);
-		ptrArrayRemoveLast (uugcInputFile);
-	}
-	else
-	{
-		unsigned long lineNumber = getInputLineNumber ();
-		int chr = getcFromInputFile();
-		c = uugcNewC (chr, lineNumber);
-	}
-
-	uugcCurrentChar = c;
-	return uugcCurrentChar;
-}
-
-CTAGS_INLINE void uugcUngetC (uugcChar *c)
-{
-	uugcCurrentChar = NULL;
-
-	if (c->c == EOF)
-	{
-		ptrArrayClear (uugcInputFile);
-		uugcDeleteC (c);
+	if (uwiCharsLength + count <= uwiCharsSize)
 		return;
-	}
 
-	ptrArrayAdd (uugcInputFile, c);
+	while (uwiCharsLength + count > uwiCharsSize)
+		uwiCharsSize *= 2;
+	uwiChars = xRealloc (uwiChars, uwiCharsSize, uwiChar);
 }
 
-CTAGS_INLINE void uugcInjectC (int chr)
+/* Forget the chars read before uwiCharsPos. */
+static void uwiCompactChars (void)
 {
-	if (chr == EOF)
+	if (uwiCharsPos == 0)
 		return;
 
-	uugcChar *lastc = NULL;
-	if (ptrArrayCount (uugcInputFile) > 0)
-		lastc = ptrArrayLast (uugcInputFile);
-
-	unsigned long lineNumber;
-	if (lastc)
-	{
-		if (chr == '\n' && lastc->lineNumber > 0)
-			lineNumber = lastc->lineNumber - 1;
-		else
-			lineNumber = lastc->lineNumber;
-	}
-	else
-	{
-		lineNumber = getInputLineNumber ();
-		if (chr == '\n')
-			lineNumber--;
-	}
-
-	uugcChar *c = uugcNewC(chr, lineNumber);
-	uugcUngetC (c);
-}
-
-CTAGS_INLINE long uugcGetLineNumber (void)
-{
-	Assert (uugcInputFile);
-
-	if (uugcCurrentChar)
-	{
-		unsigned long ln;
-		if (uugcCurrentChar->c == '\n')
-			ln = uugcCurrentChar->lineNumber + 1;
-		else
-			ln = uugcCurrentChar->lineNumber;
-		return ln;
-	}
-	else if (ptrArrayCount (uugcInputFile) > 0)
-	{
-		uugcChar *c = ptrArrayLast (uugcInputFile);
-		return c->lineNumber;
-	}
-	else
-		return getInputLineNumber ();
-}
-
-CTAGS_INLINE MIOPos uugcGetFilePosition (void)
-{
-	if (uugcCurrentChar)
-	{
-		unsigned long ln;
-		if (uugcCurrentChar->c == '\n')
-			ln = uugcCurrentChar->lineNumber + 1;
-		else
-			ln = uugcCurrentChar->lineNumber;
-		return getInputFilePositionForLine (ln);
-	}
-	else if (ptrArrayCount (uugcInputFile) > 0)
-	{
-		uugcChar *c = ptrArrayLast (uugcInputFile);
-		return getInputFilePositionForLine (c->lineNumber);
-	}
-	else
-		return getInputFilePosition ();
+	if (uwiCharsPos < uwiCharsLength)
+		memmove (uwiChars, uwiChars + uwiCharsPos,
+				 (uwiCharsLength - uwiCharsPos) * sizeof (uwiChar));
+	uwiCharsLength -= uwiCharsPos;
+	uwiCharsPos = 0;
 }
 
-static ptrArray *uwiBuffer;
-static unsigned int *uwiMarkerStack;
-static unsigned int uwiMarkerStackLength;
-static unsigned int *uwiCurrentMarker;
-
 extern void uwiActivate (unsigned int stackLength)
 {
 	Assert (stackLength > 0);
+	Assert (!uwiChars);
+
+	uwiCharsSize = 256;
+	uwiChars = xMalloc (uwiCharsSize, uwiChar);
+	uwiCharsPos = 0;
+	uwiCharsLength = 0;
+	uwiHasCurrentChar = false;
 
-	uugcActivate ();
-	uwiBuffer = ptrArrayNew ((ptrArrayDeleteFunc)uugcDeleteC);
 	uwiMarkerStackLength = stackLength;
 	uwiMarkerStack = xMalloc (stackLength, unsigned int);
 	uwiCurrentMarker = NULL;
@@ -227,7 +99,7 @@ extern void uwiActivate (unsigned int stackLength)
 
 extern void uwiDeactivate (struct sUwiStats *statsToBeUpdated)
 {
-	Assert (uwiBuffer);
+	Assert (uwiChars);
 	Assert (uwiMarkerStack);
 
 	if (statsToBeUpdated)
@@ -240,49 +112,106 @@ extern void uwiDeactivate (struct sUwiStats *statsToBeUpdated)
 			statsToBeUpdated->underflow = uwiStats.underflow;
 	}
 
-	ptrArrayDelete (uwiBuffer);
+	eFree (uwiChars);
 	eFree (uwiMarkerStack);
-	uwiBuffer = NULL;
+	uwiChars = NULL;
+	uwiCharsSize = 0;
 	uwiMarkerStack = NULL;
 	uwiMarkerStackLength = 0;
-	uugcDeactive();
 }
 
 extern int uwiGetC (void)
 {
-	int c;
-	uugcChar *chr = uugciGetC ();
+	uwiChar chr;
 
-	c = chr->c;
+	Assert (uwiChars);
+
+	if (uwiCharsPos < uwiCharsLength)
+		chr = uwiChars [uwiCharsPos++];
+	else
+	{
+		chr.lineNumber = getInputLineNumber ();
+		chr.c = getcFromInputFile ();
+		if (uwiCurrentMarker)
+		{
+			uwiReserveChars (1);
+			uwiChars [uwiCharsLength++] = chr;
+			uwiCharsPos++;
+		}
+	}
 
 	if (uwiCurrentMarker)
 	{
 		*uwiCurrentMarker += 1;
-		ptrArrayAdd (uwiBuffer, chr);
+		uwiCurrentChar = chr;
+		uwiHasCurrentChar = true;
 	}
 	else
 	{
-		uugcCurrentChar = NULL;
-		uugcDeleteC (chr);
+		if (uwiCharsPos == uwiCharsLength)
+			uwiCharsPos = uwiCharsLength = 0;
+		uwiHasCurrentChar = false;
 	}
 
-	return c;
+	return chr.c;
 }
 
 extern void uwiUngetC (int c)
 {
 	Assert (!uwiCurrentMarker);
-	uugcInjectC (c);
+
+	if (c == EOF)
+		return;
+
+	unsigned long lineNumber;
+	if (uwiCharsPos < uwiCharsLength)
+	{
+		lineNumber = uwiChars [uwiCharsPos].lineNumber;
+		if (c == '\n' && lineNumber > 0)
+			lineNumber--;
+	}
+	else
+	{
+		lineNumber = getInputLineNumber ();
+		if (c == '\n')
+			lineNumber--;
+	}
+
+	if (uwiCharsPos == 0)
+	{
+		uwiReserveChars (1);
+		memmove (uwiChars + 1, uwiChars, uwiCharsLength * sizeof (uwiChar));
+		uwiCharsLength++;
+		uwiCharsPos++;
+	}
+
+	uwiCharsPos--;
+	uwiChars [uwiCharsPos].c = c;
+	uwiChars [uwiCharsPos].lineNumber = lineNumber;
+	uwiHasCurrentChar = false;
 }
 
 extern unsigned long uwiGetLineNumber (void)
 {
-	return uugcGetLineNumber ();
+	Assert (uwiChars);
+
+	if (uwiHasCurrentChar)
+		return uwiCurrentChar.lineNumber + (uwiCurrentChar.c == '\n'? 1: 0);
+	else if (uwiCharsPos < uwiCharsLength)
+		return uwiChars [uwiCharsPos].lineNumber;
+	else
+		return getInputLineNumber ();
 }
 
 extern MIOPos uwiGetFilePosition (void)
 {
-	return uugcGetFilePosition ();
+	if (uwiHasCurrentChar)
+		return getInputFilePositionForLine (uwiCurrentChar.lineNumber
+											+ (uwiCurrentChar.c == '\n'? 1: 0));
+	else if (uwiCharsPos < uwiCharsLength)
+		return getInputFilePositionForLine (uwiChars [uwiCharsPos].lineNumber);
+	else
+		return getInputFilePosition ();
 }
 
 extern void uwiPushMarker (void)
@@ -319,22 +248,46 @@ extern void uwiPopMarker (const int upto, const bool revertChars)
 
 	uwiClearMarker (upto, revertChars);
 
-	if (uwiCurrentMarker == uwiMarkerStack) uwiCurrentMarker = NULL;
+	if (uwiCurrentMarker == uwiMarkerStack)
+	{
+		uwiCurrentMarker = NULL;
+		/* No char read so far can be unwound. */
+		uwiCompactChars ();
+	}
 	else uwiCurrentMarker--;
 }
 
 extern void uwiClearMarker (const int upto, const bool revertChars)
 {
 	Assert (uwiCurrentMarker);
-	int count = (upto <= 0)? *uwiCurrentMarker : upto;
-	void (*charHandler)(uugcChar *) = revertChars ? uugcUngetC : uugcDeleteC;
+	unsigned int count = (upto <= 0)? *uwiCurrentMarker : (unsigned int)upto;
 
-	while (count-- > 0)
+	if (count == 0)
+		return;
+
+	Assert (count <= *uwiCurrentMarker);
+	Assert (count <= uwiCharsPos);
+
+	if (revertChars)
 	{
-		charHandler (ptrArrayLast (uwiBuffer));
-		ptrArrayRemoveLast (uwiBuffer);
-		*uwiCurrentMarker -= 1;
+		uwiCharsPos -= count;
+		/* EOF is read at the end of the array only. Reading the input
+		 * file again returns it. */
+		while (uwiCharsLength > uwiCharsPos
+			   && uwiChars [uwiCharsLength - 1].c == EOF)
+			uwiCharsLength--;
 	}
+	else
+	{
+		if (uwiCharsPos < uwiCharsLength)
+			memmove (uwiChars + uwiCharsPos - count, uwiChars + uwiCharsPos,
+					 (uwiCharsLength - uwiCharsPos) * sizeof (uwiChar));
+		uwiCharsPos -= count;
+		uwiCharsLength -= count;
+	}
+
+	*uwiCurrentMarker -= count;
+	uwiHasCurrentChar = false;
 }
 
 extern void uwiDropMaker (void)
@@ -16,6 +16,7 @@
 #include <string.h>
 #include <ctype.h>
 
+#include "bytescan.h"
 #include "debug.h"
 #include "routines.h"
 #include "vstring.h"
@@ -43,8 +44,15 @@ extern void vStringResize (vString *const string, const size_t newSize)
 
 	if (size > string->size)
 	{
+		if (vStringIsInline (string))
+		{
+			char *buffer = xMalloc (size, char);
+			memcpy (buffer, string->buffer, string->length + 1);
+			string->buffer = buffer;
+		}
+		else
+			string->buffer = xRealloc (string->buffer, size, char);
 		string->size = size;
-		string->buffer = xRealloc (string->buffer, size, char);
 	}
 }
 
@@ -61,23 +69,41 @@ extern void vStringDelete (vString *const string)
 {
 	if (string != NULL)
 	{
-		if (string->buffer != NULL)
+		if (string->buffer != NULL && !vStringIsInline (string))
 			eFree (string->buffer);
 		eFree (string);
 	}
 }
 
+/* A new vString and its initial buffer are allocated at once; most of
+ * the strings made by the parsers, like identifiers, never outgrow it. */
 extern vString *vStringNew (void)
 {
-	vString *const string = xMalloc (1, vString);
+	vString *const string = eMalloc (sizeof (vString) + vStringInitialSize);
+
+	vStringInitInline (string, vStringInitialSize);
+
+	return string;
+}
+
+/* The buffer of an inline vString is the memory right after the
+ * vString itself. */
+extern void vStringInitInline (vString *const string, const size_t size)
+{
+	Assert (size > 0);
 
 	string->length = 0;
-	string->size   = vStringInitialSize;
-	string->buffer = xMalloc (string->size, char);
+	string->size   = size;
+	string->buffer = (char *) (string + 1);
 
 	vStringClear (string);
+}
 
-	return string;
+extern void vStringFinalizeInline (vString *const string)
+{
+	if (!vStringIsInline (string))
+		eFree (string->buffer);
+	string->buffer = NULL;
 }
 
 extern vString *vStringNewCopy (const vString *const string)
@@ -284,7 +310,13 @@ extern char    *vStringDeleteUnwrap       (vString *const string)
 
 	if (string != NULL)
 	{
-		buffer = string->buffer;
+		if (vStringIsInline (string))
+		{
+			buffer = xMalloc (string->length + 1, char);
+			memcpy (buffer, string->buffer, string->length + 1);
+		}
+		else
+			buffer = string->buffer;
 		string->buffer = NULL;
 
 		string->size = 0;
@@ -316,40 +348,48 @@ static int valueToXDigit (int v)
 
 extern void vStringCatSWithEscaping (vString* b, const char *s)
 {
-	for(; *s; s++)
-	{
-		unsigned char c = (unsigned char) *s;
+	const unsigned char *p = (const unsigned char *) s;
+	const unsigned char *const end = p + strlen (s);
 
+	while (p < end)
+	{
 		/* escape control characters (incl. \t) */
-		if ((c > 0x00 && c <= 0x1F) || c == 0x7F || c == '\\')
+		const unsigned char *q = findControlOrByte (p, end, '\\');
+		unsigned char c;
+
+		/* copy the run needing no escape at once */
+		vStringNCatSUnsafe (b, (const char *) p, q - p);
+		if (q == end)
+			break;
+
+		c = *q;
+		p = q + 1;
+		vStringPut (b, '\\');
+
+		switch (c)
 		{
-			vStringPut (b, '\\');
-
-			switch (c)
-			{
-				/* use a short form for known escapes */
-			case '\a':
-				c = 'a'; break;
-			case '\b':
-				c = 'b'; break;
-			case '\t':
-				c = 't'; break;
-			case '\n':
-				c = 'n'; break;
-			case '\v':
-				c = 'v'; break;
-			case '\f':
-				c = 'f'; break;
-			case '\r':
-				c = 'r'; break;
-			case '\\':
-				c = '\\'; break;
-			default:
-				vStringPut (b, 'x');
-				vStringPut (b, valueToXDigit ((c & 0xF0) >> 4));
-				vStringPut (b, valueToXDigit (c & 0x0F));
-				continue;
-			}
+			/* use a short form for known escapes */
+		case '\a':
+			c = 'a'; break;
+		case '\b':
+			c = 'b'; break;
+		case '\t':
+			c = 't'; break;
+		case '\n':
+			c = 'n'; break;
+		case '\v':
+			c = 'v'; break;
+		case '\f':
+			c = 'f'; break;
+		case '\r':
+			c = 'r'; break;
+		case '\\':
+			c = '\\'; break;
+		default:
+			vStringPut (b, 'x');
+			vStringPut (b, valueToXDigit ((c & 0xF0) >> 4));
+			vStringPut (b, valueToXDigit (c & 0x0F));
+			continue;
 		}
 		vStringPut (b, c);
 	}
@@ -357,24 +397,20 @@ extern void vStringCatSWithEscaping (vString* b, const char *s)
 
 extern void vStringCatSWithEscapingAsPattern (vString *output, const char* input)
 {
-	while (*input)
+	const unsigned char *p = (const unsigned char *) input;
+	const unsigned char *const end = p + strlen (input);
+
+	while (p < end)
 	{
-		switch (*input)
-		{
-		case '\\':
-			vStringPut(output, '\\');
-			vStringPut(output, '\\');
-			break;
-		case '/':
-			vStringPut(output, '\\');
-			vStringPut(output, '/');
-			break;
-		default:
-			vStringPut(output, *input);
+		const unsigned char *q = findByte2 (p, end, '\\', '/');
+
+		vStringNCatSUnsafe (output, (const char *) p, q - p);
+		if (q == end)
 			break;
 
-		}
-		input++;
+		vStringPut (output, '\\');
+		vStringPut (output, *q);
+		p = q + 1;
 	}
 }
 
@@ -31,6 +31,7 @@
 #define vStringLength(vs)     ((vs)->length)
 #define vStringIsEmpty(vs)    ((vs)->length == 0)
 #define vStringSize(vs)       ((vs)->size)
+#define vStringIsInline(vs)   ((vs)->buffer == (char *) ((vs) + 1))
 #define vStringLower(vs)      toLowerString((vs)->buffer)
 #define vStringUpper(vs)      toUpperString((vs)->buffer)
 #define vStringClear(string) \
@@ -56,6 +57,13 @@ typedef struct sVString {
 extern void vStringResize (vString *const string, const size_t newSize);
 extern vString *vStringNew (void);
 extern void vStringDelete (vString *const string);
+
+/* Use the SIZE bytes right after STRING as the initial buffer. STRING
+ * is a part of a memory block owned by the caller; it must not be
+ * passed to vStringDelete() or vStringDeleteUnwrap(). When the buffer
+ * grows, it is moved to the heap. vStringFinalizeInline() frees it. */
+extern void vStringInitInline (vString *const string, const size_t size);
+extern void vStringFinalizeInline (vString *const string);
 extern bool vStringStripNewline (vString *const string);
 extern void vStringStripLeading (vString *const string);
 extern void vStringChop (vString *const string);
@@ -0,0 +1,448 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   This module contains functions for keeping the tag file up to date with
+*   the input files (--watch).
+*
+*   The tag file is made in incremental mode, and made again each time the
+*   input files change. Each run is made in a child process forked after
+*   the options are processed, so every run starts from the same state.
+*
+*   A run writes the staging tag file, <tagfile>.staging, with the manifest
+*   keeping the state of incremental mode next to it. The staging tag file
+*   is then linked to <tagfile>.publishing, which is renamed to <tagfile>;
+*   a reader of the tag file sees the old tags or the new ones, never a
+*   tag file being written. The next run writes a new staging tag file
+*   instead of rewriting the one linked to the tag file.
+*
+*   The directories recursed into and the directories of the input files
+*   are watched with inotify. The changes notified in a burst, like the
+*   ones made by "git checkout", are gathered until no change is notified
+*   for WATCH_DEBOUNCE_MSEC before running again.
+*/
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "watch_p.h"
+
+#ifdef WATCH_SUPPORTED
+#include <errno.h>
+#include <poll.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/inotify.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#include "debug.h"
+#include "htable.h"
+#include "main_p.h"
+#include "options_p.h"
+#include "routines.h"
+#include "routines_p.h"
+#include "strlist.h"
+#include "vstring.h"
+
+/*
+*   MACROS
+*/
+#define STAGING_SUFFIX ".staging"
+#define PUBLISHING_SUFFIX ".publishing"
+#define NAME_INDEX_SUFFIX ".index"
+#define TRIGRAM_INDEX_SUFFIX ".trigrams"
+#define SECONDARY_INDEX_SUFFIX ".secondary"
+#define WATCH_DEBOUNCE_MSEC 500
+
+/*
+*   DATA DEFINITIONS
+*/
+
+/* The directories to be watched, recorded in a run: name -> itself */
+static hashTable *WatchedDirectories;
+
+/*
+*   FUNCTION DEFINITIONS
+*/
+
+extern void noteWatchedDirectory (const char *const dirName)
+{
+	if (WatchedDirectories == NULL
+		|| hashTableHasItem (WatchedDirectories, dirName))
+		return;
+
+	char *name = eStrdup (dirName);
+	hashTablePutItem (WatchedDirectories, name, name);
+}
+
+extern void noteWatchedInputFile (const char *const fileName)
+{
+	const char *base;
+	vString *dirName;
+
+	if (WatchedDirectories == NULL)
+		return;
+
+	base = baseFilename (fileName);
+	if (base == fileName)
+	{
+		noteWatchedDirectory (".");
+		return;
+	}
+
+	dirName = vStringNew ();
+	/* Keep the separator of a directory at the root. */
+	vStringNCopyS (dirName, fileName,
+				   (base - fileName > 1)? base - fileName - 1: 1);
+	noteWatchedDirectory (vStringValue (dirName));
+	vStringDelete (dirName);
+}
+
+#ifdef WATCH_SUPPORTED
+
+#define WATCH_EVENTS (IN_CLOSE_WRITE | IN_CREATE | IN_DELETE \
+					  | IN_MOVED_FROM | IN_MOVED_TO \
+					  | IN_DELETE_SELF | IN_MOVE_SELF)
+
+typedef struct sWatchState {
+	char *tagFileName;			/* to be published */
+	char *stagingName;
+	const char *tagFileBase;	/* the name of the tag file in its directory */
+	struct stat tagDirStatus;
+	int fd;						/* of inotify */
+	int tagDirWd;				/* the watch of the directory of the tag file */
+} watchState;
+
+static bool writeFully (int fd, const void *buf, size_t len)
+{
+	const char *p = buf;
+
+	while (len > 0)
+	{
+		ssize_t n = write (fd, p, len);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			return false;
+		p += n;
+		len -= (size_t) n;
+	}
+	return true;
+}
+
+static bool catWatchedDirectory (const void *key, void *value CTAGS_ATTR_UNUSED,
+								 void *user_data)
+{
+	vString *names = user_data;
+
+	vStringCatS (names, key);
+	vStringPut (names, '\0');
+	return true;
+}
+
+/* Run in the child process: make the tag file, and write the names of
+ * the directories to be watched to FD. */
+static void makeTagFileInChild (cookedArgs *args, int fd)
+{
+	vString *names = vStringNew ();
+	int status = 0;
+
+	WatchedDirectories = hashTableNew (256, hashCstrhash, hashCstreq,
+									   eFree, NULL);
+	batchMakeTags (args, NULL);
+
+	hashTableForeachItem (WatchedDirectories, catWatchedDirectory, names);
+	if (!writeFully (fd, vStringValue (names), vStringLength (names)))
+		status = 1;
+	close (fd);
+
+	fflush (stdout);
+	fflush (stderr);
+	/* Don't run exit(): the stdio streams inherited from the parent
+	 * process must not be flushed or closed here. */
+	_exit (status);
+}
+
+/* Make the tag file in a child process. The directories to be watched
+ * are stored to DIRS. Return false if the child process fails. */
+static bool makeTagFile (cookedArgs *args, stringList *dirs)
+{
+	char buffer [4096];
+	vString *names = vStringNew ();
+	int fds [2];
+	int status;
+	pid_t pid;
+	ssize_t n;
+
+	if (pipe (fds) != 0)
+		error (FATAL | PERROR, "cannot make a pipe");
+
+	fflush (stdout);
+	fflush (stderr);
+	pid = fork ();
+	if (pid < 0)
+		error (FATAL | PERROR, "cannot fork");
+	if (pid == 0)
+	{
+		close (fds [0]);
+		makeTagFileInChild (args, fds [1]);
+	}
+	close (fds [1]);
+
+	while ((n = read (fds [0], buffer, sizeof (buffer))) != 0)
+	{
+		if (n < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			break;
+		}
+		vStringNCatS (names, buffer, (size_t) n);
+	}
+	close (fds [0]);
+
+	while (waitpid (pid, &status, 0) < 0)
+	{
+		if (errno != EINTR)
+			error (FATAL | PERROR, "cannot wait for the child process");
+	}
+
+	stringListClear (dirs);
+	for (size_t i = 0; i < vStringLength (names); )
+	{
+		const char *name = vStringValue (names) + i;
+
+		stringListAdd (dirs, vStringNewInit (name));
+		i += strlen (name) + 1;
+	}
+	vStringDelete (names);
+
+	return WIFEXITED (status) && WEXITSTATUS (status) == 0;
+}
+
+/* Make PUBLISHED refer to the contents of STAGED, replacing the old
+ * PUBLISHED at once. */
+static void publishFile (const char *const staged, const char *const published)
+{
+	vString *temp = vStringNewInit (published);
+
+	vStringCatS (temp, PUBLISHING_SUFFIX);
+	remove (vStringValue (temp));
+	if (link (staged, vStringValue (temp)) != 0
+		|| rename (vStringValue (temp), published) != 0)
+		error (WARNING | PERROR, "cannot publish \"%s\" as \"%s\"",
+			   staged, published);
+	vStringDelete (temp);
+}
+
+/* Publish the sidecar file of the staging tag file with SUFFIX. */
+static void publishSidecarFile (const watchState *const state,
+								const char *const suffix)
+{
+	vString *staged = vStringNewInit (state->stagingName);
+	vString *published = vStringNewInit (state->tagFileName);
+
+	vStringCatS (staged, suffix);
+	vStringCatS (published, suffix);
+	publishFile (vStringValue (staged), vStringValue (published));
+	/* The next run writes a new one instead of rewriting the
+	 * published one. */
+	remove (vStringValue (staged));
+	vStringDelete (published);
+	vStringDelete (staged);
+}
+
+static void publishTagFile (const watchState *const state)
+{
+	publishFile (state->stagingName, state->tagFileName);
+	if (Option.nameIndex)
+		publishSidecarFile (state, NAME_INDEX_SUFFIX);
+	if (Option.trigramIndex)
+		publishSidecarFile (state, TRIGRAM_INDEX_SUFFIX);
+	if (Option.secondaryIndex)
+		publishSidecarFile (state, SECONDARY_INDEX_SUFFIX);
+	verbose ("published %s\n", state->tagFileName);
+}
+
+static void watchDirectories (watchState *const state, const stringList *const dirs)
+{
+	for (unsigned int i = 0; i < stringListCount (dirs); i++)
+	{
+		const char *dirName = vStringValue (stringListItem (dirs, i));
+		struct stat st;
+		int wd = inotify_add_watch (state->fd, dirName, WATCH_EVENTS | IN_ONLYDIR);
+
+		if (wd < 0)
+		{
+			error (WARNING | PERROR, "cannot watch \"%s\"", dirName);
+			continue;
+		}
+		if (stat (dirName, &st) == 0
+			&& st.st_dev == state->tagDirStatus.st_dev
+			&& st.st_ino == state->tagDirStatus.st_ino)
+			state->tagDirWd = wd;
+	}
+}
+
+/* Whether NAME is the tag file or a file made next to it. */
+static bool isTagFileName (const watchState *const state, const char *const name)
+{
+	static const char *const suffixes [] = {
+		"staging", "publishing", "manifest", "prev", "index", "trigrams",
+		"secondary", NULL
+	};
+	size_t length = strlen (state->tagFileBase);
+	const char *p;
+
+	if (strncmp (name, state->tagFileBase, length) != 0)
+		return false;
+
+	p = name + length;
+	while (*p == '.')
+	{
+		const char *const s = ++p;
+		const char *const *suffix;
+
+		p = strchr (s, '.');
+		if (p == NULL)
+			p = s + strlen (s);
+		for (suffix = suffixes; *suffix; suffix++)
+		{
+			if (strlen (*suffix) == (size_t) (p - s)
+				&& strncmp (*suffix, s, p - s) == 0)
+				break;
+		}
+		if (*suffix == NULL)
+			return false;
+	}
+	return *p == '\0';
+}
+
+static bool isInputChange (const watchState *const state,
+						   const struct inotify_event *const event)
+{
+	if (event->mask & IN_Q_OVERFLOW)
+		return true;
+	if (event->mask & IN_IGNORED)
+		return false;
+	if (event->wd == state->tagDirWd && event->len > 0
+		&& isTagFileName (state, event->name))
+		return false;
+	return true;
+}
+
+/* Wait until the input files change, and return the number of the
+ * changes notified until no change is notified for WATCH_DEBOUNCE_MSEC. */
+static unsigned int waitForChanges (const watchState *const state)
+{
+	union {
+		struct inotify_event event;
+		char bytes [4096];
+	} buffer;
+	unsigned int changes = 0;
+	int timeout = -1;
+
+	while (true)
+	{
+		struct pollfd pfd = { .fd = state->fd, .events = POLLIN };
+		int r = poll (&pfd, 1, timeout);
+		ssize_t n;
+
+		if (r < 0)
+		{
+			if (errno == EINTR)
+				continue;
+			error (FATAL | PERROR, "cannot wait for changes of input files");
+		}
+		if (r == 0)
+			break;
+
+		n = read (state->fd, buffer.bytes, sizeof (buffer.bytes));
+		if (n < 0)
+		{
+			if (errno == EINTR || errno == EAGAIN)
+				continue;
+			error (FATAL | PERROR, "cannot read changes of input files");
+		}
+
+		for (const char *p = buffer.bytes; p < buffer.bytes + n; )
+		{
+			const struct inotify_event *event = (const struct inotify_event *) p;
+
+			if (isInputChange (state, event))
+				changes++;
+			p += sizeof (struct inotify_event) + event->len;
+		}
+		if (changes > 0)
+			timeout = WATCH_DEBOUNCE_MSEC;
+	}
+	return changes;
+}
+
+static void initWatchState (watchState *const state)
+{
+	char *tagDir;
+	vString *staging;
+
+	setDefaultTagFileName ();
+	state->tagFileName = eStrdup (Option.tagFileName);
+	state->tagFileBase = baseFilename (state->tagFileName);
+
+	staging = vStringNewInit (state->tagFileName);
+	vStringCatS (staging, STAGING_SUFFIX);
+	state->stagingName = vStringDeleteUnwrap (staging);
+	/* The runs write the staging tag file. */
+	setTagFileName (state->stagingName);
+
+	tagDir = absoluteDirname (state->tagFileName);
+	if (stat (tagDir, &state->tagDirStatus) != 0)
+		error (FATAL | PERROR, "cannot find the directory of \"%s\"",
+			   state->tagFileName);
+	eFree (tagDir);
+
+	state->fd = inotify_init1 (IN_CLOEXEC);
+	if (state->fd < 0)
+		error (FATAL | PERROR, "cannot watch input files");
+	state->tagDirWd = -1;
+}
+
+extern void watchTagFile (cookedArgs *args, void *data CTAGS_ATTR_UNUSED)
+{
+	stringList *dirs = stringListNew ();
+	watchState state;
+	bool first = true;
+
+	initWatchState (&state);
+
+	while (true)
+	{
+		unsigned int changes;
+
+		/* Changes made while running are notified for the directories
+		 * found in the previous run; the new directories are watched
+		 * after the run. */
+		if (makeTagFile (args, dirs))
+			publishTagFile (&state);
+		else if (first)
+			error (FATAL, "cannot make the tag file \"%s\"", state.tagFileName);
+		else
+			error (WARNING, "cannot make the tag file \"%s\"; left as is",
+				   state.tagFileName);
+		first = false;
+
+		watchDirectories (&state, dirs);
+		changes = waitForChanges (&state);
+		verbose ("%u change%s of input files notified\n",
+				 changes, (changes == 1)? "": "s");
+	}
+}
+
+#endif	/* WATCH_SUPPORTED */
@@ -0,0 +1,41 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for keeping the tag file up to date with the input
+*   files (--watch).
+*/
+#ifndef CTAGS_MAIN_WATCH_PRIVATE_H
+#define CTAGS_MAIN_WATCH_PRIVATE_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+#include "options_p.h"
+
+/*
+*   MACROS
+*/
+#if defined (HAVE_FORK) && defined (HAVE_INOTIFY_INIT1)
+# define WATCH_SUPPORTED
+#endif
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+
+/* The main loop of --watch. The tag file is made, and made again each
+ * time the input files change, until the process is killed. */
+extern void watchTagFile (cookedArgs *args, void *data);
+
+/* Record the directory of FILENAME, an input file, or DIRNAME, a directory
+ * recursed into, to be watched. Nothing is done unless the tag file is
+ * made for --watch. */
+extern void noteWatchedInputFile (const char *const fileName);
+extern void noteWatchedDirectory (const char *const dirName);
+
+#endif	/* CTAGS_MAIN_WATCH_PRIVATE_H */
@@ -0,0 +1,561 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   A binary tags file format which readtags can load without parsing lines
+*/
+
+#include "general.h"  /* must always come first */
+
+#include "debug.h"
+#include "entry_p.h"
+#include "htable.h"
+#include "mio.h"
+#include "options_p.h"
+#include "routines.h"
+#include "vstring.h"
+#include "writer_p.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  Layout of the file; all numbers are 32-bit little endian:
+ *
+ *    BINARY_MAGIC       32 bytes; it looks like a pseudo tag line so that
+ *                       ctags can tell the file is a tag file.
+ *    header             8 numbers: sort method (0, 1, or 2), the number
+ *                       of pseudo tags, the number of tags, the number of
+ *                       fields, the size of the string table, and 3
+ *                       reserved numbers.
+ *    records            8 numbers for each pseudo tag and then each tag:
+ *                       name, input file, pattern, kind (offsets in the
+ *                       string table; BINARY_NO_STRING for no kind), the
+ *                       index of the first field, the number of fields,
+ *                       flags, and line number.
+ *    fields             2 numbers for each field: key and value
+ *    string table       NUL terminated strings, each stored once
+ *
+ *  A record holds what libreadtags reads from the line of the tag in
+ *  u-ctags format: the line is rendered with the u-ctags writer, and
+ *  parsed into unescaped strings here. The records are sorted as the
+ *  lines of a sorted tag file are. See readtags.c in libreadtags for
+ *  the reader.
+ */
+#define BINARY_MAGIC "!_TAG_BINARY_FORMAT\t1\t/u-ctags/\n"
+#define BINARY_MAGIC_SIZE 32
+#define BINARY_HEADER_NUMBERS 8
+#define BINARY_RECORD_NUMBERS 8
+#define BINARY_NO_STRING 0xffffffffU
+#define BINARY_FLAG_FILE_SCOPE 0x1
+
+#define BINARY_FILE  "tags"
+
+
+static int writeBinaryEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+							 MIO * mio, const tagEntryInfo *const tag,
+							 void *clientData);
+static int writeBinaryPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+								 MIO * mio, const ptagDesc *desc,
+								 const char *const fileName,
+								 const char *const pattern,
+								 const char *const parserName,
+								 void *clientData);
+static void rescanFailedBinaryEntry (tagWriter *writer, unsigned long validTagNum,
+									 void *clientData);
+static void finishBinaryFile (tagWriter *writer, MIO * mio,
+							  void *clientData);
+static bool treatFieldAsFixed (int fieldType);
+static void checkBinaryOptions (tagWriter *writer, bool fieldsWereReset);
+
+extern tagWriter uCtagsWriter;
+
+tagWriter binaryWriter = {
+	.writeEntry = writeBinaryEntry,
+	.writePtagEntry = writeBinaryPtagEntry,
+	.printPtagByDefault = true,
+	.preWriteEntry = NULL,
+	.postWriteEntry = NULL,
+	.rescanFailedEntry = rescanFailedBinaryEntry,
+	.finishWriting = finishBinaryFile,
+	.sortsTags = true,
+	.treatFieldAsFixed = treatFieldAsFixed,
+	.checkOptions = checkBinaryOptions,
+	.defaultFileName = BINARY_FILE,
+};
+
+typedef struct sBinaryRecord {
+	uint32_t numbers [BINARY_RECORD_NUMBERS];
+	size_t line;				/* offset of the u-ctags line in `lines' */
+	unsigned long seq;			/* the number of entries written before */
+} binaryRecord;
+
+enum binaryRecordNumber {
+	BR_NAME,
+	BR_FILE,
+	BR_PATTERN,
+	BR_KIND,
+	BR_FIELD_START,
+	BR_FIELD_COUNT,
+	BR_FLAGS,
+	BR_LINE_NUMBER,
+};
+
+typedef struct sBinaryRecords {
+	binaryRecord *table;
+	size_t count;
+	size_t size;
+} binaryRecords;
+
+typedef struct sBinaryBuffer {
+	char *data;
+	size_t length;
+	size_t size;
+} binaryBuffer;
+
+static struct sBinaryState {
+	hashTable *strings;			/* string => its offset in `stringTable' + 1 */
+	binaryBuffer stringTable;
+	binaryBuffer lines;
+	binaryRecords ptags;
+	binaryRecords tags;
+	uint32_t *fields;			/* key and value pairs */
+	size_t fieldCount;
+	size_t fieldSize;
+	unsigned long added;
+	MIO *scratch;
+	vString *value;
+} Binary;
+
+static const char *SortedLines;
+static bool SortFolded;
+
+static size_t appendToBuffer (binaryBuffer *buf, const char *data, size_t length)
+{
+	size_t offset = buf->length;
+
+	if (buf->length + length + 1 > buf->size)
+	{
+		size_t size = buf->size? buf->size: 4096;
+		while (buf->length + length + 1 > size)
+			size *= 2;
+		buf->data = xRealloc (buf->data, size, char);
+		buf->size = size;
+	}
+	memcpy (buf->data + buf->length, data, length);
+	buf->data [buf->length + length] = '\0';
+	buf->length += length + 1;
+	return offset;
+}
+
+static uint32_t internString (const char *str)
+{
+	uintptr_t offset = (uintptr_t) hashTableGetItem (Binary.strings, str);
+
+	if (offset == 0)
+	{
+		size_t length = strlen (str);
+		offset = appendToBuffer (&Binary.stringTable, str, length);
+		if (offset + length >= BINARY_NO_STRING)
+			error (FATAL, "too many strings for binary output");
+		hashTablePutItem (Binary.strings, eStrdup (str),
+						  HT_UINT_TO_PTR ((unsigned int) offset + 1));
+		return (uint32_t) offset;
+	}
+	return (uint32_t) (offset - 1);
+}
+
+static int xdigitValue (unsigned char digit)
+{
+	if (digit >= '0' && digit <= '9')
+		return digit - '0';
+	else if (digit >= 'a' && digit <= 'f')
+		return 10 + digit - 'a';
+	else if (digit >= 'A' && digit <= 'F')
+		return 10 + digit - 'A';
+	return 0;
+}
+
+/*  Intern the string between S and END after undoing the escaping of
+ *  the u-ctags writer in the same way as readTagCharacter () of
+ *  libreadtags does.
+ */
+static uint32_t internUnescaped (const char *s, const char *const end)
+{
+	vStringClear (Binary.value);
+	while (s < end)
+	{
+		int c = (unsigned char) *s++;
+
+		if (c == '\\' && s < end)
+		{
+			switch (*s)
+			{
+			case 't': c = '\t'; s++; break;
+			case 'r': c = '\r'; s++; break;
+			case 'n': c = '\n'; s++; break;
+			case '\\': c = '\\'; s++; break;
+			case 'a': c = '\a'; s++; break;
+			case 'b': c = '\b'; s++; break;
+			case 'v': c = '\v'; s++; break;
+			case 'f': c = '\f'; s++; break;
+			case 'x':
+				if (s + 2 < end
+					&& isxdigit ((unsigned char) s[1]) && isxdigit ((unsigned char) s[2]))
+				{
+					int val = (xdigitValue ((unsigned char) s[1]) << 4)
+						| xdigitValue ((unsigned char) s[2]);
+					if (val < 0x80)
+					{
+						s += 3;
+						c = val;
+					}
+				}
+				break;
+			}
+		}
+		vStringPut (Binary.value, c);
+	}
+	return internString (vStringValue (Binary.value));
+}
+
+static uint32_t internRaw (const char *s, const char *const end)
+{
+	vStringNCopyS (Binary.value, s, (size_t) (end - s));
+	return internString (vStringValue (Binary.value));
+}
+
+static void addField (uint32_t key, uint32_t value)
+{
+	if (Binary.fieldCount + 2 > Binary.fieldSize)
+	{
+		Binary.fieldSize = Binary.fieldSize? Binary.fieldSize * 2: 1024;
+		Binary.fields = xRealloc (Binary.fields, Binary.fieldSize, uint32_t);
+	}
+	Binary.fields [Binary.fieldCount++] = key;
+	Binary.fields [Binary.fieldCount++] = value;
+}
+
+/*  Return the end of the pattern starting with a delimiter at P. */
+static const char *skipPattern (const char *p, const char *const end)
+{
+	const char delimiter = *p;
+
+	for (p++; p < end; p++)
+	{
+		if (*p == '\\' && p + 1 < end)
+			p++;
+		else if (*p == delimiter)
+			return p + 1;
+	}
+	return end;
+}
+
+static void parseExtensionFields (binaryRecord *r, const char *p, const char *const end)
+{
+	while (p < end)
+	{
+		const char *field, *fieldEnd, *colon;
+
+		if (*p == '\t')
+		{
+			p++;
+			continue;
+		}
+		field = p;
+		fieldEnd = memchr (p, '\t', (size_t) (end - p));
+		if (fieldEnd == NULL)
+			fieldEnd = end;
+		p = fieldEnd;
+
+		colon = memchr (field, ':', (size_t) (fieldEnd - field));
+		if (colon == NULL)
+			r->numbers [BR_KIND] = internRaw (field, fieldEnd);
+		else if (colon - field == 4 && strncmp (field, "kind", 4) == 0)
+			r->numbers [BR_KIND] = internUnescaped (colon + 1, fieldEnd);
+		else if (colon - field == 4 && strncmp (field, "file", 4) == 0)
+			r->numbers [BR_FLAGS] |= BINARY_FLAG_FILE_SCOPE;
+		else if (colon - field == 4 && strncmp (field, "line", 4) == 0)
+			r->numbers [BR_LINE_NUMBER] = (uint32_t) strtoul (colon + 1, NULL, 10);
+		else
+		{
+			uint32_t key = internRaw (field, colon);
+			addField (key, internUnescaped (colon + 1, fieldEnd));
+			r->numbers [BR_FIELD_COUNT]++;
+		}
+	}
+}
+
+/*  Fill R with the columns and the fields of LINE rendered by the
+ *  u-ctags writer.
+ */
+static void parseLine (binaryRecord *r, const char *const line, size_t length)
+{
+	const char *const end = line + length;
+	const char *p = line;
+	const char *tab;
+
+	r->numbers [BR_KIND] = BINARY_NO_STRING;
+	r->numbers [BR_FIELD_START] = (uint32_t) (Binary.fieldCount / 2);
+	r->numbers [BR_FIELD_COUNT] = 0;
+	r->numbers [BR_FLAGS] = 0;
+	r->numbers [BR_LINE_NUMBER] = 0;
+
+	tab = memchr (p, '\t', length);
+	r->numbers [BR_NAME] = internUnescaped (p, tab? tab: end);
+	if (tab == NULL)
+	{
+		r->numbers [BR_FILE] = r->numbers [BR_PATTERN] = internString ("");
+		return;
+	}
+
+	p = tab + 1;
+	tab = memchr (p, '\t', (size_t) (end - p));
+	r->numbers [BR_FILE] = internUnescaped (p, tab? tab: end);
+	if (tab == NULL)
+	{
+		r->numbers [BR_PATTERN] = internString ("");
+		return;
+	}
+
+	p = tab + 1;
+	const char *pattern = p;
+	if (*p == '/' || *p == '?')
+		p = skipPattern (p, end);
+	else if (isdigit ((unsigned char) *p))
+	{
+		r->numbers [BR_LINE_NUMBER] = (uint32_t) strtoul (p, NULL, 10);
+		while (p < end && isdigit ((unsigned char) *p))
+			p++;
+		if (end - p >= 2 && p [0] == ';' && (p [1] == '/' || p [1] == '?'))
+			p = skipPattern (p + 1, end);
+	}
+	r->numbers [BR_PATTERN] = internRaw (pattern, p);
+
+	if (end - p >= 2 && p [0] == ';' && p [1] == '"')
+		parseExtensionFields (r, p + 2, end);
+}
+
+static binaryRecord *newRecord (binaryRecords *records)
+{
+	if (records->count == records->size)
+	{
+		records->size = records->size? records->size * 2: 1024;
+		records->table = xRealloc (records->table, records->size, binaryRecord);
+	}
+	return records->table + records->count++;
+}
+
+/*  Record the line rendered into the scratch MIO. */
+static int addRecord (binaryRecords *records, int length)
+{
+	size_t size;
+	const char *data;
+	binaryRecord *r;
+
+	if (length <= 0)
+		return length;
+
+	data = (const char *) mio_memory_get_data (Binary.scratch, &size);
+	Assert ((size_t) length <= size && data [length - 1] == '\n');
+
+	r = newRecord (records);
+	r->seq = Binary.added++;
+	r->line = appendToBuffer (&Binary.lines, data, (size_t) length - 1);
+	parseLine (r, Binary.lines.data + r->line, (size_t) length - 1);
+
+	return length;
+}
+
+static MIO *rewindScratch (void)
+{
+	if (Binary.strings == NULL)
+	{
+		Binary.strings = hashTableNewFlat (4096, hashCstrhash, hashCstreq,
+										   eFree, NULL);
+		Binary.scratch = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+		Binary.value = vStringNew ();
+	}
+	mio_seek (Binary.scratch, 0, SEEK_SET);
+	return Binary.scratch;
+}
+
+static int writeBinaryEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+							 MIO * mio CTAGS_ATTR_UNUSED, const tagEntryInfo *const tag,
+							 void *clientData CTAGS_ATTR_UNUSED)
+{
+	MIO *scratch = rewindScratch ();
+	int length = uCtagsWriter.writeEntry (&uCtagsWriter, scratch, tag, NULL);
+
+	return addRecord (&Binary.tags, length);
+}
+
+static int writeBinaryPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+								 MIO * mio CTAGS_ATTR_UNUSED, const ptagDesc *desc,
+								 const char *const fileName,
+								 const char *const pattern,
+								 const char *const parserName,
+								 void *clientData CTAGS_ATTR_UNUSED)
+{
+	MIO *scratch = rewindScratch ();
+	int length = uCtagsWriter.writePtagEntry (&uCtagsWriter, scratch, desc,
+											  fileName, pattern, parserName,
+											  NULL);
+	return addRecord (&Binary.ptags, length);
+}
+
+static void dropRecordsAfter (binaryRecords *records, unsigned long validTagNum)
+{
+	while (records->count > 0
+		   && records->table [records->count - 1].seq >= validTagNum)
+	{
+		binaryRecord *r = records->table + records->count - 1;
+		size_t fieldStart = 2 * (size_t) r->numbers [BR_FIELD_START];
+
+		/* The fields of a record are added after the fields of the
+		 * records written before. */
+		if (fieldStart < Binary.fieldCount)
+			Binary.fieldCount = fieldStart;
+		records->count--;
+	}
+}
+
+static void rescanFailedBinaryEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+									 unsigned long validTagNum,
+									 void *clientData CTAGS_ATTR_UNUSED)
+{
+	dropRecordsAfter (&Binary.ptags, validTagNum);
+	dropRecordsAfter (&Binary.tags, validTagNum);
+	if (Binary.added > validTagNum)
+		Binary.added = validTagNum;
+}
+
+static int compareRecords (const void *const one, const void *const two)
+{
+	const char *line1 = SortedLines + ((const binaryRecord *) one)->line;
+	const char *line2 = SortedLines + ((const binaryRecord *) two)->line;
+
+	if (SortFolded)
+	{
+		int r = struppercmp (line1, line2);
+		if (r)
+			return r;
+	}
+	return strcmp (line1, line2);
+}
+
+/*  Sort the records, and remove the records with identical lines as
+ *  sorting a tag file does.
+ */
+static void sortRecords (binaryRecords *records)
+{
+	size_t i, n = 0;
+
+	if (Option.sorted == SO_UNSORTED || records->count == 0)
+		return;
+
+	SortedLines = Binary.lines.data;
+	SortFolded = (Option.sorted == SO_FOLDSORTED);
+	qsort (records->table, records->count, sizeof (binaryRecord), compareRecords);
+
+	for (i = 1; i < records->count; i++)
+	{
+		if (strcmp (SortedLines + records->table [n].line,
+					SortedLines + records->table [i].line) != 0)
+			records->table [++n] = records->table [i];
+	}
+	records->count = n + 1;
+}
+
+static void writeNumbers (MIO *mio, const uint32_t *numbers, size_t count)
+{
+	unsigned char buf [BINARY_RECORD_NUMBERS * 4];
+
+	while (count > 0)
+	{
+		size_t n = count < BINARY_RECORD_NUMBERS? count: BINARY_RECORD_NUMBERS;
+
+		for (size_t i = 0; i < n; i++)
+		{
+			buf [i * 4 + 0] = (unsigned char) (numbers [i] & 0xff);
+			buf [i * 4 + 1] = (unsigned char) ((numbers [i] >> 8) & 0xff);
+			buf [i * 4 + 2] = (unsigned char) ((numbers [i] >> 16) & 0xff);
+			buf [i * 4 + 3] = (unsigned char) ((numbers [i] >> 24) & 0xff);
+		}
+		if (mio_write (mio, buf, 4, n) < n)
+			error (FATAL | PERROR, "cannot complete write");
+		numbers += n;
+		count -= n;
+	}
+}
+
+static void writeRecords (MIO *mio, const binaryRecords *records)
+{
+	for (size_t i = 0; i < records->count; i++)
+		writeNumbers (mio, records->table [i].numbers, BINARY_RECORD_NUMBERS);
+}
+
+static void clearBinaryState (void)
+{
+	if (Binary.strings)
+	{
+		hashTableDelete (Binary.strings);
+		mio_unref (Binary.scratch);
+		vStringDelete (Binary.value);
+	}
+	eFreeNoNullCheck (Binary.stringTable.data);
+	eFreeNoNullCheck (Binary.lines.data);
+	eFreeNoNullCheck (Binary.ptags.table);
+	eFreeNoNullCheck (Binary.tags.table);
+	eFreeNoNullCheck (Binary.fields);
+
+	memset (&Binary, 0, sizeof (Binary));
+}
+
+static void finishBinaryFile (tagWriter *writer CTAGS_ATTR_UNUSED, MIO * mio,
+							  void *clientData CTAGS_ATTR_UNUSED)
+{
+	uint32_t header [BINARY_HEADER_NUMBERS] = { 0 };
+
+	if (Binary.added == 0)
+		return;
+
+	sortRecords (&Binary.ptags);
+	sortRecords (&Binary.tags);
+
+	header [0] = (uint32_t) Option.sorted;
+	header [1] = (uint32_t) Binary.ptags.count;
+	header [2] = (uint32_t) Binary.tags.count;
+	header [3] = (uint32_t) (Binary.fieldCount / 2);
+	header [4] = (uint32_t) Binary.stringTable.length;
+
+	verbose ("writing %lu pseudo tags and %lu tags in binary format\n",
+			 (unsigned long) Binary.ptags.count, (unsigned long) Binary.tags.count);
+
+	if (mio_write (mio, BINARY_MAGIC, 1, BINARY_MAGIC_SIZE) < BINARY_MAGIC_SIZE)
+		error (FATAL | PERROR, "cannot complete write");
+	writeNumbers (mio, header, BINARY_HEADER_NUMBERS);
+	writeRecords (mio, &Binary.ptags);
+	writeRecords (mio, &Binary.tags);
+	writeNumbers (mio, Binary.fields, Binary.fieldCount);
+	if (Binary.stringTable.length > 0
+		&& mio_write (mio, Binary.stringTable.data, 1, Binary.stringTable.length)
+		< Binary.stringTable.length)
+		error (FATAL | PERROR, "cannot complete write");
+
+	clearBinaryState ();
+}
+
+static bool treatFieldAsFixed (int fieldType)
+{
+	return uCtagsWriter.treatFieldAsFixed (fieldType);
+}
+
+static void checkBinaryOptions (tagWriter *writer CTAGS_ATTR_UNUSED,
+								bool fieldsWereReset)
+{
+	uCtagsWriter.checkOptions (&uCtagsWriter, fieldsWereReset);
+}
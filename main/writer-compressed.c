@@ -0,0 +1,428 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   A tags file made of independently compressed blocks of tag lines
+*/
+
+#include "general.h"  /* must always come first */
+
+#include "debug.h"
+#include "entry_p.h"
+#include "mio.h"
+#include "options_p.h"
+#include "routines.h"
+#include "writer_p.h"
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+
+/*  Layout of the file; all numbers are 32-bit little endian, and an
+ *  offset is a pair of numbers, the lower 32 bits first:
+ *
+ *    COMPRESSED_MAGIC   it looks like a pseudo tag line so that ctags
+ *                       can tell the file is a tag file.
+ *    header             8 numbers: sort method (0, 1, or 2), the number
+ *                       of blocks, the offset of the block index, the
+ *                       size of the tag lines before compression (an
+ *                       offset), the target size of a block, and a
+ *                       reserved number.
+ *    blocks             a zlib stream for each block. A block holds the
+ *                       lines of a u-ctags tag file from the beginning of
+ *                       a line to the end of a line.
+ *    block index        6 numbers for each block: the offset of the
+ *                       block, its size, its size before compression,
+ *                       the offset of the first tag name of the block in
+ *                       the name table, and a reserved number.
+ *    name table         NUL terminated first tag names of the blocks,
+ *                       as written in the lines.
+ *
+ *  Concatenating the uncompressed blocks gives the tag file ctags makes
+ *  with --output-format=u-ctags. A reader bisects the name table to
+ *  find the block that can have a name, and decompresses only the
+ *  block. See readtags.c in libreadtags for the reader.
+ */
+#define COMPRESSED_MAGIC "!_TAG_COMPRESSED_FORMAT\t1\t/zlib/\n"
+#define COMPRESSED_MAGIC_SIZE (sizeof (COMPRESSED_MAGIC) - 1)
+#define COMPRESSED_HEADER_NUMBERS 8
+#define COMPRESSED_HEADER_SIZE (COMPRESSED_MAGIC_SIZE + COMPRESSED_HEADER_NUMBERS * 4)
+#define COMPRESSED_INDEX_NUMBERS 6
+#define COMPRESSED_BLOCK_SIZE (64 * 1024)
+
+#define COMPRESSED_FILE  "tags"
+
+
+static int writeCompressedEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+								 MIO * mio, const tagEntryInfo *const tag,
+								 void *clientData);
+static int writeCompressedPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+									 MIO * mio, const ptagDesc *desc,
+									 const char *const fileName,
+									 const char *const pattern,
+									 const char *const parserName,
+									 void *clientData);
+static void rescanFailedCompressedEntry (tagWriter *writer, unsigned long validTagNum,
+										 void *clientData);
+static void finishCompressedFile (tagWriter *writer, MIO * mio,
+								  void *clientData);
+static bool treatFieldAsFixed (int fieldType);
+static void checkCompressedOptions (tagWriter *writer, bool fieldsWereReset);
+
+extern tagWriter uCtagsWriter;
+
+tagWriter compressedWriter = {
+	.writeEntry = writeCompressedEntry,
+	.writePtagEntry = writeCompressedPtagEntry,
+	.printPtagByDefault = true,
+	.preWriteEntry = NULL,
+	.postWriteEntry = NULL,
+	.rescanFailedEntry = rescanFailedCompressedEntry,
+	.finishWriting = finishCompressedFile,
+	.sortsTags = true,
+	.treatFieldAsFixed = treatFieldAsFixed,
+	.checkOptions = checkCompressedOptions,
+	.defaultFileName = COMPRESSED_FILE,
+};
+
+typedef struct sCompressedLine {
+	size_t offset;				/* offset of the line in `lines' */
+	size_t length;				/* without the newline */
+	unsigned long seq;			/* the number of entries written before */
+} compressedLine;
+
+typedef struct sCompressedLines {
+	compressedLine *table;
+	size_t count;
+	size_t size;
+} compressedLines;
+
+typedef struct sCompressedBuffer {
+	unsigned char *data;
+	size_t length;
+	size_t size;
+} compressedBuffer;
+
+static struct sCompressedState {
+	compressedBuffer lines;		/* NUL terminated lines */
+	compressedLines ptags;
+	compressedLines tags;
+	unsigned long added;
+	MIO *scratch;
+
+	/* used while writing the blocks */
+	compressedBuffer block;
+	compressedBuffer blocks;	/* compressed blocks */
+	compressedBuffer names;
+	uint32_t *index;
+	size_t blockCount;
+	size_t indexSize;
+	uint64_t totalSize;
+} Compressed;
+
+static const char *SortedLines;
+static bool SortFolded;
+
+static void reserveBuffer (compressedBuffer *buf, size_t length)
+{
+	if (buf->length + length > buf->size)
+	{
+		size_t size = buf->size? buf->size: 4096;
+		while (buf->length + length > size)
+			size *= 2;
+		buf->data = xRealloc (buf->data, size, unsigned char);
+		buf->size = size;
+	}
+}
+
+static size_t appendToBuffer (compressedBuffer *buf, const void *data, size_t length,
+							  int terminator)
+{
+	size_t offset = buf->length;
+
+	reserveBuffer (buf, length + 1);
+	memcpy (buf->data + buf->length, data, length);
+	buf->length += length;
+	if (terminator != EOF)
+		buf->data [buf->length++] = (unsigned char) terminator;
+	return offset;
+}
+
+/*  Record the line rendered into the scratch MIO. */
+static int addLine (compressedLines *lines, int length)
+{
+	size_t size;
+	const char *data;
+	compressedLine *l;
+
+	if (length <= 0)
+		return length;
+
+	data = (const char *) mio_memory_get_data (Compressed.scratch, &size);
+	Assert ((size_t) length <= size && data [length - 1] == '\n');
+
+	if (lines->count == lines->size)
+	{
+		lines->size = lines->size? lines->size * 2: 1024;
+		lines->table = xRealloc (lines->table, lines->size, compressedLine);
+	}
+	l = lines->table + lines->count++;
+	l->seq = Compressed.added++;
+	l->length = (size_t) length - 1;
+	l->offset = appendToBuffer (&Compressed.lines, data, l->length, '\0');
+
+	return length;
+}
+
+static MIO *rewindScratch (void)
+{
+	if (Compressed.scratch == NULL)
+		Compressed.scratch = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+	mio_seek (Compressed.scratch, 0, SEEK_SET);
+	return Compressed.scratch;
+}
+
+static int writeCompressedEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+								 MIO * mio CTAGS_ATTR_UNUSED, const tagEntryInfo *const tag,
+								 void *clientData CTAGS_ATTR_UNUSED)
+{
+	MIO *scratch = rewindScratch ();
+	int length = uCtagsWriter.writeEntry (&uCtagsWriter, scratch, tag, NULL);
+
+	return addLine (&Compressed.tags, length);
+}
+
+static int writeCompressedPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+									 MIO * mio CTAGS_ATTR_UNUSED, const ptagDesc *desc,
+									 const char *const fileName,
+									 const char *const pattern,
+									 const char *const parserName,
+									 void *clientData CTAGS_ATTR_UNUSED)
+{
+	MIO *scratch = rewindScratch ();
+	int length = uCtagsWriter.writePtagEntry (&uCtagsWriter, scratch, desc,
+											  fileName, pattern, parserName,
+											  NULL);
+	return addLine (&Compressed.ptags, length);
+}
+
+static void dropLinesAfter (compressedLines *lines, unsigned long validTagNum)
+{
+	while (lines->count > 0
+		   && lines->table [lines->count - 1].seq >= validTagNum)
+		lines->count--;
+}
+
+static void rescanFailedCompressedEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+										 unsigned long validTagNum,
+										 void *clientData CTAGS_ATTR_UNUSED)
+{
+	dropLinesAfter (&Compressed.ptags, validTagNum);
+	dropLinesAfter (&Compressed.tags, validTagNum);
+	if (Compressed.added > validTagNum)
+		Compressed.added = validTagNum;
+}
+
+static int compareLines (const void *const one, const void *const two)
+{
+	const char *line1 = SortedLines + ((const compressedLine *) one)->offset;
+	const char *line2 = SortedLines + ((const compressedLine *) two)->offset;
+
+	if (SortFolded)
+	{
+		int r = struppercmp (line1, line2);
+		if (r)
+			return r;
+	}
+	return strcmp (line1, line2);
+}
+
+/*  Sort the lines, and remove identical lines as sorting a tag file
+ *  does.
+ */
+static void sortLines (compressedLines *lines)
+{
+	size_t i, n = 0;
+
+	if (Option.sorted == SO_UNSORTED || lines->count == 0)
+		return;
+
+	SortedLines = (const char *) Compressed.lines.data;
+	SortFolded = (Option.sorted == SO_FOLDSORTED);
+	qsort (lines->table, lines->count, sizeof (compressedLine), compareLines);
+
+	for (i = 1; i < lines->count; i++)
+	{
+		if (strcmp (SortedLines + lines->table [n].offset,
+					SortedLines + lines->table [i].offset) != 0)
+			lines->table [++n] = lines->table [i];
+	}
+	lines->count = n + 1;
+}
+
+static void writeBytes (MIO *mio, const void *data, size_t length)
+{
+	if (length > 0 && mio_write (mio, data, 1, length) < length)
+		error (FATAL | PERROR, "cannot complete write");
+}
+
+static void writeNumbers (MIO *mio, const uint32_t *numbers, size_t count)
+{
+	unsigned char buf [4];
+
+	for (size_t i = 0; i < count; i++)
+	{
+		buf [0] = (unsigned char) (numbers [i] & 0xff);
+		buf [1] = (unsigned char) ((numbers [i] >> 8) & 0xff);
+		buf [2] = (unsigned char) ((numbers [i] >> 16) & 0xff);
+		buf [3] = (unsigned char) ((numbers [i] >> 24) & 0xff);
+		writeBytes (mio, buf, 4);
+	}
+}
+
+static void setOffset (uint32_t *numbers, uint64_t offset)
+{
+	numbers [0] = (uint32_t) (offset & 0xffffffffU);
+	numbers [1] = (uint32_t) (offset >> 32);
+}
+
+/*  Compress the lines in `block' into a block of the file, and record
+ *  the block in the index. The blocks are kept in memory because the
+ *  header written before them has their sizes, and the output can be
+ *  stdout where no seek is possible.
+ */
+static void flushBlock (void)
+{
+	compressedBuffer *block = &Compressed.block;
+	compressedBuffer *blocks = &Compressed.blocks;
+	uLongf length = compressBound ((uLong) block->length);
+	const unsigned char *tab;
+	uint32_t *entry;
+	int r;
+
+	if (block->length == 0)
+		return;
+
+	reserveBuffer (blocks, (size_t) length);
+	r = compress2 (blocks->data + blocks->length, &length,
+				   block->data, (uLong) block->length, Z_DEFAULT_COMPRESSION);
+	if (r != Z_OK)
+		error (FATAL, "failed in compressing tags: %s", zError (r));
+
+	if (Compressed.blockCount == Compressed.indexSize)
+	{
+		Compressed.indexSize = Compressed.indexSize? Compressed.indexSize * 2: 256;
+		Compressed.index = xRealloc (Compressed.index,
+									 Compressed.indexSize * COMPRESSED_INDEX_NUMBERS,
+									 uint32_t);
+	}
+	entry = Compressed.index + Compressed.blockCount++ * COMPRESSED_INDEX_NUMBERS;
+	setOffset (entry, COMPRESSED_HEADER_SIZE + (uint64_t) blocks->length);
+	entry [2] = (uint32_t) length;
+	entry [3] = (uint32_t) block->length;
+	entry [4] = (uint32_t) Compressed.names.length;
+	entry [5] = 0;
+
+	/* The name of the first line in the block */
+	tab = memchr (block->data, '\t', block->length);
+	appendToBuffer (&Compressed.names, block->data,
+					tab? (size_t) (tab - block->data): 0, '\0');
+
+	blocks->length += (size_t) length;
+	Compressed.totalSize += block->length;
+	block->length = 0;
+}
+
+static void compressLines (const compressedLines *lines)
+{
+	for (size_t i = 0; i < lines->count; i++)
+	{
+		const compressedLine *l = lines->table + i;
+
+		if (Compressed.block.length > 0
+			&& Compressed.block.length + l->length + 1 > COMPRESSED_BLOCK_SIZE)
+			flushBlock ();
+		appendToBuffer (&Compressed.block, Compressed.lines.data + l->offset,
+						l->length, '\n');
+	}
+}
+
+static void clearCompressedState (void)
+{
+	if (Compressed.scratch)
+		mio_unref (Compressed.scratch);
+	eFreeNoNullCheck (Compressed.lines.data);
+	eFreeNoNullCheck (Compressed.ptags.table);
+	eFreeNoNullCheck (Compressed.tags.table);
+	eFreeNoNullCheck (Compressed.block.data);
+	eFreeNoNullCheck (Compressed.blocks.data);
+	eFreeNoNullCheck (Compressed.names.data);
+	eFreeNoNullCheck (Compressed.index);
+
+	memset (&Compressed, 0, sizeof (Compressed));
+}
+
+static void finishCompressedFile (tagWriter *writer CTAGS_ATTR_UNUSED, MIO * mio,
+								  void *clientData CTAGS_ATTR_UNUSED)
+{
+	uint32_t header [COMPRESSED_HEADER_NUMBERS] = { 0 };
+
+	if (Compressed.added == 0)
+		return;
+
+	sortLines (&Compressed.ptags);
+	sortLines (&Compressed.tags);
+
+	compressLines (&Compressed.ptags);
+	compressLines (&Compressed.tags);
+	flushBlock ();
+
+	verbose ("writing %lu lines in %lu compressed blocks (%lu bytes to %lu bytes)\n",
+			 (unsigned long) (Compressed.ptags.count + Compressed.tags.count),
+			 (unsigned long) Compressed.blockCount,
+			 (unsigned long) Compressed.totalSize,
+			 (unsigned long) Compressed.blocks.length);
+
+	header [0] = (uint32_t) Option.sorted;
+	header [1] = (uint32_t) Compressed.blockCount;
+	setOffset (header + 2, COMPRESSED_HEADER_SIZE + (uint64_t) Compressed.blocks.length);
+	setOffset (header + 4, Compressed.totalSize);
+	header [6] = COMPRESSED_BLOCK_SIZE;
+
+	writeBytes (mio, COMPRESSED_MAGIC, COMPRESSED_MAGIC_SIZE);
+	writeNumbers (mio, header, COMPRESSED_HEADER_NUMBERS);
+	writeBytes (mio, Compressed.blocks.data, Compressed.blocks.length);
+	writeNumbers (mio, Compressed.index,
+				  Compressed.blockCount * COMPRESSED_INDEX_NUMBERS);
+	writeBytes (mio, Compressed.names.data, Compressed.names.length);
+
+	clearCompressedState ();
+}
+
+static bool treatFieldAsFixed (int fieldType)
+{
+	return uCtagsWriter.treatFieldAsFixed (fieldType);
+}
+
+static void checkCompressedOptions (tagWriter *writer CTAGS_ATTR_UNUSED,
+									bool fieldsWereReset)
+{
+	uCtagsWriter.checkOptions (&uCtagsWriter, fieldsWereReset);
+}
+
+#else /* HAVE_ZLIB */
+
+tagWriter compressedWriter = {
+	.writeEntry = NULL,
+	.writePtagEntry = NULL,
+	.preWriteEntry = NULL,
+	.postWriteEntry = NULL,
+	.defaultFileName = "tags",
+};
+
+#endif
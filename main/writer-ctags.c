@@ -17,6 +17,7 @@
 #include "parse_p.h"
 #include "ptag_p.h"
 #include "read.h"
+#include "vstring.h"
 #include "writer_p.h"
 #include "xtag.h"
 #include "xtag_p.h"
@@ -182,25 +183,66 @@ static const char* escapeFieldValue (tagWriter *writer, const tagEntryInfo * tag
 	return escapeFieldValueFull (writer, tag, ftype, NO_PARSER_FIELD);
 }
 
-static int renderExtensionFieldMaybe (tagWriter *writer, int xftype, const tagEntryInfo *const tag, char sep[2], MIO *mio)
+/*  A tag line is rendered into a buffer and handed to MIO with one
+ *  mio_write () call. The fixed fields and numbers are appended without
+ *  going through printf-style formatting.
+ */
+static void catNumber (vString *line, unsigned long n)
+{
+	char buf [sizeof (n) * 3 + 1];
+	char *p = buf + sizeof (buf);
+
+	do
+	{
+		*--p = (char) ('0' + n % 10);
+		n /= 10;
+	} while (n > 0);
+	vStringNCatS (line, p, (size_t) (buf + sizeof (buf) - p));
+}
+
+static void catField (vString *line, const char *sep, const char *name, const char *value)
+{
+	vStringCatS (line, sep);
+	vStringPut (line, '\t');
+	vStringCatS (line, name);
+	vStringPut (line, ':');
+	vStringCatS (line, value);
+}
+
+static void renderExtensionFieldMaybe (tagWriter *writer, int xftype, const tagEntryInfo *const tag, char sep[2], vString *line)
 {
 	if (isFieldEnabled (xftype) && doesFieldHaveValue (xftype, tag))
 	{
-		int len;
-		len = mio_printf (mio, "%s\t%s:%s", sep,
-				  getFieldName (xftype),
+		catField (line, sep, getFieldName (xftype),
 				  escapeFieldValue (writer, tag, xftype));
 		sep[0] = '\0';
-		return len;
 	}
-	else
-		return 0;
 }
 
-static int addParserFields (tagWriter *writer, MIO * mio, const tagEntryInfo *const tag)
+/*  The enabled fields among those rendered in the loop at the end of
+ *  addExtensionFields (), collected again only when a field is enabled
+ *  or disabled. The fields disabled by default are not tested for each
+ *  tag then.
+ */
+static fieldType loopFields [FIELD_BUILTIN_LAST + 1];
+static unsigned int loopFieldCount;
+static unsigned int loopFieldsEpoch;
+
+static void collectLoopFields (void)
+{
+	loopFieldCount = 0;
+	for (int k = FIELD_ECTAGS_LOOP_START; k <= FIELD_ECTAGS_LOOP_LAST; k++)
+		if (isFieldEnabled (k))
+			loopFields [loopFieldCount++] = k;
+	for (int k = FIELD_UCTAGS_LOOP_START; k <= FIELD_BUILTIN_LAST; k++)
+		if (isFieldEnabled (k))
+			loopFields [loopFieldCount++] = k;
+	loopFieldsEpoch = getEnabledFieldsEpoch ();
+}
+
+static void addParserFields (tagWriter *writer, vString *line, const tagEntryInfo *const tag)
 {
 	unsigned int i;
-	int length = 0;
 
 	for (i = 0; i < tag->usedParserFields; i++)
 	{
@@ -209,41 +251,25 @@ static int addParserFields (tagWriter *writer, MIO * mio, const tagEntryInfo *co
 		if (! isFieldEnabled (ftype))
 			continue;
 
-		length += mio_printf(mio, "\t%s:%s",
-							 getFieldName (ftype),
-							 escapeFieldValueFull (writer, tag, ftype, i));
+		catField (line, "", getFieldName (ftype),
+				  escapeFieldValueFull (writer, tag, ftype, i));
 	}
-	return length;
 }
 
-static int writeLineNumberEntry (tagWriter *writer, MIO * mio, const tagEntryInfo *const tag)
+static void writeLineNumberEntry (tagWriter *writer, vString *line, const tagEntryInfo *const tag)
 {
 	if (Option.lineDirectives)
-		return mio_printf (mio, "%s", escapeFieldValue (writer, tag, FIELD_LINE_NUMBER));
+		vStringCatS (line, escapeFieldValue (writer, tag, FIELD_LINE_NUMBER));
 	else
-		return mio_printf (mio, "%lu", tag->lineNumber);
+		catNumber (line, tag->lineNumber);
 }
 
-static int addExtensionFields (tagWriter *writer, MIO *mio, const tagEntryInfo *const tag)
+static void addExtensionFields (tagWriter *writer, vString *line, const tagEntryInfo *const tag)
 {
 	bool isKindKeyEnabled = isFieldEnabled (FIELD_KIND_KEY);
 	bool isScopeEnabled = isFieldEnabled   (FIELD_SCOPE_KEY);
 
-	const char* const kindKey = isKindKeyEnabled
-		?getFieldName (FIELD_KIND_KEY)
-		:"";
-	const char* const kindFmt = isKindKeyEnabled
-		?"%s\t%s:%s"
-		:"%s\t%s%s";
-	const char* const scopeKey = isScopeEnabled
-		?getFieldName (FIELD_SCOPE_KEY)
-		:"";
-	const char* const scopeFmt = isScopeEnabled
-		?"%s\t%s:%s:%s"
-		:"%s\t%s%s:%s";
-
 	char sep [] = {';', '"', '\0'};
-	int length = 0;
 
 	const char *str = NULL;
 	kindDefinition *kdef = getLanguageKind(tag->langType, tag->kindIndex);
@@ -264,19 +290,25 @@ static int addExtensionFields (tagWriter *writer, MIO *mio, const tagEntryInfo *
 
 	if (str)
 	{
-		length += mio_printf (mio, kindFmt, sep, kindKey, str);
+		if (isKindKeyEnabled)
+			catField (line, sep, getFieldName (FIELD_KIND_KEY), str);
+		else
+		{
+			vStringCatS (line, sep);
+			vStringPut (line, '\t');
+			vStringCatS (line, str);
+		}
 		sep [0] = '\0';
 	}
 
 	if (isFieldEnabled (FIELD_LINE_NUMBER) &&  doesFieldHaveValue (FIELD_LINE_NUMBER, tag))
 	{
-		length += mio_printf (mio, "%s\t%s:%ld", sep,
-				   getFieldName (FIELD_LINE_NUMBER),
-				   tag->lineNumber);
+		catField (line, sep, getFieldName (FIELD_LINE_NUMBER), "");
+		catNumber (line, tag->lineNumber);
 		sep [0] = '\0';
 	}
 
-	length += renderExtensionFieldMaybe (writer, FIELD_LANGUAGE, tag, sep, mio);
+	renderExtensionFieldMaybe (writer, FIELD_LANGUAGE, tag, sep, line);
 
 	if (isFieldEnabled (FIELD_SCOPE))
 	{
@@ -286,38 +318,55 @@ static int addExtensionFields (tagWriter *writer, MIO *mio, const tagEntryInfo *
 		v = escapeFieldValue (writer, tag, FIELD_SCOPE);
 		if (k && v)
 		{
-			length += mio_printf (mio, scopeFmt, sep, scopeKey, k, v);
+			if (isScopeEnabled)
+				catField (line, sep, getFieldName (FIELD_SCOPE_KEY), k);
+			else
+			{
+				vStringCatS (line, sep);
+				vStringPut (line, '\t');
+				vStringCatS (line, k);
+			}
+			vStringPut (line, ':');
+			vStringCatS (line, v);
 			sep [0] = '\0';
 		}
 	}
 
 	if (isFieldEnabled (FIELD_TYPE_REF) && doesFieldHaveValue (FIELD_TYPE_REF, tag))
 	{
-		length += mio_printf (mio, "%s\t%s:%s", sep,
-				      getFieldName (FIELD_TYPE_REF),
-				      escapeFieldValue (writer, tag, FIELD_TYPE_REF));
+		catField (line, sep, getFieldName (FIELD_TYPE_REF),
+				  escapeFieldValue (writer, tag, FIELD_TYPE_REF));
 		sep [0] = '\0';
 	}
 
 	if (isFieldEnabled (FIELD_FILE_SCOPE) &&  doesFieldHaveValue (FIELD_FILE_SCOPE, tag))
 	{
-		length += mio_printf (mio, "%s\t%s:", sep,
-				      getFieldName (FIELD_FILE_SCOPE));
+		catField (line, sep, getFieldName (FIELD_FILE_SCOPE), "");
 		sep [0] = '\0';
 	}
 
-	for (int k = FIELD_ECTAGS_LOOP_START; k <= FIELD_ECTAGS_LOOP_LAST; k++)
-		length += renderExtensionFieldMaybe (writer, k, tag, sep, mio);
-	for (int k = FIELD_UCTAGS_LOOP_START; k <= FIELD_BUILTIN_LAST; k++)
-		length += renderExtensionFieldMaybe (writer, k, tag, sep, mio);
+	if (loopFieldsEpoch != getEnabledFieldsEpoch ())
+		collectLoopFields ();
+	for (unsigned int i = 0; i < loopFieldCount; i++)
+	{
+		fieldType k = loopFields [i];
 
-	return length;
+		if (doesFieldHaveValue (k, tag))
+		{
+			catField (line, sep, getFieldName (k),
+					  escapeFieldValue (writer, tag, k));
+			sep [0] = '\0';
+		}
+	}
 }
 
 static int writeCtagsEntry (tagWriter *writer,
 							MIO * mio, const tagEntryInfo *const tag,
 							void *clientData CTAGS_ATTR_UNUSED)
 {
+	static vString *line;
+	static vString *id;
+
 	if (writer->private)
 	{
 		struct rejection *rej = writer->private;
@@ -328,9 +377,29 @@ static int writeCtagsEntry (tagWriter *writer,
 		}
 	}
 
-	int length = mio_printf (mio, "%s\t%s\t",
-			      escapeFieldValue (writer, tag, FIELD_NAME),
-			      escapeFieldValue (writer, tag, FIELD_INPUT_FILE));
+	line = vStringNewOrClearWithAutoRelease (line);
+
+	/* The pseudo tag defining the id is written before the line. */
+	if (isInputFileIdEnabled ())
+	{
+		const char *f = (Option.lineDirectives && tag->sourceFileName)
+			? tag->sourceFileName
+			: tag->inputFileName;
+
+		id = vStringNewOrClearWithAutoRelease (id);
+		if (!getInputFileId (f, id))
+			vStringClear (id);
+	}
+	else if (id)
+		vStringClear (id);
+
+	vStringCatS (line, escapeFieldValue (writer, tag, FIELD_NAME));
+	vStringPut (line, '\t');
+	if (id && !vStringIsEmpty (id))
+		vStringCat (line, id);
+	else
+		vStringCatS (line, escapeFieldValue (writer, tag, FIELD_INPUT_FILE));
+	vStringPut (line, '\t');
 
 	/* This is for handling 'common' of 'fortran'.  See the
 	   description of --excmd=mixed in ctags.1.  In tags output, what
@@ -338,23 +407,28 @@ static int writeCtagsEntry (tagWriter *writer,
 
 	   However, in the other formats, pattern should be pattern as its name. */
 	if (tag->lineNumberEntry)
-		length += writeLineNumberEntry (writer, mio, tag);
+		writeLineNumberEntry (writer, line, tag);
 	else
 	{
 		if (Option.locate == EX_COMBINE)
-			length += mio_printf(mio, "%lu;", tag->lineNumber);
-		length += mio_puts(mio, escapeFieldValue(writer, tag, FIELD_PATTERN));
+		{
+			catNumber (line, tag->lineNumber);
+			vStringPut (line, ';');
+		}
+		vStringCatS (line, escapeFieldValue(writer, tag, FIELD_PATTERN));
 	}
 
 	if (includeExtensionFlags ())
 	{
-		length += addExtensionFields (writer, mio, tag);
-		length += addParserFields (writer, mio, tag);
+		addExtensionFields (writer, line, tag);
+		addParserFields (writer, line, tag);
 	}
 
-	length += mio_printf (mio, "\n");
+	vStringPut (line, '\n');
 
-	return length;
+	if (mio_write (mio, vStringValue (line), 1, vStringLength (line)) < vStringLength (line))
+		return -1;
+	return (int) vStringLength (line);
 }
 
 static int writeCtagsPtagEntry (tagWriter *writer,
@@ -20,12 +20,18 @@
 #include "read.h"
 #include "routines.h"
 #include "routines_p.h"
+#include "trashbox.h"
 #include "vstring.h"
 #include "writer_p.h"
 
 
 #define ETAGS_FILE  "TAGS"
 
+/* A section of the tags for an input file larger than this is written
+ * to a temporary file instead of memory. */
+#define ETAGS_SECTION_MEMORY_LIMIT (4 * 1024 * 1024)
+#define ETAGS_COPY_BUFFER_SIZE (64 * 1024)
+
 
 static int writeEtagsEntry  (tagWriter *writer, MIO * mio, const tagEntryInfo *const tag,
 							 void *clientData CTAGS_ATTR_UNUSED);
@@ -41,12 +47,18 @@ tagWriter etagsWriter = {
 	.postWriteEntry = endEtagsFile,
 	.rescanFailedEntry = NULL,
 	.treatFieldAsFixed = NULL,
+	.buffersInput = true,
 	.defaultFileName = ETAGS_FILE,
 };
 
+/* The tags for an input file are written to a section preceded by
+ * the size of the section. They are kept in MEMORY, reused for the
+ * following input files, until they are written to the tag file. */
 struct sEtags {
-	char *name;
-	MIO *mio;
+	char *name;					/* the temporary file the section is
+								   spilled to, or NULL */
+	MIO *mio;					/* MEMORY or the temporary file */
+	MIO *memory;
 	size_t byteCount;
 	vString *vLine;
 };
@@ -56,40 +68,74 @@ struct sEtags {
 static void *beginEtagsFile (tagWriter *writer CTAGS_ATTR_UNUSED, MIO *mio CTAGS_ATTR_UNUSED,
 							 void *clientData CTAGS_ATTR_UNUSED)
 {
-	static struct sEtags etags = { NULL, NULL, 0, NULL };
+	static struct sEtags etags = { NULL, NULL, NULL, 0, NULL };
 
-	etags.mio = tempFile ("w+b", &etags.name);
+	if (etags.memory == NULL)
+	{
+		etags.memory = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+		DEFAULT_TRASH_BOX (etags.memory, mio_unref);
+		etags.vLine = vStringNew ();
+		DEFAULT_TRASH_BOX (etags.vLine, vStringDelete);
+	}
+	mio_rewind (etags.memory);
+	etags.mio = etags.memory;
 	etags.byteCount = 0;
-	etags.vLine = vStringNew ();
 	return &etags;
 }
 
+/* Move the section kept in memory to a temporary file. */
+static void spillEtagsSection (struct sEtags *etags)
+{
+	size_t size;
+	unsigned char *data = mio_memory_get_data (etags->memory, &size);
+
+	etags->mio = tempFile ("w+b", &etags->name);
+	if (etags->byteCount > 0
+		&& mio_write (etags->mio, data, 1, etags->byteCount) < etags->byteCount)
+		error (FATAL | PERROR, "cannot complete write");
+	abort_if_ferror (etags->mio);
+}
+
+static void copySpilledEtagsSection (struct sEtags *etags, MIO *mainfp)
+{
+	unsigned char *buffer = eMalloc (ETAGS_COPY_BUFFER_SIZE);
+	size_t n;
+
+	mio_rewind (etags->mio);
+	while ((n = mio_read (etags->mio, buffer, 1, ETAGS_COPY_BUFFER_SIZE)) > 0)
+	{
+		if (mio_write (mainfp, buffer, 1, n) < n)
+			error (FATAL | PERROR, "cannot complete write");
+	}
+	eFree (buffer);
+
+	mio_unref (etags->mio);
+	remove (etags->name);
+	eFree (etags->name);
+	etags->name = NULL;
+}
+
 static bool endEtagsFile (tagWriter *writer,
 						  MIO *mainfp, const char *filename,
 						  void *clientData CTAGS_ATTR_UNUSED)
 {
-	const char *line;
 	struct sEtags *etags = writer->private;
 
 	mio_printf (mainfp, "\f\n%s,%ld\n", filename, (long) etags->byteCount);
 	setNumTagsAdded (numTagsAdded () + 1);
 	abort_if_ferror (mainfp);
 
-	if (etags->mio != NULL)
+	if (etags->name)
+		copySpilledEtagsSection (etags, mainfp);
+	else if (etags->byteCount > 0)
 	{
-		mio_rewind (etags->mio);
-
-		while ((line = readLineRaw (etags->vLine, etags->mio)) != NULL)
-			mio_puts (mainfp, line);
-
-		vStringDelete (etags->vLine);
-		mio_unref (etags->mio);
-		remove (etags->name);
-		eFree (etags->name);
-		etags->vLine = NULL;
-		etags->mio = NULL;
-		etags->name = NULL;
+		unsigned char *data = mio_memory_get_data (etags->memory, NULL);
+
+		if (mio_write (mainfp, data, 1, etags->byteCount) < etags->byteCount)
+			error (FATAL | PERROR, "cannot complete write");
 	}
+	abort_if_ferror (mainfp);
+	etags->mio = NULL;
 	return false;
 }
 
@@ -197,6 +243,8 @@ static int writeEtagsEntry (tagWriter *writer,
 							 tag->lineNumber, seekValue);
 	}
 	etags->byteCount += length;
+	if (etags->name == NULL && etags->byteCount > ETAGS_SECTION_MEMORY_LIMIT)
+		spillEtagsSection (etags);
 
 	return length;
 }
@@ -17,13 +17,14 @@
 #include "read.h"
 #include "routines.h"
 #include "ptag_p.h"
+#include "trashbox.h"
+#include "vstring.h"
 #include "writer_p.h"
 
 
 #include <string.h>
 
 #ifdef HAVE_JANSSON
-#include <jansson.h>
 
 /* The concept of CURRENT and AGE is taken from libtool.
  * However, we delete REVISION.
@@ -38,10 +39,6 @@
 #define JSON_WRITER_CURRENT 1
 #define JSON_WRITER_AGE 0
 
-#ifndef json_boolean /* compat with jansson < 2.4 */
-#define json_boolean(val)      ((val) ? json_true() : json_false())
-#endif
-
 
 static int writeJsonEntry  (tagWriter *writer CTAGS_ATTR_UNUSED,
 				MIO * mio, const tagEntryInfo *const tag,
@@ -65,6 +62,260 @@ tagWriter jsonWriter = {
 	.defaultFileName = NULL,
 };
 
+/*
+ * A JSON object rendered directly into a line of output
+ *
+ * The output is the same as what json_dumps (..., JSON_PRESERVE_ORDER)
+ * of jansson makes: members are separated with ", ", a key and its value
+ * with ": ". As json_string does, a string that is not valid UTF-8 is
+ * rejected, and the member is not added. As json_object_set_new does,
+ * adding a member with a key already in the object replaces the value
+ * at the place of the old one.
+ */
+struct jsonMember {
+	const char *key;
+	size_t offset;				/* of the value in the buffer */
+	size_t length;
+};
+
+struct jsonObject {
+	vString *buffer;
+	struct jsonMember *members;
+	unsigned int count;
+	unsigned int size;
+	int replacing;				/* index of the member being replaced, or -1 */
+	size_t start;				/* where the value being added starts */
+};
+
+static struct jsonObject JsonObject;
+
+/* Derived from utf8_check_first and utf8_check_full of jansson. */
+static bool isValidUtf8 (const char *str)
+{
+	const unsigned char *s = (const unsigned char *) str;
+
+	while (*s)
+	{
+		unsigned char c = *s;
+		unsigned int size;
+		int32_t value;
+
+		if (c < 0x80)
+		{
+			s++;
+			continue;
+		}
+		else if (c <= 0xc1)
+			return false;
+		else if (c <= 0xdf)
+		{
+			size = 2;
+			value = c & 0x1f;
+		}
+		else if (c <= 0xef)
+		{
+			size = 3;
+			value = c & 0xf;
+		}
+		else if (c <= 0xf4)
+		{
+			size = 4;
+			value = c & 0x7;
+		}
+		else
+			return false;
+
+		for (unsigned int i = 1; i < size; i++)
+		{
+			if (s[i] < 0x80 || s[i] > 0xbf)
+				return false;
+			value = (value << 6) + (s[i] & 0x3f);
+		}
+
+		if (value > 0x10ffff
+			|| (value >= 0xd800 && value <= 0xdfff)
+			|| (size == 2 && value < 0x80)
+			|| (size == 3 && value < 0x800)
+			|| (size == 4 && value < 0x10000))
+			return false;
+		s += size;
+	}
+	return true;
+}
+
+static void putJsonString (vString *buffer, const char *str)
+{
+	const char *run = str;
+	const char *s;
+
+	vStringPut (buffer, '"');
+	for (s = str; *s; s++)
+	{
+		unsigned char c = (unsigned char) *s;
+		const char *esc;
+		char seq [7];
+
+		if (c >= 0x20 && c != '"' && c != '\\')
+			continue;
+
+		switch (c)
+		{
+		case '\\': esc = "\\\\"; break;
+		case '"':  esc = "\\\""; break;
+		case '\b': esc = "\\b"; break;
+		case '\f': esc = "\\f"; break;
+		case '\n': esc = "\\n"; break;
+		case '\r': esc = "\\r"; break;
+		case '\t': esc = "\\t"; break;
+		default:
+			snprintf (seq, sizeof (seq), "\\u%04X", (unsigned int) c);
+			esc = seq;
+			break;
+		}
+		vStringNCatS (buffer, run, s - run);
+		vStringCatS (buffer, esc);
+		run = s + 1;
+	}
+	vStringNCatS (buffer, run, s - run);
+	vStringPut (buffer, '"');
+}
+
+static void beginJsonObject (struct jsonObject *obj)
+{
+	obj->buffer = vStringNewOrClearWithAutoRelease (obj->buffer);
+	vStringPut (obj->buffer, '{');
+	obj->count = 0;
+}
+
+static void beginJsonMember (struct jsonObject *obj, const char *key)
+{
+	for (unsigned int i = 0; i < obj->count; i++)
+	{
+		if (strcmp (obj->members[i].key, key) == 0)
+		{
+			obj->replacing = (int) i;
+			obj->start = vStringLength (obj->buffer);
+			return;
+		}
+	}
+
+	if (obj->count == obj->size)
+	{
+		if (obj->members == NULL)
+			DEFAULT_TRASH_BOX(&obj->members, eFreeIndirect);
+		obj->size = obj->size? obj->size * 2: 16;
+		obj->members = xRealloc (obj->members, obj->size, struct jsonMember);
+	}
+	if (obj->count > 0)
+		vStringCatS (obj->buffer, ", ");
+	putJsonString (obj->buffer, key);
+	vStringCatS (obj->buffer, ": ");
+
+	obj->replacing = -1;
+	obj->start = vStringLength (obj->buffer);
+	obj->members[obj->count].key = key;
+	obj->members[obj->count].offset = obj->start;
+}
+
+static void endJsonMember (struct jsonObject *obj)
+{
+	size_t length = vStringLength (obj->buffer) - obj->start;
+
+	if (obj->replacing < 0)
+	{
+		obj->members[obj->count++].length = length;
+		return;
+	}
+
+	/* The new value is at the end of the buffer. Move it to the place
+	 * of the old one. This happens rarely. */
+	struct jsonMember *m = obj->members + obj->replacing;
+	size_t oldEnd = m->offset + m->length;
+	vString *value = vStringNewNInit (vStringValue (obj->buffer) + obj->start, length);
+	vString *rest = vStringNewNInit (vStringValue (obj->buffer) + oldEnd,
+									 obj->start - oldEnd);
+
+	vStringTruncate (obj->buffer, m->offset);
+	vStringCat (obj->buffer, value);
+	vStringCat (obj->buffer, rest);
+	for (unsigned int i = obj->replacing + 1; i < obj->count; i++)
+		obj->members[i].offset = obj->members[i].offset - m->length + length;
+	m->length = length;
+
+	vStringDelete (value);
+	vStringDelete (rest);
+}
+
+static bool addJsonString (struct jsonObject *obj, const char *key, const char *str)
+{
+	if (str == NULL || !isValidUtf8 (str))
+		return false;
+
+	beginJsonMember (obj, key);
+	putJsonString (obj->buffer, str);
+	endJsonMember (obj);
+	return true;
+}
+
+/* A string rendered as a JSON value for the last tag. The input file
+ * name and the language are the same for the tags written in a row
+ * mostly. */
+struct jsonStringCache {
+	vString *string;
+	vString *rendered;
+	bool valid;					/* the string is valid UTF-8 */
+};
+
+static struct jsonStringCache JsonPathCache, JsonLanguageCache;
+
+static bool addJsonStringCached (struct jsonObject *obj, const char *key,
+								 const char *str, struct jsonStringCache *cache)
+{
+	if (str == NULL)
+		return false;
+
+	if (cache->string == NULL || strcmp (vStringValue (cache->string), str) != 0)
+	{
+		cache->string = vStringNewOrClearWithAutoRelease (cache->string);
+		cache->rendered = vStringNewOrClearWithAutoRelease (cache->rendered);
+		vStringCatS (cache->string, str);
+		cache->valid = isValidUtf8 (str);
+		if (cache->valid)
+			putJsonString (cache->rendered, str);
+	}
+	if (!cache->valid)
+		return false;
+
+	beginJsonMember (obj, key);
+	vStringCat (obj->buffer, cache->rendered);
+	endJsonMember (obj);
+	return true;
+}
+
+static void addJsonInteger (struct jsonObject *obj, const char *key, long long value)
+{
+	char buf [32];
+
+	snprintf (buf, sizeof (buf), "%lld", value);
+	beginJsonMember (obj, key);
+	vStringCatS (obj->buffer, buf);
+	endJsonMember (obj);
+}
+
+static void addJsonBoolean (struct jsonObject *obj, const char *key, bool value)
+{
+	beginJsonMember (obj, key);
+	vStringCatS (obj->buffer, value? "true": "false");
+	endJsonMember (obj);
+}
+
+static int writeJsonObject (struct jsonObject *obj, MIO *mio)
+{
+	vStringCatS (obj->buffer, "}\n");
+	mio_write (mio, vStringValue (obj->buffer), 1, vStringLength (obj->buffer));
+	return (int) vStringLength (obj->buffer);
+}
+
 static const char* escapeFieldValueRaw (const tagEntryInfo * tag, fieldType ftype, int fieldIndex)
 {
 	const char *v;
@@ -76,7 +327,9 @@ static const char* escapeFieldValueRaw (const tagEntryInfo * tag, fieldType ftyp
 	return v;
 }
 
-static json_t* escapeFieldValue (const tagEntryInfo * tag, fieldType ftype, bool returnEmptyStringAsNoValue)
+static void addFieldValue (struct jsonObject *obj, const char *key,
+						   const tagEntryInfo * tag, fieldType ftype,
+						   bool returnEmptyStringAsNoValue)
 {
 	const char *str = escapeFieldValueRaw (tag, ftype, NO_PARSER_FIELD);
 
@@ -86,35 +339,31 @@ static json_t* escapeFieldValue (const tagEntryInfo * tag, fieldType ftype, bool
 		if (dt & FIELDTYPE_STRING)
 		{
 			if (dt & FIELDTYPE_BOOL && str[0] == '\0')
-				return json_false();
+				addJsonBoolean (obj, key, false);
 			else
-				return json_string (str);
+				addJsonString (obj, key, str);
 		}
 		else if (dt & FIELDTYPE_INTEGER)
 		{
 			long tmp;
 
 			if (strToLong (str, 10, &tmp))
-				return json_integer (tmp);
-			else
-				return NULL;
+				addJsonInteger (obj, key, tmp);
 		}
 		else if (dt & FIELDTYPE_BOOL)
 		{
 			/* TODO: This must be fixed when new boolean field is added.
 			   Currently only `file:' field use this. */
-			return json_boolean (strcmp ("-", str)); /* "-" -> false */
+			addJsonBoolean (obj, key, strcmp ("-", str)); /* "-" -> false */
 		}
-		AssertNotReached ();
-		return NULL;
+		else
+			AssertNotReached ();
 	}
 	else if (returnEmptyStringAsNoValue)
-		return json_false();
-	else
-		return NULL;
+		addJsonBoolean (obj, key, false);
 }
 
-static void renderExtensionFieldMaybe (int xftype, const tagEntryInfo *const tag, json_t *response)
+static void renderExtensionFieldMaybe (int xftype, const tagEntryInfo *const tag, struct jsonObject *obj)
 {
 	const char *fname = getFieldName (xftype);
 
@@ -123,21 +372,23 @@ static void renderExtensionFieldMaybe (int xftype, const tagEntryInfo *const tag
 		switch (xftype)
 		{
 		case FIELD_LINE_NUMBER:
-			json_object_set_new (response, fname,
-					     json_integer (tag->lineNumber));
+			addJsonInteger (obj, fname, (long long) tag->lineNumber);
 			break;
 		case FIELD_FILE_SCOPE:
-			json_object_set_new (response, fname,
-					     json_boolean(1));
+			addJsonBoolean (obj, fname, true);
+			break;
+		case FIELD_LANGUAGE:
+			addJsonStringCached (obj, fname,
+								 escapeFieldValueRaw (tag, xftype, NO_PARSER_FIELD),
+								 &JsonLanguageCache);
 			break;
 		default:
-			json_object_set_new (response, fname,
-					     escapeFieldValue (tag, xftype, false));
+			addFieldValue (obj, fname, tag, xftype, false);
 		}
 	}
 }
 
-static void addParserFields (json_t *response, const tagEntryInfo *const tag)
+static void addParserFields (struct jsonObject *obj, const tagEntryInfo *const tag)
 {
 	unsigned int i;
 
@@ -148,35 +399,37 @@ static void addParserFields (json_t *response, const tagEntryInfo *const tag)
 		if (! isFieldEnabled (ftype))
 			continue;
 
+		const char *fname = getFieldName (ftype);
 		unsigned int dt = getFieldDataType (ftype);
-		json_t *o;
 		if (dt & FIELDTYPE_STRING)
 		{
 			const char *str = escapeFieldValueRaw (tag, ftype, i);
 			if (dt & FIELDTYPE_BOOL && str[0] == '\0')
-				o = json_false ();
+				addJsonBoolean (obj, fname, false);
 			else
-				o = json_string (str);
+				addJsonString (obj, fname, str);
 		}
 		else if (dt & FIELDTYPE_INTEGER)
 		{
 			/* NOT IMPLEMENTED YET */
 			AssertNotReached ();
-			o = json_null ();
+			beginJsonMember (obj, fname);
+			vStringCatS (obj->buffer, "null");
+			endJsonMember (obj);
 		}
 		else if (dt & FIELDTYPE_BOOL)
-			o = json_true ();
+			addJsonBoolean (obj, fname, true);
 		else
 		{
 			AssertNotReached ();
-			o = json_null ();
+			beginJsonMember (obj, fname);
+			vStringCatS (obj->buffer, "null");
+			endJsonMember (obj);
 		}
-
-		json_object_set_new (response, getFieldName (ftype), o);
 	}
 }
 
-static void addExtensionFields (json_t *response, const tagEntryInfo *const tag)
+static void addExtensionFields (struct jsonObject *obj, const tagEntryInfo *const tag)
 {
 	int k;
 
@@ -197,49 +450,39 @@ static void addExtensionFields (json_t *response, const tagEntryInfo *const tag)
 	}
 
 	for (k = FIELD_JSON_LOOP_START; k <= FIELD_BUILTIN_LAST; k++)
-		renderExtensionFieldMaybe (k, tag, response);
+		renderExtensionFieldMaybe (k, tag, obj);
 }
 
 static int writeJsonEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
 			       MIO * mio, const tagEntryInfo *const tag,
 				   void *clientData CTAGS_ATTR_UNUSED)
 {
-	int length = 0;
-	json_t *response = json_pack ("{ss}", "_type", "tag");
+	struct jsonObject *obj = &JsonObject;
+
+	beginJsonObject (obj);
+	addJsonString (obj, "_type", "tag");
 
 	if (isFieldEnabled (FIELD_NAME))
 	{
-		json_t *name = json_string (tag->name);
-		if (name == NULL)
-			goto out;
-		json_object_set_new (response, "name", name);
+		if (!addJsonString (obj, "name", tag->name))
+			return 0;
 	}
 	if (isFieldEnabled (FIELD_INPUT_FILE))
-		json_object_set_new (response, "path", json_string (tag->sourceFileName));
+		addJsonStringCached (obj, "path", tag->sourceFileName, &JsonPathCache);
 	if (isFieldEnabled (FIELD_PATTERN))
-	{
-		json_t *pat = escapeFieldValue(tag, FIELD_PATTERN, true);
-		json_object_set_new (response, "pattern", pat);
-	}
+		addFieldValue (obj, "pattern", tag, FIELD_PATTERN, true);
 
 	if (includeExtensionFlags ())
 	{
-		addExtensionFields (response, tag);
-		addParserFields (response, tag);
+		addExtensionFields (obj, tag);
+		addParserFields (obj, tag);
 	}
 
-	/* Print nothing if RESPONSE has only "_type" field. */
-	if (json_object_size (response) == 1)
-		goto out;
+	/* Print nothing if the object has only "_type" field. */
+	if (obj->count == 1)
+		return 0;
 
-	char *buf = json_dumps (response, JSON_PRESERVE_ORDER);
-	length = mio_printf (mio, "%s\n", buf);
-
-	free (buf);
- out:
-	json_decref (response);
-
-	return length;
+	return writeJsonObject (obj, mio);
 }
 
 static int writeJsonPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
@@ -250,45 +493,31 @@ static int writeJsonPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
 				   void *clientData CTAGS_ATTR_UNUSED)
 {
 #define OPT(X) ((X)?(X):"")
-	json_t *response;
+	struct jsonObject *obj = &JsonObject;
 	char *parserName0 = NULL;
+	bool ok;
 
 	const char *rest = ((JSON_WRITER_CURRENT > 0) && parserName && desc->jsonObjectKey)
 		? strchr(parserName, '!')
 		: NULL;
+
+	beginJsonObject (obj);
+	ok = addJsonString (obj, "_type", "ptag")
+		&& addJsonString (obj, "name", desc->name);
 	if (rest)
 	{
 		parserName0 = eStrndup(parserName, rest - parserName);
-		response = json_pack ("{ss ss ss ss ss ss}",
-				      "_type", "ptag",
-				      "name", desc->name,
-				      "parserName", parserName0,
-				      desc->jsonObjectKey, rest + 1,
-				      "path", OPT(fileName),
-				      "pattern", OPT(pattern));
+		ok = ok
+			&& addJsonString (obj, "parserName", parserName0)
+			&& addJsonString (obj, desc->jsonObjectKey, rest + 1);
 	}
 	else if (parserName)
-	{
-		response = json_pack ("{ss ss ss ss ss}",
-				      "_type", "ptag",
-				      "name", desc->name,
-				      "parserName", parserName,
-				      "path", OPT(fileName),
-				      "pattern", OPT(pattern));
-	}
-	else
-	{
-		response = json_pack ("{ss ss ss ss}",
-				      "_type", "ptag",
-				      "name", desc->name,
-				      "path", OPT(fileName),
-				      "pattern", OPT(pattern));
-	}
+		ok = ok && addJsonString (obj, "parserName", parserName);
+	ok = ok
+		&& addJsonString (obj, "path", OPT(fileName))
+		&& addJsonString (obj, "pattern", OPT(pattern));
 
-	char *buf = json_dumps (response, JSON_PRESERVE_ORDER);
-	int length = mio_printf (mio, "%s\n", buf);
-	free (buf);
-	json_decref (response);
+	int length = ok? writeJsonObject (obj, mio): 0;
 	if (parserName0)
 		eFree(parserName0);
 
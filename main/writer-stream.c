@@ -0,0 +1,559 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   A stream of binary records for a process reading the tags through
+*   a pipe or a socket
+*/
+
+#include "general.h"  /* must always come first */
+
+#include "debug.h"
+#include "entry_p.h"
+#include "field.h"
+#include "field_p.h"
+#include "htable.h"
+#include "mio.h"
+#include "options_p.h"
+#include "parse_p.h"
+#include "ptag_p.h"
+#include "routines.h"
+#include "vstring.h"
+#include "writer_p.h"
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*  Layout of the stream:
+ *
+ *    STREAM_MAGIC       a line looking like a pseudo tag line
+ *    records            each record is a 32-bit little endian length,
+ *                       and as many bytes: a type byte and the payload.
+ *
+ *  Numbers in a payload are unsigned LEB128 varints. A string in a
+ *  payload is a varint S followed by nothing if S is 0 (no string) or
+ *  odd (the string S >> 1 of the string table), or by (S >> 1) - 1
+ *  bytes and a NUL if S is even (an inline string).
+ *
+ *    STREAM_STRING      the bytes of a string and a NUL; the string is
+ *                       added to the string table. The first string in
+ *                       the stream is 0.
+ *    STREAM_PTAG        name, input file, pattern
+ *    STREAM_TAG         name, input file, pattern, line number, kind,
+ *                       flags, the number of fields, and the key and
+ *                       the value of each field
+ *
+ *  A record holds what libreadtags reads from the line of the tag in
+ *  u-ctags format, but the strings are not escaped except the pattern.
+ *  The input files, the kinds, the keys of fields, and the values of
+ *  fields taking a few values are put in the string table when they
+ *  first appear. A reader skips a record of an unknown type. See
+ *  readtags.c in libreadtags for the reader.
+ */
+#define STREAM_MAGIC "!_TAG_STREAM_FORMAT\t1\t/records/\n"
+#define STREAM_FLAG_FILE_SCOPE 0x1
+
+enum streamRecordType {
+	STREAM_STRING = 1,
+	STREAM_PTAG   = 2,
+	STREAM_TAG    = 3,
+};
+
+#define STREAM_FILE  "tags"
+
+
+static int writeStreamEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+							 MIO * mio, const tagEntryInfo *const tag,
+							 void *clientData);
+static int writeStreamPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+								 MIO * mio, const ptagDesc *desc,
+								 const char *const fileName,
+								 const char *const pattern,
+								 const char *const parserName,
+								 void *clientData);
+static void rescanFailedStreamEntry (tagWriter *writer, unsigned long validTagNum,
+									 void *clientData);
+static void finishStream (tagWriter *writer, MIO * mio,
+						  void *clientData);
+static bool treatFieldAsFixed (int fieldType);
+static void checkStreamOptions (tagWriter *writer, bool fieldsWereReset);
+
+extern tagWriter uCtagsWriter;
+
+tagWriter streamWriter = {
+	.writeEntry = writeStreamEntry,
+	.writePtagEntry = writeStreamPtagEntry,
+	.printPtagByDefault = true,
+	.preWriteEntry = NULL,
+	.postWriteEntry = NULL,
+	.rescanFailedEntry = rescanFailedStreamEntry,
+	.finishWriting = finishStream,
+	.treatFieldAsFixed = treatFieldAsFixed,
+	.checkOptions = checkStreamOptions,
+	.defaultFileName = STREAM_FILE,
+};
+
+typedef struct sStreamFields {
+	vString *buffer;			/* the keys and the values */
+	unsigned long count;
+} streamFields;
+
+typedef struct sStreamString {
+	const char *str;			/* the key in `strings' */
+	long offset;				/* of the record defining the string */
+} streamString;
+
+static struct sStreamState {
+	MIO *mio;					/* NULL before the magic is written */
+	long start;					/* the offset after the magic */
+	hashTable *strings;			/* string => its number + 1 */
+	streamString *table;
+	unsigned int count;
+	unsigned int size;
+	vString *record;
+	vString *stringRecord;		/* for STREAM_STRING written in a record */
+	vString *value;
+	vString *scope;
+	streamFields fields;
+} Stream;
+
+/*  vStringPut () doesn't count a NUL; the bytes of a record are
+ *  appended with vStringNCatSUnsafe ().
+ */
+static void catByte (vString *record, unsigned char c)
+{
+	vStringNCatSUnsafe (record, (const char *) &c, 1);
+}
+
+static void catVarint (vString *record, unsigned long n)
+{
+	while (n >= 0x80)
+	{
+		catByte (record, (unsigned char) ((n & 0x7f) | 0x80));
+		n >>= 7;
+	}
+	catByte (record, (unsigned char) n);
+}
+
+static void beginRecord (vString *record, enum streamRecordType type)
+{
+	vStringClear (record);
+	/* The length is filled in writeRecord (). */
+	vStringNCatSUnsafe (record, "\0\0\0", 4);
+	catByte (record, (unsigned char) type);
+}
+
+static int writeRecord (MIO *mio, vString *record)
+{
+	size_t length = vStringLength (record);
+	uint32_t n = (uint32_t) (length - 4);
+	char *buf = vStringValue (record);
+
+	buf [0] = (char) (n & 0xff);
+	buf [1] = (char) ((n >> 8) & 0xff);
+	buf [2] = (char) ((n >> 16) & 0xff);
+	buf [3] = (char) ((n >> 24) & 0xff);
+	if (mio_write (mio, buf, 1, length) < length)
+		return -1;
+	return (int) length;
+}
+
+static void beginStream (MIO *mio)
+{
+	if (Stream.strings == NULL)
+	{
+		Stream.strings = hashTableNewFlat (1021, hashCstrhash, hashCstreq,
+										   eFree, NULL);
+		Stream.record = vStringNew ();
+		Stream.stringRecord = vStringNew ();
+		Stream.value = vStringNew ();
+		Stream.scope = vStringNew ();
+		Stream.fields.buffer = vStringNew ();
+	}
+	if (mio_puts (mio, STREAM_MAGIC) == EOF)
+		error (FATAL | PERROR, "cannot complete write");
+	Stream.mio = mio;
+	Stream.start = mio_tell (mio);
+}
+
+/*  Return the number of STR in the string table. A record defining STR
+ *  is written to MIO if STR is not in the table. WRITTEN counts the
+ *  bytes written.
+ */
+static unsigned int internString (MIO *mio, const char *str, int *written)
+{
+	uintptr_t n = (uintptr_t) hashTableGetItem (Stream.strings, str);
+
+	if (n == 0)
+	{
+		vString *record = Stream.stringRecord;
+		char *key = eStrdup (str);
+		streamString *s;
+		int length;
+
+		if (Stream.count == Stream.size)
+		{
+			Stream.size = Stream.size? Stream.size * 2: 256;
+			Stream.table = xRealloc (Stream.table, Stream.size, streamString);
+		}
+		s = Stream.table + Stream.count;
+		s->str = key;
+		s->offset = mio_tell (mio);
+
+		beginRecord (record, STREAM_STRING);
+		vStringNCatSUnsafe (record, str, strlen (str) + 1);
+		length = writeRecord (mio, record);
+		if (length < 0)
+		{
+			eFree (key);
+			*written = -1;
+			return 0;
+		}
+		if (*written >= 0)
+			*written += length;
+
+		hashTablePutItem (Stream.strings, key, HT_UINT_TO_PTR (Stream.count + 1));
+		return Stream.count++;
+	}
+	return (unsigned int) (n - 1);
+}
+
+static void catInlineString (vString *record, const char *str)
+{
+	size_t length = strlen (str);
+
+	catVarint (record, (unsigned long) (length + 1) << 1);
+	vStringNCatSUnsafe (record, str, length + 1);
+}
+
+static void catInternedString (MIO *mio, vString *record, const char *str,
+							   int *written)
+{
+	catVarint (record, ((unsigned long) internString (mio, str, written) << 1) | 1);
+}
+
+/*  Undo the escaping of a value rendered by renderField (). Only the
+ *  fields without a renderer for unescaped values are rendered so.
+ */
+static const char *unescapeValue (const char *s)
+{
+	const char *end;
+
+	if (s == NULL || strchr (s, '\\') == NULL)
+		return s;
+
+	end = s + strlen (s);
+
+	vStringClear (Stream.value);
+	while (s < end)
+	{
+		int c = (unsigned char) *s++;
+
+		if (c == '\\' && s < end)
+		{
+			switch (*s)
+			{
+			case 't': c = '\t'; s++; break;
+			case 'r': c = '\r'; s++; break;
+			case 'n': c = '\n'; s++; break;
+			case '\\': c = '\\'; s++; break;
+			case 'a': c = '\a'; s++; break;
+			case 'b': c = '\b'; s++; break;
+			case 'v': c = '\v'; s++; break;
+			case 'f': c = '\f'; s++; break;
+			case 'x':
+				if (s + 2 < end
+					&& isxdigit ((unsigned char) s[1]) && isxdigit ((unsigned char) s[2]))
+				{
+					char hex [3] = { s[1], s[2], '\0' };
+					c = (int) strtol (hex, NULL, 16);
+					s += 3;
+				}
+				break;
+			}
+		}
+		vStringPut (Stream.value, c);
+	}
+	return vStringValue (Stream.value);
+}
+
+static const char *renderValue (const tagEntryInfo *const tag, fieldType ftype,
+								int fieldIndex)
+{
+	if (doesFieldHaveRenderer (ftype, true))
+		return renderFieldNoEscaping (ftype, tag, fieldIndex);
+	return unescapeValue (renderField (ftype, tag, fieldIndex));
+}
+
+/*  The values of these fields are few in a stream, and put in the
+ *  string table.
+ */
+static bool isValueInterned (fieldType ftype)
+{
+	switch (ftype)
+	{
+	case FIELD_LANGUAGE:
+	case FIELD_SCOPE_KIND_LONG:
+	case FIELD_SCOPE:
+	case FIELD_TYPE_REF:
+	case FIELD_INHERITANCE:
+	case FIELD_ACCESS:
+	case FIELD_IMPLEMENTATION:
+	case FIELD_ROLES:
+	case FIELD_EXTRAS:
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void addField (MIO *mio, streamFields *fields, const char *key,
+					  const char *value, bool interned, int *written)
+{
+	catInternedString (mio, fields->buffer, key, written);
+	if (interned)
+		catInternedString (mio, fields->buffer, value, written);
+	else
+		catInlineString (fields->buffer, value);
+	fields->count++;
+}
+
+static void addFieldMaybe (MIO *mio, streamFields *fields,
+						   const tagEntryInfo *const tag, fieldType ftype,
+						   int *written)
+{
+	if (isFieldEnabled (ftype) && doesFieldHaveValue (ftype, tag))
+		addField (mio, fields, getFieldName (ftype),
+				  renderValue (tag, ftype, NO_PARSER_FIELD),
+				  isValueInterned (ftype), written);
+}
+
+/*  Fill FIELDS in the order the u-ctags writer renders the extension
+ *  fields. The kind and the file scope have their places in the record.
+ */
+static void addExtensionFields (MIO *mio, streamFields *fields,
+								const tagEntryInfo *const tag,
+								unsigned long *lineNumber, int *written)
+{
+	if (isFieldEnabled (FIELD_LINE_NUMBER) && doesFieldHaveValue (FIELD_LINE_NUMBER, tag))
+		*lineNumber = tag->lineNumber;
+
+	addFieldMaybe (mio, fields, tag, FIELD_LANGUAGE, written);
+
+	if (isFieldEnabled (FIELD_SCOPE))
+	{
+		const char *k = renderValue (tag, FIELD_SCOPE_KIND_LONG, NO_PARSER_FIELD);
+		const char *v;
+
+		if (k)
+		{
+			/* K may be in the buffer of unescapeValue () V uses. */
+			vStringCopyS (Stream.scope, k);
+			v = renderValue (tag, FIELD_SCOPE, NO_PARSER_FIELD);
+			if (v && isFieldEnabled (FIELD_SCOPE_KEY))
+			{
+				vStringPut (Stream.scope, ':');
+				vStringCatS (Stream.scope, v);
+				addField (mio, fields, getFieldName (FIELD_SCOPE_KEY),
+						  vStringValue (Stream.scope), true, written);
+			}
+			else if (v)
+				addField (mio, fields, vStringValue (Stream.scope), v, true, written);
+		}
+	}
+
+	addFieldMaybe (mio, fields, tag, FIELD_TYPE_REF, written);
+
+	for (int k = FIELD_ECTAGS_LOOP_START; k <= FIELD_ECTAGS_LOOP_LAST; k++)
+		addFieldMaybe (mio, fields, tag, k, written);
+	for (int k = FIELD_UCTAGS_LOOP_START; k <= FIELD_BUILTIN_LAST; k++)
+		addFieldMaybe (mio, fields, tag, k, written);
+
+	for (unsigned int i = 0; i < tag->usedParserFields; i++)
+	{
+		const tagField *f = getParserFieldForIndex (tag, i);
+
+		if (isFieldEnabled (f->ftype))
+			addField (mio, fields, getFieldName (f->ftype),
+					  renderValue (tag, f->ftype, i), false, written);
+	}
+}
+
+static const char *getKindString (const tagEntryInfo *const tag, char letter [2])
+{
+	kindDefinition *kdef = getLanguageKind (tag->langType, tag->kindIndex);
+
+	letter [0] = kdef->letter;
+	letter [1] = '\0';
+	if (kdef->name != NULL && (isFieldEnabled (FIELD_KIND_LONG) ||
+		 (isFieldEnabled (FIELD_KIND) && kdef->letter == KIND_NULL_LETTER)))
+		return kdef->name;
+	else if (kdef->letter != KIND_NULL_LETTER && (isFieldEnabled (FIELD_KIND) ||
+			 (isFieldEnabled (FIELD_KIND_LONG) && kdef->name == NULL)))
+		return letter;
+	return NULL;
+}
+
+static int writeStreamEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+							 MIO * mio, const tagEntryInfo *const tag,
+							 void *clientData CTAGS_ATTR_UNUSED)
+{
+	static vString *address;
+	streamFields *fields;
+	vString *record;
+	unsigned long lineNumber = 0;
+	unsigned long flags = 0;
+	const char *kind = NULL;
+	char letter [2];
+	int written = 0;
+	int length;
+
+	if (Stream.mio == NULL)
+		beginStream (mio);
+	record = Stream.record;
+	fields = &Stream.fields;
+
+	address = vStringNewOrClearWithAutoRelease (address);
+	if (tag->lineNumberEntry)
+		vStringCatS (address, renderField (FIELD_LINE_NUMBER, tag, NO_PARSER_FIELD));
+	else
+	{
+		if (Option.locate == EX_COMBINE)
+		{
+			char buf [32];
+
+			snprintf (buf, sizeof (buf), "%lu;", tag->lineNumber);
+			vStringCatS (address, buf);
+		}
+		vStringCatS (address, renderField (FIELD_PATTERN, tag, NO_PARSER_FIELD));
+	}
+	if (isdigit ((unsigned char) vStringChar (address, 0)))
+		lineNumber = strtoul (vStringValue (address), NULL, 10);
+
+	vStringClear (fields->buffer);
+	fields->count = 0;
+
+	if (includeExtensionFlags ())
+	{
+		kind = getKindString (tag, letter);
+		if (isFieldEnabled (FIELD_FILE_SCOPE) && doesFieldHaveValue (FIELD_FILE_SCOPE, tag))
+			flags |= STREAM_FLAG_FILE_SCOPE;
+		addExtensionFields (mio, fields, tag, &lineNumber, &written);
+	}
+
+	/* The strings interned above are written before the record. */
+	beginRecord (record, STREAM_TAG);
+	catInlineString (record, renderFieldNoEscaping (FIELD_NAME, tag, NO_PARSER_FIELD));
+	catInternedString (mio, record,
+					   renderFieldNoEscaping (FIELD_INPUT_FILE, tag, NO_PARSER_FIELD),
+					   &written);
+	catInlineString (record, vStringValue (address));
+	catVarint (record, lineNumber);
+	if (kind)
+		catInternedString (mio, record, kind, &written);
+	else
+		catVarint (record, 0);
+	catVarint (record, flags);
+	catVarint (record, fields->count);
+	vStringCat (record, fields->buffer);
+
+	length = writeRecord (mio, record);
+	if (length < 0 || written < 0)
+		return -1;
+	return written + length;
+}
+
+static int writeStreamPtagEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+								 MIO * mio, const ptagDesc *desc,
+								 const char *const fileName,
+								 const char *const pattern,
+								 const char *const parserName,
+								 void *clientData CTAGS_ATTR_UNUSED)
+{
+	vString *record;
+	vString *s;
+
+	if (Stream.mio == NULL)
+		beginStream (mio);
+	record = Stream.record;
+
+	beginRecord (record, STREAM_PTAG);
+
+	s = vStringNewInit (PSEUDO_TAG_PREFIX);
+	vStringCatS (s, desc->name);
+	if (parserName)
+	{
+		vStringCatS (s, PSEUDO_TAG_SEPARATOR);
+		vStringCatS (s, parserName);
+	}
+	catInlineString (record, vStringValue (s));
+	catInlineString (record, fileName? fileName: "");
+
+	/* The pattern is written as the u-ctags writer does. */
+	vStringCopyS (s, "/");
+	if (pattern)
+		vStringCatSWithEscapingAsPattern (s, pattern);
+	vStringPut (s, '/');
+	catInlineString (record, vStringValue (s));
+	vStringDelete (s);
+
+	return writeRecord (mio, record);
+}
+
+/*  The tag file was truncated at the point the rescan starts. The
+ *  strings defined after the point are dropped from the string table,
+ *  and the magic is written again if it was dropped, too.
+ */
+static void rescanFailedStreamEntry (tagWriter *writer CTAGS_ATTR_UNUSED,
+									 unsigned long validTagNum CTAGS_ATTR_UNUSED,
+									 void *clientData CTAGS_ATTR_UNUSED)
+{
+	long offset;
+
+	if (Stream.mio == NULL)
+		return;
+
+	offset = mio_tell (Stream.mio);
+	while (Stream.count > 0 && Stream.table [Stream.count - 1].offset >= offset)
+	{
+		Stream.count--;
+		hashTableDeleteItem (Stream.strings, Stream.table [Stream.count].str);
+	}
+	if (offset < Stream.start)
+		Stream.mio = NULL;
+}
+
+static void finishStream (tagWriter *writer CTAGS_ATTR_UNUSED, MIO * mio CTAGS_ATTR_UNUSED,
+						  void *clientData CTAGS_ATTR_UNUSED)
+{
+	if (Stream.strings)
+	{
+		verbose ("wrote %u strings in the string table of the stream\n",
+				 Stream.count);
+		hashTableDelete (Stream.strings);
+		vStringDelete (Stream.record);
+		vStringDelete (Stream.stringRecord);
+		vStringDelete (Stream.value);
+		vStringDelete (Stream.scope);
+		vStringDelete (Stream.fields.buffer);
+	}
+	eFreeNoNullCheck (Stream.table);
+
+	memset (&Stream, 0, sizeof (Stream));
+}
+
+static bool treatFieldAsFixed (int fieldType)
+{
+	return uCtagsWriter.treatFieldAsFixed (fieldType);
+}
+
+static void checkStreamOptions (tagWriter *writer CTAGS_ATTR_UNUSED,
+								bool fieldsWereReset)
+{
+	uCtagsWriter.checkOptions (&uCtagsWriter, fieldsWereReset);
+}
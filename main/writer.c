@@ -9,9 +9,14 @@
 
 #include "general.h"
 
+#include <string.h>
+
 #include "debug.h"
 #include "entry_p.h"
 #include "options_p.h"
+#include "ptag_p.h"
+#include "routines.h"
+#include "sort_p.h"
 #include "writer_p.h"
 
 extern tagWriter uCtagsWriter;
@@ -19,6 +24,9 @@ extern tagWriter eCtagsWriter;
 extern tagWriter etagsWriter;
 extern tagWriter xrefWriter;
 extern tagWriter jsonWriter;
+extern tagWriter binaryWriter;
+extern tagWriter compressedWriter;
+extern tagWriter streamWriter;
 
 static tagWriter *writerTable [WRITER_COUNT] = {
 	[WRITER_U_CTAGS] = &uCtagsWriter,
@@ -26,11 +34,37 @@ static tagWriter *writerTable [WRITER_COUNT] = {
 	[WRITER_ETAGS] = &etagsWriter,
 	[WRITER_XREF]  = &xrefWriter,
 	[WRITER_JSON]  = &jsonWriter,
+	[WRITER_BINARY] = &binaryWriter,
+	[WRITER_COMPRESSED] = &compressedWriter,
+	[WRITER_STREAM] = &streamWriter,
 	[WRITER_CUSTOM] = NULL,
 };
 
 static tagWriter *writer;
 
+/* The point of an extra output before a tag is written to it: the tags
+ * the main writer had added and the size of the output then. */
+typedef struct sExtraOutputPoint {
+	unsigned long numTags;
+	long offset;
+} extraOutputPoint;
+
+/* An output written along with the tag file (--extra-output). The tags
+ * are kept in MIO, a memory, until the tag file is closed. */
+typedef struct sExtraOutput {
+	tagWriter *writer;
+	char *name;
+	MIO *mio;
+	/* The points of the tags written for the current input file, for
+	 * dropping the tags of a pass of a parser failing */
+	extraOutputPoint *points;
+	unsigned int pointCount;
+	unsigned int pointSize;
+} extraOutput;
+
+static extraOutput *extraOutputs;
+static unsigned int extraOutputCount;
+
 extern void setTagWriter (writerType wtype, tagWriter *customWriter)
 {
 	if (wtype != WRITER_CUSTOM)
@@ -40,6 +74,127 @@ extern void setTagWriter (writerType wtype, tagWriter *customWriter)
 	writer->type = wtype;
 }
 
+extern void addExtraOutput (writerType wtype, const char *const fileName)
+{
+	extraOutput *output;
+
+	Assert (wtype != WRITER_CUSTOM);
+
+	extraOutputs = xRealloc (extraOutputs, extraOutputCount + 1, extraOutput);
+	output = extraOutputs + extraOutputCount++;
+	memset (output, 0, sizeof (*output));
+	output->writer = writerTable [wtype];
+	output->writer->type = wtype;
+	output->name = eStrdup (fileName);
+}
+
+extern void clearExtraOutputs (void)
+{
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		Assert (extraOutputs [i].mio == NULL);
+		eFree (extraOutputs [i].name);
+	}
+	if (extraOutputs)
+		eFree (extraOutputs);
+	extraOutputs = NULL;
+	extraOutputCount = 0;
+}
+
+extern bool hasExtraOutputs (void)
+{
+	return extraOutputCount > 0;
+}
+
+extern void openExtraOutputs (const char *const tagFileName,
+							  bool (* canOverwrite) (const char *const fileName))
+{
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		const writerType wtype = output->writer->type;
+
+		if (tagFileName && strcmp (output->name, tagFileName) == 0)
+			error (FATAL, "extra output \"%s\" is the tag file", output->name);
+		if ((wtype == WRITER_U_CTAGS || wtype == WRITER_E_CTAGS || wtype == WRITER_ETAGS)
+			&& ! canOverwrite (output->name))
+			error (FATAL,
+				   "\"%s\" doesn't look like a tag file; I refuse to overwrite it.",
+				   output->name);
+		output->mio = mio_new_memory (NULL, 0, eRealloc, eFreeNoNullCheck);
+		output->pointCount = 0;
+	}
+}
+
+static void writeExtraOutput (extraOutput *output)
+{
+	size_t size = (size_t) mio_tell (output->mio);
+	unsigned char *data = mio_memory_get_data (output->mio, NULL);
+	MIO *file = mio_new_file (output->name, "w");
+
+	if (file == NULL)
+		error (FATAL | PERROR, "cannot open extra output \"%s\"", output->name);
+
+#ifndef EXTERNAL_SORT
+	/* The sections of etags format are not sorted as the tag file in
+	 * the format is not. */
+	if (Option.sorted != SO_UNSORTED && output->writer->type != WRITER_ETAGS)
+	{
+		size_t numTags = 0;
+
+		for (size_t i = 0; i < size; i++)
+			if (data [i] == '\n')
+				numTags++;
+		mio_rewind (output->mio);
+		if (numTags > 0)
+			internalSortTagsToMio (file, output->mio, numTags, NULL);
+	}
+	else
+#endif
+	if (size > 0 && mio_write (file, data, 1, size) < size)
+		error (FATAL | PERROR, "cannot write extra output \"%s\"", output->name);
+
+	if (mio_unref (file) != 0)
+		error (FATAL | PERROR, "cannot close extra output \"%s\"", output->name);
+}
+
+extern void closeExtraOutputs (void)
+{
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		tagWriter *w = output->writer;
+
+		if (output->mio == NULL)
+			continue;
+		if (w->finishWriting)
+			w->finishWriting (w, output->mio, w->clientData);
+		writeExtraOutput (output);
+		mio_unref (output->mio);
+		output->mio = NULL;
+		if (output->points)
+			eFree (output->points);
+		output->points = NULL;
+		output->pointSize = 0;
+	}
+}
+
+/* Remember the point before a tag is written to OUTPUT. */
+static void markExtraOutput (extraOutput *output)
+{
+	extraOutputPoint *point;
+
+	if (output->pointCount == output->pointSize)
+	{
+		output->pointSize = output->pointSize? output->pointSize * 2: 64;
+		output->points = xRealloc (output->points, output->pointSize,
+								   extraOutputPoint);
+	}
+	point = output->points + output->pointCount++;
+	point->numTags = numTagsAdded ();
+	point->offset = mio_tell (output->mio);
+}
+
 extern void writerSetup (MIO *mio, void *clientData)
 {
 	writer->clientData = clientData;
@@ -49,23 +204,64 @@ extern void writerSetup (MIO *mio, void *clientData)
 												 writer->clientData);
 	else
 		writer->private = NULL;
+
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		tagWriter *w = output->writer;
+
+		if (output->mio == NULL)
+			continue;
+		w->clientData = clientData;
+		w->private = w->preWriteEntry
+			? w->preWriteEntry (w, output->mio, w->clientData)
+			: NULL;
+		output->pointCount = 0;
+	}
 }
 
 extern bool writerTeardown (MIO *mio, const char *filename)
 {
+	bool r = false;
+
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		tagWriter *w = output->writer;
+
+		if (output->mio == NULL || w->postWriteEntry == NULL)
+			continue;
+
+		/* The etags writer counts the header of a section as a tag
+		 * of the tag file. */
+		unsigned long numTags = numTagsAdded ();
+		w->postWriteEntry (w, output->mio, filename, w->clientData);
+		w->private = NULL;
+		setNumTagsAdded (numTags);
+	}
+
 	if (writer->postWriteEntry)
 	{
-		bool r;
 		r = writer->postWriteEntry (writer, mio, filename,
 									writer->clientData);
 		writer->private = NULL;
-		return r;
 	}
-	return false;
+	return r;
 }
 
 extern int writerWriteTag (MIO * mio, const tagEntryInfo *const tag)
 {
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		tagWriter *w = output->writer;
+
+		if (output->mio == NULL)
+			continue;
+		markExtraOutput (output);
+		w->writeEntry (w, output->mio, tag, w->clientData);
+	}
+
 	return writer->writeEntry (writer, mio, tag,
 							   writer->clientData);
 }
@@ -79,6 +275,23 @@ extern int writerWritePtag (MIO * mio,
 	if (writer->writePtagEntry == NULL)
 		return -1;
 
+	/* The pseudo tags go to the extra outputs making tag files. */
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		tagWriter *w = output->writer;
+		const char *value = fileName;
+
+		if (output->mio == NULL
+			|| (w->type != WRITER_U_CTAGS && w->type != WRITER_E_CTAGS))
+			continue;
+		if (desc == getPtagDesc (PTAG_OUTPUT_MODE))
+			value = (w->type == WRITER_U_CTAGS)? "u-ctags": "e-ctags";
+		markExtraOutput (output);
+		w->writePtagEntry (w, output->mio, desc, value,
+						   pattern, parserName, w->clientData);
+	}
+
 	return writer->writePtagEntry (writer, mio, desc, fileName,
 								   pattern, parserName,
 								   writer->clientData);
@@ -89,6 +302,35 @@ extern void writerRescanFailed (unsigned long validTagNum)
 {
 	if (writer->rescanFailedEntry)
 		writer->rescanFailedEntry(writer, validTagNum, writer->clientData);
+
+	/* Drop the tags written to the extra outputs after the main writer
+	 * had VALIDTAGNUM tags. */
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		extraOutput *output = extraOutputs + i;
+		unsigned int n;
+
+		if (output->mio == NULL)
+			continue;
+		for (n = 0; n < output->pointCount; n++)
+			if (output->points [n].numTags >= validTagNum)
+				break;
+		if (n == output->pointCount)
+			continue;
+
+		mio_try_resize (output->mio, (size_t) output->points [n].offset);
+		mio_seek (output->mio, output->points [n].offset, SEEK_SET);
+		output->pointCount = n;
+		if (output->writer->rescanFailedEntry)
+			output->writer->rescanFailedEntry (output->writer, validTagNum,
+											   output->writer->clientData);
+	}
+}
+
+extern void writerFinish (MIO * mio)
+{
+	if (writer->finishWriting)
+		writer->finishWriting (writer, mio, writer->clientData);
 }
 
 extern bool ptagMakeCtagsOutputMode (ptagDesc *desc, langType langType CTAGS_ATTR_UNUSED,
@@ -96,7 +338,12 @@ extern bool ptagMakeCtagsOutputMode (ptagDesc *desc, langType langType CTAGS_ATT
 {
 	const char *mode ="";
 
-	if (&uCtagsWriter == writer)
+	/* The records of the binary format are what readtags reads from
+	 * tag lines in u-ctags format, and the compressed format holds
+	 * tag lines in u-ctags format. The patterns in the stream format
+	 * are the ones in u-ctags format. */
+	if (&uCtagsWriter == writer || &binaryWriter == writer
+		|| &compressedWriter == writer || &streamWriter == writer)
 		mode = "u-ctags";
 	else if (&eCtagsWriter == writer)
 		mode = "e-ctags";
@@ -117,6 +364,11 @@ extern bool writerCanPrintPtag (void)
 	return (writer->writePtagEntry)? true: false;
 }
 
+extern writerType getTagWriterType (void)
+{
+	return writer->type;
+}
+
 extern bool writerDoesTreatFieldAsFixed (int fieldType)
 {
 	if (writer->treatFieldAsFixed)
@@ -167,13 +419,16 @@ extern bool ptagMakeCtagsOutputExcmd (ptagDesc *desc,
 	case EX_COMBINE:
 		excmd = "combineV2";
 		break;
+	case EX_HASH:
+		excmd = "hash";
+		break;
 	default:
 		AssertNotReached ();
 		excmd = "bug!";
 		break;
 	}
 	return writePseudoTag (desc, excmd,
-						   "number, pattern, mixed, or combineV2",
+						   "number, pattern, mixed, combineV2, or hash",
 						   NULL);
 }
 
@@ -181,9 +436,40 @@ extern void writerCheckOptions (bool fieldsWereReset)
 {
 	if (writer->checkOptions)
 		writer->checkOptions (writer, fieldsWereReset);
+
+	/* A writer keeps its state for the input file being written, so
+	 * each format can be written to only one output. */
+	for (unsigned int i = 0; i < extraOutputCount; i++)
+	{
+		tagWriter *w = extraOutputs [i].writer;
+
+		if (w == writer)
+			error (FATAL, "extra output \"%s\" has the format of the main output",
+				   extraOutputs [i].name);
+		for (unsigned int j = 0; j < i; j++)
+			if (extraOutputs [j].writer == w)
+				error (FATAL, "extra outputs \"%s\" and \"%s\" have the same format",
+					   extraOutputs [j].name, extraOutputs [i].name);
+		if (writer->type == WRITER_ETAGS
+			&& (w->type == WRITER_U_CTAGS || w->type == WRITER_E_CTAGS))
+			error (WARNING, "extra output \"%s\" is neither sorted nor has pseudo tags in etags mode",
+				   extraOutputs [i].name);
+		if (w->checkOptions && w->checkOptions != writer->checkOptions)
+			w->checkOptions (w, fieldsWereReset);
+	}
 }
 
 extern bool writerPrintPtagByDefault (void)
 {
 	return writer->printPtagByDefault;
 }
+
+extern bool writerSortsTags (void)
+{
+	return writer->sortsTags;
+}
+
+extern bool writerBuffersInput (void)
+{
+	return writer->buffersInput;
+}
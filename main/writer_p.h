@@ -26,6 +26,9 @@ typedef enum eWriterType {
 	WRITER_ETAGS,
 	WRITER_XREF,
 	WRITER_JSON,
+	WRITER_BINARY,
+	WRITER_COMPRESSED,
+	WRITER_STREAM,
 	WRITER_CUSTOM,
 	WRITER_COUNT,
 } writerType;
@@ -50,6 +53,17 @@ struct sTagWriter {
 							  void *clientData);
 	void (* rescanFailedEntry) (tagWriter *writer, unsigned long validTagNum,
 								void *clientData);
+	/* Called once before the tag file is closed. A writer keeping
+	   the tags in memory writes them to MIO here. */
+	void (* finishWriting) (tagWriter *writer, MIO * mio,
+							void *clientData);
+	/* True if finishWriting writes the tags in the order --sort
+	   specifies; the lines of the tag file are not sorted then. */
+	bool sortsTags;
+	/* True if the tags of an input file are kept by the writer until
+	   postWriteEntry; tags appended to the tag file by the others, like
+	   worker processes, cannot be added to them. */
+	bool buffersInput;
 	bool (* treatFieldAsFixed) (int fieldType);
 
 	void (* checkOptions) (tagWriter *writer, bool fieldsWereReset);
@@ -82,6 +96,19 @@ int writerWritePtag (MIO * mio,
 					 const char *const parserName);
 
 void writerRescanFailed (unsigned long validTagNum);
+void writerFinish (MIO * mio);
+
+/* Extra outputs are written by their writers along with the tag file
+ * (--extra-output). The tags are dispatched to them by the functions
+ * above, and written to the files when closeExtraOutputs is called. */
+extern void addExtraOutput (writerType wtype, const char *const fileName);
+extern void clearExtraOutputs (void);
+extern bool hasExtraOutputs (void);
+/* CANOVERWRITE tells whether an existing file can be overwritten with
+ * an output in u-ctags, e-ctags, or etags format. */
+extern void openExtraOutputs (const char *const tagFileName,
+							  bool (* canOverwrite) (const char *const fileName));
+extern void closeExtraOutputs (void);
 
 extern const char *outputDefaultFileName (void);
 
@@ -95,10 +122,13 @@ extern bool ptagMakeCtagsOutputFilesep (ptagDesc *desc, langType language CTAGS_
 extern bool ptagMakeCtagsOutputExcmd (ptagDesc *desc, langType language CTAGS_ATTR_UNUSED, const void *data);
 
 extern bool writerCanPrintPtag (void);
+extern writerType getTagWriterType (void);
 extern bool writerDoesTreatFieldAsFixed (int fieldType);
 
 extern void writerCheckOptions (bool fieldsWereReset);
 extern bool writerPrintPtagByDefault (void);
+extern bool writerSortsTags (void);
+extern bool writerBuffersInput (void);
 
 #ifdef _WIN32
 extern enum filenameSepOp getFilenameSeparator (enum filenameSepOp currentSetting);
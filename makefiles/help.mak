@@ -15,12 +15,15 @@ help:
 	@echo ""
 	@echo "make units                        - Run parser unit test cases"
 	@echo "make tmain                        - Run ctags main functionality test cases"
-	@echo "make tlib                         - Run mini-geany test cases"
+	@echo "make tlib                         - Run mini-geany and mini-session test cases"
 	@echo "make tutil                        - Run utiltest test cases"
 	@echo "make man-test                     - Run testing examples in per-language man pages"
 	@echo "make check-genfile                - Run testing generated files are committed"
 	@echo "make check                        - Run all tests above"
 	@echo ""
+	@echo "make bench                        - Measure throughput of ctags over misc/bench.corpus"
+	@echo "make bench-util                   - Run microbenchmarks of data structures (utilbench)"
+	@echo ""
 	@echo "make fuzz                         - Verify that all parsers are able to properly process each available test unit"
 	@echo "make noise                        - Verify the behavior of parsers for broken input: a character injected or removed randomly"
 	@echo "make chop                         - Verify the behavior of parsers for broken input: randomly truncated from tail"
@@ -1,8 +1,9 @@
 # -*- makefile -*-
-.PHONY: check units fuzz noise tmain tinst tlib man-test clean-units clean-tlib clean-tmain clean-gcov clean-man-test run-gcov codecheck cppcheck dicts validate-input check-genfile tutil
+.PHONY: check units fuzz noise tmain tinst tlib man-test clean-units clean-tlib clean-tmain clean-gcov clean-man-test run-gcov codecheck cppcheck dicts validate-input check-genfile tutil bench bench-util
 
 EXTRA_DIST += misc/units misc/units.py misc/man-test.py
-EXTRA_DIST += misc/tlib misc/mini-geany.expected
+EXTRA_DIST += misc/tlib misc/mini-geany.expected misc/mini-session.expected
+EXTRA_DIST += misc/bench.py misc/bench.corpus misc/bench-cliffs
 MAN_TEST_TMPDIR = ManTest
 
 check: tmain units tlib man-test check-genfile tutil
@@ -13,6 +14,7 @@ clean-local: clean-units clean-tmain clean-man-test clean-tlib clean-gcov
 CTAGS_TEST = ./ctags$(EXEEXT)
 READTAGS_TEST = ./readtags$(EXEEXT)
 MINI_GEANY_TEST = ./mini-geany$(EXEEXT)
+MINI_SESSION_TEST = ./mini-session$(EXEEXT)
 OPTSCRIPT_TEST = ./optscript$(EXEEXT)
 UTILTEST_TEST = ./utiltest$(EXEEXT)
 
@@ -26,6 +28,7 @@ UTILTEST_TEST = ./utiltest$(EXEEXT)
 CTAGS_DEP = $(CTAGS_TEST)
 READTAGS_DEP = $(READTAGS_TEST)
 MINI_GEANY_DEP = $(MINI_GEANY_TEST)
+MINI_SESSION_DEP = $(MINI_SESSION_TEST)
 OPTSCRIPT_DEP = $(OPTSCRIPT_TEST)
 UTILTEST_DEP = $(UTILTEST_TEST)
 
@@ -126,6 +129,18 @@ units: $(CTAGS_DEP)
 	if ! test x$(PYTHON) = x; then	\
 		PROG=$(PYTHON);		\
 		SCRIPT=$(srcdir)/misc/units.py;	\
+		if ! test x$(THREADS) = x; then	\
+			THREADS_OPT=--threads=$(THREADS);	\
+		fi;	\
+		if ! test x$(TIMING) = x; then	\
+			TIMING_OPT=--timing-file=$(TIMING);	\
+		fi;	\
+		if ! test x$(TIMING_BASELINE) = x; then	\
+			TIMING_OPT="$${TIMING_OPT} --timing-baseline=$(TIMING_BASELINE)";	\
+		fi;	\
+		if ! test x$(TIMING_RATIO) = x; then	\
+			TIMING_OPT="$${TIMING_OPT} --timing-ratio=$(TIMING_RATIO)";	\
+		fi;	\
 		if type cygpath > /dev/null 2>&1; then	\
 			builddir=$$(cygpath -m "$$(pwd)");	\
 			if ! test x$(SHELL) = x; then	\
@@ -151,6 +166,8 @@ units: $(CTAGS_DEP)
 		$${VALGRIND} --run-shrink \
 		--with-timeout=`expr $(TIMEOUT) '*' 10`\
 		$${SHELL_OPT} \
+		$${THREADS_OPT} \
+		$${TIMING_OPT} \
 		$${SHOW_DIFF_OUTPUT}"; \
 		 $${PROG} $${c} $(srcdir)/Units $${builddir}/Units
 
@@ -160,6 +177,32 @@ clean-units:
 		$(SHELL) $(srcdir)/misc/units clean $$(pwd)/Units; \
 	fi
 
+#
+# BENCH Target
+#
+# e.g.
+#
+#    $ make bench BENCH_FLAGS="--output=base.json"
+#    $ make bench BENCH_FLAGS="--baseline=base.json --runs=9"
+#
+BENCH_FLAGS =
+bench: $(CTAGS_DEP)
+	$(V_RUN) \
+	if test x$(PYTHON) = x; then	\
+		echo "python3 is needed for running the benchmark" 1>&2; \
+		exit 1; \
+	fi; \
+	$(PYTHON) $(srcdir)/misc/bench.py \
+		--ctags=$(CTAGS_TEST) \
+		--srcdir=$(srcdir) \
+		$(BENCH_FLAGS)
+
+UTILBENCH_TEST = ./utilbench$(EXEEXT)
+UTILBENCH_DEP = $(UTILBENCH_TEST)
+UTILBENCH_FLAGS =
+bench-util: $(UTILBENCH_DEP)
+	$(V_RUN) $(UTILBENCH_TEST) $(UTILBENCH_FLAGS)
+
 #
 # VALIDATE-INPUT Target
 #
@@ -190,6 +233,9 @@ tmain: $(CTAGS_DEP) $(READTAGS_DEP) $(OPTSCRIPT_DEP)
 	if ! test x$(PYTHON) = x; then	\
 		PROG=$(PYTHON);		\
 		SCRIPT=$(srcdir)/misc/units.py;	\
+		if ! test x$(THREADS) = x; then	\
+			THREADS_OPT=--threads=$(THREADS);	\
+		fi;	\
 		if type cygpath > /dev/null 2>&1; then	\
 			builddir=$$(cygpath -m "$$(pwd)");	\
 			if ! test x$(SHELL) = x; then	\
@@ -211,6 +257,7 @@ tmain: $(CTAGS_DEP) $(READTAGS_DEP) $(OPTSCRIPT_DEP)
 		--units=$(UNITS) \
 		$${VALGRIND} \
 		$${SHELL_OPT} \
+		$${THREADS_OPT} \
 		$${SHOW_DIFF_OUTPUT}"; \
 		$${PROG} $${c} $(srcdir)/Tmain $${builddir}/Tmain
 
@@ -220,7 +267,7 @@ clean-tmain:
 		$(SHELL) $(srcdir)/misc/units clean-tmain $$(pwd)/Tmain; \
 	fi
 
-tlib: $(MINI_GEANY_DEP)
+tlib: $(MINI_GEANY_DEP) $(MINI_SESSION_DEP)
 	$(V_RUN) \
 	builddir=$$(pwd); \
 	mkdir -p $${builddir}/misc; \
@@ -236,10 +283,24 @@ tlib: $(MINI_GEANY_DEP)
 	else \
 		echo 'mini-geany: SKIP'; true; \
 	fi
+	$(V_RUN) \
+	builddir=$$(pwd); \
+	if test -s '$(MINI_SESSION_TEST)'; then \
+		$(MINI_SESSION_TEST) > $${builddir}/misc/mini-session.actual; \
+		if diff -uN --strip-trailing-cr $(srcdir)/misc/mini-session.expected \
+			$${builddir}/misc/mini-session.actual; then \
+			rm $${builddir}/misc/mini-session.actual; \
+			echo 'mini-session: OK'; true; \
+		else \
+			echo 'mini-session: FAILED'; false; \
+		fi; \
+	else \
+		echo 'mini-session: SKIP'; true; \
+	fi
 clean-tlib:
 	$(SILENT) echo Cleaning libctags part tests
 	$(SILENT) builddir=$$(pwd); \
-		rm -f $${builddir}/misc/mini-geany.actual
+		rm -f $${builddir}/misc/mini-geany.actual $${builddir}/misc/mini-session.actual
 
 #
 # Test installation
@@ -23,7 +23,7 @@
    Usage
    =======================================================================
 
-	$ badinput CMDLINE_TEMPLATE INPUT OUTPUT
+	$ badinput [--cpu-time=SECONDS] [--max-rss=KB] CMDLINE_TEMPLATE INPUT OUTPUT
 
    Description
    =======================================================================
@@ -79,26 +79,59 @@
    New shorter input, only 38 bytes, which can reproduce the issue is reported at the end.
    This new input is useful for debugging.
 
-   The result is shown in stdout and is recorded to the file specified as OUTPUT. */
+   The result is shown in stdout and is recorded to the file specified as OUTPUT.
+
+   Performance bugs
+   =======================================================================
+
+   With --cpu-time or --max-rss, the process is regarded as failing when
+   it runs longer than SECONDS of CPU time (user + system), or when its
+   peak resident set size gets larger than KB kilobytes, instead of when
+   it exits with non-zero status. The smallest input making a parser
+   that slow or that large is reported in the same way:
+
+	$ misc/badinput --cpu-time=0.5 "./ctags -o - --language-force=Ruby %s > /dev/null" big.rb /tmp/slow.rb
+
+   The CPU time and the peak RSS of each run are printed instead of the
+   exit status. The CPU time of the process is limited to a few seconds
+   beyond SECONDS, so that an input making ctags loop is cut short. Pick
+   a threshold well above the time ctags takes for the empty input, and
+   pass --options=NONE so that the start-up time stays the same.
+
+   A minimized input can be kept as a regression guard by copying it to
+   misc/bench-cliffs/ with a name telling the parser and the problem,
+   like misc/bench-cliffs/ruby-nested-heredoc.rb. misc/bench.py runs the
+   files there as the "cliffs" set, and `make bench` with --baseline
+   reports the set as slower if one of them hits the cliff again. */
 
 #define _GNU_SOURCE
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <errno.h>
+#include <getopt.h>
 
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
 #include <fcntl.h>
 #include <unistd.h>
 
+/* The thresholds for performance bugs; 0 means not given. */
+static double cpu_time_limit;
+static long max_rss_limit;
+
+/* The CPU time limit is raised by this many seconds for the process. */
+#define CPU_TIME_MARGIN 2
 
 static void
 print_help(const char *prog, FILE *fp, int status)
 {
 	fprintf(fp, "Usage:\n");
 	fprintf(fp, "	%s --help|-h\n", prog);
-	fprintf(fp, "	%s CMDLINE_TEMPLATE INPUT OUTPUT\n", prog);
+	fprintf(fp, "	%s [--cpu-time=SECONDS] [--max-rss=KB] CMDLINE_TEMPLATE INPUT OUTPUT\n", prog);
 	exit (status);
 }
 
@@ -158,6 +191,52 @@ prepare(int output_fd, char * input, size_t len)
 	}
 }
 
+/* Run CMDLINE, and return non-zero if it used more CPU time or memory
+ * than the thresholds. */
+static int
+run_measured (char* cmdline)
+{
+	pid_t pid;
+	int status;
+	struct rusage usage;
+	double cpu_time;
+
+	pid = fork ();
+	if (pid < 0)
+	{
+		perror ("fork");
+		exit (1);
+	}
+	if (pid == 0)
+	{
+		if (cpu_time_limit > 0)
+		{
+			struct rlimit limit;
+
+			limit.rlim_cur = (rlim_t) cpu_time_limit + 1 + CPU_TIME_MARGIN;
+			limit.rlim_max = limit.rlim_cur + 1;
+			if (setrlimit (RLIMIT_CPU, &limit) < 0)
+				perror ("setrlimit");
+		}
+		execl ("/bin/sh", "sh", "-c", cmdline, (char *) NULL);
+		perror ("execl");
+		_exit (127);
+	}
+
+	/* The usage of the shell includes the one of the commands run by it. */
+	if (wait4 (pid, &status, 0, &usage) < 0)
+	{
+		perror ("wait4");
+		exit (1);
+	}
+	cpu_time = usage.ru_utime.tv_sec + usage.ru_utime.tv_usec / 1e6
+		+ usage.ru_stime.tv_sec + usage.ru_stime.tv_usec / 1e6;
+	fprintf (stderr, "%.3fs %ldkB...", cpu_time, usage.ru_maxrss);
+
+	return ((cpu_time_limit > 0 && cpu_time > cpu_time_limit)
+			|| (max_rss_limit > 0 && usage.ru_maxrss > max_rss_limit));
+}
+
 static int
 test (char* cmdline, char * input, off_t start, size_t len, int output_fd)
 {
@@ -165,7 +244,10 @@ test (char* cmdline, char * input, off_t start, size_t len, int output_fd)
 
 	prepare (output_fd, input + start, len);
 	fprintf (stderr, "[%lu, %lu]...", start, start + len);
-	r = system(cmdline);
+	if (cpu_time_limit > 0 || max_rss_limit > 0)
+		r = run_measured (cmdline);
+	else
+		r = system(cmdline);
 	fprintf(stderr, "%d\n", r);
 
 	return r;
@@ -266,21 +348,53 @@ main(int argc, char** argv)
 	char * input;
 	size_t len;
 	int output_fd;
+	int c;
+	char *end;
+
+	static struct option long_options[] = {
+		{ "help",     no_argument,       NULL, 'h' },
+		{ "cpu-time", required_argument, NULL, 'c' },
+		{ "max-rss",  required_argument, NULL, 'm' },
+		{ NULL,       0,                 NULL, 0   },
+	};
 
+	while ((c = getopt_long (argc, argv, "+h", long_options, NULL)) != -1)
+	{
+		switch (c)
+		{
+		case 'h':
+			print_help(argv[0], stdout, 0);
+			break;
+		case 'c':
+			cpu_time_limit = strtod (optarg, &end);
+			if (*end != '\0' || !(cpu_time_limit > 0))
+			{
+				fprintf(stderr, "wrong seconds for --cpu-time: %s\n", optarg);
+				exit (1);
+			}
+			break;
+		case 'm':
+			max_rss_limit = strtol (optarg, &end, 10);
+			if (*end != '\0' || max_rss_limit <= 0)
+			{
+				fprintf(stderr, "wrong kilobytes for --max-rss: %s\n", optarg);
+				exit (1);
+			}
+			break;
+		default:
+			print_help(argv[0], stderr, 1);
+		}
+	}
 
-	if (argc == 2
-	    && ((!strcmp(argv[2], "--help"))
-		|| (!strcmp(argv[2], "-h"))))
-		print_help(argv[0], stdout, 0);
-	else if (argc != 4)
+	if (argc - optind != 3)
 	{
 		fprintf(stderr,"wrong number of arguments\n");
 		exit (1);
 	}
 
-	cmdline_template = argv[1];
-	input_file = argv[2];
-	output_file = argv[3];
+	cmdline_template = argv[optind];
+	input_file = argv[optind + 1];
+	output_file = argv[optind + 2];
 
 	if (!strstr (cmdline_template, "%s"))
 	{
@@ -305,13 +419,13 @@ main(int argc, char** argv)
 
 	if (test (cmdline, input, 0, len, output_fd) == 0)
 	{
-		fprintf(stderr, "the target command line exits normally against the original input\n");
+		fprintf(stderr, "the target command line does not fail against the original input\n");
 		exit (1);
 	}
 
 	if (test (cmdline, input, 0, 0, output_fd) != 0)
 	{
-		fprintf(stderr, "the target command line exits normally against the empty input\n");
+		fprintf(stderr, "the target command line fails against the empty input\n");
 		exit (1);
 	}
 
@@ -0,0 +1,280 @@
+#!/usr/bin/env python3
+
+#
+# bench.py - benchmark harness for ctags
+#
+# Copyright (C) 2026 Universal Ctags contributors
+#
+# This program is free software; you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation; either version 2 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program.  If not, see <http://www.gnu.org/licenses/>.
+#
+
+#
+# Python 3.5 or later is required.
+#
+# For each set of input files listed in the corpus file
+# (misc/bench.corpus), ctags runs once with --totals=json for counting
+# bytes, tags, and allocations, and then runs repeatedly for measuring
+# time and peak RSS. The median of the runs is reported.
+#
+# The startup time is measured by running ctags for an empty input file,
+# with the built-in parsers initialized when needed and with all of them
+# initialized (--_force-initializing).
+#
+# With --baseline, the results are compared with the ones saved with
+# --output in an earlier run, and the exit status is 1 if a set gets
+# slower or uses more memory than --threshold.
+#
+
+import argparse
+import glob
+import json
+import os
+import statistics
+import subprocess
+import sys
+import tempfile
+import time
+
+
+def read_corpus(corpus, srcdir):
+    sets = []
+    with open(corpus) as f:
+        for line in f:
+            fields = line.split()
+            if not fields or fields[0].startswith('#'):
+                continue
+            if len(fields) < 3:
+                sys.exit('%s: broken line: %s' % (corpus, line.rstrip()))
+            files = []
+            for pattern in fields[2:]:
+                files.extend(sorted(glob.glob(os.path.join(srcdir, pattern))))
+            sets.append((fields[0], fields[1], [f for f in files if os.path.isfile(f)]))
+    return sets
+
+
+def ctags_command(args, languages, list_file, tags_file):
+    cmd = [args.ctags, '--quiet', '--options=NONE', '-o', tags_file, '-L', list_file]
+    if languages != '-':
+        cmd.append('--languages=' + languages)
+    return cmd
+
+
+# Return (wall-clock seconds, CPU seconds, peak RSS in kB or None).
+def run_timed(cmd):
+    start = time.perf_counter()
+    if hasattr(os, 'wait4'):
+        proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status) \
+            if hasattr(os, 'waitstatus_to_exitcode') else status
+        if status != 0:
+            sys.exit('failed: %s' % ' '.join(cmd))
+        rss = usage.ru_maxrss
+        if sys.platform == 'darwin':
+            rss //= 1024        # in bytes on macOS
+        return (wall, usage.ru_utime + usage.ru_stime, rss)
+    subprocess.run(cmd, stdout=subprocess.DEVNULL, check=True)
+    wall = time.perf_counter() - start
+    return (wall, wall, None)
+
+
+def run_set(args, name, languages, files, workdir):
+    list_file = os.path.join(workdir, name + '.list')
+    tags_file = os.path.join(workdir, name + '.tags')
+    with open(list_file, 'w') as f:
+        for _ in range(args.scale):
+            for fname in files:
+                f.write(fname + '\n')
+
+    cmd = ctags_command(args, languages, list_file, tags_file)
+    probe = subprocess.run(cmd + ['--totals=json'], stdout=subprocess.DEVNULL,
+                           stderr=subprocess.PIPE, universal_newlines=True)
+    if probe.returncode != 0:
+        sys.exit('failed: %s\n%s' % (' '.join(cmd), probe.stderr))
+    totals = json.loads(probe.stderr.strip().splitlines()[-1])
+
+    runs = [run_timed(cmd) for _ in range(args.runs)]
+    wall = statistics.median([r[0] for r in runs])
+    cpu = statistics.median([r[1] for r in runs])
+    rss = [r[2] for r in runs if r[2] is not None]
+
+    return {
+        'files': totals['files'],
+        'bytes': totals['bytes'],
+        'tags': totals['tags'],
+        'allocations': totals['allocations'],
+        'wall': wall,
+        'cpu': cpu,
+        'mb_per_s': totals['bytes'] / 1e6 / wall if wall > 0 else 0,
+        'tags_per_s': totals['tags'] / wall if wall > 0 else 0,
+        'peak_rss_kb': max(rss) if rss else None,
+    }
+
+
+STARTUP_CASES = [
+    ('startup', []),
+    ('startup-init-all', ['--_force-initializing']),
+]
+
+# The startup is short; it is timed STARTUP_RUNS_SCALE times as many as
+# the sets for making the median stable.
+STARTUP_RUNS_SCALE = 10
+
+
+def run_startup(args, workdir):
+    input_file = os.path.join(workdir, 'empty.c')
+    tags_file = os.path.join(workdir, 'startup.tags')
+    open(input_file, 'w').close()
+
+    results = {}
+    for name, options in STARTUP_CASES:
+        cmd = [args.ctags, '--quiet', '--options=NONE'] + options + \
+            ['-o', tags_file, input_file]
+        runs = [run_timed(cmd) for _ in range(args.runs * STARTUP_RUNS_SCALE)]
+        results[name] = {
+            'wall': statistics.median([r[0] for r in runs]),
+            'cpu': statistics.median([r[1] for r in runs]),
+        }
+    return results
+
+
+def print_startup(startup):
+    print('')
+    print('%-18s %10s %10s' % ('startup', 'wall(ms)', 'cpu(ms)'))
+    for name, r in startup.items():
+        print('%-18s %10.2f %10.2f' % (name, r['wall'] * 1000, r['cpu'] * 1000))
+
+
+def print_results(results):
+    print('%-12s %6s %9s %8s %10s %9s %9s %11s %9s' %
+          ('set', 'files', 'MB', 'wall(s)', 'MB/s', 'tags/s', 'RSS(MB)',
+           'allocations', 'alloc/kB'))
+    for name, r in results.items():
+        rss = '%.1f' % (r['peak_rss_kb'] / 1024) if r['peak_rss_kb'] else '-'
+        print('%-12s %6d %9.2f %8.3f %10.2f %9.0f %9s %11d %9.2f' %
+              (name, r['files'], r['bytes'] / 1e6, r['wall'], r['mb_per_s'],
+               r['tags_per_s'], rss, r['allocations'],
+               r['allocations'] / (r['bytes'] / 1024) if r['bytes'] else 0))
+
+
+def change(new, old):
+    if not old:
+        return 0.0
+    return (new - old) * 100.0 / old
+
+
+def compare_results(results, baseline, threshold):
+    regressed = False
+    print('')
+    print('%-12s %10s %10s %10s  %s' % ('set', 'MB/s', 'RSS', 'allocs', 'verdict'))
+    for name, r in results.items():
+        b = baseline.get(name)
+        if b is None:
+            print('%-12s %10s %10s %10s  %s' % (name, '-', '-', '-', 'no baseline'))
+            continue
+        speed = change(r['mb_per_s'], b['mb_per_s'])
+        rss = change(r['peak_rss_kb'] or 0, b['peak_rss_kb'] or 0)
+        allocs = change(r['allocations'], b['allocations'])
+        bad = []
+        if speed < -threshold:
+            bad.append('slower')
+        if rss > threshold:
+            bad.append('more memory')
+        if allocs > threshold:
+            bad.append('more allocations')
+        if r['bytes'] != b['bytes'] or r['tags'] != b['tags']:
+            bad.append('different input or tags')
+        regressed = regressed or bool(bad)
+        print('%-12s %+9.1f%% %+9.1f%% %+9.1f%%  %s' %
+              (name, speed, rss, allocs, ', '.join(bad) if bad else 'ok'))
+    return regressed
+
+
+def compare_startup(startup, baseline, threshold):
+    regressed = False
+    print('')
+    print('%-18s %10s  %s' % ('startup', 'wall', 'verdict'))
+    for name, r in startup.items():
+        b = baseline.get(name)
+        if b is None:
+            print('%-18s %10s  %s' % (name, '-', 'no baseline'))
+            continue
+        wall = change(r['wall'], b['wall'])
+        bad = wall > threshold
+        regressed = regressed or bad
+        print('%-18s %+9.1f%%  %s' % (name, wall, 'slower' if bad else 'ok'))
+    return regressed
+
+
+def main():
+    srcdir = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    parser = argparse.ArgumentParser(description='Benchmark harness for ctags')
+    parser.add_argument('--ctags', default='./ctags',
+                        help='ctags executable (default: ./ctags)')
+    parser.add_argument('--srcdir', default=srcdir,
+                        help='top source directory (default: %(default)s)')
+    parser.add_argument('--corpus',
+                        help='corpus file (default: <srcdir>/misc/bench.corpus)')
+    parser.add_argument('--sets',
+                        help='comma separated list of sets to run (default: all)')
+    parser.add_argument('--runs', type=int, default=5,
+                        help='timed runs for each set (default: %(default)s)')
+    parser.add_argument('--scale', type=int, default=1,
+                        help='times each input file is listed (default: %(default)s)')
+    parser.add_argument('--output', help='save the results as JSON to OUTPUT')
+    parser.add_argument('--baseline', help='compare the results with BASELINE')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='percentage of allowed regression (default: %(default)s)')
+    args = parser.parse_args()
+
+    if args.runs < 1 or args.scale < 1:
+        parser.error('--runs and --scale must be positive')
+    corpus = args.corpus or os.path.join(args.srcdir, 'misc', 'bench.corpus')
+    wanted = args.sets.split(',') if args.sets else None
+
+    results = {}
+    with tempfile.TemporaryDirectory(prefix='ctags-bench-') as workdir:
+        for name, languages, files in read_corpus(corpus, args.srcdir):
+            if wanted is not None and name not in wanted:
+                continue
+            if not files:
+                print('%s: no input file' % name, file=sys.stderr)
+                continue
+            results[name] = run_set(args, name, languages, files, workdir)
+        startup = run_startup(args, workdir)
+
+    print_results(results)
+    print_startup(startup)
+
+    if args.output:
+        with open(args.output, 'w') as f:
+            json.dump({'runs': args.runs, 'scale': args.scale, 'sets': results,
+                       'startup': startup},
+                      f, indent=2, sort_keys=True)
+            f.write('\n')
+
+    if args.baseline:
+        with open(args.baseline) as f:
+            baseline = json.load(f)
+        regressed = compare_results(results, baseline['sets'], args.threshold)
+        regressed = compare_startup(startup, baseline.get('startup', {}),
+                                    args.threshold) or regressed
+        if regressed:
+            return 1
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -26,7 +26,7 @@
 # diff, etc.) are needed.
 #
 
-import time     # for debugging
+import time
 import argparse
 import filecmp
 import glob
@@ -57,8 +57,12 @@ LANGUAGES = []
 PRETENSE_OPTS = ''
 RUN_SHRINK = False
 SHOW_DIFF_OUTPUT = False
-NUM_WORKER_THREADS = 4
+NUM_WORKER_THREADS = os.cpu_count() or 4
 DIFF_U_NUM = 0
+TIMING_FILE = None
+TIMING_BASELINE = None
+TIMING_RATIO = 2.0
+TIMING_MIN = 0.05
 
 #
 # Internal variables and constants
@@ -89,6 +93,53 @@ L_BROKEN_ARGS_CTAGS = []
 L_VALGRIND = []
 TMAIN_STATUS = True
 TMAIN_FAILED = []
+L_SLOWER = []
+
+#
+# Timing of the cases: the name of a case -> (wall-clock seconds,
+# peak RSS in KiB or None)
+#
+TIMINGS = {}
+
+#
+# Output of the worker threads
+#
+# Each work item writes its output to a buffer of its own; the buffers
+# are printed in the order the items are queued, not in the order they
+# are completed, so the output is the same however many threads are
+# used.
+#
+class OrderedOutput:
+    def __init__(self):
+        self.lock = threading.Lock()
+        self.queued = 0
+        self.printed = 0
+        self.done = {}
+
+    def reserve(self):
+        with self.lock:
+            index = self.queued
+            self.queued += 1
+            return index
+
+    def complete(self, index, text):
+        with self.lock:
+            self.done[index] = text
+            while self.printed in self.done:
+                sys.stdout.write(self.done.pop(self.printed))
+                self.printed += 1
+            sys.stdout.flush()
+
+_ORDERED_OUTPUT = OrderedOutput()
+_THREAD_LOCAL = threading.local()
+
+# The file where a work item running in the current thread prints.
+def output_file():
+    f = getattr(_THREAD_LOCAL, 'file', None)
+    return f if f else sys.stdout
+
+def print_in_order(text):
+    _ORDERED_OUTPUT.complete(_ORDERED_OUTPUT.reserve(), text)
 
 def remove_prefix(string, prefix):
     if string.startswith(prefix):
@@ -115,12 +166,12 @@ def error_exit(status, msg):
     print(msg, file=sys.stderr)
     sys.exit(status)
 
-def line(*args, file=sys.stdout):
+def line(*args, file=None):
     if len(args) > 0:
         ch = args[0]
     else:
         ch = '-'
-    print(ch * 60, file=file)
+    print(ch * 60, file=file if file else output_file())
 
 def remove_readonly(func, path, _):
     # Clear the readonly bit and reattempt the removal
@@ -229,7 +280,7 @@ def decorate(decorator, msg, colorized):
     else:
         return msg
 
-def run_result(result_type, msg, output, *args, file=sys.stdout):
+def run_result(result_type, msg, output, *args, file=None):
     func_dict = {
             'skip': run_result_skip,
             'error': run_result_error,
@@ -237,6 +288,8 @@ def run_result(result_type, msg, output, *args, file=sys.stdout):
             'known_error': run_result_known_error,
             }
 
+    if not file:
+        file = output_file()
     func_dict[result_type](msg, file, COLORIZED_OUTPUT, *args)
     file.flush()
     if output:
@@ -265,11 +318,46 @@ def run_result_known_error(msg, f, colorized, *args):
     s = msg + decorate('yellow', 'failed', colorized) + ' (KNOWN bug)'
     print(s, file=f)
 
+# Run CMDLINE as subprocess.run does, measuring the wall-clock time and
+# the peak RSS of the process. The peak RSS is None where os.wait4 is
+# not available.
+def run_measured(cmdline, stdout, stderr, timeout):
+    start = time.time()
+    if not hasattr(os, 'wait4'):
+        ret = subprocess.run(cmdline, stdout=stdout, stderr=stderr,
+                timeout=timeout)
+        return (ret, time.time() - start, None)
+
+    p = subprocess.Popen(cmdline, stdout=stdout, stderr=stderr)
+    killed = []
+    def kill():
+        killed.append(True)
+        p.kill()
+    timer = None
+    if timeout:
+        timer = threading.Timer(timeout, kill)
+        timer.start()
+    (pid, status, usage) = os.wait4(p.pid, 0)
+    wall = time.time() - start
+    if timer:
+        timer.cancel()
+    if os.WIFSIGNALED(status):
+        p.returncode = -os.WTERMSIG(status)
+    else:
+        p.returncode = os.WEXITSTATUS(status)
+    if killed:
+        raise subprocess.TimeoutExpired(cmdline, timeout)
+
+    rss = usage.ru_maxrss
+    if platform.system() == 'Darwin':
+        rss //= 1024
+    return (subprocess.CompletedProcess(cmdline, p.returncode), wall, rss)
+
 def run_shrink(cmdline_template, finput, foutput, lang):
     script = sys.argv[0]
     script = os.path.splitext(script)[0]   # remove '.py'
 
-    print('Shrinking ' + finput + ' as ' + lang)
+    print('Shrinking ' + finput + ' as ' + lang, file=output_file())
     # fallback to the shell script version
     subprocess.run([SHELL, script, 'shrink',
         '--timeout=1', '--foreground',
@@ -476,8 +564,6 @@ def run_tcase(finput, t, name, tclass, category, build_t, extra_inputs):
     oshrink_template = o + '/SHRINK-%s.tmp'
     obundles = o + '/BUNDLES'
 
-    broken_args_ctags = False
-
     #
     # Filtered by UNIT
     #
@@ -493,10 +579,6 @@ def run_tcase(finput, t, name, tclass, category, build_t, extra_inputs):
     cmdline += ['--optlib-dir=+' + t + '/optlib', '-o', '-']
     if os.path.isfile(fargs):
         cmdline += ['--options=' + fargs]
-        ret = subprocess.run(cmdline + ['--_force-quit=0'],
-                stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
-        if ret.returncode != 0:
-            broken_args_ctags = True
 
     #
     # make a backup (basedcmdline) of cmdline.  basedcmdline is used
@@ -560,14 +642,6 @@ def run_tcase(finput, t, name, tclass, category, build_t, extra_inputs):
         L_SKIPPED_BY_ILOOP += [category + '/' + name]
         run_result('skip', msg, oresult, 'may cause an infinite loop')
         return False
-    if broken_args_ctags:
-        if not guessed_lang:
-            guessed_lang = guess_lang(basecmdline, finput)
-        msg = build_strings(guessed_lang)[0]
-        L_BROKEN_ARGS_CTAGS += [category + '/' + name]
-        run_result('error', msg, None, 'broken args.ctags?')
-        return False
-
     cmdline += output_tflag + [finput]
     if len(extra_inputs) > 0:
         cmdline += extra_inputs
@@ -580,12 +654,11 @@ def run_tcase(finput, t, name, tclass, category, build_t, extra_inputs):
     if timeout_value == 0:
         timeout_value = None
 
-    start = time.time()
     try:
         with open(orawout, 'wb') as fo, \
                 open(ostderr, 'wb') as fe:
-            ret = subprocess.run(cmdline, stdout=fo, stderr=fe,
-                    timeout=timeout_value)
+            (ret, wall, rss) = run_measured(cmdline, fo, fe, timeout_value)
+        TIMINGS[category + '/' + name] = (wall, rss)
         run_record_cmdline(cmdline, ffilter, ocmdline, output_type)
     except subprocess.TimeoutExpired:
         if not guessed_lang:
@@ -597,11 +670,23 @@ def run_tcase(finput, t, name, tclass, category, build_t, extra_inputs):
         if RUN_SHRINK and len(extra_inputs) == 0:
             run_shrink(cmdline_template, finput, oshrink, guessed_lang)
         return False
-    #print('execute time: %f' % (time.time() - start))
 
     guessed_lang = guess_lang_from_log(ostderr)
     (msg, cmdline_template, oshrink) = build_strings(guessed_lang)
 
+    # Whether args.ctags is broken or not is checked only when ctags
+    # fails. Checking it for all the cases costs an extra ctags process
+    # for each case.
+    if ret.returncode != 0 and os.path.isfile(fargs):
+        probe = subprocess.run(basecmdline + ['--_force-quit=0'],
+                stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+        if probe.returncode != 0:
+            guessed_lang = guess_lang(basecmdline, finput)
+            msg = build_strings(guessed_lang)[0]
+            L_BROKEN_ARGS_CTAGS += [category + '/' + name]
+            run_result('error', msg, None, 'broken args.ctags?')
+            return False
+
     if ret.returncode != 0:
         if WITH_VALGRIND and ret.returncode == _VALGRIND_EXIT and \
                 tclass != 'v':
@@ -694,16 +779,24 @@ def create_thread_queue(func):
         threads.append(t)
     return (q, threads)
 
+def queue_work(q, *args):
+    q.put((_ORDERED_OUTPUT.reserve(), args))
+
 def worker(func, q):
     while True:
         item = q.get()
         if item is None:
             break
+        (index, args) = item
+        buf = io.StringIO()
+        _THREAD_LOCAL.file = buf
         try:
-            func(*item)
+            func(*args)
         except:
             import traceback
-            traceback.print_exc()
+            traceback.print_exc(file=buf)
+        _THREAD_LOCAL.file = None
+        _ORDERED_OUTPUT.complete(index, buf.getvalue())
         q.task_done()
 
 def join_workers(q, threads):
@@ -735,19 +828,19 @@ def accepted_file(fname):
     # Ignore backup files
     return not fname.endswith('~')
 
-def run_dir(category, base_dir, build_base_dir):
+def run_dir(q, category, base_dir, build_base_dir):
     #
     # Filtered by CATEGORIES
     #
     if len(CATEGORIES) > 0 and not category in CATEGORIES:
         return False
 
-    print("\nCategory: " + category)
-    line()
-
-    (q, threads) = create_thread_queue(run_tcase)
+    header = io.StringIO()
+    print("\nCategory: " + category, file=header)
+    line(file=header)
+    print_in_order(header.getvalue())
 
-    for finput in glob.glob(base_dir + '/*.[dbtiv]/input.*'):
+    for finput in sorted(glob.glob(base_dir + '/*.[dbtiv]/input.*')):
         finput = finput.replace('\\', '/')  # for Windows
         if not accepted_file(finput):
             continue
@@ -763,9 +856,7 @@ def run_dir(category, base_dir, build_base_dir):
         build_tcase_dir = build_base_dir + remove_prefix(tcase_dir, base_dir)
         ret = re.match(r'^.*/(.*)\.([dbtiv])$', tcase_dir)
         (name, tclass) = ret.group(1, 2)
-        q.put((finput, tcase_dir, name, tclass, category, build_tcase_dir, extra_inputs))
-
-    join_workers(q, threads)
+        queue_work(q, finput, tcase_dir, name, tclass, category, build_tcase_dir, extra_inputs)
 
 def run_show_diff_output(units_dir, t):
     print("\t", end='')
@@ -804,21 +895,21 @@ def run_summary(build_dir):
     print(fmt % ('#passed:', len(L_PASSED)))
 
     print(fmt % ('#FIXED:', len(L_FIXED)))
-    for t in L_FIXED:
+    for t in sorted(L_FIXED):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     print(fmt % ('#FAILED (broken args.ctags?):', len(L_BROKEN_ARGS_CTAGS)))
-    for t in L_BROKEN_ARGS_CTAGS:
+    for t in sorted(L_BROKEN_ARGS_CTAGS):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     print(fmt % ('#FAILED (unexpected-exit-status):', len(L_FAILED_BY_STATUS)))
-    for t in L_FAILED_BY_STATUS:
+    for t in sorted(L_FAILED_BY_STATUS):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
         if SHOW_DIFF_OUTPUT:
             run_show_stderr_output(build_dir, remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     print(fmt % ('#FAILED (unexpected-output):', len(L_FAILED_BY_DIFF)))
-    for t in L_FAILED_BY_DIFF:
+    for t in sorted(L_FAILED_BY_DIFF):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
         if SHOW_DIFF_OUTPUT:
             run_show_stderr_output(build_dir, remove_prefix(t, _DEFAULT_CATEGORY + '/'))
@@ -826,36 +917,77 @@ def run_summary(build_dir):
 
     if WITH_TIMEOUT != 0:
         print(fmt % ('#TIMED-OUT (' + str(WITH_TIMEOUT) + 's):', len(L_FAILED_BY_TIMEED_OUT)))
-        for t in L_FAILED_BY_TIMEED_OUT:
+        for t in sorted(L_FAILED_BY_TIMEED_OUT):
             print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     print(fmt % ('#skipped (features):', len(L_SKIPPED_BY_FEATURES)))
-    for t in L_SKIPPED_BY_FEATURES:
+    for t in sorted(L_SKIPPED_BY_FEATURES):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     print(fmt % ('#skipped (languages):', len(L_SKIPPED_BY_LANGUAGES)))
-    for t in L_SKIPPED_BY_LANGUAGES:
+    for t in sorted(L_SKIPPED_BY_LANGUAGES):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     if WITH_TIMEOUT == 0:
         print(fmt % ('#skipped (infinite-loop):', len(L_SKIPPED_BY_ILOOP)))
-        for t in L_SKIPPED_BY_ILOOP:
+        for t in sorted(L_SKIPPED_BY_ILOOP):
             print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     print(fmt % ('#known-bugs:', len(L_KNOWN_BUGS)))
-    for t in L_KNOWN_BUGS:
+    for t in sorted(L_KNOWN_BUGS):
         print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
     if WITH_VALGRIND:
         print(fmt % ('#valgrind-error:', len(L_VALGRIND)))
-        for t in L_VALGRIND:
+        for t in sorted(L_VALGRIND):
             print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
         if SHOW_DIFF_OUTPUT:
             print(fmt % ('##valgrind-error:', len(L_VALGRIND)))
-            for t in L_VALGRIND:
+            for t in sorted(L_VALGRIND):
                 print("\t" + remove_prefix(t, _DEFAULT_CATEGORY + '/'))
                 run_show_valgrind_output(build_dir, remove_prefix(t, _DEFAULT_CATEGORY + '/'))
 
+    if TIMING_BASELINE:
+        print(fmt % ('#slower (x' + str(TIMING_RATIO) + '):', len(L_SLOWER)))
+        for (t, old, new) in L_SLOWER:
+            print("\t%s (%.3fs -> %.3fs)" % (remove_prefix(t, _DEFAULT_CATEGORY + '/'), old, new))
+
+# The timing file has a line for each case: the name, the wall-clock
+# time in seconds, and the peak RSS in KiB ('-' if unknown), separated
+# by tabs. Lines starting with '#' are comments.
+def write_timings(fname):
+    with open(fname, 'w') as f:
+        print('# name\twall(s)\tmaxrss(KiB)', file=f)
+        for t in sorted(TIMINGS):
+            (wall, rss) = TIMINGS[t]
+            print('%s\t%.4f\t%s' % (t, wall, '-' if rss is None else rss), file=f)
+
+def read_timings(fname):
+    timings = {}
+    with open(fname, 'r') as f:
+        for l in f:
+            if l.startswith('#'):
+                continue
+            fields = l.rstrip('\r\n').split('\t')
+            if len(fields) < 2:
+                continue
+            timings[fields[0]] = float(fields[1])
+    return timings
+
+# Cases taking less time than TIMING_MIN in both the runs are not
+# compared; their time is mostly the noise of starting ctags.
+def compare_timings(baseline):
+    global L_SLOWER
+    for t in sorted(TIMINGS):
+        if not t in baseline:
+            continue
+        new = TIMINGS[t][0]
+        old = baseline[t]
+        if max(new, old) < TIMING_MIN:
+            continue
+        if new > old * TIMING_RATIO:
+            L_SLOWER += [(t, old, new)]
+
 def make_pretense_map(arg):
     r = ''
     for p in arg.split(','):
@@ -886,6 +1018,10 @@ def action_run(parser, action, *args):
     global PRETENSE_OPTS
     global NUM_WORKER_THREADS
     global SHELL
+    global TIMING_FILE
+    global TIMING_BASELINE
+    global TIMING_RATIO
+    global TIMING_MIN
 
     parser.add_argument('--categories', metavar='CATEGORY1[,CATEGORY2,...]',
             help='run only CATEGORY* related cases.')
@@ -914,6 +1050,16 @@ def action_run(parser, action, *args):
             help='number of worker threads')
     parser.add_argument('--shell',
             help='shell to be used.')
+    parser.add_argument('--timing-file', metavar='FILE',
+            help='record the wall-clock time and the peak RSS of ctags for each case in FILE.')
+    parser.add_argument('--timing-baseline', metavar='FILE',
+            help='report the cases slower than recorded in FILE, written by --timing-file.')
+    parser.add_argument('--timing-ratio', type=float, default=TIMING_RATIO,
+            metavar='RATIO',
+            help='report a case slower than the baseline by more than RATIO times (default: %(default)s).')
+    parser.add_argument('--timing-min', type=float, default=TIMING_MIN,
+            metavar='SECONDS',
+            help='do not compare a case taking less than SECONDS in both the runs (default: %(default)s).')
     parser.add_argument('units_dir',
             help='Units directory.')
     parser.add_argument('build_dir', nargs='?', default='',
@@ -941,28 +1087,46 @@ def action_run(parser, action, *args):
         SHELL = res.shell
     if res.build_dir == '':
         res.build_dir = res.units_dir
+    TIMING_FILE = res.timing_file
+    TIMING_BASELINE = res.timing_baseline
+    TIMING_RATIO = res.timing_ratio
+    TIMING_MIN = res.timing_min
 
     if WITH_VALGRIND:
         check_availability('valgrind')
     check_availability('diff')
     init_features()
+    if TIMING_BASELINE:
+        if not os.path.isfile(TIMING_BASELINE):
+            error_exit(1, 'no such timing baseline: ' + TIMING_BASELINE)
+        baseline = read_timings(TIMING_BASELINE)
 
     if isabs(res.build_dir):
         build_dir = res.build_dir
     else:
         build_dir = os.path.realpath(res.build_dir)
 
+    # The cases of all the categories share the worker threads.
+    (q, threads) = create_thread_queue(run_tcase)
+
     category = _DEFAULT_CATEGORY
     if len(CATEGORIES) == 0 or (category in CATEGORIES):
-        run_dir(category, res.units_dir, build_dir)
+        run_dir(q, category, res.units_dir, build_dir)
 
-    for d in glob.glob(res.units_dir + '/*.r'):
+    for d in sorted(glob.glob(res.units_dir + '/*.r')):
         d = d.replace('\\', '/')    # for Windows
         if not os.path.isdir(d):
             continue
         category = os.path.basename(d)
         build_d = res.build_dir + '/' + category
-        run_dir(category, d, build_d)
+        run_dir(q, category, d, build_d)
+
+    join_workers(q, threads)
+
+    if TIMING_FILE:
+        write_timings(TIMING_FILE)
+    if TIMING_BASELINE:
+        compare_timings(baseline)
 
     run_summary(build_dir)
 
@@ -1104,8 +1268,7 @@ def tmain_sub(test_name, basedir, subdir, build_subdir):
 
     if ret.returncode == CODE_FOR_IGNORING_THIS_TMAIN_TEST:
         run_result('skip', '', None, stdout.replace("\n", ''), file=strbuf)
-        print(strbuf.getvalue(), end='')
-        sys.stdout.flush()
+        print(strbuf.getvalue(), end='', file=output_file())
         strbuf.close()
         return True
 
@@ -1138,8 +1301,7 @@ def tmain_sub(test_name, basedir, subdir, build_subdir):
         elif os.path.isfile(actual_txt):
             os.remove(actual_txt)
 
-    print(strbuf.getvalue(), end='')
-    sys.stdout.flush()
+    print(strbuf.getvalue(), end='', file=output_file())
     strbuf.close()
     return True
 
@@ -1151,14 +1313,14 @@ def tmain_run(topdir, build_topdir, units):
     (q, threads) = create_thread_queue(tmain_sub)
 
     basedir = os.getcwd()
-    for subdir in glob.glob(topdir + '/*.d'):
+    for subdir in sorted(glob.glob(topdir + '/*.d')):
         test_name = os.path.basename(subdir)[:-2]
 
         if len(units) > 0 and not test_name in units:
             continue
 
         build_subdir = build_topdir + '/' + os.path.basename(subdir)
-        q.put((test_name, basedir, subdir, build_subdir))
+        queue_work(q, test_name, basedir, subdir, build_subdir)
 
     join_workers(q, threads)
 
@@ -1166,7 +1328,7 @@ def tmain_run(topdir, build_topdir, units):
     if not TMAIN_STATUS:
         print('Failed tests')
         line('=')
-        for f in TMAIN_FAILED:
+        for f in sorted(TMAIN_FAILED):
             print(re.sub('<G>', ' (not committed/cached yet)', f))
         print()
 
@@ -98,7 +98,7 @@ V_WINDRES_1 =
 peg/%.c peg/%.h: peg/%.peg $(PACKCC)
 	$(V_PACKCC) $(PACKCC) $<
 
-all: copy_gnulib_heads $(PACKCC) ctags.exe readtags.exe optscript.exe utiltest.exe
+all: copy_gnulib_heads $(PACKCC) ctags.exe readtags.exe optscript.exe utiltest.exe utilbench.exe
 
 ctags: ctags.exe
 
@@ -128,13 +128,16 @@ optscript.exe: $(ALL_LIB_OBJS) $(OPTSCRIPT_OBJS) $(ALL_LIB_HEADS) $(OPTSCRIPT_DS
 utiltest.exe: $(UTIL_OBJS) $(UTIL_HEAD) $(UTILTEST_OBJS) $(UTILTEST_HEADS)
 	$(V_CC) $(CC) $(OPT) $(CFLAGS) $(LDFLAGS) -o $@ $(UTIL_OBJS) $(UTILTEST_OBJS)
 
+utilbench.exe: $(UTIL_OBJS) $(UTIL_HEAD) $(UTILBENCH_OBJS) $(UTILBENCH_HEADS)
+	$(V_CC) $(CC) $(OPT) $(CFLAGS) $(LDFLAGS) -o $@ $(UTIL_OBJS) $(UTILBENCH_OBJS)
+
 copy_gnulib_heads:
 	cp win32/config_mingw.h config.h
 	cp win32/gnulib_h/langinfo.h win32/gnulib_h/locale.h win32/gnulib_h/unistd.h win32/gnulib_h/fnmatch.h win32/gnulib_h/string.h win32/gnulib_h/wchar.h gnulib
 
 clean:
 	$(SILENT) echo Cleaning
-	$(SILENT) rm -f ctags.exe readtags.exe optscript.exe $(PACKCC)
+	$(SILENT) rm -f ctags.exe readtags.exe optscript.exe utiltest.exe utilbench.exe $(PACKCC)
 	$(SILENT) rm -f tags
 	$(SILENT) rm -f main/*.o optlib/*.o parsers/*.o parsers/cxx/*.o gnulib/*.o misc/packcc/*.o peg/*.o extra-cmds/*.o libreadtags/*.o dsl/*.o win32/*.o win32/mkstemp/*.o
 	$(SILENT) rm -f config.h gnulib/langinfo.h gnulib/locale.h gnulib/unistd.h gnulib/fnmatch.h gnulib/string.h gnulib/wchar.h
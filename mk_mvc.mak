@@ -28,6 +28,7 @@ UTIL_OBJS = $(UTIL_SRCS:.c=.obj)
 READTAGS_DSL_OBJS = $(READTAGS_DSL_SRCS:.c=.obj)
 OPTSCRIPT_OBJS = $(OPTSCRIPT_SRCS:.c=.obj)
 UTILTEST_OBJS = $(UTILTEST_SRCS:.c=.obj)
+UTILBENCH_OBJS = $(UTILBENCH_SRCS:.c=.obj)
 
 !if "$(WITH_ICONV)" == "yes"
 DEFINES = $(DEFINES) -DHAVE_ICONV
@@ -78,7 +79,7 @@ PDBFLAG =
 {gnulib\malloc}.c{gnulib\malloc}.obj::
 	$(CC) $(OPT) $(DEFINES) $(INCLUDES) /Fognulib\malloc\ /c $<
 
-all: copy_gnulib_heads $(PACKCC) ctags.exe readtags.exe optscript.exe utiltest.exe
+all: copy_gnulib_heads $(PACKCC) ctags.exe readtags.exe optscript.exe utiltest.exe utilbench.exe
 
 ctags: ctags.exe
 
@@ -94,6 +95,9 @@ optscript.exe: $(ALL_LIB_OBJS) $(OPTSCRIPT_OBJS) $(ALL_LIB_HEADS) $(OPTSCRIPT_DS
 utiltest.exe: $(UTIL_OBJS) $(UTIL_HEADS) $(UTILTEST_OBJS) $(UTILTEST_HEADS) $(WIN32_HEADS)
 	$(CC) $(OPT) /Fe$@ $(UTIL_OBJS) $(UTILTEST_OBJS) $(WIN32_OBJS) /link setargv.obj
 
+utilbench.exe: $(UTIL_OBJS) $(UTIL_HEADS) $(UTILBENCH_OBJS) $(UTILBENCH_HEADS) $(WIN32_HEADS)
+	$(CC) $(OPT) /Fe$@ $(UTIL_OBJS) $(UTILBENCH_OBJS) $(WIN32_OBJS) /link setargv.obj
+
 $(PACKCC_OBJ): $(PACKCC_SRC)
 	$(CC) /c $(OPT) /Fo$@ $(INCLUDES) $(COMMON_DEFINES) $(PACKCC_SRC)
 
@@ -117,6 +121,6 @@ copy_gnulib_heads:
 
 clean:
 	- del *.obj main\*.obj optlib\*.obj parsers\*.obj parsers\cxx\*.obj gnulib\*.obj misc\packcc\*.obj peg\*.obj extra-cmds\*.obj libreadtags\*.obj dsl\*.obj win32\mkstemp\*.obj win32\*.res main\repoinfo.h
-	- del ctags.exe readtags.exe optscript.exe $(PACKCC)
+	- del ctags.exe readtags.exe optscript.exe utiltest.exe utilbench.exe $(PACKCC)
 	- del tags
 	- del config.h gnulib\langinfo.h gnulib\fnmatch.h gnulib\*.obj gnulib\malloc\*.obj
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/cmake.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/cmake.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,1439 @@
 #include "xtag.h"
 
 
+static const unsigned char CMakeSet0 [32] = {
+	0xff, 0xf9, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+	0xbd, 0x5f, 0xf6, 0xff, 0xbd, 0x5f, 0xf6, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet1 [32] = {
+	0xff, 0xf9, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet2 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char CMakeSet3 [32] = {
+	0xff, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet4 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char CMakeSet5 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char CMakeSet6 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x09, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char CMakeSet7 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char CMakeSet8 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char CMakeSet9 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet10 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet11 [32] = {
+	0xff, 0xf9, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff,
+	0x9d, 0x5f, 0xf7, 0xff, 0x9d, 0x5f, 0xf7, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet12 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet13 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xef, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet14 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+	0xbf, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CMakeSet15 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchCMake0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (CMakeSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet1, *p))
+			p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher0 = {
+	matchCMake0, 0, false, false,
+};
+
+static bool matchCMake1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher1 = {
+	matchCMake1, 0, false, false,
+};
+
+static bool matchCMake2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'E' && *p != 'e'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher2 = {
+	matchCMake2, 0, false, true,
+};
+
+static bool matchCMake3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'F' && *p != 'f'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'U' && *p != 'u'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'I' && *p != 'i'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher3 = {
+	matchCMake3, 0, false, true,
+};
+
+static bool matchCMake4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'M' && *p != 'm'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'R' && *p != 'r'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher4 = {
+	matchCMake4, 0, false, true,
+};
+
+static bool matchCMake5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'D' && *p != 'd'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'D' && *p != 'd'))
+			goto next;
+		p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (end - p >= 13
+		    && (p [0] == 'C' || p [0] == 'c')
+		    && (p [1] == 'U' || p [1] == 'u')
+		    && (p [2] == 'S' || p [2] == 's')
+		    && (p [3] == 'T' || p [3] == 't')
+		    && (p [4] == 'O' || p [4] == 'o')
+		    && (p [5] == 'M' || p [5] == 'm')
+		    && p [6] == '_'
+		    && (p [7] == 'T' || p [7] == 't')
+		    && (p [8] == 'A' || p [8] == 'a')
+		    && (p [9] == 'R' || p [9] == 'r')
+		    && (p [10] == 'G' || p [10] == 'g')
+		    && (p [11] == 'E' || p [11] == 'e')
+		    && (p [12] == 'T' || p [12] == 't'))
+			p += 13;
+		else if (end - p >= 10
+		    && (p [0] == 'E' || p [0] == 'e')
+		    && (p [1] == 'X' || p [1] == 'x')
+		    && (p [2] == 'E' || p [2] == 'e')
+		    && (p [3] == 'C' || p [3] == 'c')
+		    && (p [4] == 'U' || p [4] == 'u')
+		    && (p [5] == 'T' || p [5] == 't')
+		    && (p [6] == 'A' || p [6] == 'a')
+		    && (p [7] == 'B' || p [7] == 'b')
+		    && (p [8] == 'L' || p [8] == 'l')
+		    && (p [9] == 'E' || p [9] == 'e'))
+			p += 10;
+		else if (end - p >= 7
+		    && (p [0] == 'L' || p [0] == 'l')
+		    && (p [1] == 'I' || p [1] == 'i')
+		    && (p [2] == 'B' || p [2] == 'b')
+		    && (p [3] == 'R' || p [3] == 'r')
+		    && (p [4] == 'A' || p [4] == 'a')
+		    && (p [5] == 'R' || p [5] == 'r')
+		    && (p [6] == 'Y' || p [6] == 'y'))
+			p += 7;
+		else
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher5 = {
+	matchCMake5, 1, false, true,
+};
+
+static bool matchCMake6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'P' && *p != 'p'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'I' && *p != 'i'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher6 = {
+	matchCMake6, 0, false, true,
+};
+
+static bool matchCMake7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'P' && *p != 'p'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'R' && *p != 'r'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'J' && *p != 'j'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'E' && *p != 'e'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher7 = {
+	matchCMake7, 0, false, true,
+};
+
+static bool matchCMake8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		while (p < end && REGEX_SET_HAS (CMakeSet2, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher8 = {
+	matchCMake8, 0, false, false,
+};
+
+static bool matchCMake9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher9 = {
+	matchCMake9, 0, false, false,
+};
+
+static bool matchCMake10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher10 = {
+	matchCMake10, 1, false, false,
+};
+
+static bool matchCMake11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher11 = {
+	matchCMake11, 2, false, false,
+};
+
+static bool matchCMake12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || !REGEX_SET_HAS (CMakeSet6, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher12 = {
+	matchCMake12, 0, false, false,
+};
+
+static bool matchCMake13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (CMakeSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet8, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || !REGEX_SET_HAS (CMakeSet6, *p))
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher13 = {
+	matchCMake13, 2, false, false,
+};
+
+static bool matchCMake14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (CMakeSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet8, *p))
+			p++;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher14 = {
+	matchCMake14, 1, false, false,
+};
+
+static bool matchCMake15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (CMakeSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet8, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher15 = {
+	matchCMake15, 2, false, false,
+};
+
+static bool matchCMake16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher16 = {
+	matchCMake16, 1, false, false,
+};
+
+static bool matchCMake17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher17 = {
+	matchCMake17, 2, false, false,
+};
+
+static bool matchCMake18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher18 = {
+	matchCMake18, 1, false, false,
+};
+
+static bool matchCMake19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher19 = {
+	matchCMake19, 2, false, false,
+};
+
+static bool matchCMake20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || !REGEX_SET_HAS (CMakeSet6, *p))
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher20 = {
+	matchCMake20, 2, false, false,
+};
+
+static bool matchCMake21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher21 = {
+	matchCMake21, 0, false, false,
+};
+
+static bool matchCMake22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ']')
+			goto next;
+		p++;
+		if (p == end || *p != ']')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet2, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher22 = {
+	matchCMake22, 0, false, false,
+};
+
+static bool matchCMake23 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (CMakeSet9, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet10, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher23 = {
+	matchCMake23, 0, false, false,
+};
+
+static bool matchCMake24 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (end - p >= 1
+		    && REGEX_SET_HAS (CMakeSet11, p [0]))
+			p += 1;
+		else if (end - p >= 2
+		    && (p [0] == 'E' || p [0] == 'e')
+		    && REGEX_SET_HAS (CMakeSet12, p [1]))
+			p += 2;
+		else if (end - p >= 3
+		    && (p [0] == 'E' || p [0] == 'e')
+		    && (p [1] == 'N' || p [1] == 'n')
+		    && REGEX_SET_HAS (CMakeSet13, p [2]))
+			p += 3;
+		else if (end - p >= 4
+		    && (p [0] == 'E' || p [0] == 'e')
+		    && (p [1] == 'N' || p [1] == 'n')
+		    && (p [2] == 'D' || p [2] == 'd')
+		    && REGEX_SET_HAS (CMakeSet14, p [3]))
+			p += 4;
+		else
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (CMakeSet1, *p))
+			p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher24 = {
+	matchCMake24, 1, false, false,
+};
+
+static bool matchCMake25 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'E' && *p != 'e'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher25 = {
+	matchCMake25, 0, false, true,
+};
+
+static bool matchCMake26 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'F' && *p != 'f'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'U' && *p != 'u'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'I' && *p != 'i'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher26 = {
+	matchCMake26, 0, false, true,
+};
+
+static bool matchCMake27 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'M' && *p != 'm'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'R' && *p != 'r'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher27 = {
+	matchCMake27, 0, false, true,
+};
+
+static bool matchCMake28 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'E' && *p != 'e'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'D' && *p != 'd'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'F' && *p != 'f'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'U' && *p != 'u'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'I' && *p != 'i'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CMakeSet15, *p))
+			p++;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher28 = {
+	matchCMake28, 0, false, true,
+};
+
+static bool matchCMake29 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'D' && *p != 'd'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'D' && *p != 'd'))
+			goto next;
+		p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (end - p >= 13
+		    && (p [0] == 'C' || p [0] == 'c')
+		    && (p [1] == 'U' || p [1] == 'u')
+		    && (p [2] == 'S' || p [2] == 's')
+		    && (p [3] == 'T' || p [3] == 't')
+		    && (p [4] == 'O' || p [4] == 'o')
+		    && (p [5] == 'M' || p [5] == 'm')
+		    && p [6] == '_'
+		    && (p [7] == 'T' || p [7] == 't')
+		    && (p [8] == 'A' || p [8] == 'a')
+		    && (p [9] == 'R' || p [9] == 'r')
+		    && (p [10] == 'G' || p [10] == 'g')
+		    && (p [11] == 'E' || p [11] == 'e')
+		    && (p [12] == 'T' || p [12] == 't'))
+			p += 13;
+		else if (end - p >= 10
+		    && (p [0] == 'E' || p [0] == 'e')
+		    && (p [1] == 'X' || p [1] == 'x')
+		    && (p [2] == 'E' || p [2] == 'e')
+		    && (p [3] == 'C' || p [3] == 'c')
+		    && (p [4] == 'U' || p [4] == 'u')
+		    && (p [5] == 'T' || p [5] == 't')
+		    && (p [6] == 'A' || p [6] == 'a')
+		    && (p [7] == 'B' || p [7] == 'b')
+		    && (p [8] == 'L' || p [8] == 'l')
+		    && (p [9] == 'E' || p [9] == 'e'))
+			p += 10;
+		else if (end - p >= 7
+		    && (p [0] == 'L' || p [0] == 'l')
+		    && (p [1] == 'I' || p [1] == 'i')
+		    && (p [2] == 'B' || p [2] == 'b')
+		    && (p [3] == 'R' || p [3] == 'r')
+		    && (p [4] == 'A' || p [4] == 'a')
+		    && (p [5] == 'R' || p [5] == 'r')
+		    && (p [6] == 'Y' || p [6] == 'y'))
+			p += 7;
+		else
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher29 = {
+	matchCMake29, 1, false, true,
+};
+
+static bool matchCMake30 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'P' && *p != 'p'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'I' && *p != 'i'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher30 = {
+	matchCMake30, 0, false, true,
+};
+
+static bool matchCMake31 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher31 = {
+	matchCMake31, 1, false, false,
+};
+
+static bool matchCMake32 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CMakeSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CMakeMatcher32 = {
+	matchCMake32, 2, false, false,
+};
+
 static void initializeCMakeParser (const langType language)
 {
 
@@ -30,175 +1463,232 @@ static void initializeCMakeParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^sSfFmMaAoOpP# \t\n][^ #\t\n]*[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^set[ \t]*\\(",
-	                               "", "", "{icase}{tenter=variable}", NULL);
+	                               "", "", "{icase}{tenter=variable}", NULL,
+	                               &CMakeMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^function[ \t]*\\(",
-	                               "", "", "{icase}{tenter=function}", NULL);
+	                               "", "", "{icase}{tenter=function}", NULL,
+	                               &CMakeMatcher3);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^macro[ \t]*\\(",
-	                               "", "", "{icase}{tenter=macro}", NULL);
+	                               "", "", "{icase}{tenter=macro}", NULL,
+	                               &CMakeMatcher4);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^add_(custom_target|executable|library)[ \t]*\\(",
-	                               "", "", "{icase}{tenter=target}", NULL);
+	                               "", "", "{icase}{tenter=target}", NULL,
+	                               &CMakeMatcher5);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^option[ \t]*\\(",
-	                               "", "", "{icase}{tenter=option}", NULL);
+	                               "", "", "{icase}{tenter=option}", NULL,
+	                               &CMakeMatcher6);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^project[ \t]*\\(",
-	                               "", "", "{icase}{tenter=project}", NULL);
+	                               "", "", "{icase}{tenter=project}", NULL,
+	                               &CMakeMatcher7);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^ \t\n]+[ \t\n]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher8);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "variable",
 	                               "^([A-Za-z0-9_.-]+)[ \t\n\\)]+",
-	                               "\\1", "v", "{tleave}", NULL);
+	                               "\\1", "v", "{tleave}", NULL,
+	                               &CMakeMatcher10);
 	addLanguageTagMultiTableRegex (language, "variable",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "variable",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "variable",
 	                               "^([A-Za-z0-9_.-]+)(#)",
-	                               "\\1", "v", "{tleave}{_advanceTo=2start}", NULL);
+	                               "\\1", "v", "{tleave}{_advanceTo=2start}", NULL,
+	                               &CMakeMatcher11);
 	addLanguageTagMultiTableRegex (language, "variableScoped",
 	                               "^[A-Za-z0-9_.-]+[# \t\n\\)]",
-	                               "", "", "{tjump=inVariable}{_advanceTo=0start}", NULL);
+	                               "", "", "{tjump=inVariable}{_advanceTo=0start}", NULL,
+	                               &CMakeMatcher12);
 	addLanguageTagMultiTableRegex (language, "variableScoped",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "variableScoped",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "function",
 	                               "^([A-Za-z_][A-Za-z0-9_]*)([# \t\n\\)])",
-	                               "\\1", "f", "{_advanceTo=2start}{tjump=inFunction}{scope=push}", NULL);
+	                               "\\1", "f", "{_advanceTo=2start}{tjump=inFunction}{scope=push}", NULL,
+	                               &CMakeMatcher13);
 	addLanguageTagMultiTableRegex (language, "function",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "function",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "macro",
 	                               "^([A-Za-z_][A-Za-z0-9_]*)[ \t\n\\)]+",
-	                               "\\1", "m", "{tleave}", NULL);
+	                               "\\1", "m", "{tleave}", NULL,
+	                               &CMakeMatcher14);
 	addLanguageTagMultiTableRegex (language, "macro",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "macro",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "macro",
 	                               "^([A-Za-z_][A-Za-z0-9_]*)(#)",
-	                               "\\1", "m", "{tleave}{_advanceTo=2start}", NULL);
+	                               "\\1", "m", "{tleave}{_advanceTo=2start}", NULL,
+	                               &CMakeMatcher15);
 	addLanguageTagMultiTableRegex (language, "target",
 	                               "^([A-Za-z0-9_.-]+)[ \t\n\\)]+",
-	                               "\\1", "t", "{tleave}", NULL);
+	                               "\\1", "t", "{tleave}", NULL,
+	                               &CMakeMatcher16);
 	addLanguageTagMultiTableRegex (language, "target",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "target",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "target",
 	                               "^([A-Za-z0-9_.-]+)(#)",
-	                               "\\1", "t", "{tleave}{_advanceTo=2start}", NULL);
+	                               "\\1", "t", "{tleave}{_advanceTo=2start}", NULL,
+	                               &CMakeMatcher17);
 	addLanguageTagMultiTableRegex (language, "option",
 	                               "^([A-Za-z0-9_.-]+)[ \t\n\\)]+",
-	                               "\\1", "D", "{tleave}", NULL);
+	                               "\\1", "D", "{tleave}", NULL,
+	                               &CMakeMatcher18);
 	addLanguageTagMultiTableRegex (language, "option",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "option",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "option",
 	                               "^([A-Za-z0-9_.-]+)(#)",
-	                               "\\1", "D", "{tleave}{_advanceTo=2start}", NULL);
+	                               "\\1", "D", "{tleave}{_advanceTo=2start}", NULL,
+	                               &CMakeMatcher19);
 	addLanguageTagMultiTableRegex (language, "project",
 	                               "^([A-Za-z0-9_.-]+)([# \t\n\\)])",
-	                               "\\1", "p", "{tleave}{_advanceTo=2start}", NULL);
+	                               "\\1", "p", "{tleave}{_advanceTo=2start}", NULL,
+	                               &CMakeMatcher20);
 	addLanguageTagMultiTableRegex (language, "project",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "project",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "commentBegin",
 	                               "^\\[\\[",
-	                               "", "", "{tjump=commentMultiline}", NULL);
+	                               "", "", "{tjump=commentMultiline}", NULL,
+	                               &CMakeMatcher21);
 	addLanguageTagMultiTableRegex (language, "commentBegin",
 	                               "^[^\n]*[ \t\n]*",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "commentMultiline",
 	                               "^\\]\\][ \t\n]*",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &CMakeMatcher22);
 	addLanguageTagMultiTableRegex (language, "commentMultiline",
 	                               "^.[^]]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher23);
 	addLanguageTagMultiTableRegex (language, "skipComment",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipWhiteSpace",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "skipToName",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "skipToName",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "nextToken",
 	                               "^[^ \t\n]+[ \t\n]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher8);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^([^eEsSfFmMaAoO# \t\n]|[eE][^nN]|[eE][nN][^dD]|[eE][nN][dD][^fF#])[^ #\t\n]*[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher24);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^#",
-	                               "", "", "{tenter=commentBegin}", NULL);
+	                               "", "", "{tenter=commentBegin}", NULL,
+	                               &CMakeMatcher1);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^set[ \t]*\\(",
-	                               "", "", "{icase}{tenter=variableScoped}", NULL);
+	                               "", "", "{icase}{tenter=variableScoped}", NULL,
+	                               &CMakeMatcher25);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^function[ \t]*\\(",
-	                               "", "", "{icase}{tenter=function}", NULL);
+	                               "", "", "{icase}{tenter=function}", NULL,
+	                               &CMakeMatcher26);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^macro[ \t]*\\(",
-	                               "", "", "{icase}{tenter=macro}", NULL);
+	                               "", "", "{icase}{tenter=macro}", NULL,
+	                               &CMakeMatcher27);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^endfunction[ \t]*\\([^)]*\\)",
-	                               "", "", "{icase}{tleave}{scope=pop}", NULL);
+	                               "", "", "{icase}{tleave}{scope=pop}", NULL,
+	                               &CMakeMatcher28);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^add_(custom_target|executable|library)[ \t]*\\(",
-	                               "", "", "{icase}{tenter=target}", NULL);
+	                               "", "", "{icase}{tenter=target}", NULL,
+	                               &CMakeMatcher29);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^option[ \t]*\\(",
-	                               "", "", "{icase}{tenter=option}", NULL);
+	                               "", "", "{icase}{tenter=option}", NULL,
+	                               &CMakeMatcher30);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^[^ \t\n]+[ \t\n]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher8);
 	addLanguageTagMultiTableRegex (language, "inFunction",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &CMakeMatcher9);
 	addLanguageTagMultiTableRegex (language, "inVariable",
 	                               "^[^\")]+((\"(\\\\\"|[^\"])*\")([^\")]+(\"(\\\\\"|[^\"])*\"))*)[ \t\n]PARENT_SCOPE[# \t\n)]",
-	                               "", "", "{tjump=variable}{_advanceTo=0start}", NULL);
+	                               "", "", "{tjump=variable}{_advanceTo=0start}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "inVariable",
 	                               "^([A-Za-z0-9_.-]+)[ \t\n\\)]+",
-	                               "\\1", "v", "{tleave}{scope=ref}", NULL);
+	                               "\\1", "v", "{tleave}{scope=ref}", NULL,
+	                               &CMakeMatcher31);
 	addLanguageTagMultiTableRegex (language, "inVariable",
 	                               "^([A-Za-z0-9_.-]+)(#)",
-	                               "\\1", "v", "{tleave}{scope=ref}{_advanceTo=2start}", NULL);
+	                               "\\1", "v", "{tleave}{scope=ref}{_advanceTo=2start}", NULL,
+	                               &CMakeMatcher32);
 }
 
 extern parserDefinition* CMakeParser (void)
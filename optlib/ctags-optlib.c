@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/ctags-optlib.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/ctags-optlib.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,8 +8,185 @@
 #include "xtag.h"
 
 
-static void initializeCtagsParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char CtagsSet0 [32] = {
+	0xff, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CtagsSet1 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CtagsSet2 [32] = {
+	0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char CtagsSet3 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchCtags0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'g')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CtagsSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p != end && *p != '\n')
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CtagsMatcher0 = {
+	matchCtags0, 1, true, false,
+};
+
+static bool matchCtags1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != 'k')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CtagsSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (CtagsSet2, *p))
+			goto next;
+		p++;
+		if (p == end || *p != ',')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (CtagsSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != ',')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (CtagsSet2, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher CtagsMatcher1 = {
+	matchCtags1, 1, true, false,
+};
+
+static void initializeCtagsParser (const langType language)
 {
+
+
 }
 
 extern parserDefinition* CtagsParser (void)
@@ -37,11 +214,11 @@ extern parserDefinition* CtagsParser (void)
 	};
 	static tagRegexTable CtagsTagRegexTable [] = {
 		{"^--langdef=([^ \t]+)$", "\\1",
-		"l", "{scope=set}", NULL, false},
+		"l", "{scope=set}", NULL, false, &CtagsMatcher0},
 		{"^--regex-[^=]+=.*/.,(.+)/.*", "\\1",
-		"k", "{scope=ref}", NULL, false},
+		"k", "{scope=ref}", NULL, false, NULL},
 		{"^--kinddef-[^=]+=.,([^,]+),.*", "\\1",
-		"k", "{scope=ref}", NULL, false},
+		"k", "{scope=ref}", NULL, false, &CtagsMatcher1},
 	};
 
 
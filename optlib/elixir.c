@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/elixir.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/elixir.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,8 +8,820 @@
 #include "xtag.h"
 
 
-static void initializeElixirParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char ElixirSet0 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x80, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char ElixirSet1 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xff, 0x83,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char ElixirSet2 [32] = {
+	0x00, 0x02, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char ElixirSet3 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchElixir0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (ElixirSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher0 = {
+	matchElixir0, 1, true, false,
+};
+
+static bool matchElixir1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (ElixirSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher1 = {
+	matchElixir1, 1, true, false,
+};
+
+static bool matchElixir2 (const char *input, size_t size, regexSpan *groups)
 {
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [1].start = p - s;
+		if (end - p >= 1
+		    && p [0] == '@')
+			p += 1;
+		else if (end - p >= 3
+		    && p [0] == 'd'
+		    && p [1] == 'e'
+		    && p [2] == 'f')
+			p += 3;
+		else
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'b')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'k')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [2].start = p - s;
+		if (p == end || !REGEX_SET_HAS (ElixirSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher2 = {
+	matchElixir2, 2, true, false,
+};
+
+static bool matchElixir3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'g')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (ElixirSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher3 = {
+	matchElixir3, 1, true, false,
+};
+
+static bool matchElixir4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'x')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher4 = {
+	matchElixir4, 0, true, false,
+};
+
+static bool matchElixir5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'g')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher5 = {
+	matchElixir5, 1, true, false,
+};
+
+static bool matchElixir6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'g')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher6 = {
+	matchElixir6, 1, true, false,
+};
+
+static bool matchElixir7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'R')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ElixirSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ElixirSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		q = p;
+		while (p < end && p - q < 1 && *p == ')')
+			p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher7 = {
+	matchElixir7, 2, true, false,
+};
+
+static bool matchElixir8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'R')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ElixirSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ElixirSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [2].start = p - s;
+		q = p;
+		while (p < end && p - q < 1 && *p == ')')
+			p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher8 = {
+	matchElixir8, 2, true, false,
+};
+
+static bool matchElixir9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (end - p >= 4
+		    && p [0] == 't'
+		    && p [1] == 'y'
+		    && p [2] == 'p'
+		    && p [3] == 'e')
+			p += 4;
+		else if (end - p >= 6
+		    && p [0] == 'o'
+		    && p [1] == 'p'
+		    && p [2] == 'a'
+		    && p [3] == 'q'
+		    && p [4] == 'u'
+		    && p [5] == 'e')
+			p += 6;
+		else
+			goto next;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [2].start = p - s;
+		if (p == end || !REGEX_SET_HAS (ElixirSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher9 = {
+	matchElixir9, 2, true, false,
+};
+
+static bool matchElixir10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'y')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (ElixirSet0, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ElixirSet1, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ElixirMatcher10 = {
+	matchElixir10, 1, true, false,
+};
+
+static void initializeElixirParser (const langType language)
+{
+
+
 }
 
 extern parserDefinition* ElixirParser (void)
@@ -71,21 +883,21 @@ extern parserDefinition* ElixirParser (void)
 	};
 	static tagRegexTable ElixirTagRegexTable [] = {
 		{"^[ \t]*defprotocol[ \t]+([A-Z][a-zA-Z0-9_]*\\.)*([A-Z][a-zA-Z0-9_?!]*)", "\\2",
-		"p", "{scope=set}", NULL, false},
+		"p", "{scope=set}", NULL, false, NULL},
 		{"^[ \t]*defmodule[ \t]+([A-Z][a-zA-Z0-9_]*\\.)*([A-Z][a-zA-Z0-9_?!]*)", "\\2",
-		"m", "{scope=set}", NULL, false},
+		"m", "{scope=set}", NULL, false, NULL},
 		{"^[ \t]*def((p?)|macro(p?))[ \t]+([a-zA-Z0-9_?!]+)[ \t]+([\\|\\^/&<>~.=!*+-]{1,3}|and|or|in|(not( +in)?)|when)[ \t]+[a-zA-Z0-9_?!]", "\\5",
-		"o", "{scope=ref}{exclusive}", NULL, false},
+		"o", "{scope=ref}{exclusive}", NULL, false, NULL},
 		{"^[ \t]*def[ \t]+([a-z_][a-zA-Z0-9_?!]*)", "\\1",
-		"f", "{scope=ref}{{. (public) access:}}", NULL, false},
+		"f", "{scope=ref}{{. (public) access:}}", NULL, false, &ElixirMatcher0},
 		{"^[ \t]*defp[ \t]+([a-z_][a-zA-Z0-9_?!]*)", "\\1",
-		"f", "{scope=ref}{{. (private) access:}}", NULL, false},
+		"f", "{scope=ref}{{. (private) access:}}", NULL, false, &ElixirMatcher1},
 		{"^[ \t]*(@|def)callback[ \t]+([a-z_][a-zA-Z0-9_?!]*)", "\\2",
-		"c", "{scope=ref}", NULL, false},
+		"c", "{scope=ref}", NULL, false, &ElixirMatcher2},
 		{"^[ \t]*defdelegate[ \t]+([a-z_][a-zA-Z0-9_?!]*)", "\\1",
-		"d", "{scope=ref}", NULL, false},
+		"d", "{scope=ref}", NULL, false, &ElixirMatcher3},
 		{"^[ \t]*defexception[ \t]+([A-Z][a-zA-Z0-9_]*\\.)*([A-Z][a-zA-Z0-9_?!]*)", "\\2",
-		"e", "{scope=ref}{exclusive}", NULL, false},
+		"e", "{scope=ref}{exclusive}", NULL, false, NULL},
 		{"^[ \t]*defexception[ \t]+", "",
 		"", "{exclusive}"
 		"{{\n"
@@ -95,27 +907,27 @@ extern parserDefinition* ElixirParser (void)
 		"            :name /exception _tag _commit exch scope:\n"
 		"        } if\n"
 		"    } if\n"
-		"}}", NULL, false},
+		"}}", NULL, false, &ElixirMatcher4},
 		{"^[ \t]*defguard[ \t]+(is_[a-zA-Z0-9_?!]+)", "\\1",
-		"g", "{scope=ref}{{. (public) access:}}", NULL, false},
+		"g", "{scope=ref}{{. (public) access:}}", NULL, false, &ElixirMatcher5},
 		{"^[ \t]*defguardp[ \t]+(is_[a-zA-Z0-9_?!]+)", "\\1",
-		"g", "{scope=ref}{{. (private) access:}}", NULL, false},
+		"g", "{scope=ref}{{. (private) access:}}", NULL, false, &ElixirMatcher6},
 		{"^[ \t]*defimpl[ \t]+([A-Z][a-zA-Z0-9_]*\\.)*([A-Z][a-zA-Z0-9_?!]*)", "\\2",
-		"i", "{scope=ref}", NULL, false},
+		"i", "{scope=ref}", NULL, false, NULL},
 		{"^[ \t]*defmacro[ \t]+([a-z_][a-zA-Z0-9_?!]*)(.[^\\|\\^/&<>~.=!*+-]+)", "\\1",
-		"a", "{scope=ref}{{. (public) access:}}", NULL, false},
+		"a", "{scope=ref}{{. (public) access:}}", NULL, false, NULL},
 		{"^[ \t]*defmacrop[ \t]+([a-z_][a-zA-Z0-9_?!]*)(.[^\\|\\^/&<>~.=!*+-]+)", "\\1",
-		"a", "{scope=ref}{{. (private) access:}}", NULL, false},
+		"a", "{scope=ref}{{. (private) access:}}", NULL, false, NULL},
 		{"^[ \t]*Record\\.defrecord[ \t(]+:([a-zA-Z0-9_]+)(\\)?)", "\\1",
-		"r", "{scope=ref}{{. (public) access:}}", NULL, false},
+		"r", "{scope=ref}{{. (public) access:}}", NULL, false, &ElixirMatcher7},
 		{"^[ \t]*Record\\.defrecordp[ \t(]+:([a-zA-Z0-9_]+)(\\)?)", "\\1",
-		"r", "{scope=ref}{{. (private) access:}}", NULL, false},
+		"r", "{scope=ref}{{. (private) access:}}", NULL, false, &ElixirMatcher8},
 		{"^[ \t]*test[ \t(]+\"([a-z_][a-zA-Z0-9_?! ]*)\"*(\\)?)[ \t]*do", "\\1",
-		"t", "{scope=ref}", NULL, false},
+		"t", "{scope=ref}", NULL, false, NULL},
 		{"^[ \t]*@(type|opaque)[ \t]+([a-z_][a-zA-Z0-9_?!]*)", "\\2",
-		"y", "{scope=ref}{{. (public) access:}}", NULL, false},
+		"y", "{scope=ref}{{. (public) access:}}", NULL, false, &ElixirMatcher9},
 		{"^[ \t]*@typep[ \t]+([a-z_][a-zA-Z0-9_?!]*)", "\\1",
-		"y", "{scope=ref}{{. (private) access:}}", NULL, false},
+		"y", "{scope=ref}{{. (private) access:}}", NULL, false, &ElixirMatcher10},
 	};
 
 
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/forth.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/forth.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -9,8 +9,245 @@
 #include "selectors.h"
 
 
-static void initializeForthParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char ForthSet0 [32] = {
+	0x00, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char ForthSet1 [32] = {
+	0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char ForthSet2 [32] = {
+	0xff, 0xc1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char ForthSet3 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchForth0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (ForthSet0, *p))
+			p++;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ForthSet1, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ForthMatcher0 = {
+	matchForth0, 0, true, false,
+};
+
+static bool matchForth1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ForthMatcher1 = {
+	matchForth1, 1, true, false,
+};
+
+static bool matchForth2 (const char *input, size_t size, regexSpan *groups)
 {
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != 'V' && *p != 'v'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'R' && *p != 'r'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'I' && *p != 'i'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'B' && *p != 'b'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'L' && *p != 'l'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'E' && *p != 'e'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ForthMatcher2 = {
+	matchForth2, 1, true, true,
+};
+
+static bool matchForth3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || (*p != 'C' && *p != 'c'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'O' && *p != 'o'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'A' && *p != 'a'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'N' && *p != 'n'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ForthSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ForthMatcher3 = {
+	matchForth3, 1, true, true,
+};
+
+static void initializeForthParser (const langType language)
+{
+
+
 }
 
 extern parserDefinition* ForthParser (void)
@@ -45,13 +282,13 @@ extern parserDefinition* ForthParser (void)
 	};
 	static tagRegexTable ForthTagRegexTable [] = {
 		{"^[[:space:]]*\\\\.*", "",
-		"", "{exclusive}", NULL, false},
+		"", "{exclusive}", NULL, false, &ForthMatcher0},
 		{"^:[[:space:]]+([^[:space:]]+)", "\\1",
-		"w", "{exclusive}", NULL, false},
+		"w", "{exclusive}", NULL, false, &ForthMatcher1},
 		{"^variable[[:space:]]+([^[:space:]]+)", "\\1",
-		"v", "{exclusive}{icase}", NULL, false},
+		"v", "{exclusive}{icase}", NULL, false, &ForthMatcher2},
 		{"^[[:alnum:]]+[[:space:]]+constant[[:space:]]+([^[:space:]]+)", "\\1",
-		"c", "{exclusive}{icase}", NULL, false},
+		"c", "{exclusive}{icase}", NULL, false, &ForthMatcher3},
 	};
 
 	static selectLanguage selectors[] = { selectFortranOrForthByForthMarker, NULL };
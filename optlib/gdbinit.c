@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/gdbinit.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/gdbinit.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,8 +8,305 @@
 #include "xtag.h"
 
 
-static void initializeGdbinitParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char GdbinitSet0 [32] = {
+	0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char GdbinitSet1 [32] = {
+	0x00, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char GdbinitSet2 [32] = {
+	0xff, 0xc1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char GdbinitSet3 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchGdbinit0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (GdbinitSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GdbinitMatcher0 = {
+	matchGdbinit0, 0, true, false,
+};
+
+static bool matchGdbinit1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p != end && *p != '\n')
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GdbinitMatcher1 = {
+	matchGdbinit1, 1, true, false,
+};
+
+static bool matchGdbinit2 (const char *input, size_t size, regexSpan *groups)
 {
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p != end && *p != '\n')
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GdbinitMatcher2 = {
+	matchGdbinit2, 1, true, false,
+};
+
+static bool matchGdbinit3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GdbinitMatcher3 = {
+	matchGdbinit3, 1, true, false,
+};
+
+static bool matchGdbinit4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GdbinitSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (GdbinitSet1, *p))
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GdbinitMatcher4 = {
+	matchGdbinit4, 1, true, false,
+};
+
+static void initializeGdbinitParser (const langType language)
+{
+
+
 }
 
 extern parserDefinition* GdbinitParser (void)
@@ -44,15 +341,15 @@ extern parserDefinition* GdbinitParser (void)
 	};
 	static tagRegexTable GdbinitTagRegexTable [] = {
 		{"^#.*", "",
-		"", "{exclusive}", NULL, false},
+		"", "{exclusive}", NULL, false, &GdbinitMatcher0},
 		{"^define[[:space:]]+([^[:space:]]+)$", "\\1",
-		"d", NULL, NULL, false},
+		"d", NULL, NULL, false, &GdbinitMatcher1},
 		{"^document[[:space:]]+([^[:space:]]+)$", "\\1",
-		"D", NULL, NULL, false},
+		"D", NULL, NULL, false, &GdbinitMatcher2},
 		{"^set[[:space:]]+\\$([a-zA-Z0-9_]+)[[:space:]]*=", "\\1",
-		"t", NULL, NULL, false},
+		"t", NULL, NULL, false, &GdbinitMatcher3},
 		{"^[[:space:]]+set[[:space:]]+\\$([a-zA-Z0-9_]+)[[:space:]]*=", "\\1",
-		"l", NULL, NULL, false},
+		"l", NULL, NULL, false, &GdbinitMatcher4},
 	};
 
 
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/gperf.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/gperf.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,664 @@
 #include "xtag.h"
 
 
+static const unsigned char GPerfSet0 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char GPerfSet1 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char GPerfSet2 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char GPerfSet3 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchGPerf0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher0 = {
+	matchGPerf0, 0, false, false,
+};
+
+static bool matchGPerf1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher1 = {
+	matchGPerf1, 0, false, false,
+};
+
+static bool matchGPerf2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || (*p != '\t' && *p != ' '))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher2 = {
+	matchGPerf2, 0, false, false,
+};
+
+static bool matchGPerf3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher3 = {
+	matchGPerf3, 0, false, false,
+};
+
+static bool matchGPerf4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (GPerfSet0, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher4 = {
+	matchGPerf4, 0, false, false,
+};
+
+static bool matchGPerf5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GPerfSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher5 = {
+	matchGPerf5, 0, false, false,
+};
+
+static bool matchGPerf6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher6 = {
+	matchGPerf6, 0, false, false,
+};
+
+static bool matchGPerf7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (GPerfSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher7 = {
+	matchGPerf7, 0, false, false,
+};
+
+static bool matchGPerf8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GPerfSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher8 = {
+	matchGPerf8, 0, false, false,
+};
+
+static bool matchGPerf9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher9 = {
+	matchGPerf9, 0, false, false,
+};
+
+static bool matchGPerf10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (GPerfSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher10 = {
+	matchGPerf10, 0, false, false,
+};
+
+static bool matchGPerf11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher11 = {
+	matchGPerf11, 0, false, false,
+};
+
+static bool matchGPerf12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (GPerfSet0, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher12 = {
+	matchGPerf12, 0, false, false,
+};
+
+static bool matchGPerf13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (GPerfSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher13 = {
+	matchGPerf13, 0, false, false,
+};
+
+static bool matchGPerf14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher14 = {
+	matchGPerf14, 0, false, false,
+};
+
+static bool matchGPerf15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher15 = {
+	matchGPerf15, 0, false, false,
+};
+
+static bool matchGPerf16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ';')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher16 = {
+	matchGPerf16, 0, false, false,
+};
+
+static bool matchGPerf17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher17 = {
+	matchGPerf17, 0, false, false,
+};
+
+static bool matchGPerf18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (GPerfSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher18 = {
+	matchGPerf18, 0, false, false,
+};
+
+static bool matchGPerf19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher19 = {
+	matchGPerf19, 0, false, false,
+};
+
+static bool matchGPerf20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher20 = {
+	matchGPerf20, 0, false, false,
+};
+
+static bool matchGPerf21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher21 = {
+	matchGPerf21, 0, false, false,
+};
+
+static bool matchGPerf22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (GPerfSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher GPerfMatcher22 = {
+	matchGPerf22, 0, false, false,
+};
+
 static void initializeGPerfParser (const langType language)
 {
 
@@ -22,16 +680,20 @@ static void initializeGPerfParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &GPerfMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%\\{",
-	                               "", "", "{tjump=codeinc}{_guest=C,0end,}", NULL);
+	                               "", "", "{tjump=codeinc}{_guest=C,0end,}", NULL,
+	                               &GPerfMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^struct[ \t]",
-	                               "", "", "{_guest=C,0start,}{tenter=struct}", NULL);
+	                               "", "", "{_guest=C,0start,}{tenter=struct}", NULL,
+	                               &GPerfMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%%",
-	                               "", "", "{tjump=keywordsec}", NULL);
+	                               "", "", "{tjump=keywordsec}", NULL,
+	                               &GPerfMatcher3);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%define[ \t]+(hash-function-name|lookup-function-name|class-name|string-pool-name)[ \t]+([_a-zA-Z:][_a-zA-Z:0-9]*)[^\n]*\n",
 	                               "", "", ""
@@ -43,46 +705,60 @@ static void initializeGPerfParser (const langType language)
 		"     (string-pool-name)     /strpool >> \\1 get\n"
 		"  @2\n"
 		"  _tag _commit pop\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^\n]*\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher4);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[^*]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher5);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &GPerfMatcher6);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher7);
 	addLanguageTagMultiTableRegex (language, "codeinc",
 	                               "^[^%]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher8);
 	addLanguageTagMultiTableRegex (language, "codeinc",
 	                               "^%\\}",
-	                               "", "", "{tjump=structdec}{_guest=,,0start}", NULL);
+	                               "", "", "{tjump=structdec}{_guest=,,0start}", NULL,
+	                               &GPerfMatcher9);
 	addLanguageTagMultiTableRegex (language, "codeinc",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher10);
 	addLanguageTagMultiTableRegex (language, "keywordsec",
 	                               "^%%",
-	                               "", "", "{tjump=functions}{_guest=C,0end,}", NULL);
+	                               "", "", "{tjump=functions}{_guest=C,0end,}", NULL,
+	                               &GPerfMatcher11);
 	addLanguageTagMultiTableRegex (language, "keywordsec",
 	                               "^([^\n,]+)[^\n]*\n?",
-	                               "\\1", "k", "", NULL);
+	                               "\\1", "k", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "keywordsec",
 	                               "^[^\n]*\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher12);
 	addLanguageTagMultiTableRegex (language, "functions",
 	                               "^.+",
-	                               "", "", "{_guest=,,0end}", NULL);
+	                               "", "", "{_guest=,,0end}", NULL,
+	                               &GPerfMatcher13);
 	addLanguageTagMultiTableRegex (language, "structdec",
 	                               "^struct[ \t]",
-	                               "", "", "{_guest=C,0start,}{tenter=struct}", NULL);
+	                               "", "", "{_guest=C,0start,}{tenter=struct}", NULL,
+	                               &GPerfMatcher2);
 	addLanguageTagMultiTableRegex (language, "structdec",
 	                               "^%%",
-	                               "", "", "{tjump=keywordsec}", NULL);
+	                               "", "", "{tjump=keywordsec}", NULL,
+	                               &GPerfMatcher3);
 	addLanguageTagMultiTableRegex (language, "structdec",
 	                               "^%define[ \t]+(hash-function-name|lookup-function-name|class-name|string-pool-name)[ \t]+([_a-zA-Z:][_a-zA-Z:0-9]*)[^\n]*\n",
 	                               "", "", ""
@@ -94,37 +770,48 @@ static void initializeGPerfParser (const langType language)
 		"     (string-pool-name)     /strpool >> \\1 get\n"
 		"  @2\n"
 		"  _tag _commit pop\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "structdec",
 	                               "^[^\n]*\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher4);
 	addLanguageTagMultiTableRegex (language, "struct",
 	                               "^\\{",
-	                               "", "", "{tenter=structbody}", NULL);
+	                               "", "", "{tenter=structbody}", NULL,
+	                               &GPerfMatcher14);
 	addLanguageTagMultiTableRegex (language, "struct",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &GPerfMatcher15);
 	addLanguageTagMultiTableRegex (language, "struct",
 	                               "^;",
-	                               "", "", "{tleave}{_guest=,,0end}", NULL);
+	                               "", "", "{tleave}{_guest=,,0end}", NULL,
+	                               &GPerfMatcher16);
 	addLanguageTagMultiTableRegex (language, "struct",
 	                               "^%",
-	                               "", "", "{tleave}{_guest=,,0end}{_advanceTo=0start}", NULL);
+	                               "", "", "{tleave}{_guest=,,0end}{_advanceTo=0start}", NULL,
+	                               &GPerfMatcher17);
 	addLanguageTagMultiTableRegex (language, "struct",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher18);
 	addLanguageTagMultiTableRegex (language, "structbody",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &GPerfMatcher19);
 	addLanguageTagMultiTableRegex (language, "structbody",
 	                               "^\\{",
-	                               "", "", "{tenter=structbody}", NULL);
+	                               "", "", "{tenter=structbody}", NULL,
+	                               &GPerfMatcher20);
 	addLanguageTagMultiTableRegex (language, "structbody",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &GPerfMatcher21);
 	addLanguageTagMultiTableRegex (language, "structbody",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &GPerfMatcher22);
 }
 
 extern parserDefinition* GPerfParser (void)
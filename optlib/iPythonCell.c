@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/iPythonCell.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/iPythonCell.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -9,8 +9,10 @@
 #include "subparser.h"
 
 
-static void initializeIPythonCellParser (const langType language CTAGS_ATTR_UNUSED)
+static void initializeIPythonCellParser (const langType language)
 {
+
+
 }
 
 extern parserDefinition* IPythonCellParser (void)
@@ -41,9 +43,9 @@ extern parserDefinition* IPythonCellParser (void)
 	};
 	static tagRegexTable IPythonCellTagRegexTable [] = {
 		{"^[ \t]*(# ?%%|# <codecell>)[ \t]*(.*[^ \t])$", "\\2",
-		"c", "{exclusive}", NULL, false},
+		"c", "{exclusive}", NULL, false, NULL},
 		{"^[ \t]*##[ \t]*(.*[^ \t])$", "\\1",
-		"c", "{_extra=doubleSharps}{exclusive}", NULL, false},
+		"c", "{_extra=doubleSharps}{exclusive}", NULL, false, NULL},
 	};
 
 	static subparser IPythonCellSubparser = {
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/inko.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/inko.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,940 @@
 #include "xtag.h"
 
 
+static const unsigned char InkoSet0 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char InkoSet1 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char InkoSet2 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x07, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchInko0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher0 = {
+	matchInko0, 0, false, false,
+};
+
+static bool matchInko1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher1 = {
+	matchInko1, 0, false, false,
+};
+
+static bool matchInko2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '`')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher2 = {
+	matchInko2, 0, false, false,
+};
+
+static bool matchInko3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher3 = {
+	matchInko3, 0, false, false,
+};
+
+static bool matchInko4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher4 = {
+	matchInko4, 0, false, false,
+};
+
+static bool matchInko5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher5 = {
+	matchInko5, 0, false, false,
+};
+
+static bool matchInko6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher6 = {
+	matchInko6, 0, false, false,
+};
+
+static bool matchInko7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher7 = {
+	matchInko7, 0, false, false,
+};
+
+static bool matchInko8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher8 = {
+	matchInko8, 0, false, false,
+};
+
+static bool matchInko9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher9 = {
+	matchInko9, 0, false, false,
+};
+
+static bool matchInko10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher10 = {
+	matchInko10, 0, false, false,
+};
+
+static bool matchInko11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (InkoSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher11 = {
+	matchInko11, 1, false, false,
+};
+
+static bool matchInko12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher12 = {
+	matchInko12, 0, false, false,
+};
+
+static bool matchInko13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher13 = {
+	matchInko13, 0, false, false,
+};
+
+static bool matchInko14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher14 = {
+	matchInko14, 0, false, false,
+};
+
+static bool matchInko15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher15 = {
+	matchInko15, 0, false, false,
+};
+
+static bool matchInko16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher16 = {
+	matchInko16, 0, false, false,
+};
+
+static bool matchInko17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher17 = {
+	matchInko17, 0, false, false,
+};
+
+static bool matchInko18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher18 = {
+	matchInko18, 0, false, false,
+};
+
+static bool matchInko19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher19 = {
+	matchInko19, 0, false, false,
+};
+
+static bool matchInko20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher20 = {
+	matchInko20, 0, false, false,
+};
+
+static bool matchInko21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher21 = {
+	matchInko21, 0, false, false,
+};
+
+static bool matchInko22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (InkoSet2, *p))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (InkoSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher22 = {
+	matchInko22, 1, false, false,
+};
+
+static bool matchInko23 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher23 = {
+	matchInko23, 0, false, false,
+};
+
+static bool matchInko24 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher24 = {
+	matchInko24, 0, false, false,
+};
+
+static bool matchInko25 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher25 = {
+	matchInko25, 0, false, false,
+};
+
+static bool matchInko26 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher26 = {
+	matchInko26, 0, false, false,
+};
+
+static bool matchInko27 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher27 = {
+	matchInko27, 0, false, false,
+};
+
+static bool matchInko28 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher28 = {
+	matchInko28, 0, false, false,
+};
+
+static bool matchInko29 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '`')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher29 = {
+	matchInko29, 0, false, false,
+};
+
+static bool matchInko30 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || *p != '`')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher30 = {
+	matchInko30, 0, false, false,
+};
+
+static bool matchInko31 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (InkoSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher InkoMatcher31 = {
+	matchInko31, 0, false, false,
+};
+
 static void initializeInkoParser (const langType language)
 {
 
@@ -24,118 +958,156 @@ static void initializeInkoParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^'",
-	                               "", "", "{tenter=sstring}", NULL);
+	                               "", "", "{tenter=sstring}", NULL,
+	                               &InkoMatcher0);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^\"",
-	                               "", "", "{tenter=dstring}", NULL);
+	                               "", "", "{tenter=dstring}", NULL,
+	                               &InkoMatcher1);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^`",
-	                               "", "", "{tenter=tstring}", NULL);
+	                               "", "", "{tenter=tstring}", NULL,
+	                               &InkoMatcher2);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &InkoMatcher3);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[[:blank:]]*class[[:blank:]]+",
-	                               "", "", "{tenter=class}", NULL);
+	                               "", "", "{tenter=class}", NULL,
+	                               &InkoMatcher4);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[[:blank:]]*trait[[:blank:]]+",
-	                               "", "", "{tenter=trait}", NULL);
+	                               "", "", "{tenter=trait}", NULL,
+	                               &InkoMatcher5);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[[:blank:]]*def[[:blank:]]+",
-	                               "", "", "{tenter=method}", NULL);
+	                               "", "", "{tenter=method}", NULL,
+	                               &InkoMatcher6);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[[:blank:]]*impl[[:blank:]]+",
-	                               "", "", "{tenter=impl}", NULL);
+	                               "", "", "{tenter=impl}", NULL,
+	                               &InkoMatcher7);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[[:blank:]]*let[[:blank:]]+",
-	                               "", "", "{tenter=let}", NULL);
+	                               "", "", "{tenter=let}", NULL,
+	                               &InkoMatcher8);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^\\{",
-	                               "", "", "{placeholder}{scope=push}", NULL);
+	                               "", "", "{placeholder}{scope=push}", NULL,
+	                               &InkoMatcher9);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^\\}",
-	                               "", "", "{scope=pop}", NULL);
+	                               "", "", "{scope=pop}", NULL,
+	                               &InkoMatcher10);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^(@[a-zA-Z0-9_]+):",
-	                               "\\1", "a", "{scope=ref}", NULL);
+	                               "\\1", "a", "{scope=ref}", NULL,
+	                               &InkoMatcher11);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher12);
 	addLanguageTagMultiTableRegex (language, "class",
 	                               "^([A-Z][a-zA-Z0-9_?]*)[^{]*",
-	                               "\\1", "o", "{scope=push}", NULL);
+	                               "\\1", "o", "{scope=push}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "class",
 	                               "^\\{",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher13);
 	addLanguageTagMultiTableRegex (language, "class",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher14);
 	addLanguageTagMultiTableRegex (language, "trait",
 	                               "^([A-Z][a-zA-Z0-9_?]*)[^{]*",
-	                               "\\1", "t", "{scope=push}", NULL);
+	                               "\\1", "t", "{scope=push}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "trait",
 	                               "^\\{",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher15);
 	addLanguageTagMultiTableRegex (language, "trait",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher16);
 	addLanguageTagMultiTableRegex (language, "method",
 	                               "^([a-zA-Z0-9_?]+|\\[\\]=?|\\^|&|\\||\\*|\\+|\\-|/|>>|<<|%)",
-	                               "\\1", "m", "{scope=push}", NULL);
+	                               "\\1", "m", "{scope=push}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "method",
 	                               "^\\{|\n",
-	                               "", "", "{scope=pop}{tleave}", NULL);
+	                               "", "", "{scope=pop}{tleave}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "method",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher17);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher18);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher19);
 	addLanguageTagMultiTableRegex (language, "impl",
 	                               "^([A-Z][a-zA-Z0-9_?]*)[[:blank:]]+for[[:blank:]]+([A-Z][a-zA-Z0-9_?]*)[^{]*",
-	                               "\\2", "r", "{scope=push}{_field=implements:\\1}", NULL);
+	                               "\\2", "r", "{scope=push}{_field=implements:\\1}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "impl",
 	                               "^([A-Z][a-zA-Z0-9_?]*)[^{]*",
-	                               "\\1", "r", "{scope=push}", NULL);
+	                               "\\1", "r", "{scope=push}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "impl",
 	                               "^\\{",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher20);
 	addLanguageTagMultiTableRegex (language, "impl",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher21);
 	addLanguageTagMultiTableRegex (language, "let",
 	                               "^([A-Z][a-zA-Z0-9_]+)",
-	                               "\\1", "c", "{scope=ref}{tleave}", NULL);
+	                               "\\1", "c", "{scope=ref}{tleave}", NULL,
+	                               &InkoMatcher22);
 	addLanguageTagMultiTableRegex (language, "sstring",
 	                               "^'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher23);
 	addLanguageTagMultiTableRegex (language, "sstring",
 	                               "^\\\\'",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher24);
 	addLanguageTagMultiTableRegex (language, "sstring",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher25);
 	addLanguageTagMultiTableRegex (language, "dstring",
 	                               "^\"",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher26);
 	addLanguageTagMultiTableRegex (language, "dstring",
 	                               "^\\\\\"",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher27);
 	addLanguageTagMultiTableRegex (language, "dstring",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher28);
 	addLanguageTagMultiTableRegex (language, "tstring",
 	                               "^`",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &InkoMatcher29);
 	addLanguageTagMultiTableRegex (language, "tstring",
 	                               "^\\\\`",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher30);
 	addLanguageTagMultiTableRegex (language, "tstring",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &InkoMatcher31);
 }
 
 extern parserDefinition* InkoParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/kconfig.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/kconfig.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,456 @@
 #include "xtag.h"
 
 
+static const unsigned char KconfigSet0 [32] = {
+	0xfe, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char KconfigSet1 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char KconfigSet2 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char KconfigSet3 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x10, 0x20, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchKconfig0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (KconfigSet0, *p))
+			p++;
+		if (p != end && *p != '\n')
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher0 = {
+	matchKconfig0, 0, true, false,
+};
+
+static bool matchKconfig1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (KconfigSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher1 = {
+	matchKconfig1, 1, true, false,
+};
+
+static bool matchKconfig2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher2 = {
+	matchKconfig2, 0, true, false,
+};
+
+static bool matchKconfig3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'h')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (KconfigSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher3 = {
+	matchKconfig3, 1, true, false,
+};
+
+static bool matchKconfig4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'h')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p != end && *p != '\n')
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher4 = {
+	matchKconfig4, 0, true, false,
+};
+
+static bool matchKconfig5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'h')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher5 = {
+	matchKconfig5, 0, true, false,
+};
+
+static bool matchKconfig6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (KconfigSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher6 = {
+	matchKconfig6, 1, true, false,
+};
+
+static bool matchKconfig7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (KconfigSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == ':')
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher KconfigMatcher7 = {
+	matchKconfig7, 1, true, false,
+};
+
 typedef enum {
 	K_CONFIG,
 	K_MENU,
@@ -18,8 +468,10 @@ typedef enum {
 } KconfigKind;
 
 
-static void initializeKconfigParser (const langType language CTAGS_ATTR_UNUSED)
+static void initializeKconfigParser (const langType language)
 {
+
+
 }
 
 extern parserDefinition* KconfigParser (void)
@@ -70,29 +522,29 @@ extern parserDefinition* KconfigParser (void)
 	};
 	static tagRegexTable KconfigTagRegexTable [] = {
 		{"^[ \t]*#.*$", "",
-		"", "{placeholder}", NULL, false},
+		"", "{placeholder}", NULL, false, &KconfigMatcher0},
 		{"^[ \t]*(menu)?config[ \t]+([A-Za-z0-9_]+)[ \t]*$", "\\2",
-		"c", "{scope=ref}", NULL, false},
+		"c", "{scope=ref}", NULL, false, NULL},
 		{"^[ \t]*(menu)?config[ \t]+([A-Za-z0-9_]+)[ \t]*$", "CONFIG_\\2",
-		"c", "{scope=ref}{_extra=configPrefixed}", NULL, false},
+		"c", "{scope=ref}{_extra=configPrefixed}", NULL, false, NULL},
 		{"^[ \t]*(menu)?config[ \t]+([A-Za-z0-9_]+)[ \t]*$", "CONFIG_\\2_MODULE",
-		"c", "{scope=ref}{_extra=configPrefixed}{exclusive}", NULL, false},
+		"c", "{scope=ref}{_extra=configPrefixed}{exclusive}", NULL, false, NULL},
 		{"^[ \t]*menu[ \t]+\"([^\"]+)\"[ \t]*", "\\1",
-		"m", "{scope=push}{exclusive}", NULL, false},
+		"m", "{scope=push}{exclusive}", NULL, false, &KconfigMatcher1},
 		{"^[ \t]*endmenu[ \t]*", "",
-		"", "{scope=pop}{placeholder}{exclusive}", NULL, false},
+		"", "{scope=pop}{placeholder}{exclusive}", NULL, false, &KconfigMatcher2},
 		{"^[ \t]*source[ \t]+\"?([^\"]+)\"?[ \t]*", "\\1",
-		"k", "{_role=source}{exclusive}{scope=ref}", NULL, false},
+		"k", "{_role=source}{exclusive}{scope=ref}", NULL, false, NULL},
 		{"^[ \t]*choice[ \t]+([A-Za-z0-9_]+)[ \t]*", "\\1",
-		"C", "{scope=push}{exclusive}", NULL, false},
+		"C", "{scope=push}{exclusive}", NULL, false, &KconfigMatcher3},
 		{"^[ \t]*choice[ \t]*$", "",
-		"C", "{_anonymous=choice}{scope=push}{exclusive}", NULL, false},
+		"C", "{_anonymous=choice}{scope=push}{exclusive}", NULL, false, &KconfigMatcher4},
 		{"^[ \t]*endchoice[ \t]*", "",
-		"", "{scope=pop}{placeholder}{exclusive}", NULL, false},
+		"", "{scope=pop}{placeholder}{exclusive}", NULL, false, &KconfigMatcher5},
 		{"^[ \t]*mainmenu[ \t]+\"([^\"]+)\"[ \t]*", "\\1",
-		"M", "{exclusive}", NULL, false},
+		"M", "{exclusive}", NULL, false, &KconfigMatcher6},
 		{"^([-a-zA-Z0-9_$]+)[ \t]*:?=", "\\1",
-		"v", "{exclusive}", NULL, false},
+		"v", "{exclusive}", NULL, false, &KconfigMatcher7},
 	};
 
 
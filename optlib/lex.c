@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/lex.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/lex.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -9,6 +9,569 @@
 #include "selectors.h"
 
 
+static const unsigned char LEXSet0 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char LEXSet1 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char LEXSet2 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char LEXSet3 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char LEXSet4 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xef,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char LEXSet5 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char LEXSet6 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchLEX0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher0 = {
+	matchLEX0, 0, false, false,
+};
+
+static bool matchLEX1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || (*p != 's' && *p != 'x'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher1 = {
+	matchLEX1, 0, false, false,
+};
+
+static bool matchLEX2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher2 = {
+	matchLEX2, 0, false, false,
+};
+
+static bool matchLEX3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (LEXSet0, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher3 = {
+	matchLEX3, 0, false, false,
+};
+
+static bool matchLEX4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (LEXSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher4 = {
+	matchLEX4, 0, false, false,
+};
+
+static bool matchLEX5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher5 = {
+	matchLEX5, 0, false, false,
+};
+
+static bool matchLEX6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (LEXSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher6 = {
+	matchLEX6, 0, false, false,
+};
+
+static bool matchLEX7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (LEXSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher7 = {
+	matchLEX7, 0, false, false,
+};
+
+static bool matchLEX8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher8 = {
+	matchLEX8, 0, false, false,
+};
+
+static bool matchLEX9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (LEXSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher9 = {
+	matchLEX9, 0, false, false,
+};
+
+static bool matchLEX10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (LEXSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher10 = {
+	matchLEX10, 0, false, false,
+};
+
+static bool matchLEX11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher11 = {
+	matchLEX11, 0, false, false,
+};
+
+static bool matchLEX12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (LEXSet5, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (LEXSet6, *p))
+			p++;
+		groups [1].end = p - s;
+		if (p == end || *p != '>')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher12 = {
+	matchLEX12, 1, false, false,
+};
+
+static bool matchLEX13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (LEXSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher13 = {
+	matchLEX13, 0, false, false,
+};
+
+static bool matchLEX14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (LEXSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher14 = {
+	matchLEX14, 0, false, false,
+};
+
+static bool matchLEX15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (LEXSet5, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (LEXSet6, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher15 = {
+	matchLEX15, 1, false, false,
+};
+
+static bool matchLEX16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher16 = {
+	matchLEX16, 0, false, false,
+};
+
+static bool matchLEX17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (LEXSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher LEXMatcher17 = {
+	matchLEX17, 0, false, false,
+};
+
 static void initializeLEXParser (const langType language)
 {
 
@@ -21,64 +584,84 @@ static void initializeLEXParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &LEXMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%[sx][ \t]+",
-	                               "", "", "{tenter=cond}", NULL);
+	                               "", "", "{tenter=cond}", NULL,
+	                               &LEXMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%(top)?\\{",
-	                               "", "", "{tenter=codeblock}{_guest=C,0end,}", NULL);
+	                               "", "", "{tenter=codeblock}{_guest=C,0end,}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%%",
-	                               "", "", "{tjump=rulesec}", NULL);
+	                               "", "", "{tjump=rulesec}", NULL,
+	                               &LEXMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^([a-zA-Z_][-a-zA-Z0-9_]*)[^\n]+\n",
-	                               "\\1", "r", "", NULL);
+	                               "\\1", "r", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^\n]*\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher3);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[^*]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher4);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &LEXMatcher5);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher6);
 	addLanguageTagMultiTableRegex (language, "codeblock",
 	                               "^[^%]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher7);
 	addLanguageTagMultiTableRegex (language, "codeblock",
 	                               "^%\\}",
-	                               "", "", "{tleave}{_guest=,,0start}", NULL);
+	                               "", "", "{tleave}{_guest=,,0start}", NULL,
+	                               &LEXMatcher8);
 	addLanguageTagMultiTableRegex (language, "codeblock",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher9);
 	addLanguageTagMultiTableRegex (language, "rulesec",
 	                               "^[^%<]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher10);
 	addLanguageTagMultiTableRegex (language, "rulesec",
 	                               "^%%",
-	                               "", "", "{tjump=usercode}{_guest=C,0end,}", NULL);
+	                               "", "", "{tjump=usercode}{_guest=C,0end,}", NULL,
+	                               &LEXMatcher11);
 	addLanguageTagMultiTableRegex (language, "rulesec",
 	                               "^<([_a-zA-Z][_a-zA-Z0-9]*)>[ \t]*\\{[ \t]*\n",
-	                               "\\1", "c", "{_role=grouping}", NULL);
+	                               "\\1", "c", "{_role=grouping}", NULL,
+	                               &LEXMatcher12);
 	addLanguageTagMultiTableRegex (language, "rulesec",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher13);
 	addLanguageTagMultiTableRegex (language, "usercode",
 	                               "^.+",
-	                               "", "", "{_guest=,,0end}", NULL);
+	                               "", "", "{_guest=,,0end}", NULL,
+	                               &LEXMatcher14);
 	addLanguageTagMultiTableRegex (language, "cond",
 	                               "^([_a-zA-Z][_a-zA-Z0-9]*)[ \t]*",
-	                               "\\1", "c", "", NULL);
+	                               "\\1", "c", "", NULL,
+	                               &LEXMatcher15);
 	addLanguageTagMultiTableRegex (language, "cond",
 	                               "^\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &LEXMatcher16);
 	addLanguageTagMultiTableRegex (language, "cond",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &LEXMatcher17);
 }
 
 extern parserDefinition* LEXParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/man.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/man.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,552 @@
 #include "xtag.h"
 
 
+static const unsigned char ManSet0 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char ManSet1 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xe7, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char ManSet2 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char ManSet3 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char ManSet4 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchMan0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (end - p >= 1
+		    && REGEX_SET_HAS (ManSet0, p [0]))
+			p += 1;
+		else if (end - p >= 2
+		    && p [0] == '.'
+		    && REGEX_SET_HAS (ManSet1, p [1]))
+			p += 2;
+		else
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (ManSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher0 = {
+	matchMan0, 1, false, true,
+};
+
+static bool matchMan1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'T' && *p != 't'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'H' && *p != 'h'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ManSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ManSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher1 = {
+	matchMan1, 1, false, true,
+};
+
+static bool matchMan2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'H' && *p != 'h'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ManSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ManSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher2 = {
+	matchMan2, 1, false, true,
+};
+
+static bool matchMan3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'H' && *p != 'h'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher3 = {
+	matchMan3, 0, false, true,
+};
+
+static bool matchMan4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher4 = {
+	matchMan4, 0, false, false,
+};
+
+static bool matchMan5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'H' && *p != 'h'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ManSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ManSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher5 = {
+	matchMan5, 1, false, true,
+};
+
+static bool matchMan6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'H' && *p != 'h'))
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher6 = {
+	matchMan6, 1, false, true,
+};
+
+static bool matchMan7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ManSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ManSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher7 = {
+	matchMan7, 1, false, true,
+};
+
+static bool matchMan8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher8 = {
+	matchMan8, 0, false, true,
+};
+
+static bool matchMan9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (ManSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (ManSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher9 = {
+	matchMan9, 1, false, true,
+};
+
+static bool matchMan10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher10 = {
+	matchMan10, 0, false, true,
+};
+
+static bool matchMan11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		if (p == end || (*p != 'S' && *p != 's'))
+			goto next;
+		p++;
+		if (p == end || (*p != 'H' && *p != 'h'))
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher ManMatcher11 = {
+	matchMan11, 1, false, true,
+};
+
 typedef enum {
 	K_TITLE,
 	K_SECTION,
@@ -95,131 +641,166 @@ static void initializeManParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^([^\n.]|\\.[^\nst])[^\n]*\n",
-	                               "", "", "{icase}", NULL);
+	                               "", "", "{icase}", NULL,
+	                               &ManMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\.TH[\t ]+\"([^\"]+)\"[^\n]*\n",
-	                               "\\1", "t", "{icase}{scope=set}", NULL);
+	                               "\\1", "t", "{icase}{scope=set}", NULL,
+	                               &ManMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\.TH[\t ]+([^\t \n]+)[^\n]*\n",
-	                               "\\1", "t", "{icase}{scope=set}", NULL);
+	                               "\\1", "t", "{icase}{scope=set}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\.SH[\t ]+\"([^\"\n]+)\"[^\n]*\n",
-	                               "\\1", "s", "{icase}{scope=push}{tenter=section}", NULL);
+	                               "\\1", "s", "{icase}{scope=push}{tenter=section}", NULL,
+	                               &ManMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\.SH[\t ]+([^\n]+)\n",
-	                               "\\1", "s", "{icase}{scope=push}{tenter=section}", NULL);
+	                               "\\1", "s", "{icase}{scope=push}{tenter=section}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\.SH[\t ]*\n",
 	                               "", "", "{icase}{tenter=sectionheading}"
 		"{{\n"
 		"    /push\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &ManMatcher3);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^([^\n.]|\\.[^\nst])[^\n]*\n",
-	                               "", "", "{icase}", NULL);
+	                               "", "", "{icase}", NULL,
+	                               &ManMatcher0);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^\\.SH[\t ]+\"([^\"\n]+)\"[^\n]*\n",
-	                               "\\1", "s", "{icase}{scope=replace}", NULL);
+	                               "\\1", "s", "{icase}{scope=replace}", NULL,
+	                               &ManMatcher5);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^\\.SH[\t ]+([^\n]+)\n",
-	                               "\\1", "s", "{icase}{scope=replace}", NULL);
+	                               "\\1", "s", "{icase}{scope=replace}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^(\\.SH)[\t ]*\n",
 	                               "", "", "{icase}{tjump=sectionheading}"
 		"{{\n"
 		"    2 /replace\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &ManMatcher6);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^\\.SS[\t ]+\"([^\"\n]+)\"[^\n]*\n",
-	                               "\\1", "S", "{icase}{scope=push}{tenter=subsection}", NULL);
+	                               "\\1", "S", "{icase}{scope=push}{tenter=subsection}", NULL,
+	                               &ManMatcher7);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^\\.SS[\t ]+([^\n]+)\n",
-	                               "\\1", "S", "{icase}{scope=push}{tenter=subsection}", NULL);
+	                               "\\1", "S", "{icase}{scope=push}{tenter=subsection}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^\\.SS[\t ]*\n",
 	                               "", "", "{icase}{tenter=subsectionheading}"
 		"{{\n"
 		"    /push\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &ManMatcher8);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "section",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "sectionheading",
 	                               "^[ \t]*([^\n]+)\n",
 	                               "\\1", "s", "{tjump=section}"
 		"{{\n"
 		"    heading-action\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "sectionheading",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "sectionheading",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^([^\n.]|\\.[^\nst])[^\n]*\n",
-	                               "", "", "{icase}", NULL);
+	                               "", "", "{icase}", NULL,
+	                               &ManMatcher0);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^\\.SS[\t ]+\"([^\"\n]+)\"[^\n]*\n",
-	                               "\\1", "S", "{icase}{scope=replace}", NULL);
+	                               "\\1", "S", "{icase}{scope=replace}", NULL,
+	                               &ManMatcher9);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^\\.SS[\t ]+([^\n]+)\n",
-	                               "\\1", "S", "{icase}{scope=replace}", NULL);
+	                               "\\1", "S", "{icase}{scope=replace}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^\\.SS[\t ]*\n",
 	                               "", "", "{icase}{tjump=subsectionheading}"
 		"{{\n"
 		"    2 /replace\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &ManMatcher10);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^(\\.SH)",
 	                               "", "", "{icase}{_advanceTo=0start}{tleave}"
 		"{{\n"
 		"    1 fill-end-of-scope\n"
 		"    _scopepop\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &ManMatcher11);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "subsection",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "subsectionheading",
 	                               "^[ \t]*([^\n]+)\n",
 	                               "\\1", "S", "{tjump=subsection}"
 		"{{\n"
 		"    heading-action\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "subsectionheading",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "subsectionheading",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "EOF",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "SKIP",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "REST",
 	                               "^[^\n]*\n|[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "REST",
 	                               "^",
-	                               "", "", "{scope=clear}{tquit}", NULL);
+	                               "", "", "{scope=clear}{tquit}", NULL,
+	                               &ManMatcher4);
 	addLanguageTagMultiTableRegex (language, "GUARD",
 	                               "^([^\n.]|\\.[^\nst])[^\n]*\n",
-	                               "", "", "{icase}", NULL);
+	                               "", "", "{icase}", NULL,
+	                               &ManMatcher0);
 }
 
 extern parserDefinition* ManParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/meson.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/meson.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,532 @@
 #include "xtag.h"
 
 
+static const unsigned char MesonSet0 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char MesonSet1 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char MesonSet2 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char MesonSet3 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char MesonSet4 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char MesonSet5 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char MesonSet6 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char MesonSet7 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char MesonSet8 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x20,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchMeson0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (MesonSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher0 = {
+	matchMeson0, 0, false, false,
+};
+
+static bool matchMeson1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher1 = {
+	matchMeson1, 0, false, false,
+};
+
+static bool matchMeson2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher2 = {
+	matchMeson2, 0, false, false,
+};
+
+static bool matchMeson3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher3 = {
+	matchMeson3, 0, false, false,
+};
+
+static bool matchMeson4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (MesonSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher4 = {
+	matchMeson4, 0, false, false,
+};
+
+static bool matchMeson5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (MesonSet2, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (MesonSet3, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (MesonSet0, *p))
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (MesonSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher5 = {
+	matchMeson5, 1, false, false,
+};
+
+static bool matchMeson6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (MesonSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher6 = {
+	matchMeson6, 0, false, false,
+};
+
+static bool matchMeson7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher7 = {
+	matchMeson7, 0, false, false,
+};
+
+static bool matchMeson8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (MesonSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher8 = {
+	matchMeson8, 0, false, false,
+};
+
+static bool matchMeson9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (MesonSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher9 = {
+	matchMeson9, 0, false, false,
+};
+
+static bool matchMeson10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher10 = {
+	matchMeson10, 0, false, false,
+};
+
+static bool matchMeson11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (MesonSet6, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher11 = {
+	matchMeson11, 0, false, false,
+};
+
+static bool matchMeson12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher12 = {
+	matchMeson12, 0, false, false,
+};
+
+static bool matchMeson13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (MesonSet7, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher13 = {
+	matchMeson13, 0, false, false,
+};
+
+static bool matchMeson14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher14 = {
+	matchMeson14, 0, false, false,
+};
+
+static bool matchMeson15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (MesonSet8, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher15 = {
+	matchMeson15, 0, false, false,
+};
+
+static bool matchMeson16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (MesonSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher MesonMatcher16 = {
+	matchMeson16, 0, false, false,
+};
+
 static void initializeMesonParser (const langType language)
 {
 
@@ -21,175 +547,232 @@ static void initializeMesonParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &MesonMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^'''",
-	                               "", "", "{tenter=mline_string}", NULL);
+	                               "", "", "{tenter=mline_string}", NULL,
+	                               &MesonMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^'",
-	                               "", "", "{tenter=string}", NULL);
+	                               "", "", "{tenter=string}", NULL,
+	                               &MesonMatcher3);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[[({]",
-	                               "", "", "{tenter=skipPair}", NULL);
+	                               "", "", "{tenter=skipPair}", NULL,
+	                               &MesonMatcher4);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^(jar|executable|shared_module|(both_|shared_|static_)?library)[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL);
+	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^custom_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^(alias|run)_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL);
+	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^bench_mark[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^import[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL);
+	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^project[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "P", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "P", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^subdir[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "S", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "S", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^test[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "t", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "t", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^([a-zA-Z_][a-zA-Z_0-9]*)[ \t\n]*=[ \t\n]*",
-	                               "\\1", "V", "", NULL);
+	                               "\\1", "V", "", NULL,
+	                               &MesonMatcher5);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher6);
 	addLanguageTagMultiTableRegex (language, "mline_string",
 	                               "^'''",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &MesonMatcher7);
 	addLanguageTagMultiTableRegex (language, "mline_string",
 	                               "^[^']+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher8);
 	addLanguageTagMultiTableRegex (language, "mline_string",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher9);
 	addLanguageTagMultiTableRegex (language, "string",
 	                               "^\\\\'",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher10);
 	addLanguageTagMultiTableRegex (language, "string",
 	                               "^[^\\\\']+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher11);
 	addLanguageTagMultiTableRegex (language, "string",
 	                               "^'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &MesonMatcher12);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher13);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &MesonMatcher14);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &MesonMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^'''",
-	                               "", "", "{tenter=mline_string}", NULL);
+	                               "", "", "{tenter=mline_string}", NULL,
+	                               &MesonMatcher2);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^'",
-	                               "", "", "{tenter=string}", NULL);
+	                               "", "", "{tenter=string}", NULL,
+	                               &MesonMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^[[({]",
-	                               "", "", "{tenter=skipPair}", NULL);
+	                               "", "", "{tenter=skipPair}", NULL,
+	                               &MesonMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^(jar|executable|shared_module|(both_|shared_|static_)?library)[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL);
+	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^custom_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^(alias|run)_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL);
+	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^bench_mark[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^import[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL);
+	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^[])}]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &MesonMatcher15);
 	addLanguageTagMultiTableRegex (language, "skipPair",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher16);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher0);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &MesonMatcher1);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^'''",
-	                               "", "", "{tenter=mline_string}", NULL);
+	                               "", "", "{tenter=mline_string}", NULL,
+	                               &MesonMatcher2);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^'",
-	                               "", "", "{tenter=string}", NULL);
+	                               "", "", "{tenter=string}", NULL,
+	                               &MesonMatcher3);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^[[({]",
-	                               "", "", "{tenter=skipPair}", NULL);
+	                               "", "", "{tenter=skipPair}", NULL,
+	                               &MesonMatcher4);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^(jar|executable|shared_module|(both_|shared_|static_)?library)[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL);
+	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^custom_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^(alias|run)_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL);
+	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^bench_mark[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "common",
 	                               "^import[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL);
+	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &MesonMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^'''",
-	                               "", "", "{tenter=mline_string}", NULL);
+	                               "", "", "{tenter=mline_string}", NULL,
+	                               &MesonMatcher2);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^'",
-	                               "", "", "{tenter=string}", NULL);
+	                               "", "", "{tenter=string}", NULL,
+	                               &MesonMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^[[({]",
-	                               "", "", "{tenter=skipPair}", NULL);
+	                               "", "", "{tenter=skipPair}", NULL,
+	                               &MesonMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^(jar|executable|shared_module|(both_|shared_|static_)?library)[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL);
+	                               "\\3", "B", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^custom_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "c", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^(alias|run)_target[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL);
+	                               "\\2", "r", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^bench_mark[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL);
+	                               "\\1", "b", "{tenter=skipToArgEnd}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^import[ \t\n]*\\([ \t\n]*'([^']*[^\\\\])'[ \t\n]*",
-	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL);
+	                               "\\1", "m", "{tenter=skipToArgEnd}{_role=imported}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^[])}]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &MesonMatcher15);
 	addLanguageTagMultiTableRegex (language, "skipToArgEnd",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &MesonMatcher16);
 }
 
 extern parserDefinition* MesonParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/mesonOptions.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/mesonOptions.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,8 +8,10 @@
 #include "xtag.h"
 
 
-static void initializeMesonOptionsParser (const langType language CTAGS_ATTR_UNUSED)
+static void initializeMesonOptionsParser (const langType language)
 {
+
+
 }
 
 extern parserDefinition* MesonOptionsParser (void)
@@ -64,7 +66,7 @@ extern parserDefinition* MesonOptionsParser (void)
 		"    } {\n"
 		"        _commit pop\n"
 		"    } ifelse\n"
-		"}}", NULL, true},
+		"}}", NULL, true, NULL},
 	};
 
 
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/org.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/org.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,350 @@
 #include "xtag.h"
 
 
+static const unsigned char OrgSet0 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0xfb, 0xff, 0xef,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char OrgSet1 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char OrgSet2 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x08, 0x28, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char OrgSet3 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char OrgSet4 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char OrgSet5 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char OrgSet6 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchOrg0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (OrgSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher0 = {
+	matchOrg0, 0, false, false,
+};
+
+static bool matchOrg1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '+')
+			goto next;
+		p++;
+		if (p == end || *p != 'b')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'g')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && *p == ' ')
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (OrgSet1, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (OrgSet2, *p))
+			p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher1 = {
+	matchOrg1, 1, false, false,
+};
+
+static bool matchOrg2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (OrgSet3, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher2 = {
+	matchOrg2, 0, false, false,
+};
+
+static bool matchOrg3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (OrgSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '>')
+			goto next;
+		p++;
+		if (p == end || *p != '>')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher3 = {
+	matchOrg3, 1, false, false,
+};
+
+static bool matchOrg4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (OrgSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher4 = {
+	matchOrg4, 0, false, false,
+};
+
+static bool matchOrg5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (OrgSet6, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher5 = {
+	matchOrg5, 0, false, false,
+};
+
+static bool matchOrg6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '+')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher6 = {
+	matchOrg6, 0, false, false,
+};
+
+static bool matchOrg7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (OrgSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher OrgMatcher7 = {
+	matchOrg7, 0, false, false,
+};
+
 static void initializeOrgParser (const langType language)
 {
 	addLanguageOptscriptToHook (language, SCRIPT_HOOK_PRELUDE,
@@ -27,37 +371,47 @@ static void initializeOrgParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[^#*<]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &OrgMatcher0);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^#\\+begin_src[ ]+([a-zA-Z0-9][-#+a-zA-Z0-9]*)",
-	                               "", "", "{tenter=srcblock}{_guest=\\1,0end,}", NULL);
+	                               "", "", "{tenter=srcblock}{_guest=\\1,0end,}", NULL,
+	                               &OrgMatcher1);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^#\\+(NAME|name):[[:blank:]]+([[:graph:][:blank:]]+)([\n])?",
-	                               "\\2", "d", "", NULL);
+	                               "\\2", "d", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^#[^\n]*\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &OrgMatcher2);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^(\\*{1,7})[ \t]+([[:graph:][:blank:]]+)([\n])?",
 	                               "", "", ""
 		"{{\n"
 		"    \\2 kindTable \\1 length 1 sub get @2 _tag _commit pop\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^<<([^>]+)>>",
-	                               "\\1", "d", "", NULL);
+	                               "\\1", "d", "", NULL,
+	                               &OrgMatcher3);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &OrgMatcher4);
 	addLanguageTagMultiTableRegex (language, "srcblock",
 	                               "^[^#]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &OrgMatcher5);
 	addLanguageTagMultiTableRegex (language, "srcblock",
 	                               "^#\\+end_src",
-	                               "", "", "{tleave}{_guest=,,0end}", NULL);
+	                               "", "", "{tleave}{_guest=,,0end}", NULL,
+	                               &OrgMatcher6);
 	addLanguageTagMultiTableRegex (language, "srcblock",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &OrgMatcher7);
 }
 
 extern parserDefinition* OrgParser (void)
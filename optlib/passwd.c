@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/passwd.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/passwd.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,8 +8,107 @@
 #include "xtag.h"
 
 
-static void initializePasswdParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char PasswdSet0 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchPasswd0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [2].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [2].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [3].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [3].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [4].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [4].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [5].start = p - s;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		groups [5].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [6].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [6].end = p - s;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [7].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PasswdSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [7].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PasswdMatcher0 = {
+	matchPasswd0, 7, true, false,
+};
+
+static void initializePasswdParser (const langType language)
 {
+
+
 }
 
 extern parserDefinition* PasswdParser (void)
@@ -46,7 +145,7 @@ extern parserDefinition* PasswdParser (void)
 	};
 	static tagRegexTable PasswdTagRegexTable [] = {
 		{"^([^:]+):([^:]+):([^:]+):([^:]+):([^:]*):([^:]+):([^:]+)", "\\1",
-		"u", "{_field=home:\\6}{_field=shell:\\7}", NULL, false},
+		"u", "{_field=home:\\6}{_field=shell:\\7}", NULL, false, &PasswdMatcher0},
 	};
 
 
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/pkgConfig.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/pkgConfig.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,352 @@
 #include "xtag.h"
 
 
+static const unsigned char PkgConfigSet0 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PkgConfigSet1 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PkgConfigSet2 [32] = {
+	0xff, 0xc1, 0xff, 0xff, 0xfc, 0xff, 0xff, 0x8f,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PkgConfigSet3 [32] = {
+	0xff, 0xc1, 0xff, 0xff, 0xfe, 0xef, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PkgConfigSet4 [32] = {
+	0x00, 0x02, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PkgConfigSet5 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchPkgConfig0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PkgConfigSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PkgConfigSet1, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher0 = {
+	matchPkgConfig0, 1, false, false,
+};
+
+static bool matchPkgConfig1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'P')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'v')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher1 = {
+	matchPkgConfig1, 0, false, false,
+};
+
+static bool matchPkgConfig2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'C')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher2 = {
+	matchPkgConfig2, 0, false, false,
+};
+
+static bool matchPkgConfig3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PkgConfigSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher3 = {
+	matchPkgConfig3, 1, false, false,
+};
+
+static bool matchPkgConfig4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher4 = {
+	matchPkgConfig4, 0, false, false,
+};
+
+static bool matchPkgConfig5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PkgConfigSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher5 = {
+	matchPkgConfig5, 0, false, false,
+};
+
+static bool matchPkgConfig6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PkgConfigSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher6 = {
+	matchPkgConfig6, 1, false, false,
+};
+
+static bool matchPkgConfig7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PkgConfigSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher7 = {
+	matchPkgConfig7, 0, false, false,
+};
+
+static bool matchPkgConfig8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PkgConfigSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PkgConfigMatcher8 = {
+	matchPkgConfig8, 0, false, false,
+};
+
 static void initializePkgConfigParser (const langType language)
 {
 
@@ -17,7 +363,8 @@ static void initializePkgConfigParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^([-a-zA-Z0-9_.]+)[\t ]*=[^\n]*",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               &PkgConfigMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^Name:[\t ]*([^\n]+)",
 	                               "\\1", "N", ""
@@ -36,55 +383,67 @@ static void initializePkgConfigParser (const langType language)
 		"    } {\n"
 		"        pop\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^Requires(\\.private)?:[\t ]*",
 	                               "", "", "{tenter=dep}"
 		"{{\n"
 		"    /required\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^Provides:[\t ]*",
 	                               "", "", "{tenter=dep}"
 		"{{\n"
 		"    /provided\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PkgConfigMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^Conflicts:[\t ]*",
 	                               "", "", "{tenter=dep}"
 		"{{\n"
 		"    /conflicted\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PkgConfigMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^\n]+|[\n]",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "dep",
 	                               "^([^[:space:]=<>!]+)[ \t]*",
 	                               "\\1", "p", ""
 		"{{\n"
 		"    dup . exch _assignrole\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PkgConfigMatcher3);
 	addLanguageTagMultiTableRegex (language, "dep",
 	                               "^(=|<=?|>=?|!=)[\t ]*",
-	                               "", "", "{tenter=rightside}", NULL);
+	                               "", "", "{tenter=rightside}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "dep",
 	                               "^[\n]",
 	                               "", "", "{tleave}"
 		"{{\n"
 		"    pop\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PkgConfigMatcher4);
 	addLanguageTagMultiTableRegex (language, "dep",
 	                               "^[^\n]",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PkgConfigMatcher5);
 	addLanguageTagMultiTableRegex (language, "rightside",
 	                               "^([^[:space:],]+)",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PkgConfigMatcher6);
 	addLanguageTagMultiTableRegex (language, "rightside",
 	                               "^[ \t,]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PkgConfigMatcher7);
 	addLanguageTagMultiTableRegex (language, "rightside",
 	                               "^.",
-	                               "", "", "{_advanceTo=0start}{tleave}", NULL);
+	                               "", "", "{_advanceTo=0start}{tleave}", NULL,
+	                               &PkgConfigMatcher8);
 }
 
 extern parserDefinition* PkgConfigParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/pod.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/pod.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -16,7 +16,7 @@ typedef enum {
 } PodKind;
 
 
-static void initializePodParser (const langType language CTAGS_ATTR_UNUSED)
+static void initializePodParser (const langType language)
 {
 	addLanguageOptscriptToHook (language, SCRIPT_HOOK_PRELUDE,
 		"{{    /kindTable [\n"
@@ -56,6 +56,8 @@ static void initializePodParser (const langType language CTAGS_ATTR_UNUSED)
 		"        pop\n"
 		"    } def\n"
 		"}}");
+
+
 }
 
 extern parserDefinition* PodParser (void)
@@ -101,7 +103,7 @@ extern parserDefinition* PodParser (void)
 		"    } {\n"
 		"        _scopepush\n"
 		"    } ifelse\n"
-		"}}", NULL, false},
+		"}}", NULL, false, NULL},
 	};
 
 
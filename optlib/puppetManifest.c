@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/puppetManifest.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/puppetManifest.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,2489 @@
 #include "xtag.h"
 
 
+static const unsigned char PuppetManifestSet0 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PuppetManifestSet1 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PuppetManifestSet2 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PuppetManifestSet3 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PuppetManifestSet4 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PuppetManifestSet5 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PuppetManifestSet6 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PuppetManifestSet7 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PuppetManifestSet8 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x73, 0x7f, 0xff, 0xe7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char PuppetManifestSet9 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char PuppetManifestSet10 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x07,
+	0xfe, 0xff, 0xff, 0x07, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchPuppetManifest0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher0 = {
+	matchPuppetManifest0, 0, false, false,
+};
+
+static bool matchPuppetManifest1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher1 = {
+	matchPuppetManifest1, 0, false, false,
+};
+
+static bool matchPuppetManifest2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher2 = {
+	matchPuppetManifest2, 0, false, false,
+};
+
+static bool matchPuppetManifest3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher3 = {
+	matchPuppetManifest3, 0, false, false,
+};
+
+static bool matchPuppetManifest4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher4 = {
+	matchPuppetManifest4, 0, false, false,
+};
+
+static bool matchPuppetManifest5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '<')
+			p++;
+		if (p == end || *p != '|')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher5 = {
+	matchPuppetManifest5, 0, false, false,
+};
+
+static bool matchPuppetManifest6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher6 = {
+	matchPuppetManifest6, 0, false, false,
+};
+
+static bool matchPuppetManifest7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher7 = {
+	matchPuppetManifest7, 0, false, false,
+};
+
+static bool matchPuppetManifest8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher8 = {
+	matchPuppetManifest8, 0, false, false,
+};
+
+static bool matchPuppetManifest9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher9 = {
+	matchPuppetManifest9, 0, false, false,
+};
+
+static bool matchPuppetManifest10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (end - p >= 2
+		    && p [0] == 'i'
+		    && p [1] == 'f')
+			p += 2;
+		else if (end - p >= 5
+		    && p [0] == 'e'
+		    && p [1] == 'l'
+		    && p [2] == 's'
+		    && p [3] == 'i'
+		    && p [4] == 'f')
+			p += 5;
+		else if (end - p >= 4
+		    && p [0] == 'e'
+		    && p [1] == 'l'
+		    && p [2] == 's'
+		    && p [3] == 'e')
+			p += 4;
+		else if (end - p >= 6
+		    && p [0] == 'u'
+		    && p [1] == 'n'
+		    && p [2] == 'l'
+		    && p [3] == 'e'
+		    && p [4] == 's'
+		    && p [5] == 's')
+			p += 6;
+		else
+			goto next;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher10 = {
+	matchPuppetManifest10, 1, false, false,
+};
+
+static bool matchPuppetManifest11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher11 = {
+	matchPuppetManifest11, 0, false, false,
+};
+
+static bool matchPuppetManifest12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'y')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher12 = {
+	matchPuppetManifest12, 0, false, false,
+};
+
+static bool matchPuppetManifest13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher13 = {
+	matchPuppetManifest13, 0, false, false,
+};
+
+static bool matchPuppetManifest14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher14 = {
+	matchPuppetManifest14, 0, false, false,
+};
+
+static bool matchPuppetManifest15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher15 = {
+	matchPuppetManifest15, 0, false, false,
+};
+
+static bool matchPuppetManifest16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher16 = {
+	matchPuppetManifest16, 0, false, false,
+};
+
+static bool matchPuppetManifest17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher17 = {
+	matchPuppetManifest17, 0, false, false,
+};
+
+static bool matchPuppetManifest18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher18 = {
+	matchPuppetManifest18, 0, false, false,
+};
+
+static bool matchPuppetManifest19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher19 = {
+	matchPuppetManifest19, 0, false, false,
+};
+
+static bool matchPuppetManifest20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher20 = {
+	matchPuppetManifest20, 0, false, false,
+};
+
+static bool matchPuppetManifest21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher21 = {
+	matchPuppetManifest21, 0, false, false,
+};
+
+static bool matchPuppetManifest22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet3, *p))
+			p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher22 = {
+	matchPuppetManifest22, 0, false, false,
+};
+
+static bool matchPuppetManifest23 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher23 = {
+	matchPuppetManifest23, 0, false, false,
+};
+
+static bool matchPuppetManifest24 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet4, *p))
+			p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher24 = {
+	matchPuppetManifest24, 0, false, false,
+};
+
+static bool matchPuppetManifest25 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher25 = {
+	matchPuppetManifest25, 0, false, false,
+};
+
+static bool matchPuppetManifest26 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher26 = {
+	matchPuppetManifest26, 0, false, false,
+};
+
+static bool matchPuppetManifest27 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher27 = {
+	matchPuppetManifest27, 0, false, false,
+};
+
+static bool matchPuppetManifest28 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '<')
+			p++;
+		if (p == end || *p != '|')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher28 = {
+	matchPuppetManifest28, 0, false, false,
+};
+
+static bool matchPuppetManifest29 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && p - q < 1 && *p == ';')
+			p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher29 = {
+	matchPuppetManifest29, 0, false, false,
+};
+
+static bool matchPuppetManifest30 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ';')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher30 = {
+	matchPuppetManifest30, 0, false, false,
+};
+
+static bool matchPuppetManifest31 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher31 = {
+	matchPuppetManifest31, 0, false, false,
+};
+
+static bool matchPuppetManifest32 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher32 = {
+	matchPuppetManifest32, 0, false, false,
+};
+
+static bool matchPuppetManifest33 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher33 = {
+	matchPuppetManifest33, 0, false, false,
+};
+
+static bool matchPuppetManifest34 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher34 = {
+	matchPuppetManifest34, 0, false, false,
+};
+
+static bool matchPuppetManifest35 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher35 = {
+	matchPuppetManifest35, 0, false, false,
+};
+
+static bool matchPuppetManifest36 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher36 = {
+	matchPuppetManifest36, 0, false, false,
+};
+
+static bool matchPuppetManifest37 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher37 = {
+	matchPuppetManifest37, 0, false, false,
+};
+
+static bool matchPuppetManifest38 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher38 = {
+	matchPuppetManifest38, 0, false, false,
+};
+
+static bool matchPuppetManifest39 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet1, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher39 = {
+	matchPuppetManifest39, 0, false, false,
+};
+
+static bool matchPuppetManifest40 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher40 = {
+	matchPuppetManifest40, 0, false, false,
+};
+
+static bool matchPuppetManifest41 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher41 = {
+	matchPuppetManifest41, 0, false, false,
+};
+
+static bool matchPuppetManifest42 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher42 = {
+	matchPuppetManifest42, 0, false, false,
+};
+
+static bool matchPuppetManifest43 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ']')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher43 = {
+	matchPuppetManifest43, 0, false, false,
+};
+
+static bool matchPuppetManifest44 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher44 = {
+	matchPuppetManifest44, 0, false, false,
+};
+
+static bool matchPuppetManifest45 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher45 = {
+	matchPuppetManifest45, 0, false, false,
+};
+
+static bool matchPuppetManifest46 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '<')
+			p++;
+		if (p == end || *p != '|')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher46 = {
+	matchPuppetManifest46, 0, false, false,
+};
+
+static bool matchPuppetManifest47 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '|')
+			goto next;
+		p++;
+		if (p == end || *p != '>')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '>')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher47 = {
+	matchPuppetManifest47, 0, false, false,
+};
+
+static bool matchPuppetManifest48 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher48 = {
+	matchPuppetManifest48, 0, false, false,
+};
+
+static bool matchPuppetManifest49 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet5, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet6, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [2].start = p - s;
+		if (p == end || (*p != ',' && *p != '='))
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher49 = {
+	matchPuppetManifest49, 2, false, false,
+};
+
+static bool matchPuppetManifest50 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher50 = {
+	matchPuppetManifest50, 0, false, false,
+};
+
+static bool matchPuppetManifest51 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher51 = {
+	matchPuppetManifest51, 0, false, false,
+};
+
+static bool matchPuppetManifest52 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher52 = {
+	matchPuppetManifest52, 0, false, false,
+};
+
+static bool matchPuppetManifest53 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ',')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher53 = {
+	matchPuppetManifest53, 0, false, false,
+};
+
+static bool matchPuppetManifest54 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher54 = {
+	matchPuppetManifest54, 0, false, false,
+};
+
+static bool matchPuppetManifest55 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet6, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		groups [2].start = p - s;
+		if (p == end || (*p != '(' && *p != '{'))
+			goto next;
+		p++;
+		groups [2].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher55 = {
+	matchPuppetManifest55, 2, false, false,
+};
+
+static bool matchPuppetManifest56 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher56 = {
+	matchPuppetManifest56, 0, false, false,
+};
+
+static bool matchPuppetManifest57 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher57 = {
+	matchPuppetManifest57, 0, false, false,
+};
+
+static bool matchPuppetManifest58 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher58 = {
+	matchPuppetManifest58, 0, false, false,
+};
+
+static bool matchPuppetManifest59 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher59 = {
+	matchPuppetManifest59, 1, false, false,
+};
+
+static bool matchPuppetManifest60 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher60 = {
+	matchPuppetManifest60, 1, false, false,
+};
+
+static bool matchPuppetManifest61 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher61 = {
+	matchPuppetManifest61, 0, false, false,
+};
+
+static bool matchPuppetManifest62 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet5, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet2, *p))
+			p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet5, *p))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher62 = {
+	matchPuppetManifest62, 1, false, false,
+};
+
+static bool matchPuppetManifest63 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher63 = {
+	matchPuppetManifest63, 0, false, false,
+};
+
+static bool matchPuppetManifest64 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher64 = {
+	matchPuppetManifest64, 0, false, false,
+};
+
+static bool matchPuppetManifest65 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher65 = {
+	matchPuppetManifest65, 0, false, false,
+};
+
+static bool matchPuppetManifest66 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher66 = {
+	matchPuppetManifest66, 0, false, false,
+};
+
+static bool matchPuppetManifest67 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet8, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher67 = {
+	matchPuppetManifest67, 0, false, false,
+};
+
+static bool matchPuppetManifest68 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher68 = {
+	matchPuppetManifest68, 0, false, false,
+};
+
+static bool matchPuppetManifest69 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher69 = {
+	matchPuppetManifest69, 0, false, false,
+};
+
+static bool matchPuppetManifest70 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher70 = {
+	matchPuppetManifest70, 0, false, false,
+};
+
+static bool matchPuppetManifest71 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher71 = {
+	matchPuppetManifest71, 0, false, false,
+};
+
+static bool matchPuppetManifest72 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ';')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher72 = {
+	matchPuppetManifest72, 0, false, false,
+};
+
+static bool matchPuppetManifest73 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '<')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '<')
+			p++;
+		if (p == end || *p != '|')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher73 = {
+	matchPuppetManifest73, 0, false, false,
+};
+
+static bool matchPuppetManifest74 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != '"' && *p != '\''))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher74 = {
+	matchPuppetManifest74, 0, false, false,
+};
+
+static bool matchPuppetManifest75 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ']')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher75 = {
+	matchPuppetManifest75, 0, false, false,
+};
+
+static bool matchPuppetManifest76 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher76 = {
+	matchPuppetManifest76, 0, false, false,
+};
+
+static bool matchPuppetManifest77 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher77 = {
+	matchPuppetManifest77, 0, false, false,
+};
+
+static bool matchPuppetManifest78 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher78 = {
+	matchPuppetManifest78, 0, false, false,
+};
+
+static bool matchPuppetManifest79 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher79 = {
+	matchPuppetManifest79, 0, false, false,
+};
+
+static bool matchPuppetManifest80 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher80 = {
+	matchPuppetManifest80, 0, false, false,
+};
+
+static bool matchPuppetManifest81 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet9, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet10, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher81 = {
+	matchPuppetManifest81, 0, false, false,
+};
+
+static bool matchPuppetManifest82 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (PuppetManifestSet10, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (PuppetManifestSet10, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher82 = {
+	matchPuppetManifest82, 0, false, false,
+};
+
+static bool matchPuppetManifest83 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != '\t' && *p != ' '))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher83 = {
+	matchPuppetManifest83, 0, false, false,
+};
+
+static bool matchPuppetManifest84 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher84 = {
+	matchPuppetManifest84, 0, false, false,
+};
+
+static bool matchPuppetManifest85 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher85 = {
+	matchPuppetManifest85, 0, false, false,
+};
+
+static bool matchPuppetManifest86 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher PuppetManifestMatcher86 = {
+	matchPuppetManifest86, 0, false, false,
+};
+
 typedef enum {
 	K_CLASS,
 	K_DEFINITION,
@@ -86,25 +2569,32 @@ static void initializePuppetManifestParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^<<?\\|",
-	                               "", "", "{tenter=skipCollector}", NULL);
+	                               "", "", "{tenter=skipCollector}", NULL,
+	                               &PuppetManifestMatcher5);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\$",
-	                               "", "", "{tenter=var}", NULL);
+	                               "", "", "{tenter=var}", NULL,
+	                               &PuppetManifestMatcher6);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^(@)?(::[a-zA-Z0-9:_]+|[a-zA-Z][a-zA-Z0-9:_]*)[ \t\n]*\\{",
 	                               "", "", "{tenter=resourceBlock}"
@@ -115,73 +2605,96 @@ static void initializePuppetManifestParser (const langType language)
 		"       /resource\n"
 		"    } ifelse \\2 true\n"
 		"    % kind:name type:string true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^class[ \t\n]+",
-	                               "", "", "{tenter=classStart}", NULL);
+	                               "", "", "{tenter=classStart}", NULL,
+	                               &PuppetManifestMatcher7);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^define[ \t\n]+",
-	                               "", "", "{tenter=defineStart}", NULL);
+	                               "", "", "{tenter=defineStart}", NULL,
+	                               &PuppetManifestMatcher8);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^case[ \t\n]+",
-	                               "", "", "{tenter=caseStart}", NULL);
+	                               "", "", "{tenter=caseStart}", NULL,
+	                               &PuppetManifestMatcher9);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^(if|elsif|else|unless)[ \t\n]+",
-	                               "", "", "{tenter=ifStart}", NULL);
+	                               "", "", "{tenter=ifStart}", NULL,
+	                               &PuppetManifestMatcher10);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^node[ \t\n]+",
-	                               "", "", "{tenter=nodeStart}", NULL);
+	                               "", "", "{tenter=nodeStart}", NULL,
+	                               &PuppetManifestMatcher11);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^type[ \t\n]+",
-	                               "", "", "{tenter=typeStart}", NULL);
+	                               "", "", "{tenter=typeStart}", NULL,
+	                               &PuppetManifestMatcher12);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\$",
-	                               "", "", "{tenter=var}", NULL);
+	                               "", "", "{tenter=var}", NULL,
+	                               &PuppetManifestMatcher13);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\(",
-	                               "", "", "{tenter=skipArgs}", NULL);
+	                               "", "", "{tenter=skipArgs}", NULL,
+	                               &PuppetManifestMatcher14);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\{",
-	                               "", "", "{tenter=skipBlock}", NULL);
+	                               "", "", "{tenter=skipBlock}", NULL,
+	                               &PuppetManifestMatcher15);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^.",
-	                               "", "", "{tenter=separator}", NULL);
+	                               "", "", "{tenter=separator}", NULL,
+	                               &PuppetManifestMatcher16);
 	addLanguageTagMultiTableRegex (language, "separator",
 	                               "^[a-zA-Z0-9]",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher17);
 	addLanguageTagMultiTableRegex (language, "separator",
 	                               "^",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher18);
 	addLanguageTagMultiTableRegex (language, "any",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "ignoreWhiteSpace",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "end",
 	                               "^",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher20);
 	addLanguageTagMultiTableRegex (language, "endWithPop",
 	                               "^",
-	                               "", "", "{tleave}{scope=pop}", NULL);
+	                               "", "", "{tleave}{scope=pop}", NULL,
+	                               &PuppetManifestMatcher21);
 	addLanguageTagMultiTableRegex (language, "ssliteral",
 	                               "^[^']*'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher22);
 	addLanguageTagMultiTableRegex (language, "ssliteral",
 	                               "^[^']+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher23);
 	addLanguageTagMultiTableRegex (language, "dsliteral",
 	                               "^[^\"]*\"",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher24);
 	addLanguageTagMultiTableRegex (language, "dsliteral",
 	                               "^[^\"]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher25);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^(@)?(::[a-zA-Z0-9:_]+|[a-zA-Z][a-zA-Z0-9:_]*)[ \t\n]*\\{",
 	                               "", "", "{tenter=resourceBlock}"
@@ -192,55 +2705,72 @@ static void initializePuppetManifestParser (const langType language)
 		"       /resource\n"
 		"    } ifelse \\2 true\n"
 		"    % kind:name type:string true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^class[ \t\n]+",
-	                               "", "", "{tenter=classStart}", NULL);
+	                               "", "", "{tenter=classStart}", NULL,
+	                               &PuppetManifestMatcher7);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^define[ \t\n]+",
-	                               "", "", "{tenter=defineStart}", NULL);
+	                               "", "", "{tenter=defineStart}", NULL,
+	                               &PuppetManifestMatcher8);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^case[ \t\n]+",
-	                               "", "", "{tenter=caseStart}", NULL);
+	                               "", "", "{tenter=caseStart}", NULL,
+	                               &PuppetManifestMatcher9);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^(if|elsif|else|unless)[ \t\n]+",
-	                               "", "", "{tenter=ifStart}", NULL);
+	                               "", "", "{tenter=ifStart}", NULL,
+	                               &PuppetManifestMatcher10);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^node[ \t\n]+",
-	                               "", "", "{tenter=nodeStart}", NULL);
+	                               "", "", "{tenter=nodeStart}", NULL,
+	                               &PuppetManifestMatcher11);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^type[ \t\n]+",
-	                               "", "", "{tenter=typeStart}", NULL);
+	                               "", "", "{tenter=typeStart}", NULL,
+	                               &PuppetManifestMatcher12);
 	addLanguageTagMultiTableRegex (language, "blockStart",
 	                               "^\\$",
-	                               "", "", "{tenter=var}", NULL);
+	                               "", "", "{tenter=var}", NULL,
+	                               &PuppetManifestMatcher13);
 	addLanguageTagMultiTableRegex (language, "blockHead",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "blockHead",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "blockHead",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "blockHead",
 	                               "^\\{",
-	                               "", "", "{tenter=block,end}", NULL);
+	                               "", "", "{tenter=block,end}", NULL,
+	                               &PuppetManifestMatcher26);
 	addLanguageTagMultiTableRegex (language, "blockHead",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "blockHeadPopAtLast",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "blockHeadPopAtLast",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "blockHeadPopAtLast",
 	                               "^\\{",
-	                               "", "", "{tenter=block,endWithPop}", NULL);
+	                               "", "", "{tenter=block,endWithPop}", NULL,
+	                               &PuppetManifestMatcher27);
 	addLanguageTagMultiTableRegex (language, "blockHeadPopAtLast",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "blockHeadPopAtLast",
 	                               "^inherits[ \t\n]+(::[a-z][_a-zA-Z0-9:]*|[a-z][_a-zA-Z0-9:]*)[ \t\n]*",
 	                               "", "", ""
@@ -252,13 +2782,16 @@ static void initializePuppetManifestParser (const langType language)
 		"           pop\n"
 		"        } ifelse\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "blockHeadPopAtLast",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^(@)?(::[a-zA-Z0-9:_]+|[a-zA-Z][a-zA-Z0-9:_]*)[ \t\n]*\\{",
 	                               "", "", "{tenter=resourceBlock}"
@@ -269,67 +2802,87 @@ static void initializePuppetManifestParser (const langType language)
 		"       /resource\n"
 		"    } ifelse \\2 true\n"
 		"    % kind:name type:string true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^class[ \t\n]+",
-	                               "", "", "{tenter=classStart}", NULL);
+	                               "", "", "{tenter=classStart}", NULL,
+	                               &PuppetManifestMatcher7);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^define[ \t\n]+",
-	                               "", "", "{tenter=defineStart}", NULL);
+	                               "", "", "{tenter=defineStart}", NULL,
+	                               &PuppetManifestMatcher8);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^case[ \t\n]+",
-	                               "", "", "{tenter=caseStart}", NULL);
+	                               "", "", "{tenter=caseStart}", NULL,
+	                               &PuppetManifestMatcher9);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^(if|elsif|else|unless)[ \t\n]+",
-	                               "", "", "{tenter=ifStart}", NULL);
+	                               "", "", "{tenter=ifStart}", NULL,
+	                               &PuppetManifestMatcher10);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^node[ \t\n]+",
-	                               "", "", "{tenter=nodeStart}", NULL);
+	                               "", "", "{tenter=nodeStart}", NULL,
+	                               &PuppetManifestMatcher11);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^type[ \t\n]+",
-	                               "", "", "{tenter=typeStart}", NULL);
+	                               "", "", "{tenter=typeStart}", NULL,
+	                               &PuppetManifestMatcher12);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^\\$",
-	                               "", "", "{tenter=var}", NULL);
+	                               "", "", "{tenter=var}", NULL,
+	                               &PuppetManifestMatcher13);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^<<?\\|",
-	                               "", "", "{tenter=skipCollector}", NULL);
+	                               "", "", "{tenter=skipCollector}", NULL,
+	                               &PuppetManifestMatcher28);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^;?[ \t\n]*\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher29);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^;",
 	                               "", "", "{tjump=resourceBlock}{scope=pop}"
 		"{{\n"
 		"    false\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PuppetManifestMatcher30);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^:",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher31);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^\\{",
-	                               "", "", "{tenter=block}", NULL);
+	                               "", "", "{tenter=block}", NULL,
+	                               &PuppetManifestMatcher32);
 	addLanguageTagMultiTableRegex (language, "block",
 	                               "^.",
-	                               "", "", "{tenter=separator}", NULL);
+	                               "", "", "{tenter=separator}", NULL,
+	                               &PuppetManifestMatcher33);
 	addLanguageTagMultiTableRegex (language, "classStart",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "classStart",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "classStart",
 	                               "^(::[a-z][_a-zA-Z0-9:]*|[a-z][_a-zA-Z0-9:]*)[ \t\n]*(\\(|\\{|inherits[ \t\n]+(::[a-z][_a-zA-Z0-9:]*|[a-z][_a-zA-Z0-9:]*))[ \t\n]*",
 	                               "\\1", "c", "{scope=push}"
@@ -348,142 +2901,187 @@ static void initializePuppetManifestParser (const langType language)
 		"            /blockHead /endWithPop _tentercont\n"
 		"        } ifelse\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^\\}",
 	                               "", "", "{tleave}"
 		"{{\n"
 		"    { pop pop } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PuppetManifestMatcher34);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^'",
-	                               "", "", "{tenter=resourceName}{_advanceTo=0start}", NULL);
+	                               "", "", "{tenter=resourceName}{_advanceTo=0start}", NULL,
+	                               &PuppetManifestMatcher35);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^\"",
-	                               "", "", "{tenter=resourceName}{_advanceTo=0start}", NULL);
+	                               "", "", "{tenter=resourceName}{_advanceTo=0start}", NULL,
+	                               &PuppetManifestMatcher36);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^\\[",
-	                               "", "", "{tenter=resourceArray}", NULL);
+	                               "", "", "{tenter=resourceArray}", NULL,
+	                               &PuppetManifestMatcher37);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^\\{",
-	                               "", "", "{tenter=block}", NULL);
+	                               "", "", "{tenter=block}", NULL,
+	                               &PuppetManifestMatcher38);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "resourceBlock",
 	                               "^.",
-	                               "", "", "{tenter=resourceBody}{scope=push}{placeholder}", NULL);
+	                               "", "", "{tenter=resourceBody}{scope=push}{placeholder}", NULL,
+	                               &PuppetManifestMatcher39);
 	addLanguageTagMultiTableRegex (language, "skipLiteral",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipLiteral",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^\\{",
-	                               "", "", "{tenter=skipBlock}", NULL);
+	                               "", "", "{tenter=skipBlock}", NULL,
+	                               &PuppetManifestMatcher40);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher41);
 	addLanguageTagMultiTableRegex (language, "skipBlock",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^\\[",
-	                               "", "", "{tenter=skipArray}", NULL);
+	                               "", "", "{tenter=skipArray}", NULL,
+	                               &PuppetManifestMatcher42);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^\\]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher43);
 	addLanguageTagMultiTableRegex (language, "skipArray",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^\\(",
-	                               "", "", "{tenter=skipArgs}", NULL);
+	                               "", "", "{tenter=skipArgs}", NULL,
+	                               &PuppetManifestMatcher44);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^\\)",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher45);
 	addLanguageTagMultiTableRegex (language, "skipArgs",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^<<?\\|",
-	                               "", "", "{tenter=skipCollector}", NULL);
+	                               "", "", "{tenter=skipCollector}", NULL,
+	                               &PuppetManifestMatcher46);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^\\|>>?",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher47);
 	addLanguageTagMultiTableRegex (language, "skipCollector",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^\\)",
 	                               "", "", "{tleave}"
@@ -498,7 +3096,8 @@ static void initializePuppetManifestParser (const langType language)
 		"        % something wrong\n"
 		"        pop\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PuppetManifestMatcher48);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^\\$([a-zA-Z][_a-zA-Z0-9:]*)[ \t]*([=,])[ \t]*",
 	                               "\\1", "p", "{scope=ref}"
@@ -508,40 +3107,52 @@ static void initializePuppetManifestParser (const langType language)
 		"       /skipDefaultValue _tenter\n"
 		"    } if\n"
 		"    ?$ \\1 ?,\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PuppetManifestMatcher49);
 	addLanguageTagMultiTableRegex (language, "signature",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^\\[",
-	                               "", "", "{tenter=skipArray}", NULL);
+	                               "", "", "{tenter=skipArray}", NULL,
+	                               &PuppetManifestMatcher50);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^\\{",
-	                               "", "", "{tenter=skipBlock}", NULL);
+	                               "", "", "{tenter=skipBlock}", NULL,
+	                               &PuppetManifestMatcher51);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^\\(",
-	                               "", "", "{tenter=skipArgs}", NULL);
+	                               "", "", "{tenter=skipArgs}", NULL,
+	                               &PuppetManifestMatcher52);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^,",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher53);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^\\)",
-	                               "", "", "{tleave}{_advanceTo=0start}", NULL);
+	                               "", "", "{tleave}{_advanceTo=0start}", NULL,
+	                               &PuppetManifestMatcher54);
 	addLanguageTagMultiTableRegex (language, "skipDefaultValue",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "var",
 	                               "^(::[a-zA-Z0-9_:]+|[a-zA-Z_][a-zA-Z0-9_:]*)[ \t\n]*=",
 	                               "\\1", "v", "{tenter=varexpr,end}"
@@ -549,13 +3160,16 @@ static void initializePuppetManifestParser (const langType language)
 		"    \\1 0 get ?: eq not {\n"
 		"       . _scoperef\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "defineStart",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "defineStart",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "defineStart",
 	                               "^([a-z][_a-zA-Z0-9:]*)[ \n\t]*([({])",
 	                               "\\1", "d", "{scope=push}"
@@ -568,94 +3182,124 @@ static void initializePuppetManifestParser (const langType language)
 		"    } {\n"
 		"       /block /endWithPop _tentercont\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &PuppetManifestMatcher55);
 	addLanguageTagMultiTableRegex (language, "caseStart",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "caseStart",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "caseStart",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "caseStart",
 	                               "^\\{",
-	                               "", "", "{tenter=caseBlock}", NULL);
+	                               "", "", "{tenter=caseBlock}", NULL,
+	                               &PuppetManifestMatcher56);
 	addLanguageTagMultiTableRegex (language, "caseStart",
 	                               "^}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher57);
 	addLanguageTagMultiTableRegex (language, "caseStart",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^\\{",
-	                               "", "", "{tenter=block,end}", NULL);
+	                               "", "", "{tenter=block,end}", NULL,
+	                               &PuppetManifestMatcher58);
 	addLanguageTagMultiTableRegex (language, "ifStart",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^'([^']+)'",
-	                               "\\1", "n", "", NULL);
+	                               "\\1", "n", "", NULL,
+	                               &PuppetManifestMatcher59);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^\"([^\"]+)\"",
-	                               "\\1", "n", "", NULL);
+	                               "\\1", "n", "", NULL,
+	                               &PuppetManifestMatcher60);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^\\{",
-	                               "", "", "{tenter=block,end}", NULL);
+	                               "", "", "{tenter=block,end}", NULL,
+	                               &PuppetManifestMatcher61);
 	addLanguageTagMultiTableRegex (language, "nodeStart",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "typeStart",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "typeStart",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "typeStart",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "typeStart",
 	                               "^([a-zA-Z][a-zA-Z0-9]*::[a-zA-Z][a-zA-Z0-9]+)[ \t\n]*=[ \t\n]*",
-	                               "\\1", "t", "{tenter=varexpr,end}", NULL);
+	                               "\\1", "t", "{tenter=varexpr,end}", NULL,
+	                               &PuppetManifestMatcher62);
 	addLanguageTagMultiTableRegex (language, "typeStart",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "comment_multiline",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher63);
 	addLanguageTagMultiTableRegex (language, "comment_multiline",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "comment_oneline",
 	                               "^\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher64);
 	addLanguageTagMultiTableRegex (language, "comment_oneline",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "resourceName",
 	                               "^'([^']+)'|\"([^\"]+)\"",
 	                               "", "", "{tenter=resourceBody,end}"
@@ -683,10 +3327,12 @@ static void initializePuppetManifestParser (const langType language)
 		"           _scopepush\n"
 		"        } if\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "resourceName",
 	                               "^",
-	                               "", "", "{tquit}", NULL);
+	                               "", "", "{tquit}", NULL,
+	                               &PuppetManifestMatcher65);
 	addLanguageTagMultiTableRegex (language, "resourceNameInArray",
 	                               "^'([^']+)'|\"([^\"]+)\"",
 	                               "", "", "{tleave}"
@@ -707,121 +3353,160 @@ static void initializePuppetManifestParser (const langType language)
 		"           _scoperef\n"
 		"        } if\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "resourceNameInArray",
 	                               "^",
-	                               "", "", "{tquit}", NULL);
+	                               "", "", "{tquit}", NULL,
+	                               &PuppetManifestMatcher66);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^[^/#{'\";}<]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher67);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher68);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher69);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^\\}",
-	                               "", "", "{tleave}{_advanceTo=0start}{scope=pop}", NULL);
+	                               "", "", "{tleave}{_advanceTo=0start}{scope=pop}", NULL,
+	                               &PuppetManifestMatcher70);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^\\{",
-	                               "", "", "{tenter=skipBlock}", NULL);
+	                               "", "", "{tenter=skipBlock}", NULL,
+	                               &PuppetManifestMatcher71);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^;",
-	                               "", "", "{tleave}{scope=pop}", NULL);
+	                               "", "", "{tleave}{scope=pop}", NULL,
+	                               &PuppetManifestMatcher72);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^<<?\\|",
-	                               "", "", "{tenter=skipCollector}", NULL);
+	                               "", "", "{tenter=skipCollector}", NULL,
+	                               &PuppetManifestMatcher73);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "resourceBody",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "resourceArray",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "resourceArray",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "resourceArray",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "resourceArray",
 	                               "^['\"]",
-	                               "", "", "{tenter=resourceNameInArray}{_advanceTo=0start}", NULL);
+	                               "", "", "{tenter=resourceNameInArray}{_advanceTo=0start}", NULL,
+	                               &PuppetManifestMatcher74);
 	addLanguageTagMultiTableRegex (language, "resourceArray",
 	                               "^\\]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher75);
 	addLanguageTagMultiTableRegex (language, "resourceArray",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral,end}", NULL);
+	                               "", "", "{tenter=ssliteral,end}", NULL,
+	                               &PuppetManifestMatcher76);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral,end}", NULL);
+	                               "", "", "{tenter=dsliteral,end}", NULL,
+	                               &PuppetManifestMatcher77);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\\[",
-	                               "", "", "{tenter=skipArray,end}", NULL);
+	                               "", "", "{tenter=skipArray,end}", NULL,
+	                               &PuppetManifestMatcher78);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\\{",
-	                               "", "", "{tenter=skipBlock,end}", NULL);
+	                               "", "", "{tenter=skipBlock,end}", NULL,
+	                               &PuppetManifestMatcher79);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\\(",
-	                               "", "", "{tenter=skipArgs,end}", NULL);
+	                               "", "", "{tenter=skipArgs,end}", NULL,
+	                               &PuppetManifestMatcher80);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\\$[a-zA-Z:][0-9a-zA-Z:]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher81);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^[0-9]+(\\.[0-9]+(e([+-][0-9]+)))?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^[a-zA-Z0-9:][0-9a-zA-Z:]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher82);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^[ \t]",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher83);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &PuppetManifestMatcher84);
 	addLanguageTagMultiTableRegex (language, "varexpr",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &PuppetManifestMatcher0);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &PuppetManifestMatcher1);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher2);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &PuppetManifestMatcher3);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &PuppetManifestMatcher4);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^:",
-	                               "", "", "{tenter=blockHead}", NULL);
+	                               "", "", "{tenter=blockHead}", NULL,
+	                               &PuppetManifestMatcher85);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^}",
-	                               "", "", "{tleave}{_advanceTo=0start}", NULL);
+	                               "", "", "{tleave}{_advanceTo=0start}", NULL,
+	                               &PuppetManifestMatcher86);
 	addLanguageTagMultiTableRegex (language, "caseBlock",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &PuppetManifestMatcher19);
 }
 
 extern parserDefinition* PuppetManifestParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/qemuhx.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/qemuhx.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,8 +8,204 @@
 #include "xtag.h"
 
 
-static void initializeQemuHXParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char QemuHXSet0 [32] = {
+	0x00, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char QemuHXSet1 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char QemuHXSet2 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchQemuHX0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'S')
+			goto next;
+		p++;
+		if (p == end || *p != 'Q')
+			goto next;
+		p++;
+		if (p == end || *p != 'M')
+			goto next;
+		p++;
+		if (p == end || *p != 'P')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (QemuHXSet0, *p))
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (QemuHXSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || !REGEX_SET_HAS (QemuHXSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher QemuHXMatcher0 = {
+	matchQemuHX0, 1, true, false,
+};
+
+static bool matchQemuHX1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'S')
+			goto next;
+		p++;
+		if (p == end || *p != 'Q')
+			goto next;
+		p++;
+		if (p == end || *p != 'M')
+			goto next;
+		p++;
+		if (p == end || *p != 'P')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (QemuHXSet0, *p))
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (QemuHXSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || !REGEX_SET_HAS (QemuHXSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		if (p == end || *p != '-')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher QemuHXMatcher1 = {
+	matchQemuHX1, 1, true, false,
+};
+
+static bool matchQemuHX2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (QemuHXSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (QemuHXSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher QemuHXMatcher2 = {
+	matchQemuHX2, 1, true, false,
+};
+
+static void initializeQemuHXParser (const langType language)
 {
+
+
 }
 
 extern parserDefinition* QemuHXParser (void)
@@ -44,15 +240,15 @@ extern parserDefinition* QemuHXParser (void)
 	};
 	static tagRegexTable QemuHXTagRegexTable [] = {
 		{"^SQMP[[:space:]]([-a-z_0-9A-Z]+)[[:space:]]---", "\\1",
-		"q", "{mgroup=1}", NULL, true},
+		"q", "{mgroup=1}", NULL, true, &QemuHXMatcher0},
 		{"^SQMP[[:space:]]([-a-z_0-9A-Z]+)[[:space:]]---", "qmp_\\1",
 		"q", "{mgroup=1}{_extra=funcmap}"
 		"{{\n"
 		"    . :name dup (-_) _tr!\n"
 		"    . exch name:\n"
-		"}}", NULL, true},
+		"}}", NULL, true, &QemuHXMatcher1},
 		{"^@item[[:space:]]{1,}([-.a-z_0-9A-Z]{1,})", "\\1",
-		"i", NULL, NULL, false},
+		"i", NULL, NULL, false, &QemuHXMatcher2},
 	};
 
 
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/rdoc.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/rdoc.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -18,7 +18,7 @@ typedef enum {
 } RDocKind;
 
 
-static void initializeRDocParser (const langType language CTAGS_ATTR_UNUSED)
+static void initializeRDocParser (const langType language)
 {
 	addLanguageOptscriptToHook (language, SCRIPT_HOOK_PRELUDE,
 		"{{    /kindTable [\n"
@@ -55,6 +55,8 @@ static void initializeRDocParser (const langType language CTAGS_ATTR_UNUSED)
 		"        pop\n"
 		"    } def\n"
 		"}}");
+
+
 }
 
 extern parserDefinition* RDocParser (void)
@@ -108,7 +110,7 @@ extern parserDefinition* RDocParser (void)
 		"            _scopepush\n"
 		"        } ifelse\n"
 		"    } if\n"
-		"}}", NULL, false},
+		"}}", NULL, false, NULL},
 	};
 
 
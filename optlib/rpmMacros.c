@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/rpmMacros.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/rpmMacros.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,427 @@
 #include "xtag.h"
 
 
+static const unsigned char RpmMacrosSet0 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char RpmMacrosSet1 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char RpmMacrosSet2 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchRpmMacros0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher0 = {
+	matchRpmMacros0, 0, false, false,
+};
+
+static bool matchRpmMacros1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (RpmMacrosSet0, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher1 = {
+	matchRpmMacros1, 0, false, false,
+};
+
+static bool matchRpmMacros2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (RpmMacrosSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher2 = {
+	matchRpmMacros2, 0, false, false,
+};
+
+static bool matchRpmMacros3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher3 = {
+	matchRpmMacros3, 0, false, false,
+};
+
+static bool matchRpmMacros4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher4 = {
+	matchRpmMacros4, 1, false, false,
+};
+
+static bool matchRpmMacros5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (RpmMacrosSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher5 = {
+	matchRpmMacros5, 1, false, false,
+};
+
+static bool matchRpmMacros6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher6 = {
+	matchRpmMacros6, 0, false, false,
+};
+
+static bool matchRpmMacros7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher7 = {
+	matchRpmMacros7, 1, false, false,
+};
+
+static bool matchRpmMacros8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher8 = {
+	matchRpmMacros8, 1, false, false,
+};
+
+static bool matchRpmMacros9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (RpmMacrosSet0, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher9 = {
+	matchRpmMacros9, 0, false, false,
+};
+
+static bool matchRpmMacros10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (RpmMacrosSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher10 = {
+	matchRpmMacros10, 0, false, false,
+};
+
+static bool matchRpmMacros11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher11 = {
+	matchRpmMacros11, 0, false, false,
+};
+
+static bool matchRpmMacros12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher12 = {
+	matchRpmMacros12, 0, false, false,
+};
+
+static bool matchRpmMacros13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (RpmMacrosSet0, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher13 = {
+	matchRpmMacros13, 0, false, false,
+};
+
+static bool matchRpmMacros14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher RpmMacrosMatcher14 = {
+	matchRpmMacros14, 1, false, false,
+};
+
 static void initializeRpmMacrosParser (const langType language)
 {
 
@@ -19,7 +440,8 @@ static void initializeRpmMacrosParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &RpmMacrosMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%([_a-zA-Z0-9]+)(\\([^)]*\\))*[^{\n\\\\]*([\n]|[\\\\][\n]|[{]|[\\\\])",
 	                               "\\1", "m", ""
@@ -35,22 +457,27 @@ static void initializeRpmMacrosParser (const langType language)
 		"        .\n"
 		"        /contline _tenter\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &RpmMacrosMatcher1);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &RpmMacrosMatcher2);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[\n]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &RpmMacrosMatcher3);
 	addLanguageTagMultiTableRegex (language, "contline",
 	                               "^(\n)",
 	                               "", "", "{tleave}"
 		"{{\n"
 		"   @1 end:\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &RpmMacrosMatcher4);
 	addLanguageTagMultiTableRegex (language, "contline",
 	                               "^[^\n]*([^\n])\n?",
 	                               "", "", ""
@@ -59,16 +486,20 @@ static void initializeRpmMacrosParser (const langType language)
 		"       1@ end:\n"
 		"       _tleave\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "mbody",
 	                               "^([^\\\\{}#]+)",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &RpmMacrosMatcher5);
 	addLanguageTagMultiTableRegex (language, "mbody",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &RpmMacrosMatcher6);
 	addLanguageTagMultiTableRegex (language, "mbody",
 	                               "^([{])",
-	                               "", "", "{tenter=mbody0}", NULL);
+	                               "", "", "{tenter=mbody0}", NULL,
+	                               &RpmMacrosMatcher7);
 	addLanguageTagMultiTableRegex (language, "mbody",
 	                               "^([}])",
 	                               "", "", "{tleave}"
@@ -78,25 +509,32 @@ static void initializeRpmMacrosParser (const langType language)
 		"    } {\n"
 		"        @1 end:\n"
 		"    } ifelse\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &RpmMacrosMatcher8);
 	addLanguageTagMultiTableRegex (language, "mbody",
 	                               "^\\\\.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &RpmMacrosMatcher9);
 	addLanguageTagMultiTableRegex (language, "mbody0",
 	                               "^[^\\\\{}#]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &RpmMacrosMatcher10);
 	addLanguageTagMultiTableRegex (language, "mbody0",
 	                               "^[{]",
-	                               "", "", "{tenter=mbody0}", NULL);
+	                               "", "", "{tenter=mbody0}", NULL,
+	                               &RpmMacrosMatcher11);
 	addLanguageTagMultiTableRegex (language, "mbody0",
 	                               "^#",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &RpmMacrosMatcher12);
 	addLanguageTagMultiTableRegex (language, "mbody0",
 	                               "^\\\\.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &RpmMacrosMatcher13);
 	addLanguageTagMultiTableRegex (language, "mbody0",
 	                               "^([}])",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &RpmMacrosMatcher14);
 }
 
 extern parserDefinition* RpmMacrosParser (void)
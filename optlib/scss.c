@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/scss.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/scss.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,1351 @@
 #include "xtag.h"
 
 
+static const unsigned char SCSSSet0 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SCSSSet1 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SCSSSet2 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SCSSSet3 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SCSSSet4 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SCSSSet5 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SCSSSet6 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x77, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SCSSSet7 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchSCSS0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SCSSSet0, *p))
+			p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '\n')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher0 = {
+	matchSCSS0, 0, false, false,
+};
+
+static bool matchSCSS1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher1 = {
+	matchSCSS1, 0, false, false,
+};
+
+static bool matchSCSS2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher2 = {
+	matchSCSS2, 0, false, false,
+};
+
+static bool matchSCSS3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher3 = {
+	matchSCSS3, 0, false, false,
+};
+
+static bool matchSCSS4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher4 = {
+	matchSCSS4, 0, false, false,
+};
+
+static bool matchSCSS5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || (*p != '\t' && *p != ' '))
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SCSSSet0, *p))
+			p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '\n')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher5 = {
+	matchSCSS5, 1, false, false,
+};
+
+static bool matchSCSS6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'x')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher6 = {
+	matchSCSS6, 1, false, false,
+};
+
+static bool matchSCSS7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher7 = {
+	matchSCSS7, 1, false, false,
+};
+
+static bool matchSCSS8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'h')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || (*p != '\t' && *p != ' '))
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher8 = {
+	matchSCSS8, 1, false, false,
+};
+
+static bool matchSCSS9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		q = p;
+		while (p < end && p - q < 1 && *p == '\n')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher9 = {
+	matchSCSS9, 0, false, false,
+};
+
+static bool matchSCSS10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet2, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != ';')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '\n')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher10 = {
+	matchSCSS10, 0, false, false,
+};
+
+static bool matchSCSS11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher11 = {
+	matchSCSS11, 0, false, false,
+};
+
+static bool matchSCSS12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == ':')
+			p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || !REGEX_SET_HAS (SCSSSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher12 = {
+	matchSCSS12, 1, false, false,
+};
+
+static bool matchSCSS13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher13 = {
+	matchSCSS13, 1, false, false,
+};
+
+static bool matchSCSS14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '$')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SCSSSet0, *p))
+			p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '\n')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher14 = {
+	matchSCSS14, 1, false, false,
+};
+
+static bool matchSCSS15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '.')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher15 = {
+	matchSCSS15, 1, false, false,
+};
+
+static bool matchSCSS16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher16 = {
+	matchSCSS16, 1, false, false,
+};
+
+static bool matchSCSS17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher17 = {
+	matchSCSS17, 1, false, false,
+};
+
+static bool matchSCSS18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (SCSSSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher18 = {
+	matchSCSS18, 0, false, false,
+};
+
+static bool matchSCSS19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher19 = {
+	matchSCSS19, 0, false, false,
+};
+
+static bool matchSCSS20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (SCSSSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher20 = {
+	matchSCSS20, 0, false, false,
+};
+
+static bool matchSCSS21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher21 = {
+	matchSCSS21, 0, false, false,
+};
+
+static bool matchSCSS22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (SCSSSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher22 = {
+	matchSCSS22, 0, false, false,
+};
+
+static bool matchSCSS23 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher23 = {
+	matchSCSS23, 0, false, false,
+};
+
+static bool matchSCSS24 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher24 = {
+	matchSCSS24, 0, false, false,
+};
+
+static bool matchSCSS25 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (SCSSSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher25 = {
+	matchSCSS25, 0, false, false,
+};
+
+static bool matchSCSS26 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SCSSSet0, *p))
+			p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '\n')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher26 = {
+	matchSCSS26, 0, false, false,
+};
+
+static bool matchSCSS27 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher27 = {
+	matchSCSS27, 0, false, false,
+};
+
+static bool matchSCSS28 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher28 = {
+	matchSCSS28, 0, false, false,
+};
+
+static bool matchSCSS29 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher29 = {
+	matchSCSS29, 0, false, false,
+};
+
+static bool matchSCSS30 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher30 = {
+	matchSCSS30, 1, false, false,
+};
+
+static bool matchSCSS31 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher31 = {
+	matchSCSS31, 0, false, false,
+};
+
+static bool matchSCSS32 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher32 = {
+	matchSCSS32, 0, false, false,
+};
+
+static bool matchSCSS33 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (SCSSSet5, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher33 = {
+	matchSCSS33, 0, false, false,
+};
+
+static bool matchSCSS34 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher34 = {
+	matchSCSS34, 0, false, false,
+};
+
+static bool matchSCSS35 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher35 = {
+	matchSCSS35, 0, false, false,
+};
+
+static bool matchSCSS36 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet6, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher36 = {
+	matchSCSS36, 0, false, false,
+};
+
+static bool matchSCSS37 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher37 = {
+	matchSCSS37, 0, false, false,
+};
+
+static bool matchSCSS38 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher38 = {
+	matchSCSS38, 0, false, false,
+};
+
+static bool matchSCSS39 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SCSSSet7, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SCSSMatcher39 = {
+	matchSCSS39, 0, false, false,
+};
+
 static void initializeSCSSParser (const langType language)
 {
 
@@ -21,139 +1366,184 @@ static void initializeSCSSParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^//[^\n]*\n?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher0);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &SCSSMatcher1);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^#\\{",
-	                               "", "", "{tenter=interp}", NULL);
+	                               "", "", "{tenter=interp}", NULL,
+	                               &SCSSMatcher2);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^'",
-	                               "", "", "{tenter=strs}", NULL);
+	                               "", "", "{tenter=strs}", NULL,
+	                               &SCSSMatcher3);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^\"",
-	                               "", "", "{tenter=strd}", NULL);
+	                               "", "", "{tenter=strd}", NULL,
+	                               &SCSSMatcher4);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[ \t]([A-Za-z0-9_-]+)[ \t]*:[^\n]*\n?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher5);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^@mixin[ \t]+([A-Za-z0-9_-]+)",
-	                               "\\1", "m", "{tenter=args}", NULL);
+	                               "\\1", "m", "{tenter=args}", NULL,
+	                               &SCSSMatcher6);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^@function[ \t]+([A-Za-z0-9_-]+)",
-	                               "\\1", "f", "{tenter=args}", NULL);
+	                               "\\1", "f", "{tenter=args}", NULL,
+	                               &SCSSMatcher7);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^@each[ \t]+\\$([A-Za-z0-9_-]+)[ \t]in[ \t]+",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               &SCSSMatcher8);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^@for[ \t]+\\$([A-Za-z0-9_-]+)[ \t]from[ \t]+.*[ \t]+(to|through)[ \t]+[^{]+",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^@[^\n]+\n?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher9);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^:[^{;]+;\n?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher10);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^:[^\n;{]+\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher11);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^::?([A-Za-z0-9_-]+)[ \t]*[,({]",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher12);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^:[^\n{]+[;{]\n?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^\\$([A-Za-z0-9_-]+)[ \t]*:[ \t]*\\(",
-	                               "\\1", "v", "{tenter=map}", NULL);
+	                               "\\1", "v", "{tenter=map}", NULL,
+	                               &SCSSMatcher13);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^\\$([A-Za-z0-9_-]+)[ \t]*:[^\n]*\n?",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               &SCSSMatcher14);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[.]([A-Za-z0-9_-]+)",
-	                               "\\1", "c", "", NULL);
+	                               "\\1", "c", "", NULL,
+	                               &SCSSMatcher15);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^%([A-Za-z0-9_-]+)",
-	                               "\\1", "P", "", NULL);
+	                               "\\1", "P", "", NULL,
+	                               &SCSSMatcher16);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^#([A-Za-z0-9_-]+)",
-	                               "\\1", "i", "", NULL);
+	                               "\\1", "i", "", NULL,
+	                               &SCSSMatcher17);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher18);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SCSSMatcher19);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher20);
 	addLanguageTagMultiTableRegex (language, "interp",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SCSSMatcher21);
 	addLanguageTagMultiTableRegex (language, "interp",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher22);
 	addLanguageTagMultiTableRegex (language, "args",
 	                               "^\\{",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SCSSMatcher23);
 	addLanguageTagMultiTableRegex (language, "args",
 	                               "^#\\{",
-	                               "", "", "{tenter=interp}", NULL);
+	                               "", "", "{tenter=interp}", NULL,
+	                               &SCSSMatcher24);
 	addLanguageTagMultiTableRegex (language, "args",
 	                               "^\\$([A-Za-z0-9_-]+)[ \t]*(:([ \t]*\\$)?|[,)])",
-	                               "\\1", "z", "", NULL);
+	                               "\\1", "z", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "args",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher25);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^//[^\n]*\n?",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher26);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &SCSSMatcher27);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^#\\{",
-	                               "", "", "{tenter=interp}", NULL);
+	                               "", "", "{tenter=interp}", NULL,
+	                               &SCSSMatcher28);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^\\)",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SCSSMatcher29);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^([A-Za-z0-9_-]+)[ \t]*:",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               &SCSSMatcher30);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^'",
-	                               "", "", "{tenter=strs}", NULL);
+	                               "", "", "{tenter=strs}", NULL,
+	                               &SCSSMatcher31);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^\"",
-	                               "", "", "{tenter=strd}", NULL);
+	                               "", "", "{tenter=strd}", NULL,
+	                               &SCSSMatcher32);
 	addLanguageTagMultiTableRegex (language, "map",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher33);
 	addLanguageTagMultiTableRegex (language, "strs",
 	                               "^'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SCSSMatcher34);
 	addLanguageTagMultiTableRegex (language, "strs",
 	                               "^#\\{",
-	                               "", "", "{tenter=interp}", NULL);
+	                               "", "", "{tenter=interp}", NULL,
+	                               &SCSSMatcher35);
 	addLanguageTagMultiTableRegex (language, "strs",
 	                               "^[^'#\\\\]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher36);
 	addLanguageTagMultiTableRegex (language, "strs",
 	                               "^\\\\?.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "strd",
 	                               "^\"",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SCSSMatcher37);
 	addLanguageTagMultiTableRegex (language, "strd",
 	                               "^#\\{",
-	                               "", "", "{tenter=interp}", NULL);
+	                               "", "", "{tenter=interp}", NULL,
+	                               &SCSSMatcher38);
 	addLanguageTagMultiTableRegex (language, "strd",
 	                               "^[^\"#\\\\]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SCSSMatcher39);
 	addLanguageTagMultiTableRegex (language, "strd",
 	                               "^\\\\?.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 }
 
 extern parserDefinition* SCSSParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/systemtap.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/systemtap.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,1886 @@
 #include "xtag.h"
 
 
+static const unsigned char SystemTapSet0 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x53, 0x7f, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0x3f, 0xff, 0xfe, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet1 [32] = {
+	0x00, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SystemTapSet2 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet3 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SystemTapSet4 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet5 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet6 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet7 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SystemTapSet8 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SystemTapSet9 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x73, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet10 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x73, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet11 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet12 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x53, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet13 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x53, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet14 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0x53, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet15 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char SystemTapSet16 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xf7, 0x7d, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet17 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xd7, 0x7d, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet18 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char SystemTapSet19 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchSystemTap0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher0 = {
+	matchSystemTap0, 0, false, false,
+};
+
+static bool matchSystemTap1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'b')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher1 = {
+	matchSystemTap1, 0, false, false,
+};
+
+static bool matchSystemTap2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '#')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher2 = {
+	matchSystemTap2, 0, false, false,
+};
+
+static bool matchSystemTap3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher3 = {
+	matchSystemTap3, 0, false, false,
+};
+
+static bool matchSystemTap4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher4 = {
+	matchSystemTap4, 0, false, false,
+};
+
+static bool matchSystemTap5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '@')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher5 = {
+	matchSystemTap5, 0, false, false,
+};
+
+static bool matchSystemTap6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'f')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher6 = {
+	matchSystemTap6, 0, false, false,
+};
+
+static bool matchSystemTap7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'g')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'b')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher7 = {
+	matchSystemTap7, 0, false, false,
+};
+
+static bool matchSystemTap8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher8 = {
+	matchSystemTap8, 1, false, false,
+};
+
+static bool matchSystemTap9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher9 = {
+	matchSystemTap9, 0, false, false,
+};
+
+static bool matchSystemTap10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher10 = {
+	matchSystemTap10, 0, false, false,
+};
+
+static bool matchSystemTap11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher11 = {
+	matchSystemTap11, 0, false, false,
+};
+
+static bool matchSystemTap12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher12 = {
+	matchSystemTap12, 0, false, false,
+};
+
+static bool matchSystemTap13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher13 = {
+	matchSystemTap13, 0, false, false,
+};
+
+static bool matchSystemTap14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (SystemTapSet4, *p))
+			p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher14 = {
+	matchSystemTap14, 0, false, false,
+};
+
+static bool matchSystemTap15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher15 = {
+	matchSystemTap15, 0, false, false,
+};
+
+static bool matchSystemTap16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher16 = {
+	matchSystemTap16, 0, false, false,
+};
+
+static bool matchSystemTap17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher17 = {
+	matchSystemTap17, 0, false, false,
+};
+
+static bool matchSystemTap18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher18 = {
+	matchSystemTap18, 0, false, false,
+};
+
+static bool matchSystemTap19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet6, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher19 = {
+	matchSystemTap19, 0, false, false,
+};
+
+static bool matchSystemTap20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ']')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher20 = {
+	matchSystemTap20, 0, false, false,
+};
+
+static bool matchSystemTap21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher21 = {
+	matchSystemTap21, 0, false, false,
+};
+
+static bool matchSystemTap22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet8, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		q = p;
+		while (p < end && p - q < 1 && *p == '+')
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher22 = {
+	matchSystemTap22, 1, false, false,
+};
+
+static bool matchSystemTap23 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet8, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher23 = {
+	matchSystemTap23, 1, false, false,
+};
+
+static bool matchSystemTap24 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet9, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher24 = {
+	matchSystemTap24, 0, false, false,
+};
+
+static bool matchSystemTap25 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher25 = {
+	matchSystemTap25, 0, false, false,
+};
+
+static bool matchSystemTap26 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet10, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher26 = {
+	matchSystemTap26, 0, false, false,
+};
+
+static bool matchSystemTap27 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher27 = {
+	matchSystemTap27, 0, false, false,
+};
+
+static bool matchSystemTap28 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher28 = {
+	matchSystemTap28, 0, false, false,
+};
+
+static bool matchSystemTap29 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet11, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher29 = {
+	matchSystemTap29, 0, false, false,
+};
+
+static bool matchSystemTap30 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet12, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher30 = {
+	matchSystemTap30, 0, false, false,
+};
+
+static bool matchSystemTap31 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher31 = {
+	matchSystemTap31, 0, false, false,
+};
+
+static bool matchSystemTap32 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher32 = {
+	matchSystemTap32, 1, false, false,
+};
+
+static bool matchSystemTap33 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher33 = {
+	matchSystemTap33, 0, false, false,
+};
+
+static bool matchSystemTap34 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet13, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher34 = {
+	matchSystemTap34, 0, false, false,
+};
+
+static bool matchSystemTap35 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher35 = {
+	matchSystemTap35, 0, false, false,
+};
+
+static bool matchSystemTap36 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher36 = {
+	matchSystemTap36, 1, false, false,
+};
+
+static bool matchSystemTap37 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher37 = {
+	matchSystemTap37, 0, false, false,
+};
+
+static bool matchSystemTap38 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher38 = {
+	matchSystemTap38, 0, false, false,
+};
+
+static bool matchSystemTap39 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet14, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher39 = {
+	matchSystemTap39, 0, false, false,
+};
+
+static bool matchSystemTap40 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher40 = {
+	matchSystemTap40, 0, false, false,
+};
+
+static bool matchSystemTap41 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher41 = {
+	matchSystemTap41, 1, false, false,
+};
+
+static bool matchSystemTap42 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher42 = {
+	matchSystemTap42, 1, false, false,
+};
+
+static bool matchSystemTap43 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher43 = {
+	matchSystemTap43, 0, false, false,
+};
+
+static bool matchSystemTap44 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet15, *p))
+			p++;
+		groups [1].end = p - s;
+		q = p;
+		while (p < end && p - q < 1 && *p == '%')
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher44 = {
+	matchSystemTap44, 1, false, false,
+};
+
+static bool matchSystemTap45 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher45 = {
+	matchSystemTap45, 0, false, false,
+};
+
+static bool matchSystemTap46 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ',')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher46 = {
+	matchSystemTap46, 0, false, false,
+};
+
+static bool matchSystemTap47 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '[')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher47 = {
+	matchSystemTap47, 0, false, false,
+};
+
+static bool matchSystemTap48 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet15, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher48 = {
+	matchSystemTap48, 1, false, false,
+};
+
+static bool matchSystemTap49 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (SystemTapSet7, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (SystemTapSet15, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (SystemTapSet1, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher49 = {
+	matchSystemTap49, 1, false, false,
+};
+
+static bool matchSystemTap50 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet16, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher50 = {
+	matchSystemTap50, 0, false, false,
+};
+
+static bool matchSystemTap51 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher51 = {
+	matchSystemTap51, 0, false, false,
+};
+
+static bool matchSystemTap52 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet17, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher52 = {
+	matchSystemTap52, 0, false, false,
+};
+
+static bool matchSystemTap53 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher53 = {
+	matchSystemTap53, 0, false, false,
+};
+
+static bool matchSystemTap54 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet14, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher54 = {
+	matchSystemTap54, 0, false, false,
+};
+
+static bool matchSystemTap55 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher55 = {
+	matchSystemTap55, 0, false, false,
+};
+
+static bool matchSystemTap56 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher56 = {
+	matchSystemTap56, 0, false, false,
+};
+
+static bool matchSystemTap57 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (SystemTapSet18, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher57 = {
+	matchSystemTap57, 0, false, false,
+};
+
+static bool matchSystemTap58 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher58 = {
+	matchSystemTap58, 0, false, false,
+};
+
+static bool matchSystemTap59 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (SystemTapSet19, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher SystemTapMatcher59 = {
+	matchSystemTap59, 0, false, false,
+};
+
 static void initializeSystemTapParser (const langType language)
 {
 
@@ -38,259 +1918,338 @@ static void initializeSystemTapParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^[^#/'\"pfg@%]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher0);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^probe[[:space:]]+",
-	                               "", "", "{tenter=probe}", NULL);
+	                               "", "", "{tenter=probe}", NULL,
+	                               &SystemTapMatcher1);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^@define[[:space:]]+",
-	                               "", "", "{tenter=macro}", NULL);
+	                               "", "", "{tenter=macro}", NULL,
+	                               &SystemTapMatcher5);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^function[[:space:]]+",
-	                               "", "", "{tenter=func}", NULL);
+	                               "", "", "{tenter=func}", NULL,
+	                               &SystemTapMatcher6);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^global[[:space:]]+",
-	                               "", "", "{tenter=vars}", NULL);
+	                               "", "", "{tenter=vars}", NULL,
+	                               &SystemTapMatcher7);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^(%\\{)",
 	                               "", "", "{tenter=cfuncStmt}"
 		"{{\n"
 		"    1@ true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher8);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^%\\(",
 	                               "", "", "{tenter=cfuncStmt}"
 		"{{\n"
 		"    false\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher9);
 	addLanguageTagMultiTableRegex (language, "main",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "any",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "skipWhiteSpace",
 	                               "^[ \t\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher11);
 	addLanguageTagMultiTableRegex (language, "skipLiteral",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "skipLiteral",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "ssliteral",
 	                               "^[^']*'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher14);
 	addLanguageTagMultiTableRegex (language, "ssliteral",
 	                               "^[^']+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher15);
 	addLanguageTagMultiTableRegex (language, "dsliteral",
 	                               "^[^\"\\\\]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher16);
 	addLanguageTagMultiTableRegex (language, "dsliteral",
 	                               "^\"",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher17);
 	addLanguageTagMultiTableRegex (language, "dsliteral",
 	                               "^\\\\.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher18);
 	addLanguageTagMultiTableRegex (language, "arraysize",
 	                               "^[^]/#]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher19);
 	addLanguageTagMultiTableRegex (language, "arraysize",
 	                               "^]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher20);
 	addLanguageTagMultiTableRegex (language, "arraysize",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "stmtend",
 	                               "^",
-	                               "", "", "{tleave}{scope=pop}", NULL);
+	                               "", "", "{tleave}{scope=pop}", NULL,
+	                               &SystemTapMatcher21);
 	addLanguageTagMultiTableRegex (language, "probe",
 	                               "^([[:alpha:]_][[:alnum:]_.]*)[[:space:]]*\\+?=[[:space:]]*",
-	                               "\\1", "p", "{tenter=probeBody}{scope=push}", NULL);
+	                               "\\1", "p", "{tenter=probeBody}{scope=push}", NULL,
+	                               &SystemTapMatcher22);
 	addLanguageTagMultiTableRegex (language, "probe",
 	                               "^([[:alpha:]_][[:alnum:]_.]*)[[:space:]]*",
-	                               "\\1", "p", "{_role=attached}{tenter=probeBody}{scope=push}", NULL);
+	                               "\\1", "p", "{_role=attached}{tenter=probeBody}{scope=push}", NULL,
+	                               &SystemTapMatcher23);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^[^\\{/#'\"]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher24);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^\\{",
-	                               "", "", "{tenter=probeStmt,stmtend}", NULL);
+	                               "", "", "{tenter=probeStmt,stmtend}", NULL,
+	                               &SystemTapMatcher25);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "probeBody",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^[^\\{\\}/#'\"]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher26);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher27);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^\\{",
-	                               "", "", "{tenter=probeStmt}", NULL);
+	                               "", "", "{tenter=probeStmt}", NULL,
+	                               &SystemTapMatcher28);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "probeStmt",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "func",
 	                               "^([[:alpha:]_][[:alnum:]_]*)(:[[:alpha:]_][[:alnum:]_]*)?[[:space:]]*\\(",
-	                               "\\1", "f", "{tenter=funcSig,funcBody}{scope=push}", NULL);
+	                               "\\1", "f", "{tenter=funcSig,funcBody}{scope=push}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "funcSig",
 	                               "^[^)/]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher29);
 	addLanguageTagMultiTableRegex (language, "funcSig",
 	                               "^\\)(:[0-9]+)?",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "funcSig",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "funcSig",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "funcSig",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "funcSig",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^[^\\{%'\"#]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher30);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^\\{",
-	                               "", "", "{tenter=funcStmt,stmtend}", NULL);
+	                               "", "", "{tenter=funcStmt,stmtend}", NULL,
+	                               &SystemTapMatcher31);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^(%\\{)",
 	                               "", "", "{tenter=cfuncStmt,stmtend}"
 		"{{\n"
 		"    1@ true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher32);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^%\\(",
 	                               "", "", "{tenter=cfuncStmt,stmtend}"
 		"{{\n"
 		"    false\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher33);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "funcBody",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^[^%/#'\"\\{\\}]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher34);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher35);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^(%\\{)",
 	                               "", "", "{tenter=cfuncStmt}"
 		"{{\n"
 		"    1@ true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher36);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^%\\(",
 	                               "", "", "{tenter=cfuncStmt}"
 		"{{\n"
 		"    false\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher37);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^\\{",
-	                               "", "", "{tenter=funcStmt}", NULL);
+	                               "", "", "{tenter=funcStmt}", NULL,
+	                               &SystemTapMatcher38);
 	addLanguageTagMultiTableRegex (language, "funcStmt",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^[^%/#'\"]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher39);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^%\\)",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher40);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^(%\\})",
 	                               "", "", "{tleave}"
@@ -301,136 +2260,178 @@ static void initializeSystemTapParser (const langType language)
 		"        % However, we have not implemented such a feature yet.\n"
 		"        (CPreProcessor) exch @1 _makepromise { pop } if\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher41);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^(%\\{)",
 	                               "", "", "{tenter=cfuncStmt}"
 		"{{\n"
 		"    1@ true\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher42);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^%\\(",
 	                               "", "", "{tenter=cfuncStmt}"
 		"{{\n"
 		"    false\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &SystemTapMatcher43);
 	addLanguageTagMultiTableRegex (language, "cfuncStmt",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^([[:alpha:]_][[:alnum:]_]*)%?",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               &SystemTapMatcher44);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^[\n]",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher45);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^,[[:space:]]*",
-	                               "", "", "{tjump=vars}", NULL);
+	                               "", "", "{tjump=vars}", NULL,
+	                               &SystemTapMatcher46);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^\\[",
-	                               "", "", "{tenter=arraysize}", NULL);
+	                               "", "", "{tenter=arraysize}", NULL,
+	                               &SystemTapMatcher47);
 	addLanguageTagMultiTableRegex (language, "vars",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "macro",
 	                               "^([[:alpha:]_][[:alnum:]_]*)[[:space:]]*\\(",
-	                               "\\1", "m", "{tenter=macroSig,macroBody}{scope=push}", NULL);
+	                               "\\1", "m", "{tenter=macroSig,macroBody}{scope=push}", NULL,
+	                               &SystemTapMatcher48);
 	addLanguageTagMultiTableRegex (language, "macro",
 	                               "^([[:alpha:]_][[:alnum:]_]*)[[:space:]]*",
-	                               "\\1", "m", "{tenter=macroBody,stmtend}{scope=push}", NULL);
+	                               "\\1", "m", "{tenter=macroBody,stmtend}{scope=push}", NULL,
+	                               &SystemTapMatcher49);
 	addLanguageTagMultiTableRegex (language, "macroSig",
 	                               "^[^#/)]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher50);
 	addLanguageTagMultiTableRegex (language, "macroSig",
 	                               "^\\)",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher51);
 	addLanguageTagMultiTableRegex (language, "macroSig",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "macroSig",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "macroSig",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "macroSig",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "macroBody",
 	                               "^[^%#/)]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher52);
 	addLanguageTagMultiTableRegex (language, "macroBody",
 	                               "^%\\(",
-	                               "", "", "{tenter=macroStmt,stmtend}", NULL);
+	                               "", "", "{tenter=macroStmt,stmtend}", NULL,
+	                               &SystemTapMatcher53);
 	addLanguageTagMultiTableRegex (language, "macroBody",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "macroBody",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "macroBody",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "macroBody",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^[^#/%'\"]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher54);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^%\\)",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher55);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^\"",
-	                               "", "", "{tenter=dsliteral}", NULL);
+	                               "", "", "{tenter=dsliteral}", NULL,
+	                               &SystemTapMatcher12);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^'",
-	                               "", "", "{tenter=ssliteral}", NULL);
+	                               "", "", "{tenter=ssliteral}", NULL,
+	                               &SystemTapMatcher13);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^\\#",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher2);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment_multiline}", NULL);
+	                               "", "", "{tenter=comment_multiline}", NULL,
+	                               &SystemTapMatcher3);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^//",
-	                               "", "", "{tenter=comment_oneline}", NULL);
+	                               "", "", "{tenter=comment_oneline}", NULL,
+	                               &SystemTapMatcher4);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^%\\(",
-	                               "", "", "{tenter=macroStmt}", NULL);
+	                               "", "", "{tenter=macroStmt}", NULL,
+	                               &SystemTapMatcher56);
 	addLanguageTagMultiTableRegex (language, "macroStmt",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "comment_multiline",
 	                               "^[^*]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher57);
 	addLanguageTagMultiTableRegex (language, "comment_multiline",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher58);
 	addLanguageTagMultiTableRegex (language, "comment_multiline",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 	addLanguageTagMultiTableRegex (language, "comment_oneline",
 	                               "^[^\n]*\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &SystemTapMatcher59);
 	addLanguageTagMultiTableRegex (language, "comment_oneline",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &SystemTapMatcher10);
 }
 
 extern parserDefinition* SystemTapParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/terraform.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/terraform.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,818 @@
 #include "xtag.h"
 
 
+static const unsigned char TerraformSet0 [32] = {
+	0x00, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char TerraformSet1 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char TerraformSet2 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char TerraformSet3 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchTerraform0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (end - p >= 1
+		    && p [0] == '#')
+			p += 1;
+		else if (end - p >= 2
+		    && p [0] == '/'
+		    && p [1] == '/')
+			p += 2;
+		else
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher0 = {
+	matchTerraform0, 1, false, false,
+};
+
+static bool matchTerraform1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher1 = {
+	matchTerraform1, 0, false, false,
+};
+
+static bool matchTerraform2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (TerraformSet0, *p))
+			p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher2 = {
+	matchTerraform2, 0, false, false,
+};
+
+static bool matchTerraform3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 's')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'c')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [2].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [2].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher3 = {
+	matchTerraform3, 2, false, false,
+};
+
+static bool matchTerraform4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [2].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [2].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher4 = {
+	matchTerraform4, 2, false, false,
+};
+
+static bool matchTerraform5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'v')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'a')
+			goto next;
+		p++;
+		if (p == end || *p != 'b')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher5 = {
+	matchTerraform5, 1, false, false,
+};
+
+static bool matchTerraform6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'v')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'r')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher6 = {
+	matchTerraform6, 1, false, false,
+};
+
+static bool matchTerraform7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'm')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'd')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'l')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher7 = {
+	matchTerraform7, 1, false, false,
+};
+
+static bool matchTerraform8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'p')
+			goto next;
+		p++;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (TerraformSet0, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet1, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher8 = {
+	matchTerraform8, 1, false, false,
+};
+
+static bool matchTerraform9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (TerraformSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher9 = {
+	matchTerraform9, 0, false, false,
+};
+
+static bool matchTerraform10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher10 = {
+	matchTerraform10, 0, false, false,
+};
+
+static bool matchTerraform11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher11 = {
+	matchTerraform11, 0, false, false,
+};
+
+static bool matchTerraform12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (TerraformSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher12 = {
+	matchTerraform12, 0, false, false,
+};
+
+static bool matchTerraform13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher13 = {
+	matchTerraform13, 0, false, false,
+};
+
+static bool matchTerraform14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher14 = {
+	matchTerraform14, 0, false, false,
+};
+
+static bool matchTerraform15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (end - p >= 1
+		    && p [0] == '#')
+			p += 1;
+		else if (end - p >= 2
+		    && p [0] == '/'
+		    && p [1] == '/')
+			p += 2;
+		else
+			goto next;
+		groups [1].end = p - s;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher15 = {
+	matchTerraform15, 1, false, false,
+};
+
+static bool matchTerraform16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher16 = {
+	matchTerraform16, 0, false, false,
+};
+
+static bool matchTerraform17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (TerraformSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher17 = {
+	matchTerraform17, 0, false, false,
+};
+
+static bool matchTerraform18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher18 = {
+	matchTerraform18, 0, false, false,
+};
+
+static bool matchTerraform19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (TerraformSet2, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformMatcher19 = {
+	matchTerraform19, 0, false, false,
+};
+
 static void initializeTerraformParser (const langType language)
 {
 
@@ -18,67 +830,88 @@ static void initializeTerraformParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^(\\#|//)",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &TerraformMatcher0);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^/\\*",
-	                               "", "", "{tenter=multicomment}", NULL);
+	                               "", "", "{tenter=multicomment}", NULL,
+	                               &TerraformMatcher1);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^locals[[:space:]]*\\{",
-	                               "", "", "{tenter=locals}", NULL);
+	                               "", "", "{tenter=locals}", NULL,
+	                               &TerraformMatcher2);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^resource[[:space:]]\"([^\"]+)\"[[:space:]]\"([^\"]+)\"",
-	                               "\\2", "r", "", NULL);
+	                               "\\2", "r", "", NULL,
+	                               &TerraformMatcher3);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^data[[:space:]]\"([^\"]+)\"[[:space:]]\"([^\"]+)\"",
-	                               "\\2", "d", "", NULL);
+	                               "\\2", "d", "", NULL,
+	                               &TerraformMatcher4);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^variable[[:space:]]\"([^\"]+)\"",
-	                               "\\1", "v", "", NULL);
+	                               "\\1", "v", "", NULL,
+	                               &TerraformMatcher5);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^provider[[:space:]]\"([^\"]+)\"",
-	                               "\\1", "p", "", NULL);
+	                               "\\1", "p", "", NULL,
+	                               &TerraformMatcher6);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^module[[:space:]]\"([^\"]+)\"",
-	                               "\\1", "m", "", NULL);
+	                               "\\1", "m", "", NULL,
+	                               &TerraformMatcher7);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^output[[:space:]]\"([^\"]+)\"",
-	                               "\\1", "o", "", NULL);
+	                               "\\1", "o", "", NULL,
+	                               &TerraformMatcher8);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &TerraformMatcher9);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[^\n]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &TerraformMatcher10);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\n",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &TerraformMatcher11);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &TerraformMatcher12);
 	addLanguageTagMultiTableRegex (language, "locals",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &TerraformMatcher13);
 	addLanguageTagMultiTableRegex (language, "locals",
 	                               "^\\{",
-	                               "", "", "{tenter=locals}", NULL);
+	                               "", "", "{tenter=locals}", NULL,
+	                               &TerraformMatcher14);
 	addLanguageTagMultiTableRegex (language, "locals",
 	                               "^(\\#|//)",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &TerraformMatcher15);
 	addLanguageTagMultiTableRegex (language, "locals",
 	                               "^/\\*",
-	                               "", "", "{tenter=multicomment}", NULL);
+	                               "", "", "{tenter=multicomment}", NULL,
+	                               &TerraformMatcher16);
 	addLanguageTagMultiTableRegex (language, "locals",
 	                               "^([a-z0-9_]+)+[[:space:]]*=[[:space:]]+",
-	                               "\\1", "l", "", NULL);
+	                               "\\1", "l", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "locals",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &TerraformMatcher17);
 	addLanguageTagMultiTableRegex (language, "multicomment",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &TerraformMatcher18);
 	addLanguageTagMultiTableRegex (language, "multicomment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &TerraformMatcher19);
 }
 
 extern parserDefinition* TerraformParser (void)
@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/terraformvariables.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/terraformvariables.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -9,8 +9,62 @@
 #include "dependency.h"
 
 
-static void initializeTerraformVariablesParser (const langType language CTAGS_ATTR_UNUSED)
+static const unsigned char TerraformVariablesSet0 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0x00, 0x00, 0x00, 0x80, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char TerraformVariablesSet1 [32] = {
+	0x00, 0x3e, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static bool matchTerraformVariables0 (const char *input, size_t size, regexSpan *groups)
 {
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		q = p;
+		while (p < end && REGEX_SET_HAS (TerraformVariablesSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (TerraformVariablesSet1, *p))
+			p++;
+		if (p == end || *p != '=')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		while (start < end && *start != '\n')
+			start++;
+		if (start++ == end)
+			break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher TerraformVariablesMatcher0 = {
+	matchTerraformVariables0, 1, true, false,
+};
+
+static void initializeTerraformVariablesParser (const langType language)
+{
+
+
 }
 
 extern parserDefinition* TerraformVariablesParser (void)
@@ -30,7 +84,7 @@ extern parserDefinition* TerraformVariablesParser (void)
 
 	static tagRegexTable TerraformVariablesTagRegexTable [] = {
 		{"^([a-z0-9_]+)[[:space:]]*=", "\\1",
-		"v", "{_role=assigned}{_language=Terraform}", NULL, false},
+		"v", "{_role=assigned}{_language=Terraform}", NULL, false, &TerraformVariablesMatcher0},
 	};
 
 	static parserDependency TerraformVariablesDependencies [] = {
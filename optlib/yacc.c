@@ -1,5 +1,5 @@
 /*
- * Generated by ./misc/optlib2c from optlib/yacc.ctags, Don't edit this manually.
+ * Generated by misc/optlib2c from optlib/yacc.ctags, Don't edit this manually.
  */
 #include "general.h"
 #include "parse.h"
@@ -8,6 +8,1436 @@
 #include "xtag.h"
 
 
+static const unsigned char YACCSet0 [32] = {
+	0x00, 0x06, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char YACCSet1 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet2 [32] = {
+	0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet3 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet4 [32] = {
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet5 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet6 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char YACCSet7 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char YACCSet8 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char YACCSet9 [32] = {
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x03,
+	0xfe, 0xff, 0xff, 0x87, 0xfe, 0xff, 0xff, 0x07,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const unsigned char YACCSet10 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xd7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet11 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet12 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf7,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const unsigned char YACCSet13 [32] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static bool matchYACC0 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher0 = {
+	matchYACC0, 0, false, false,
+};
+
+static bool matchYACC1 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != 't')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'k')
+			goto next;
+		p++;
+		if (p == end || *p != 'e')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet0, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher1 = {
+	matchYACC1, 0, false, false,
+};
+
+static bool matchYACC2 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (p == end || *p != 'u')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		if (p == end || *p != 'i')
+			goto next;
+		p++;
+		if (p == end || *p != 'o')
+			goto next;
+		p++;
+		if (p == end || *p != 'n')
+			goto next;
+		p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (YACCSet1, *p))
+			p++;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher2 = {
+	matchYACC2, 1, false, false,
+};
+
+static bool matchYACC3 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [1].start = p - s;
+		if (end - p >= 4
+		    && p [0] == 't'
+		    && p [1] == 'y'
+		    && p [2] == 'p'
+		    && p [3] == 'e')
+			p += 4;
+		else if (end - p >= 5
+		    && p [0] == 'n'
+		    && p [1] == 't'
+		    && p [2] == 'e'
+		    && p [3] == 'r'
+		    && p [4] == 'm')
+			p += 5;
+		else
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (YACCSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher3 = {
+	matchYACC3, 1, false, false,
+};
+
+static bool matchYACC4 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher4 = {
+	matchYACC4, 0, false, false,
+};
+
+static bool matchYACC5 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		while (p < end && REGEX_SET_HAS (YACCSet2, *p))
+			p++;
+		if (p == end || *p != '\n')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher5 = {
+	matchYACC5, 0, false, false,
+};
+
+static bool matchYACC6 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet3, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher6 = {
+	matchYACC6, 0, false, false,
+};
+
+static bool matchYACC7 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher7 = {
+	matchYACC7, 0, false, false,
+};
+
+static bool matchYACC8 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher8 = {
+	matchYACC8, 0, false, false,
+};
+
+static bool matchYACC9 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet5, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher9 = {
+	matchYACC9, 0, false, false,
+};
+
+static bool matchYACC10 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher10 = {
+	matchYACC10, 0, false, false,
+};
+
+static bool matchYACC11 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher11 = {
+	matchYACC11, 0, false, false,
+};
+
+static bool matchYACC12 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher12 = {
+	matchYACC12, 0, false, false,
+};
+
+static bool matchYACC13 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (YACCSet6, *p))
+			goto next;
+		p++;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet7, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (YACCSet0, *p))
+			p++;
+		if (p == end || *p != ':')
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (YACCSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher13 = {
+	matchYACC13, 1, false, false,
+};
+
+static bool matchYACC14 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher14 = {
+	matchYACC14, 0, false, false,
+};
+
+static bool matchYACC15 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet4, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher15 = {
+	matchYACC15, 0, false, false,
+};
+
+static bool matchYACC16 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && p - q < 1 && *p == 'N')
+			p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher16 = {
+	matchYACC16, 0, false, false,
+};
+
+static bool matchYACC17 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (YACCSet8, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (YACCSet9, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (YACCSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher17 = {
+	matchYACC17, 1, false, false,
+};
+
+static bool matchYACC18 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher18 = {
+	matchYACC18, 0, false, false,
+};
+
+static bool matchYACC19 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher19 = {
+	matchYACC19, 0, false, false,
+};
+
+static bool matchYACC20 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher20 = {
+	matchYACC20, 0, false, false,
+};
+
+static bool matchYACC21 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet10, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher21 = {
+	matchYACC21, 0, false, false,
+};
+
+static bool matchYACC22 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher22 = {
+	matchYACC22, 0, false, false,
+};
+
+static bool matchYACC23 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher23 = {
+	matchYACC23, 0, false, false,
+};
+
+static bool matchYACC24 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '/')
+			goto next;
+		p++;
+		if (p == end || *p != '*')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher24 = {
+	matchYACC24, 0, false, false,
+};
+
+static bool matchYACC25 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher25 = {
+	matchYACC25, 0, false, false,
+};
+
+static bool matchYACC26 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher26 = {
+	matchYACC26, 0, false, false,
+};
+
+static bool matchYACC27 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet11, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher27 = {
+	matchYACC27, 0, false, false,
+};
+
+static bool matchYACC28 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher28 = {
+	matchYACC28, 0, false, false,
+};
+
+static bool matchYACC29 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher29 = {
+	matchYACC29, 0, false, false,
+};
+
+static bool matchYACC30 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher30 = {
+	matchYACC30, 0, false, false,
+};
+
+static bool matchYACC31 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ')')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher31 = {
+	matchYACC31, 0, false, false,
+};
+
+static bool matchYACC32 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher32 = {
+	matchYACC32, 0, false, false,
+};
+
+static bool matchYACC33 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && REGEX_SET_HAS (YACCSet12, *p))
+			p++;
+		if (p - q < 1)
+			goto next;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher33 = {
+	matchYACC33, 0, false, false,
+};
+
+static bool matchYACC34 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '{')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher34 = {
+	matchYACC34, 0, false, false,
+};
+
+static bool matchYACC35 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != ';')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher35 = {
+	matchYACC35, 0, false, false,
+};
+
+static bool matchYACC36 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher36 = {
+	matchYACC36, 0, false, false,
+};
+
+static bool matchYACC37 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '}')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher37 = {
+	matchYACC37, 0, false, false,
+};
+
+static bool matchYACC38 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+	const unsigned char *q;
+
+	while (true)
+	{
+		p = start;
+		q = p;
+		while (p < end && p - q < 1 && *p == 'N')
+			p++;
+		if (p == end || *p != '_')
+			goto next;
+		p++;
+		while (p < end && (*p == '\t' || *p == ' '))
+			p++;
+		if (p == end || *p != '(')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher38 = {
+	matchYACC38, 0, false, false,
+};
+
+static bool matchYACC39 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		groups [1].start = p - s;
+		if (p == end || !REGEX_SET_HAS (YACCSet8, *p))
+			goto next;
+		p++;
+		while (p < end && REGEX_SET_HAS (YACCSet9, *p))
+			p++;
+		groups [1].end = p - s;
+		while (p < end && REGEX_SET_HAS (YACCSet0, *p))
+			p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher39 = {
+	matchYACC39, 1, false, false,
+};
+
+static bool matchYACC40 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '"')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher40 = {
+	matchYACC40, 0, false, false,
+};
+
+static bool matchYACC41 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher41 = {
+	matchYACC41, 0, false, false,
+};
+
+static bool matchYACC42 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '%')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher42 = {
+	matchYACC42, 0, false, false,
+};
+
+static bool matchYACC43 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet13, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher43 = {
+	matchYACC43, 0, false, false,
+};
+
+static bool matchYACC44 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\\')
+			goto next;
+		p++;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher44 = {
+	matchYACC44, 0, false, false,
+};
+
+static bool matchYACC45 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || *p != '\'')
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher45 = {
+	matchYACC45, 0, false, false,
+};
+
+static bool matchYACC46 (const char *input, size_t size, regexSpan *groups)
+{
+	const unsigned char *const s = (const unsigned char *) input;
+	const unsigned char *const end = s + size;
+	const unsigned char *start = s, *p;
+
+	while (true)
+	{
+		p = start;
+		if (p == end || !REGEX_SET_HAS (YACCSet4, *p))
+			goto next;
+		p++;
+		groups [0].start = start - s;
+		groups [0].end = p - s;
+		return true;
+	next:
+		break;
+	}
+	return false;
+}
+
+static const tagRegexMatcher YACCMatcher46 = {
+	matchYACC46, 0, false, false,
+};
+
 static void initializeYACCParser (const langType language)
 {
 	addLanguageOptscriptToHook (language, SCRIPT_HOOK_PRELUDE,
@@ -32,52 +1462,66 @@ static void initializeYACCParser (const langType language)
 
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &YACCMatcher0);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^%token[ \t\n]+",
 	                               "", "", "{tenter=token}"
 		"{{\n"
 		"    /token-type false def\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher1);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^%(union)[^\\{]*\\{",
-	                               "", "", "{tenter=cUnion}{_guest=C,1start,}", NULL);
+	                               "", "", "{tenter=cUnion}{_guest=C,1start,}", NULL,
+	                               &YACCMatcher2);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^%(code[^\\{]*)?\\{",
-	                               "", "", "{tenter=cPrologue}{_guest=C,0end,}", NULL);
+	                               "", "", "{tenter=cPrologue}{_guest=C,0end,}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^%(type|nterm)[ \n\t]*",
 	                               "", "", "{tenter=type}"
 		"{{\n"
 		"    /token-type false def\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher3);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^%%",
-	                               "", "", "{tjump=grammar}", NULL);
+	                               "", "", "{tjump=grammar}", NULL,
+	                               &YACCMatcher4);
 	addLanguageTagMultiTableRegex (language, "toplevel",
 	                               "^[^\n]*\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher5);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^[^*]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher6);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^\\*/",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher7);
 	addLanguageTagMultiTableRegex (language, "comment",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher8);
 	addLanguageTagMultiTableRegex (language, "cPrologue",
 	                               "^[^%]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher9);
 	addLanguageTagMultiTableRegex (language, "cPrologue",
 	                               "^%\\}",
-	                               "", "", "{tleave}{_guest=,,0start}", NULL);
+	                               "", "", "{tleave}{_guest=,,0start}", NULL,
+	                               &YACCMatcher10);
 	addLanguageTagMultiTableRegex (language, "cPrologue",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher11);
 	addLanguageTagMultiTableRegex (language, "grammar",
 	                               "^%%",
-	                               "", "", "{tjump=cEpilogue}{_guest=C,0end,}", NULL);
+	                               "", "", "{tjump=cEpilogue}{_guest=C,0end,}", NULL,
+	                               &YACCMatcher12);
 	addLanguageTagMultiTableRegex (language, "grammar",
 	                               "^([a-zA-Z_.][-a-zA-Z_.0-9]+)[ \t\n]*:[ \t\n]*",
 	                               "\\1", "l", "{tenter=rule}"
@@ -85,16 +1529,20 @@ static void initializeYACCParser (const langType language)
 		"    type-dict \\1 known {\n"
 		"        type-dict \\1 get . exch typeref:\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher13);
 	addLanguageTagMultiTableRegex (language, "grammar",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher14);
 	addLanguageTagMultiTableRegex (language, "cEpilogue",
 	                               "^.+",
-	                               "", "", "{_guest=,,0end}", NULL);
+	                               "", "", "{_guest=,,0end}", NULL,
+	                               &YACCMatcher15);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^N?_[ \t]*\\(",
-	                               "", "", "{tenter=iString}", NULL);
+	                               "", "", "{tenter=iString}", NULL,
+	                               &YACCMatcher16);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^([_a-zA-Z][_a-zA-Z0-9]*)[ \t\n]*",
 	                               "\\1", "t", ""
@@ -102,115 +1550,150 @@ static void initializeYACCParser (const langType language)
 		"    token-type false ne {\n"
 		"        . token-type typeref:\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher17);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^<[ \t]*([_a-zA-Z][_a-zA-Z0-9 *]*)[ \t]*>[ \t\n]*",
 	                               "", "", ""
 		"{{\n"
 		"    /token-type \\1 def\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^\"",
-	                               "", "", "{tenter=cString}", NULL);
+	                               "", "", "{tenter=cString}", NULL,
+	                               &YACCMatcher18);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^'",
-	                               "", "", "{tenter=cCharlit}", NULL);
+	                               "", "", "{tenter=cCharlit}", NULL,
+	                               &YACCMatcher19);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^-?[ \t\n]*(0x)?[0-9]+[ \t\n]*",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^%",
 	                               "", "", "{tleave}{_advanceTo=0start}"
 		"{{\n"
 		"    /token-type false def\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher20);
 	addLanguageTagMultiTableRegex (language, "token",
 	                               "^.|\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "cUnion",
 	                               "^[^\"/\\{\\}]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher21);
 	addLanguageTagMultiTableRegex (language, "cUnion",
 	                               "^\"",
-	                               "", "", "{tenter=cString}", NULL);
+	                               "", "", "{tenter=cString}", NULL,
+	                               &YACCMatcher22);
 	addLanguageTagMultiTableRegex (language, "cUnion",
 	                               "^'",
-	                               "", "", "{tenter=cCharlit}", NULL);
+	                               "", "", "{tenter=cCharlit}", NULL,
+	                               &YACCMatcher23);
 	addLanguageTagMultiTableRegex (language, "cUnion",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &YACCMatcher24);
 	addLanguageTagMultiTableRegex (language, "cUnion",
 	                               "^\\{",
-	                               "", "", "{tenter=cAction}", NULL);
+	                               "", "", "{tenter=cAction}", NULL,
+	                               &YACCMatcher25);
 	addLanguageTagMultiTableRegex (language, "cUnion",
 	                               "^\\}",
-	                               "", "", "{tleave}{_guest=,,0end}{tleave}", NULL);
+	                               "", "", "{tleave}{_guest=,,0end}{tleave}", NULL,
+	                               &YACCMatcher26);
 	addLanguageTagMultiTableRegex (language, "cString",
 	                               "^[^\\\\\"]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher27);
 	addLanguageTagMultiTableRegex (language, "cString",
 	                               "^\\\\.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher28);
 	addLanguageTagMultiTableRegex (language, "cString",
 	                               "^\"",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher29);
 	addLanguageTagMultiTableRegex (language, "iString",
 	                               "^\"",
-	                               "", "", "{tenter=cString}", NULL);
+	                               "", "", "{tenter=cString}", NULL,
+	                               &YACCMatcher30);
 	addLanguageTagMultiTableRegex (language, "iString",
 	                               "^\\)",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher31);
 	addLanguageTagMultiTableRegex (language, "iString",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher32);
 	addLanguageTagMultiTableRegex (language, "rule",
 	                               "^[^\\{;]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher33);
 	addLanguageTagMultiTableRegex (language, "rule",
 	                               "^\\{",
-	                               "", "", "{tenter=cAction}", NULL);
+	                               "", "", "{tenter=cAction}", NULL,
+	                               &YACCMatcher34);
 	addLanguageTagMultiTableRegex (language, "rule",
 	                               "^;",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher35);
 	addLanguageTagMultiTableRegex (language, "rule",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher36);
 	addLanguageTagMultiTableRegex (language, "cActionCommon",
 	                               "^[^\"/\\{\\}]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher21);
 	addLanguageTagMultiTableRegex (language, "cActionCommon",
 	                               "^\"",
-	                               "", "", "{tenter=cString}", NULL);
+	                               "", "", "{tenter=cString}", NULL,
+	                               &YACCMatcher22);
 	addLanguageTagMultiTableRegex (language, "cActionCommon",
 	                               "^'",
-	                               "", "", "{tenter=cCharlit}", NULL);
+	                               "", "", "{tenter=cCharlit}", NULL,
+	                               &YACCMatcher23);
 	addLanguageTagMultiTableRegex (language, "cActionCommon",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &YACCMatcher24);
 	addLanguageTagMultiTableRegex (language, "cActionCommon",
 	                               "^\\{",
-	                               "", "", "{tenter=cAction}", NULL);
+	                               "", "", "{tenter=cAction}", NULL,
+	                               &YACCMatcher25);
 	addLanguageTagMultiTableRegex (language, "cAction",
 	                               "^[^\"/\\{\\}]+",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher21);
 	addLanguageTagMultiTableRegex (language, "cAction",
 	                               "^\"",
-	                               "", "", "{tenter=cString}", NULL);
+	                               "", "", "{tenter=cString}", NULL,
+	                               &YACCMatcher22);
 	addLanguageTagMultiTableRegex (language, "cAction",
 	                               "^'",
-	                               "", "", "{tenter=cCharlit}", NULL);
+	                               "", "", "{tenter=cCharlit}", NULL,
+	                               &YACCMatcher23);
 	addLanguageTagMultiTableRegex (language, "cAction",
 	                               "^/\\*",
-	                               "", "", "{tenter=comment}", NULL);
+	                               "", "", "{tenter=comment}", NULL,
+	                               &YACCMatcher24);
 	addLanguageTagMultiTableRegex (language, "cAction",
 	                               "^\\{",
-	                               "", "", "{tenter=cAction}", NULL);
+	                               "", "", "{tenter=cAction}", NULL,
+	                               &YACCMatcher25);
 	addLanguageTagMultiTableRegex (language, "cAction",
 	                               "^\\}",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher37);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^N?_[ \t]*\\(",
-	                               "", "", "{tenter=iString}", NULL);
+	                               "", "", "{tenter=iString}", NULL,
+	                               &YACCMatcher38);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^([_a-zA-Z][_a-zA-Z0-9]*)[ \t\n]*",
 	                               "", "", ""
@@ -218,40 +1701,50 @@ static void initializeYACCParser (const langType language)
 		"    token-type false ne {\n"
 		"        type-dict \\1 token-type put\n"
 		"    } if\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher39);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^<[ \t]*([_a-zA-Z][_a-zA-Z0-9 *]*)[ \t]*>[ \t\n]*",
 	                               "", "", ""
 		"{{\n"
 		"    /token-type \\1 def\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^\"",
-	                               "", "", "{tenter=cString}", NULL);
+	                               "", "", "{tenter=cString}", NULL,
+	                               &YACCMatcher40);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^'",
-	                               "", "", "{tenter=cCharlit}", NULL);
+	                               "", "", "{tenter=cCharlit}", NULL,
+	                               &YACCMatcher41);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^%",
 	                               "", "", "{tleave}{_advanceTo=0start}"
 		"{{\n"
 		"    /token-type false def\n"
-		"}}", NULL);
+		"}}", NULL,
+	                               &YACCMatcher42);
 	addLanguageTagMultiTableRegex (language, "type",
 	                               "^.|\n",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               NULL);
 	addLanguageTagMultiTableRegex (language, "cCharlit",
 	                               "^[^\\\\]'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher43);
 	addLanguageTagMultiTableRegex (language, "cCharlit",
 	                               "^\\\\.'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher44);
 	addLanguageTagMultiTableRegex (language, "cCharlit",
 	                               "^'",
-	                               "", "", "{tleave}", NULL);
+	                               "", "", "{tleave}", NULL,
+	                               &YACCMatcher45);
 	addLanguageTagMultiTableRegex (language, "cCharlit",
 	                               "^.",
-	                               "", "", "", NULL);
+	                               "", "", "", NULL,
+	                               &YACCMatcher46);
 }
 
 extern parserDefinition* YACCParser (void)
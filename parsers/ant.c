@@ -119,7 +119,7 @@ static tagXpathTable antXpathTargetNameTable [] = {
 };
 
 static tagXpathTableTable antXpathTableTable[] = {
-	[TABLE_MAIN]        = { ARRAY_AND_SIZE (antXpathMainTable)       },
+	[TABLE_MAIN]        = { ARRAY_AND_SIZE (antXpathMainTable), .streamable = true },
 	[TABLE_PROJECT]     = { ARRAY_AND_SIZE (antXpathProjectTable)    },
 	[TABLE_MAIN_NAME]   = { ARRAY_AND_SIZE (antXpathMainNameTable)   },
 	[TABLE_TARGET_NAME] = { ARRAY_AND_SIZE (antXpathTargetNameTable) },
@@ -13,8 +13,10 @@
 */
 #include "general.h"  /* must always come first */
 
+#include <ctype.h>
 #include <string.h>
 
+#include "bytescan.h"
 #include "cpreprocessor.h"
 #include "debug.h"
 #include "dependency.h"
@@ -153,6 +155,15 @@ static const char *extraLinesepChars = defaultExtraLinesepChars;
 
 static bool useCPreProcessor = true;
 
+/* The bytes at the head of an input looked at to know whether the input
+ * is written by a compiler. */
+#define GENERATED_ASM_HEAD_WINDOW 4096
+
+static const char *const cppDirectives [] = {
+	"define", "undef", "include", "include_next", "if", "ifdef", "ifndef",
+	"elif", "else", "endif", "error", "warning", "pragma", "line",
+};
+
 /*
 *   FUNCTION DEFINITIONS
 */
@@ -649,14 +660,90 @@ static const unsigned char *readLineNoCpp (const char *commentChars)
 		return (unsigned char *)vStringValue (line);
 }
 
-static const unsigned char *asmReadLineFromInputFile (const char *commentChars, bool useCpp)
+/* Read a line of the input at once. Only for an input with no extra
+ * line separators. */
+static const unsigned char *readLineAtOnce (const char *commentChars)
 {
-	if (useCpp)
+	static vString *line;
+	size_t length;
+	const unsigned char *l = readLineFromInputFileWithLength (&length);
+
+	if (l == NULL || commentChars[0] == '\0')
+		return l;
+
+	line = vStringNewOrClear (line);
+	vStringNCatSUnsafe (line, (const char *) l, strcspn ((const char *) l, commentChars));
+	return (unsigned char *)vStringValue (line);
+}
+
+static const unsigned char *asmReadLineFromInputFile (const char *commentChars,
+													  bool useCpp, bool atOnce)
+{
+	if (atOnce)
+		return readLineAtOnce (commentChars);
+	else if (useCpp)
 		return readLineViaCpp (commentChars);
 	else
 		return readLineNoCpp (commentChars);
 }
 
+static bool isCppDirective (const unsigned char *p, const unsigned char *end)
+{
+	const unsigned char *word;
+
+	while (p < end && (*p == ' ' || *p == '\t'))
+		p++;
+	word = p;
+	while (p < end && islower (*p))
+		p++;
+	for (unsigned int i = 0; i < ARRAY_SIZE (cppDirectives); i++)
+		if (strlen (cppDirectives [i]) == (size_t) (p - word)
+			&& strncmp (cppDirectives [i], (const char *) word, p - word) == 0)
+			return true;
+	return false;
+}
+
+/* An input written by a compiler has a .file or .section directive, and
+ * neither preprocessor directives nor C block comments in its head. "#APP" and
+ * "# 1 \"x.c\"" of GCC are not directives. Such an input is read a line at
+ * once instead of running the C preprocessor over each byte of it. */
+static bool isGeneratedAssembly (void)
+{
+	size_t size;
+	const unsigned char *data = getInputFileData (&size);
+	const unsigned char *p, *end;
+	bool generated = false;
+
+	if (data == NULL)
+		return false;
+	end = data + ((size < GENERATED_ASM_HEAD_WINDOW)? size: GENERATED_ASM_HEAD_WINDOW);
+
+	for (p = data; p < end; p++)
+	{
+		const unsigned char *eol = findByte (p, end, '\n');
+
+		while (p < eol && (*p == ' ' || *p == '\t'))
+			p++;
+		if (p < eol && *p == '#')
+		{
+			if (isCppDirective (p + 1, eol))
+				return false;
+		}
+		else if (eol - p >= 5
+				 && (strncmp ((const char *) p, ".file", 5) == 0
+					 || (eol - p >= 8 && strncmp ((const char *) p, ".section", 8) == 0)))
+			generated = true;
+		for (const unsigned char *slash = findByte (p, eol, '/'); slash + 1 < eol;
+			 slash = findByte (slash + 1, eol, '/'))
+		{
+			if (slash [1] == '*')
+				return false;
+		}
+		p = eol;
+	}
+	return generated;
+}
+
 static void  readMacroParameters (int index, tagEntryInfo *e, const unsigned char *cp)
 {
 	vString *name = vStringNew ();
@@ -745,7 +832,7 @@ static void  readMacroParameters (int index, tagEntryInfo *e, const unsigned cha
 	vStringDelete (name);
 }
 
-static void findAsmTagsCommon (bool useCpp)
+static void findAsmTagsCommon (bool useCpp, bool atOnce)
 {
 	vString *name = vStringNew ();
 	vString *operator = vStringNew ();
@@ -759,7 +846,7 @@ static void findAsmTagsCommon (bool useCpp)
 	int sectionScope = CORK_NIL;
 	int macroScope = CORK_NIL;
 
-	 while ((line = asmReadLineFromInputFile (commentCharsInMOL, useCpp)) != NULL)
+	 while ((line = asmReadLineFromInputFile (commentCharsInMOL, useCpp, atOnce)) != NULL)
 	 {
 		const unsigned char *cp = line;
 		bool labelCandidate = (bool) (! isspace (*cp));
@@ -838,7 +925,10 @@ static void findAsmTagsCommon (bool useCpp)
 
 static void findAsmTags (void)
 {
-	findAsmTagsCommon (useCPreProcessor);
+	if (extraLinesepChars[0] == '\0' && isGeneratedAssembly ())
+		findAsmTagsCommon (false, true);
+	else
+		findAsmTagsCommon (useCPreProcessor, false);
 }
 
 static void initialize (const langType language)
@@ -21,6 +21,7 @@
 
 #include "debug.h"
 #include "bibtex.h"
+#include "bytescan.h"
 #include "entry.h"
 #include "keyword.h"
 #include "parse.h"
@@ -355,12 +356,38 @@ static bool mayParseTokenInSubparser (tokenInfo *const token)
 	return eof;
 }
 
+/*
+ * Skip to the next '@'. Only a token starting with '@' can start an
+ * entry; the tokens of the field values are thrown away by
+ * parseBibFile (). A '@' in a comment is skipped like readToken ()
+ * does.
+ */
+static void skipToEntry (void)
+{
+	static const unsigned char set [] = { '@', '%' };
+	int c;
+
+	do
+	{
+		if (InputCursor.current < InputCursor.end)
+			InputCursor.current = findByteInSet (InputCursor.current, InputCursor.end,
+												 set, ARRAY_SIZE (set));
+		c = getcFromInputFile ();
+		if (c == '%')
+			skipToCharacterInInputFile ('\n');
+	} while (c != EOF && c != '@');
+
+	if (c == '@')
+		ungetcToInputFile (c);
+}
+
 static void parseBibFile (tokenInfo *const token)
 {
 	bool eof = false;
 
 	do
 	{
+		skipToEntry ();
 		if (!readToken (token))
 			break;
 
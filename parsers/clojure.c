@@ -17,6 +17,8 @@
 #include "vstring.h"
 #include "entry.h"
 
+#include "lisp.h"
+
 typedef enum {
 	K_FUNCTION,
 	K_NAMESPACE
@@ -142,11 +144,18 @@ static void skipToSymbol (const char **p)
 static void findClojureTags (void)
 {
 	vString *name = vStringNew ();
+	const unsigned char *line;
+	const unsigned char *next = NULL;
 	const char *p;
 	int scope_index = CORK_NIL;
+	lispFormScanner scanner;
 
-	while ((p = (char *)readLineFromInputFile ()) != NULL)
+	while ((line = next? next: readLineFromInputFile ()) != NULL)
 	{
+		bool head = false;
+
+		next = NULL;
+		p = (const char *) line;
 		vStringClear (name);
 
 		while (isspace ((unsigned char) *p))
@@ -158,13 +167,25 @@ static void findClojureTags (void)
 			{
 				skipToSymbol (&p);
 				scope_index = makeNamespaceTag (name, p);
+				head = true;
 			}
 			else if (isFunction (p) || isCoreFunction (p))
 			{
 				skipToSymbol (&p);
 				makeFunctionTag (name, p, scope_index);
+				head = true;
 			}
 		}
+
+		/* Indented lines are looked at too, so a def nested in the
+		 * body of a defn, or a "(defn" line in its docstring, would
+		 * otherwise be tagged as a definition in the namespace. */
+		if (head)
+		{
+			lispFormScannerInit (&scanner, 0);
+			lispScanFormLine (&scanner, line);
+			next = lispSkipForm (&scanner);
+		}
 	}
 	vStringDelete (name);
 }
@@ -15,6 +15,7 @@
 
 #include <string.h>
 
+#include "bytescan.h"
 #include "debug.h"
 #include "entry.h"
 #include "htable.h"
@@ -26,6 +27,8 @@
 #include "param.h"
 #include "parse.h"
 #include "promise.h"
+#include "ptrarray.h"
+#include "routines.h"
 #include "xtag.h"
 
 #include "cxx/cxx_debug.h"
@@ -151,9 +154,18 @@ typedef struct sCppState {
 
 	cppMacroInfo * macroInUse;
 	hashTable * fileMacroTable;
+	ptrArray * includedMacroTables; /* the macro tables of headerMacros
+									 * included from the current input */
 
 } cppState;
 
+/*  The macros defined in a header file tagged before.
+ */
+typedef struct sHeaderMacros {
+	uint64_t hash;           /* of the contents of the header, or 0 */
+	hashTable * macros;
+} headerMacros;
+
 
 typedef enum {
 	CPREPRO_MACRO_KIND_UNDEF_ROLE,
@@ -206,6 +218,10 @@ static fieldDefinition CPreProFields[COUNT_FIELD] = {
 
 static bool doesExaminCodeWithInIf0Branch;
 static bool doesExpandMacros;
+static bool doesExpandIncludedMacros;
+
+/* normalized path of a header file -> headerMacros */
+static hashTable *headerMacrosTable;
 
 /*
 * CXX parser state. This is stored at the beginning of a conditional.
@@ -218,6 +234,9 @@ static int externalParserBlockNestLevel;
 /*  Use brace formatting to detect end of block.
  */
 static bool BraceFormat = false;
+/* True if a branch of a conditional has been ignored since cppInit().
+ * Only the choice of the ignored branches depends on BraceFormat. */
+static bool BranchIgnored = false;
 
 void cppPushExternalParserBlock(void)
 {
@@ -275,6 +294,8 @@ static cppState Cpp = {
 
 static hashTable *makeMacroTable (void);
 static cppMacroInfo * saveMacro(hashTable *table, const char * macro);
+static void storeHeaderMacros (void);
+static void includeHeaderMacros (const char *const fileName);
 
 /*
 *   FUNCTION DEFINITIONS
@@ -285,6 +306,21 @@ extern bool cppIsBraceFormat (void)
 	return BraceFormat;
 }
 
+extern bool cppHasIgnoredBranch (void)
+{
+	return BranchIgnored;
+}
+
+extern bool cppIsRestartable (void)
+{
+	return Cpp.ungetDataSize == 0
+		&& Cpp.directive.nestLevel == 0
+		&& Cpp.directive.state == DRCTV_NONE
+		&& !BranchIgnored
+		&& Cpp.fileMacroTable == NULL
+		&& Cpp.macroInUse == NULL;
+}
+
 extern unsigned int cppGetDirectiveNestLevel (void)
 {
 	return Cpp.directive.nestLevel;
@@ -303,6 +339,7 @@ static void cppInitCommon(langType clientLang,
 		     int macrodefFieldIndex)
 {
 	BraceFormat = state;
+	BranchIgnored = false;
 
 	CXX_DEBUG_PRINT("cppInit: brace format is %d",BraceFormat);
 
@@ -396,6 +433,9 @@ static void cppInitCommon(langType clientLang,
 								   : clientLang) & CORK_SYMTAB))
 		? makeMacroTable ()
 		: NULL;
+	Cpp.includedMacroTables = (Cpp.fileMacroTable && doesExpandIncludedMacros)
+		? ptrArrayNew (NULL)
+		: NULL;
 }
 
 extern void cppInit (const bool state, const bool hasAtLiteralStrings,
@@ -431,6 +471,14 @@ static void cppClearMacroInUse (cppMacroInfo **pM)
 
 extern void cppTerminate (void)
 {
+	if (Cpp.includedMacroTables)
+	{
+		if (isInputHeaderFile ())
+			storeHeaderMacros ();
+		ptrArrayDelete (Cpp.includedMacroTables);
+		Cpp.includedMacroTables = NULL;
+	}
+
 	if (Cpp.directive.name != NULL)
 	{
 		vStringDelete (Cpp.directive.name);
@@ -626,6 +674,58 @@ static int cppGetcFromUngetBufferOrFile(void)
 	return getcFromInputFile();
 }
 
+/*  Skip the characters up to C0 or C1 in the current input line at once.
+ *  The skipped characters are appended to CONTENTS up to LIMIT bytes if
+ *  CONTENTS is not NULL.
+ */
+static void cppSkipInputTo (unsigned char c0, unsigned char c1,
+							vString *contents, size_t limit)
+{
+	const unsigned char *p;
+
+	if (Cpp.ungetPointer || InputCursor.current >= InputCursor.end)
+		return;
+
+	if (Cpp.macroInUse)
+		cppClearMacroInUse (&Cpp.macroInUse);
+	p = findByte2 (InputCursor.current, InputCursor.end, c0, c1);
+	if (contents && vStringLength (contents) < limit)
+	{
+		size_t length = p - InputCursor.current;
+		if (length > limit - vStringLength (contents))
+			length = limit - vStringLength (contents);
+		vStringNCatSUnsafe (contents, (const char *) InputCursor.current, length);
+	}
+	InputCursor.current = p;
+}
+
+/*  Reads the characters of an ignored branch, skipping whole lines which
+ *  cannot change the state of the preprocessor: lines having no directive,
+ *  comment, string, character literal, line continuation, trigraph, nor
+ *  digraph. Returns the next character not skipped.
+ */
+static int cppGetcSkippingIgnoredLines (void)
+{
+	int c;
+
+	while (true)
+	{
+		if (Cpp.ungetPointer)
+			return cppGetcFromUngetBufferOrFile ();
+
+		c = cppGetcFromUngetBufferOrFile ();
+		if (c == EOF || c == NEWLINE || strchr ("#/\"'\\?%", c))
+			return c;
+		if (! (InputCursor.current < InputCursor.end
+			   && InputCursor.end [-1] == NEWLINE
+			   && InputCursor.current + strcspn ((const char *) InputCursor.current,
+												 "#/\"'\\?%") == InputCursor.end))
+			return c;
+
+		/* Skip the rest of the line including the newline. */
+		InputCursor.current = InputCursor.end;
+	}
+}
 
 /*  Reads a directive, whose first character is given by "c", into "name".
  */
@@ -782,6 +882,8 @@ static bool pushConditional (const bool firstBranchChosen)
 		ifdef->enterExternalParserBlockNestLevel = externalParserBlockNestLevel;
 		ifdef->asmArea.line = 0;
 		ignoreBranch = ifdef->ignoring;
+		if (ignoreBranch && !ignoreAllBranches)
+			BranchIgnored = true;
 	}
 	return ignoreBranch;
 }
@@ -1140,8 +1242,12 @@ static void directiveInclude (const int c)
 	{
 		readFilename (c, Cpp.directive.name);
 		if ((! isIgnore ()) && vStringLength (Cpp.directive.name))
+		{
 			makeIncludeTag (vStringValue (Cpp.directive.name),
 					c == '<');
+			if (Cpp.includedMacroTables)
+				includeHeaderMacros (vStringValue (Cpp.directive.name));
+		}
 	}
 	Cpp.directive.state = DRCTV_NONE;
 }
@@ -1206,6 +1312,8 @@ static bool directiveHash (const int c)
 		promiseOrPrepareAsm (ifdef, s);
 
 		ignore = setIgnore (isIgnoreBranch ());
+		if (ignore && !ifdef->ignoreAllBranches)
+			BranchIgnored = true;
 		CXX_DEBUG_PRINT("Found #elif or #else: ignore is %d",ignore);
 		if (! ignore  &&  s == IF_ELSE)
 			chooseBranch ();
@@ -1285,12 +1393,17 @@ static Comment isComment (void)
  */
 static int cppSkipOverCComment (void)
 {
-	int c = cppGetcFromUngetBufferOrFile ();
+	int c;
 
+	cppSkipInputTo ('*', '*', NULL, 0);
+	c = cppGetcFromUngetBufferOrFile ();
 	while (c != EOF)
 	{
 		if (c != '*')
+		{
+			cppSkipInputTo ('*', '*', NULL, 0);
 			c = cppGetcFromUngetBufferOrFile ();
+		}
 		else
 		{
 			const int next = cppGetcFromUngetBufferOrFile ();
@@ -1365,8 +1478,14 @@ static int skipToEndOfString (bool ignoreBackslash)
 
 	vStringClear(Cpp.charOrStringContents);
 
-	while ((c = cppGetcFromUngetBufferOrFile ()) != EOF)
+	for (;;)
 	{
+		cppSkipInputTo (DOUBLE_QUOTE, ignoreBackslash? DOUBLE_QUOTE: BACKSLASH,
+						Cpp.charOrStringContents, 1024);
+		c = cppGetcFromUngetBufferOrFile ();
+		if (c == EOF)
+			break;
+
 		if (c == BACKSLASH && ! ignoreBackslash)
 		{
 			int c0 = cppGetcFromUngetBufferOrFile ();
@@ -1592,7 +1711,11 @@ extern int cppGetc (void)
 
 	do {
 start_loop:
-		c = cppGetcFromUngetBufferOrFile ();
+		if (ignore && Cpp.directive.accept && Cpp.directive.state == DRCTV_NONE
+			&& macroCorkIndex == CORK_NIL && macrodef == NULL && condition == NULL)
+			c = cppGetcSkippingIgnoredLines ();
+		else
+			c = cppGetcFromUngetBufferOrFile ();
 process:
 		switch (c)
 		{
@@ -2000,28 +2123,38 @@ static void findCppTags (void)
 static hashTable * cmdlineMacroTable;
 
 
+static bool isMacroDefinitionEntry (tagEntryInfo * entry)
+{
+	return ((entry->langType == Cpp.clientLang || entry->langType == Cpp.lang)
+			&& entry->kindIndex == Cpp.defineMacroKindIndex
+			&& isRoleAssigned (entry, ROLE_DEFINITION_INDEX));
+}
+
+static cppMacroInfo * saveMacroFromTagEntry (hashTable *table, tagEntryInfo * entry)
+{
+	vString *macrodef = vStringNewInit (entry->name);
+	if (entry->extensionFields.signature)
+		vStringCatS (macrodef, entry->extensionFields.signature);
+	vStringPut (macrodef, '=');
+
+	const char *val = getParserFieldValueForType (entry, Cpp.macrodefFieldIndex);
+	if (val)
+		vStringCatS (macrodef, val);
+
+	cppMacroInfo *info = saveMacro (table, vStringValue (macrodef));
+	vStringDelete (macrodef);
+	return info;
+}
+
 static bool buildMacroInfoFromTagEntry (int corkIndex,
 										tagEntryInfo * entry,
 										void * data)
 {
 	cppMacroInfo **info = data;
 
-	if ((entry->langType == Cpp.clientLang || entry->langType == Cpp.lang)
-		&& entry->kindIndex == Cpp.defineMacroKindIndex
-		&& isRoleAssigned (entry, ROLE_DEFINITION_INDEX))
+	if (isMacroDefinitionEntry (entry))
 	{
-		vString *macrodef = vStringNewInit (entry->name);
-		if (entry->extensionFields.signature)
-			vStringCatS (macrodef, entry->extensionFields.signature);
-		vStringPut (macrodef, '=');
-
-		const char *val = getParserFieldValueForType (entry, Cpp.macrodefFieldIndex);
-		if (val)
-			vStringCatS (macrodef, val);
-
-		*info = saveMacro (Cpp.fileMacroTable, vStringValue (macrodef));
-		vStringDelete (macrodef);
-
+		*info = saveMacroFromTagEntry (Cpp.fileMacroTable, entry);
 		return false;
 	}
 	return true;
@@ -2058,9 +2191,176 @@ extern cppMacroInfo * cppFindMacro (const char *const name)
 		if (info)
 			return info;
 	}
+
+	if (Cpp.includedMacroTables)
+	{
+		for (unsigned int i = 0; i < ptrArrayCount (Cpp.includedMacroTables); i++)
+		{
+			info = hashTableGetItem (ptrArrayItem (Cpp.includedMacroTables, i), name);
+			if (info)
+				return info;
+		}
+	}
 	return NULL;
 }
 
+extern bool cppHasMacros (void)
+{
+	return cmdlineMacroTable || Cpp.fileMacroTable;
+}
+
+/*
+ *  Macros of header files
+ */
+
+/*  Returns a copy of PATH without "." components, empty components, and
+ *  ".." components following a directory name, so the same header file
+ *  included from different directories has the same name.
+ */
+static char *normalizeHeaderPath (const char *const path)
+{
+	vString *normalized = vStringNew ();
+	const char *p = path;
+
+	if (*p == '/')
+		vStringPut (normalized, '/');
+
+	while (*p)
+	{
+		const char *sep = strchr (p, '/');
+		size_t length = sep? (size_t) (sep - p): strlen (p);
+		size_t start = vStringLength (normalized);
+
+		if (length == 0 || (length == 1 && p[0] == '.'))
+			;
+		else if (length == 2 && p[0] == '.' && p[1] == '.')
+		{
+			const char *base = vStringValue (normalized);
+			size_t last = (start > 0)? start - 1: 0;
+
+			/* Find the last directory name ending with the last '/'. */
+			while (last > 0 && base[last - 1] != '/')
+				last--;
+			if (start > last + 1 && strncmp (base + last, "../", 3) != 0)
+				vStringTruncate (normalized, last);
+			else if (!(start == 1 && base[0] == '/'))
+			{
+				vStringCatS (normalized, "..");
+				if (sep)
+					vStringPut (normalized, '/');
+			}
+		}
+		else
+		{
+			vStringNCatSUnsafe (normalized, p, length);
+			if (sep)
+				vStringPut (normalized, '/');
+		}
+
+		if (sep == NULL)
+			break;
+		p = sep + 1;
+	}
+	return vStringDeleteUnwrap (normalized);
+}
+
+static void deleteHeaderMacros (void *data)
+{
+	headerMacros *h = data;
+
+	hashTableDelete (h->macros);
+	eFree (h);
+}
+
+static bool storeMacroFromTagEntry (int corkIndex CTAGS_ATTR_UNUSED,
+									tagEntryInfo * entry,
+									void * data)
+{
+	if (isMacroDefinitionEntry (entry)
+		&& !hashTableHasItem (data, entry->name))
+		saveMacroFromTagEntry (data, entry);
+	return true;
+}
+
+/*  Records the macros defined in the current input file, a header file, so
+ *  that later input files including it can expand them. The table built
+ *  when tagging the same contents before is kept.
+ */
+static void storeHeaderMacros (void)
+{
+	size_t size;
+	const unsigned char *data = getInputFileData (&size);
+	uint64_t hash = data? hashBytes (FNV1A_INITIAL_HASH, data, size): 0;
+	char *path = normalizeHeaderPath (getInputFileName ());
+	headerMacros *h;
+
+	if (headerMacrosTable == NULL)
+		headerMacrosTable = hashTableNew (64, hashCstrhash, hashCstreq,
+										  eFree, deleteHeaderMacros);
+
+	h = hashTableGetItem (headerMacrosTable, path);
+	if (h && hash != 0 && h->hash == hash)
+	{
+		eFree (path);
+		return;
+	}
+
+	h = xMalloc (1, headerMacros);
+	h->hash = hash;
+	h->macros = makeMacroTable ();
+	foreachEntriesInScope (CORK_NIL, NULL, storeMacroFromTagEntry, h->macros);
+	if (hashTableUpdateOrPutItem (headerMacrosTable, path, h))
+		eFree (path);
+}
+
+static headerMacros *findHeaderMacros (const char *const path)
+{
+	char *normalized = normalizeHeaderPath (path);
+	headerMacros *h = hashTableGetItem (headerMacrosTable, normalized);
+
+	eFree (normalized);
+	return h;
+}
+
+/*  Makes the macros of the header file FILENAME available to the current
+ *  input file. FILENAME is searched in the directory of the input file and
+ *  its parent directories, because the include paths for the input file
+ *  are unknown.
+ */
+static void includeHeaderMacros (const char *const fileName)
+{
+	headerMacros *h = NULL;
+
+	if (headerMacrosTable == NULL)
+		return;
+
+	if (fileName[0] == '/')
+		h = findHeaderMacros (fileName);
+	else
+	{
+		char *dir = normalizeHeaderPath (getInputFileName ());
+		vString *candidate = vStringNew ();
+		char *sep;
+
+		while (h == NULL && (sep = strrchr (dir, '/')) != NULL)
+		{
+			sep[1] = '\0';
+			vStringCopyS (candidate, dir);
+			vStringCatS (candidate, fileName);
+			h = findHeaderMacros (vStringValue (candidate));
+			sep[0] = '\0';
+		}
+		if (h == NULL && getInputFileName ()[0] != '/')
+			h = findHeaderMacros (fileName);
+
+		vStringDelete (candidate);
+		eFree (dir);
+	}
+
+	if (h)
+		ptrArrayAdd (Cpp.includedMacroTables, h->macros);
+}
+
 extern vString * cppBuildMacroReplacement(
 		const cppMacroInfo * macro,
 		const char ** parameters, /* may be NULL */
@@ -2544,7 +2844,7 @@ static void freeMacroInfo(cppMacroInfo * info)
 
 static hashTable *makeMacroTable (void)
 {
-	return hashTableNew(
+	return hashTableNewFlat(
 		1024,
 		hashCstrhash,
 		hashCstreq,
@@ -2565,6 +2865,12 @@ static void finalizeCpp (const langType language, bool initialized)
 		hashTableDelete (cmdlineMacroTable);
 		cmdlineMacroTable = NULL;
 	}
+
+	if (headerMacrosTable)
+	{
+		hashTableDelete (headerMacrosTable);
+		headerMacrosTable = NULL;
+	}
 }
 
 static bool CpreProExpandMacrosInInput (const langType language CTAGS_ATTR_UNUSED, const char *name, const char *arg)
@@ -2574,6 +2880,13 @@ static bool CpreProExpandMacrosInInput (const langType language CTAGS_ATTR_UNUSE
 	return true;
 }
 
+static bool CpreProExpandIncludedMacros (const langType language CTAGS_ATTR_UNUSED, const char *name, const char *arg)
+{
+	doesExpandIncludedMacros = paramParserBool (arg, doesExpandIncludedMacros,
+												name, "parameter");
+	return true;
+}
+
 static bool CpreProInstallIgnoreToken (const langType language CTAGS_ATTR_UNUSED, const char *optname CTAGS_ATTR_UNUSED, const char *arg)
 {
 	if (arg == NULL || arg[0] == '\0')
@@ -2633,6 +2946,10 @@ static paramDefinition CpreProParams [] = {
 	{ .name = "_expand",
 	  .desc = "expand macros if their definitions are in the current C/C++/CUDA input file (true or [false])",
 	  .handleParam = CpreProExpandMacrosInInput,
+	},
+	{ .name = "_expandIncluded",
+	  .desc = "expand macros if their definitions are in the header files tagged before and included from the current input file (true or [false])",
+	  .handleParam = CpreProExpandIncludedMacros,
 	}
 };
 
@@ -79,6 +79,14 @@
 *   FUNCTION PROTOTYPES
 */
 extern bool cppIsBraceFormat (void);
+/* Return true if a branch of a conditional has been ignored since
+ * cppInit (). If not, the input is read the same way whether the brace
+ * format is assumed or not. */
+extern bool cppHasIgnoredBranch (void);
+/* Return true if the preprocessor holds nothing a pass restarting at the
+ * next line after cppInit () would miss: no character to read again, no
+ * open conditional, no ignored branch, and no macro to expand. */
+extern bool cppIsRestartable (void);
 extern unsigned int cppGetDirectiveNestLevel (void);
 
 /* Don't forget to set useCort true in your parser.
@@ -134,6 +142,9 @@ typedef struct sCppMacroInfo {
 } cppMacroInfo;
 
 extern cppMacroInfo * cppFindMacro (const char *const name);
+/* Return true if cppFindMacro () may find a macro, i.e. some macros are
+ * defined or ignored on the command line or collected from the input. */
+extern bool cppHasMacros (void);
 extern void cppUngetStringBuiltByMacro (const char * string,int len, cppMacroInfo *macro);
 
 /*
@@ -1964,6 +1964,38 @@ bool cxxParserParseIfForWhileSwitchCatchParenthesis(void)
 	return true;
 }
 
+// Besides the tags made by the preprocessor, the only tags found inside
+// the function bodies of C code are the locals, the labels and the tags
+// of the local struct, union, enum and typedef declarations. If none of
+// them can be emitted the bodies don't need to be parsed.
+static bool cxxParserCanSkipFunctionBodies(void)
+{
+	// C++ bodies may also contain lambdas and local classes.
+	if(!cxxParserCurrentLanguageIsC())
+		return false;
+
+	for(unsigned int uKind = 0;uKind < g_cxx.uKindDefinitionCount;uKind++)
+	{
+		switch(uKind)
+		{
+			case CXXTagKindMACRO:
+			case CXXTagKindINCLUDE:
+			case CXXTagKindMACROPARAM:
+			case CXXTagKindFUNCTION:
+			case CXXTagKindPROTOTYPE:
+			break;
+			default:
+				if(cxxTagKindEnabled(uKind))
+					return false;
+			break;
+		}
+	}
+
+	// The macros are expanded by the tokenizer and the subparsers
+	// are notified of the tokens.
+	return (!cppHasMacros()) && (!cxxSubparserExists());
+}
+
 static rescanReason cxxParserMain(const unsigned int passCount)
 {
 	cxxScopeClear();
@@ -1998,8 +2030,10 @@ static rescanReason cxxParserMain(const unsigned int passCount)
 	g_cxx.iChar = ' ';
 
 	g_cxx.iNestingLevels = 0;
+	g_cxx.bSkipFunctionBodies = cxxParserCanSkipFunctionBodies();
 
 	bool bRet = cxxParserParseBlock(false);
+	bool bBranchIgnored = cppHasIgnoredBranch();
 
 	cppTerminate ();
 
@@ -2011,7 +2045,13 @@ static rescanReason cxxParserMain(const unsigned int passCount)
 		cxxTokenChainClear(g_cxx.pTemplateSpecializationTokenChain);
 	// Restart coveralls: LCOV_EXCL_END
 
-	if(!bRet && (passCount == 1))
+	// The second pass differs from the first one only in the branches
+	// of the preprocessor conditionals it ignores. If the first pass
+	// ignored none, the second pass would read the same tokens and fail
+	// at the same place. For the same reason the second pass starts at
+	// the last top-level statement boundary marked before the first
+	// ignored branch (see cxxParserParseBlockInternal()).
+	if(!bRet && (passCount == 1) && bBranchIgnored)
 	{
 		CXX_DEBUG_PRINT("Processing failed: trying to rescan");
 		return RESCAN_FAILED;
@@ -2055,7 +2095,10 @@ rescanReason cxxCppParserMain(const unsigned int passCount)
 	// In header files we disable processing of public/protected/private keywords
 	// until we either figure out that this is really C++ or we're start parsing
 	// a struct/union.
-	g_cxx.bConfirmedCPPLanguage = !isInputHeaderFile();
+	if(getPassStartLine() > 1)
+		g_cxx.bConfirmedCPPLanguage = g_cxx.bConfirmedCPPLanguageAtRescanPoint;
+	else
+		g_cxx.bConfirmedCPPLanguage = !isInputHeaderFile();
 	cxxKeywordEnablePublicProtectedPrivate(g_cxx.bConfirmedCPPLanguage);
 
 	rescanReason r = cxxParserMain(passCount);
@@ -26,10 +26,290 @@
 
 #include "cxx_subparser_internal.h"
 
+#include <ctype.h>
 #include <string.h>
 
 static bool cxxParserParseBlockFull(bool bExpectClosingBracket, bool bExported);
 
+// The state of a statement skipped by cxxParserSkipBlockContents().
+enum CXXSkipStatementFlag
+{
+	// The last token is an assignment.
+	CXXSkipStatementAfterAssignment = 1,
+	// The last token is __attribute__ or __declspec: the tokenizer
+	// drops the parenthesis following it.
+	CXXSkipStatementAfterAttribute = (1 << 1),
+	// An enum keyword has been seen: a bracket opens its body.
+	CXXSkipStatementSeenEnum = (1 << 2),
+	// A struct or union keyword has been seen: a bracket opens its body.
+	CXXSkipStatementSeenStruct = (1 << 3),
+	// An identifier has been seen after the enum/struct/union keyword.
+	CXXSkipStatementSeenTagName = (1 << 4),
+	// The rest of the statement is read as a whole up to the semicolon,
+	// as after return or after the body of an enum/struct/union.
+	CXXSkipStatementToSemicolon = (1 << 5),
+	// The statement ends also at a colon (after case).
+	CXXSkipStatementToColon = (1 << 6)
+};
+
+// The states in which cxxParserParseUpToOneOf() reads the statement
+// and a closing bracket or parenthesis is a syntax error.
+#define CXX_SKIP_STATEMENT_STRICT \
+	(CXXSkipStatementSeenEnum | CXXSkipStatementSeenStruct | \
+		CXXSkipStatementToSemicolon | CXXSkipStatementToColon)
+
+static bool cxxParserSkipBlock(vString * pGroups);
+
+static bool cxxParserSkipIsWordChar(int iChar)
+{
+	return (iChar >= 0) && (iChar < 0x80) &&
+		(isalnum(iChar) || (iChar == '_') || (iChar == '$'));
+}
+
+// Skips the statements of a block up to its closing bracket without
+// building any token: this is used for the function bodies when
+// g_cxx.bSkipFunctionBodies is set.
+//
+// The characters are read with cppGetc() as the tokenizer does, so
+// strings, comments and preprocessor directives are handled the same
+// way. The preprocessor chooses the branches of the conditionals
+// looking at the statement and block boundaries: these are reported
+// exactly where the full parser would do it. The anonymous
+// enums/structs/unions are counted too as their names are numbered.
+//
+// pGroups is the stack of the closing characters of the open (...),
+// [...] and {...} groups (initializers, enum bodies...) of the statement.
+//
+// Returns false if EOF or a mismatched bracket is found, where the
+// full parser fails too.
+static bool cxxParserSkipBlockContents(vString * pGroups)
+{
+	unsigned int uFlags = 0;
+	int iPrevChar = ' ';
+	char szWord[32];
+
+	for(;;)
+	{
+		int iChar = g_cxx.iChar;
+
+		if(cppIsspace(iChar))
+		{
+			iPrevChar = ' ';
+			g_cxx.iChar = cppGetc();
+			continue;
+		}
+
+		if(iChar == EOF)
+			return false;
+
+		// A token starts here.
+		cppBeginStatement();
+
+		bool bTopLevel = vStringLength(pGroups) == 0;
+		bool bAfterAssignment = uFlags & CXXSkipStatementAfterAssignment;
+		bool bAfterAttribute = uFlags & CXXSkipStatementAfterAttribute;
+
+		uFlags &= ~(CXXSkipStatementAfterAssignment | CXXSkipStatementAfterAttribute);
+
+		if(cxxParserSkipIsWordChar(iChar))
+		{
+			// An identifier, a keyword or a number
+			size_t uLength = 0;
+			do {
+				if(uLength < sizeof(szWord))
+					szWord[uLength] = (char)iChar;
+				uLength++;
+				iChar = cppGetc();
+			} while(cxxParserSkipIsWordChar(iChar));
+			g_cxx.iChar = iChar;
+			iPrevChar = 'a';
+
+			if(
+					(!bTopLevel) ||
+					(uFlags & (CXXSkipStatementToSemicolon | CXXSkipStatementToColon)) ||
+					isdigit(szWord[0])
+				)
+				continue;
+
+			int iKeyword = -1;
+			if(uLength < sizeof(szWord) - 1)
+			{
+				szWord[uLength] = '\0';
+				iKeyword = lookupKeyword(szWord,g_cxx.eLangType);
+				if((iKeyword >= 0) && cxxKeywordIsDisabled((CXXKeyword)iKeyword))
+					iKeyword = -1;
+			}
+
+			if(iKeyword < 0)
+			{
+				uFlags |= CXXSkipStatementSeenTagName;
+				continue;
+			}
+
+			if(cxxKeywordMayDropInTokenizer((CXXKeyword)iKeyword))
+			{
+				uFlags |= CXXSkipStatementAfterAttribute;
+				continue;
+			}
+
+			if(uFlags & (CXXSkipStatementSeenEnum | CXXSkipStatementSeenStruct))
+				continue;
+
+			switch(iKeyword)
+			{
+				case CXXKeywordENUM:
+					uFlags |= CXXSkipStatementSeenEnum;
+					uFlags &= ~CXXSkipStatementSeenTagName;
+				break;
+				case CXXKeywordSTRUCT:
+				case CXXKeywordUNION:
+					uFlags |= CXXSkipStatementSeenStruct;
+					uFlags &= ~CXXSkipStatementSeenTagName;
+				break;
+				case CXXKeywordRETURN:
+				case CXXKeywordGOTO:
+				case CXXKeywordBREAK:
+				case CXXKeywordCONTINUE:
+					uFlags |= CXXSkipStatementToSemicolon;
+				break;
+				case CXXKeywordCASE:
+					uFlags |= CXXSkipStatementToSemicolon | CXXSkipStatementToColon;
+				break;
+				default:
+				break;
+			}
+			continue;
+		}
+
+		g_cxx.iChar = cppGetc();
+
+		switch(iChar)
+		{
+			case '(':
+			case '[':
+			case '{':
+				if(bTopLevel && (iChar == '('))
+				{
+					// struct x * f(...), enum x f(...)
+					if(!bAfterAttribute)
+						uFlags &= ~(CXXSkipStatementSeenEnum | CXXSkipStatementSeenStruct);
+				} else if(bTopLevel && (iChar == '{'))
+				{
+					if(
+							(uFlags & (CXXSkipStatementSeenEnum | CXXSkipStatementSeenStruct)) &&
+							(!(uFlags & CXXSkipStatementSeenTagName))
+						)
+					{
+						// Only the number in the name matters
+						CXXToken * pAnonymous = cxxTokenCreateAnonymousIdentifier(
+								(uFlags & CXXSkipStatementSeenEnum) ?
+									CXXTagKindENUM : CXXTagKindSTRUCT,
+								NULL
+							);
+						cxxTokenDestroy(pAnonymous);
+					}
+
+					if(
+							(!bAfterAssignment) &&
+							(!(uFlags & (
+									CXXSkipStatementSeenEnum |
+									CXXSkipStatementToSemicolon |
+									CXXSkipStatementToColon
+								)))
+						)
+					{
+						// A nested block or the body of a struct/union
+						bool bStruct = uFlags & CXXSkipStatementSeenStruct;
+
+						cxxParserNewStatement();
+						if(!cxxParserSkipBlock(pGroups))
+							return false;
+
+						// The declaration after the body of a struct/union
+						// is read up to the semicolon.
+						uFlags = bStruct ? CXXSkipStatementToSemicolon : 0;
+						iPrevChar = ' ';
+						continue;
+					}
+
+					// An initializer or the body of an enum: the
+					// declaration after it is read up to the semicolon.
+					if(uFlags & CXXSkipStatementSeenEnum)
+						uFlags = CXXSkipStatementToSemicolon;
+				}
+				vStringPut(pGroups,(iChar == '(') ? ')' : ((iChar == '[') ? ']' : '}'));
+			break;
+			case ')':
+			case ']':
+			case '}':
+				if(!bTopLevel)
+				{
+					if(vStringLast(pGroups) != iChar)
+						return false;
+					vStringChop(pGroups);
+					break;
+				}
+				if(uFlags & CXX_SKIP_STATEMENT_STRICT)
+					return false;
+				if(iChar == '}')
+				{
+					cxxParserNewStatement();
+					return true;
+				}
+			break;
+			case ';':
+				if(bTopLevel)
+				{
+					cxxParserNewStatement();
+					uFlags = 0;
+				}
+			break;
+			case ':':
+				if(g_cxx.iChar == ':')
+				{
+					do {
+						g_cxx.iChar = cppGetc();
+					} while(g_cxx.iChar == ':');
+				} else if(bTopLevel && (uFlags & CXXSkipStatementToColon))
+				{
+					cxxParserNewStatement();
+					uFlags = 0;
+				}
+			break;
+			case '=':
+				if(g_cxx.iChar == '=')
+				{
+					do {
+						g_cxx.iChar = cppGetc();
+					} while(g_cxx.iChar == '=');
+				} else if((iPrevChar >= 0x80) || (!strchr("!%+-/<=?^|",iPrevChar)))
+				{
+					uFlags |= CXXSkipStatementAfterAssignment;
+					// struct x y = ...
+					if(bTopLevel && (uFlags & CXXSkipStatementSeenStruct))
+						uFlags = CXXSkipStatementAfterAssignment | CXXSkipStatementToSemicolon;
+				}
+			break;
+			default:
+			break;
+		}
+
+		iPrevChar = iChar;
+	}
+}
+
+static bool cxxParserSkipBlock(vString * pGroups)
+{
+	cppPushExternalParserBlock();
+	cxxParserNewStatement();
+	cppBeginStatement();
+
+	bool bRet = cxxParserSkipBlockContents(pGroups);
+
+	cppPopExternalParserBlock();
+	return bRet;
+}
+
 bool cxxParserParseBlockHandleOpeningBracket(void)
 {
 	CXX_DEBUG_ENTER();
@@ -169,7 +449,18 @@ bool cxxParserParseBlockHandleOpeningBracket(void)
 
 	cxxParserNewStatementFull(bExported);
 
-	if(!cxxParserParseBlockFull(true, bExported))
+	if(g_cxx.bSkipFunctionBodies && (iScopes > 0) && (!g_cxx.pUngetToken))
+	{
+		vString * pGroups = vStringNew();
+		bool bRet = cxxParserSkipBlock(pGroups);
+		vStringDelete(pGroups);
+
+		if(!bRet)
+		{
+			CXX_DEBUG_LEAVE_TEXT("Failed to skip function body");
+			return false;
+		}
+	} else if(!cxxParserParseBlockFull(true, bExported))
 	{
 		CXX_DEBUG_LEAVE_TEXT("Failed to parse nested block");
 		return false;
@@ -277,6 +568,22 @@ static bool cxxParserParseBlockInternal(bool bExpectClosingBracket, bool bExport
 	CXXTokenChain *pSideChain = NULL;
 	for(;;)
 	{
+		// Between two top-level statements ending a line, the first pass
+		// can be resumed by the second one (see cxxParserMain()).
+		if(
+				(!bExpectClosingBracket) &&
+				(g_cxx.iChar == '\n') &&
+				(g_cxx.pTokenChain->iCount == 0) &&
+				(!pSideChain) &&
+				(!g_cxx.pUngetToken) &&
+				(!cppIsBraceFormat()) &&
+				cxxScopeIsGlobal() &&
+				cppIsRestartable() &&
+				(!cxxParserHasCurrentModuleToken()) &&
+				markRescanPoint()
+			)
+			g_cxx.bConfirmedCPPLanguageAtRescanPoint = g_cxx.bConfirmedCPPLanguage;
+
 		if(!cxxParserParseNextToken())
 		{
 found_eof:
@@ -298,7 +298,8 @@ int cxxParserMaybeParseKnRStyleFunctionDefinition(void)
 		tag->isFileScope = (g_cxx.uKeywordState & CXXParserKeywordStateSeenStatic) &&
 				!isInputHeaderFile();
 
-		vString * pszSignature = cxxTokenChainJoin(pParenthesis->pChain,NULL,0);
+		vString * pszSignature = isFieldValueNeeded(FIELD_SIGNATURE) ?
+				cxxTokenChainJoinScratch(pParenthesis->pChain,NULL,0) : NULL;
 
 		// FIXME: Return type!
 		// FIXME: Properties?
@@ -309,8 +310,7 @@ int cxxParserMaybeParseKnRStyleFunctionDefinition(void)
 		iCorkQueueIndex = cxxTagCommit(&iCorkQueueIndexFQ);
 		cxxTagUseTokenAsPartOfDefTag(iCorkQueueIndex, pIdentifier);
 
-		if(pszSignature)
-			vStringDelete(pszSignature);
+		cxxTokenChainReleaseScratch(pszSignature);
 	}
 
 	cxxTokenDestroy(pParenthesis);
@@ -1634,8 +1634,9 @@ int cxxParserEmitFunctionTags(
 			? 0
 			: tag->isFileScope;
 
-		vString * pszSignature = cxxTokenChainJoin(pInfo->pParenthesis->pChain,NULL,0);
-		if(pInfo->pSignatureConst)
+		vString * pszSignature = isFieldValueNeeded(FIELD_SIGNATURE) ?
+				cxxTokenChainJoinScratch(pInfo->pParenthesis->pChain,NULL,0) : NULL;
+		if(pszSignature && pInfo->pSignatureConst)
 		{
 			vStringPut (pszSignature, ' ');
 			cxxTokenAppendToString(pszSignature,pInfo->pSignatureConst);
@@ -1782,8 +1783,7 @@ int cxxParserEmitFunctionTags(
 		if(piCorkQueueIndex)
 			*piCorkQueueIndex = iCorkQueueIndex;
 
-		if(pszSignature)
-			vStringDelete(pszSignature);
+		cxxTokenChainReleaseScratch(pszSignature);
 
 		if(pszProperties)
 			vStringDelete(pszProperties);
@@ -223,6 +223,7 @@ bool cxxParserParseNamespace(void);
 bool cxxParserParseModule(void);
 bool cxxParserParseImport(void);
 void cxxParserDestroyCurrentModuleToken(void);
+bool cxxParserHasCurrentModuleToken(void);
 
 // cxx_parser.c
 void cxxParserNewStatementFull(bool bExported);
@@ -369,6 +370,11 @@ typedef struct _CXXParserState
 	// definitely confirm we're parsing C++.
 	bool bConfirmedCPPLanguage;
 
+	// The value of bConfirmedCPPLanguage at the last rescan point marked
+	// in the first pass. The second pass restarting at the point starts
+	// with it.
+	bool bConfirmedCPPLanguageAtRescanPoint;
+
 	// The nesting levels our parser is in.
 	//
 	// Note that this is really a kind-of arbitrary measure as the counter
@@ -380,6 +386,10 @@ typedef struct _CXXParserState
 	// This usually happens only with erroneous macro usage or broken input.
 	int iNestingLevels;
 
+	// True if the function bodies are skipped without building tokens
+	// as nothing inside them could be emitted (see cxxParserMain()).
+	bool bSkipFunctionBodies;
+
 } CXXParserState;
 
 
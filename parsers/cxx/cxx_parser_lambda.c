@@ -261,8 +261,11 @@ bool cxxParserHandleLambda(CXXToken * pParenthesis)
 		// FIXME: Properties?
 
 		vString * pszSignature = NULL;
-		if(cxxTokenTypeIs(pParenthesis,CXXTokenTypeParenthesisChain))
-			pszSignature = cxxTokenChainJoin(pParenthesis->pChain,NULL,0);
+		if(
+				cxxTokenTypeIs(pParenthesis,CXXTokenTypeParenthesisChain) &&
+				isFieldValueNeeded(FIELD_SIGNATURE)
+			)
+			pszSignature = cxxTokenChainJoinScratch(pParenthesis->pChain,NULL,0);
 
 		if(pszSignature)
 			tag->extensionFields.signature = vStringValue(pszSignature);
@@ -273,8 +276,7 @@ bool cxxParserHandleLambda(CXXToken * pParenthesis)
 		if(pTypeName)
 			cxxTokenDestroy(pTypeName);
 
-		if(pszSignature)
-			vStringDelete(pszSignature);
+		cxxTokenChainReleaseScratch(pszSignature);
 	}
 
 	cxxScopePush(
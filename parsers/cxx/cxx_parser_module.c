@@ -40,6 +40,11 @@ void cxxParserDestroyCurrentModuleToken(void)
 	cxxParserSetCurrentModuleToken(NULL);
 }
 
+bool cxxParserHasCurrentModuleToken(void)
+{
+	return pCurrentModuleToken != NULL;
+}
+
 
 static CXXToken * cxxTokenModuleTokenCreate(CXXToken *pBegin, CXXToken *pEnd)
 {
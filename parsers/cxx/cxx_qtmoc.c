@@ -304,12 +304,16 @@ extern parserDefinition* QtMocParser (void)
 {
 	parserDefinition* const def = parserNew("QtMoc");
 
+	static const int notifiedKinds[] = {
+		CXXTagKindPROTOTYPE, KIND_GHOST_INDEX,
+	};
 	static struct sQtMocSubparser qtMocSubparser = {
 		.cxx = {
 			.subparser = {
 				.direction = SUBPARSER_BI_DIRECTION,
 				.inputStart = inputStart,
 				.makeTagEntryNotify = makeTagEntryNotify,
+				.makeTagEntryNotifyKinds = notifiedKinds,
 			},
 			.enterBlockNotify = enterBlockNotify,
 			.leaveBlockNotify = leaveBlockNotify,
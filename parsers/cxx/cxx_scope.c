@@ -11,6 +11,7 @@
 
 #include "vstring.h"
 #include "debug.h"
+#include "numarray.h"
 
 #include "cxx_tag.h"
 #include "cxx_debug.h"
@@ -22,22 +23,27 @@
 
 // The tokens defining current scope
 static CXXTokenChain * g_pScope = NULL;
+// The full name of the outermost scopes, joined with "::".
+// It covers as many scopes as g_pScopeNameLengths has items:
+// the N-th item is the length of the name before the N-th scope.
+// Pushing a scope doesn't rebuild the name of the outer scopes.
 static vString * g_szScopeName = NULL;
-static bool g_bScopeNameDirty = true;
+static intArray * g_pScopeNameLengths = NULL;
 
 void cxxScopeInit(void)
 {
 	g_pScope = cxxTokenChainCreate();
+	g_szScopeName = vStringNew();
+	g_pScopeNameLengths = intArrayNew();
 }
 
 void cxxScopeDone(void)
 {
 	cxxTokenChainDestroy(g_pScope);
-	if(g_szScopeName)
-	{
-		vStringDelete(g_szScopeName);
-		g_szScopeName = NULL;
-	}
+	vStringDelete(g_szScopeName);
+	g_szScopeName = NULL;
+	intArrayDelete(g_pScopeNameLengths);
+	g_pScopeNameLengths = NULL;
 }
 
 void cxxScopeClear(void)
@@ -46,8 +52,45 @@ void cxxScopeClear(void)
 		cxxTokenChainClear(g_pScope);
 	if(g_szScopeName)
 	{
-		vStringDelete(g_szScopeName);
-		g_szScopeName = NULL;
+		vStringClear(g_szScopeName);
+		intArrayClear(g_pScopeNameLengths);
+	}
+}
+
+// Forget the names of the scopes popped.
+static void cxxScopeTruncateName(void)
+{
+	int iCount = g_pScope->iCount;
+
+	if((int)intArrayCount(g_pScopeNameLengths) <= iCount)
+		return;
+
+	vStringTruncate(g_szScopeName,intArrayItem(g_pScopeNameLengths,iCount));
+	while((int)intArrayCount(g_pScopeNameLengths) > iCount)
+		intArrayRemoveLast(g_pScopeNameLengths);
+}
+
+// Append the names of the scopes pushed since the name was built.
+static void cxxScopeUpdateName(void)
+{
+	int iNamed = (int)intArrayCount(g_pScopeNameLengths);
+	CXXToken * t = g_pScope->pTail;
+
+	CXX_DEBUG_ASSERT(iNamed <= g_pScope->iCount,"The name must not cover popped scopes");
+
+	if(iNamed == g_pScope->iCount)
+		return;
+
+	for(int i = g_pScope->iCount - 1; i > iNamed; i--)
+		t = t->pPrev;
+
+	while(t)
+	{
+		intArrayAdd(g_pScopeNameLengths,(int)vStringLength(g_szScopeName));
+		if(t != g_pScope->pHead)
+			vStringCatS(g_szScopeName,"::");
+		cxxTokenAppendToString(g_szScopeName,t);
+		t = t->pNext;
 	}
 }
 
@@ -158,55 +201,20 @@ int cxxScopeGetSize(void)
 
 const char * cxxScopeGetFullName(void)
 {
-	if(!g_bScopeNameDirty)
-		return g_szScopeName ? vStringValue(g_szScopeName): NULL;
-
 	if(g_pScope->iCount < 1)
-	{
-		g_bScopeNameDirty = false;
 		return NULL;
-	}
 
-	g_szScopeName = vStringNewOrClear(g_szScopeName);
-
-	cxxTokenChainJoinInString(
-			g_pScope,
-			g_szScopeName,
-			"::",
-			CXXTokenChainJoinNoTrailingSpaces
-		);
-
-	g_bScopeNameDirty = false;
+	cxxScopeUpdateName();
 	return vStringValue(g_szScopeName);
 }
 
 vString * cxxScopeGetFullNameAsString(void)
 {
-	vString * ret;
-
-	if(!g_bScopeNameDirty)
-	{
-		ret = g_szScopeName;
-		g_szScopeName = NULL;
-		g_bScopeNameDirty = true;
-		return ret;
-	}
-
 	if(g_pScope->iCount < 1)
 		return NULL;
 
-	g_szScopeName = vStringNewOrClear(g_szScopeName);
-
-	cxxTokenChainJoinInString(
-			g_pScope,
-			g_szScopeName,
-			"::",
-			CXXTokenChainJoinNoTrailingSpaces
-		);
-
-	ret = g_szScopeName;
-	g_szScopeName = NULL;
-	return ret;
+	cxxScopeUpdateName();
+	return vStringNewCopy(g_szScopeName);
 }
 
 vString * cxxScopeGetFullNameExceptLastComponentAsString(void)
@@ -247,7 +255,6 @@ void cxxScopePushTop(CXXToken * t)
 		t->bInternalScopeExported = true;
 
 	cxxTokenChainAppend(g_pScope,t);
-	g_bScopeNameDirty = true;
 
 #ifdef CXX_DO_DEBUGGING
 	const char * szScopeName = cxxScopeGetFullName();
@@ -264,7 +271,7 @@ CXXToken * cxxScopeTakeTop(void)
 		);
 
 	CXXToken * t = cxxTokenChainTakeLast(g_pScope);
-	g_bScopeNameDirty = true;
+	cxxScopeTruncateName();
 
 #ifdef CXX_DO_DEBUGGING
 	const char * szScopeName = cxxScopeGetFullName();
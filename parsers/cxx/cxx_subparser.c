@@ -14,6 +14,15 @@
 #include "cxx_token_chain.h"
 
 
+bool cxxSubparserExists (void)
+{
+	subparser *pSubparser;
+
+	foreachSubparser (pSubparser, false)
+		return true;
+	return false;
+}
+
 bool cxxSubparserNotifyParseAccessSpecifier (ptrArray *pSubparsers)
 {
 	bool bR = false;
@@ -15,6 +15,7 @@
 #include "cxx_subparser.h"
 #include "ptrarray.h"
 
+bool cxxSubparserExists (void);
 bool cxxSubparserNotifyParseAccessSpecifier (ptrArray *pSubparsers);
 void cxxSubparserNotifyfoundExtraIdentifierAsAccessSpecifier(ptrArray *pSubparsers,
 															 CXXToken *pToken);
@@ -654,11 +654,11 @@ void cxxTagSetField(unsigned int uField,const char * szValue,bool bCopyValue)
 	if(!g_cxx.pFieldOptions[uField].enabled)
 		return;
 
-	/* If we make a copy for the value, the copy must be freed after
-	 * calling cxxTagCommit() for g_oCXXTag. The parser trash box
-	 * allows us to delay freeing the copy. */
+	/* If we make a copy for the value, the copy must live until
+	 * cxxTagCommit() is called for g_oCXXTag. The parser arena keeps
+	 * the copy until the end of the input file. */
 	attachParserField(&g_oCXXTag,g_cxx.pFieldOptions[uField].ftype,
-					  bCopyValue?parserTrashBoxPut(eStrdup(szValue),eFree):szValue);
+					  bCopyValue?parserArenaStrdup(szValue):szValue);
 }
 
 void cxxTagSetCorkQueueField(
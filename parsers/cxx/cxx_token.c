@@ -74,6 +74,7 @@ void cxxTokenAPIInit(void)
 		(objPoolCreateFunc)createToken, (objPoolDeleteFunc)deleteToken,
 		(objPoolClearFunc)clearToken,
 		NULL);
+	cxxTokenChainAPIInit();
 }
 
 void cxxTokenAPINewFile(void)
@@ -83,7 +84,9 @@ void cxxTokenAPINewFile(void)
 
 void cxxTokenAPIDone(void)
 {
+	// Pooled tokens may still have side chains.
 	objPoolDelete (g_pTokenPool);
+	cxxTokenChainAPIDone();
 }
 
 CXXToken * cxxTokenCreate(void)
@@ -13,10 +13,22 @@
 
 #include "vstring.h"
 #include "debug.h"
+#include "objpool.h"
 #include "routines.h"
 
 #include <string.h>
 
+#define CXX_TOKEN_CHAIN_POOL_MAXIMUM_SIZE 1024
+#define CXX_SCRATCH_STRING_POOL_MAXIMUM_SIZE 16
+
+// Chains are created for each parenthesis, bracket and template
+// argument list, and their tokens are moved around several times, so
+// they are recycled like tokens.
+static objPool * g_pTokenChainPool = NULL;
+
+// Strings joined from chains and thrown away after emitting a tag.
+static objPool * g_pScratchStringPool = NULL;
+
 void cxxTokenChainInit(CXXTokenChain * tc)
 {
 	Assert(tc);
@@ -25,11 +37,42 @@ void cxxTokenChainInit(CXXTokenChain * tc)
 	tc->iCount = 0;
 }
 
+static CXXTokenChain * createTokenChain(void *createArg CTAGS_ATTR_UNUSED)
+{
+	return xMalloc(1, CXXTokenChain);
+}
+
+static vString * createScratchString(void *createArg CTAGS_ATTR_UNUSED)
+{
+	return vStringNew();
+}
+
+static void clearScratchString(vString * s)
+{
+	vStringClear(s);
+}
+
+void cxxTokenChainAPIInit(void)
+{
+	g_pTokenChainPool = objPoolNew(CXX_TOKEN_CHAIN_POOL_MAXIMUM_SIZE,
+		(objPoolCreateFunc)createTokenChain, (objPoolDeleteFunc)eFree,
+		(objPoolClearFunc)cxxTokenChainInit,
+		NULL);
+	g_pScratchStringPool = objPoolNew(CXX_SCRATCH_STRING_POOL_MAXIMUM_SIZE,
+		(objPoolCreateFunc)createScratchString, (objPoolDeleteFunc)vStringDelete,
+		(objPoolClearFunc)clearScratchString,
+		NULL);
+}
+
+void cxxTokenChainAPIDone(void)
+{
+	objPoolDelete(g_pScratchStringPool);
+	objPoolDelete(g_pTokenChainPool);
+}
+
 CXXTokenChain * cxxTokenChainCreate(void)
 {
-	CXXTokenChain * tc = xMalloc(1, CXXTokenChain);
-	cxxTokenChainInit(tc);
-	return tc;
+	return objPoolGet(g_pTokenChainPool);
 }
 
 void cxxTokenChainDestroy(CXXTokenChain * tc)
@@ -48,7 +91,7 @@ void cxxTokenChainDestroy(CXXTokenChain * tc)
 		t = t2;
 	}
 
-	eFree(tc);
+	objPoolPut(g_pTokenChainPool, tc);
 }
 
 CXXToken * cxxTokenChainTakeFirst(CXXTokenChain * tc)
@@ -385,6 +428,31 @@ vString * cxxTokenChainJoin(
 	return s;
 }
 
+vString * cxxTokenChainJoinScratch(
+		CXXTokenChain * tc,
+		const char * szSeparator,
+		unsigned int uFlags
+	)
+{
+	if(!tc)
+		return NULL;
+
+	if(tc->iCount == 0)
+		return NULL;
+
+	vString * s = objPoolGet(g_pScratchStringPool);
+
+	cxxTokenChainJoinInString(tc,s,szSeparator,uFlags);
+
+	return s;
+}
+
+void cxxTokenChainReleaseScratch(vString * s)
+{
+	if(s)
+		objPoolPut(g_pScratchStringPool, s);
+}
+
 void cxxTokenChainAppendEntries(CXXTokenChain * src, CXXTokenChain * dest)
 {
 	CXXToken * pDestLast = cxxTokenChainLast(dest);
@@ -24,6 +24,10 @@ struct _CXXTokenChain
 // The struct is typedef'd in cxx_token.h
 // typedef struct _CXXTokenChain CXXTokenChain;
 
+// Called by cxxTokenAPIInit() and cxxTokenAPIDone().
+void cxxTokenChainAPIInit(void);
+void cxxTokenChainAPIDone(void);
+
 CXXTokenChain * cxxTokenChainCreate(void);
 void cxxTokenChainDestroy(CXXTokenChain * tc);
 
@@ -194,6 +198,16 @@ vString * cxxTokenChainJoin(
 		unsigned int uFlags
 	);
 
+// Like cxxTokenChainJoin() but the returned string is taken from a pool
+// of scratch strings: release it with cxxTokenChainReleaseScratch()
+// instead of vStringDelete().
+vString * cxxTokenChainJoinScratch(
+		CXXTokenChain * tc,
+		const char * szSeparator,
+		unsigned int uFlags
+	);
+void cxxTokenChainReleaseScratch(vString * s);
+
 void cxxTokenChainJoinRangeInString(
 		CXXToken * from,
 		CXXToken * to,
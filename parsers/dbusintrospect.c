@@ -128,7 +128,7 @@ static tagXpathTable dbusIntrospectXpathRootTable [] = {
 };
 
 static tagXpathTableTable dbusIntrospectXpathTableTable[] = {
-	[TABLE_ROOT]      = { ARRAY_AND_SIZE (dbusIntrospectXpathRootTable)     },
+	[TABLE_ROOT]      = { ARRAY_AND_SIZE (dbusIntrospectXpathRootTable), .streamable = true },
 	[TABLE_MAIN]      = { ARRAY_AND_SIZE (dbusIntrospectXpathMainTable)     },
 	[TABLE_INTERFACE] = { ARRAY_AND_SIZE (dbusIntrospectXpathInterfaceTable)},
 	[TABLE_MAIN_NAME] = { ARRAY_AND_SIZE (dbusIntrospectXpathMainNameTable) },
@@ -124,6 +124,77 @@ static int parseHunk (const unsigned char* cp, vString *hunk, int scope_index)
 	return i;
 }
 
+/* Read a line count of a hunk header like "-28,6" or "+1" at CP. The
+ * count is 1 if it is omitted. Returns the position after the range,
+ * or NULL if there is no range. */
+static const unsigned char *parseHunkRange (const unsigned char *cp, int sign,
+											unsigned long *count)
+{
+	if (*cp++ != sign || !isdigit (*cp))
+		return NULL;
+
+	while (isdigit (*cp))
+		cp++;
+
+	*count = 1;
+	if (*cp == ',')
+	{
+		cp++;
+		if (!isdigit (*cp))
+			return NULL;
+		*count = 0;
+		while (isdigit (*cp))
+			*count = *count * 10 + (*cp++ - '0');
+	}
+	return cp;
+}
+
+/* Get the numbers of the old and new lines in the body of the hunk
+ * starting with the "@@ " line at CP. Returns false if the header
+ * doesn't give them. */
+static bool parseHunkCounts (const unsigned char *cp,
+							 unsigned long *old_lines, unsigned long *new_lines)
+{
+	cp = parseHunkRange (cp + 3, '-', old_lines);
+	if (cp == NULL || *cp++ != ' ')
+		return false;
+	cp = parseHunkRange (cp, '+', new_lines);
+	return (cp != NULL
+			&& strncmp ((const char*) cp, HunkDelim[1], 3u) == 0);
+}
+
+/* Count LINE, a line in the body of a hunk, against the numbers of
+ * the old and new lines left. Returns false if LINE cannot be a line
+ * in the body; the counts in the header are wrong then. */
+static bool countHunkLine (const unsigned char *line,
+						   unsigned long *old_lines, unsigned long *new_lines)
+{
+	switch (*line)
+	{
+		case ' ':
+		case '\0':	/* a context line with its space stripped */
+			if (*old_lines == 0 || *new_lines == 0)
+				return false;
+			--*old_lines;
+			--*new_lines;
+			return true;
+		case '-':
+			if (*old_lines == 0)
+				return false;
+			--*old_lines;
+			return true;
+		case '+':
+			if (*new_lines == 0)
+				return false;
+			--*new_lines;
+			return true;
+		case '\\':	/* "\ No newline at end of file" */
+			return true;
+		default:
+			return false;
+	}
+}
+
 static void markTheLastTagAsDeletedFile (int scope_index)
 {
 	tagEntryInfo *e =  getEntryInCorkQueue (scope_index);
@@ -140,11 +211,22 @@ static void findDiffTags (void)
 	int delim = DIFF_DELIM_MINUS;
 	diffKind kind;
 	int scope_index = CORK_NIL;
+	/* The lines left in the body of the current hunk. A line in the
+	 * body can look like a delimiter; e.g. a removed line "-- x". */
+	unsigned long old_lines = 0, new_lines = 0;
 
 	while ((line = readLineFromInputFile ()) != NULL)
 	{
 		const unsigned char* cp = line;
 
+		if (old_lines > 0 || new_lines > 0)
+		{
+			if (countHunkLine (cp, &old_lines, &new_lines))
+				continue;
+			/* Broken counts: find the delimiters in every line again. */
+			old_lines = new_lines = 0;
+		}
+
 		if (strncmp ((const char*) cp, DiffDelims[delim], 4u) == 0)
 		{
 			scope_index = CORK_NIL;
@@ -194,6 +276,8 @@ static void findDiffTags (void)
 		{
 			if (parseHunk (cp, hunk, scope_index) != CORK_NIL)
 				vStringClear (hunk);
+			if (!parseHunkCounts (cp, &old_lines, &new_lines))
+				old_lines = new_lines = 0;
 		}
 	}
 	vStringDelete (hunk);
@@ -39,6 +39,7 @@ extern parserDefinition* DosBatchParser (void)
 	def->tagRegexTable = dosTagRegexTable;
 	def->tagRegexCount = ARRAY_SIZE (dosTagRegexTable);
 	def->method     = METHOD_NOT_CRAFTED|METHOD_REGEX;
+	def->lineOriented = true;
 	def->selectLanguage = selectors;
 	return def;
 }
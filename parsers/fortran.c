@@ -245,6 +245,11 @@ static struct {
 	bool newline;
 } Free;
 
+/* The characters in [InputCursor.current, PlainCharsEnd) are in the
+ * current line, and none of them needs the handling of getFixedFormChar ()
+ * or getFreeFormChar (); getCharFull () returns them as is. */
+static const unsigned char *PlainCharsEnd;
+
 /* indexed by tagType */
 static kindDefinition FortranKinds [] = {
 	{ true,  'b', "blockData",  "block data"},
@@ -666,6 +671,7 @@ static int skipLine (void)
 {
 	int c;
 
+	PlainCharsEnd = NULL;
 	do
 		c = getcFromInputFile ();
 	while (c != EOF  &&  c != '\n');
@@ -753,12 +759,42 @@ static lineType getLineType (void)
 	return type;
 }
 
+/* Find the plain characters following the one just read in the line.
+ * The line is terminated with NUL at InputCursor.end unless a character
+ * pushed back with ungetcToInputFile () is waiting. */
+static void findPlainChars (const char *const specialChars)
+{
+	const unsigned char *p = InputCursor.current;
+
+	if (p == NULL || p >= InputCursor.end)
+		return;
+
+	PlainCharsEnd = p + strcspn ((const char *) p, specialChars);
+}
+
+/* A newline, a comment, and an ampersand possibly marking free source
+ * form end the plain characters in the body of a fixed form line. */
+static void findFixedFormPlainChars (void)
+{
+	findPlainChars ("\n!&");
+#ifdef STRICT_FIXED_FORM
+	if (PlainCharsEnd == NULL)
+		;
+	else if (Fixed.column >= 71)
+		PlainCharsEnd = InputCursor.current;
+	else if (PlainCharsEnd > InputCursor.current + (71 - Fixed.column))
+		PlainCharsEnd = InputCursor.current + (71 - Fixed.column);
+#endif
+}
+
 static int getFixedFormChar (bool parsingString, bool *freeSourceFormFound)
 {
 	bool newline = false;
 	lineType type;
 	int c = '\0';
 
+	PlainCharsEnd = NULL;
+
 	if (Fixed.column > 0)
 	{
 #ifdef STRICT_FIXED_FORM
@@ -842,6 +878,8 @@ static int getFixedFormChar (bool parsingString, bool *freeSourceFormFound)
 				Assert ("Unexpected line type" == NULL);
 		}
 	}
+	if (Fixed.column > 0 && c != '\n' && c != EOF)
+		findFixedFormPlainChars ();
 	return c;
 }
 
@@ -856,7 +894,10 @@ static int skipToNextLine (void)
 static int getFreeFormChar (void)
 {
 	bool advanceLine = false;
-	int c = getcFromInputFile ();
+	int c;
+
+	PlainCharsEnd = NULL;
+	c = getcFromInputFile ();
 
 	/* If the last nonblank, non-comment character of a FORTRAN 90
 	 * free-format text line is an ampersand then the next non-comment
@@ -898,6 +939,11 @@ static int getFreeFormChar (void)
 			advanceLine = false;
 	}
 	Free.newline = (bool) (c == '\n');
+
+	/* Only a newline and an ampersand marking a continuation are special
+	 * in the middle of a free form line. */
+	if (!Free.newline && c != EOF)
+		findPlainChars ("\n&");
 	return c;
 }
 
@@ -910,6 +956,11 @@ static int getCharFull (bool parsingString, bool *freeSourceFormFound)
 		c = Ungetc;
 		Ungetc = '\0';
 	}
+	else if (InputCursor.current < PlainCharsEnd)
+	{
+		++Fixed.column;			/* not used in free source form */
+		c = *InputCursor.current++;
+	}
 	else if (inFreeSourceForm)
 		c = getFreeFormChar ();
 	else
@@ -1013,6 +1064,21 @@ static void parseIdentifier (vString *const string, const int firstChar)
 	do
 	{
 		vStringPut (string, c);
+
+		/* Take the plain identifier characters following C at once. */
+		if (Ungetc == '\0')
+		{
+			const unsigned char *p = InputCursor.current;
+			while (p < PlainCharsEnd && isident (*p))
+				p++;
+			if (p != InputCursor.current)
+			{
+				vStringNCatSUnsafe (string, (const char *) InputCursor.current,
+									p - InputCursor.current);
+				Fixed.column += p - InputCursor.current;
+				InputCursor.current = p;
+			}
+		}
 		c = getChar ();
 	} while (isident (c));
 
@@ -1089,8 +1155,9 @@ static void readToken (tokenInfo *const token)
 	token->isMethod = false;
 	token->signature = NULL;
 
-getNextChar:
-	c = getChar ();
+	do
+		c = getChar ();
+	while (c == ' ' || c == '\t');
 
 	token->lineNumber	= getInputLineNumber ();
 	token->filePosition	= getInputFilePosition ();
@@ -1098,8 +1165,6 @@ getNextChar:
 	switch (c)
 	{
 		case EOF:  token->type = TOKEN_EOF;         break;
-		case ' ':  goto getNextChar;
-		case '\t': goto getNextChar;
 		case ',':  token->type = TOKEN_COMMA;       break;
 		case '(':  token->type = TOKEN_PAREN_OPEN;  break;
 		case ')':  token->type = TOKEN_PAREN_CLOSE; break;
@@ -2739,6 +2804,7 @@ static rescanReason findFortranTags (const unsigned int passCount)
 		Fixed.column = 0;
 		Fixed.freeSourceFormFound = false;
 	}
+	PlainCharsEnd = NULL;
 
 	parseProgramUnit (token);
 	if (inFixedSourceForm && Fixed.freeSourceFormFound)
@@ -30,6 +30,7 @@
 #include "debug.h"
 #include "xtag.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "strlist.h"
 
 #define isIdentifierChar(c) \
@@ -333,16 +334,15 @@ static int makeSimpleGDScriptRefTag (const tokenInfo *const token,
 
 static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 {
-	tokenInfo *token = xMalloc (1, tokenInfo);
-	token->string = vStringNew ();
+	vString *string;
+	tokenInfo *token = allocPooledToken (sizeof (tokenInfo), &string);
+	token->string = string;
 	return token;
 }
 
 static void deletePoolToken (void *data)
 {
-	tokenInfo *token = data;
-	vStringDelete (token->string);
-	eFree (token);
+	freePooledToken (data, sizeof (tokenInfo));
 }
 
 static void clearPoolToken (void *data)
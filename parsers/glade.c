@@ -62,7 +62,7 @@ enum gladeXpathTable {
 };
 
 static tagXpathTableTable gladeXpathTableTable[] = {
-	[TABLE_MAIN] = { ARRAY_AND_SIZE(gladeXpathMainTable) },
+	[TABLE_MAIN] = { ARRAY_AND_SIZE(gladeXpathMainTable), .streamable = true },
 };
 
 static void
@@ -18,6 +18,7 @@
 #include "read.h"
 #include "numarray.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "parse.h"
 #include "routines.h"
 #include "vstring.h"
@@ -99,6 +100,7 @@ typedef struct sCollector {
 
 static int Lang_go;
 static objPool *TokenPool = NULL;
+static tokenType lastTokenType = TOKEN_NONE;
 
 typedef enum {
 	GOTAG_UNDEFINED = -1,
@@ -197,8 +199,9 @@ static fieldDefinition GoFields [] = {
 
 static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 {
-	tokenInfo *const token = xMalloc (1, tokenInfo);
-	token->string = vStringNew ();
+	vString *string;
+	tokenInfo *const token = allocPooledToken (sizeof (tokenInfo), &string);
+	token->string = string;
 	return token;
 }
 
@@ -224,10 +227,7 @@ static void copyToken (tokenInfo *const dest, const tokenInfo *const other)
 
 static void deletePoolToken (void* data)
 {
-	tokenInfo * const token = data;
-
-	vStringDelete (token->string);
-	eFree (token);
+	freePooledToken (data, sizeof (tokenInfo));
 }
 
 static void initialize (const langType language)
@@ -355,7 +355,6 @@ static void collectorTruncate (collector *collector, bool dropLast)
 static void readTokenFull (tokenInfo *const token, collector *collector)
 {
 	int c;
-	static tokenType lastTokenType = TOKEN_NONE;
 	bool firstWhitespace = true;
 	bool whitespace;
 
@@ -554,27 +553,95 @@ static void readToken (tokenInfo *const token)
 	readTokenFull (token, NULL);
 }
 
+/*
+ * Skip to the character matching OPEN_C without making tokens.
+ * Nothing is tagged between a pair of brackets skipped with no
+ * collector (e.g. a function body), so only the comments and the
+ * string, raw string and rune literals, which may contain the
+ * brackets, have to be recognized here. They are skipped the same
+ * way as readTokenFull () does.
+ */
+static void skipCharsToMatched (int open_c, int close_c)
+{
+	int nest_level = 1;
+
+	while (nest_level > 0)
+	{
+		int c = getcFromInputFile ();
+
+		if (c == EOF)
+			return;
+		else if (c == open_c)
+			nest_level++;
+		else if (c == close_c)
+			nest_level--;
+		else if (c == '"' || c == '\'' || c == '`')
+		{
+			int d;
+			while ((d = getcFromInputFile ()) != EOF && d != c)
+			{
+				if (d == '\\' && c != '`')
+					getcFromInputFile ();
+			}
+		}
+		else if (c == '/')
+		{
+			int d = getcFromInputFile ();
+			if (d == '/')
+				skipToCharacterInInputFile ('\n');
+			else if (d == '*')
+			{
+				d = skipToCharacterInInputFile ('*');
+				while (d == '*')
+				{
+					d = getcFromInputFile ();
+					if (d == '/')
+						break;
+					else if (d != '*' && d != EOF)
+						d = skipToCharacterInInputFile ('*');
+				}
+			}
+			else
+				ungetcToInputFile (d);
+		}
+	}
+}
+
 static bool skipToMatchedNoRead (tokenInfo *const token, collector *collector)
 {
 	int nest_level = 0;
 	tokenType open_token = token->type;
 	tokenType close_token;
+	int open_c, close_c;
 
 	switch (open_token)
 	{
 		case TOKEN_OPEN_PAREN:
 			close_token = TOKEN_CLOSE_PAREN;
+			open_c = '(';
+			close_c = ')';
 			break;
 		case TOKEN_OPEN_CURLY:
 			close_token = TOKEN_CLOSE_CURLY;
+			open_c = '{';
+			close_c = '}';
 			break;
 		case TOKEN_OPEN_SQUARE:
 			close_token = TOKEN_CLOSE_SQUARE;
+			open_c = '[';
+			close_c = ']';
 			break;
 		default:
 			return false;
 	}
 
+	if (!collector)
+	{
+		skipCharsToMatched (open_c, close_c);
+		lastTokenType = close_token;
+		return true;
+	}
+
 	/*
 	 * This routine will skip to a matching closing token.
 	 * It will also handle nested tokens.
@@ -16,6 +16,7 @@
 #include "entry.h"
 #include "parse.h"
 #include "read.h"
+#include "bytescan.h"
 #include "routines.h"
 #include "keyword.h"
 #include "promise.h"
@@ -205,6 +206,20 @@ static void readTokenText (tokenInfo *const token, bool collectText)
 
 	vStringClear (token->string);
 
+	/* The text not collected can be skipped to the next tag at once. */
+	if (!collectText)
+	{
+		c = skipToCharacterInInputFile ('<');
+		if (c == EOF)
+			token->type = TOKEN_EOF;
+		else
+		{
+			ungetcToInputFile (c);
+			token->type = TOKEN_TEXT;
+		}
+		return;
+	}
+
 getNextChar:
 
 	c = getcFromInputFile ();
@@ -449,6 +464,52 @@ static bool readTagContent (tokenInfo *token, vString *text, long *line, long *l
 	return type == TOKEN_CLOSE_TAG_START;
 }
 
+/* Skip the script to the next '<', leaving it unread. *LINE and
+ * *LINEOFFSET are set to the position after the last non-space character
+ * skipped, where readTokenInScript () would have stopped reading the
+ * token before the '<', or to the current position if there is none. */
+static void skipToTagInScript (long *line, long *lineOffset)
+{
+	*line = getInputLineNumber ();
+	*lineOffset = getInputLineOffset ();
+
+	while (1)
+	{
+		const unsigned char *p = InputCursor.current;
+		int c;
+
+		if (p < InputCursor.end)
+		{
+			const unsigned char *lt = findByte (p, InputCursor.end, '<');
+			const unsigned char *q = lt;
+
+			while (q > p && isspace (q[-1]))
+				q--;
+			if (q > p)
+			{
+				InputCursor.current = q;
+				*line = getInputLineNumber ();
+				*lineOffset = getInputLineOffset ();
+			}
+			InputCursor.current = lt;
+			if (lt < InputCursor.end)
+				return;
+		}
+
+		c = getcFromInputFile ();
+		if (c == EOF || c == '<')
+		{
+			ungetcToInputFile (c);
+			return;
+		}
+		if (!isspace (c))
+		{
+			*line = getInputLineNumber ();
+			*lineOffset = getInputLineOffset ();
+		}
+	}
+}
+
 static bool skipScriptContent (tokenInfo *token, long *line, long *lineOffset)
 {
 	TRACE_ENTER();
@@ -463,8 +524,13 @@ static bool skipScriptContent (tokenInfo *token, long *line, long *lineOffset)
 
 	do
 	{
-		line_tmp[0] = getInputLineNumber ();
-		lineOffset_tmp[0] = getInputLineOffset ();
+		if (found_start)
+		{
+			line_tmp[0] = getInputLineNumber ();
+			lineOffset_tmp[0] = getInputLineOffset ();
+		}
+		else
+			skipToTagInScript (&line_tmp[0], &lineOffset_tmp[0]);
 
 		readTokenInScript (token);
 		type = token->type;
@@ -502,29 +568,18 @@ static void skipOtherScriptContent (const int delimiter)
 	const long startLineOffset = getInputLineOffset () - 2;
 
 	vString *script_name = vStringNew ();
-	bool reading_script_name = true;
-	while (1)
+	int c;
+
+	while ((c = getcFromInputFile ()) != EOF && !isspace (c))
+		vStringPut (script_name, c);
+
+	if (c != EOF)
 	{
-		int c = getcFromInputFile ();
-		if (c == EOF)
-		{
-			break;
-		}
-		else if (reading_script_name && !isspace(c))
-		{
-			vStringPut (script_name, c);
-		}
-		else if (reading_script_name)
-		{
-			reading_script_name = false;
-		}
-		else if (c == delimiter)
+		while (skipToCharacterInInputFile (delimiter) != EOF)
 		{
 			c = getcFromInputFile ();
 			if (c == '>')
-			{
 				break;
-			}
 			ungetcToInputFile (c);
 		}
 	}
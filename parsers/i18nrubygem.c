@@ -141,7 +141,10 @@ static bool i18nRubyGemInitTagEntry(tagEntryInfo *e, yamlSubparser *yaml, char *
 				i18n->localeFound = LOCALE_FOUND;
 			}
 			else
+			{
 				i18n->localeFound = LOCALE_NONE;
+				ypathStopTraversing (yaml);
+			}
 		}
 	}
 
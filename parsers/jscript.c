@@ -44,6 +44,7 @@
 #include "routines.h"
 #include "vstring.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "options.h"
 #include "mbcs.h"
 #include "trace.h"
@@ -149,6 +150,13 @@ static langType Lang_js;
 
 static objPool *TokenPool = NULL;
 
+/* The classes of the bytes for the fast paths of the tokenizer */
+enum {
+	JS_CHAR_BLANK = 1 << 0,		/* ' ' and '\t' */
+	JS_CHAR_IDENT = 1 << 1,		/* isIdentChar() except '.' */
+};
+static unsigned char JsCharClass [256];
+
 #ifdef HAVE_ICONV
 static iconv_t JSUnicodeConverter = (iconv_t) -2;
 #endif
@@ -331,9 +339,10 @@ static void dumpToken (const tokenInfo *const token);
 
 static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 {
-	tokenInfo *token = xMalloc (1, tokenInfo);
+	vString *string;
+	tokenInfo *token = allocPooledToken (sizeof (tokenInfo), &string);
 
-	token->string = vStringNew ();
+	token->string = string;
 	token->scope = CORK_NIL;
 
 	return token;
@@ -355,9 +364,7 @@ static void clearPoolToken (void *data)
 
 static void deletePoolToken (void *data)
 {
-	tokenInfo *token = data;
-	vStringDelete (token->string);
-	eFree (token);
+	freePooledToken (data, sizeof (tokenInfo));
 }
 
 static void copyToken (tokenInfo *const dest, const tokenInfo *const src,
@@ -380,8 +387,8 @@ static void copyToken (tokenInfo *const dest, const tokenInfo *const src,
 static void injectDynamicName (tokenInfo *const token, vString *newName)
 {
 	token->dynamicProp = true;
-	vStringDelete (token->string);
-	token->string = newName;
+	vStringCopy (token->string, newName);
+	vStringDelete (newName);
 }
 
 /*
@@ -830,11 +837,31 @@ static int readUnicodeEscapeSequence (const int fallback)
 	return c;
 }
 
+/* Append the characters up to one in STOPS in the current input line to
+ * STRING at once, or skip them if STRING is NULL.
+ */
+static void readInputUntil (vString *const string, const char *const stops)
+{
+	if (InputCursor.current < InputCursor.end)
+	{
+		/* [current, end) is the rest of the line, terminated by a NUL. */
+		size_t length = strcspn ((const char *) InputCursor.current, stops);
+		if (string)
+			vStringNCatSUnsafe (string, (const char *) InputCursor.current, length);
+		InputCursor.current += length;
+	}
+}
+
 static void parseString (vString *const string, const int delimiter)
 {
+	const char *const stops = (delimiter == '"')? "\"\\\r\n": "'\\\r\n";
 	bool end = false;
+
+	Assert (delimiter == '"' || delimiter == '\'');
 	while (! end)
 	{
+		readInputUntil (string, stops);
+
 		int c = getcFromInputFile ();
 		if (c == EOF)
 			end = true;
@@ -884,6 +911,7 @@ static void parseRegExp (void)
 
 	do
 	{
+		readInputUntil (NULL, "/\\[]\r\n");
 		c = getcFromInputFile ();
 		if (! in_range && c == '/')
 		{
@@ -927,11 +955,38 @@ static void accept_period_in_identifier(bool incl)
 	}
 }
 
+static void initJsCharClass (void)
+{
+	for (int c = 0; c < 256; c++)
+	{
+		JsCharClass [c] = 0;
+		if (c == ' ' || c == '\t')
+			JsCharClass [c] |= JS_CHAR_BLANK;
+		if (isalpha (c) || isdigit (c) || c == '$' ||
+			c == '@' || c == '_' || c == '#' || c >= 0x80)
+			JsCharClass [c] |= JS_CHAR_IDENT;
+	}
+}
+
 static bool isIdentChar(const int c)
 {
-	return (isalpha (c) || isdigit (c) || c == '$' || \
-			c == '@' || c == '_' || c == '#' || \
-			c >= 0x80 || (include_period_in_identifier > 0 && c == '.'));
+	return ((c >= 0 && c < 256 && (JsCharClass [c] & JS_CHAR_IDENT)) ||
+			(include_period_in_identifier > 0 && c == '.'));
+}
+
+/* Skip the blanks in the current input line at once, and return the
+ * number of them.
+ */
+static int skipBlanks (void)
+{
+	const unsigned char *p = InputCursor.current;
+
+	while (p < InputCursor.end && (JsCharClass [*p] & JS_CHAR_BLANK))
+		p++;
+
+	int n = (int) (p - InputCursor.current);
+	InputCursor.current = p;
+	return n;
 }
 
 static void parseIdentifier (vString *const string, const int first_char)
@@ -941,6 +996,15 @@ static void parseIdentifier (vString *const string, const int first_char)
 	do
 	{
 		vStringPut (string, c);
+
+		/* Take the rest of the identifier in the current line at once. */
+		const unsigned char *p = InputCursor.current;
+		while (p < InputCursor.end && isIdentChar (*p))
+			p++;
+		vStringNCatSUnsafe (string, (const char *) InputCursor.current,
+							p - InputCursor.current);
+		InputCursor.current = p;
+
 		c = getcFromInputFile ();
 		if (c == '\\')
 			c = readUnicodeEscapeSequence (c);
@@ -957,6 +1021,7 @@ static void parseTemplateString (vString *const string)
 	int c;
 	do
 	{
+		readInputUntil (string, "`\\$");
 		c = getcFromInputFile ();
 		if (c == '`' || c == EOF)
 			break;
@@ -1053,6 +1118,8 @@ getNextChar:
 		c = getcFromInputFile ();
 		if (include_newlines && (c == '\r' || c == '\n'))
 			newline_encountered = true;
+		else if (c == '\t' || c == ' ')
+			i += skipBlanks ();
 		i++;
 	}
 	while (c == '\t' || c == ' ' || c == '\r' || c == '\n');
@@ -3327,6 +3394,7 @@ static void initialize (const langType language)
 	Assert (ARRAY_SIZE (JsKinds) == JSTAG_COUNT);
 	Lang_js = language;
 
+	initJsCharClass ();
 	TokenPool = objPoolNew (16, newPoolToken, deletePoolToken, clearPoolToken, NULL);
 }
 
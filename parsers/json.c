@@ -21,6 +21,7 @@
 #include "entry.h"
 #include "keyword.h"
 #include "options.h"
+#include "param.h"
 #include "parse.h"
 #include "read.h"
 #include "routines.h"
@@ -144,6 +145,10 @@ static void makeJsonTag (tokenInfo *const token, const jsonKind kind)
 #define DEPTH_LIMIT 512
 static int depth_counter;
 
+/* Objects and arrays nested deeper than this are skipped without
+ * tagging their contents. 0 means no limit. */
+static unsigned int maxDepth;
+
 static void readTokenFull (tokenInfo *const token,
 						   bool includeStringRepr)
 {
@@ -284,6 +289,43 @@ static void skipToOneOf3 (tokenInfo *const token,
 	}
 }
 
+/* Skip the rest of the object or array opened by the last token read,
+ * up to and including its closing bracket, without making tokens.
+ * Brackets of both types are counted together as the token based
+ * skipping is forgiving about mismatched ones too. */
+static void skipValueChars (void)
+{
+	int nest_level = 1;
+
+	while (nest_level > 0)
+	{
+		int c = getcFromInputFile ();
+
+		switch (c)
+		{
+			case EOF:
+				return;
+			case '[':
+			case '{':
+				nest_level++;
+				break;
+			case ']':
+			case '}':
+				nest_level--;
+				break;
+			case '"':
+				while ((c = getcFromInputFile ()) != '"' && c != EOF)
+				{
+					if (c == '\\')
+						getcFromInputFile ();
+					else if (c >= 0x00 && c <= 0x1F)
+						break; /* same as readTokenFull () */
+				}
+				break;
+		}
+	}
+}
+
 static jsonKind tokenToKind (const tokenType type)
 {
 	switch (type)
@@ -300,7 +342,14 @@ static jsonKind tokenToKind (const tokenType type)
 
 static void parseValue (tokenInfo *const token)
 {
-	if (token->type == TOKEN_OPEN_CURLY)
+	if (maxDepth > 0 && depth_counter > (int) maxDepth
+		&& (token->type == TOKEN_OPEN_CURLY || token->type == TOKEN_OPEN_SQUARE))
+	{
+		skipValueChars ();
+		depth_counter--;
+		readToken (token);
+	}
+	else if (token->type == TOKEN_OPEN_CURLY)
 	{
 		tokenInfo *name = newToken ();
 
@@ -399,6 +448,22 @@ static void initialize (const langType language)
 	Lang_json = language;
 }
 
+static bool jsonSetMaxDepth (const langType language CTAGS_ATTR_UNUSED,
+							 const char *name, const char *arg)
+{
+	if (!strToUInt (arg, 0, &maxDepth))
+		error (FATAL, "Invalid value for \"%s\" parameter", name);
+	return true;
+}
+
+static paramDefinition JsonParams [] = {
+	{
+		.name = "maxDepth",
+		.desc = "don't tag the contents of objects and arrays nested deeper than this ([0] for no limit)",
+		.handleParam = jsonSetMaxDepth,
+	},
+};
+
 /* Create parser definition structure */
 extern parserDefinition* JsonParser (void)
 {
@@ -412,6 +477,8 @@ extern parserDefinition* JsonParser (void)
 	def->keywordTable = JsonKeywordTable;
 	def->keywordCount = ARRAY_SIZE (JsonKeywordTable);
 	def->allowNullTag = true;
+	def->paramTable = JsonParams;
+	def->paramCount = ARRAY_SIZE (JsonParams);
 
 	return def;
 }
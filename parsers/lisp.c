@@ -12,12 +12,15 @@
 */
 #include "general.h"  /* must always come first */
 
+#include "bytescan.h"
 #include "parse.h"
 #include "read.h"
 #include "routines.h"
 #include "selectors.h"
 #include "vstring.h"
 
+#include "lisp.h"
+
 #include <string.h>
 
 /*
@@ -280,19 +283,122 @@ static void L_getit (vString *const name, const unsigned char *dbp,
 
 /* Algorithm adapted from from GNU etags.
  */
+extern void lispFormScannerInit (lispFormScanner *s, unsigned int syntax)
+{
+	s->syntax = syntax;
+	s->depth = 0;
+	s->blockComment = 0;
+	s->inString = false;
+}
+
+#define advance(P,N,END) ((P) = ((END) - (P) > (N))? (P) + (N): (END))
+
+extern void lispScanFormLine (lispFormScanner *s, const unsigned char *line)
+{
+	static const unsigned char set [] = { '(', ')', '"', ';', '\\', '#', '|', '?' };
+	const unsigned char *end = line + strlen ((const char *) line);
+	const unsigned char *p = line;
+
+	while (p < end)
+	{
+		if (s->inString)
+		{
+			p = findByte2 (p, end, '"', '\\');
+			if (p < end && *p == '"')
+				s->inString = false;
+			advance (p, (*p == '\\')? 2: 1, end);
+			continue;
+		}
+		else if (s->blockComment > 0)
+		{
+			p = findByte2 (p, end, '|', '#');
+			if (p + 1 < end && p [0] == '|' && p [1] == '#')
+				s->blockComment--, p++;
+			else if (p + 1 < end && p [0] == '#' && p [1] == '|')
+				s->blockComment++, p++;
+			advance (p, 1, end);
+			continue;
+		}
+
+		p = findByteInSet (p, end, set, ARRAY_SIZE (set));
+		if (p == end)
+			break;
+		switch (*p)
+		{
+			case '(':
+				s->depth++;
+				break;
+			case ')':
+				if (--s->depth == 0)
+					return;
+				break;
+			case '"':
+				s->inString = true;
+				break;
+			case ';':
+				return;
+			case '\\':
+				/* An escaped character in a symbol, or a character of Clojure */
+				p++;
+				break;
+			case '#':
+				if (p + 1 < end && p [1] == '\\' && (s->syntax & LISP_SYNTAX_HASH_CHAR))
+					p += 2;
+				else if (p + 1 < end && p [1] == '|' && (s->syntax & LISP_SYNTAX_BLOCK_COMMENT))
+				{
+					s->blockComment++;
+					p++;
+				}
+				break;
+			case '|':
+				if (s->syntax & LISP_SYNTAX_BAR_SYMBOL)
+					p = findByte (p + 1, end, '|');
+				break;
+			case '?':
+				/* ?( and ?\( start no symbol. */
+				if ((s->syntax & LISP_SYNTAX_QUESTION_CHAR)
+					&& (p == line || isspace (p [-1]) || strchr ("()'`,", p [-1])))
+					p += (p + 1 < end && p [1] == '\\')? 2: 1;
+				break;
+		}
+		advance (p, 1, end);
+	}
+}
+#undef advance
+
+extern const unsigned char *lispSkipForm (lispFormScanner *s)
+{
+	const unsigned char *line;
+
+	while (s->depth > 0 && (line = readLineFromInputFile ()) != NULL)
+	{
+		if (*line == '(' && !s->inString && s->blockComment == 0)
+			return line;
+		lispScanFormLine (s, line);
+	}
+	return NULL;
+}
+
 static void findLispTagsCommon (bool case_insensitive,
 								bool has_namespace,
-								int (*hint2kind) (const vString *))
+								int (*hint2kind) (const vString *),
+								unsigned int syntax)
 {
 	vString *name = vStringNew ();
 	vString *kind_hint = vStringNew ();
-	const unsigned char* p;
+	const unsigned char* line;
+	const unsigned char* next = NULL;
+	lispFormScanner scanner;
 
-
-	while ((p = readLineFromInputFile ()) != NULL)
+	while ((line = next? next: readLineFromInputFile ()) != NULL)
 	{
+		const unsigned char* p = line;
+
+		next = NULL;
 		if (*p == '(')
 		{
+			bool head = false;
+
 			if (L_isdef (p, case_insensitive))
 			{
 				vStringClear (kind_hint);
@@ -305,6 +411,7 @@ static void findLispTagsCommon (bool case_insensitive,
 				while (isspace (*p))
 					p++;
 				L_getit (name, p, case_insensitive, hint2kind, kind_hint);
+				head = true;
 			}
 			else if (has_namespace)
 			{
@@ -330,9 +437,20 @@ static void findLispTagsCommon (bool case_insensitive,
 						while (isspace (*p))
 							p++;
 						L_getit (name, p, case_insensitive, hint2kind, kind_hint);
+						head = true;
 					}
 				}
 			}
+
+			/* Don't match the lines of the body against "(def": a
+			 * docstring line like "(defun foo ...)" in column 0 is
+			 * not a definition, and a long macro body needs no scan. */
+			if (head)
+			{
+				lispFormScannerInit (&scanner, syntax);
+				lispScanFormLine (&scanner, line);
+				next = lispSkipForm (&scanner);
+			}
 		}
 	}
 	vStringDelete (name);
@@ -341,12 +459,15 @@ static void findLispTagsCommon (bool case_insensitive,
 
 static void findLispTags (void)
 {
-	findLispTagsCommon (true, true, lisp_hint2kind);
+	findLispTagsCommon (true, true, lisp_hint2kind,
+						LISP_SYNTAX_BLOCK_COMMENT | LISP_SYNTAX_HASH_CHAR
+						| LISP_SYNTAX_BAR_SYMBOL);
 }
 
 static void findEmacsLispTags (void)
 {
-	findLispTagsCommon (false, false, elisp_hint2kind);
+	findLispTagsCommon (false, false, elisp_hint2kind,
+						LISP_SYNTAX_QUESTION_CHAR);
 }
 
 extern parserDefinition* LispParser (void)
@@ -0,0 +1,52 @@
+/*
+*   Copyright (c) 2026, Universal Ctags contributors
+*
+*   This source code is released for free distribution under the terms of the
+*   GNU General Public License version 2 or (at your option) any later version.
+*
+*   Defines interface for skipping the rest of a form in the parsers of
+*   the Lisp family.
+*/
+#ifndef CTAGS_PARSER_LISP_H
+#define CTAGS_PARSER_LISP_H
+
+/*
+*   INCLUDE FILES
+*/
+#include "general.h"  /* must always come first */
+
+/*
+*   DATA DECLARATIONS
+*/
+
+/* The syntax of the dialect, beyond ( ) " ; and \ */
+enum lispSyntax {
+	LISP_SYNTAX_BLOCK_COMMENT = (1 << 0), /* #| ... |# */
+	LISP_SYNTAX_HASH_CHAR     = (1 << 1), /* #\( */
+	LISP_SYNTAX_QUESTION_CHAR = (1 << 2), /* ?( and ?\( of Emacs Lisp */
+	LISP_SYNTAX_BAR_SYMBOL    = (1 << 3), /* |a (b| */
+};
+
+typedef struct sLispFormScanner {
+	unsigned int syntax;	/* bits of enum lispSyntax */
+	int depth;
+	int blockComment;		/* the depth of nested #| |# */
+	bool inString;
+} lispFormScanner;
+
+/*
+*   FUNCTION PROTOTYPES
+*/
+extern void lispFormScannerInit (lispFormScanner *s, unsigned int syntax);
+
+/* Count the parentheses in LINE. The scanning stops where the depth
+ * gets back to 0. */
+extern void lispScanFormLine (lispFormScanner *s, const unsigned char *line);
+
+/* Read the lines of the input with readLineFromInputFile () until the
+ * depth gets back to 0. A line starting with '(' out of a string or a
+ * comment is taken as the start of a top-level form, and returned not
+ * to lose the form after an unbalanced one. NULL is returned otherwise. */
+extern const unsigned char *lispSkipForm (lispFormScanner *s);
+
+#endif	/* CTAGS_PARSER_LISP_H */
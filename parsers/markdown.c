@@ -33,6 +33,7 @@
 #include "routines.h"
 #include "promise.h"
 #include "htable.h"
+#include "xtag.h"
 
 #include "markdown.h"
 
@@ -348,6 +349,26 @@ static void getAllHashTagsInLineMaybe (const unsigned char *line, int pos,
 	}
 }
 
+/* Return true if a promise for a code block written in LANG would run. */
+static bool isCodeBlockLanguageEnabled (const vString *const lang)
+{
+	langType language;
+
+	if (vStringIsEmpty (lang) || !isXtagEnabled (XTAG_GUEST))
+		return false;
+
+	language = getNamedLanguage (vStringValue (lang), 0);
+	return language != LANG_IGNORE && isLanguageEnabled (language);
+}
+
+/* Return true if LINE can close the fenced code block opened with C. */
+static bool isCodeBlockFenceMaybe (const unsigned char *line, char c)
+{
+	while (isspace (*line))
+		line++;
+	return line[0] == c && line[1] == c && line[2] == c;
+}
+
 static void findMarkdownTags (void)
 {
 	vString *prevLine = vStringNew ();
@@ -368,6 +389,10 @@ static void findMarkdownTags (void)
 	markdownSubparser *marksub = NULL;
 	while ((line = readLineFromInputFile ()) != NULL)
 	{
+		/* The body of a fenced code block is left to the guest parser. */
+		if (inCodeChar && !marksub && !isCodeBlockFenceMaybe (line, inCodeChar))
+			continue;
+
 		int lineLen = strlen ((const char*) line);
 		bool lineProcessed = false;
 		bool indented;
@@ -424,6 +449,8 @@ static void findMarkdownTags (void)
 						vStringStripLeading (codeLang);
 						vStringStripTrailing (codeLang);
 					}
+					if (!isCodeBlockLanguageEnabled (codeLang))
+						vStringClear (codeLang);
 				}
 				else
 				{
@@ -49,6 +49,7 @@ extern parserDefinition* MatLabParser (void)
 	def->tagRegexTable = matlabTagRegexTable;
 	def->tagRegexCount = ARRAY_SIZE (matlabTagRegexTable);
 	def->method     = METHOD_NOT_CRAFTED|METHOD_REGEX;
+	def->lineOriented = true;
 	def->selectLanguage = selectors;
 	return def;
 }
@@ -58,12 +58,17 @@ static void leavingPodNotify  (perlSubparser *perl);
  *   DATA DEFINITIONS
  */
 
+static const int notifiedKinds[] = {
+	KIND_PERL_MODULE, KIND_GHOST_INDEX,
+};
+
 static struct FParamsSubparser fparamsSubparser = {
 	.perl = {
 		.subparser = {
 			.direction  = SUBPARSER_BI_DIRECTION,
 			.inputStart = inputStart,
 			.makeTagEntryNotify = makeTagEntryNotify,
+			.makeTagEntryNotifyKinds = notifiedKinds,
 		},
 		.enteringPodNotify = enteringPodNotify,
 		.leavingPodNotify  = leavingPodNotify,
@@ -146,6 +146,10 @@ static void findingQuotedWordNotify (perlSubparser *perl, int moduleIndex, const
  *   DATA DEFINITIONS
  */
 
+static const int notifiedKinds[] = {
+	KIND_PERL_PACKAGE, KIND_PERL_SUBROUTINE, KIND_PERL_MODULE, KIND_GHOST_INDEX,
+};
+
 static struct mooseSubparser mooseSubparser = {
 	.perl = {
 		.subparser = {
@@ -153,6 +157,7 @@ static struct mooseSubparser mooseSubparser = {
 			.inputStart = inputStart,
 			.inputEnd   = inputEnd,
 			.makeTagEntryNotify = makeTagEntryNotify,
+			.makeTagEntryNotifyKinds = notifiedKinds,
 		},
 		.enteringPodNotify = enteringPodNotify,
 		.leavingPodNotify  = leavingPodNotify,
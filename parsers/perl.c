@@ -652,6 +652,52 @@ static void finiHereDocMarkerManager(struct hereDocMarkerManager *mgr)
 	mgr->current = 0;
 }
 
+/* Skip the lines of the pod area started at the current line, up to
+ * and including its "=cut" line, and make a promise for running the
+ * Pod parser on the area. Nothing else in the area matters, so only
+ * "=cut" is looked for here. Returns false if the input ends in the
+ * area. */
+static bool skipPodArea (void)
+{
+	unsigned long podStart = getSourceLineNumber ();
+	const unsigned char *line;
+
+	notifyEnteringPod ();
+	while ((line = readLineFromInputFile ()) != NULL)
+	{
+		if (strncmp ((const char*) line, "=cut", (size_t) 4) == 0)
+		{
+			notifyLeavingPod ();
+			makePromise ("Pod",
+						 podStart, 0,
+						 getInputLineNumber(), 0,
+						 getSourceLineNumber());
+			return true;
+		}
+	}
+	return false;
+}
+
+/* A pod area can be after __END__ marker.
+ * Perl parser itself doesn't need to parse the area
+ * after the marker. Parsing the area is needed only
+ * if Perl parser runs Pod parser as a guest.
+ */
+static void skipDataArea (void)
+{
+	const unsigned char *line;
+
+	if (!isXtagEnabled (XTAG_GUEST))
+		return;
+
+	while ((line = readLineFromInputFile ()) != NULL)
+	{
+		if (line [0] == '=' && isPodWord ((const char*)line + 1)
+			&& !skipPodArea ())
+			break;
+	}
+}
+
 /* Algorithm adapted from from GNU etags.
  * Perl support by Bart Robinson <lomew@cs.utah.edu>
  * Perl sub names: look for /^ [ \t\n]sub [ \t\n]+ [^ \t\n{ (]+/
@@ -660,17 +706,7 @@ static void findPerlTags (void)
 {
 	vString *name = vStringNew ();
 	vString *package = NULL;
-	bool skipPodDoc = false;
 	const unsigned char *line;
-	unsigned long podStart = 0UL;
-
-	/* A pod area can be after __END__ marker.
-	 * Perl parser itself doesn't need to parse the area
-	 * after the marker. Parsing the area is needed only
-	 * if Perl parser runs Pod parser as a guest.
-	 * This variable is set true when it is needed.
-	 */
-	bool parse_only_pod_area = false;
 
 	/* Core modules AutoLoader and SelfLoader support delayed compilation
 	 * by allowing Perl code that follows __END__ and __DATA__ tokens,
@@ -698,41 +734,18 @@ static void findPerlTags (void)
 		if (isInHereDoc (&hdoc_mgr, line))
 			continue;
 
-		if (skipPodDoc)
+		if (line [0] == '=')
 		{
-			if (strncmp ((const char*) line, "=cut", (size_t) 4) == 0)
-			{
-				skipPodDoc = false;
-				if (podStart != 0UL)
-				{
-					notifyLeavingPod ();
-					makePromise ("Pod",
-						     podStart, 0,
-						     getInputLineNumber(), 0,
-						     getSourceLineNumber());
-					podStart = 0UL;
-				}
-			}
-			continue;
-		}
-		else if (line [0] == '=')
-		{
-			skipPodDoc = isPodWord ((const char*)line + 1);
-			if (skipPodDoc)
-			{
-				podStart = getSourceLineNumber ();
-				notifyEnteringPod ();
-			}
+			if (isPodWord ((const char*)line + 1) && !skipPodArea ())
+				break;
 			continue;
 		}
 		else if (strcmp ((const char*) line, "__DATA__") == 0)
 		{
 			if (respect_token & RESPECT_DATA)
 			{
-				if (isXtagEnabled (XTAG_GUEST))
-					parse_only_pod_area = true;
-				else
-					break;
+				skipDataArea ();
+				break;
 			}
 			else
 				continue;
@@ -741,10 +754,8 @@ static void findPerlTags (void)
 		{
 			if (respect_token & RESPECT_END)
 			{
-				if (isXtagEnabled (XTAG_GUEST))
-					parse_only_pod_area = true;
-				else
-					break;
+				skipDataArea ();
+				break;
 			}
 			else
 				continue;
@@ -752,9 +763,6 @@ static void findPerlTags (void)
 		else if (line [0] == '#')
 			continue;
 
-		if (parse_only_pod_area)
-			continue;
-
 		while (isspace (*cp) || *cp == '{' || *cp == '}')
 			cp++;
 
@@ -25,6 +25,7 @@
 #include "routines.h"
 #include "debug.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "promise.h"
 #include "trace.h"
 
@@ -490,9 +491,10 @@ static void makeFunctionTag (const tokenInfo *const token,
 
 static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 {
-	tokenInfo *token = xMalloc (1, tokenInfo);
+	vString *string;
+	tokenInfo *token = allocPooledToken (sizeof (tokenInfo), &string);
 
-	token->string = vStringNew ();
+	token->string = string;
 	token->scope  = vStringNew ();
 	return token;
 }
@@ -514,9 +516,8 @@ static void clearPoolToken (void *data)
 static void deletePoolToken (void *data)
 {
 	tokenInfo *token = data;
-	vStringDelete (token->string);
 	vStringDelete (token->scope);
-	eFree (token);
+	freePooledToken (token, sizeof (tokenInfo));
 }
 
 static void copyToken (tokenInfo *const dest, const tokenInfo *const src,
@@ -866,7 +867,7 @@ static int findPhpStart (void)
 	int c;
 	do
 	{
-		if ((c = getcFromInputFile ()) == '<')
+		if ((c = skipToCharacterInInputFile ('<')) == '<')
 		{
 			c = getcFromInputFile ();
 			/* <?, <?= and <?php, but not <?xml */
@@ -23,6 +23,7 @@
 #include "debug.h"
 #include "xtag.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "ptrarray.h"
 #include "trace.h"
 
@@ -370,16 +371,15 @@ static int makeSimplePythonRefTag (const tokenInfo *const token,
 
 static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 {
-	tokenInfo *token = xMalloc (1, tokenInfo);
-	token->string = vStringNew ();
+	vString *string;
+	tokenInfo *token = allocPooledToken (sizeof (tokenInfo), &string);
+	token->string = string;
 	return token;
 }
 
 static void deletePoolToken (void *data)
 {
-	tokenInfo *token = data;
-	vStringDelete (token->string);
-	eFree (token);
+	freePooledToken (data, sizeof (tokenInfo));
 }
 
 static void clearPoolToken (void *data)
@@ -703,6 +703,9 @@ static void readToken (tokenInfo *const token)
 
 static void reprCat (vString *const repr, const tokenInfo *const token)
 {
+	if (repr == NULL)
+		return;
+
 	if (token->type != TOKEN_INDENT &&
 	    token->type != TOKEN_WHITESPACE)
 	{
@@ -1187,7 +1190,12 @@ static bool parseClassOrDef (tokenInfo *const token,
 	/* collect parameters or inheritance */
 	if (token->type == '(')
 	{
-		arglist = vStringNew ();
+		/* Build the signature or the inheritance only if it is used. */
+		if ((isCDef && kind != K_CLASS)
+			|| isFieldValueNeeded ((kind == K_CLASS)
+								   ? FIELD_INHERITANCE
+								   : FIELD_SIGNATURE))
+			arglist = vStringNew ();
 		parameters = ptrArrayNew ((ptrArrayDeleteFunc)deleteTypedParam);
 
 		if (isCDef && kind != K_CLASS)
@@ -1744,6 +1752,7 @@ static bool parseVariable (tokenInfo *const token, const pythonKind kind)
 static void setIndent (tokenInfo *const token)
 {
 	NestingLevel *lv = nestingLevelsGetCurrent (PythonNestingLevels);
+	bool popped = false;
 
 	while (lv && PY_NL (lv)->indentation >= token->indent)
 	{
@@ -1751,7 +1760,131 @@ static void setIndent (tokenInfo *const token)
 
 		nestingLevelsPop (PythonNestingLevels);
 		lv = nestingLevelsGetCurrent (PythonNestingLevels);
+		popped = true;
+	}
+
+	/* No tag made so far is referred once a top-level scope is closed. */
+	if (popped && lv == NULL)
+		flushCorkQueue ();
+}
+
+/* Return true if the statement starting at P can make no tag in the body
+ * of a function while the local variable kind is disabled, and the
+ * statement ends in the current line at the returned *END.  A keyword
+ * having its own ID other than "pass", "return" and "as" may start a
+ * definition, an import, or a lambda bound to a name, so the statement
+ * having one is left to the parser. */
+static bool isLocalStatementInLine (const unsigned char *p,
+                                    const unsigned char *const limit,
+                                    const unsigned char **end)
+{
+	int depth = 0;
+
+	if (*p == '@')
+		return false;
+
+	while (p < limit)
+	{
+		const unsigned char c = *p;
+
+		if (c == '\'' || c == '"')
+		{
+			bool triple = (limit - p >= 3 && p[1] == c && p[2] == c);
+
+			p += triple ? 3 : 1;
+			while (p < limit && *p != '\n' && *p != '\r')
+			{
+				if (*p == '\\')
+					p++;
+				else if (*p == c && (! triple || (limit - p >= 3 && p[1] == c && p[2] == c)))
+					break;
+				p++;
+			}
+			if (p >= limit || *p == '\n' || *p == '\r')
+				return false;	/* the string continues in the next line */
+			p += triple ? 3 : 1;
+		}
+		else if (isIdentifierChar (c))
+		{
+			const unsigned char *word = p;
+			char buf [16];
+
+			do
+				p++;
+			while (p < limit && isIdentifierChar (*p));
+
+			if ((size_t) (p - word) < sizeof (buf))
+			{
+				keywordId keyword;
+
+				memcpy (buf, word, p - word);
+				buf [p - word] = '\0';
+				keyword = lookupKeyword (buf, Lang_python);
+				if ((keyword != KEYWORD_NONE &&
+				     keyword != KEYWORD_pass &&
+				     keyword != KEYWORD_return &&
+				     keyword != KEYWORD_as &&
+				     keyword != KEYWORD_REST) ||
+				    strcmp (buf, "SimpleNamespace") == 0)
+					return false;
+			}
+		}
+		else if (c == '(' || c == '[' || c == '{')
+		{
+			depth++;
+			p++;
+		}
+		else if (c == ')' || c == ']' || c == '}')
+		{
+			if (depth > 0)
+				depth--;
+			p++;
+		}
+		else if (c == '\n' || c == '\r' || c == '#')
+		{
+			/* an open bracket continues the statement in the next line */
+			if (depth > 0)
+				return false;
+			*end = p;
+			return true;
+		}
+		else if (c == ';' || c == '\\')
+			return false;
+		else
+			p++;
+	}
+
+	/* The last line without newline, or a character pushed back. */
+	return false;
+}
+
+/* Skip the statement at the beginning of the current line if it is in
+ * the body of a function and can make no tag.  This avoids tokenizing the
+ * most lines of a function body when local variables are not tagged. */
+static bool skipLocalStatement (void)
+{
+	NestingLevel *lv = nestingLevelsGetCurrent (PythonNestingLevels);
+	tagEntryInfo *lvEntry = getEntryOfNestingLevel (lv);
+	const unsigned char *end;
+	int c;
+
+	if (PythonKinds[K_LOCAL_VARIABLE].enabled ||
+	    lvEntry == NULL || lvEntry->kindIndex == K_CLASS ||
+	    NextToken != NULL)
+		return false;
+
+	/* The first character of the line is pushed back after reading the
+	 * indentation.  Reading it again lets us see the rest of the line. */
+	c = getcFromInputFile ();
+	if (c == EOF || InputCursor.current == NULL || InputCursor.current [-1] != c ||
+	    ! isLocalStatementInLine (InputCursor.current - 1, InputCursor.end, &end))
+	{
+		ungetcToInputFile (c);
+		return false;
 	}
+
+	InputCursor.current = end;
+	return true;
 }
 
 static void findPythonTags (void)
@@ -1777,7 +1910,11 @@ static void findPythonTags (void)
 			readToken (token);
 
 		if (token->type == TOKEN_INDENT)
+		{
 			setIndent (token);
+			if (skipLocalStatement () && PythonFields[F_DECORATORS].enabled)
+				vStringClear (decorators);
+		}
 		else if (token->keyword == KEYWORD_class ||
 		         token->keyword == KEYWORD_def)
 		{
@@ -120,7 +120,7 @@ static tagXpathTable relaxngXpathDefineNameTable [] = {
 };
 
 static tagXpathTableTable relaxngXpathTableTable[] = {
-	[TABLE_MAIN]         = { ARRAY_AND_SIZE (relaxngXpathMainTable)        },
+	[TABLE_MAIN]         = { ARRAY_AND_SIZE (relaxngXpathMainTable), .streamable = true },
 	[TABLE_ELEMENT_NAME] = { ARRAY_AND_SIZE (relaxngXpathElementNameTable) },
 	[TABLE_PATTERN]      = { ARRAY_AND_SIZE (relaxngXpathPatternTable)     },
 	[TABLE_GRAMMAR]      = { ARRAY_AND_SIZE (relaxngXpathGrammerTable)     },
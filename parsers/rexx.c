@@ -35,6 +35,7 @@ extern parserDefinition* RexxParser (void)
 	def->tagRegexTable = rexxTagRegexTable;
 	def->tagRegexCount = ARRAY_SIZE (rexxTagRegexTable);
 	def->method     = METHOD_NOT_CRAFTED|METHOD_REGEX;
+	def->lineOriented = true;
 	def->selectLanguage = selectors;
 	return def;
 }
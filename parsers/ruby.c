@@ -108,6 +108,10 @@ static void enterUnnamedScope (void);
 static bool canMatchWithEnd (const unsigned char** s, const unsigned char *end,
 							 const char* literal, bool (*end_check) (int))
 {
+	/* Most of the probes fail here. */
+	if (**s != (unsigned char) *literal)
+		return false;
+
 	const int literal_length = strlen (literal);
 	const int s_length = end - *s;
 
@@ -267,6 +271,56 @@ static bool canMatchKeywordWithAssign (const unsigned char** s, const unsigned c
 	return canMatchKeywordWithAssignFull (s, end, literal, NULL);
 }
 
+/*
+ * Returns the position of the right side of the assignment at 's',
+ * where canMatchKeywordWithAssign () looks for the keyword if it
+ * isn't at 's' itself, or NULL if 's' doesn't start an assignment.
+ * 'lhs' is set to the name assigned.
+ */
+static const unsigned char *findAssignedValue (const unsigned char* s,
+											   const unsigned char **lhs)
+{
+	advanceWhile (&s, isSigilChar);
+
+	*lhs = s;
+	if (! advanceWhile (&s, isIdentChar))
+		return NULL;
+
+	advanceWhile (&s, isWhitespace);
+
+	if (! (advanceWhile (&s, isOperatorChar) && *(s - 1) == '='))
+		return NULL;
+
+	advanceWhile (&s, isWhitespace);
+	return s;
+}
+
+/*
+ * Same as canMatchKeywordWithAssignFull (), but takes 'lhs' and 'rhs'
+ * computed with findAssignedValue () for 's' instead of scanning the
+ * left side of the assignment again. Probing the many keywords at the
+ * start of a line costs a comparison or two for each of them.
+ */
+static bool canMatchKeywordOrAssignedFull (const unsigned char** s, const unsigned char *end,
+										   const unsigned char *lhs, const unsigned char *rhs,
+										   const char* literal, vString *assignee)
+{
+	if (canMatchKeyword (s, end, literal))
+		return true;
+
+	if (rhs && canMatchKeyword (&rhs, end, literal))
+	{
+		if (assignee)
+			advanceWhileFull (&lhs, isIdentChar, assignee);
+		*s = rhs;
+		return true;
+	}
+	return false;
+}
+
+#define canMatchKeywordOrAssigned(S,END,RHS,LITERAL) \
+	canMatchKeywordOrAssignedFull ((S), (END), NULL, (RHS), (LITERAL), NULL)
+
 extern bool rubyCanMatchKeywordWithAssign (const unsigned char** s, const char* literal)
 {
 	size_t s_length = strlen ((const char *)*s);
@@ -1148,28 +1202,33 @@ static void findRubyTags (void)
 		*       unless <exp>
 		*/
 
-		if (canMatchKeywordWithAssign (&cp, lend, "for") ||
-			canMatchKeywordWithAssign (&cp, lend, "until") ||
-			canMatchKeywordWithAssign (&cp, lend, "while"))
+		const unsigned char *probed = cp;
+		const unsigned char *lhs;
+		const unsigned char *rhs = findAssignedValue (cp, &lhs);
+		if (canMatchKeywordOrAssigned (&cp, lend, rhs, "for") ||
+			canMatchKeywordOrAssigned (&cp, lend, rhs, "until") ||
+			canMatchKeywordOrAssigned (&cp, lend, rhs, "while"))
 		{
 			expect_separator = true;
 			enterUnnamedScope ();
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "case") ||
-				 canMatchKeywordWithAssign (&cp, lend, "if") ||
-				 canMatchKeywordWithAssign (&cp, lend, "unless"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "case") ||
+				 canMatchKeywordOrAssigned (&cp, lend, rhs, "if") ||
+				 canMatchKeywordOrAssigned (&cp, lend, rhs, "unless"))
 		{
 			enterUnnamedScope ();
 		}
+		if (cp != probed)
+			rhs = findAssignedValue (cp, &lhs);
 
 		/*
 		* "module M", "class C" and "def m" should only be at the beginning
 		* of a line.
 		*/
-		if (canMatchKeywordWithAssign (&cp, lend, "class")
-			|| canMatchKeywordWithAssign (&cp, lend, "module")
-			|| (canMatchKeywordWithAssignFull (&cp, lend, "Class.new", leftSide))
-			|| (canMatchKeywordWithAssignFull (&cp, lend, "Module.new", leftSide)))
+		if (canMatchKeywordOrAssigned (&cp, lend, rhs, "class")
+			|| canMatchKeywordOrAssigned (&cp, lend, rhs, "module")
+			|| (canMatchKeywordOrAssignedFull (&cp, lend, lhs, rhs, "Class.new", leftSide))
+			|| (canMatchKeywordOrAssignedFull (&cp, lend, lhs, rhs, "Module.new", leftSide)))
 		{
 			int r;
 
@@ -1227,31 +1286,31 @@ static void findRubyTags (void)
 				}
 			}
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "include"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "include"))
 		{
 			readAndStoreMixinSpec (&cp, lend, "include");
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "prepend"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "prepend"))
 		{
 			readAndStoreMixinSpec (&cp, lend, "prepend");
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "extend"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "extend"))
 		{
 			readAndStoreMixinSpec (&cp, lend, "extend");
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "def"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "def"))
 		{
 			readAndEmitDef (&cp, lend);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "attr_reader"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "attr_reader"))
 		{
 			readAttrsAndEmitTags (&cp, lend, true, false);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "attr_writer"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "attr_writer"))
 		{
 			readAttrsAndEmitTags (&cp, lend, false, true);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "attr_accessor"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "attr_accessor"))
 		{
 			readAttrsAndEmitTags (&cp, lend, true, true);
 		}
@@ -1260,19 +1319,19 @@ static void findRubyTags (void)
 			emitRubyTag (constant, K_CONST);
 			vStringClear (constant);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "require"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "require"))
 		{
 			readStringAndEmitTag (&cp, K_LIBRARY, RUBY_LIBRARY_REQUIRED);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "require_relative"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "require_relative"))
 		{
 			readStringAndEmitTag (&cp, K_LIBRARY, RUBY_LIBRARY_REQUIRED_REL);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "load"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "load"))
 		{
 			readStringAndEmitTag (&cp, K_LIBRARY, RUBY_LIBRARY_LOADED);
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "alias"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "alias"))
 		{
 			if (!readAndEmitTagFull (&cp, lend, K_ALIAS, false, true)
 				&& (*cp == '$'))
@@ -1287,9 +1346,9 @@ static void findRubyTags (void)
 				vStringDelete (alias);
 			}
 		}
-		else if (canMatchKeywordWithAssign (&cp, lend, "alias_method"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "alias_method"))
 			readMethodAndEmitTags (&cp, lend, K_ALIAS);
-		else if (canMatchKeywordWithAssign (&cp, lend, "define_method"))
+		else if (canMatchKeywordOrAssigned (&cp, lend, rhs, "define_method"))
 		{
 			int r = readMethodAndEmitTags (&cp, lend, K_METHOD);
 			/* "define_method(m)" makes a scope.
@@ -1299,11 +1358,11 @@ static void findRubyTags (void)
 			if (nl && r == nl->corkIndex)
 				expect_separator = true;
 		}
-		else if ((canMatchKeywordWithAssign (&cp, lend, "private")
-				  || canMatchKeywordWithAssign (&cp, lend, "protected")
-				  || canMatchKeywordWithAssign (&cp, lend, "public")
-				  || canMatchKeywordWithAssign (&cp, lend, "private_class_method")
-				  || canMatchKeywordWithAssign (&cp, lend, "public_class_method")))
+		else if ((canMatchKeywordOrAssigned (&cp, lend, rhs, "private")
+				  || canMatchKeywordOrAssigned (&cp, lend, rhs, "protected")
+				  || canMatchKeywordOrAssigned (&cp, lend, rhs, "public")
+				  || canMatchKeywordOrAssigned (&cp, lend, rhs, "private_class_method")
+				  || canMatchKeywordOrAssigned (&cp, lend, rhs, "public_class_method")))
 		{
 			skipWhitespace (&cp);
 			if (canMatchKeywordWithAssign (&cp, lend, "def"))
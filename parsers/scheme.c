@@ -20,6 +20,8 @@
 #include "routines.h"
 #include "vstring.h"
 
+#include "lisp.h"
+
 /*
 *   DATA DEFINITIONS
 */
@@ -52,20 +54,28 @@ static void readIdentifier (vString *const name, const unsigned char *cp)
 		vStringPut (name, *p);
 }
 
+#define SCHEME_SYNTAX (LISP_SYNTAX_BLOCK_COMMENT | LISP_SYNTAX_HASH_CHAR \
+					   | LISP_SYNTAX_BAR_SYMBOL)
+
 static void findSchemeTags (void)
 {
 	vString *name = vStringNew ();
 	const unsigned char *line;
+	const unsigned char *next = NULL;
+	lispFormScanner scanner;
 
-	while ((line = readLineFromInputFile ()) != NULL)
+	while ((line = next? next: readLineFromInputFile ()) != NULL)
 	{
 		const unsigned char *cp = line;
 
+		next = NULL;
 		if (cp [0] == '(' &&
 			(cp [1] == 'D' || cp [1] == 'd') &&
 			(cp [2] == 'E' || cp [2] == 'e') &&
 			(cp [3] == 'F' || cp [3] == 'f'))
 		{
+			lispFormScannerInit (&scanner, SCHEME_SYNTAX);
+			lispScanFormLine (&scanner, line);
 			while (*cp != '\0'  &&  !isspace (*cp))
 				cp++;
 			/* Skip over open parens and white space */
@@ -73,7 +83,11 @@ static void findSchemeTags (void)
 				while (*cp != '\0' && (isspace (*cp) || *cp == '('))
 					cp++;
 				if (*cp == '\0')
+				{
 					cp = line = readLineFromInputFile ();
+					if (line && scanner.depth > 0)
+						lispScanFormLine (&scanner, line);
+				}
 				else
 					break;
 			} while (line);
@@ -81,6 +95,11 @@ static void findSchemeTags (void)
 				break;
 			readIdentifier (name, cp);
 			makeSimpleTag (name, K_FUNCTION);
+			/* Internal defines are not tagged, and a "(define" in
+			 * column 0 of a multi-line string of the body, e.g. a usage
+			 * example, must not be taken for a top-level one. */
+			next = lispSkipForm (&scanner);
+			continue;
 		}
 		if (cp [0] == '(' &&
 			(cp [1] == 'S' || cp [1] == 's') &&
@@ -89,13 +108,19 @@ static void findSchemeTags (void)
 			(cp [4] == '!') &&
 			(isspace (cp [5]) || cp[5] == '\0'))
 		{
+			lispFormScannerInit (&scanner, SCHEME_SYNTAX);
+			lispScanFormLine (&scanner, line);
 			cp += 5;
 			/* Skip over white space */
 			do {
 				while (*cp != '\0' && isspace (*cp))
 					cp++;
 				if (*cp == '\0')
+				{
 					cp = line = readLineFromInputFile ();
+					if (line && scanner.depth > 0)
+						lispScanFormLine (&scanner, line);
+				}
 				else
 					break;
 			} while (line);
@@ -103,6 +128,7 @@ static void findSchemeTags (void)
 				break;
 			readIdentifier (name, cp);
 			makeSimpleTag (name, K_SET);
+			next = lispSkipForm (&scanner);
 		}
 	}
 	vStringDelete (name);
@@ -533,6 +533,8 @@ static void findShTagsCommon (size_t (* keyword_handler) (int,
 		int found_kind = K_NOTHING;
 		int found_role = ROLE_DEFINITION_INDEX;
 
+		/* The lines of a here document are compared only with its
+		 * delimiter; nothing in them is tagged. */
 		if (hereDocDelimiter)
 		{
 			if (hereDocIndented)
@@ -35,5 +35,6 @@ extern parserDefinition* SlangParser (void)
 	def->tagRegexTable = slangTagRegexTable;
 	def->tagRegexCount = ARRAY_SIZE (slangTagRegexTable);
 	def->method     = METHOD_NOT_CRAFTED|METHOD_REGEX;
+	def->lineOriented = true;
 	return def;
 }
@@ -19,6 +19,7 @@
 #endif
 #include <string.h>
 
+#include "bytescan.h"
 #include "debug.h"
 #include "entry.h"
 #include "keyword.h"
@@ -1132,6 +1133,170 @@ static void findCmdTerm (tokenInfo *const token, const bool check_first)
 			 ! isType (token, TOKEN_EOF));
 }
 
+/*
+ * The statements loading the rows in a database dump, like
+ *     INSERT INTO t VALUES (...), (...), ...;
+ *     COPY t (a, b) FROM stdin;
+ *     ...
+ *     \.
+ * make no tag but can be most of the input. Their data is skipped by
+ * searching for the bytes that can end it instead of reading tokens.
+ */
+static bool isBulkDataStatement (tokenInfo *const token, const char *keyword)
+{
+	return (isType (token, TOKEN_IDENTIFIER)
+			&& strcasecmp (vStringValue (token->string), keyword) == 0);
+}
+
+/* Skip to the first of the N bytes in SET, and return it. */
+static int skipToCharactersInInputFile (const unsigned char *set, unsigned int n)
+{
+	int c;
+
+	do
+	{
+		if (InputCursor.current < InputCursor.end)
+			InputCursor.current = findByteInSet (InputCursor.current, InputCursor.end,
+												 set, n);
+		c = getcFromInputFile ();
+	} while (c != EOF && memchr (set, c, n) == NULL);
+	return c;
+}
+
+/* Read the first word of a line in a skipped statement, and return
+ * whether the line starts another statement, where the terminator of
+ * the skipped one is omitted as T-SQL allows. TOKEN is set to the
+ * keyword then. */
+static bool isStatementStartLine (tokenInfo *const token)
+{
+	int c;
+
+	do
+		c = getcFromInputFile ();
+	while (c == ' ' || c == '\t');
+
+	if (isIdentChar1 (c))
+	{
+		do
+		{
+			vStringPut (token->string, c);
+			c = getcFromInputFile ();
+		} while (isIdentChar (c));
+
+		token->keyword = lookupCaseKeyword (vStringValue (token->string), Lang_sql);
+		if (isKeyword (token, KEYWORD_create)
+			|| isKeyword (token, KEYWORD_declare)
+			|| isKeyword (token, KEYWORD_begin)
+			|| isKeyword (token, KEYWORD_go))
+		{
+			ungetcToInputFile (c);
+			token->type = TOKEN_KEYWORD;
+			return true;
+		}
+		vStringClear (token->string);
+		token->keyword = KEYWORD_NONE;
+	}
+	if (c != EOF)
+		ungetcToInputFile (c);
+	return false;
+}
+
+/* Skip the rest of an INSERT statement, respecting the quotes and the
+ * comments. TOKEN is left at the semicolon ending it, or at the first
+ * keyword of the next statement. */
+static void skipInsertValues (tokenInfo *const token)
+{
+	static const unsigned char ends [] = { ';', '\'', '"', '`', '$', '-', '/', '\n' };
+	int c;
+
+	vStringClear (token->string);
+	token->keyword = KEYWORD_NONE;
+	do
+	{
+		c = skipToCharactersInInputFile (ends, ARRAY_SIZE (ends));
+		switch (c)
+		{
+			case '\n':
+				if (isStatementStartLine (token))
+					return;
+				break;
+			case '\'':
+			case '"':
+			case '`':
+				/* A doubled quote in a string is read as two strings. */
+				c = skipToCharacterInInputFile (c);
+				break;
+			case '$':
+				/* A dollar-quoted string of PostgreSQL */
+				parseDollarQuote (token->string, c, NULL);
+				vStringClear (token->string);
+				break;
+			case '-':
+			case '/':
+			{
+				int d = getcFromInputFile ();
+
+				if (c == '-' && d == '-')
+					c = skipToCharacterInInputFile ('\n');
+				else if (c == '/' && d == '*')
+				{
+					do
+					{
+						c = skipToCharacterInInputFile ('*');
+						if (c != EOF)
+						{
+							c = getcFromInputFile ();
+							if (c == '*')
+								ungetcToInputFile (c);
+						}
+					} while (c != EOF && c != '/');
+				}
+				else if (d == EOF)
+					c = EOF;
+				else
+					ungetcToInputFile (d);
+				break;
+			}
+		}
+	} while (c != ';' && c != EOF);
+
+	token->type = (c == EOF)? TOKEN_EOF: TOKEN_SEMICOLON;
+}
+
+/* Read a COPY statement, and skip the rows following it up to the line
+ * "\." if they are read from stdin. */
+static void skipCopyData (tokenInfo *const token)
+{
+	bool fromStdin = false;
+
+	do
+	{
+		readToken (token);
+		if (isBulkDataStatement (token, "stdin"))
+			fromStdin = true;
+	} while (! isCmdTerm (token) && ! isType (token, TOKEN_EOF));
+
+	if (! fromStdin || ! isType (token, TOKEN_SEMICOLON))
+		return;
+
+	/* The rows start at the next line. */
+	while (skipToCharacterInInputFile ('\n') != EOF)
+	{
+		int c = getcFromInputFile ();
+
+		if (c == '\\')
+		{
+			c = getcFromInputFile ();
+			if (c == '.')
+				return;
+		}
+		if (c == EOF)
+			break;
+		ungetcToInputFile (c);
+	}
+	token->type = TOKEN_EOF;
+}
+
 static void skipToMatched(tokenInfo *const token)
 {
 	int nest_level = 0;
@@ -3156,10 +3321,19 @@ static tokenType parseSqlFile (tokenInfo *const token)
 	do
 	{
 		enum eKeywordId k = token->keyword;
+		bool atStatementStart = isCmdTerm (token) || isType (token, TOKEN_UNDEFINED);
 		readToken (token);
 
 		if (isType (token, TOKEN_BLOCK_LABEL_BEGIN))
 			parseLabel (token);
+		else if (atStatementStart && isBulkDataStatement (token, "insert"))
+		{
+			skipInsertValues (token);
+			if (isType (token, TOKEN_KEYWORD))
+				parseKeywords (token, KEYWORD_NONE);
+		}
+		else if (atStatementStart && isBulkDataStatement (token, "copy"))
+			skipCopyData (token);
 		else
 			parseKeywords (token, k);
 	} while (! isKeyword (token, KEYWORD_end) &&
@@ -21,6 +21,7 @@
 #endif
 #include <string.h>
 
+#include "bytescan.h"
 #include "debug.h"
 #include "entry.h"
 #include "keyword.h"
@@ -71,6 +72,7 @@ enum eKeywordId {
 	KEYWORD_renewenvironment,
 	KEYWORD_newtheorem,
 	KEYWORD_newcounter,
+	KEYWORD_verb,
 };
 typedef int keywordId; /* to allow KEYWORD_NONE */
 
@@ -199,6 +201,13 @@ static const keywordTable TexKeywordTable [] = {
 	{ "renewenvironment",	KEYWORD_renewenvironment},
 	{ "newtheorem",		KEYWORD_newtheorem			},
 	{ "newcounter",		KEYWORD_newcounter			},
+	{ "verb",			KEYWORD_verb				},
+};
+
+/* The environments whose bodies are not TeX */
+static const char *const VerbatimEnvironments [] = {
+	"verbatim", "verbatim*", "Verbatim", "Verbatim*", "BVerbatim", "LVerbatim",
+	"lstlisting", "minted", "comment", "filecontents", "filecontents*",
 };
 
 /*
@@ -393,7 +402,15 @@ static void parseIdentifier (vString *const string, const int firstChar)
 	Assert (isIdentChar (c));
 	do
 	{
+		const unsigned char *p = InputCursor.current;
+
 		vStringPut (string, c);
+		/* Take the rest of the identifier in the line at once. */
+		while (p < InputCursor.end && isIdentChar (*p))
+			p++;
+		vStringNCatSUnsafe (string, (const char *) InputCursor.current,
+							p - InputCursor.current);
+		InputCursor.current = p;
 		c = getcFromInputFile ();
 	} while (c != EOF && isIdentChar (c));
 
@@ -475,6 +492,94 @@ static bool readToken (tokenInfo *const token)
 	return readTokenFull (token, false);
 }
 
+/* Skip the argument of \verb, delimited by the character after \verb or
+ * \verb* in the same line. */
+static void skipVerb (void)
+{
+	int c = getcFromInputFile ();
+
+	if (c == '*')
+		c = getcFromInputFile ();
+	if (c == EOF || c == '\n')
+		return;
+
+	if (InputCursor.current < InputCursor.end)
+	{
+		const unsigned char *p = findByte (InputCursor.current, InputCursor.end,
+										   (unsigned char) c);
+		InputCursor.current = (p < InputCursor.end)? p + 1: p;
+	}
+}
+
+static bool isVerbatimEnvironment (vString *envName)
+{
+	for (unsigned int i = 0; i < ARRAY_SIZE (VerbatimEnvironments); i++)
+		if (strcmp (vStringValue (envName), VerbatimEnvironments [i]) == 0)
+			return true;
+	return false;
+}
+
+/* Skip the body of the verbatim environment ENVNAME, leaving its \end
+ * unread. */
+static void skipVerbatimBody (vString *envName)
+{
+	vString *terminator = vStringNewInit ("end{");
+	size_t length;
+	int c;
+
+	vStringCat (terminator, envName);
+	vStringPut (terminator, '}');
+	length = vStringLength (terminator);
+
+	do
+	{
+		if (InputCursor.current < InputCursor.end)
+			InputCursor.current = findByte (InputCursor.current, InputCursor.end, '\\');
+		c = getcFromInputFile ();
+		if (c == '\\'
+			&& (size_t) (InputCursor.end - InputCursor.current) >= length
+			&& memcmp (InputCursor.current, vStringValue (terminator), length) == 0)
+		{
+			ungetcToInputFile (c);
+			break;
+		}
+	} while (c != EOF);
+
+	vStringDelete (terminator);
+}
+
+/* Skip display math to the \] closing \[, or to the $$ closing $$ if
+ * DOLLARS is true. Nothing in it is tagged. */
+static void skipDisplayMath (bool dollars)
+{
+	static const unsigned char set [] = { '\\', '$', '%' };
+	int c;
+
+	do
+	{
+		if (InputCursor.current < InputCursor.end)
+			InputCursor.current = findByteInSet (InputCursor.current, InputCursor.end,
+												 set, ARRAY_SIZE (set));
+		c = getcFromInputFile ();
+		if (c == '%')
+			skipToCharacterInInputFile ('\n'); /* % are single line comments */
+		else if (c == '\\')
+		{
+			/* \$ and \% are not special; \] closes \[. */
+			c = getcFromInputFile ();
+			if (!dollars && c == ']')
+				break;
+		}
+		else if (c == '$' && dollars)
+		{
+			c = getcFromInputFile ();
+			if (c == '$')
+				break;
+			ungetcToInputFile (c);
+		}
+	} while (c != EOF);
+}
+
 static void copyToken (tokenInfo *const dest, tokenInfo *const src)
 {
 	dest->lineNumber = src->lineNumber;
@@ -825,6 +930,9 @@ static bool parseEnv (tokenInfo *const token, bool begin, bool *tokenUnprocessed
 			eof = notifyReadingBeginEnvironment (token, envName, tokenUnprocessed);
 		else
 			eof = notifyReadingEndEnvironment (envName);
+
+		if (begin && !eof && !*tokenUnprocessed && isVerbatimEnvironment (envName))
+			skipVerbatimBody (envName);
 	}
 
  out:
@@ -1082,12 +1190,37 @@ static void parseTexFile (tokenInfo *const token)
 				case KEYWORD_newcounter:
 					eof = parseNewcounter (token, &tokenUnprocessed);
 					break;
+				case KEYWORD_verb:
+					skipVerb ();
+					break;
 				default:
 					break;
 			}
 		}
+		else if (isType (token, '\\'))
+		{
+			/* A backslash not followed by a letter. The second backslash
+			 * of \\ is read here not to start a command. */
+			int c = getcFromInputFile ();
+
+			if (c == '[')
+				skipDisplayMath (false);
+			else if (c != '\\')
+				ungetcToInputFile (c);
+		}
 		else if (isType (token, TOKEN_IDENTIFIER))
-			eof = notifyReadingIdentifier (token, &tokenUnprocessed);
+		{
+			const char *id = vStringValue (token->string);
+
+			if (id [0] == '$' && id [1] == '$')
+			{
+				if (strstr (id + 2, "$$") == NULL)
+					skipDisplayMath (true);
+			}
+			/* The subparsers are notified only of \identifiers. */
+			else if (id [0] == '\\')
+				eof = notifyReadingIdentifier (token, &tokenUnprocessed);
+		}
 		if (eof)
 			break;
 	} while (true);
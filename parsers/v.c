@@ -21,6 +21,7 @@
 #include "read.h"
 #include "numarray.h"
 #include "objpool.h"
+#include "tokenpool.h"
 #include "parse.h"
 #include "routines.h"
 #include "vstring.h"
@@ -410,8 +411,9 @@ static bool parseVType (tokenInfo *const, vString *const, int, bool, bool);
 
 static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 {
-	tokenInfo *token = xMalloc (1, tokenInfo);
-	token->string = vStringNew();
+	vString *string;
+	tokenInfo *token = allocPooledToken (sizeof (tokenInfo), &string);
+	token->string = string;
 #ifdef DEBUG
 	token->id = PS->nextTokenId++;
 #endif
@@ -420,9 +422,7 @@ static void *newPoolToken (void *createArg CTAGS_ATTR_UNUSED)
 
 static void deletePoolToken (void *data)
 {
-	tokenInfo *token = data;
-	vStringDelete (token->string);
-	eFree (token);
+	freePooledToken (data, sizeof (tokenInfo));
 }
 
 static void clearPoolToken (void *data)
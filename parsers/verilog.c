@@ -25,6 +25,7 @@
 
 #include <string.h>
 
+#include "bytescan.h"
 #include "debug.h"
 #include "entry.h"
 #include "keyword.h"
@@ -629,35 +630,16 @@ static void vUngetc (int c)
 	Ungetc = c;
 }
 
-/* Mostly copied from cppSkipOverCComment() in cpreprocessor.c.
- *
- * cppSkipOverCComment() uses the internal ungetc buffer of
- * CPreProcessor. On the other hand, the Verilog parser uses
+/* cppSkipOverCComment() in cpreprocessor.c uses the internal ungetc
+ * buffer of CPreProcessor. On the other hand, the Verilog parser uses
  * getcFromInputFile() directly. getcFromInputFile() uses just
  * another internal ungetc buffer. Using them mixed way will
  * cause a trouble. */
 static int verilogSkipOverCComment (void)
 {
-	int c = getcFromInputFile ();
-
-	while (c != EOF)
-	{
-		if (c != '*')
-			c = getcFromInputFile ();
-		else
-		{
-			const int next = getcFromInputFile ();
-
-			if (next != '/')
-				c = next;
-			else
-			{
-				c = ' ';	/* replace comment with space */
-				break;
-			}
-		}
-	}
-	return c;
+	if (skipToCharacterInInputFile2 ('*', '/') == EOF)
+		return EOF;
+	return ' ';	/* replace comment with space */
 }
 
 static int _vGetc (bool inSkipPastMatch)
@@ -740,10 +722,17 @@ static int skipWhite (int c)
 static int skipPastMatch (const char *const pair)
 {
 	const int begin = pair [0], end = pair [1];
+	/* _vGetc () does something only for these characters */
+	const unsigned char interesting [] = { begin, end, '/', '"' };
 	int matchLevel = 1;
 	int c;
 	do
 	{
+		/* Skip the other characters in the current line at once, e.g.
+		 * the port connections of an instance in a netlist. */
+		if (Ungetc == '\0' && InputCursor.current < InputCursor.end)
+			InputCursor.current = findByteInSet (InputCursor.current, InputCursor.end,
+												 interesting, ARRAY_SIZE (interesting));
 		c = _vGetc (true);
 		if (c == begin)
 			++matchLevel;
@@ -763,8 +752,15 @@ static int skipDimension (int c)
 
 static int skipToSemiColon (int c)
 {
+	static const unsigned char interesting [] = { ';', '/' };
+
 	while (c != ';' && c != EOF)
+	{
+		if (Ungetc == '\0' && InputCursor.current < InputCursor.end)
+			InputCursor.current = findByteInSet (InputCursor.current, InputCursor.end,
+												 interesting, ARRAY_SIZE (interesting));
 		c = vGetc ();
+	}
 	return c;	// ';' or EOF
 }
 
@@ -814,6 +810,9 @@ static int skipToNewLine (int c)
 
 static int skipMacro (int c, tokenInfo *token)
 {
+	if (c != '`')	// called between most identifiers; avoid making a token
+		return c;
+
 	tokenInfo *localToken = newToken ();	// don't update token outside
 	while (c == '`')	// to support back-to-back compiler directives
 	{
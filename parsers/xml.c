@@ -65,7 +65,8 @@ static void findNsPrefix (xmlNode *node,
 static tagXpathTable XmlXpathMainTable [] = {
 	{ "//*",
 	  LXPATH_TABLE_DO_RECUR,
-	  { .recurSpec = { .enter = findNsPrefix, .nextTable = TABLE_ID } }
+	  { .recurSpec = { .enter = findNsPrefix, .nextTable = TABLE_ID,
+					   .shallow = true } }
 	},
 };
 
@@ -78,7 +79,7 @@ static tagXpathTable XmlXpathIdTable [] = {
 };
 
 static tagXpathTableTable xmlXpathTableTable[] = {
-	[TABLE_MAIN] = { ARRAY_AND_SIZE (XmlXpathMainTable) },
+	[TABLE_MAIN] = { ARRAY_AND_SIZE (XmlXpathMainTable), .streamable = true },
 	[TABLE_ID]   = { ARRAY_AND_SIZE (XmlXpathIdTable) },
 };
 
@@ -39,6 +39,9 @@ struct sXmlSubparser {
 	 * calling this hook. CTX and ROOT are already used once by
 	 * the XML base parser for tagging id= and namespace related attributes.
 	 * The resource life cycle of CTX and ROOT is managed by the base parser.
+	 * When the base parser reads a large input in the streaming mode,
+	 * CTX and ROOT are NULL; findXMLTags() reads the input again for
+	 * the subparser then.
 	 */
 	void (* runXPathEngine) (xmlSubparser *s,
 							 xmlXPathContext *ctx, xmlNode *root);
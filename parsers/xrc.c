@@ -61,7 +61,7 @@ enum xrcXpathTable {
 };
 
 static tagXpathTableTable xrcXpathTableTable[] = {
-	[TABLE_MAIN] = { ARRAY_AND_SIZE(xrcXpathMainTable) },
+	[TABLE_MAIN] = { ARRAY_AND_SIZE(xrcXpathMainTable), .streamable = true },
 };
 
 /*
@@ -126,7 +126,10 @@ enum xsltXpathTable {
 	  { .recurSpec = { makeTagRecursively, TABLE_WITH_PARAM} }}	\
 
 static tagXpathTable xsltXpathMainTable[] = {
-	{ "(/*[local-name()='stylesheet']|/*[local-name()='transform'])",
+	{ "/*[local-name()='stylesheet']",
+	  LXPATH_TABLE_DO_RECUR,
+	  { .recurSpec = { makeTagRecursivelyWithVersionVerification } }},
+	{ "/*[local-name()='transform']",
 	  LXPATH_TABLE_DO_RECUR,
 	  { .recurSpec = { makeTagRecursivelyWithVersionVerification } }},
 };
@@ -253,7 +256,7 @@ static tagXpathTable xsltXpathVersionVerifyTable [] = {
 
 
 static tagXpathTableTable xsltXpathTableTable[] = {
-	[TABLE_MAIN]              = { ARRAY_AND_SIZE (xsltXpathMainTable) },
+	[TABLE_MAIN]              = { ARRAY_AND_SIZE (xsltXpathMainTable), .streamable = true },
 	[TABLE_STYLESHEET]        = { ARRAY_AND_SIZE (xsltXpathStylesheetTable) },
 	[TABLE_VERSION_VERIFY]    = { ARRAY_AND_SIZE (xsltXpathVersionVerifyTable) },
 	[TABLE_TEMPLATE]          = { ARRAY_AND_SIZE (xsltXpathTemplateTable) },
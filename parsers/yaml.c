@@ -133,6 +133,7 @@ static void ypathPushType (yamlSubparser *yaml, yaml_token_t *token);
 static void ypathPopType (yamlSubparser *yaml, yaml_token_t *token);
 static void ypathPopAllTypes (yamlSubparser *yaml, yaml_token_t *token);
 static void ypathFillKeywordOfTokenMaybe (yamlSubparser *yaml, yaml_token_t *token, langType lang);
+static bool ypathCanMatchUnder (yamlSubparser *yaml);
 
 static void ypathDefaultStateMachine (yamlSubparser *s, yaml_token_t *token)
 {
@@ -175,6 +176,35 @@ static void ypathDefaultStateMachine (yamlSubparser *s, yaml_token_t *token)
 	}
 }
 
+/* Return true if TOKEN is in a block where none of the ypath tables of
+ * S can match. Such a block is skipped as a whole: the stack of the
+ * types is not pushed, and the callbacks are not called for the tokens
+ * in it. */
+static bool ypathSkipToken (yamlSubparser *s, yaml_token_t *token)
+{
+	if (s->skippingDepth > 0)
+	{
+		if (token->type == YAML_BLOCK_SEQUENCE_START_TOKEN
+			|| token->type == YAML_BLOCK_MAPPING_START_TOKEN)
+			s->skippingDepth++;
+		else if (token->type == YAML_BLOCK_END_TOKEN
+				 && --s->skippingDepth == 0)
+			s->detectionState = YPATH_DSTAT_INITIAL;
+		return token->type != YAML_STREAM_END_TOKEN;
+	}
+
+	if (s->newTokenNotfify == NULL && s->ypathTables
+		&& (token->type == YAML_BLOCK_SEQUENCE_START_TOKEN
+			|| token->type == YAML_BLOCK_MAPPING_START_TOKEN)
+		&& !ypathCanMatchUnder (s))
+	{
+		s->skippingDepth = 1;
+		return true;
+	}
+
+	return false;
+}
+
 static void ypathDefaultNewTokenCallback (yamlSubparser *s, yaml_token_t *token)
 {
 	if (token->type == YAML_BLOCK_SEQUENCE_START_TOKEN
@@ -200,6 +230,8 @@ static void initSubparserState (yamlSubparser *yaml, langType sublang)
 {
 	yaml->ypathTypeStack = NULL;
 	yaml->detectionState = YPATH_DSTAT_INITIAL;
+	yaml->skippingDepth = 0;
+	yaml->stopped = false;
 	if (yaml->ypathTables && !yaml->compiled)
 	{
 		ypathCompileTables (sublang, yaml->ypathTables,
@@ -213,12 +245,28 @@ static void initSubparserState (yamlSubparser *yaml, langType sublang)
 	}
 }
 
+static bool isYamlTokenNeeded (bool anchorEnabled)
+{
+	subparser *sub;
+
+	if (anchorEnabled)
+		return true;
+
+	foreachSubparser(sub, false)
+	{
+		if (!((yamlSubparser *)sub)->stopped)
+			return true;
+	}
+	return false;
+}
+
 static void findYamlTags (void)
 {
 	subparser *sub;
 	yaml_parser_t yaml;
 	yaml_token_t token;
 	bool done;
+	bool anchorEnabled = isLanguageKindEnabled (getInputLanguage (), K_ANCHOR);
 
 	yamlInit (&yaml);
 
@@ -234,15 +282,25 @@ static void findYamlTags (void)
 	if (sub)
 		chooseExclusiveSubparser (sub, NULL);
 
-	done = false;
+	done = !isYamlTokenNeeded (anchorEnabled);
 	while (!done)
 	{
 		if (!yaml_parser_scan (&yaml, &token))
 			break;
 
-		handlYamlToken (&token);
+		if (anchorEnabled)
+			handlYamlToken (&token);
+		bool needed = anchorEnabled;
 		foreachSubparser(sub, false)
 		{
+			yamlSubparser *ysub = (yamlSubparser *)sub;
+
+			if (ysub->stopped)
+				continue;
+			needed = true;
+			if (ypathSkipToken (ysub, &token))
+				continue;
+
 			enterSubparser (sub);
 			if (((yamlSubparser *)sub)->newTokenNotfify)
 				((yamlSubparser *)sub)->newTokenNotfify ((yamlSubparser *)sub, &token);
@@ -261,7 +319,8 @@ static void findYamlTags (void)
 			TRACE_PRINT_NEWLINE();
 		}
 
-		if (token.type == YAML_STREAM_END_TOKEN)
+		/* No one needs the rest of the input. */
+		if (token.type == YAML_STREAM_END_TOKEN || !needed)
 			done = true;
 
 		yaml_token_delete (&token);
@@ -299,6 +358,7 @@ extern parserDefinition* YamlParser (void)
 struct ypathTypeStack {
 	yaml_token_type_t type;
 	int key;
+	size_t depth;
 	struct ypathTypeStack *next;
 };
 
@@ -369,6 +429,7 @@ static void ypathPushType (yamlSubparser *yaml, yaml_token_t *token)
 
 	s->type = token->type;
 	s->key = KEYWORD_NONE;
+	s->depth = s->next? s->next->depth + 1: 1;
 
 	if (yaml->enterBlockNotify)
 		yaml->enterBlockNotify (yaml, token);
@@ -397,15 +458,12 @@ static void ypathPopAllTypes (yamlSubparser *yaml, yaml_token_t *token)
 
 extern size_t ypathGetTypeStackDepth (yamlSubparser *yaml)
 {
-	size_t depth = 0;
-	struct ypathTypeStack *s = yaml->ypathTypeStack;
-
-	while (s) {
-		depth++;
-		s = s->next;
-	}
+	return yaml->ypathTypeStack? yaml->ypathTypeStack->depth: 0;
+}
 
-	return depth;
+extern void ypathStopTraversing (yamlSubparser *yaml)
+{
+	yaml->stopped = true;
 }
 
 static void ypathFillKeywordOfTokenMaybe (yamlSubparser *yaml, yaml_token_t *token, langType lang)
@@ -440,6 +498,40 @@ static bool ypathStateStackMatch (struct ypathTypeStack *stack,
 		return false;
 }
 
+/* Can an entry of the tables match a node in the block pushed next?
+ * The keys of the blocks on the stack don't change until the block
+ * pushed next is popped. */
+static bool ypathCanMatchUnder (yamlSubparser *yaml)
+{
+	size_t depth = ypathGetTypeStackDepth (yaml);
+
+	for (size_t i = 0; i < yaml->ypathTableCount; i++)
+	{
+		intArray *code = yaml->ypathTables[i].code;
+		size_t len = intArrayCount (code);
+		struct ypathTypeStack *stack;
+		size_t offset;
+
+		if (len <= depth)
+			continue;
+
+		/* CODE is reversed: the key for the top of the stack is at
+		 * LEN - DEPTH. */
+		for (stack = yaml->ypathTypeStack, offset = len - depth;
+			 stack;
+			 stack = stack->next, offset++)
+		{
+			int expected_key = intArrayItem (code, offset);
+			if (expected_key != KEYWORD_NONE && stack->key != expected_key)
+				break;
+		}
+		if (stack == NULL)
+			return true;
+	}
+
+	return false;
+}
+
 static void ypathHandleToken (yamlSubparser *yaml, yaml_token_t *token, int state,
 							  tagYpathTable tables[], size_t count)
 {
@@ -43,6 +43,12 @@ struct sYamlSubparser {
 		YPATH_DSTAT_LAST_VALUE,
 		YPATH_DSTAT_INITIAL,
 	} detectionState;
+
+	/* If NEWTOKENNOTFIFY is NULL, the blocks where no entry of
+	 * YPATHTABLES can match are skipped; the notify methods are not
+	 * called for them and for the tokens in them. */
+	unsigned int skippingDepth;
+	bool stopped;
 };
 
 #define YAML(S) ((yamlSubparser *)S)
@@ -50,6 +56,10 @@ struct sYamlSubparser {
 extern void attachYamlPosition (tagEntryInfo *tag, yaml_token_t *token, bool asEndPosition);
 extern size_t ypathGetTypeStackDepth (yamlSubparser *yaml);
 
+/* Tell the base parser that YAML needs no more token of the current
+ * input. */
+extern void ypathStopTraversing (yamlSubparser *yaml);
+
 /*
  * Experimental Ypath code
  */
@@ -13,7 +13,7 @@
 #include "debug.h"
 
 #define PCC_GETCHAR(auxil) getcFromInputFile()
-#define PCC_MALLCO(auxil,size) eMalloc(size)
+#define PCC_MALLOC(auxil,size) eMalloc(size)
 #define PCC_REALLOC(auxil,ptr,size) eRealloc(ptr,size)
 #define PCC_FREE(auxil,ptr) eFreeNoNullCheck((void *)ptr)
 #define PCC_ERROR(auxil) baseReportError(BASE(auxil))
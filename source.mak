@@ -17,6 +17,7 @@ MIO_SRCS  = main/mio.c
 UTIL_PUBLIC_HEADS = \
 	main/general.h		\
 	\
+	main/bytescan.h		\
 	main/fname.h		\
 	main/gcc-attr.h		\
 	main/htable.h		\
@@ -30,6 +31,7 @@ UTIL_PUBLIC_HEADS = \
 	$(NULL)
 
 UTIL_PRIVATE_HEADS = \
+	main/arena_p.h		\
 	main/routines_p.h	\
 	\
 	$(NULL)
@@ -41,6 +43,8 @@ UTIL_HEADS = \
 	$(NULL)
 
 UTIL_SRCS = \
+	main/arena.c		\
+	main/bytescan.c		\
 	main/fname.c		\
 	main/htable.c		\
 	main/numarray.c		\
@@ -67,9 +71,33 @@ UTILTEST_SRCS  = \
 	$(NULL)
 UTILTEST_OBJS = $(UTILTEST_SRCS:.c=.$(OBJEXT))
 
+UTILBENCH_HEADS = \
+	main/interval_tree_generic.h \
+	main/keyword.h \
+	main/keyword_p.h \
+	main/objpool.h \
+	main/rbtree.h \
+	main/rbtree_augmented.h \
+	\
+	$(MIO_HEADS) \
+	\
+	$(NULL)
+UTILBENCH_SRCS  = \
+	extra-cmds/utilbench.c \
+	extra-cmds/readtags-stub.c \
+	main/keyword.c \
+	main/objpool.c \
+	main/rbtree.c \
+	\
+	$(MIO_SRCS) \
+	\
+	$(NULL)
+UTILBENCH_OBJS = $(UTILBENCH_SRCS:.c=.$(OBJEXT))
+
 MAIN_PUBLIC_HEADS =		\
 	$(UTIL_PUBLIC_HEADS)	\
 	\
+	main/atom.h		\
 	main/dependency.h	\
 	main/entry.h		\
 	main/field.h		\
@@ -90,9 +118,11 @@ MAIN_PUBLIC_HEADS =		\
 	main/rbtree_augmented.h	\
 	main/read.h		\
 	main/selectors.h	\
+	main/session.h		\
 	main/strlist.h		\
 	main/subparser.h	\
 	main/tokeninfo.h	\
+	main/tokenpool.h	\
 	main/trace.h		\
 	main/types.h		\
 	main/unwindi.h  	\
@@ -105,18 +135,26 @@ LIB_PRIVATE_HEADS =		\
 	\
 	main/args_p.h		\
 	main/colprint_p.h	\
+	main/dedup_p.h		\
 	main/dependency_p.h	\
 	main/entry_p.h		\
 	main/error_p.h		\
+	main/eventtrace_p.h	\
 	main/field_p.h		\
 	main/flags_p.h		\
 	main/fmt_p.h		\
+	main/gitindex_p.h	\
+	main/globset_p.h	\
+	main/ignore_p.h		\
 	main/interactive_p.h	\
+	main/jobs_p.h		\
 	main/keyword_p.h	\
 	main/kind_p.h		\
+	main/litset_p.h		\
 	main/lregex_p.h		\
 	main/lxpath_p.h		\
 	main/main_p.h		\
+	main/manifest_p.h	\
 	main/mbcs_p.h		\
 	main/options_p.h	\
 	main/param_p.h		\
@@ -127,11 +165,16 @@ LIB_PRIVATE_HEADS =		\
 	main/ptag_p.h		\
 	main/read_p.h		\
 	main/script_p.h		\
+	main/secondary_p.h	\
+	main/shard_p.h		\
 	main/sort_p.h		\
 	main/stats_p.h		\
 	main/subparser_p.h	\
+	main/symindex_p.h	\
 	main/trashbox_p.h	\
+	main/trigram_p.h	\
 	main/utf8_str.h		\
+	main/watch_p.h		\
 	main/writer_p.h		\
 	main/xtag_p.h		\
 	\
@@ -151,20 +194,29 @@ LIB_SRCS =			\
 	$(UTIL_SRCS)			\
 	\
 	main/args.c			\
+	main/atom.c			\
 	main/colprint.c			\
+	main/dedup.c		\
 	main/dependency.c		\
 	main/entry.c			\
 	main/entry_private.c		\
 	main/error.c			\
+	main/eventtrace.c		\
 	main/field.c			\
 	main/flags.c			\
 	main/fmt.c			\
+	main/gitindex.c		\
+	main/globset.c		\
+	main/ignore.c		\
+	main/jobs.c			\
 	main/keyword.c			\
 	main/kind.c			\
+	main/litset.c			\
 	main/lregex.c			\
 	main/lregex-default.c		\
 	main/lxpath.c			\
 	main/main.c			\
+	main/manifest.c		\
 	main/mbcs.c			\
 	main/nestlevel.c		\
 	main/objpool.c			\
@@ -178,18 +230,28 @@ LIB_SRCS =			\
 	main/read.c			\
 	main/script.c			\
 	main/seccomp.c			\
+	main/secondary.c		\
 	main/selectors.c		\
+	main/session.c			\
+	main/shard.c			\
 	main/sort.c			\
 	main/stats.c			\
 	main/strlist.c			\
+	main/symindex.c		\
 	main/trace.c			\
 	main/tokeninfo.c		\
+	main/tokenpool.c		\
+	main/trigram.c		\
 	main/unwindi.c			\
 	main/utf8_str.c			\
+	main/watch.c			\
 	main/writer.c			\
 	main/writer-etags.c		\
 	main/writer-ctags.c		\
 	main/writer-json.c		\
+	main/writer-binary.c		\
+	main/writer-compressed.c	\
+	main/writer-stream.c		\
 	main/writer-xref.c		\
 	main/xtag.c			\
 	\
@@ -215,6 +277,12 @@ MINI_GEANY_SRCS = \
 	\
 	$(NULL)
 
+MINI_SESSION_HEADS =
+MINI_SESSION_SRCS = \
+	main/mini-session.c \
+	\
+	$(NULL)
+
 OPTSCRIPT_SRCS = \
 	extra-cmds/optscript-repl.c \
 	\
@@ -295,6 +363,7 @@ PARSER_HEADS = \
 	parsers/frontmatter.h \
 	parsers/iniconf.h \
 	parsers/jscript.h \
+	parsers/lisp.h \
 	parsers/m4.h \
 	parsers/make.h \
 	parsers/markdown.h \
@@ -482,6 +551,7 @@ OPTSCRIPT_DSL_OBJS = $(OPTSCRIPT_DSL_SRCS:.c=.$(OBJEXT))
 
 READTAGS_DSL_HEADS = \
 	dsl/es.h \
+	dsl/bytecode.h \
 	dsl/dsl.h \
 	dsl/formatter.h \
 	dsl/qualifier.h \
@@ -493,6 +563,7 @@ READTAGS_DSL_HEADS = \
 
 READTAGS_DSL_SRCS = \
 	dsl/es.c \
+	dsl/bytecode.c \
 	dsl/dsl.c \
 	dsl/formatter.c \
 	dsl/qualifier.c \